@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libedgelearning.pdb"
+  "libedgelearning.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edgelearning.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
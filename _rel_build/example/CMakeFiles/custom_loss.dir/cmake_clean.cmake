@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/custom_loss.dir/custom_loss.cpp.o"
+  "CMakeFiles/custom_loss.dir/custom_loss.cpp.o.d"
+  "custom_loss"
+  "custom_loss.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/custom_loss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
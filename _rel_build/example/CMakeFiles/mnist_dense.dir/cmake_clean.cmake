@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mnist_dense.dir/mnist_dense.cpp.o"
+  "CMakeFiles/mnist_dense.dir/mnist_dense.cpp.o.d"
+  "mnist_dense"
+  "mnist_dense.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mnist_dense.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_classification.dir/simple_classification.cpp.o"
+  "CMakeFiles/simple_classification.dir/simple_classification.cpp.o.d"
+  "simple_classification"
+  "simple_classification.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_classification.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
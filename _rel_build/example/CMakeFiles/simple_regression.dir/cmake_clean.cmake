@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_regression.dir/simple_regression.cpp.o"
+  "CMakeFiles/simple_regression.dir/simple_regression.cpp.o.d"
+  "simple_regression"
+  "simple_regression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
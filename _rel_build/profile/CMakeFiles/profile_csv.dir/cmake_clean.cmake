@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile_csv.dir/profile_csv.cpp.o"
+  "CMakeFiles/profile_csv.dir/profile_csv.cpp.o.d"
+  "profile_csv"
+  "profile_csv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile_csv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile_dense.dir/profile_dense.cpp.o"
+  "CMakeFiles/profile_dense.dir/profile_dense.cpp.o.d"
+  "profile_dense"
+  "profile_dense.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile_dense.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
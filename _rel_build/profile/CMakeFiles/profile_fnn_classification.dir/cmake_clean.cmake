@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile_fnn_classification.dir/profile_fnn_classification.cpp.o"
+  "CMakeFiles/profile_fnn_classification.dir/profile_fnn_classification.cpp.o.d"
+  "profile_fnn_classification"
+  "profile_fnn_classification.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile_fnn_classification.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile_fnn_regression.dir/profile_fnn_regression.cpp.o"
+  "CMakeFiles/profile_fnn_regression.dir/profile_fnn_regression.cpp.o.d"
+  "profile_fnn_regression"
+  "profile_fnn_regression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile_fnn_regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile_json.dir/profile_json.cpp.o"
+  "CMakeFiles/profile_json.dir/profile_json.cpp.o.d"
+  "profile_json"
+  "profile_json.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile_json.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/dnn/activation.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/activation.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/activation.cpp.o.d"
+  "/root/repo/source/dnn/adam_optimizer.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/adam_optimizer.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/adam_optimizer.cpp.o.d"
+  "/root/repo/source/dnn/avg_pooling.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/avg_pooling.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/avg_pooling.cpp.o.d"
+  "/root/repo/source/dnn/cce_loss.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/cce_loss.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/cce_loss.cpp.o.d"
+  "/root/repo/source/dnn/codegen.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/codegen.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/codegen.cpp.o.d"
+  "/root/repo/source/dnn/concatenate.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/concatenate.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/concatenate.cpp.o.d"
+  "/root/repo/source/dnn/convolutional.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/convolutional.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/convolutional.cpp.o.d"
+  "/root/repo/source/dnn/dense.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dense.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dense.cpp.o.d"
+  "/root/repo/source/dnn/dlgraph.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dlgraph.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dlgraph.cpp.o.d"
+  "/root/repo/source/dnn/dropout.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dropout.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/dropout.cpp.o.d"
+  "/root/repo/source/dnn/feedforward.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/feedforward.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/feedforward.cpp.o.d"
+  "/root/repo/source/dnn/fused.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/fused.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/fused.cpp.o.d"
+  "/root/repo/source/dnn/gd_optimizer.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/gd_optimizer.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/gd_optimizer.cpp.o.d"
+  "/root/repo/source/dnn/graph_passes.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/graph_passes.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/graph_passes.cpp.o.d"
+  "/root/repo/source/dnn/gru.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/gru.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/gru.cpp.o.d"
+  "/root/repo/source/dnn/layer.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/layer.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/layer.cpp.o.d"
+  "/root/repo/source/dnn/loss.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/loss.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/loss.cpp.o.d"
+  "/root/repo/source/dnn/lstm.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/lstm.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/lstm.cpp.o.d"
+  "/root/repo/source/dnn/max_pooling.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/max_pooling.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/max_pooling.cpp.o.d"
+  "/root/repo/source/dnn/model.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/model.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/model.cpp.o.d"
+  "/root/repo/source/dnn/model_file.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/model_file.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/model_file.cpp.o.d"
+  "/root/repo/source/dnn/mse_loss.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/mse_loss.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/mse_loss.cpp.o.d"
+  "/root/repo/source/dnn/optimizer.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/optimizer.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/optimizer.cpp.o.d"
+  "/root/repo/source/dnn/pipeline.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/pipeline.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/pipeline.cpp.o.d"
+  "/root/repo/source/dnn/pooling.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/pooling.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/pooling.cpp.o.d"
+  "/root/repo/source/dnn/recurrent.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/recurrent.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/recurrent.cpp.o.d"
+  "/root/repo/source/dnn/scheduler.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/scheduler.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/scheduler.cpp.o.d"
+  "/root/repo/source/dnn/tbptt.cpp" "source/dnn/CMakeFiles/edgelearning-dnn.dir/tbptt.cpp.o" "gcc" "source/dnn/CMakeFiles/edgelearning-dnn.dir/tbptt.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
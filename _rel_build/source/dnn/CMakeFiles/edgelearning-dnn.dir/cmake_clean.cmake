@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edgelearning-dnn.dir/activation.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/activation.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/adam_optimizer.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/adam_optimizer.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/avg_pooling.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/avg_pooling.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/cce_loss.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/cce_loss.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/codegen.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/codegen.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/concatenate.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/concatenate.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/convolutional.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/convolutional.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/dense.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/dense.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/dlgraph.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/dlgraph.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/dropout.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/dropout.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/feedforward.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/feedforward.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/fused.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/fused.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/gd_optimizer.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/gd_optimizer.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/graph_passes.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/graph_passes.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/gru.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/gru.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/layer.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/layer.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/loss.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/loss.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/lstm.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/lstm.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/max_pooling.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/max_pooling.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/model.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/model.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/model_file.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/model_file.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/mse_loss.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/mse_loss.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/optimizer.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/optimizer.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/pipeline.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/pipeline.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/pooling.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/pooling.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/recurrent.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/recurrent.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/scheduler.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/scheduler.cpp.o.d"
+  "CMakeFiles/edgelearning-dnn.dir/tbptt.cpp.o"
+  "CMakeFiles/edgelearning-dnn.dir/tbptt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edgelearning-dnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
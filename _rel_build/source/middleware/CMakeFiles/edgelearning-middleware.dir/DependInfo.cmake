@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/middleware/fnn.cpp" "source/middleware/CMakeFiles/edgelearning-middleware.dir/fnn.cpp.o" "gcc" "source/middleware/CMakeFiles/edgelearning-middleware.dir/fnn.cpp.o.d"
+  "/root/repo/source/middleware/layer_descriptor.cpp" "source/middleware/CMakeFiles/edgelearning-middleware.dir/layer_descriptor.cpp.o" "gcc" "source/middleware/CMakeFiles/edgelearning-middleware.dir/layer_descriptor.cpp.o.d"
+  "/root/repo/source/middleware/rnn.cpp" "source/middleware/CMakeFiles/edgelearning-middleware.dir/rnn.cpp.o" "gcc" "source/middleware/CMakeFiles/edgelearning-middleware.dir/rnn.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edgelearning-middleware.dir/fnn.cpp.o"
+  "CMakeFiles/edgelearning-middleware.dir/fnn.cpp.o.d"
+  "CMakeFiles/edgelearning-middleware.dir/layer_descriptor.cpp.o"
+  "CMakeFiles/edgelearning-middleware.dir/layer_descriptor.cpp.o.d"
+  "CMakeFiles/edgelearning-middleware.dir/rnn.cpp.o"
+  "CMakeFiles/edgelearning-middleware.dir/rnn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edgelearning-middleware.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
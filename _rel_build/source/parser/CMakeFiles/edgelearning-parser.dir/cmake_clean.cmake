@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edgelearning-parser.dir/parser.cpp.o"
+  "CMakeFiles/edgelearning-parser.dir/parser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edgelearning-parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_compact_dataset.dir/test_compact_dataset.cpp.o"
+  "CMakeFiles/test_compact_dataset.dir/test_compact_dataset.cpp.o.d"
+  "test_compact_dataset"
+  "test_compact_dataset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_compact_dataset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
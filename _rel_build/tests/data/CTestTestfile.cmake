@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/data
+# Build directory: /root/repo/_rel_build/tests/data
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_dataset "test_dataset")
+set_tests_properties(test_dataset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/data/CMakeLists.txt;8;add_test;/root/repo/tests/data/CMakeLists.txt;0;")
+add_test(test_compact_dataset "test_compact_dataset")
+set_tests_properties(test_compact_dataset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/data/CMakeLists.txt;8;add_test;/root/repo/tests/data/CMakeLists.txt;0;")
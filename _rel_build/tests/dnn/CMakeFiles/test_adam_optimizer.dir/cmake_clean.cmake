@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_adam_optimizer.dir/test_adam_optimizer.cpp.o"
+  "CMakeFiles/test_adam_optimizer.dir/test_adam_optimizer.cpp.o.d"
+  "test_adam_optimizer"
+  "test_adam_optimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_adam_optimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
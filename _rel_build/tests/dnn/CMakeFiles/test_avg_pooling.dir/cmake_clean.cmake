@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_avg_pooling.dir/test_avg_pooling.cpp.o"
+  "CMakeFiles/test_avg_pooling.dir/test_avg_pooling.cpp.o.d"
+  "test_avg_pooling"
+  "test_avg_pooling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_avg_pooling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cce_loss.dir/test_cce_loss.cpp.o"
+  "CMakeFiles/test_cce_loss.dir/test_cce_loss.cpp.o.d"
+  "test_cce_loss"
+  "test_cce_loss.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cce_loss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_concatenate.dir/test_concatenate.cpp.o"
+  "CMakeFiles/test_concatenate.dir/test_concatenate.cpp.o.d"
+  "test_concatenate"
+  "test_concatenate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_concatenate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dlgraph.dir/test_dlgraph.cpp.o"
+  "CMakeFiles/test_dlgraph.dir/test_dlgraph.cpp.o.d"
+  "test_dlgraph"
+  "test_dlgraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dlgraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dlmath.dir/test_dlmath.cpp.o"
+  "CMakeFiles/test_dlmath.dir/test_dlmath.cpp.o.d"
+  "test_dlmath"
+  "test_dlmath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dlmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gd_optimizer.dir/test_gd_optimizer.cpp.o"
+  "CMakeFiles/test_gd_optimizer.dir/test_gd_optimizer.cpp.o.d"
+  "test_gd_optimizer"
+  "test_gd_optimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gd_optimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
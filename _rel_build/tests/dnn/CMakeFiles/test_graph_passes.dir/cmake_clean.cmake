@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_graph_passes.dir/test_graph_passes.cpp.o"
+  "CMakeFiles/test_graph_passes.dir/test_graph_passes.cpp.o.d"
+  "test_graph_passes"
+  "test_graph_passes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_graph_passes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
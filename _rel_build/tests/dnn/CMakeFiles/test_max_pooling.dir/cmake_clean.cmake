@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_max_pooling.dir/test_max_pooling.cpp.o"
+  "CMakeFiles/test_max_pooling.dir/test_max_pooling.cpp.o.d"
+  "test_max_pooling"
+  "test_max_pooling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_max_pooling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
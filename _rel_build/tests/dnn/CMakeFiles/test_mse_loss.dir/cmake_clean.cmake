@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mse_loss.dir/test_mse_loss.cpp.o"
+  "CMakeFiles/test_mse_loss.dir/test_mse_loss.cpp.o.d"
+  "test_mse_loss"
+  "test_mse_loss.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mse_loss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
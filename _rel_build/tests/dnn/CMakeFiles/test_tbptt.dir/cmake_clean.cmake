@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tbptt.dir/test_tbptt.cpp.o"
+  "CMakeFiles/test_tbptt.dir/test_tbptt.cpp.o.d"
+  "test_tbptt"
+  "test_tbptt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tbptt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,56 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dnn
+# Build directory: /root/repo/_rel_build/tests/dnn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_dlmath "test_dlmath")
+set_tests_properties(test_dlmath PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_dlgraph "test_dlgraph")
+set_tests_properties(test_dlgraph PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_layer "test_layer")
+set_tests_properties(test_layer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_loss "test_loss")
+set_tests_properties(test_loss PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_cce_loss "test_cce_loss")
+set_tests_properties(test_cce_loss PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_mse_loss "test_mse_loss")
+set_tests_properties(test_mse_loss PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_dense "test_dense")
+set_tests_properties(test_dense PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_activation "test_activation")
+set_tests_properties(test_activation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_recurrent "test_recurrent")
+set_tests_properties(test_recurrent PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_lstm "test_lstm")
+set_tests_properties(test_lstm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_gru "test_gru")
+set_tests_properties(test_gru PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_convolutional "test_convolutional")
+set_tests_properties(test_convolutional PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_max_pooling "test_max_pooling")
+set_tests_properties(test_max_pooling PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_avg_pooling "test_avg_pooling")
+set_tests_properties(test_avg_pooling PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_dropout "test_dropout")
+set_tests_properties(test_dropout PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_concatenate "test_concatenate")
+set_tests_properties(test_concatenate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_model "test_model")
+set_tests_properties(test_model PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_codegen "test_codegen")
+set_tests_properties(test_codegen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_tbptt "test_tbptt")
+set_tests_properties(test_tbptt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_pipeline "test_pipeline")
+set_tests_properties(test_pipeline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_graph_passes "test_graph_passes")
+set_tests_properties(test_graph_passes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_model_file "test_model_file")
+set_tests_properties(test_model_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_optimizer "test_optimizer")
+set_tests_properties(test_optimizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_gd_optimizer "test_gd_optimizer")
+set_tests_properties(test_gd_optimizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
+add_test(test_adam_optimizer "test_adam_optimizer")
+set_tests_properties(test_adam_optimizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dnn/CMakeLists.txt;32;add_test;/root/repo/tests/dnn/CMakeLists.txt;0;")
@@ -0,0 +1,132 @@
+// Generated by EdgeLearning from model "branches".
+// Self-contained inference code: no heap allocation.
+//
+// layer0: a (Dense 4 -> 2)
+// layer1: b (Dense 4 -> 3)
+// layer2: b_elu (Elu 3 -> 3)
+// layer3: concat (Concatenate 2 -> 5)
+// layer4: head (Dense 5 -> 2)
+// layer5: head_softmax (Softmax 2 -> 2)
+
+#include <cmath>
+#include <cstddef>
+
+namespace from_model {
+
+using NumType = double;
+
+constexpr std::size_t INPUT_SIZE = 4;
+constexpr std::size_t OUTPUT_SIZE = 2;
+
+namespace {
+
+constexpr NumType layer0_weights[8] = {
+    0.23948876381057244, 0.35205934133659122, 0.080766403627429581, -0.065673624363064467,
+    0.24606681498467853, -0.12884152795400453, -0.27363778424934826, 0.62605477055708214,
+};
+
+constexpr NumType layer0_biases[2] = {
+    0.01, 0.01,
+};
+
+constexpr NumType layer1_weights[12] = {
+    0.23948876381057244, 0.35205934133659122, 0.080766403627429581, -0.065673624363064467,
+    0.24606681498467853, -0.12884152795400453, -0.27363778424934826, 0.62605477055708214,
+    0.20485297007207093, 0.081711383812759233, 0.23891750882273788, 0.20063008279537248,
+};
+
+constexpr NumType layer1_biases[3] = {
+    0.01, 0.01, 0.01,
+};
+
+constexpr NumType layer4_weights[10] = {
+    0.2142052622911326, 0.31489144773696787, 0.072239667523647258, -0.058740275361839386,
+    0.22008885012504201, -0.1152393659320374, -0.24474907471758559, 0.55996040984146778,
+    0.18322606658955223, 0.073084883496362232,
+};
+
+constexpr NumType layer4_biases[2] = {
+    0.01, 0.01,
+};
+
+void dense(NumType* dst, const NumType* src, const NumType* weights,
+           const NumType* bias, std::size_t input_size, std::size_t output_size)
+{
+    for (std::size_t i = 0; i < output_size; ++i)
+    {
+        dst[i] = bias[i];
+        for (std::size_t j = 0; j < input_size; ++j)
+        {
+            dst[i] += weights[(i * input_size) + j] * src[j];
+        }
+    }
+}
+
+void elu(NumType* dst, const NumType* src, std::size_t length, NumType alpha)
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] = src[i] > 0 ? src[i] : alpha * (std::exp(src[i]) - 1);
+    }
+}
+
+void stable_softmax(NumType* dst, const NumType* src, std::size_t length)
+{
+    NumType d = src[0];
+    for (std::size_t i = 1; i < length; ++i)
+    {
+        if (d < src[i]) d = src[i];
+    }
+    NumType sum_exp_z{0};
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] = std::exp(src[i] - d);
+        sum_exp_z += dst[i];
+    }
+    NumType inv_sum_exp_z = NumType{1} / sum_exp_z;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] *= inv_sum_exp_z;
+    }
+}
+
+void concatenate_slice(NumType* dst, const NumType* src, std::size_t offset,
+                       std::size_t block, std::size_t stride, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (std::size_t j = 0; j < block; ++j)
+        {
+            dst[offset + (i * stride) + j] = src[(i * block) + j];
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * \brief Model inference.
+ * \param input  Array of INPUT_SIZE elements.
+ * \param output Array of OUTPUT_SIZE elements.
+ */
+void predict(const NumType* input, NumType* output)
+{
+    NumType buffer0[2];
+    NumType buffer1[5];
+    NumType buffer2[3];
+    // a (Dense).
+    dense(buffer0, input, layer0_weights, layer0_biases, 4, 2);
+    // b (Dense).
+    dense(buffer1, input, layer1_weights, layer1_biases, 4, 3);
+    // b_elu (Elu).
+    elu(buffer2, buffer1, 3, 0.5);
+    // concat (Concatenate).
+    concatenate_slice(buffer1, buffer0, 0, 2, 5, 1);
+    concatenate_slice(buffer1, buffer2, 2, 3, 5, 1);
+    // head (Dense).
+    dense(buffer0, buffer1, layer4_weights, layer4_biases, 5, 2);
+    // head_softmax (Softmax).
+    stable_softmax(output, buffer0, 2);
+}
+
+} // namespace from_model
@@ -0,0 +1,5433 @@
+// Generated by EdgeLearning from model "classifier".
+// Self-contained inference code: no heap allocation.
+//
+// layer0: h1 (Dense 4 -> 200)
+// layer1: h1_relu (Relu 200 -> 200)
+// layer2: h2 (Dense 200 -> 100)
+// layer3: h2_relu (Relu 100 -> 100)
+// layer4: out (Dense 100 -> 2)
+// layer5: out_softmax (Softmax 2 -> 2)
+
+#include <cmath>
+#include <cstddef>
+
+namespace from_json {
+
+using NumType = double;
+
+constexpr std::size_t INPUT_SIZE = 4;
+constexpr std::size_t OUTPUT_SIZE = 2;
+
+namespace {
+
+constexpr NumType layer0_weights[800] = {
+    0.33872599476794213, 0.49808351585619787, 0.11417692873830754, -0.092841333911293941,
+    0.34743771564136028, -0.18283374889719886, -0.38731315363137081, 0.88460826003010085,
+    0.29032263827924687, 0.11628024202497132, 0.33836811086417351, 0.28427567380519719,
+    0.82242835197495467, 0.28412057678815261, 0.52810317287354125, -0.32537038233988941,
+    0.98441947638745408, -0.87860678438896322, -0.050512969391688402, -0.9358645828980825,
+    -1.5761273564607454, 0.11175143816469449, -0.45630791022173162, 0.50403429050687032,
+    -0.28051249848171744, -0.11321053618758627, 0.47678147995022846, 0.68755504647206467,
+    0.32399305542789858, 1.2814606525427086, 0.29902466487295398, 0.50696569972367678,
+    1.1874487029437562, 0.57400465316597904, 0.59085044255549546, -0.50437236043387157,
+    0.29005011832184507, -0.24315952940268767, -1.1500715097959964, -0.4497129620636317,
+    0.044308726095485085, 0.51408134179807008, 0.86853154617731054, -0.30292131777262066,
+    0.50709896090387763, -0.3936957405505927, 0.23314501629336326, -0.38364865112807861,
+    -0.28842870682917798, -0.14728073218083523, 0.13723974464204713, -0.23992409447527999,
+    -0.65704735611807041, 2.1477447266225687, -1.053666931018306, 1.2503461237352989,
+    1.2479041140140243, -1.4807294116046101, 0.50642780215640126, -0.090313839803845691,
+    0.3406377038293576, 0.31691038287560419, -0.22814076792299265, -0.23868861167238151,
+    0.27921631368152139, 0.84520377180653194, -0.35389462470864935, -0.68122230759057734,
+    -0.80644557289179641, 0.82892995405693559, -0.5331246392057718, 0.6883880935227249,
+    -0.80987866886400406, 0.70470570097516316, 1.0269414799871035, 0.47653237287233774,
+    -0.42217581711034813, 0.083426996175195514, 0.1264390090915388, -0.002893085422152223,
+    0.74645415729102527, -0.63312447952447448, 0.85839448214767589, 0.20700678241504133,
+    -0.46015004345456123, 0.46259538678817319, 0.29835785513314578, -0.91236591186332872,
+    -0.74596676628469716, 0.1066176481481883, -0.045261033531443576, -0.29374818465864733,
+    -0.14632013277716688, -0.11256733997788793, 0.36247916597959706, 0.0025007835580966487,
+    -0.063184021495521575, 0.12009626052014688, 0.15893189366985822, -0.32897308707007128,
+    0.65275272613287449, 0.54005063019037058, 0.0058283808967652829, 0.11229786478137617,
+    -0.36663793502412029, 0.81908313912726172, -0.27462488028825116, 0.52026934490605181,
+    -0.060437183795258767, 0.22930100957263261, -1.3698362556015411, 0.11397345683106336,
+    0.34955020959061556, -0.27649372963092395, -1.0906891150554625, -0.84783695560089245,
+    0.68896659770900326, 0.36579531208896243, -0.17462773818196492, 2.2541339964000402,
+    -0.77820936453785761, 0.014698405521174285, 0.27106081870796389, -0.62945765149985344,
+    -0.60487629387009134, 1.1932388215602574, -0.47625416780018548, -0.32400595015896166,
+    -0.43003346756962924, 0.69057567548279775, -0.058644536267865574, 0.63966692677074166,
+    -0.18457734429291073, 0.75857784821386864, -0.0070961226866068363, -1.430159610062959,
+    1.0258601797604687, 0.80286703331516063, 1.0864071653728649, -0.40361721552401481,
+    0.033946645097414553, 0.83212980437783568, 1.3142672758694356, 0.21475251906878431,
+    1.1090460603114991, 0.50318239722583724, 0.34409115150215869, -0.82237103945813039,
+    0.22511677465910881, -0.12524472711816928, 1.1231235144342504, 0.33642292071479774,
+    0.071555623336534202, 0.088679805178470877, -0.11285033769222796, -1.3497434293489574,
+    -1.2577261998444687, 0.15750790013007229, 1.0788681446336748, -0.15684130386766112,
+    -0.40976933594158194, -1.9709164236798273, 0.018429058339336897, -0.66822266410005104,
+    0.37291074340859931, 0.3883101772418896, -0.19948889377586104, 0.60742972609705725,
+    0.068421144595951819, 0.78467640142028672, -0.3619592960264586, -0.63813749555931476,
+    -0.28129563476222913, -0.18567955841851613, -0.064731331734174627, -1.7554849968660318,
+    -0.23799612071060688, -0.22893349035894758, -1.0331100909284625, -0.45877730776768838,
+    -0.28421289653755355, 0.39697539194711251, 0.25562509670367745, 0.15727597419482739,
+    1.6252476118518109, 1.3148769649403658, -0.35221377693129985, 0.75512979302571315,
+    0.48304032700981087, 0.48692079800193006, -0.52627492262943221, 0.48835400547411695,
+    -1.1683106805254952, -0.33850110373334252, 0.094484931362642063, -0.079187363766826849,
+    0.12320613330692201, 0.516170859479675, -0.50809192390886027, -0.18461467687753313,
+    -0.33750787066385129, -0.52381106461793714, -0.01001445273703634, 0.1707969956122343,
+    0.5812963395220877, 0.077111992038948682, 0.29184198591251165, 0.2533935665991936,
+    -0.47236339862962229, -0.62708429224200513, 0.62883785863199093, -1.2049382687413317,
+    0.61172440618047352, 0.73802372850345821, 1.145201475863757, 0.94118014271222084,
+    -0.07605893900655554, -0.22046863961821675, 0.37631821603241589, 0.14064708874811843,
+    0.52827240414280263, -0.81790873509375839, 0.77483576966932122, -1.4035831195998543,
+    -0.19577929296959964, 0.3143793392654593, -0.97824074752281009, -0.083488466589194565,
+    -0.79386406599307602, -0.086670818451864015, -0.37684873633821758, 0.52741028579009852,
+    -0.65970060904734529, -0.41659770271926161, 0.74940123287703786, 0.33083938797099854,
+    0.10003298762768764, 0.40813373717729667, -0.24764266224233297, 0.28900584517797678,
+    0.44862983893447728, -1.0884593960181594, -0.25160677339145698, 0.45266792694936958,
+    0.50508772951878844, -1.7935775305170485, -1.0596200715794817, -0.52271820973773075,
+    -0.0075317384872819566, 0.51650927649408807, -0.61458073307589034, 1.3378905874149545,
+    0.19182478815471854, -0.060085997705072947, -0.33296829883612111, -0.24981689114232977,
+    0.44513232668677172, -0.12081309062880348, 0.27881567556267112, 0.21498401967161779,
+    1.0553669258299132, -0.52823423972664441, 0.65421306026486425, 0.011586784458336215,
+    -0.58588266503143804, -1.168872788678101, -0.27170068870464437, -1.3562067979328838,
+    -0.064091815661952822, -0.07759761692261298, -0.57715729509597524, 0.42610211461320058,
+    -0.093371045426806673, -0.48638838645489507, -0.043837945463708283, -0.45412015309105569,
+    -0.31215984997450819, 1.522058184571172, 0.66636219645368977, -1.4034704479982152,
+    -0.64939115213882614, 1.050475573185353, -0.98326089896143787, -0.32385911578706478,
+    -0.065483961211554753, 1.2289231984849873, 0.33515448695521494, 0.8088064159097077,
+    -0.48005505362529782, 0.48262438060064539, -0.60609340896626884, 0.16537373900139873,
+    -0.23914507187707174, 0.76681830840206544, -0.25446266657535921, 0.50445894044345108,
+    -0.71395674241103058, -0.98440741060149572, 0.91982966078225914, 0.25580482716481534,
+    -0.79964172940657074, -0.093508903714625599, 0.47473886743236943, -0.21238974294678839,
+    0.80180137244260397, 0.74181408834591667, 0.18582689600977603, -0.1226253304365774,
+    -0.65204477783497083, 0.42355896125238657, 1.417477697998101, -0.90126640458032381,
+    -0.54118008670230822, 0.99661216522430351, 0.063368654328523843, -0.071547270493086554,
+    0.10181331371676461, -0.58359710577110402, 0.20318479364481301, 0.33044268640599306,
+    -0.82211352554296868, 0.1770609641232001, 0.52456507737137514, 0.14139426839892114,
+    0.16488922886374599, -0.017764926194790934, 0.5711405521639874, -0.41870793745740614,
+    0.44051230312632028, 0.98275527983969935, -0.29166214108710087, 0.84835261924425276,
+    -0.83380197774736065, 0.22325292849409023, -1.0431080016594132, -0.90628142326236938,
+    -0.50288475339919025, -0.0027337428016400009, -0.17394566580398665, 0.21070350736182897,
+    0.008707518040264043, -1.4010895043078349, -0.15970025231148555, 0.10966777660767228,
+    -0.813956120068421, 1.5457059198626562, -0.65704629245255308, -0.91421885323077834,
+    1.0711411839433751, 1.6397084924324596, 0.65281311835584543, 1.0908449155391851,
+    0.97016898620856351, 1.1944446838317493, 0.57769097574577977, -0.68947043738313363,
+    -0.16760495105251325, 0.22296277170127018, -0.32182851339116852, 0.12232693960217066,
+    0.15905255178609815, 0.22987068678429104, 0.8679320328772836, -1.2158014146235843,
+    -0.80231680750972734, 0.64182261572321397, -0.42281457662114169, 1.2815000405746895,
+    0.075050751088466108, 0.13121224416658178, 0.88866566031004202, 0.22258309287390898,
+    -0.14268534437639352, -0.32321512298217797, -1.5423125563526603, -0.66071533039699282,
+    0.2353227195772595, 0.83136455121500419, -0.55442719565995779, -0.52212189921139074,
+    -0.092462245826333916, 0.8085458882436215, 0.19566340708054186, 1.1016122887388098,
+    0.081123271401021685, 0.23663701615142804, -0.32028393822658324, -1.1217355111624674,
+    -1.2350407711572688, 0.56114389603913173, 0.2680470628423719, 0.58053972904740059,
+    0.088352930947855804, -1.0498978864973671, -0.15492410454756408, 1.204050106275913,
+    -0.32334560687838049, -0.052959619399437885, 0.20887974224010644, 1.1819580743977864,
+    0.82471229419031822, 0.55667065495179846, -0.13810864481037521, -0.43855764701954703,
+    0.20990205952424859, 0.026775273634035441, 0.2230296859923187, 1.3468793457138639,
+    -0.41723802435886209, -0.063443524882463728, 1.6161798945167174, 1.1582595280593209,
+    0.91391072407287388, -0.2761228076925884, 0.31432027442057225, -0.27337396995470215,
+    0.5118752486656698, -0.71610416744278804, -0.31899991994475668, 0.97384798815646489,
+    0.21077074807064691, -0.34102171769035733, 0.71679322083868702, 0.87910516563013219,
+    0.10801756306731644, 1.4268466179823751, -0.0023495142682671273, -0.51670562091123873,
+    0.88364706616917832, -0.78076657544612693, -0.49794796951671516, 0.81270050720374698,
+    -0.46734886825933408, 0.42576499000536011, -1.0088609375707713, -1.5547243363865229,
+    0.2772010412738371, -0.43017611593069305, -0.31799657431002465, 0.2746061593633698,
+    0.62370352360100056, 0.8486415374895625, 1.4239563707064093, 0.38098208088194258,
+    -0.43727699060732883, -1.2360659987350771, 0.50265425348150583, -0.59224434940437531,
+    0.48151764285283194, 0.92492779475812359, 0.67170829722668979, -0.65669315312376642,
+    0.33948275572116632, 0.0056247980845519742, 0.79089435706164235, -0.097415171804633008,
+    0.023110303912243002, -0.53404938692164583, -0.53863604223635309, -0.58982198744436887,
+    -0.42904434520598744, -0.66594427276044532, -0.33416367920343981, 0.14784047990958096,
+    0.95411970163620963, 0.71960858576975983, -0.32394721561593492, 1.0658258717018194,
+    0.5778261459278643, 0.45945788683540345, 0.013400865888525413, 0.51823187004382731,
+    -1.0984483574576316, -0.35666161835330373, 1.286141665993241, -0.26072682611012082,
+    -0.063114311590583505, 0.93773154170132345, -0.72993245019230057, 0.70919568694690938,
+    -0.506635575414765, 0.77302084543791527, 0.63151436503620828, -0.35585400919005583,
+    -0.9046609035333617, -0.47597102126546253, 0.18960936167743173, 0.16592209992602613,
+    -0.71724291203746093, -0.35579510468089182, 0.81243247625821213, 0.48705353084202313,
+    0.11486919563618518, 0.68593715172256053, 1.4811972948853842, -0.74593964569954885,
+    0.41599231839545192, 1.7181659159902443, -0.013861755828849387, 0.4571337868887092,
+    -0.37980846784580657, 0.41854665456164364, -1.3589981962927147, 0.49437824378442047,
+    -0.0087013829689906157, 0.75203083326052644, 0.17562899353709766, 0.29465404041496823,
+    0.58003120008131082, -0.54174683246456157, -0.99146644416635232, 0.23763601522141903,
+    0.26760420188712092, -0.11822937896317803, 0.19888338088052204, -0.24424048164922382,
+    0.034874458350184719, -0.8165521075384975, -0.74715343489890829, 0.37372864583166227,
+    0.33912677925212081, 1.122364310335781, 0.33325379316292297, 0.41626040028817507,
+    -0.84132055905957515, -0.11905524614382357, -1.6352280079443857, -0.31078344860824653,
+    1.3347936081206837, -0.16130571010183176, -1.0340515769894494, -1.0130856659097796,
+    0.10952621513611639, -0.83491917650088143, -0.10566154606787231, -0.52527381560940001,
+    -0.10910349273541424, -1.2110683046678852, 0.17778735272868276, -0.11367834810593656,
+    -0.27063962142096348, -0.086221685068379461, 0.9321560079029364, -1.1201292120447577,
+    0.6857590235290647, 0.60687947535729392, 0.14468653047760771, -0.07435181507151653,
+    0.24739492205994287, -0.0065910761727250595, 0.062356908814446124, -0.73001707490351619,
+    -1.235823543310985, -0.014592901650147662, 1.0251249093474901, 0.62755525677565527,
+    -0.5520530153624853, 0.45293690341936477, 1.1642514720198549, -0.11043278207813979,
+    0.27492475847977976, -0.13504340364878212, -0.33727057644772274, 0.7292057135135952,
+    0.082286525776491801, -0.33004690495963113, -0.44439409190268747, 0.74352722355994016,
+    -0.0026493806810279855, -0.54017928293637418, 0.37455550812448035, 0.68324340562265717,
+    0.89474356536189426, -0.4904143826192921, -1.1440740103549176, 0.71263362872355729,
+    -0.68329445698375957, -1.9273319281626908, -0.90688508798852863, 0.89585312492347791,
+    -0.40608709676704113, 0.23836891899655685, 0.87608365883727823, 0.96763037053814627,
+    1.010636051132987, 0.99534853642580301, 0.12869159272680836, -1.5954881223625503,
+    -0.24908051960423699, -0.64188209627875548, 0.22476666592548905, -0.75866150749817218,
+    0.95824887312965934, 0.079399650431978788, 0.22967828428506984, -0.88102079326669114,
+    -0.38494526460181394, -0.66210971933162022, -0.25845016445464963, -0.46594124392588615,
+    -0.99242404293873765, 0.10498300913520033, 0.21760594206237052, 0.74679001450837024,
+    -0.020736753411020624, -0.11629753900956441, -0.78762532734917812, 0.26726646492109757,
+    -1.7824999966731556, -0.53038318049839195, 0.92072761113942037, 0.47370485239168075,
+    -1.0091832635289659, 0.3951000945912273, -0.31400356631698573, -0.2227314045345016,
+    -1.3483510779902004, 0.1000141401516693, -0.32850350797607092, 0.31370920663848556,
+    -0.72930152144897853, 0.84069606972303235, -0.04616928995376391, 0.69054131926792517,
+    0.96966022239826877, -0.42435486846326115, -0.6204917063023343, -0.54583305787770209,
+    -0.14334125273135692, 0.14374341562144247, -0.039853717353370309, -0.47223814149770027,
+    0.22821207441974112, -0.90014336471567136, -1.163041487711419, 0.5068063982008354,
+    -0.14922932039153941, 0.90070473486450087, 0.58361378000678443, 0.19143327111572184,
+    -0.38158570913922152, -0.29305962214468917, -0.24853351300067617, -0.27496181648398943,
+    0.41033788781778174, 0.38884918839880017, 0.74939897331036842, 1.2445725946891772,
+    0.038935249733439134, -0.0031064416843784399, 0.78405879662619504, -1.4720879632431398,
+    -0.78360293454925201, 0.094213277909562784, 0.46370594258009068, 0.17291818596305011,
+    0.48157063424461655, 0.51643949622536989, -0.60346070184354694, -1.2715009429185786,
+    -0.20336443798866835, 0.26836992162205486, -0.69286472965827317, -0.81630599722482788,
+    0.40124675794745684, 1.0054440287432498, 0.68133324633740722, 0.52487011972672981,
+    0.49803540176428462, 0.7272323224114543, -0.66180965703552286, -0.34205715201771159,
+    0.45838961404360762, -0.17762121195583491, 0.1027844316798408, 1.0774322043470141,
+    0.11660232542348398, -1.1300811605359369, 0.1583004278504995, 0.23507325820673627,
+    0.46581204712169477, 0.21404263440674087, 0.83703263341559198, 0.97497705413529179,
+    0.16465110754829554, -0.082096015153654001, 0.20245679303053923, -1.0365607600373719,
+    0.1047881633198994, 0.36123408518421052, 0.1022239297401777, 1.0122874037239828,
+    0.56784219781032119, 0.49934374163749562, -0.48082491061700455, -0.72368511648987233,
+    -0.85739263889409412, 0.31353455493776072, -0.29067681041157162, 0.82455541862139647,
+    0.16495100396494936, -0.92268770267510758, -0.16160737417357043, 1.0392358437479257,
+    -0.22283137280497303, 0.36446348092082642, -0.45480283057332876, -0.52060559067400625,
+    -1.4621632121007542, 0.56606535010234194, -0.8975487444648802, -0.57316779123593242,
+    -1.3550184393217752, 0.57402708536876368, 0.40504179661156431, -0.16676678707446724,
+    -0.084029429901079894, 0.18132443270386278, -0.38815303497327736, 0.58738111573176954,
+    -0.11407182959409642, 0.40473252802894588, 0.43514005043556686, -0.85491340827105611,
+    0.56079306968106435, 0.038390939692428502, 0.5098770122178321, -0.56130140845584686,
+    -1.2451693814448745, -0.95408259538331597, 0.087231469910610537, -0.23653346667772907,
+    -0.5719120357310099, -0.79948193991147709, 1.0876689397252004, -0.16612292958627725,
+    0.44534115147882031, 0.70742109679767706, -0.34765381467453998, 0.65772642940161574,
+    0.40292501856715773, -0.44123494049688278, -0.56054369140160165, 0.59541401337650401,
+    -1.8331230662869915, -0.38633172021863549, 0.82628489994052101, 0.71515792677079226,
+    -1.3651174418349823, -0.65882157127884822, 0.17628884077381288, 0.36728116212087558,
+    -0.32365370024849321, 1.1038231447609899, -0.9671039182526755, 0.23454347201927458,
+    -0.66918218992395184, 0.10543647784316235, -0.62721858620837478, -0.07315776124154276,
+    -0.76942360139291299, -0.38531876950515725, 0.74776200666891823, 0.23990929037531514,
+    1.2574606523557437, -0.067961284743518952, 1.165628482281408, -0.36529998330169722,
+    0.33900594038897308, -1.4486823473488364, -0.4332721147923177, -0.66750731720114076,
+    0.20815295235862755, -0.60704800602343112, -0.44705427104637191, -0.062766296346741052,
+    -1.3114979751233926, 0.16222475597835684, 0.52591341248998669, 0.3972795716901692,
+    0.12662154835390965, 0.48155640319270204, 0.83337731582858421, -0.14733939571344765,
+    0.59263811409462974, 0.014584020959444175, 0.64190229082482575, 0.19511886075861523,
+    -0.063010476422326406, 0.94575486943618192, 0.65258931893392225, 0.22844231765745848,
+    0.55966723631392912, -0.54150642991159337, 0.50009688180763456, -0.7978275426415592,
+    -0.32769676348134996, -0.48545098065099868, -0.87350347299361075, -0.71742679200969972,
+};
+
+constexpr NumType layer0_biases[200] = {
+    0.01016583854355757, 0.0089575213589238208, 0.011214988634428196, 0.0076379084084590996,
+    0.0098831560997656599, 0.010131161887339092, 0.009564988365443514, 0.011963950926433594,
+    0.0091767856268095797, 0.0099558634346563722, 0.012442813697974292, 0.0096226850051055451,
+    0.0099410252984595115, 0.0094335825180334974, 0.010388706945901887, 0.01062690585080886,
+    0.011660856856619637, 0.0098302786074517777, 0.0089558840943367215, 0.0098439858156544827,
+    0.01053952789828551, 0.0092007292792852229, 0.01, 0.011709929859335578,
+    0.010870524325649002, 0.0077039721851353601, 0.013466847911814815, 0.0099110509096158889,
+    0.010010845102296391, 0.012944814618641196, 0.0099561782273515816, 0.0083953476068456025,
+    0.0092786246423402219, 0.010905300491753853, 0.010157545638330798, 0.0059106760502324086,
+    0.0097275388904449773, 0.010242997844056891, 0.0099113689410025088, 0.0092392798129411913,
+    0.01, 0.013396430799378316, 0.0093496092594747837, 0.01,
+    0.01, 0.010757219656428422, 0.010786406564363003, 0.010775873586257517,
+    0.01, 0.0092906449494962826, 0.01, 0.0095149194958976634,
+    0.0099285359331968345, 0.010401718894383587, 0.0085764241395586867, 0.0097217897603278699,
+    0.010027259555193324, 0.01011429373634886, 0.0096960799262508258, 0.0084173521013520391,
+    0.010013065506852804, 0.01, 0.0093954428055495094, 0.0098656351834745196,
+    0.01085048835317191, 0.0077069748384310105, 0.01, 0.011368169133591796,
+    0.01, 0.0084349623368968236, 0.010511703600975775, 0.013326116433733166,
+    0.0095049288461634997, 0.0096547670410288156, 0.0094716855368147668, 0.0098626339482149085,
+    0.015404131203118992, 0.0094388637008454949, 0.011900072429866895, 0.01049833184110466,
+    0.011128583459234096, 0.0097193885153658809, 0.0094639523427539236, 0.01,
+    0.01002553678775083, 0.01, 0.009797443935661022, 0.0099297250318358798,
+    0.011554467550354061, 0.010595853918845013, 0.0078821475918159044, 0.0089115230787891343,
+    0.0099254291452048823, 0.01, 0.006982466531534566, 0.0096829018943392995,
+    0.0096217135583365147, 0.010847930940976434, 0.012050893869242393, 0.010834697437522222,
+    0.010830020474333539, 0.010960508797215449, 0.0098731396452339699, 0.007519940271216061,
+    0.011271653837327917, 0.010387880056991001, 0.010408488434293392, 0.0069526541923274959,
+    0.01, 0.0092384473330801679, 0.011922730413581422, 0.0099501943572749794,
+    0.011377327753932194, 0.013294442103073643, 0.01, 0.01,
+    0.0077978820035584269, 0.0093087808719068514, 0.0099416288024874646, 0.0086845277418419239,
+    0.011037190297572856, 0.010038723716837209, 0.011362136178042385, 0.0079227335857008831,
+    0.0076187799146463404, 0.010456210206586856, 0.011880647012777884, 0.010035948010707658,
+    0.0084119625039975974, 0.010012191259563057, 0.01260628567625448, 0.01,
+    0.010719795086258477, 0.01, 0.0099884514210681341, 0.010862652226624362,
+    0.012698376137755278, 0.010703030358881916, 0.010415193844365881, 0.015194658392019347,
+    0.0090353080750644535, 0.0092260346363547893, 0.013109121908317218, 0.0098577403317964812,
+    0.009981259863243129, 0.011083495550194328, 0.0102002981131192, 0.0099407056085524664,
+    0.011724373745012317, 0.01, 0.011727504499871972, 0.010278145011701899,
+    0.010110746354766321, 0.010026560892314731, 0.0099657944393670549, 0.011182276403566697,
+    0.010301394692075597, 0.010066165734522119, 0.010004637132563715, 0.010434993032669513,
+    0.01, 0.010645497123590211, 0.01070520132292656, 0.0092423606006051297,
+    0.010377603370694689, 0.01, 0.0073664316338844264, 0.0095728672603808979,
+    0.011770869298546873, 0.0087906384854971893, 0.0075858228126630921, 0.010498029953589789,
+    0.0081402940094067108, 0.010327801435105531, 0.010612697883947196, 0.011327485850849865,
+    0.0099159797073899106, 0.01, 0.010162643443887611, 0.0090127336921768577,
+    0.0091150826920135819, 0.0086697091729839859, 0.01, 0.011016928602633889,
+    0.011702337406397119, 0.0092615516700713628, 0.0099069032714456072, 0.010044081339415062,
+    0.0099790027908225956, 0.01, 0.011029602840537379, 0.01011757605339722,
+    0.01, 0.010009239093448084, 0.0096121189559038814, 0.010919247532186213,
+    0.0081100247479889455, 0.0080013160652462646, 0.0091236767771439783, 0.01,
+};
+
+constexpr NumType layer2_weights[20000] = {
+    0.047631569369078877, 0.07019279546649114, 0.015865855598366247, -0.013515788104849869,
+    0.049202605362112302, -0.025773140669491369, -0.054914696705204977, 0.12449658364625607,
+    0.040421638570846838, 0.016341522534764882, 0.047486551517305936, 0.040079896952335006,
+    0.11651173295625744, 0.039779994631550512, 0.074710313772103742, -0.045949768304973562,
+    0.13910345090660406, -0.12438751582939216, -0.0074832519068819808, -0.13235283005988432,
+    -0.22319608099293406, 0.015765841690104237, -0.064536462951285151, 0.071236900037533052,
+    -0.039664745879981526, -0.016368186714621574, 0.067216826763887752, 0.097270290859624506,
+    0.045668535422490587, 0.1801603928161819, 0.042162183478714609, 0.071468308138262313,
+    0.16776035471110085, 0.081202225234081757, 0.082905766488081456, -0.071930977403388663,
+    0.040664598451246869, -0.034774328426329763, -0.16264703836798972, -0.063630732059778261,
+    0.0060553819231598874, 0.072126810427987173, 0.12260467704210422, -0.042998983122066375,
+    0.07175405490942513, -0.055809182503933512, 0.031968640297349672, -0.054538497966308393,
+    -0.040787795212089556, -0.020901905375800077, 0.019416738731082732, -0.034276264740024966,
+    -0.092866948965674878, 0.30282659245722338, -0.14903048218108353, 0.17685698118969115,
+    0.17644568095321556, -0.20943298638131475, 0.071563192708320025, -0.012996553624234556,
+    0.048088393956189433, 0.044759166637266326, -0.032677760599913279, -0.033812259271103151,
+    0.03911849114265973, 0.11905427444246566, -0.050156422979781928, -0.096458588909366011,
+    -0.11404212958698304, 0.11702128306355256, -0.075421718852292846, 0.096695841156579712,
+    -0.11447398696480457, 0.099498390238726003, 0.14527204891724421, 0.067476826101152521,
+    -0.060193203357673725, 0.011678830828059397, 0.017734608680158154, -0.00044584462659816814,
+    0.10549906396462448, -0.089668177675462701, 0.12074113187917088, 0.029222421139715238,
+    -0.065024245393061203, 0.06550513789207317, 0.042189374002335557, -0.13031338684762256,
+    -0.10611771235408951, 0.015053140095582295, -0.0065100312731242223, -0.041792540516197442,
+    -0.021166573612013774, -0.016036346225434182, 0.050982756610375386, -0.00031270903398623987,
+    -0.0090031422875223015, 0.016827766273558583, 0.022290017284636303, -0.046818973119129643,
+    0.092225984510617823, 0.076053030246609601, 0.00041910724199833901, 0.01583138956299085,
+    -0.052304089329060777, 0.11516810330913899, -0.039408551222045729, 0.073148062932953506,
+    -0.0085373467129471817, 0.032412768705842025, -0.1946201206896786, 0.016125347961886791,
+    0.049012874488993032, -0.039368822896362413, -0.15424676654662259, -0.11990269484805723,
+    0.096460719593776348, 0.051017005170701311, -0.024898835692276071, 0.31825418156145818,
+    -0.11021290088111903, 0.0020791291066944535, 0.038272861184342095, -0.089415751431592125,
+    -0.086225444513932936, 0.16887788252090072, -0.067638989899303295, -0.0457392172596333,
+    -0.06081327947042902, 0.097730826064863496, -0.0089028163159748392, 0.090497967999878234,
+    -0.026225911024181002, 0.10718688994652339, -0.0010632493430544345, -0.20230462905749164,
+    0.14466815854082601, 0.11351431510897339, 0.15352156136055808, -0.05732327912162468,
+    0.0049560436039710627, 0.11793602012357425, 0.18599381435931051, 0.030517224674290168,
+    0.15686035471869758, 0.070787597023270865, 0.048390612173596595, -0.11628117711431021,
+    0.031655085686207465, -0.017725209046524693, 0.15874478720704491, 0.047559816731791396,
+    0.010120776030630862, 0.012551763839256859, -0.015953035866421449, -0.19111125866764495,
+    -0.17785945163959327, 0.022327226737945734, 0.15263658402039995, -0.022571926145562072,
+    -0.05795013523332021, -0.27949979904174455, 0.0025550245934674834, -0.094525684841640381,
+    0.052430934956746472, 0.054644782035647849, -0.029187504196035434, 0.085518112111689151,
+    0.0093210390701819641, 0.11102613575607714, -0.051841098057696752, -0.090224834846511059,
+    -0.040235653126603287, -0.026342905831087442, -0.009235828923009063, -0.24836559769228492,
+    -0.033658832385860087, -0.032376084694703385, -0.14612770271936645, -0.065005306648477618,
+    -0.04032239927828718, 0.055907191150049336, 0.036103775498559205, 0.022171422099281864,
+    0.22931906094343071, 0.18580168911002484, -0.049869650935423095, 0.10675203787772053,
+    0.068100127790773721, 0.068792884660301798, -0.074490801539936966, 0.068465243273785559,
+    -0.16522408094644955, -0.047871748872597264, 0.013331805546936982, -0.011545090309950091,
+    0.017090263021388559, 0.072573638184256217, -0.071861513444624728, -0.026058240702519983,
+    -0.047632949038107705, -0.074016018640103681, -0.0013102088829270414, 0.024306285811754348,
+    0.082260017328597099, 0.010969864302090951, 0.041344062605159111, 0.036127974585993171,
+    -0.066583387501920777, -0.088681095958716608, 0.089064583163239008, -0.17037861782596361,
+    0.08648057321538509, 0.10452621536987826, 0.16200037053960681, 0.13308649529066735,
+    -0.010594316202496425, -0.031044600332560322, 0.053466504650391634, 0.019992396072009845,
+    0.0748615461377755, -0.11564107302996478, 0.10960743052813647, -0.19847530099665864,
+    -0.027681089737757777, 0.044601590376610351, -0.13827431037992247, -0.011810060539624427,
+    -0.1122725583956256, -0.011976798689737715, -0.053297956576952001, 0.074602647983062043,
+    -0.093200587180042482, -0.058883140787085703, 0.1062820921873262, 0.047067171595349587,
+    0.014435555220494218, 0.058011596392454338, -0.034929949854210343, 0.041005027130153263,
+    0.063445720730840857, -0.15381187814198088, -0.035553312642371271, 0.064016170242963494,
+    0.071430191727370404, -0.25359859217260411, -0.14949407840244219, -0.073821808870313796,
+    -0.0010141238542913946, 0.073110339851446923, -0.086887721034978938, 0.18939857046665337,
+    0.027147828338689468, -0.0081421668343204801, -0.047063908499099992, -0.035305826574855204,
+    0.062879343352223185, -0.017154963653136679, 0.039400157443901934, 0.030396985800952212,
+    0.14945415048762872, -0.074511807645051525, 0.092792391393720294, 0.0017730902803063135,
+    -0.082769640189959942, -0.16516946734811488, -0.038424279887221843, -0.19179134503341885,
+    -0.0091787380504168986, -0.0109852982805453, -0.081648863695965107, 0.060348112363328647,
+    -0.013199491311181321, -0.068709835073872474, -0.0061863320432133809, -0.064217524215615177,
+    -0.043836194914458962, 0.21544701987179621, 0.094419991685672763, -0.19838435112847763,
+    -0.091843965988948409, 0.14854501747675222, -0.13887363063932104, -0.045828879188183368,
+    -0.0095491042225601102, 0.17354705590747999, 0.047198001653485089, 0.11461391436607345,
+    -0.067623911186991195, 0.068311873307691354, -0.085645028018910885, 0.023493284144550597,
+    -0.033660518965510575, 0.10847396495852124, -0.035930190361040268, 0.07154351190365435,
+    -0.10092952977721895, -0.13915604579463295, 0.13017579773385451, 0.036305415695614546,
+    -0.11297754551195728, -0.013052897904530483, 0.067356778654371063, -0.029944760266400472,
+    0.11300520222786885, 0.10460135089660698, 0.026049858778717912, -0.017641444494153523,
+    -0.092169670580470237, 0.059956100836827092, 0.20085068341337464, -0.12743163167956986,
+    -0.076512690905942163, 0.14088089798330786, 0.0088378312670996991, -0.010243741805809784,
+    0.014597718153557893, -0.082394934728482375, 0.028716443341273743, 0.046777041168329259,
+    -0.11624996501555394, 0.024959889826911368, 0.074115578569341645, 0.02009845687316197,
+    0.02362283100687913, -0.0024894806569174571, 0.08091030497252473, -0.059183345526771527,
+    0.062370923112932228, 0.13901400462310801, -0.040954763082178949, 0.12000111245607128,
+    -0.11788773456245322, 0.031572731931585322, -0.14751772768471474, -0.1281495500221746,
+    -0.070964685534587568, -0.00038590453585876996, -0.024549182573555671, 0.029893215522848515,
+    0.0012816710038506365, -0.19812377886376523, -0.022538334987915513, 0.01555038789518922,
+    -0.11509384907021904, 0.21876755281759369, -0.092783792672958026, -0.12928612865744904,
+    0.15155955332395812, 0.23189953069232999, 0.092356079845952579, 0.15428938506215178,
+    0.13710001341657765, 0.16879160980788838, 0.081610946032935672, -0.097548123415006197,
+    -0.023719127685438712, 0.031472612474623067, -0.04553078545909698, 0.017405678631198029,
+    0.022662648562860998, 0.032938859708526239, 0.12295728546982437, -0.17186270332913101,
+    -0.11336599547944441, 0.090851425413541076, -0.059453981395726579, 0.1813896196866695,
+    0.010767850816403735, 0.018546090879860356, 0.12593861585545713, 0.031489807040663627,
+    -0.020030164749511317, -0.045674034069997406, -0.21809097365963698, -0.093407885584409017,
+    0.033529506109896759, 0.11787775888339558, -0.078242870449151541, -0.073628720089752797,
+    -0.013032936305768138, 0.11445401932171526, 0.027673604491294291, 0.15584758104245347,
+    0.011660442276545727, 0.033534105416689421, -0.045251289521350442, -0.15863474481869527,
+    -0.17466651213824802, 0.079280240463475898, 0.037878394467093027, 0.08225735463315198,
+    0.012310603542952032, -0.1486082473847084, -0.022012531479587639, 0.17021208593831072,
+    -0.045646243000201973, -0.0073669891349984525, 0.029509683839056149, 0.16707496211218209,
+    0.11655738838069589, 0.078675990675163579, -0.019610099562242987, -0.06205810842037221,
+    0.029593294673030141, 0.0037316935107861702, 0.0314525289321919, 0.19043815410702949,
+    -0.059010339807343451, -0.0089353890266863426, 0.22854251448547497, 0.16383613489666382,
+    0.12946946563424275, -0.038844900425221901, 0.044605976085517793, -0.038501915955172147,
+    0.072272707736017794, -0.10136828803166126, -0.045189150509968898, 0.13761291156121513,
+    0.029778684262431725, -0.048258399966620964, 0.10135690266569478, 0.12429254276202042,
+    0.015237183009216539, 0.20175851571277167, -0.00035749822529118332, -0.07310713315487842,
+    0.12523380402635514, -0.11017207572021687, -0.070260759272205126, 0.11520182836905185,
+    -0.066089994559948476, 0.06021226232492255, -0.14267330248090843, -0.21986854977778511,
+    0.039279516949622083, -0.060790319080340174, -0.044934901494795017, 0.03891421927672592,
+    0.088045704922986856, 0.11986576061334744, 0.20125892811501381, 0.053742583711374171,
+    -0.06183876046712198, -0.17480457155685239, 0.071100525156182925, -0.083751079714697543,
+    0.067978793191178236, 0.1306907338176288, 0.094898992587575365, -0.092955882848815646,
+    0.047745465650932073, 0.00054647034842456228, 0.11160088595418885, -0.01397176313050056,
+    0.0032682905223258051, -0.075524949032358263, -0.076173906113770312, -0.083411419078695218,
+    -0.060673236715414802, -0.094178742232250937, -0.047250366822045337, 0.020907801175587649,
+    0.13511020149624792, 0.10196242514877298, -0.045687437682368687, 0.15089386764507257,
+    0.081775195884274898, 0.065023693958318793, 0.0019484998939568268, 0.073364226039759464,
+    -0.15533860003353281, -0.050432729685765815, 0.18189402638026517, -0.036865811921468074,
+    -0.0087895090589889813, 0.13270485517622085, -0.10312999152061425, 0.10040515990263181,
+    -0.071738585961614185, 0.1092343798030862, 0.089227746817236692, -0.050359608887418167,
+    -0.12793889021257826, -0.067313192820161044, 0.026811289529533773, 0.023472830994161292,
+    -0.10154139948975777, -0.050389432433714909, 0.1147657588736527, 0.068777701386841736,
+    0.01642117124890637, 0.097179182120867985, 0.20962743546943352, -0.10535283588270969,
+    0.05901376269165387, 0.24319215974001512, -0.0018222169269313784, 0.06485416058033236,
+    -0.053745785294983417, 0.059157662953966801, -0.19219590952602217, 0.069869257409454169,
+    -0.0013734165999122192, 0.10619186632385366, 0.024727261300523978, 0.041554070419050571,
+    0.082024726729394967, -0.076612627410727455, -0.14021073748904073, 0.033604049204071805,
+    0.037986684718844782, -0.016614964519537877, 0.028256679977067781, -0.034443072915429709,
+    0.0049385061270111235, -0.11547391074538922, -0.10566358608465105, 0.052856043008877883,
+    0.047753438623886896, 0.15850299989400693, 0.046973794490780346, 0.058702167759225758,
+    -0.11897613767686693, -0.016835522048760706, -0.23125389479898803, -0.043949688172202392,
+    0.18868973953541388, -0.022881779699867828, -0.14627116100357107, -0.1432920572408905,
+    0.015489345888088916, -0.11807540228929224, -0.014942799147049461, -0.074284935399427779,
+    -0.01542773455279837, -0.17127082157315734, 0.025145612912297281, -0.016076021253429829,
+    -0.038343478191274677, -0.012257273178386173, 0.13175078346850719, -0.15842426172008106,
+    0.096750097601959559, 0.085650265466150025, 0.020272435628192882, -0.010722603950700576,
+    0.034923951305819018, -0.00098587822322328223, 0.0087633289576247598, -0.10325271058820865,
+    -0.17479673937998985, -0.002100249969740797, 0.14494435590427043, 0.088727553735582887,
+    -0.078467241760048045, 0.06361133215820633, 0.16428313304348446, -0.015955314413051376,
+    0.038969865556277683, -0.019022124033288616, -0.047637621769118593, 0.1031982033706747,
+    0.011702599898209324, -0.046611785711021314, -0.062811459911919013, 0.10522860497239393,
+    -0.00063054879052626672, -0.076612347249971971, 0.05276087564928434, 0.096360620642307937,
+    0.12654558997307397, -0.069335669286381726, -0.16179401955733325, 0.10080024557285758,
+    -0.096631675531574646, -0.27256568995458513, -0.12825270097506977, 0.12669778885158525,
+    -0.057519443147995453, 0.033641585360272973, 0.12382352163689331, 0.13673823289817719,
+    0.14292301587756454, 0.14074151600890658, 0.018193062362470945, -0.22563870520683971,
+    -0.035222368644797365, -0.09077458299112795, 0.03179496012574811, -0.1072890596513065,
+    0.13536567121549806, 0.011083633027865563, 0.032374215049686912, -0.12467914115785209,
+    -0.054436611886338068, -0.093634261375699468, -0.036550372776932231, -0.065894042642897874,
+    -0.14043868952804686, 0.014713019888256245, 0.030665825098957038, 0.10544904346369774,
+    -0.0029544189212978092, -0.016465584521014237, -0.11139280304787837, 0.03776419818943786,
+    -0.25208812835590683, -0.075012455589044999, 0.13019946234406471, 0.066983382903273325,
+    -0.14272022644129087, 0.055866709485337805, -0.044407602693685461, -0.03149954239373564,
+    -0.190684726329131, 0.01414516462911092, -0.046459437318081186, 0.044369556471407792,
+    -0.1032360753528128, 0.11880180274727872, -0.0066145168138703747, 0.097578340871625965,
+    0.1370963428435939, -0.060036242462442498, -0.087763032057583776, -0.077207591417632102,
+    -0.020272998741258822, 0.020314474264749537, -0.0056388877421948832, -0.066785825499189586,
+    0.032271334707878213, -0.12729904416529589, -0.16448078052758994, 0.0716696992559821,
+    -0.021140602078907226, 0.12733654203443065, 0.082520139886827645, 0.027037163656413645,
+    -0.053964368507244211, -0.041447683320070372, -0.035147946478978613, -0.038885473000639992,
+    0.057991603754375003, 0.054940122121756182, 0.10593701364118349, 0.17595953132707015,
+    0.0054480308881093443, -0.00049360445294826052, 0.11081999204373197, -0.20820361356660283,
+    -0.11078481732245425, 0.013378400075179759, 0.065636007656030337, 0.024511421680683355,
+    0.068065609157480347, 0.072999618944330935, -0.085365666466449164, -0.17982520714769093,
+    -0.028760074630795704, 0.037953238289091452, -0.097990568031828623, -0.11544310123218456,
+    0.056960848974728154, 0.14240816469079531, 0.096530709507701401, 0.074406386311977851,
+    0.070468844825315402, 0.10289010830563139, -0.093568903223736261, -0.04834815296769357,
+    0.064659425399994377, -0.025260194441868548, 0.014419708496512976, 0.15225671353478898,
+    0.016591811036363542, -0.15978253586299981, 0.022506763502562185, 0.033354404731197718,
+    0.066079513102495865, 0.030466267262433722, 0.11852512313707, 0.13803584887600914,
+    0.02323820940866719, -0.01165270612539062, 0.028592518063628669, -0.14660468228491183,
+    0.014992614946373561, 0.051213929343644826, 0.014592762490055526, 0.14330058523681763,
+    0.080268533966359232, 0.070590835013128725, -0.068009705447280633, -0.10236986585219117,
+    -0.12128540882173916, 0.044280795733867277, -0.041136186200067787, 0.11655331766962963,
+    0.023210979888463639, -0.13057893181571195, -0.022939677093151228, 0.14683791629230419,
+    -0.03151303799018515, 0.05154722116991519, -0.064317049568288848, -0.073624989210550648,
+    -0.20678110449558951, 0.080053729530420614, -0.1269372166327182, -0.081058166388128641,
+    -0.19163313733179216, 0.081162762582020237, 0.057273693846540401, -0.023592181751435223,
+    -0.011815349139740052, 0.025716688258557316, -0.054832929801799518, 0.083154239146342374,
+    -0.016069868680306264, 0.057302868486050346, 0.061615952709030093, -0.12087538993786649,
+    0.079436363274768745, 0.0055327842793830113, 0.072206503184030088, -0.079305273537431956,
+    -0.17609354266910593, -0.13492765460152076, 0.012332195095860506, -0.033450883653076899,
+    -0.080950187291071632, -0.11310997283410217, 0.15370554271868947, -0.023553367167283117,
+    0.062837830835210079, 0.099917013761086304, -0.049275684005122208, 0.092904414781153147,
+    0.057046258631591448, -0.062342339452145012, -0.079239655603074, 0.084280264905284175,
+    -0.25924146082696115, -0.054631988905625463, 0.11685730515877712, 0.10114545533401767,
+    -0.19305748940866649, -0.09317215531857384, 0.024924808775557382, 0.051939184092743,
+    -0.045770183984799713, 0.15610617639205357, -0.13676643799538934, 0.033166402426647937,
+    -0.094636652868898108, 0.014910969693465052, -0.088702103118836195, -0.010349013366189434,
+    -0.10887167405756687, -0.054551584180154294, 0.10565348334248786, 0.033850900242182902,
+    0.17781452809444817, -0.0096108989386794186, 0.16482198291346989, -0.051667378747896849,
+    0.047939310590699072, -0.20487462231912154, -0.06127845181064788, -0.09439979009691328,
+    0.029431941762455428, -0.085849837443631893, -0.063225486296070763, -0.0088781333609418214,
+    -0.18546367453750512, 0.022975773496034638, 0.074399143219291475, 0.056211171834359232,
+    0.017818746597755977, 0.068046687736723774, 0.11778930580615066, -0.020892331652662202,
+    0.083952457325475571, 0.0022174038535799005, 0.090906256938383639, 0.027707890756588829,
+    -0.0087446235502950907, 0.13390802976681737, 0.092434451624971173, 0.032440256914607141,
+    0.079238197929568016, -0.076516553351913361, 0.070795292657392483, -0.11279964920809209,
+    -0.04634492597845144, -0.068656397460012467, -0.12353204582875649, -0.10145946992699389,
+    0.036486889323624837, -0.027091749593072575, -0.1400256688965883, -0.054816961819938975,
+    0.2184174982125823, 0.042102573551962438, -0.049921497759423263, 0.059395443268898507,
+    -0.2712559302741519, -0.0025661982135659661, -0.063476218609911234, 0.10002069721234624,
+    0.065015242340330265, -0.057316107587636916, -0.15770966309648812, 0.0053580333929375296,
+    0.23363598601307262, 0.22796633387850826, 0.011720608320614674, -0.033627494923309922,
+    0.010597898701896915, 0.10100715229148227, -0.069495501538716198, 0.16286612106252929,
+    0.14624304728101942, -0.12882952727920088, 0.10320813813831485, -0.0091664004978720664,
+    -0.10739499923502452, -0.036976140132456779, -0.087129659284268815, -0.089123753021248531,
+    0.058507282832559952, -0.19468424163255879, -0.18835558073212383, -0.13996593469341298,
+    -0.15075421064613984, -0.024400369969538441, -0.083625483108363208, 0.15306622657400207,
+    0.12004538313846556, -0.039096918593514503, -0.082764747630717395, -0.098247605201122912,
+    -0.061806413463532994, -0.058334346599678656, 0.085780831155313736, 0.11725170047988445,
+    -0.067799713112100993, 0.032883016091079381, 0.012149121292298266, -0.18784026741645085,
+    0.10172431116045975, -0.15039339489842041, -0.11739404368509342, 0.11058577969735001,
+    -0.13138557462418443, -0.063549520913988231, -0.0060427817422006244, -0.021871216396391991,
+    0.28060480673704513, 0.038042423996740585, -0.013676705871211427, -0.13064947245780043,
+    0.18189616505918649, 0.10329918605319606, 0.10178452176850597, 0.064861296493772799,
+    -0.14250629164229936, 0.10611201252863321, -0.094739316686829445, -0.18465832358935602,
+    0.034698409661717368, 0.064228652643684811, 0.1439335492259026, -0.018555458000385702,
+    -0.0044956691915148594, 0.070480094376168492, -0.012580833849861195, 0.052068269504452314,
+    -0.15362482070319514, -0.054578660244568922, -0.17650496985908018, 0.044801688822553587,
+    -0.023130643591312491, 0.02735778154137012, 0.12538525489875046, -0.0152500317280077,
+    -0.024771952296632024, 0.03804593902083693, -0.045037952433908936, 0.014773390607419674,
+    0.065105007896365419, -0.11952573622743493, 0.020888068079357378, -0.063301776695689468,
+    0.15083088188208571, -0.20635308071611977, 0.023913748460770091, -0.18749299556209298,
+    0.20107527312719689, -0.13870945815242755, -0.05685907549150751, 0.12984515007823091,
+    0.0025393196485088629, -0.10823399389382381, -0.083003957248357352, -0.055957524828609287,
+    0.087165871937192191, -0.019056205592418676, -0.03386240185459951, -0.036784022723269805,
+    0.00055842469549645553, -0.083921660031625073, -0.13890391922186227, -0.1566369514396474,
+    -0.015308625097576693, -0.13300599805653157, -0.019691184425514194, 0.043110846222196429,
+    0.1372275737911994, -0.097958614009057587, 0.061592796945415335, -0.10408808968416697,
+    -0.029455044095275454, -0.16119521769579806, -0.012856067529035096, 0.0083726665038703733,
+    -0.01212466023289463, 0.017336652486270136, -0.0080890115536453571, -0.21528121906709097,
+    -0.15854604931070715, -0.073595211160868701, 0.15167619973683255, 0.17267547461994009,
+    0.17793780477596921, -0.10707215763665819, -0.028892410291378859, -0.074775654588585316,
+    0.035068372895979055, -0.054002646503102283, 0.039672517550559228, 0.11441228899845389,
+    -0.066844898883473225, 0.0066808274306284126, 0.031614469313312139, -0.018034444215951,
+    0.07709255772703924, 0.0076711799577303605, -0.032131296203313717, -0.023045164916570948,
+    0.022083177918870159, 0.053399492146836293, -0.0081033742449974112, 0.090674929166956908,
+    -0.18029676745027712, -0.051205810145194132, -0.11833886751367176, 0.04302051000318248,
+    0.17188607807321962, -0.0047553191765527959, -0.11130260197676532, 0.053838970508794361,
+    0.12428210127281923, -0.022264127588642525, -0.012072773559806817, -0.04379029657241329,
+    0.10406340413195268, -0.020160257321120097, -0.086764790746492904, -0.076493165979460792,
+    -0.06609656296853926, -0.055199353162015623, -0.020370069151701458, 0.0025196582874078329,
+    -0.018232030538993988, 0.056955318877494936, 0.021481384864854625, 0.040244181995091943,
+    -0.092821739515605711, 0.059877940204655949, -0.030965266974212903, 0.068964337667407366,
+    0.033835307958065691, -0.003981237612324582, 0.090564792407535663, 0.15117638936210376,
+    -0.038642165390363026, -0.016537017445499742, 0.083200587595713443, -0.029291592793681542,
+    0.0078750370950873092, 0.080014061003826908, -0.033947265674071157, -0.14263689795136456,
+    -0.10376579037783658, -0.0018959336044962458, 0.20799160694022356, 0.090828055889133744,
+    -0.033735458582438517, -0.0087804372082950152, -0.073295303353555705, 0.24838329846776228,
+    0.05951432757979775, 0.020121323768972469, -0.00060200829757808903, -0.2555164997158263,
+    -0.1806538463240388, -0.064417475794116719, 0.16896258588021432, -0.068947343739224509,
+    -0.018468829897072058, -0.066035840776111979, -0.12974484884914644, -0.12072204027835155,
+    -0.053831810813597218, -0.041617083733294244, 0.044190861759472497, 0.15510926052799456,
+    -0.023532292429078918, 0.030615192192233943, 0.1015659862770241, -0.057724011111104312,
+    -0.03980370812064872, -0.12111164824011757, -0.090734729899586058, -0.1184079866620706,
+    0.041877107810158284, 0.076268668934608874, 0.054029599591066596, 0.13676217258221449,
+    -0.16776361484751565, 0.062627003448383775, -0.047856696510171867, -0.0694388930533031,
+    0.0004310362500910962, 0.058512028458947526, -0.063450613263556499, -0.028592736599685989,
+    -0.082769064071041371, -0.052973539507474653, -0.11612064949099776, 0.016719054800695961,
+    0.060909232350574431, -0.08015108233286114, -0.072248615882023748, 0.14197845725079025,
+    -0.19148049729148647, 0.05088817350399566, 0.063990019749875823, 0.183551565688816,
+    -0.018602108076875613, -0.063307608717528635, -0.038673394486117264, -0.044854492924289016,
+    -0.084675801753730837, 0.017825277275561279, 0.15515949877484567, -0.015523863235986573,
+    0.086089725392899705, 0.044941560028722988, 0.036744168908962212, 0.15766957928098643,
+    0.035471176590454713, 0.068714011826054924, -0.0034432765113416412, -0.042023316563973762,
+    -0.050043336741200733, -0.073566782517820228, 0.20748503812318131, -0.022490139544458349,
+    -0.020198180847186921, -0.005387390126276966, 0.2062976723253912, -0.065549065060393222,
+    0.19629844188310031, -0.15855926163574552, 0.066155535138172766, -0.098463904916239672,
+    0.015330972729702245, -0.19843145360807582, -0.019489302508104555, -0.049292913166166602,
+    0.2436942268690814, 0.013391428383070192, 0.17123748514078352, 0.17782436647397318,
+    -0.064771998346921378, 0.15415916201334393, -0.03196062719005939, 0.16479419200211415,
+    -0.21715655491016805, 0.02235988078313976, 0.1329017782851786, 0.023980559950740384,
+    -0.10959857449375876, 0.013833485419550019, -0.025273560553761083, 0.12956879324730652,
+    -0.14107883220982317, 0.092895126276771892, -0.072478010539685708, -0.096299695488716502,
+    0.0043538329418707092, -0.010171023736712623, 0.0065471388832347094, 0.10050854915144702,
+    0.04536209090948172, 0.058703581469944574, -0.084299752781457307, -0.054598415037876276,
+    0.0012339717866606493, 0.05357170876029315, -0.19145326545951902, 0.1953046101004329,
+    0.070861869872056615, -0.02160956933932829, -0.038569431547952678, -0.015703089716687404,
+    0.23670726083166843, -0.17682775398949493, 0.05872584512232857, 0.094829087402956869,
+    0.10134382753221312, -0.075117628731997885, 0.18878612013984819, -0.17207329791194312,
+    0.017331050780594215, -0.04454373437699282, 0.15799622706580779, 0.036056915822521678,
+    0.059166749636321833, -0.01593032207055944, -0.045153709873689329, -0.10085628013973086,
+    -0.0058200311155543584, -0.0042641465061979055, 0.046873003131680559, 0.1383242216449676,
+    -0.095540120663270639, 0.062828444710765388, -0.096657778363091501, 0.016687220746864594,
+    0.031347186427135805, 0.18559348276404122, -0.22033438509246234, 0.037406230963832561,
+    0.014675323856709234, -0.0019532578385987576, 0.045455414686847669, -0.024927256729692412,
+    0.099909841332876864, 0.027521599013311568, -0.033105224378232614, 0.027115081232139435,
+    -0.02313197344703358, -0.1622395259360013, 0.0025434198526141311, -0.17704751608917257,
+    -0.076157556237950522, -0.054188491236912481, -0.07590086283040319, -0.086986794808093376,
+    0.050335486942179188, 0.035589411871117006, 0.26657743606703965, -0.1098637635752901,
+    0.050217524038064947, -0.070655066854457577, -0.0093601210721082524, -0.12902986501542549,
+    -0.28795638578431393, 0.093869599459877107, 0.012880518755138917, -0.15068486551870419,
+    0.046918536819067901, 0.024480953822716894, -0.11175684060283315, -0.047247453107001652,
+    -0.10493040041471796, -0.0269817834602375, -0.11889189577673259, -0.064774818604202283,
+    0.00044092566317083552, -0.012429898653018235, 0.035134815947376878, -0.025802742180755581,
+    -0.077409274882319565, -0.086231316422506157, -0.019263888857284014, 0.06466900134837808,
+    0.042632197000573996, 0.12145686013983553, -0.098154739891302412, -0.016810566430036838,
+    -0.063307264738163976, 0.11042325753459628, -0.022765358349672703, 0.093540167967258947,
+    -0.081658607728896368, 0.044242743415142956, -0.0057884075119841874, 0.085894664345603389,
+    0.16108523719150253, 0.0072092379697488778, -0.022887106263210891, 0.0053945703654338347,
+    -0.030640564938792289, -0.022863075898338896, 0.011367468385041822, 0.091026245178113002,
+    -0.063722874032744931, -0.003178140843774829, -0.19836896600338022, 0.046685367505418116,
+    0.016112302601504393, 0.07936925228202317, -0.10458051148625376, 0.14479084455674179,
+    0.0325442283841339, 0.023857974756732857, -0.030518307900195291, -0.10730554251047385,
+    0.021297327417928103, -0.12243737070768713, -0.043280784780132815, 0.037099652241277738,
+    -0.0038395816702697359, 0.016729480477580636, 0.041431802395726913, 0.13038485561657467,
+    -0.042617848927863425, -0.086268310080693023, 0.12823987627331315, -0.016936488042560174,
+    -0.023489815147334815, -0.028837683481327266, 0.034395013692812351, 0.086134488951996782,
+    -0.0064591038339028546, 0.0049829385072843492, -0.024863178730992544, -0.066938320438992532,
+    0.0084048121268020092, -0.045888678468439935, 0.070827551237197417, -0.051175687943307749,
+    0.060656852297658763, 0.06774711609655977, 0.037457433900095156, 0.0031240392290316291,
+    -0.14159305838285538, 0.082910664695893435, 0.068702793210715304, -0.050399530058882681,
+    -0.083346734289467497, 0.14046666737533053, -0.013554320477952419, -0.084707169708299321,
+    -0.13213999479607005, -0.078503321412508709, 0.053902660115845859, 0.19490915623222646,
+    0.091547670899876366, 0.062971126939690605, 0.10568747214393888, 0.0023158859274554789,
+    0.1386689942004678, -0.14899248361102879, 0.27325483989348492, -0.046091829196775354,
+    0.066840598016025682, 0.075612017953259961, 0.0030791361869441751, 0.1078460079598316,
+    0.057496156061781642, 0.019820143053599415, 0.098858179551724629, -0.13232502174225116,
+    0.08693793212688862, 0.033668734531015057, -0.044137114532578708, -0.069591355761072837,
+    -0.16505792735905286, -0.058643322286343183, -0.10407066975254574, 0.055416933757764339,
+    0.045263977540684154, 0.015400545759761936, -0.1614415149622844, 0.081532132776834146,
+    -0.22732771495706239, -0.0028537106438862353, -0.11137240240735799, -0.1415222090290445,
+    -0.041610630519414056, -0.047421326311381407, 0.11612436570697539, 0.095243600450830745,
+    -0.074848094552462843, 0.091871173861566444, 0.0092096496608720605, -0.02389068332146458,
+    -0.022872028167583481, -0.069872451091007828, -0.073439131991813067, -0.058793863853156561,
+    0.10002420255896255, -0.086178383728279642, 0.0040899895972187185, 0.03702576171136257,
+    0.025336401493576702, -0.0075335528687488383, -0.14068180657690682, -0.12701814667104472,
+    -0.069228418500368025, -0.073378911364375188, 0.26386132605723639, -0.1270781582014715,
+    -0.0523468665179408, -0.067092015426646515, 0.008178573374269112, 0.0088202351188765519,
+    -0.10690839213811169, -0.031771207877475838, -0.0056695738164131461, 0.11446429817490129,
+    -0.053721902451340807, 0.021274191324378831, 0.17856735050380104, -0.035865569896411952,
+    -0.084462080320104063, 0.0012022001193108568, 0.0093815752312323246, -0.14139907183636008,
+    0.002216670929441885, 0.022097785473434696, 0.018254955499800572, 0.055461443924755639,
+    0.098275547106994127, -0.05716429265821249, 0.021772113833429672, -0.08964758658078946,
+    0.0010802836813368897, -0.015326857483320924, 0.062748721562078794, -0.13577370317336385,
+    0.11429970632238567, 0.017317601834001828, -0.10570914151471977, -0.00024242397280329448,
+    0.083497798057301217, -0.078217136724934966, 0.00026512128132853745, -0.082534341296760239,
+    0.070116312342411488, -0.0066005288813799764, 0.16616796485075835, -0.20062126493646759,
+    -0.051312128535795302, -0.0030257838474540741, 0.10055252339727269, -0.040958170985414245,
+    0.045001540436861845, 0.028336494755304933, -0.1342038756940199, 0.098688209140860961,
+    0.0057964229012453404, 0.017047199521615777, 0.12290967662162917, -0.12610966884272995,
+    -0.056877453421828914, -0.033591869896239773, -0.10861777958338405, -0.082942591332967261,
+    0.0045887887059956065, 0.015533157699308015, -0.22312240798454025, -0.019700680834014606,
+    0.12692103655303977, 0.12438661877300801, -0.029750884682905761, -0.31415152579105637,
+    -0.08593851065574018, 0.15024652377703349, 0.11166860383806738, 0.021133678014278432,
+    0.099005491920071034, -0.1192644105101725, 0.12660851475388274, 0.078288481623784378,
+    -0.13914754170765861, -0.12819506387711696, -0.028962218414562192, 0.077316193978545875,
+    0.050583749368222006, 0.12378506535701848, 0.21042818980722222, 0.13597491656931526,
+    0.10291345383584444, -0.015583639396234384, -0.089929012368747993, -0.022326080501890742,
+    0.052158268429183592, -0.1373645655419857, 0.03002760112886424, 0.027498560517333313,
+    0.10066185163365096, -0.059582812194875316, -0.14748580111217055, 0.21624701695642395,
+    -0.0019737632775259136, 0.14716410909817934, -0.037004236215959461, -0.10890425662445748,
+    0.10252169317331992, 0.021116779641895622, -0.033734077512041154, -0.073987151034211787,
+    -0.24823730006366487, 0.057064482238992777, 0.032246916980337742, 0.064820446606519103,
+    0.040780866710017759, 0.11967056713880431, 0.057590309287955083, -0.0039003543114234057,
+    0.049788501760879886, 0.099851300625854733, 0.070846486248702864, -0.030776156963461608,
+    0.046922243795088706, 0.035840346553289659, 0.034297310638704573, 0.014259666779811112,
+    0.018960658636614086, -0.14665112342393566, 0.10864010460736223, -0.031337424614603815,
+    0.011934854351206736, -0.12064077892955211, -0.026308198918611702, -0.030588741367800737,
+    0.13676072549479448, 0.040032559397044434, 0.04928822946624753, 0.045629011656239726,
+    0.012714855703803566, 0.098235177794270004, 0.012842362910697387, -0.0013650560572463779,
+    0.05926414763553587, -0.019466770299700509, 0.053184693077282352, -0.10470296075574084,
+    -0.20912625892667347, 0.055048129867377768, 0.03370976062395567, -0.080546372101725605,
+    0.0053472611906304176, 0.041709300483877831, -0.048154925548258606, 0.069673345197578243,
+    -0.087283821319243643, -0.052155269616397111, 0.04651651071460039, -0.014237434576820217,
+    -0.028934781326842702, -0.051697991837515632, 0.051100678401674926, 0.13200739239163453,
+    0.0040478756892338248, 0.069591353083758051, -0.042026432270925854, -0.18519712145827183,
+    -0.14924558992863926, -0.12626606325846024, 0.093551286777704412, 0.085355665582781806,
+    -0.20876448261012484, 0.16823137366751867, 0.13191266811208277, 0.060552230228917148,
+    0.01839795816554517, 0.029722135341494756, 0.18235373692090798, 0.18898922859335046,
+    0.041930858787457372, -0.051459183010555715, 0.080887557999262019, 0.0051727727080589101,
+    -0.0087605373615508245, 0.061252117084562997, 0.037324256299855842, -0.0159665424134985,
+    0.0036611833748801388, 0.032221352950326729, 0.038806840858674585, -0.070379743230369593,
+    -0.033612520199665805, 0.12834109519121098, -0.21412522040943283, -0.035906184385048723,
+    -0.074111101116167505, 0.066944931035932603, 0.22233947985259608, -0.018483594945624817,
+    -0.086094138241105775, 0.030584901037188205, 0.20333931683909931, -0.11015243756862914,
+    -0.041043916005844623, 0.13579268648797446, -0.12382154229195036, -0.039345729802801675,
+    -0.2242169525202489, -0.030755011263327463, -0.014187852554916208, -0.061851404704734068,
+    -0.055564146017738895, -0.1151465426490758, -0.099859741309778982, -0.012738205406623885,
+    -0.025072024586018253, -0.052032562387826581, -0.046306366852738583, -0.046833878018933753,
+    -0.0080318357841023414, 0.050337922822870619, 0.097960029435966614, 0.028337189015402033,
+    0.086239994912393605, -0.19253937213151462, 0.031600331314431927, -0.069782832310744419,
+    0.18729435913619433, 0.12079217495600017, 0.013473248838427489, -0.13936411532988702,
+    0.028219147598095587, -0.28972641492653423, 0.14426512180579226, 0.030584700734026964,
+    0.075474121834637808, -0.090002578085553689, 0.01011611162049629, 0.075856069732329071,
+    0.1439722323805441, 0.021876917193150179, 0.15270012477354525, -0.15265504527023008,
+    0.11334092378222987, -0.15678698757827264, -0.035817145635652262, 0.032314370511384173,
+    -0.057061676404924516, 0.038995424582559883, -0.079364890142125083, -0.27379304964015322,
+    0.035734524134339356, 0.00036441693075168851, 0.025561343017250823, -0.00022585077171740804,
+    0.00032740024766802779, -0.013598465582516473, -0.016883383164597015, -0.0031221025270234846,
+    -0.02320210532092918, -0.034597349925652505, -0.090349487994704297, -0.086327871403073159,
+    -0.065992670523339389, 0.12979257758267176, 0.11664023073805189, 0.032919659844421405,
+    -0.070205261086649887, -0.038331937578374796, 0.12020582690565806, 0.084308690159774352,
+    0.00030303331316668098, -0.16185974009036624, -0.09922135488128668, 0.18102151132174804,
+    -0.18493075975401169, 0.075826361068096884, -0.070477696895951986, -0.081596105573592273,
+    -0.078968376776396537, -0.096664042099485009, 0.22825397539507494, 0.051983837394798969,
+    0.070125660329358575, -0.016599868285887179, 0.058460900937986275, 0.17654442480100566,
+    -0.032292391381769217, 0.028812595067601091, -0.036181118333119842, 0.092956471868412438,
+    0.036142915466435784, 0.056538918772599728, -0.044657970003409403, -0.17242468904712005,
+    -0.0040830583576538975, 0.07181447417649299, -0.026582177816546284, -0.22458179562176664,
+    0.0051280503548890074, 0.16231841663412289, 0.057881677215728899, -0.03582959879563552,
+    -0.24935871065690923, -0.055555887798040667, 0.045792630565752078, 0.0019527609758090063,
+    -0.085654783525096603, 0.026304779199882194, -0.071688156968555475, 0.072494740513000283,
+    -0.13532015181308421, -0.14893778099205274, 0.043069148250758804, 0.060787517085901306,
+    -0.086899770145734453, -0.015626804516678562, 0.13456191322973007, 0.01915536259573478,
+    -0.050721441282896768, -0.082181717659292094, 0.08166856295884059, -0.12167464617650943,
+    -0.099379775162336037, -0.0050350598043971788, 0.11218927880547055, 0.068305528634824433,
+    0.10033952923829663, -0.067960395168125826, -0.12921486361414411, -0.23596160495715612,
+    0.001586178651310383, 0.019113579303803644, 0.080610324327689206, 0.21135046646476191,
+    -0.048886095926988289, 0.016213649318404712, 0.034188449331353045, 0.045630542379083462,
+    0.035303561776643962, 0.035734419591878681, -0.25373857722865489, 0.29850186494023917,
+    -0.10236121758860556, 0.066707623631165031, 0.076124762908568719, 0.023785093059187915,
+    0.077521325271498756, -0.11066705824488528, -0.045290384914343916, -0.0392235195555206,
+    -0.12396588327067157, 0.028413738011945147, 0.041857922809657638, -0.02017413903099833,
+    0.047215957146114061, -0.041364746569454366, 0.036447136567966575, 0.12076042328005127,
+    -0.099607484783150735, -0.032012482746582756, 0.074573788401635976, -0.077189448833876975,
+    0.16899493033769819, -0.0032385529192516527, 0.065477173179725012, 0.069128496888479884,
+    -0.036202521234114111, 0.0066993860911606319, 0.13652501299494593, 0.18307654150067137,
+    0.03528008283838846, -0.14212280632940463, -0.069050123647289907, 0.05548762159196563,
+    -0.050608538558743629, 0.12090196375163287, -0.066733638051454339, -0.10216949886617094,
+    0.19368885255402676, 0.15531346802679744, 0.039534987098335028, 0.013191431355353859,
+    0.21981744020957431, -0.021005951570818988, 0.063829733446103529, 0.075990059537246496,
+    0.23048154851424194, -0.2328849629735083, 0.025554530590437843, 0.096965972109555001,
+    -0.050460198250755907, 0.053784898821803352, 0.17087619652443209, 0.15316228954217717,
+    0.11161326031446835, -0.11198770799512739, -0.053813558881699836, -0.00016185553799895149,
+    -0.016342169584318379, -0.012006418417122518, 0.076112898029064305, 0.10394860954648817,
+    -0.086424377428722235, -0.016381474803396572, 0.10898149154424178, -0.1991692283693168,
+    -0.037313476405659463, -0.19116903568021945, -0.10097554977767544, -0.064390157591228223,
+    -0.016726488062716354, 0.030036225190782619, -0.15949125214546622, 0.15706539908552761,
+    -0.037219865480001134, 0.025808604095887505, 0.050188628384068651, 0.15439497365917698,
+    0.1124555269457726, -0.043533338349749519, -0.094311196446553863, 0.0053129936091012749,
+    0.074754944745536539, 0.010518235992277162, 0.084586155793653195, 0.044008308646694409,
+    -0.053364396975596355, 0.11599889046085934, -0.054380203228172289, 0.057562791587320312,
+    0.13354434877427449, 0.007667585705931952, 0.080946339323218333, -0.12866227462824698,
+    0.016132514880470961, -0.027231366311295628, 0.085185801003020312, 0.010744956729870456,
+    0.099185410593195897, 0.031870519842192156, 0.099468661161264335, 0.0032038473017406456,
+    -0.033646993467394123, 0.19195518869134359, 0.0083574955238521487, 0.011014210638599796,
+    -0.10296859226648546, -0.060536183907451496, -0.12104781921326478, 0.05830525235670244,
+    0.1098995578708117, 0.24990977391239896, -0.022632051556422769, -0.079037078521208309,
+    -0.0057057408053550604, 0.080911871957122988, -0.061321602811842249, -0.029761512025444279,
+    0.10740056642931842, 0.023811730427609493, 0.14692502052302853, -0.011812820720807856,
+    -0.00075933085077056371, 0.15282867938008385, 0.066225577984617284, -0.04710643058798436,
+    0.12511454356037882, 0.02801263616452402, -0.092318475476432613, -0.092125337322840381,
+    -0.078980997203291686, 0.096063362923988857, -0.1029897971779704, -0.11721297475737567,
+    0.037700072522788584, -0.0091071960972242943, -0.089527706114539016, 0.055024758615151936,
+    0.11962174397429584, -0.086934462986308456, 0.18607992067976148, -0.052726437482364774,
+    0.015057561113318907, -0.020608727968145842, 0.018134475560337787, 0.014012309557468029,
+    0.047515889061069773, 0.030759039470524229, 0.19264984930259793, -0.10881027219764226,
+    -0.082399744636275238, -0.043102263698585067, -0.10667008841124935, 0.089161068965118134,
+    -0.030907205490529499, 0.067121967300077259, 0.14065095683677006, 0.092134169517410824,
+    -0.069059657113208023, 0.11271984192071784, -0.19786971438664114, -0.12245248527204824,
+    0.12411070885838096, -0.049325191319973163, 0.043671375216397017, -0.0068839642026855032,
+    0.16431106077523625, 0.1176292965817051, -0.02038006482420977, -0.064949855792126948,
+    -0.078325996535449693, -0.011649652074215732, -0.079973346857797362, -0.095018249030658558,
+    -0.072055650805166627, -0.095992376667496437, 0.12920703309836962, -0.089928584460393396,
+    0.064205401967209044, 0.12058080813243065, 0.081019425025608841, 0.035644891956988015,
+    -0.06195405417795169, 0.16156121738841434, -0.01230232549251979, 0.1087754623342931,
+    0.047970191267646491, 0.22029217854574676, 0.11620488710200624, -0.056456559624443778,
+    -0.010311303017972886, 0.010182872529067169, 0.087237463442498706, 0.080725567832166112,
+    0.1232712118645376, -0.025658974505883447, 0.021535282707270873, 0.06685019704942001,
+    0.04408169718717117, 0.06229545031055702, 0.0076864244986212804, 0.055753908693128962,
+    -0.19890808464449306, 0.042343769673227435, -0.021023026541588084, 0.14809337161022423,
+    -0.16447983827608417, 0.12973500716173458, -0.026390537790064825, -0.17458220710473085,
+    0.01389094354167035, 0.046295027911969655, -0.067440515893278291, -0.064474022656468219,
+    -0.093676265539091016, 0.016957639600364834, 0.097407324732028663, -0.056192321043146989,
+    0.10197499151666012, -0.1634042001277734, 0.065097092563217995, -0.043234986830218147,
+    -0.066739122461231912, 0.023626298039895275, -0.11072519245125563, -0.055216551774820273,
+    -0.018268592586008412, 0.062855699075709287, -0.090258129010875432, -0.0064562112251905874,
+    0.0079531223582938945, 0.013593132016669431, 0.094216357386386701, 0.040465808275473455,
+    0.06961328333718457, -0.069241083694457708, -0.01621608469737398, 0.077871831729759089,
+    0.049394638186487809, 0.077539666594646867, -0.11105433902669887, 0.098857290137058518,
+    -0.088209268718195441, 0.019236051456180184, -0.058559890179206965, 0.032419723536643567,
+    0.096006294025981126, 0.072996299245954785, 0.07007008054282278, -0.087987461847337703,
+    -0.16501611709268682, -0.028272999743863381, 0.06260641784416382, -0.04412462976410448,
+    0.15521970851808228, -0.017166533164749441, -0.17080987434494305, 0.16018766167077836,
+    0.12651735072855791, 0.2239367715540404, 0.029146984394136426, -0.095051436953765167,
+    0.08653456704130115, -0.2064187239612727, -0.016560981206002041, -0.046694047615989838,
+    -0.078747341107016505, 0.018076406626483105, 0.090793765038073473, -0.11299419301909852,
+    0.050695307069823857, 0.018672813444863795, -0.14144551952075565, -0.049452010690191013,
+    -0.17758071404399756, -0.075153760910210782, -0.087167828874706241, 0.032955046294421413,
+    -0.10439076195694665, 0.10878415490771561, -0.11074597377181891, -0.0040130387904279731,
+    0.13182296031570251, -0.009131780795016281, 0.090682302693011446, 0.10841134539969914,
+    0.090467747470705559, -0.067700192503550291, -0.006269278787833869, 0.15992505836910326,
+    -0.067856597458276505, -0.014477223788608039, -0.16195166249998316, 0.08160664843108717,
+    0.096766044269777043, -0.02229770141055747, 0.036921019300679044, -0.22479799600997888,
+    -0.11781938630484247, -0.069187914987960314, 0.10185249276838067, -0.025963055691355808,
+    -0.011125377610259236, -0.039472209508249187, -0.013472927690869215, 0.010000220768732153,
+    -0.10526723160906203, -0.030303249439240263, -0.031762059232781428, -0.068917287339244224,
+    -0.03989010699861166, -0.0074463422165620095, 0.020187205772100324, 0.044614688620098528,
+    -0.067548234425032577, 0.13016388696285205, 0.31664350978879313, 0.057682013081282076,
+    -0.080104277729541734, 0.13117006868944017, -0.0043570149317885797, -0.0031955982327149198,
+    -0.045506827168868745, 0.091392288757794662, -0.11978154342392958, 0.0017174539322604993,
+    0.1048403922621631, -0.22028453143857987, 0.085536295482031247, 0.039925070410147201,
+    0.04997255337820946, 0.21488971941563445, 0.05727256940921719, -0.13370330537077332,
+    0.06230609255663197, 0.2142183176620599, -0.097640335533963923, -0.021984394270493975,
+    -0.007455283910039287, -0.05315363493932012, -0.0095842045939763722, 0.1517707671933787,
+    0.018093039078217216, 0.22080659373504583, 0.011374159649641993, -0.19046185993790199,
+    0.072012490933625259, 0.16962532305556891, -0.015441628279731029, 0.036820906589453931,
+    0.15813184868687769, -0.021145888074254195, 0.011170445849228293, -0.092364780678043934,
+    0.14381115563785524, 0.061730926119225316, 0.21717133616409889, 0.10179003567738927,
+    -0.11688452041226292, 0.028255932570680698, -0.02413381812401949, -0.11443236730808332,
+    -0.26159884729218469, 0.022734814564570896, 0.085759378098468397, 0.10577313153560174,
+    0.21713348936755761, -0.01809508680805581, 0.020933047184174141, 0.023796447906142524,
+    -0.1093101046479958, 0.05409762094465851, -0.096816144635229098, -0.10376428710380103,
+    0.047276684647328655, -0.10745650219719659, -0.046822198705302027, 0.032484913501397809,
+    0.085203039220196786, -0.034818781214173679, -0.06191286635615717, 0.032305182146010351,
+    0.18718641602412597, -0.059735849259621887, 0.090028889322723959, -0.25758793407502872,
+    -0.12436930695674669, -0.10394441516014591, -0.029357938399025653, 0.071879542137385954,
+    0.034059701202159363, 0.022407111592867426, -0.15086021570088096, -0.11970945024612634,
+    -0.037596267288312966, 0.073016396001957196, -0.17728365456769524, 0.087446673946281361,
+    -0.14030127172139226, 0.088836811693796619, 0.30217417984853839, 0.10153613496117958,
+    -0.050714256782748574, 0.09330877660052099, -0.071107350639806041, -0.016052861993410324,
+    0.030963518591792624, 0.02741417496517114, -0.11802498644284308, 0.048640992347866646,
+    -0.073021910135293203, 0.096295882307657385, 0.01248740122874927, 0.066042735429785657,
+    -0.083732992676888204, 0.032587140145224514, 0.10108100677617933, -0.033106135976130512,
+    0.0026536387935530274, 0.056771967895115828, -0.086929137751208807, -0.063124118992475123,
+    -0.11815990624929584, -0.079160003711718108, 0.10213559292233794, 0.2364574070548344,
+    -0.07341589414580374, -0.10882549682734302, 0.10036675801202499, -0.2211268891398484,
+    -0.015350592009202508, 0.07562704011913135, -0.0036044616187263846, 0.15920287043541259,
+    0.1217997152412455, 0.022265663041682524, -0.043930104223871301, 0.014212537817750821,
+    -0.10799865656490644, 0.14779978479970288, 0.046833728703965474, 0.0067808825857172544,
+    -0.044575343226822182, 0.045884587417929806, -0.022544445249054308, -0.10647604792170429,
+    0.16878312295597242, 0.084226436081806633, 0.0521764698822271, 0.049622206591602561,
+    0.081464475768633193, -0.12955748080346749, -0.10458323122775015, -0.022826966319167398,
+    0.14120369652650352, -0.05486234186137872, -0.01130322196255925, 0.14425473701419034,
+    -0.010055637150557437, -0.02271752817579234, 0.080743069202813961, -0.075295957261134056,
+    0.19831695934361393, 0.07014822724756592, 0.022922858427984326, -0.080833359926069465,
+    -0.11636368207427959, -0.04004046804604218, -0.030872830288453997, 0.05288587906744513,
+    -0.016088353537013253, -0.041343621085729414, 0.024997129975594296, 0.058774424027705455,
+    0.011395875874380857, -0.042757127163813718, 0.054739315185960806, 0.11197916672256379,
+    -0.025209992275974383, -0.13908003999198212, 0.10022986602222193, 0.022882845606653129,
+    0.14344915734126368, -0.014269534103129073, -0.00022472370896657736, 0.02378648533025806,
+    -0.0090831467380547235, -0.069904737196064354, -0.028129050426154462, 0.012225532489042725,
+    -0.11858762881322826, 0.065168619351640214, 0.064509644693573065, -0.063014449973537695,
+    -0.14725398792379038, -0.16610568467602715, 0.065890513804665624, 0.13987281071243171,
+    -0.096874621512135967, -0.020823062616701065, -0.10756053010181321, -0.1352333650851304,
+    -0.089270583756644137, 0.020409079748589718, 0.071792792294429073, -0.010552776036457122,
+    0.020359210113245735, 0.15021177800353658, -0.024250186835899881, -0.2208808490497689,
+    -0.074753716930367795, 0.10394028513139986, 0.06919663261773612, -0.0064414070950541275,
+    0.049529131656578435, 0.052626423562488894, -0.01364122463417557, -0.0029690682022503728,
+    -0.03703015084394707, 0.041946787630297466, -0.028469191599382798, 0.068080779858640306,
+    -0.053356985516986359, -0.034295852362569941, -0.074171187107533648, -0.13927621050271552,
+    0.039476863536869147, -0.13743624684236294, 0.0091651819537471139, -0.087884439862564737,
+    0.2233350538040984, -0.15430539583754416, -0.022043880849079118, 0.14058633689037706,
+    0.13816589669383411, 0.095250109487708304, 0.051305910150166882, 0.12916515817172242,
+    0.22840127161640075, 0.024759841502301663, 0.15171766314406543, -0.05893920080920384,
+    -0.034605098792839815, -0.042940745616805935, -0.064857094517203909, -0.024459052219839485,
+    -0.045755380928797752, 0.03224864776845706, -0.023623756837271002, -0.087901552697558463,
+    0.1639640803360424, 0.088729315843809359, 0.10275460059104481, 0.097620173031717494,
+    0.18416497172231988, 0.11391377212798509, 0.26565789220209335, -0.079564183034033092,
+    -0.13711515079808292, -0.063151721621088036, -0.05600417081545387, 0.046386884128491845,
+    0.062750123099157215, -0.074972373417732691, 0.016433718711922073, 0.087124170809547472,
+    -0.072188199118022781, 0.1113474368108805, -0.060646613759189505, -0.041116156724213065,
+    -0.03797416409680443, -0.11195859989457174, 0.22126394169361832, -0.086573533228136615,
+    -0.071502207441627802, -0.043387887362328445, -0.0054188884747306924, 0.065155047435921015,
+    0.12046085467559348, -0.047733928059372856, 0.095998371190082643, 0.039428437914584377,
+    0.084530205747126996, 0.079426693264987913, -0.067481097001883636, 0.047661220847890137,
+    0.05701422657325398, -0.088642300006556013, 0.0020561084660458881, 0.022666104518589483,
+    -0.15244456995867584, 0.068715064381531146, -0.010102946075217332, 0.07713648053938002,
+    -0.14405370151274829, -0.049470388785014564, -0.087079991785076194, -0.21583993579070654,
+    0.00074899804352039981, 0.085343143662463539, -0.011740235001182089, -0.067440349321056692,
+    -0.14572982363437889, -0.13664040628697371, 0.0473288485671483, -0.063260875307091124,
+    -0.047846409751849915, 0.036624177249417689, -0.092220235340044296, 0.081158394506801054,
+    -0.16354394637180358, -0.17683924274424176, 0.081050133637533189, 0.14004856138334226,
+    -0.051670880077532011, 0.10315375890003115, -0.031615689501790931, 0.17624814721836082,
+    0.13914506757274253, 0.014009549767484192, 0.059823187321111262, 0.033214161622764062,
+    -0.0033507798362679949, -0.17527875345216465, -0.058860474426146087, -0.26735306771663186,
+    0.10225527706776627, -0.024506086375234257, -0.068654932233297591, 0.11211686325194353,
+    0.049529314948762587, -0.0287053228867209, -0.072499537899729613, 0.23057506900548749,
+    0.029234202037309785, 0.010518158756869948, 0.051981014753167659, -0.0098934657452765858,
+    0.19782348186005499, 0.26077921742226851, -0.090687016054375694, 0.058531182041789941,
+    -0.070399614953853218, -0.061531466314433431, -0.16016447813706192, 0.073857457248362485,
+    -0.016479232440545204, -0.11893932349586889, -0.091223790030538585, -0.05765629604385359,
+    -0.056769017467850659, 0.090435643147039155, 0.01342189805473085, 0.12464017817278703,
+    0.017975727497743909, 0.018087744817490627, 0.077732645851295495, 0.21997150043997402,
+    0.012140671370046055, -0.032622975957701944, 0.10273428431381727, 0.031672290999983664,
+    0.07392985406303812, 0.18274284571655031, 0.022995966160315899, 0.11790601300355415,
+    -0.040316171662155932, -0.050847265471288899, -0.23007599601605516, -0.0075464761587621873,
+    -0.01015184804334663, 0.077822281441678826, 0.043188268297690444, -0.12408142309813028,
+    -0.16773837755787158, -0.10491045664378543, 0.082449369756228338, -0.066263098195339959,
+    0.094887468749517062, 0.30498227092973268, 0.19568188931112215, -0.1668764374387231,
+    0.018709942380339149, 0.017434938566471252, 0.12657325653727497, -0.13353876053548441,
+    -0.16941353666180126, 0.091613751869687232, -0.0062844859818836536, 0.070825052857024728,
+    0.0065129398422883534, -0.035693383112757361, 0.096960574318458712, 0.021543304118775967,
+    0.086054149637854779, 0.16299317341197683, -0.12792584686051248, -0.051594167456527687,
+    0.01518980038309441, -0.089101306980515257, -0.15662389216443015, -0.08929838256804043,
+    -0.033071460436204313, -0.069923232698292065, 0.012702348278004186, -0.11795546181813638,
+    0.035844900036576623, 0.037987805140119492, 0.10043921768124935, -0.045718540168527319,
+    0.066758127199787951, 0.025298954734229481, 0.075970840435168094, 0.011040369731157608,
+    0.067125971121662686, -0.17547334734032222, -0.1603867464410576, 0.0030199660182439322,
+    -0.079899343291723671, 0.01573081710276401, -0.0013252678556177574, -0.069906024121786148,
+    0.12242890107834151, -0.057949039214435796, -0.091069251230680298, -0.062248660479473909,
+    0.11728925226107177, 0.084749441454868096, -0.097147943063218445, 0.1457178332736169,
+    0.0051540138656194162, -0.072128127677065029, -0.02353870747726923, -0.1649568848136562,
+    -0.028557400461561095, 0.022936178763585877, -0.11840040544760856, -0.0624657327666224,
+    -0.050895064910119338, -0.046537198003748219, 0.042868653417201343, 0.058782723603326689,
+    -0.12001862014056366, -0.019222458132352745, 0.20127874412447896, -0.045478914972366204,
+    0.048840888242050434, -0.11799146034698046, -0.060300001377643582, 0.082313100482272264,
+    0.0079721459824984055, 0.01332138272215882, -0.18700393974871138, 0.022511057582339615,
+    0.022589387479405892, -0.0068700764693878655, 0.1374073595226365, 0.11721314585005942,
+    -0.014005726462490684, 0.12899462087544422, 0.074119534460135653, -0.099707763843987898,
+    -0.19199996130694552, 0.044231665582804197, -0.1226807065451075, 0.066902642596726514,
+    0.14312825843273377, -0.037796548923872617, 0.089115773971036191, -0.058132137065466008,
+    0.12930520452774141, 0.027121724490196907, 0.048357326183349265, 0.13968835989584721,
+    -0.28479785503526817, -0.080196507301453807, 0.045066669072270416, 0.048885873288787435,
+    0.040268715740692088, 0.072555029997185577, -0.033603295217558449, -0.032208380713129807,
+    -0.067326059570950447, 0.024464441576890344, -0.13708457356965192, 0.046660236614493825,
+    -0.020283294045684346, -0.033075128167923268, 0.035672913885337283, 0.01285188784783353,
+    0.022219387034613833, 0.15776607986676808, -0.036284122853454996, -0.037673310196492435,
+    -0.34147087208621291, 0.0049724680729385518, -0.090627193765276864, 0.037973511522254623,
+    -0.028756473058251877, 0.12572637596424679, -0.045790505055979119, -0.037175722144298998,
+    0.017997101987724386, 0.075595265940421652, 0.034519215415417623, -0.067486790423584977,
+    0.0657115956915795, -0.018991323277545973, 0.054145210317049552, -0.095754712487953725,
+    -0.034469848429828698, 0.00097939469678439577, -0.1206222155070175, -0.059447109595170015,
+    0.020821858053053113, -0.19834908880485833, -0.21884687421253438, 0.056670747619523468,
+    0.14703495132662556, -0.051312227302785923, 0.091758835733099231, 0.12585476583922572,
+    0.12990652979651141, 0.039662331537335414, -0.062578150241026684, -0.026870055787253534,
+    0.016378908070409919, 0.17947137640957261, 0.12681303700571067, -0.029293379287155221,
+    0.17605934666119477, -0.02846505635822727, -0.12688982287615003, 0.041373751767957018,
+    -0.06459802032052489, -0.033191084573303928, 0.19143176258737801, 0.068016429901740005,
+    0.13005553449084273, 0.028874395541602243, -0.05273773602835239, -0.16262526080962258,
+    0.11246967426845643, -0.007313036742689869, -0.12937629137756704, 0.045861919530726901,
+    -0.13950311892155343, 0.030530540516371024, 0.083639524892069314, 0.06674989458958118,
+    0.080948960525695043, 0.080176303703880916, -0.08381027050615858, -0.17572542613435291,
+    0.21866163042809256, 0.040890173884277528, 0.051320362228166244, -0.12840422770077059,
+    0.21634565855161458, 0.016012501371767084, 0.21272724910262458, -0.11173159690376357,
+    0.069214094392183234, 0.064427892814460694, 0.15860686143533065, -0.048268635444351719,
+    0.048903993328398822, -0.07306847281865593, 0.0069384884422363556, 0.039258700154753967,
+    0.15218505787133985, -0.098790317635056024, 0.1270786893334086, 0.1856309669519601,
+    0.23573866904068369, 0.018770291158638534, 0.17108829271798484, 0.044758973559858133,
+    -0.11133676418793018, -0.021093516023593988, -0.077697317256144788, -0.055443467515446793,
+    -0.0065888745731477296, 0.10435800339750829, -0.054620329547120587, 0.013254648684251835,
+    0.047037348120312246, -0.26156057274696037, -0.0014674632650799649, -0.0079634472111704945,
+    0.083363493329945221, 0.16748402573843715, 0.36919676254607287, 0.12269116881723632,
+    0.09579864509294625, 0.0098835914497207647, 0.025264046575793647, -0.059605059201015109,
+    0.060711472709721021, 0.0251421133297508, 0.00029649060316672311, -0.094978834573531623,
+    -0.0094115533193492567, -0.1018827742433102, -0.0081491597968930771, -0.054768714801710972,
+    0.027296071412689547, -0.013119270562739377, -0.0040424464393554417, -0.28152372363438855,
+    -0.0019826653740251938, 0.059274623866356846, 0.10339591369783535, 0.031736274836723338,
+    0.013324132935751729, -0.13409535899483035, 0.09623942454442036, 0.13214705772276095,
+    -0.097260790840331554, -0.082856013100901862, -0.045611951868159827, 0.082520740724773556,
+    -0.091578930027359784, -0.17956081417317313, 0.11112216043129752, 0.068910941542761589,
+    0.012753975766712066, -0.038267867982108413, 0.087574783230851716, -0.07309571055074271,
+    -0.098499945564842026, 0.04409077268874028, 0.13233866930274257, 0.11026776451347972,
+    0.055970578191491233, -0.16871847462575704, 0.13686211041758775, 0.1399629058440276,
+    -0.076330245591142501, 0.01450939476831571, 0.059397369587762018, 0.11328706270276741,
+    -0.083402814107316148, 0.23040172380901791, -0.015911929422920128, -0.069068119566470271,
+    -0.19891972122466406, 0.038990189345943643, -0.066264424233341154, -0.098604118150440692,
+    -0.029781076950560814, 0.17760691881096533, -0.056749600949740089, 0.069033011837446742,
+    0.030631170412209887, -0.10177990163890256, 0.083342142172953021, -0.062078726209235907,
+    -0.058099137787206594, 0.010514069465623237, 0.11904264068319211, 0.028102771871648238,
+    0.024631144682979628, 0.083339387852124622, -0.025368235102875059, 0.059957248435873939,
+    0.027252756743694442, -0.1628314295718456, -0.17450599251398108, -0.10744636181395134,
+    -0.0057027435466106592, -0.047500522772838928, 0.014314432601028163, 0.0031824304200869197,
+    0.025316109760128311, -0.043291438411927043, 0.045974253547645935, 0.019366091844403431,
+    -0.020338393661763363, 0.037753183631343376, 0.07554382539177551, -0.038013506777030949,
+    0.061756010230281294, -0.082234444937304432, 0.040126919534339639, -0.10820419272395849,
+    -0.14242458640789663, 0.097166235293176195, 0.1504740301875703, 0.09192815514950986,
+    -0.040886978293244058, -0.14358697440103327, 0.020710514574063879, -0.013052881250400432,
+    0.11069175756003485, -0.2059596394396761, 0.0038251995246440431, -0.1898727686808056,
+    0.078519901017152796, 0.020190467099923275, -0.0278845086779901, -0.03993317518468778,
+    -0.025203372203704267, -0.035047506498546939, -0.1000966799035175, -0.041417295260043618,
+    -0.067394858601833821, -0.062290575180712064, 0.061852592071926227, 0.21572778258572189,
+    0.053550834031690142, -0.15071941958129656, 0.081970609022150476, -0.096091590075743472,
+    -0.011890769537604047, -0.037829408058338329, -0.046522338289447324, -0.037446301662254669,
+    0.14419449470352974, 0.11446958076919632, -0.050200878010546603, 0.12220989139620891,
+    -0.15308179824284887, 0.038877904172163393, 0.11584181005263752, 0.10350593508571422,
+    0.040101405264645611, -0.062472856007657285, 0.0014047814805434738, 0.025461096533077505,
+    0.033287287811979677, 0.062951590198100177, -0.068046778877634162, 0.21788564495262938,
+    -0.074483861101199311, 0.043435989080173751, -0.045126152867130453, 0.071886217448303355,
+    0.044829012599406672, 0.066162026163445561, -0.11498113950600944, -0.0038392395468471851,
+    0.10477143040462276, -0.035803264743882186, -0.086315282928812034, -0.087715397072257839,
+    0.046130823504063521, -0.085163421438245804, -0.16700172819253034, 0.04519807939930795,
+    0.013584600584566744, -0.027309701385989302, -0.1562643112324677, 0.14195469003790298,
+    -0.13052502199922297, -0.11703841468403085, -0.039974110293024785, 0.12573131352928799,
+    0.092976852009751323, 0.082524194853363361, 0.073994405690018569, 0.10435335127221471,
+    -0.12958014301264489, -0.17334356827823866, 0.1856422910691202, 0.079985811353878195,
+    0.059155004963931758, 0.13094100628689956, 0.14444069729856143, -0.13185061347743887,
+    -0.046164583981028934, 0.036943293746469548, -0.06207321889350538, 0.077249955423075362,
+    -0.11467472868747378, -0.013277156819428607, 0.016558595361959309, 0.019732591232955572,
+    0.11825923641494158, 0.050992663132838761, -0.12979206056459247, 0.22975652365882338,
+    -0.22656493453443891, -0.064666830506715026, 0.14658588890405683, -0.041655329538023707,
+    0.036148506414300265, -0.053370449279580325, -0.024629905524462928, -0.15513505185341128,
+    0.078829006020207953, -0.16895904632127492, -0.25140963834410807, -0.04566949400902659,
+    0.01127144022015902, 0.083539420414710186, 0.08338212385001309, 0.07697005444062853,
+    -0.16345993208641915, -0.082539314228351743, 0.19742032354067013, -0.008810061093020018,
+    0.039540116676644775, 0.0042960236934392448, 0.31704752091477356, 0.17761699071969181,
+    -0.012735063188273568, 0.15979588419711599, 0.032990901437863859, 0.2241429221879726,
+    -0.1845389208964448, -0.15547814243105743, -0.11047739649472832, 0.013311284423204157,
+    -0.048572271103444253, 0.047931813096038577, -0.11072053550691685, -0.13195575516945354,
+    0.082333568565619408, 0.19316651227980625, 0.15038281608330639, -0.016304507001160758,
+    0.011037437882995957, -0.014421907352600183, -0.14704258613063106, 0.074883158852899007,
+    -0.055251419430105232, -0.11177380557724217, 0.030396593081504754, -0.034659257668062292,
+    -0.083197749601787954, 0.044219899301126582, -0.035058995370596112, 0.037538498555143539,
+    0.094202475113831938, -0.036422196604954202, -0.005600890681544176, 0.077638355402451981,
+    0.047170223911285399, -0.15338450567967385, 0.10990526285714841, 0.0071147929355433572,
+    -0.0065585489697291364, 0.062398039110658138, 0.24236599243875784, 0.021302707130429626,
+    -0.15279542411445146, -0.032468054791118348, -0.058670250908714486, 0.10963256494343442,
+    -0.2155888865924678, -0.15790077844348907, 0.0015103375383673269, 0.11263305427871349,
+    0.024959671759078903, 0.023551831060539229, -0.042081140180093408, -0.11372082986221756,
+    -0.16323129818972981, 0.26889128516937066, 0.1384224820388846, -0.15495415342356408,
+    -0.082986035481365628, -0.021029632196079975, 0.13589419871417549, 0.13986976504227627,
+    -0.079206333975079701, 0.20523197670657725, -0.12661467250754674, 0.004269691317512459,
+    -0.023584745503604846, -0.27322624148955316, 0.036046055677218844, -0.060082274474589303,
+    -0.025050630048568976, -0.10424897487995961, 0.10841463527315949, 0.13875378479076259,
+    0.011290488851279489, -0.1008890026750863, -0.069414390270187115, -0.053647794020584574,
+    0.090253508634300442, 0.03919538249067505, -0.1044212955178949, 0.024757570783236139,
+    0.22940994464728529, 0.066254070990734312, -0.0077000971700856759, -0.1154221182397335,
+    0.095936653776409891, 0.16936257386406639, 0.012848714216991479, -0.09438567959597656,
+    -0.017203796554310379, -0.020389719893157184, 0.12413763990649358, -0.043628026108766871,
+    0.17511582982146889, -0.1802524462881003, -0.056390289694607278, 0.015631860808151942,
+    -0.0058305169866692897, 0.0017283004149255756, 0.11770651079352699, 0.031420810092154527,
+    0.0066628490573987066, -0.02610341757180475, -0.10597284756248443, -0.060024245536299224,
+    0.036716673144853211, -0.078870221194896561, 0.064075438803721393, -0.098368165357134121,
+    0.12664064481684192, 0.11896327363581301, -0.028842246257751621, 0.034162749912829651,
+    0.046162536802853697, -0.067031034421299637, -0.015599419889564793, 0.014226653884041866,
+    0.028373239992474205, -0.038084194933776676, 0.13925123397566502, -0.12131386857553597,
+    0.26528359064296481, 0.01965043586965079, -0.17258825791183455, 0.032553758733190066,
+    0.016599257875742381, -0.078635785693043872, 0.068584742936414533, 0.048952435586937008,
+    0.11135495528455523, 0.017259402230627122, 0.067614498098396453, -0.035210792719149307,
+    0.052535465201817011, -0.11998380873420393, 0.021606649877602274, -0.059380999755369458,
+    0.10825082870359323, -0.032471253229738491, -0.1718908512994112, 0.0069510179349342146,
+    -0.02974591866700332, 0.14351501424310209, 0.12334953503376908, -0.16409303690840463,
+    -0.039978341325012046, 0.092420100823702042, 0.023302711922551747, -0.091243334980058294,
+    -0.097620815812598349, 0.16060260453765812, -0.011567620743140505, -0.22513504343392771,
+    -0.12356152336096085, -0.11096846626811209, 0.14069678184049911, 0.013720346323546798,
+    -0.019127923853606503, 0.042778482157688161, 0.084908450872428154, -0.028854731697212019,
+    -0.1658682764607676, 0.018073197124531114, -0.11679159842309632, -0.052634722240242092,
+    0.11120087565826187, 0.17474504827446863, -0.16783216586620103, -0.15763469220616944,
+    0.078215707653859878, 0.090302901248358589, 0.1919255591979678, -0.03891518899136772,
+    0.072777774653404584, -0.01158831933473539, 0.052016679970119634, 0.01038525416735666,
+    0.062528414816568553, -0.12818232453521416, -0.015728824755014605, -0.271231273352739,
+    -0.0053475815695808874, 0.055499745788004012, 0.12497793098519133, 0.03511749127668249,
+    0.044636668951943612, -0.23623313724201436, -0.054343220594590236, -0.1106564533378204,
+    0.052519505952391826, 0.21536951098099236, -0.0767078701743584, -0.078947252692972689,
+    0.11335716124272545, 0.098102203216291664, 0.11729558879213364, 0.21003692779991226,
+    0.093021746547500436, -0.012558834439772295, 0.0052910197832442916, -0.038665904659149215,
+    0.10116777856059937, 0.073684739388484119, 0.0024633615921648669, 0.049658183083847576,
+    0.014577837420612525, 0.085692916588550466, 0.072252778548403215, -0.086606612446921111,
+    -0.042722489058506306, -0.00082716862904461716, 0.072824951545420721, -0.075554802358408474,
+    0.011464623829304773, -0.07197013233444996, -0.018561662610461875, -0.16687606785270623,
+    -0.026876221049539316, -0.12217563471981313, 0.12975745223762372, 0.12611751331503565,
+    0.017166164292091467, 0.14792333882582884, 0.11191303275590937, -0.089047513478172358,
+    -0.099159727433971098, 0.061734685789367839, -0.021661469220117736, 0.1600105667626765,
+    0.10825583347744797, -0.051268884247100147, 0.012046397089973952, 0.057239122956608587,
+    0.026154695695807143, -0.1258566462585172, 0.068341404616323376, 0.15636502214997816,
+    -0.10300740780172446, 0.0011631820403555245, 0.10060264038974347, 0.0048148233368961795,
+    -0.10618537835204063, -0.16521648250593451, 0.065448974942081697, -0.0039804698756651588,
+    0.069827220126279052, 0.0041738782476940448, -0.059254951941347188, -0.021237948502431769,
+    -0.0039278819330658106, 0.055662226576929381, 0.015496027314863424, -0.058179406094223209,
+    0.093534257846777755, 0.011688848677320195, 0.014638032710660972, -0.026761752870047652,
+    0.0064942455233209994, -0.07154483749927662, -0.18085136709624389, -0.016667334072786338,
+    0.01292452910222038, -0.099266439171294782, 0.11881725535228155, -0.027081029499859154,
+    -0.025505640026276446, -0.0048576159980930796, 0.0060003487842345332, -0.019521489106128522,
+    -0.039202338326316387, 0.024158129012178096, 0.076595286041013053, 0.11638340137625112,
+    0.23292840933375608, -0.12789969520354114, -0.18307285880240864, 0.19639439055191482,
+    -0.087506066142520544, 0.048405968493134874, 0.059390906159090297, 0.015365712740721798,
+    -0.16746729928118739, 0.071841197871029647, -0.12835013056942268, 0.07008139163217475,
+    0.01891602105769126, 0.14584408883414085, 0.19749662945157576, -0.071903743379041665,
+    -0.11507166335781692, -0.030333221071979093, 0.16068421228694071, 0.14606725705821047,
+    0.019941971904583536, 0.032007524343250424, -0.054679126814232197, -0.052648724352175727,
+    -0.15449381311381505, -0.038760865697574351, -0.14459922695768263, 0.058380472537630415,
+    -0.011632007408934953, 0.098982885660175629, -0.021928345965098548, 0.051039242533416289,
+    -0.20344762688819742, -0.20718054650959683, -0.042789699368046996, -0.13692695821921103,
+    -0.022820759224109626, -0.14692629782307529, 0.11493411236499261, 0.14446530100470886,
+    0.072765812168170949, -0.12499458121497381, -0.014878640724671922, -0.11228291806995824,
+    0.099859956299158739, -0.14421706207946344, -0.13821346874191076, -0.23151592446254554,
+    0.038220042125620857, -0.21500011331748375, -0.10836861371311533, -0.0062616937628239321,
+    0.056575027631228229, 0.066163276571554921, 0.008800249659291326, 0.11886390850526669,
+    0.11954731542565035, 0.0017471363419520308, 0.10511091332711235, 0.096664097042372485,
+    -0.078898760611996896, 0.016134711111054259, -0.081725434260302571, 0.093172910266502817,
+    -0.070707839888048019, 0.077242675309668649, -0.057629793728469846, 0.0686641510939867,
+    -0.11485616722081216, 0.037716808307502465, -0.060360870788853473, 0.1227384151292818,
+    -0.064811029336853926, -0.14047459780775054, -0.065270140287017442, -0.024062067149272372,
+    0.17909211932274627, 0.062197792365014735, 0.044881169445514166, -0.018718714986866659,
+    0.039411562489210905, -0.16346394844350395, 0.012221335922725897, 0.027059468639588746,
+    0.024595064310010527, 0.081092585435485087, 0.037694334296302111, 0.017917147873775113,
+    0.064292933486250342, -0.16702946077208927, -0.16196986874601171, 0.068660329706777309,
+    0.072794258747370111, 0.12368597170207987, -0.19741831268419444, -0.06242237035570649,
+    0.098345355309318302, 0.12733360071746422, 0.06727212159966578, -0.058745445234891371,
+    -0.026286544640793125, -0.11878392532697704, -0.033955285601937259, -0.094179924104488333,
+    -0.12545603051496093, 0.23003852543320599, 0.079312690286601303, -0.095112027754567646,
+    -0.034531724899326627, -0.063676192885091604, -0.08261975806048244, 0.0033445533767891308,
+    0.044142088312315197, 0.012906358109430067, 0.14066143215861193, 0.012567912478858419,
+    -0.00065721247167795235, -0.0081028868793871049, 0.00843485143631118, -0.00048641264184294276,
+    0.01299702276276452, -0.10281905801684182, -0.0041277354916972675, -0.031995407934808748,
+    -0.077499114843866124, 0.039960203682396861, 0.065596133601457288, -0.10939897513385259,
+    -0.015814178581820063, 0.017452990895627216, 0.063602917668953776, 0.053420206367581526,
+    0.16033573099501491, 0.013076740921084178, -0.091633566919969489, 0.22764984114331396,
+    -0.060991555556367136, 0.15481766653786866, -0.0026008368957658383, -0.027802602693566211,
+    -0.16110909319254671, 0.19408756988091858, -0.087319924963679546, -0.049379550019100299,
+    0.033820200931651577, -0.017412470570276513, -0.088619404098101123, -0.18473309437068136,
+    0.067272425507730313, 0.1519850364020949, 0.073702021749635804, 0.081136218280834019,
+    0.029819512652897156, -0.12927138039051903, -0.091413178302734141, 0.12677572614700663,
+    -0.11731427414774186, -0.062516972153105754, -0.12197204686160387, -0.22474067631492992,
+    0.038803744062048492, -0.061316181216586121, -0.045278974236669461, -0.075317251516968872,
+    -0.02556874764299933, -0.051668844948457686, -0.14909899378728461, -0.056496857705618936,
+    0.1289745346467448, -0.042285041860701242, 0.12134866787735613, 0.0099211144692841341,
+    0.087641979561142155, -0.01602887552182395, 0.092124899290056836, -0.22731149082604926,
+    0.02918335707012178, -0.12596062099134206, -0.012097674044992703, -0.10124662936210162,
+    0.11824713341187958, -0.042653839044997061, -0.013938879204523517, 0.069948668769005073,
+    0.11692167495908388, -0.004447734475129893, 0.089490127509765094, -0.07833788485538673,
+    0.044991803026772387, 0.064401428035973443, 0.044535890385022481, 0.074679254314365867,
+    0.00074105623089410161, 0.13040653997228585, -0.066701427556902199, 0.11592490791066684,
+    -0.04856875832303232, 0.04785311250087828, -0.13557917848326143, 0.047057506183165954,
+    -0.14964340712148649, 0.049964679600430675, 0.14332015373920906, -0.04432158859463655,
+    0.027539565221289492, -0.11013863241336677, -0.05299088372503688, -0.010442855690206707,
+    0.011715300464524172, 0.0022281127389213139, -0.064099232119523647, -0.033779473321527614,
+    0.046694682534447335, 8.3349735883126209e-05, 0.082980616197260534, 0.10210870106384361,
+    0.12715836966178223, 0.0040232262067103541, 0.0082152763395333273, 0.074335549239079382,
+    0.061101210833126696, -0.13762980122207227, 0.25486658389637568, 0.12680016852203682,
+    0.034396685527611721, -0.0042115261083242941, -0.07834046968440489, 0.019418449031386582,
+    -0.007395679104905903, 0.11272796056979099, -0.064369189450565814, 0.032738103150841649,
+    0.078183206623384294, 0.06996313380468093, 0.20865075049344459, 0.026852997426659093,
+    -0.0032501479980059939, 0.0097758951184159885, -0.051992349875200398, 0.1753768650147281,
+    -0.11915685664798255, 0.065834027184110175, 0.13272314081674041, -0.042848113339750492,
+    0.033654989754033915, 0.032404300028115195, 0.028088181677394377, -0.07303367906166057,
+    -0.091483801444070603, 0.038058885971267414, -0.022558831066277762, -0.11654683376994898,
+    0.064938040741345848, 0.043936601516544584, -0.08298636842145482, -0.096983466575177452,
+    -0.057765287805621651, -0.052761017224565332, -0.0028608533929601054, -0.01525707946862297,
+    0.076139484738704244, 0.12279840839686193, -0.16077475701146635, -0.021345977935021371,
+    0.1205086255857953, -0.030367708640480131, -0.036442167543732348, 0.0131722123262636,
+    0.050786169199937795, -0.13405740782126063, -0.041513713035800009, 0.025480865080515468,
+    0.092594438264494552, -0.013681097657769155, 0.059152463003472981, 0.021642977112778749,
+    -0.042410745427393044, 0.15746854658978307, -0.075271979712184023, -0.029139216980083454,
+    0.19740636548508059, -0.095058373334879862, -0.13133588224652812, 0.18353613843409725,
+    0.08587299677354597, -0.033083909053945391, -0.018156538630111702, 0.0080861645094787125,
+    0.074076426056928102, 0.021076147373838162, -0.10171509367878095, -0.038629450118508164,
+    -0.099965964982073371, 0.11889618850852271, 0.0088421007426448244, -0.19275921251573588,
+    -0.016127194826562909, -0.063411156185443393, -0.043495479402375373, 0.071284771258924268,
+    0.053070612203523271, 0.01459150763264077, 0.035804786488147326, 0.010014164839201945,
+    -0.0019528011934622966, -0.11977619283543972, 0.015152634230218419, -0.036926515894006924,
+    0.031803421874276608, 0.017713172387339046, 0.0037483289050520363, -0.13114871358389268,
+    0.061554115084611234, 0.021994097633960187, 0.070296543600242289, 0.02868901633561247,
+    -0.093704315423525447, -0.066082280723763459, -0.077882927452792614, 0.21052412760344719,
+    0.034881179643593913, -0.073077561543824332, -0.12347325174218041, 0.11818807731750884,
+    0.083341968768920666, 0.19766245573058161, 0.11977995573777589, 0.068012189390674813,
+    0.029081580347487195, -0.066161205758441338, -0.13733454138301027, -0.085490040918275223,
+    0.066181532916604655, 0.003548809654080623, -0.15745613167147368, -0.054078962391334286,
+    0.068831366169262317, -0.047632637402072263, -0.19276114324677512, 0.12616257869411993,
+    -0.0029402481880915232, 0.21932735270669743, -0.037411437985403563, 0.18533827419419172,
+    0.052049362847561183, -0.17323803008195685, 0.020874864488928502, -0.064089226431615923,
+    -0.011822342614082795, -0.0096595885151975792, 0.13864737152007531, 0.016356353364362232,
+    0.013654341999901088, -0.074523926578502431, -0.012795829358864062, 0.067897667233923722,
+    -0.015595199630086244, -0.095410347498450496, -0.19636363482716257, 0.0086879396924529565,
+    0.080879685842067006, 0.010737927004764175, 0.11598982966274825, -0.046741462917094551,
+    -0.049012435991052296, -0.032235760875361605, -0.090056685334277409, -0.0817476023684129,
+    0.089138681108447332, -0.066194435708290575, 0.042660338681166574, -0.11873135523442474,
+    -0.082395932471549527, 0.12372796605337272, 0.056396796646266102, -0.041899781520587175,
+    0.096900152527768096, 0.12212520272283883, 0.17070562630820393, 0.033124847836485088,
+    -0.081435851928662234, 0.10582166483345556, 0.061365928043262179, 0.050252289574689878,
+    -0.0052441521147255973, -0.10403608283504287, 0.30855985634824201, 0.064955637324231166,
+    -0.062072468857014444, 0.088780195103791329, -0.10637735132982996, 0.049221929664808019,
+    -0.022883456132909132, 0.059809586766568605, -0.077553960301805613, -0.020439988127533209,
+    0.086800614786169322, -0.13433060167885397, -0.068017692716439107, -0.031649841469021889,
+    -0.0049740176548951015, 0.026388398173325427, 0.04026959151381624, -0.1055558168093254,
+    -0.1822962960273754, 0.11278423055588885, 0.10288165114887841, -0.16342609676241243,
+    0.09845474942302658, -0.071804385885618785, -0.15004534430974806, 0.005816560658770867,
+    0.1164980766355893, -0.061655647973402332, -0.12100223914466952, -0.012410559356717515,
+    0.14490508487512496, 0.1382004293665991, 0.021819734199159915, -0.13508496965019906,
+    0.001000452492058191, -0.12481687872268993, -0.015008405750868939, -0.079469691554451855,
+    0.028270071628628535, -0.071327602014739921, -0.096668434502603207, 0.21850389281906502,
+    -0.038375179424480987, 0.0029960198226788065, 0.076314579768297558, -0.004896497888537423,
+    -0.053143852506825628, -0.030778758492178673, 0.13881052584070716, -0.12255209907184045,
+    -0.07844079926758217, 0.017638559759612468, 0.16455916346612809, 0.05052884923341721,
+    0.0058996267787122803, 0.26637043126484777, -0.066110605820389828, -0.16132871446077066,
+    0.047639386846194592, 0.021349994333740744, 0.028153446913660441, -0.034716320482004522,
+    -0.043048193735266561, 0.01832552139064815, -0.013331439782087144, -0.15577150770464818,
+    -0.028940958198583094, 0.058713648526896763, -0.024732522109260271, -0.092794248102452806,
+    0.0070415558571197733, 0.07114392414685998, -0.077536145286641406, -0.14635713337946327,
+    0.024257474162988346, -0.10995966252430044, -0.020580923894802317, 0.26480724722598659,
+    -0.013374770762845963, -0.14013634932911354, -0.095571019874754137, -0.11174288078213229,
+    -0.023906385507053013, -0.085398307061584522, -0.01005000943111427, 0.010363517232141064,
+    0.19760445582227332, -0.021423238244226643, 0.084970297198127709, 0.065685700803949074,
+    0.027087545248930964, -0.02427638818494314, 0.078710464698999075, 0.1345848691547302,
+    -0.10693129059070093, 0.092615687352343934, -0.16010337207630793, 0.020410560972506039,
+    0.047605978196975499, 0.048931594411065718, 0.090023118423797274, -0.044629618099503054,
+    0.18461660625950618, -0.040414076628520069, 0.0008087894544074499, -0.032880523994045834,
+    0.066036353493232697, -0.0054196703683891114, 0.058617532833733721, 0.11714848161138933,
+    -0.0099747602654387639, -0.056827955246806464, -0.060145234857565101, -0.12048103385878578,
+    -0.10129636921359625, 0.090251464723107452, -0.13035755239920757, 0.057316904343644441,
+    -0.029838000534743059, 0.14963046031264726, -0.016604999235362135, -0.033852168802163504,
+    -0.0053561239779837131, 0.022339123056024247, 0.070287554707104252, 0.041945706671149191,
+    -0.081416366345431146, -0.049313688209649167, 0.16982712403810482, 0.15384814169709393,
+    0.074438916815201553, 0.19393230301130723, 0.037443069932199043, 0.042179170776975417,
+    0.044591634074911513, 0.14415535928462661, -0.137204437284146, 0.023157387299824379,
+    0.13508096568925901, 0.0056989760812399086, 0.28180095789226439, 0.13363486306638969,
+    -0.15274261241493259, -0.11929625986727338, 0.022210073599124934, 0.3809288060517107,
+    0.0072746404816768102, -0.035776238347687304, 0.040674546691544557, 0.0098718194044836102,
+    -0.029630308646612757, -0.059153169647301655, 0.035842083869494827, -0.047446281638040953,
+    -0.10897801025269389, -0.091169730935366122, -0.13585198128572912, 0.02843176019629038,
+    -0.11704577195614006, -0.1936033012960508, -0.018818859287374031, -0.0028449713768017894,
+    -0.027222325457618629, 0.064953302960980508, 0.012938538235291383, 0.0037370676281887217,
+    0.10779583739566279, 0.011898634008900079, 0.023084884153701531, -0.058811576201879857,
+    0.189674890195111, 0.053620643646409116, -0.045441265094576147, -0.17514479211880507,
+    -0.12692716773093132, 0.061096852450116951, 0.12975751812271907, -0.1508949625726059,
+    0.28174713494148257, -0.014663061079318499, 0.11130224062696076, -0.043112215963813927,
+    -0.16104007889350797, 0.18744488473031665, -0.038344059782388196, 0.0042106357247573998,
+    -0.085944855159644784, 0.016163677710622163, -0.028498836408713098, 0.014929629458137793,
+    0.046598235441208245, -0.0032902208759941951, -0.05517025168445483, 0.12485512106366584,
+    -0.060554190284300868, 0.031743019314838111, -0.08926047077442173, 0.20294496369900247,
+    0.11615025769661229, 0.044918548555864746, 0.037328443887482951, -0.11635198424726004,
+    -0.13413798557905532, -0.019078081866808008, -0.010127816522681923, 0.12502541054294847,
+    0.12332312880072666, 0.10877640136244666, -0.024465544843361216, 0.075036622751569235,
+    0.067884153123611762, -0.017923467042594083, 0.074724050504481235, 0.091782106374873176,
+    0.036733540146192546, -0.073435770597514535, 0.0097275751971335391, 0.15074947654301016,
+    0.040056651710025905, 0.094811510186014719, -0.1278384272451584, 0.021111162822819527,
+    0.066433080485037863, 0.025410331506297731, 0.15775647249066471, 0.19704672861507394,
+    -0.023853499792338289, 0.074834963983055516, -0.057975329262350876, -0.185464735549011,
+    0.10774881900383618, 0.13258084992063318, -0.020895738872731249, 0.15559250551695328,
+    0.12995057222918269, 0.057627154144084425, 0.014677929995897163, 0.020256106196108483,
+    0.10110000888446828, -0.10432414957802597, 0.048185945792128169, -0.083059750938396765,
+    0.13855025263486875, 0.033077929661174579, -0.053206060238849072, -0.088148831978476547,
+    -0.0086685612465249064, 0.16630732899942224, 0.016185427787855169, -0.021458940850491933,
+    -0.018110033893776748, 0.096806866003096903, 0.03344102463872102, 0.0042846816974217196,
+    -0.013366287426157043, 0.0079850387064176083, -0.16848754573029334, 0.12010048268950521,
+    -0.17677464712563126, 0.00048855379731005931, 0.08587863826580841, -0.082047990974888255,
+    -0.050028047974027434, -0.19663472233038742, -0.024328515831375228, 0.24313988895372313,
+    0.18240872779280359, -0.018046720690676053, 0.032181791014093138, 0.058428191010598207,
+    -0.074605488727172015, -0.063964802298764514, 0.092982557461161019, -0.049776693753315934,
+    -0.045175458657525695, 0.025018537947161447, 0.038545848649155633, -0.02699138864497707,
+    -0.031786168204068981, -0.043857732018060216, 0.049575721460692931, 0.11683125461174429,
+    0.010956672301908015, -0.18995862303475325, 0.21679082949416059, -0.028507027511537858,
+    -0.14193364672056211, -0.11425316122166487, 0.011920253153122069, 0.040156580286305255,
+    0.055171558959078021, -0.082038952714440019, 0.27121156197623586, 0.068646725271077361,
+    0.14258368578716679, -0.13294972095820462, 0.051802324091902913, 0.028467718880001901,
+    0.080336049256304956, 0.034296741417257109, -0.10253681009980276, 0.014435765353651028,
+    0.13991167965364176, -0.04826219279416373, -0.088487288939278902, -0.078752928369418829,
+    -0.17356692863651665, -0.062754665047976943, -0.092566920825208857, 0.043879674662517194,
+    0.089767446967476863, -0.011158778821234776, -0.074316989315756726, 0.16211295597844536,
+    0.050369902862764847, -0.012042564028921987, -0.009096920221293988, -0.018315034914141628,
+    0.074613642237816011, -0.17246133343718695, 0.010370360770203341, 0.030304241881575079,
+    0.013864560044727843, -0.0945663764706519, -0.18522807046293713, -0.12471727860416033,
+    -0.020889735491701707, -0.072968241604784045, -0.022772648626957187, -0.055053232302421609,
+    0.19445130566388516, -0.076457824515525866, 0.01401043809409293, 0.04863721797517067,
+    0.1453728270838274, 0.069683691033810904, -0.094669040724628103, -0.095480549468654502,
+    0.032510693014451114, 0.019663579243482835, -0.098429044217350048, -0.082356467175062273,
+    -0.014463903217464885, -0.013760298397830188, -0.075846627526858834, 0.032989657136367798,
+    -0.19655167464523371, -0.091241358625461219, 0.10208401715667582, 0.12525915816347771,
+    0.082191707775236975, -0.167252524886666, -0.038029107085615299, -0.0422980720948338,
+    0.042322164487023098, -0.066337480574580721, -0.026911650902492767, -0.10818414776836005,
+    0.10039880142885443, 0.084203227240282702, -0.033449675431610454, -0.071527240431046413,
+    -0.030350714569529542, 0.17661203770719991, 0.086343563183015254, 0.12571633973498339,
+    -0.067354877968261076, 0.13949039679156552, 0.015035186077252445, 0.0062122574885926582,
+    0.12900369804860737, 0.20737749794259819, -0.032252718009136462, 0.23276748631231425,
+    -0.073982581036622072, -0.020787607611946934, -0.093616455710259519, 0.16178706659964884,
+    0.073551811462396657, 0.070710442134417503, 0.00078507569665375691, -0.138061028144387,
+    0.098648595846433346, 0.071787216336537549, 0.0013003657339220433, -0.18791796899896915,
+    -0.072711312973260583, 0.078737488908147774, -0.1317681182873266, -0.069677585880047938,
+    0.19409889854484727, -0.08382379069862872, 0.1350628214270648, -0.075051901192685913,
+    0.10129085047422465, 0.087674774216157547, -0.049438846133896978, 0.0092288500595951346,
+    0.012786246275724299, 0.073153031754678993, 0.04309605189920112, -0.050652978389075766,
+    0.053332829083274261, 0.074330149344175686, -0.078275973896169027, -0.10431253903307425,
+    -0.004229000085769481, 0.0066759995176924524, -0.083134200233637712, -0.012369180648553552,
+    -0.033891233588150951, 0.12500533093123775, -0.12973438444985885, -0.017725304978511627,
+    0.032833046578921499, 0.02440787507512459, 0.061792634785949929, -0.078859130066014083,
+    0.07755149664163398, 0.052063637328772096, 0.22851551196131081, 0.11532336018044081,
+    -0.037583217109003919, -0.10053067801923259, 0.036993413489679015, -0.065796591031205678,
+    -0.086357688132137511, -0.020941779896476654, -0.021163500583386802, -0.0069805512888197882,
+    0.049667360853451074, 0.052684868869174492, -0.048432575796486729, -0.14293780012316307,
+    0.073247546065337496, 0.09363306303956255, 0.026369947309821312, 0.045266078726265042,
+    0.051333869582536641, -0.079649998973138694, 0.17843247596624687, 0.0098352237488122003,
+    -0.019943548518645632, -0.047781260645903115, 0.085215746936341374, 0.17022196208174725,
+    -0.097724524687952466, -0.11499295563402286, -0.0072239307163594058, 0.09402027070384103,
+    0.042793318636804349, 0.14282756101617386, -0.087705790324730928, 0.043873826358044161,
+    -0.088194101428214891, 0.036752583982591895, -0.024357575111490431, 0.10482547911616706,
+    -0.08446435660413705, -0.093701352027330445, -0.061609590541724754, 0.0026900148982080601,
+    -0.14625464202756311, 0.094739787205755877, -0.24070082610223434, 0.17684040037691642,
+    -0.048241386183486133, -0.049852861635820277, 0.099807542147406794, 0.075475236062755843,
+    -0.048080584661128578, 0.18510106768155996, 0.12516939114962164, 0.058029449101616878,
+    -0.10504684957597837, -0.01235368595360797, 0.020384030985543089, 0.017339707564305546,
+    0.054086057212118531, -0.020443500817596647, 0.080820640168276364, -0.038629415375148364,
+    0.13795600440014588, -0.045378571638970772, -0.031552939222434469, -0.11773467024019907,
+    0.033162810096128176, -0.058627246941669403, 0.029405612689597599, 0.016561970132980521,
+    0.016747808735323694, -0.073318503928036932, -0.11491627540213092, 0.15521474874039487,
+    0.16190213190979252, 0.08678392639273777, 0.15806965874163159, -0.052554156621499225,
+    -0.00034415910891980289, -0.18160555002185386, -0.18028550474794072, -0.16168286865959167,
+    0.07712874519882533, -0.074605757514249776, 0.082898222385252462, 0.036596890621485301,
+    -0.09550327023615017, 0.06064270715395495, -0.13742648745420133, 0.18863720931103886,
+    0.062906355167342359, 0.073363384128462494, 0.013069462522606996, -0.049616883049607617,
+    -0.020822194687410648, 0.11313696861170418, -0.12449913657973501, -0.073690151768572631,
+    -0.034111567487431729, 0.077444363669435579, -0.049844882837686164, -0.057501224610549954,
+    0.0080710317494195136, -0.024239976504748566, -0.090263260669184345, -0.17126084952247411,
+    0.15842391833572786, -0.18484520530746196, -0.21509150079544531, -0.010460338535839846,
+    0.084183750059181051, -0.086401329110339931, -0.047584579583795784, -0.073257371039397917,
+    0.022717570390035986, 0.037164048632918091, -0.31097533428211604, -0.12110254032689106,
+    0.10936172711858635, 0.00057342386226113845, -0.023118399566109248, -0.091544635454392634,
+    0.10770064510052733, -0.19700523512162801, -0.14700858735131361, -0.16828909055615301,
+    -0.095746241277306965, 0.14076564334118113, 0.046712168259792422, 0.068305887546349836,
+    0.043494879259389593, -0.093538611010996628, 0.12115132789204475, 0.040891801228862705,
+    0.069431129872171968, 0.14798809198624843, -0.015194215968035803, -0.089421335944623676,
+    0.028747242060146734, 0.050833120180531391, 0.068314236541078113, -0.17606534639317004,
+    0.0059368502145575527, -0.0040246173682729567, -0.080747692875025215, 0.03765529276617343,
+    0.11751141334607708, -0.00010311936442637136, 0.035703862181366751, -0.0036775553070417088,
+    0.06165720456567475, 0.0013291186635940888, 0.14038796419102903, -0.0061020523119588903,
+    -0.011563844289576186, -0.025169968174791141, -0.11925205451848239, 0.023603620075991854,
+    0.097323701756041936, -0.094314043845087445, -0.070939187014941132, -0.10347394258789094,
+    0.11199775342912331, 0.2245220796248989, 0.055236639929478998, -0.070672323789470956,
+    0.08657302622520624, 0.037081886869025783, 0.061392123552412067, 0.016535566631055928,
+    0.059487178225840417, 0.0074096030733512373, 0.087960127339702016, 0.066258293117058789,
+    0.050713811024348375, 0.21423936202609792, -0.0069348751783318641, 0.17543002430089064,
+    0.10349904792205673, -0.061000413863168387, 0.038606683952930786, -0.044909554287399893,
+    -0.19864974776073219, 0.049245842775294403, -0.00027910307659312361, -0.0011542572372157793,
+    0.13060540666745146, 0.16079183531469515, -0.07700158546756769, -0.1718513044819798,
+    -0.33975306734581256, 0.16598869170864625, -0.073230585974920867, 0.14312044516412933,
+    -0.14514734143045321, 0.2222558815643606, 0.23538719241043143, 0.076588284607016097,
+    0.06873798003476661, 0.0098387949219670614, 0.021609574082558008, 0.29519750031880471,
+    -0.12700140106193039, -0.039610769924063004, 0.13673440903818582, -0.002407366797890052,
+    0.036631069917879774, 0.050855120917568608, 0.2173360792157604, -0.12372568946838476,
+    -0.0290475264301784, -0.045832878909979106, 0.11343816244201595, -0.066686089925982697,
+    0.0044234234027103131, 0.096313531152165635, 0.091011633305206938, 0.081533455396916407,
+    0.15858407136019301, -0.13936788163389599, 0.061452521566928334, -0.030657885420505925,
+    0.18681291325983282, -0.070059357612128031, 0.11520155123070562, 0.0051303219234557773,
+    0.078115208006456105, 0.20944875037234134, -0.076665397472710145, -0.024703999214269037,
+    0.038326385473542106, 0.015026015855878464, 0.041377626840193311, -0.12826552781340117,
+    -0.01787640695326272, -0.041654530715199548, -0.017287896827329657, -0.10466826407934876,
+    0.056256476684580191, -0.032989826559593628, 0.043704941398799317, 0.13251380123980674,
+    0.082841628339981904, -0.033885512945185138, -0.033554306453039431, 0.053316737561117857,
+    0.066468177669207235, 0.034920347113268149, 0.087544126506538825, 0.073228493669295777,
+    -0.068240291690526186, 0.027611051532868365, -0.13428939286271852, -0.061577288198168004,
+    -0.086386681631437354, 0.059320911444686569, -0.0060192505360817878, -0.14609932856255164,
+    -0.15763435108207879, -0.1030079915759759, 0.096496829769136844, 0.098781853109732642,
+    0.0014358335194941949, 0.02077028862355022, -0.00073676882791427951, -0.046428744545442775,
+    0.032599774052502216, 0.026892131516125503, 0.13764391188714145, 0.13703847322191168,
+    -0.12390186816378183, -0.12676138490175237, 0.085229921516537396, 0.12192620308205467,
+    0.19727546066572732, 0.042401982519189016, -0.1009714929200209, 0.084603568442370922,
+    0.088951899253054578, -0.0095293850181662997, -0.042592956880379292, 0.050507749642411275,
+    0.064693640951172984, 0.04451132448799143, 0.049014766256707538, -0.10212843418613311,
+    -0.075188559762875112, 0.039874382020524193, 0.00047925183735800204, -0.23508101616785723,
+    -0.037445623928843888, -0.090807975395418281, -0.025934953424465543, -0.22629525768079894,
+    0.001848266775404422, -0.04590393365830981, 0.065053338691339932, -0.03761514813919356,
+    -0.18150136182462104, -0.14346706303361198, 0.025359397364309366, -0.0075858163256964078,
+    -0.072787005992599824, -0.116971750205525, -0.10190534802135132, 0.040755515963496684,
+    -0.0075815303875943338, 0.095334850287114872, -0.0050577279219530761, -0.003807567261185015,
+    -0.11249546751827762, -0.081355826597722003, 0.091711512218723604, 0.15239198874853194,
+    0.02964461749138737, -0.027091600258145582, 0.062028391216196362, 0.019415920223017712,
+    -0.0054763420321473954, 0.038055358315427487, 0.14217839224131201, -0.09449152438887895,
+    -0.13795002241162468, 0.10188588785690182, 0.10072743811369593, 0.13944028299946171,
+    0.22109689921758766, -0.15674865940020627, -0.023411045487576637, 0.048940645670994425,
+    0.050920058592403152, -0.01996567385233949, 0.091827423194401347, 0.011804801185436406,
+    -0.018885100064652518, -0.078426293341211123, -0.013834996311811542, 0.024250385430149034,
+    0.11929713076749415, 0.19334633357075665, -0.07836469123432302, -0.040565358016323307,
+    0.002629544772443761, 0.014163871220078001, 0.054286146354839006, -0.014255688766460323,
+    -0.063473725281554691, 0.1671125487966901, 0.1419301654133085, -0.076498366935933926,
+    0.058993869663977877, -0.05534314292322861, -0.039490009078053674, -0.0059128901323330409,
+    -0.060842110504029677, 0.20843356076071873, -0.12445831084356238, 0.033878861310428457,
+    0.12564840053727766, 0.056333249749249248, -0.018125810026798073, 0.066439751046903917,
+    0.024707021605355178, -0.037421407893291021, 0.034149405350169422, -0.028824991982029098,
+    0.035159557791876038, -0.04805887234892578, 0.15647503172888555, -0.25022073680554169,
+    0.024831705313458796, 0.13777478076957619, 0.093376766678798087, 0.033715172162650131,
+    -0.013148008939247184, -0.050461614538559199, 0.10076689672839069, -0.046752645493267672,
+    -0.052541897775132074, 0.0058546639555694981, 0.13365975882366588, 0.012905856901882241,
+    -0.049659290085150971, -0.17654757467016932, 0.073884454204698052, 0.091657169269431377,
+    0.074244666747687205, 0.10591703830568737, -0.045714799729103514, 0.038627269910129138,
+    0.15485752248053053, 0.11439427632803641, -0.15342058688702348, -0.12743188187372609,
+    -0.087550160174304018, -0.10087291426073905, -0.31594506483704926, 0.059653704906949025,
+    0.048341317091160296, -0.1338732872339031, -0.10392982907980099, -0.065669427367132979,
+    0.066807276768668322, -0.089625438625778986, 0.078945874991493248, 0.089251508342791219,
+    0.022329567358944563, -0.021783170329429131, -0.038118144372609984, 0.027869443138817836,
+    0.047617148774073255, 0.039376187623876131, -0.056564288950671247, -0.10983558830574534,
+    0.016766569493365524, 0.058039956523173224, 0.15471570686634531, 0.084727419760792386,
+    0.074937578344426686, 0.17925529271561175, 0.0054403285523147394, -0.072437397037140208,
+    0.22145112990432742, -0.11552817885855159, 0.030627157671136013, -0.20523864516436283,
+    0.061821826842251543, 0.14857440734523691, 0.13507932045830354, 0.01946872505762965,
+    0.037527479111209891, -0.058853804230331846, 0.039353251463321734, 0.058415253912301207,
+    -0.045874941585970476, -0.1223164311621493, -0.13979201151030179, 0.048745551952438924,
+    -0.095527577674598185, -0.020826718942936293, 0.12472392332718112, -0.037677900147114141,
+    0.04860542124347976, -0.020932405891304229, 0.0096350177896402378, 0.027120375745940457,
+    -0.13413880557615571, -0.052576119968278101, -0.023944538349098543, -0.019495391924609879,
+    -0.15958336913724017, 0.015412560648170127, -0.10659283875851695, 0.18270915874516674,
+    0.18876399179912604, 0.033234589441061377, 0.24548536009440694, -0.042532148355635513,
+    0.030875415659280307, 0.16542534244505999, 0.080714093732242934, 0.0032620981589838644,
+    -0.012057184279130988, -0.023725248949531499, -0.072427397052385725, 0.094117664445201407,
+    0.00054371402888047889, -0.32492345989767962, -0.13864386984160545, 0.05079023009576332,
+    0.069310009560464111, -0.13416971355757304, -0.072051989854767795, 0.058585623321586615,
+    -0.14815309371099009, 0.15641087864128345, 0.043771124313525589, 0.00054712245224507346,
+    -0.16633599626516865, 0.011837105034034056, -0.010252659560761422, -0.035264455017907453,
+    -0.28215306318613076, -0.022529948437761373, 0.021461272566155314, -0.015626569650870527,
+    0.076527486638453976, 0.042896956681695991, -0.14301243604565322, -0.16938636866522144,
+    -0.10655651304763188, -0.061263611352551706, 0.014790986019166187, 0.077257036221325348,
+    -0.14068811053367736, 0.17351097817376498, 0.0631184450431473, -0.13424945295410626,
+    -0.080934612457701186, -0.076131878007130324, 0.03390841160029022, -0.1600374260423075,
+    -0.078079630742939388, 0.0026019016832118788, 0.13736654295403813, 0.19773393715710486,
+    0.089684838956773053, -0.13841572052340842, 0.039475517452499317, -0.020769941763502685,
+    -0.021620709930568444, -0.071473138311023046, -0.079184898976909487, 0.02270994699642339,
+    0.072532016679166186, 0.044762442451863019, -0.024322195730820544, 0.099354120024008064,
+    -0.12343641213091829, 0.043085575004329454, 0.23725015174215758, -0.024054939959591133,
+    -0.02501766316177996, -0.18446916358136045, 0.078343522524930598, -0.081198696139177143,
+    0.094294703989808368, -0.065880424140415658, 0.011918787961424152, -0.029781891741779257,
+    0.013601844464592458, 0.092755234732555855, -0.10600402298600933, 0.056314514461916737,
+    -0.060074194482924843, -0.1613417786519506, -0.082361970542980792, -0.16976093250996208,
+    0.023705575592148049, -0.037192549918513722, -0.085519108699825902, 0.11722824507107475,
+    0.013351403087217696, 0.10648810186734126, 0.13712122375003258, -0.020580996750058561,
+    -0.010677996437828777, -0.10454153499546787, -0.0016446341372816236, 0.091772463606507426,
+    -0.20857446892736534, 0.080848702367867675, -0.014077290966202992, 0.10337095559871877,
+    0.036230966246290658, -0.082568030690533922, -0.037958078814017984, 0.18110523854959265,
+    0.10447470482867463, -0.016085979472555176, 0.034451761734934, 0.011557233678027261,
+    0.05469737188673441, -0.018679750787104949, 0.066193296826395659, -0.13320105269870183,
+    -0.068298246356954362, 0.063234543973703247, -0.028050244358396727, -0.0038045727747424733,
+    -0.20258345010381612, 0.05850247335177762, -0.029622880780173409, -0.059119986037821995,
+    -0.059180479723722854, 0.052044028648642063, 0.10069167979703697, -0.055887260532928286,
+    0.067654921292787287, 0.048532883743144212, 0.01349424942213452, -0.10140354242163305,
+    0.010173194869163569, 0.10804497807788205, -0.07965322391470718, -0.036535439995536975,
+    -0.0057626559983980138, 0.037563105096655502, 0.11976633138329557, -0.042176350776430456,
+    0.089454767754658979, 0.024585460175149905, 0.038812952879931202, 0.074565998628348479,
+    0.02847405325293394, 0.046058089079855542, -0.0022525599256237234, 0.088315223059187778,
+    -0.056371282862526254, -0.21369800854394783, 0.096419302792127987, -0.059664820404476189,
+    -0.0739590969126592, 0.13637546437445483, -0.10980721116486557, 0.093483536406758314,
+    0.16729870353721102, -0.0046030236188833156, 0.06490744408747956, -0.055190665640876491,
+    -0.0084369613397906554, 0.015747196060469367, 0.1095774796540642, -0.08196539304532717,
+    0.11300286825278481, -0.0036446076910863607, 0.11747478771700559, -0.019297771142774409,
+    -0.16307369404444938, -0.087650068383835877, -0.078994066647022895, -0.048152838657049606,
+    0.0042093353685865951, -0.023356528720872179, -0.052508764314900605, 0.09169939032031886,
+    -0.093542934699911248, 0.051673604155936352, 0.10492385575558447, 0.068346125526606835,
+    0.084540365380888258, -0.09215461534740535, 0.075976435354509847, -0.11000637252959058,
+    0.041479477519545338, 0.16346785783695056, -0.13139293389352655, -0.17488774656121941,
+    0.064307207784249767, 0.14580787021682906, -0.15568766310080276, 0.18209011672646794,
+    -0.013840317499766157, -0.031036194635443767, -0.045638443694946997, -0.03978020072917738,
+    -0.12232342103024091, -0.074665408301491001, -0.058002579136851327, -0.021047056210586397,
+    -0.06769171664520543, 0.059987583435162542, -0.13046426546956175, 0.032711377991003009,
+    -0.03079709504854081, 0.077278600372303913, -0.041683013116462664, 0.0053261313147004745,
+    0.0447642046659988, 0.02383921455969772, -0.047868422283655697, 0.088529170466725718,
+    -0.19144537912156134, -0.18995363625819731, 0.10966598198701981, -0.08897834660751236,
+    0.016808861613242142, -0.12136478885425621, -0.23413502617538615, 0.12682143567310872,
+    0.081673529369697184, 0.059413576845888966, -0.15876051682987119, 0.030085538291426243,
+    -0.14301545877349658, 0.099154489416122191, -0.061110748901770415, -0.10333023126459846,
+    0.056777382745903777, 0.045668027411555054, -0.075604375143071723, -0.13841778265405164,
+    0.03937419253430266, 0.0039908315185146186, -0.010021009312204301, -0.06712153227361646,
+    -0.041088937255752835, 0.015624593160391116, -0.035790036646898886, 0.022940768478214423,
+    -0.084964889715429884, 0.070790256031163096, -0.11721043648500862, -0.042671439977778398,
+    0.076227383777884877, -0.14086747027565338, 0.063813418433267335, -0.068632613594858213,
+    -0.022426409059959927, -0.1198667167430547, -0.11313574136609238, 0.023092597632415852,
+    -0.01843329912233516, 0.083799496715051838, -0.021364233722631153, -0.065665415154991733,
+    0.044153146805618861, 0.059265278318551572, 0.0027433011092868813, 0.025528515272121396,
+    -0.025337087414517567, -0.034928279821957134, -0.187008558807501, 0.038826245765595853,
+    -0.060173058340857725, 0.069133879656214606, -0.042601679827594365, -0.014057097250455109,
+    -0.19243154823243155, -0.013504669623735671, 0.064283037118115324, -0.18220786307273815,
+    0.065578028333834262, -0.00090023685525301902, -0.024030195349304818, -0.11311115136437581,
+    0.017469413277006678, -0.0079575330468802854, -0.10099928031205196, 0.029539195805363745,
+    0.10823519995990641, 0.073290363380300649, 0.067561741099925118, 0.11420287450530361,
+    -0.00056429770876900514, -0.031642653697692806, 0.13835058151084118, 0.034209130499411815,
+    -0.015540276678777797, -0.06016866652909221, 0.027051641531953267, 0.14625640006297563,
+    0.0889246025223039, 0.11447413512995369, -0.033240481059974757, -0.075019245956082892,
+    -0.075059665017567403, -0.046254864915786016, -0.022137859600534462, -0.072584319209462372,
+    0.046094757064191916, 0.041573195115285955, 0.085750725324680963, -0.0084126086850690694,
+    -0.030481226673241192, 0.080590702179682991, -0.27721830891053556, 0.085446225880414728,
+    -0.10935080413151076, -0.034207443878795984, -0.14437434969554144, -0.12108672806682347,
+    0.027260651519743172, 0.059921453306356377, 0.14225636828934485, -0.017781093997153111,
+    0.135792896701248, 0.063146394048281276, -0.029790709491499947, 0.14055307456149879,
+    0.027272396113788878, 0.10136124705714243, -0.047471190707343659, 0.017873717449469268,
+    0.020253437547831037, -0.081716451714250404, 0.1286124347849934, 0.11043991283737729,
+    -0.15320046822980932, 0.1759732139953375, -0.062193788795615768, -0.11951519209353309,
+    0.028670676186294819, 0.024555410876521567, 0.027449577559483095, -0.015987756405995535,
+    0.087535361211939292, 0.15665528198054776, -0.077499459873941856, 0.018220767432126264,
+    0.12880144986739331, 0.14943405938200266, -0.0076733249808215364, 0.042830793682347025,
+    -0.062018850355777935, 0.10515591277247986, 0.03813291772083089, 0.077093694920343805,
+    -0.038717487359313053, 0.072260652832694325, 0.056585964689146021, -0.022723610193416868,
+    -0.10990937348424186, -0.053727389460924167, 0.0040628941190552284, -0.094812793702628129,
+    0.098831296061528878, -0.032702659604038405, -0.070944745933542677, 0.0063044903118039718,
+    0.026139461854914576, 0.030121825657347921, 0.0134585354688931, -0.01620971669927318,
+    -0.07185122232506945, -0.083489583251608976, 0.090026608700703281, -0.035826078249515274,
+    0.10864468307027483, -0.050398095851581955, -0.047707477537488732, -0.0090339311955898657,
+    0.25331218975328496, 0.21232006990086469, 0.2691772488479473, 0.082039809932942423,
+    0.12026677447045273, 0.067275605006269917, -0.0047183528912385104, -0.01773029389760096,
+    -0.018796173329081383, 0.024010007025528506, 0.15830049534230653, 0.10385418886112815,
+    0.21832202928348293, 0.0067596340373966713, 0.20269659885590449, -0.080326386810491118,
+    -0.091849462892639247, 0.068778868963055323, -0.17459382115860364, 0.20211729702257789,
+    -0.052012483928609445, -0.14385545266226626, -0.020455788018033938, 0.06329765417306589,
+    0.078322452185510608, -0.0066013638787271664, -0.045786627725183306, -0.05377191589613331,
+    0.042255227205756987, 0.20846533344820775, 0.061160050521886271, -0.0022994291943230732,
+    0.2219713549028576, 0.015821319561515095, -0.051019176125749591, -0.052622001132420063,
+    0.052375732171583186, 0.076761418967325967, -0.0059335172085683225, 0.13522142042771615,
+    0.049535306196950728, 0.067362848161375694, -0.066225176287622048, 0.028004633465698984,
+    0.083279286536612165, 0.013048372669692937, 0.025493338310825016, 0.10564118797439445,
+    0.0014078369149218113, -0.033230067433152301, -0.0012536519455368406, -0.058453569964571822,
+    -0.13163259682572648, 0.043195902932582346, -0.043157756180651118, -0.036643688556818883,
+    -0.056064803506799023, -0.019722649282894966, 0.035122967887642208, 0.02873433266662791,
+    -0.1045848751562381, -0.030632405498351296, 0.062861884993183084, 0.064690781744196887,
+    -0.029222743238097836, 0.017540606533138013, 0.014755894147143589, 0.063834198934574579,
+    -0.0091190568552221626, 0.090533099695018743, -0.019430544868020223, -0.038869723447995615,
+    -0.10269240668351415, -0.094022687009852848, 0.14982559924992231, 0.12423013121995569,
+    0.066977777133172212, -0.014506406462695432, -0.034260693869519729, 0.0052267130161072796,
+    -0.15439790291202443, 0.19306455923313381, -0.061095887508220377, 0.061479406378810456,
+    -0.094504642565164471, -0.005529265630152525, 0.06600544928606801, 0.015300464941061683,
+    0.13259198484167706, -0.058401045290051218, -0.07276733567635045, -0.071678663513441751,
+    -0.15921460480657967, -0.02357914461007753, 0.030742622629545472, 0.099227871895692626,
+    0.060990207168226264, 0.0073010323570709664, 0.05116818195978852, 0.16643550651514108,
+    -0.079115330334905712, 0.17473630386752553, 0.13397715922964268, 0.099457091401304196,
+    0.041252473041924087, 0.18988383708721665, 0.054982988287238993, -0.19047626121805003,
+    -0.083666349886148988, -0.098521541068918458, 0.053574603296998757, 0.076155762834516708,
+    0.086063034623964432, -0.17736412318618303, -0.10857881204656866, 0.0167247968989538,
+    -0.092856777046711386, 0.025731340706712597, -0.04075166935423321, 0.031427901028178711,
+    -0.073845345971888215, 0.062001361802069277, -0.13671383904833995, 0.045529030279764141,
+    0.0056355051701679161, -0.014940530283498848, -0.26472049760379934, 0.056962605417139635,
+    0.10177783954620699, -0.16889815123901819, 0.056342272046007537, 0.051065481437428249,
+    0.054242162756451648, 0.14828792614540048, 0.0099027658797571708, 0.0054413077631109436,
+    0.050949103616621166, -0.0058972006611721726, -0.098691859678739655, -0.0085476394275340525,
+    -0.42417719792572522, -0.086510340050842488, -0.091231699455486592, -0.030569012035452377,
+    -0.10705464472541661, -0.20000533897749007, -0.17493991121016972, -0.04515441615477539,
+    -0.026681373293891159, -0.17557113692244644, 0.076915048599945107, -0.071885439386421154,
+    -0.072423661016435797, -0.11356738792499058, 0.16515756146357918, 0.01124301594447873,
+    -0.027597029245748458, 0.024482056391617633, -0.13611265187336952, -0.049335316227926029,
+    0.0036783139262880518, 0.13123802533050494, 0.051903304910917221, 0.036360438694686747,
+    -0.073256879105937714, 0.023989319248844211, 0.06191023215957852, 0.26645106021700071,
+    -0.054355325238846348, 0.016481714618038875, -0.050642817233000133, -0.029248971828790743,
+    0.19023172676422861, 0.04054042169600152, -0.069944453394322065, 0.020818664699700923,
+    -0.058939812151757351, -0.0092221602764787705, -0.024621275264094165, 0.023114284798192181,
+    0.047634469730904141, 0.166690500244222, 0.020609072833607245, -0.090915630199579975,
+    0.090730581770616048, -0.20351233394457419, -0.012132389448966645, 0.042403954089887647,
+    0.12626606388880987, 0.089728508170253157, 0.16135273490351221, 0.11928197067838398,
+    0.055502874011714554, 0.0012421218593702771, 0.0520462701907091, -0.097310681953845096,
+    -0.10263239911978342, -0.10984651884743309, -0.051507706677547518, 0.062843526393153229,
+    0.050521642606176809, 0.02471215880608716, 0.056432806252678241, 0.025954004937017605,
+    0.21775580783839035, -0.021196166842289602, -0.0094497622008152451, 0.07857874153412342,
+    0.1099544101580142, 0.11007735588411241, 0.1005466753664124, 0.057572691375705816,
+    -0.071917576290558588, 0.13324072760339833, -0.1590445658803441, -0.11331822187446236,
+    0.086312541198664383, -0.071390371138998432, 0.026983802529389811, 0.088018674029000349,
+    -0.1002332364238072, -0.14773848962292835, -0.015373388919428846, 0.065086442347112847,
+    -0.018451748387740875, -0.2098393957886055, 0.21102811621865916, -0.047699967229825037,
+    -0.10046354099846221, 0.021287674859718515, -0.037879055329035315, -0.04946589289593277,
+    0.013361514833305112, -0.016663179121761712, 0.075300404128941192, -0.10636326454948723,
+    -0.066348885893780046, -0.10699192497085507, -0.084129022707028364, -0.067868291777828299,
+    0.02086509126318847, -0.028050283480356354, 0.0096347130651753318, -0.14128354602010576,
+    0.034992068124936333, 0.10428483354577986, 0.048246507264719476, -0.012489772847867292,
+    0.037482598736846402, 0.18026347482550351, -0.011779403504066735, -0.079800193439381911,
+    -0.059167750535437436, -0.0025978587246634805, -0.11908295649217815, 0.17345357329286751,
+    0.090185254897416314, -0.0036070581868678344, -0.054607245085558268, 0.18669736336003637,
+    0.12913007184955289, 0.089974912332909926, -0.022981210211247893, 0.032634180030302745,
+    0.0088491601219617706, 0.13681910299920061, 0.0027615731632027588, -0.067926065508159023,
+    -0.13952579782782379, -0.0044796868586397436, -0.060964168254282941, 0.25035838855359449,
+    0.13687165683163965, 0.038245656977683389, 0.0065800581836223974, -0.057424864480395854,
+    0.19868205476432815, 0.10764895531006657, 0.12438922997187499, 0.2170523014570532,
+    0.20096369315175203, -0.0764567524502935, -0.0028656851215427947, -0.035537191229190641,
+    -0.070366293237057884, 0.062939462393667558, 0.18612676214589943, 0.047745818449717758,
+    -0.0064364016843268691, -0.17448491533712882, -0.013639291179281027, -0.11494836061652702,
+    -0.093953540349092493, -0.11768673954354139, 0.041081030885092566, 0.14706773877683668,
+    -0.10189996920586086, 0.087763324795152392, 0.015995555241625988, -0.16526974888121745,
+    0.10873095184974901, -0.15995231877038402, 0.044785173283493143, 0.035524662116296971,
+    0.06712356291299397, -0.10872126749907983, -0.16373709475424778, -0.021851270987246707,
+    -0.052093656500035813, 0.002867199051407707, 0.074975461410668756, 0.19131775682481139,
+    0.015561417325562415, -0.0014385024698071206, 0.043359532927950792, -0.067211445955813895,
+    0.0006804388219023486, -0.069872340913169059, 0.14955908029936543, 0.015321091736306941,
+    -0.11910457127982024, -0.019152492894262851, 0.16174383363460104, 0.064670033200885157,
+    -0.10831691485714591, 0.027375384657345674, 0.068861107687890416, -0.12953293430177817,
+    0.018659526471103159, -0.047372038976257885, -0.047499303054881752, -0.03697556463142309,
+    -0.029796757081022588, -0.16253093427701437, 0.0016649831197730254, -0.029091543208836498,
+    0.065296964501900312, -0.023300412897394832, 0.14588664936152604, -0.14529315494174794,
+    0.0011868994169222536, 0.096062913620000245, 0.040942905706085699, 0.17281404134645528,
+    -0.059705748062164679, -0.1167286632704119, 0.074419029671001974, 0.099908208629759146,
+    -0.068192937815173535, -0.024983537924935822, -0.021759964560887381, -0.038726232281405711,
+    -0.043510385814922919, -0.085602229126761326, -0.1013311166954397, 0.038149231397629359,
+    -0.19686017732271544, -0.011060626024263573, 0.091029761604272161, 0.1473945768140465,
+    0.13525423547310186, -0.18584400428756784, -0.085127329801466672, -0.018194941495820797,
+    -0.013894344121850283, -0.044716310316091558, -0.031694639984802736, 0.16463172268061488,
+    0.095215520179525198, 0.17439410887482226, 0.019206958889265456, 0.20459715916854682,
+    -0.10707059924885726, -0.054076619974176655, -0.0010063733702592246, -0.087051752899476573,
+    0.0088249570268496176, 0.09462281741388745, 0.18009295778836079, 0.070130027746731396,
+    -0.044396303253552476, -0.036354072369104186, -0.1389747336624661, -0.094510106614334566,
+    -0.13130866023836135, -0.010151781321526835, -0.019311238935779969, 0.01170339607678534,
+    -0.041418031839288792, -0.11210020124113745, 0.067374119059382259, -0.085649976525591129,
+    0.072501605149782475, 0.11576572205856457, -0.1086287993172622, 0.065652417215819436,
+    0.14157054431242422, 0.0092741511361533416, 0.18499251417238771, -0.073092796895744577,
+    -0.034217145540360143, -0.02984830080184871, -0.049521161965419752, -0.011996128077925782,
+    0.12997409949224914, 0.0018342774485563926, 0.069193228740661195, 0.037656188563890011,
+    0.036465527800982438, -0.18206346291478551, -0.074133505658623255, 0.0048662598473086481,
+    0.19987912518777975, 0.12820219302687219, -0.16770320546305559, -0.034909984177881041,
+    -0.10619472396824055, -0.044933812904883318, 0.13967117416271171, 0.19505391994009413,
+    0.044518496622313858, -0.120673379828862, -0.083416522016133574, -0.12972097152666423,
+    0.13001230562235147, -0.019180988854079276, -0.014543084114324385, -0.26683916860087076,
+    0.020508439425384474, -0.065081146348969596, -0.028000753223291104, -0.060630681250949739,
+    -0.12408081629356754, -0.031149774584865911, 0.19192499774962724, -0.022728888276327297,
+    -0.062437389749604048, -0.055477002727414418, -0.071618239773394141, 0.092689443055626111,
+    -0.097018345402732589, -0.12250977935375146, -0.23449326022887501, -0.11312866333401117,
+    0.089822217002148166, -0.12711216537271575, 0.0079546491802275805, -0.084632540288171174,
+    0.058307636821081255, 0.12200310291266846, -0.026115908364964968, -0.041602475888434291,
+    -0.030673464379465457, -0.17991156064977676, -0.059840059221968368, 0.14641608329191227,
+    -0.0018969672652842376, -0.014231470765207671, 0.070340437900635239, -0.18489251340656815,
+    -0.1511261509309472, -0.18242363131312256, 0.041765223444956701, -0.0052237284840607624,
+    0.015759868858543025, 0.1263393566940392, -0.11887661610724119, -0.071874846529950007,
+    -0.11299293421409323, -0.014497940958189055, -0.023064930297666889, 0.033779993968428366,
+    -0.028024063180093012, 0.042119842574593266, -0.037225430566334421, 0.033089874181854072,
+    0.065042355070104321, 0.082725911730729088, -0.010267970185790067, 0.063714454470706131,
+    -0.016472867262425989, -0.047471316102723836, 0.090841534735111029, 0.15304291464603229,
+    -0.1242486122402984, 0.020534363930577573, 0.13229930313969904, 0.070956807335954122,
+    0.16879834632327956, -0.086816402818502322, -0.05879950996612298, 0.1245907366699327,
+    -0.15555692871698579, -0.12058759393090979, -0.062175942216365881, 0.013387334092094479,
+    -0.014256867325792351, 0.0053737410070011172, -0.035141456198697289, 0.21533207148372102,
+    0.11026302782341652, -0.019718949995577485, -0.061624547701592591, -0.17442504642546941,
+    0.040882967738887312, -0.012072790158088716, 0.013655886994406031, -0.069667867846009479,
+    0.050007071644504457, 0.064585724303538913, 0.078979668856573787, 0.053120858879593127,
+    -0.062881345714860981, 0.12536891042035334, 0.10279045670448723, -0.09896490377923442,
+    0.049364641375797838, -0.11093690366464555, 0.16314360769414404, 0.044785622800352524,
+    0.11149402374882052, -0.046688340232672675, 0.010001265119768704, 0.086466916716685827,
+    -0.062272162244485743, -0.061273192515266618, -0.10847492982354866, 0.097695503142733883,
+    -0.10342241462612252, -0.066773747857945223, 0.057052700666059053, 0.059716853942607409,
+    0.04793859698128404, 0.19835475162757507, 0.15815215589650294, -0.067821863399901386,
+    0.12863422889198631, 0.10881841227173004, -0.10978903778792259, -0.055861064117954974,
+    -0.034746584151811616, -0.1237481515128605, 0.18968043713623883, 0.12374817559896345,
+    0.069341286944418393, 0.0086456442156543981, 0.15855892870245208, -0.037674450006138567,
+    -0.13977400840976437, -0.12316070764390896, -0.029359760473048283, -0.0041961853042895908,
+    0.041328144458721981, 0.001759361259771266, 0.080628392986590761, -0.087871416976630118,
+    0.29741502057147667, 0.020717593550985604, 0.0047466329042910186, -0.048396577441670328,
+    -0.068839245839772287, 0.095763715238319669, -0.02539687471193874, -0.058096108149122708,
+    -0.23828952809310339, -0.017433351770832151, 0.046519100580173403, 0.077801017244874815,
+    -0.044715003630014342, -0.08296799325934931, -0.045085413614400341, 0.022023972013851971,
+    0.17416267637578658, 0.028439904719605051, -0.052040519530878231, -0.048221451171033609,
+    -0.0087469434000538564, 0.096269983844432735, -0.0015300436313845959, -0.050222201826720957,
+    -0.070749468586410652, -0.1798384800160876, -0.14359129487023925, -0.22695874220234807,
+    0.1041970811950394, 0.15159665350714635, 0.047819094787134815, -0.18176739268780884,
+    -0.10228066170549122, -0.036100658766396634, -0.025387631889424507, -0.065587626177564737,
+    -0.027943020691899936, 0.09563787282582692, -0.088976826470713255, 0.043859742643135163,
+    0.020428613140832969, -0.088922095901905807, -0.15717845651063203, 0.006188348151188492,
+    -0.076209803183399052, -0.045711044871489068, -0.11272423752528449, -0.1070013535259005,
+    -0.034723705684132571, -0.022833721998388248, 0.14219847200705102, -0.0020420655716504202,
+    0.15763305395793734, -0.067501902829696994, 0.058904728682476308, -0.21303582684310532,
+    -0.064285274688608604, -0.023588580275867035, 0.11718336993216416, 0.066132261057677458,
+    -0.040158809927889359, 0.010953055944171491, 0.050205274782294029, -0.016539132816765834,
+    0.15767710662047874, -0.011391653346490012, 0.011950759791609745, 0.050188408143379284,
+    0.065516796664171539, 0.0041535680029773109, -0.15651097750535448, 0.14368810649261174,
+    -0.0042993498931262206, -0.071471504579083536, -0.092468239491310014, 0.13602025116142838,
+    0.097138257921979637, 0.056179515806215004, 0.13729167953750601, 0.11416267267969873,
+    -0.11776782655955567, -0.014621541627530885, 0.059240349936127111, -0.2850123863051417,
+    -0.02380442049492474, 0.026015715506826048, -0.11670963568829547, -0.27436493263111855,
+    -0.12313678083530023, -0.071343604940217228, 0.033741343228469986, -0.10415014057099224,
+    0.21582221437984475, 0.056723004009881318, 0.07646848426006253, 0.11757222132005002,
+    -0.0020261633534708326, -0.028414580909652959, 0.023457932980425145, -0.00028769627015600064,
+    0.12287362786561222, -0.0026574121044480974, 0.11149712161749714, -0.070097418768611794,
+    -0.072777004609574827, 0.050149371550300546, -0.07643144835333443, -0.10131025370392124,
+    -0.065768942363282235, -0.083134363649428555, -0.25959773929275182, -0.033431509804052628,
+    0.1650198975889938, 0.03560469281279241, 0.00076784821524804433, -0.017761720872955116,
+    0.068921128127760384, -0.053628638088412499, 0.0045925350565366885, 0.068867833856697189,
+    -0.019037080783682804, 0.10595390308930693, -0.0017927506137481492, 0.1027814001702872,
+    0.064929395225931524, 0.15416226844636757, -0.12632886551809697, -0.10389931040046196,
+    -0.11245939345306899, 0.08107562586633113, -0.12385865286246084, 0.0010582495363775641,
+    0.14789216125313526, 0.054215688776497337, -0.066172186311041242, 0.079485416682713264,
+    -0.16739139954927693, -0.13402247386359858, 0.016523182913975022, -0.042306863988109261,
+    -0.049341900124048065, 0.20214649709656599, 0.088164162009355312, -0.078242254431776126,
+    0.074431023119652717, 0.096290938621796121, -0.036182109568037801, -0.032069866183900425,
+    -0.100523148940314, 0.15840099207364147, -0.063857519392991419, -0.13951614779950641,
+    -0.12690276211981691, 0.12618383979684805, -0.036146867807017924, -0.27427023598901962,
+    -0.079216919424652227, -0.13958189148665953, -0.14711192352304731, -0.0062025598130489891,
+    -0.048983472613256515, 0.020397509654731111, -0.023805508172382129, -0.12041156229722444,
+    -0.056028323333661915, 0.017207676105589261, -0.087616075383437922, 0.13318088352611798,
+    -0.087569288773522505, -0.072218204764633379, 0.11780524561486649, -0.052175622109680443,
+    0.015507524740097792, 0.16373081253689331, 0.062506061159693857, -0.061124691469743697,
+    0.18401254596506617, -0.1842742700787792, 0.022867857409239512, -0.14994867966013198,
+    -0.077297356346745769, 0.0079089175802610056, 0.12193402472920709, 0.048577191123193454,
+    -0.041219191733504947, -0.056363938923757399, -0.02971938644502492, -0.10595023058402286,
+    0.022909982076275905, 0.024563487847552409, 0.015775774954384536, -0.18666893072352589,
+    -0.20029255362654672, -0.18720604244277081, -0.21790597835288111, 0.097130119077998303,
+    -0.040070466900324647, -0.062743464264441925, 0.03691427485642184, 0.050902678472698581,
+    0.0083035371799121682, 0.083148177725508005, 0.057902878002950776, -0.21050235644135579,
+    0.075922906863804832, -0.059763660524722789, 0.20088410084834649, -0.14442549918249389,
+    0.10265126667374984, -0.16257904819945546, 0.079690433364084295, -0.00098765179900308633,
+    -0.048885657550879688, 0.097726780984475653, 0.06251424488013653, 0.071226180872802747,
+    -0.088907437786693508, -0.11081641667186511, -0.16044571130742383, -0.079817545932947834,
+    0.076389266803294539, -0.029528583012424808, 0.10676347327702145, 0.08965038006980576,
+    0.15007911003525845, 0.15571303012336665, 0.058470193259049064, -0.1138704780045933,
+    0.016843733880208139, -0.049232641103146714, -0.053888342013906562, -0.086567642737408135,
+    0.2245768203626613, 0.21892520097011975, -0.009027820909371178, 0.07187622643957968,
+    0.041813441370538378, -0.15489622394030067, -0.028863600960363167, 0.049759421325472605,
+    -0.15512175615402168, -0.13622718331809969, 0.084053150934893406, -0.034386953220622733,
+    -0.039552849158943394, 0.051452692752151245, 0.16580756010187142, 0.071974237956092674,
+    0.0099536154500218903, 0.10516192695327978, 0.025324922335101273, 0.011927399364245543,
+    0.052284784533512166, -0.18793774490004125, -0.035354669150126292, 0.055194936402896501,
+    0.14242665666065329, 0.10541984094254117, -0.069006157337994534, -0.13205653143315269,
+    0.10013918973915066, 0.073329270688933176, -0.066350039590597557, 0.2222651526218892,
+    0.057816352074636576, 0.081405886083009429, 0.10053975844806917, 0.04426683885817153,
+    0.071532530026880883, 0.016104434560633242, -0.042941090845600757, 0.098451321323148044,
+    -0.049269571803703609, -0.018959762163937612, 0.0048843819430833763, -0.073537230466209053,
+    0.07224665467322515, 0.12093777866278131, -0.02364997039313281, -0.085461337036179225,
+    -0.013913316418940887, -0.013327840515861365, -0.20282313891944725, 0.082867011114184652,
+    -0.14419148581011024, -0.17843818021213667, -0.13988450430870375, 0.024150911475273817,
+    -0.064642297135124857, -0.11947245453352739, 0.14088915610138425, -0.039913981772818914,
+    0.099480187798836078, 0.087068901167511967, -0.0091314165874310012, -0.081918879268521788,
+    -0.010561326030063991, -0.085971256818954109, -0.076810208240268102, 0.19046048653341158,
+    0.079819984640120398, -0.072826817579278891, 0.0037460943962180403, -0.041052621029912847,
+    0.26216018793405982, -0.076113907228521405, 0.075925192459756416, -0.025291807197077673,
+    0.0083405909792383087, 0.10436603861170929, -0.088157120365795122, -0.16131128643916823,
+    -0.073549763183014732, 0.20508079219321251, 0.15709500210535837, 0.022819424369256745,
+    -0.17937647510376062, 0.1627494056694854, 0.12355748271110423, -0.013844541571726002,
+    0.12306363401435534, 0.16102300749287607, 0.018679019032224145, 0.024901939670706589,
+    -0.059905323473930697, 0.073412743839624914, 0.11414796536451052, 0.27157018031836466,
+    0.13061780340962942, 0.22192783234447189, -0.12567914920143489, 0.012326817801048768,
+    0.22775716660347262, -0.076859254117906936, -0.046669268399575956, -0.12201507455876269,
+    0.047006627392109965, 0.091820591938117646, -0.0007726216230732844, 0.13842816450368048,
+    -0.075101097508121342, 0.11210872261370304, -0.014432472359722006, 0.15203039895729625,
+    -0.044652258780768617, -0.031662156507562295, -0.31983587665711871, 0.02032553775120706,
+    -0.050326962059946835, -0.040011124780068567, -0.0051969136374929396, 0.10379376020106237,
+    0.13644403526934562, 0.0954654842457692, -0.14738611177870337, -0.14726381591043239,
+    -0.14393574522656802, -0.13214368874808358, -0.079164678629687082, 0.034699617152530809,
+    -0.074747359760468687, 0.00087411150022570266, -0.0268253205833478, 0.055211587982078689,
+    0.11733757933815336, 0.007066016132307164, -0.12336462806467818, -0.20009123561371422,
+    0.03682298619947965, -0.17025291939709727, -0.055517323442057676, 0.041745328740821458,
+    0.16239521409717422, -0.0065302335228420083, 0.10774191826379756, -0.11360347908897128,
+    -0.053268751027094711, -0.13916000071706222, -0.15824161805762094, 0.10124625451478904,
+    0.038664167134396431, -0.14060275938278596, -0.079067108362005034, -0.15656542003652008,
+    0.062885874284528145, 0.033123042187703698, 0.12968320133341232, -0.22133758637805256,
+    -0.13594210412005822, 0.00035007095387513802, -0.012008370650740223, 0.1344621491910333,
+    0.0067150218475499311, -0.12850589081407365, -0.0070141493642730673, -0.13327172703568213,
+    0.04559639968991356, -0.066533535870438171, -0.015844804611426032, 0.08993101461593965,
+    -0.059874317821688318, -0.21296019775042879, -0.26588796994191943, 0.27929627965680481,
+    0.064404765335804318, -0.19485433414495495, -0.011729819883489376, 0.072337527925935161,
+    -0.088123073505199823, 0.11929152709738029, 0.022345479330353777, -0.021950449833466536,
+    -0.10540165824401411, 0.026614962386541086, 0.088036191866363522, 0.083559039607128918,
+    -0.04395402747566049, -0.025391922070853164, -0.0877623897870769, -0.13029475375937227,
+    0.012062145175335562, -0.017381690111537531, -0.10418077538924944, 0.016315126780193586,
+    0.066323068636323909, 0.14050770682595795, 0.0064598117225538043, 0.052404792438922813,
+    -0.046478302006302513, 0.012153325024069328, -0.12647499131789652, 0.10135472152724459,
+    -0.025398444436504575, 0.14881572633634613, 0.0035491125564907858, 0.0061182883713412394,
+    0.035041579637505781, -0.059718292647176818, -0.034335902118080651, 0.069518065218864555,
+    -0.12895636663547394, -0.017002740551071493, -0.02531456624146132, -0.099657751055578489,
+    -0.016277985338659328, 0.16839878305157474, -0.10317604600422121, 0.013457009727399849,
+    0.0043003957613349303, -0.23362598781383015, 0.12669863770292206, -0.080136043849595981,
+    0.31080330121127836, -0.16517177238204234, 0.009195096421418145, 0.0049797434981248626,
+    -0.078176113993588967, -0.079267764915744221, 0.15611991109155554, -0.13143625637929346,
+    0.077480398890780011, -0.041666774149446001, -0.048970044652924871, 0.11275465780088552,
+    -0.076951425678139923, 0.06128326431061544, -0.079057156997277653, 0.072633270485047169,
+    0.10539324195272692, 0.10046985925047738, -0.042750747203720768, 0.0310422911755103,
+    0.014542910447905769, 0.070774987363692768, -0.14349196179458232, -0.12403696276969067,
+    0.012113966771193224, -0.01514433404181165, -0.088157563822902907, 0.002032335552549044,
+    -0.012011782514283378, 0.052673307021602805, -0.069608364802354342, 0.023548648889583516,
+    -0.034692814557307626, -0.0061412820159753344, -0.35989338278466709, -0.0068458434815682583,
+    -0.027496508226014349, 0.18051690752820104, 0.056382724015931224, 0.017638021476569996,
+    0.06404011615825432, -0.062520883192378501, -0.10890637287428306, 0.23370046261053268,
+    -0.042533617279453637, -0.042705062383367506, -0.0031688246255898696, 0.025183368294706091,
+    0.069166450948667385, -0.031949839294258466, 0.057340140310975354, -0.19124318584271527,
+    -0.068143736135741179, 0.17376305979151779, 0.067250502270198839, 0.087207883068373168,
+    -0.097724691381904816, 0.036537272143077996, -0.14903939450440909, 0.011152368512667876,
+    -0.21432214967205054, 0.10207990764022766, -0.076856631240534296, 0.023572327632160002,
+    -0.18772519365149418, 0.018105739121436395, 0.0010080325264422004, -0.03251625368132053,
+    -0.010172344713615432, -0.16212266048928814, 0.0098122967326962317, 0.070230607081879767,
+    0.10840598835825691, 0.11487291296813754, 0.011355381046851959, 0.017461738211752714,
+    -0.095066630094887847, -0.010979666338804504, -0.059823326529212351, 0.01500535420436405,
+    0.051357865369333379, -0.056754167836835734, 0.019007143207662759, 0.097528909675565836,
+    -0.1277089840920653, 0.10914783083201229, -0.042627461997754273, -0.025228685141073917,
+    -0.0064156312990897597, -0.061336928341874292, 0.10143623390682657, 0.0642872617140368,
+    -0.30907319190899174, -0.030919977123395465, -0.3963095750033096, 0.24007816737856938,
+    -0.043141352775186249, -0.12133825648222595, 0.038239289192554496, 0.08255341845734844,
+    -0.041968091713966711, -0.060264241834958682, 0.14468214186573544, 0.040572640448819558,
+    0.15354146237337121, -0.097519013722463757, -0.049088232595834405, -0.018668494381750007,
+    0.041965722463390545, -0.11892627640089021, -0.024006680439252265, 0.21894206433321323,
+    0.074231370800286453, -0.0090973779509969203, 0.034181833649259183, 0.14441726205439462,
+    0.037364619559829976, 0.011674806939314841, -0.017198160466753938, 0.003651427145382892,
+    -0.050151878393864424, -0.029746489553592489, -0.018188055894861093, 0.030084178405322466,
+    0.10752673545224574, -0.22776400911211991, 0.026146470814016377, -0.11836655648157779,
+    0.18942109698215093, -0.10143764554121303, -0.015751280732686983, -0.0031652819620493948,
+    -0.0074753079728493311, 0.087087511738174472, -0.049395587373658824, 0.020934130392189759,
+    0.051406046048157135, 0.082541150165985372, 0.034985168168289178, -0.026701174895963922,
+    -0.015848712615949254, 0.077279261641858291, 0.023928887511142121, -0.033238252593251354,
+    -0.14851609296434745, -0.036139186655464263, -0.075959046415165654, 0.011006314402129918,
+    -0.034042004963519459, 0.0081265242347457484, 0.12676241577522451, 0.1471477994390672,
+    -0.017456898993156413, 0.14265890124378186, 0.079465809486230984, 0.0082256647113409485,
+    -0.11688367587733033, 0.097976901138076611, -0.041492266986597512, 0.083277682464345595,
+    0.21251601446520008, -0.1494620497384995, -0.024972321928161071, -0.16353549159068342,
+    -0.13051309982300388, -0.07404023784488574, 0.19257636813065657, -0.069594493123034867,
+    0.048246147923212059, -0.1959410549049293, 0.028925602156264114, -0.035713452728877659,
+    -0.081015572167666514, 0.050944322207633626, 0.0016313598121896168, 0.068380233255888045,
+    -0.088643784189177691, 0.14049088271941357, -0.10866863119263842, 0.025801158737897335,
+    -0.14863807117680694, 0.0736196007594727, -0.0040882819822363227, -0.10275427424824023,
+    0.14580756323658739, 0.096796550859386946, 0.080582031357437175, -0.054787647828239756,
+    -0.0029381532467101048, -0.03102050583523415, -0.10448345138011143, 0.083712295869288342,
+    -0.12444989749835408, 0.054785847339773319, 0.080160811480273819, -0.012158787359456295,
+    0.0013608121074153777, -0.031264470530108536, 0.1039375550215851, -0.14537898038952912,
+    -0.038774024121267806, -0.07541024416534664, -0.036599550884102272, -0.16087874311546321,
+    -0.11071894309243709, 0.0043776605426425804, 0.11804630315154721, 0.0081211860445748515,
+    0.10312141778834015, -0.20526044947642325, -0.13797026523332165, 0.15797609900317858,
+    0.12320007694911127, -0.042053446677852935, -0.11966372352019777, -0.080179354305039752,
+    0.078314376809839908, 0.10651632652727927, 0.20769409876672937, -0.036888371845724452,
+    0.07595459373104145, 0.042584627365516992, -0.049073232754350847, -0.009329108532228618,
+    0.12828004713380325, 0.024616286159421408, -0.036161779704982584, 0.18658503048821837,
+    -0.048653484941313073, 0.038638747684839866, 0.055669471976571051, -0.018744278842084565,
+    -0.13630894804907603, 0.020451398012163474, 0.10688313218418082, -0.018221395866230748,
+    -0.03199815153737829, -0.057704543682926358, -0.15988652029765343, -0.022629900013751463,
+    0.048374858773142432, -0.012796464298498286, 0.069735504138137394, -0.030197149307848555,
+    0.08930274717452899, -0.011549029975549433, -0.045470455642293836, 0.043771444892546307,
+    0.16946009752570251, 0.15200488457965503, -0.0078887470832348927, 0.0123144741762077,
+    -0.0011654585485818846, 0.0056028138453818807, 0.11390482726738782, 0.063861585280682628,
+    -0.062730878451688774, 0.13958100170172047, 0.029991330220440992, 0.17597362515782128,
+    -0.019071977630454717, 0.0021711576391167655, -0.041305622076838723, -0.10480557741592808,
+    0.0076129957626183548, 0.1888357687449633, 0.087525620475453716, -0.19253243076005347,
+    -0.059249493814751371, 0.17235682838640609, 0.083174273325096165, -0.12324574281178539,
+    -0.11464828953334663, 0.022777225041017521, -0.08980596017229317, -0.11978658201787937,
+    0.024294731060604358, -0.082923811165267064, -0.098576157504133566, 0.13770467768884112,
+    0.080912612726174185, 0.010593921325561804, -2.9258270173722265e-05, 0.023284659996567859,
+    0.085790541055834835, -0.017803589072020013, -0.040266881245264639, -0.12456948448064853,
+    0.095224068187597488, -0.021865306671719268, 0.039304913537523689, -0.042612549780978663,
+    0.13522816103990445, 0.021645355734832235, 0.04315339939814454, -0.018013078221921996,
+    0.15937747910901823, -0.019717750766291436, 0.069696750696691429, 0.078044761018182043,
+    -0.030364745842757314, -0.21434496100769898, 0.15340455168843278, 0.063334047723985584,
+    0.060228947675644871, -0.027573962781620696, -0.094334237665219603, -0.076469214105921335,
+    0.045085069705356404, 0.017908951655894591, -0.078585004035820985, -0.067842950790687806,
+    0.18769867574646865, 0.14825533763665166, 0.19859584211259512, -0.17648526317547245,
+    0.01077094533521228, -0.040005596910601578, 0.0022586186348555596, 0.083470886126917013,
+    0.13051854331247614, -0.17618902701107153, 0.048628314194481076, -0.043739902792418905,
+    -0.032930464338921779, 0.11922941651259376, 0.22268932833658761, -0.084017517322628771,
+    -0.11660685970767702, -0.20669095922264358, 0.086930825135551018, -0.029140172402740302,
+    -0.051289592743474409, 0.031130079850408186, -0.10199481261363476, -0.067245125739237507,
+    0.018995122028093774, -0.061715416920491324, 0.12643979898147162, 0.011510946137704644,
+    -0.073385452890898373, 0.11221023821405127, -0.10867435289286084, 0.05303864394703757,
+    -0.031937711172976439, -0.035097098987102823, 0.16460279036378755, 0.026106097618537258,
+    -0.17665122129287486, -0.11057513351433645, -0.0021416075597102966, -0.046309444260910326,
+    0.046354381824155612, 0.037864784869243134, -0.039272676098914674, 0.010148965294924903,
+    -0.0034606779343660087, 0.056721177193119851, 0.043127485566219904, 0.047620430522971074,
+    -0.079596190284484933, 0.01268319941465065, 0.14494256823069165, -0.06167178501820552,
+    0.033563953099755552, -0.088536907327618999, 0.052451095290374707, 0.10058437745362259,
+    -0.079067798147238869, 0.03687204724014604, -0.01852469128025332, 0.16514312033449113,
+    0.13567873386065088, -0.018552249350304622, 0.0019514358371387098, 0.086326853750834751,
+    0.050316106581170889, 0.20699679931496226, 0.04424235570841973, -0.046698683563690335,
+    -0.041455711911955233, -0.011835098966404433, 0.017292445160115976, 0.19567309654918155,
+    0.047397915023496072, -0.0076679774905608969, 0.063144572445760258, 0.092958416678620634,
+    0.034199392301626663, -0.026378580718069866, -0.011557923284010346, 0.026790407241830218,
+    0.0010357140509851027, -0.13081797759583103, -0.10134049823627819, -0.038122071661883944,
+    -0.11490979498503349, 0.029419173460645476, -0.066651478171433007, -0.038342162185470728,
+    0.10448661078706466, 0.070568656465415242, -0.05042099443531918, 0.059482175195091587,
+    0.061245825880189043, -0.11297641561760413, -0.11434333135998938, -0.01007883109209921,
+    -0.085481360416517785, -0.113090427223926, 0.008548742521488132, 0.19642391201272888,
+    -0.0052263182342199488, -0.026813774507214939, 0.15530622190867693, 0.090193624860946203,
+    0.15487790782923391, 0.008110201642663583, -0.040692332432345595, -0.064286446068612182,
+    -0.0015129963892741979, 0.20274981811611326, -0.082222772583600626, 0.036271717604868269,
+    0.14629592077131509, -0.01164563967744758, -0.24679224694039634, 0.10360503530887474,
+    0.029123097683945425, -0.10969234971881592, -0.034480087130802806, -0.16576584322951135,
+    -0.092812341830722608, 0.053944264263575729, -0.10314578420531609, -0.062479817010438338,
+    -0.028206060118684029, 0.050948110980142666, -0.022160763838794631, -0.0083961426032932978,
+    0.052695895390500125, 0.053499970260354232, -0.029979814831469487, 0.095173771820632858,
+    -0.051148576492917097, 0.049898332451284041, 0.016246136514293259, -0.037323710683904367,
+    0.028919823272740047, 0.13161370011339857, -0.048583418556677804, 0.10294116087045982,
+    0.071223473553510608, -0.15284043556184768, 0.050475369347453412, 0.096675548809757858,
+    0.075635027471217808, 0.064342343352448844, -0.16925370551280849, -0.018216387515955394,
+    -0.17761438888153497, 0.051318494057298852, 0.12038231044475632, -0.16986898892617738,
+    -0.076183462544221689, -0.045245878935752673, -0.0061234728409108128, 0.032114292795999429,
+    0.013256340231728943, 0.045785209577595506, -0.024408222372732689, -0.098836182215211413,
+    0.18641415618537177, -0.00024115521015231838, 0.026018452291726155, 0.046228743144103517,
+    -0.10205783875551507, -0.018708700248170569, 0.064026797667391333, -0.1058313974493925,
+    -0.10585464050758786, 0.12808948407645354, -0.011701849095236775, -0.045162293941989104,
+    0.083284195784618584, -0.095598128083441855, -0.031229627632456288, 0.10720503592650818,
+    -0.063887938267350619, -0.0070558997749898865, 0.032320101409246925, 0.11560074397004032,
+    0.055725914563939521, -0.02522912680539879, -0.043177315097904262, -0.10144423313672826,
+    -0.016913598134050589, -0.027425231240488183, 0.2641800211995155, 0.030597654666338767,
+    0.024181845635562898, 0.015471280164497165, -0.11826138844525504, 0.023684115925294898,
+    -0.080674426564247628, 0.12881352425133663, 0.10004623124601189, -0.15139234702828364,
+    0.081262774502538285, 0.0823781650587668, 0.072600198059862259, 0.051874710430755575,
+    -0.008262968946574082, -0.088395720828448182, 0.095567834493808762, -0.037693232612496332,
+    -0.14123352635513381, 0.10306495264001643, 0.015539054553666651, -0.1274044109892597,
+    0.15876741455098681, 0.076521604853888939, -0.084140545912699566, 0.040019999143441988,
+    0.12989918757630325, -0.08146351726444491, 0.083471531716499542, -0.047522814623889575,
+    -0.004212203765225065, 0.02321191634727135, 0.20280430924379467, -0.14263976765303646,
+    0.047036242465105342, -0.076960828319906624, 0.04148720889950696, -0.14432331729292838,
+    -0.11017326243416899, -0.033282128693183435, 0.1388527758317136, -0.047089915168856862,
+    0.10438994274129548, 0.012491017296788261, 0.17413226046332747, -0.032774821809956771,
+    0.080740887008461368, 0.032070367132579193, 0.022859797439232336, -0.09516984978798787,
+    0.067266542036619331, -0.03949322310455225, -0.026999258300064471, -0.035489037003378514,
+    0.010646020223234418, -0.12696502941826235, 0.19039621176333754, -0.00065994558268748886,
+    -0.11039558451143275, -0.049701097072946579, -0.046865824648157403, 0.16926119885697399,
+    -0.026745636342780144, -0.096404467241884576, 0.034977120360212076, 0.075335855940520835,
+    0.11173736663560488, -0.042603588472156707, -0.025163832124816224, 0.073895036987780743,
+    0.086235487097340802, -0.10647720554177896, -0.016793247637338596, -0.023868335782238667,
+    -0.035131240007416097, -0.044552387465562754, 0.014168243621126063, 0.041910360725651949,
+    -0.12440813066256867, -0.071073978714644007, -0.0063351057093617774, 0.012180685822430702,
+    0.20001150422379166, 0.15560645883802152, -0.17118230647402702, -0.020044193109641336,
+    0.028880943185199723, 0.070898252362834119, -0.068106603461415574, 0.068204164999447578,
+    -0.052293194314587302, 0.05664275802045006, 0.048848405420131212, -0.013368335263528781,
+    0.066762884639483752, -0.035727792508413299, -0.068130812484981221, 0.0818470486872237,
+    0.042144997010415824, -0.052051914533723091, 0.06993013467428727, 0.083705051038380093,
+    0.087046775075971361, -0.17890911290837527, 0.088551254680917069, -0.15031248152585319,
+    0.066246107373703095, -0.091744067467290275, 0.02102513319524834, -0.13692381491398473,
+    -0.067399512047530516, -0.10639019567137153, -0.028140109371040351, 0.074326012046734738,
+    -0.053993846006523405, -0.029902117202919212, -0.044050079698133293, -0.14240107994242901,
+    -0.14365956892687959, 0.12765948880800557, -0.10999674922185283, -0.0039486963373186997,
+    -0.010923773096211347, 0.028551942105987122, 0.018907791715608625, 0.11415754838269132,
+    0.067308967721869714, -0.0067059215062451813, 0.008429767380266507, 0.061730058040113334,
+    0.075327633059454627, 0.071203478719983365, -0.12675995929141168, 0.035991723911966929,
+    -0.0030616745709572575, -0.0028322563826177478, -0.043314389537522376, -0.065306362204493568,
+    -0.049986682659455189, 0.019205624118802986, 0.062397249247973345, -0.031489621015066638,
+    -0.16676333955523934, -0.053482641788520816, 0.0067740887112745759, -0.083434978436696047,
+    -0.05424878463508287, 0.11775537278208868, 0.020969865856227676, 0.15091310180870174,
+    -0.050180633694664384, 0.13006917989709474, -0.034083514517333512, 0.026542505651173831,
+    0.14040461550848593, -0.006873762728925906, 0.063813266351207196, -0.093534969295528431,
+    0.024369092930653719, 0.012095170012204252, -0.004472803986045373, -0.13438138182114498,
+    -0.083050431754001758, 0.069206402874921386, 0.091234490718260661, -0.016365028476112577,
+    -0.071836758345831295, -0.05713774087974044, 0.072758963334530552, 0.1520120073451918,
+    0.1444177841610573, 0.048300426470769341, 0.24042620493226635, 0.12554009626245435,
+    0.094790738213356998, -0.10798452816163373, -0.018105315069260126, -0.26233737808522023,
+    0.0055689252796978358, 0.022677690852826875, -0.11123290830567725, 0.022793556381378255,
+    0.06463063192561723, -0.030550303257444685, 0.11327834822918925, -0.1905127369561358,
+    -0.05141398460741984, 0.015874167683888465, -0.18927733187472787, 0.11619420478173399,
+    -0.15059903676445655, -0.19256313919600285, 0.00036907416172883177, 0.069426480589414905,
+    -0.013816364130065829, -0.089965348536327303, -0.15528585736896713, 0.063940901637134243,
+    -0.025410175329015985, 0.14386994310368462, 0.10385641177739602, -0.10406454596598638,
+    -0.032146077940403438, 0.039962006809208944, -0.066938673696612758, -0.074068299270714608,
+    -0.036063780354473204, -0.18030285324019174, -0.060194474081590066, -0.045789912519950265,
+    0.012064209600161706, 0.055724553931925706, 0.051039289296577209, -0.099965553457586703,
+    -0.12331006344835943, -0.013046434509455713, 0.048869995173905167, 0.28692887829332697,
+    0.069156858577186495, -0.11782515355008, -0.0077040748422201408, -0.14378219711803306,
+    -0.03189568946816685, 0.04789297944260118, -0.091782214138727405, 0.18586366309036961,
+    0.043363699634029473, 0.10396273785498891, 0.19722623436767622, 0.093289667229786322,
+    0.03430106753110964, 0.054827130495851056, -0.2291245245735011, -0.17801925074390543,
+    0.056223220821625119, -0.072763132954513352, 0.0033023113633362982, 0.013123431105043598,
+    0.077034191983026981, 0.11510361236029386, 0.016610651408599051, 0.16506743715245947,
+    0.066940049092436935, -0.18557218741711165, -0.19423572550722684, -0.040803145817153955,
+    0.11250027018001073, 0.14938416899475981, 0.2285352717886808, 0.044763584390889982,
+    -0.051962792811889369, -0.04858837304716386, -0.095743367417780903, 0.0569715672632694,
+    0.00010522409041177301, -0.019771515806340331, -0.12176384631847706, -0.10059873266101367,
+    0.046445687229311819, 0.011350117700484328, -0.17623193166979523, 0.18395965864238342,
+    -0.14607485022645897, -0.15542925745056055, -0.21733875485060744, 0.038953917854364771,
+    0.024362632627515288, -0.16223317004663257, 0.019619984980568727, 0.26362595272875078,
+    -0.062372298411097316, 0.053796357626143237, -0.17657469316657215, -0.19496627540474606,
+    0.018247723254355995, 0.039572653117348755, -0.13483427429383105, -0.052043627751960413,
+    -0.15165580771853965, 0.063292078061214244, -0.10169255843288834, -0.060882594277888349,
+    -0.019083533297032308, 0.042627305828593809, -0.14808449837701521, 0.17095203915948515,
+    0.033033741768123508, 0.001954318119414575, -0.032563850826200003, -0.0013192774018990832,
+    -0.28538267355170033, 0.0098941176660916948, -0.054973663114158314, 0.093805497111110026,
+    -0.047186229048246202, -0.079275185524669736, 0.1253406832471349, 0.038717017692401295,
+    0.14536420952230153, -0.10481309134095998, 0.098675023149474655, -0.12058410468703425,
+    0.13232824907649945, 0.038000248477367222, 0.044447849839420767, 0.18664859008802559,
+    0.019560106078467251, -0.018198605494008566, -0.072735331562717262, -0.026899636202372641,
+    -0.017767740719351024, 0.015982861174877464, 0.042771711985663083, -0.098898682238548488,
+    0.10223653875450696, -0.015165711697399498, 0.023871527313279753, -0.12021130317078704,
+    -0.066212953919291495, 0.10012692871897853, -0.018127121228613565, -0.00097161139584673445,
+    0.076810622688361654, 0.0056197451239019683, 0.061682592416321992, -0.12306780352441896,
+    0.046080499009498267, -0.24919524743999993, -0.060535187731528488, -0.1127576953841527,
+    -0.14349551349275708, -0.088631789135022648, -0.041655781237042423, -0.06149876172040028,
+    -0.076399261065468099, -0.1871702853268338, -0.13041225224482728, -0.026211897193206449,
+    0.12319435659977843, -0.11860426655491546, -0.057431811366973208, 0.032056549343478763,
+    0.0076816094684020349, -0.013267819901742226, -0.063346668391851491, -0.022622024093949374,
+    -0.029788937391653114, 0.14413789580805955, 0.11144383415470699, -0.21329931355211681,
+    0.045715104392888173, -0.048718695988902876, 0.086131410193409363, -0.091095383269110347,
+    0.18702244995710282, -0.033632461350102595, -0.021764446155971742, -0.083644632925733861,
+    0.13172092705823718, 0.064393895108004265, 0.14375109388767371, -0.018766895828702789,
+    -0.1413636395682491, -0.065353165165653523, 0.044277905263310297, -0.15726951221754557,
+    0.047401052945491295, 0.068863635288629502, 0.051004260595453023, 0.0533153409922889,
+    0.020224429995810228, 0.10502708686987527, 0.086522619750606974, -0.048082744404530309,
+    -0.027709940252463219, -0.090929895951753881, 0.024906947017867505, 0.061053466510369303,
+    -0.024903051991015501, 0.2742509518002742, -0.034155271379505837, 0.087395588171479521,
+    0.028495558677319024, 0.095836805094433486, -0.13147294403312618, 0.18921054532153037,
+    -0.038206497597580713, 0.1165125156786927, -0.056886971208207154, -0.10594730914666176,
+    0.08642074755845916, 0.067703026998284663, -0.045602068829173087, -0.24286765201686644,
+    -0.031234107467811051, 0.032811700405891424, 0.063844476453433038, -0.019317589948641103,
+    -0.042148864661811586, -0.011251996346571834, 0.019403031453946985, 0.012133572773764791,
+    0.12340763876612384, 0.12251713480726899, -0.039635137584647331, 0.12293771970224954,
+    -0.10942329718343161, 0.0018821423115820508, -0.043946339267910445, -0.049974653600936308,
+    0.053893757800837244, -0.088935103463640169, 0.081765208928658975, 0.15704044079803944,
+    0.035239264137530223, 0.015648986229510452, -0.28133333412778289, -0.058935304302608342,
+    -0.041745064759951545, -0.036535745234193451, 0.035031522560956589, 0.082058257231521992,
+    -0.042929318924310324, 0.0083082677311166944, 0.031733263775525364, -0.075868519426793457,
+    -0.089308864323017975, -0.039149431211861443, 0.11545791575126128, 0.041526833498480603,
+    -0.027227451723380421, -0.045166218544982345, 0.10974039930460476, -0.17123548011856921,
+    0.046197303223304759, 0.011273726833726889, 0.028341417810954034, 0.063024743124114907,
+    0.053711846870497217, 0.02085540789016423, -0.051489851740242891, 0.16584062076738101,
+    0.043044203926675656, -0.011250740432114213, 0.094390000251392187, 0.054832194889767316,
+    -0.024024214832761546, -0.16651870568054272, -0.054730228580125717, -0.035300991210522638,
+    -0.068771390357027964, 0.020871227579445574, 0.083137914551632316, -0.020020955282683453,
+    0.12394351360463041, 0.14013923421583982, 0.30242352364748709, -0.0040763301205492134,
+    -0.16127375213691963, -0.0053977083821113974, 0.019084498744702586, 0.031456314639386924,
+    0.12457069810809283, -0.072476202158347477, 0.14829588156514625, 0.14370935729931605,
+    -0.0089513655632997794, 0.057406342689354739, -0.0095093908051673455, 0.12465733655427505,
+    0.094229236402324182, -0.013464424548357971, 0.083108566361475608, 0.050613314694856519,
+    -0.067141862002965055, -0.064709983390630929, 0.033672607603710485, -0.081873028389736452,
+    0.04113808131657435, 0.084397448132232225, 0.10154124462107693, -0.036422963529054282,
+    0.01513320769793608, 0.38211521938390419, 0.038424822767946676, 0.048689277762389634,
+    -0.044814490125927066, -0.08505902134775184, 0.16957094368481493, -0.040751731670744203,
+    -0.11816534364652004, 0.050758940330761719, 0.022313584051691801, 0.048869354474657477,
+    -0.034539853661634735, 0.046539233857508092, -0.09500144519573811, 0.14291597796064731,
+    0.11702225713243782, 0.15491303758846331, -0.15931590115187952, -0.028916348155462332,
+    -0.090718454087014358, -0.15603164860364027, 0.061808321962881045, -0.11391535052499083,
+    0.17523117382353109, 0.076580809208697476, -0.017639900290886051, -0.083381506265605851,
+    0.019260492339147131, 0.085248685894567258, -0.011932468694790749, -0.15313613020689609,
+    -0.0044762875950931933, 0.16398848224862994, -0.076749108093736446, 0.10430738110783058,
+    0.084265633838547335, 0.0085583628766520634, -0.10963763260643951, -0.10650424715156781,
+    -0.062968749164309598, 0.18833231988691329, -0.14864240399135922, -0.15905785535653622,
+    -0.063298521774619268, 0.22130187616166169, -0.043728172612139654, -0.085725076379690027,
+    0.11975222475559, -0.079789007867675732, -0.030304375009730433, 0.030281137783371631,
+    0.045021592603678551, -0.032060554447411349, 0.12735532643127823, -0.059984628448666658,
+    0.019806382183440913, -0.17731322037013761, -0.0018409565130881426, -0.22931409192505348,
+    0.052139367507320268, 0.016511550827204343, -0.010076778579346517, 0.065004745407659534,
+    0.094204596993859607, -0.17944186213603375, 0.011783848507276698, -0.096587285016083185,
+    -0.17355570696471095, -0.19263589289903768, -0.0468588089233795, 0.00328730668453437,
+    0.035145424034353633, -0.034858548326744031, 0.014290827591093576, -0.026643047069182902,
+    0.0095392105429894444, -0.017542105013726491, 0.090207260649050158, -0.1399869722614521,
+    -0.0052531510057074043, -0.08253885892386742, -0.024122251699079559, -0.023785791352899526,
+    0.074977303897020744, 0.056530878445608369, -0.022197339497182628, -0.10504565077359003,
+    -0.098701392685923761, 0.17219844681274843, 0.014223656505782216, 0.062387212163013066,
+    -0.030385099046204095, 0.12254113359888914, -0.04551663138092657, -0.041062843099638813,
+    0.16580928794791383, 0.12090621897439296, 0.022952227320891964, 0.040452494916935554,
+    -0.053349338462481313, -0.025485416332259099, 0.052531171936197163, 0.092375041182452239,
+    -0.11701848430376216, -0.18148073105532703, -0.16806033026589673, -0.095368091971646946,
+    -0.068774832009422665, -0.052310811816012603, 0.088291588672656685, -0.17368276411501782,
+    -0.25306029072133218, -0.019878071501607496, 0.24091176473788312, 0.013693593892426734,
+    0.1540453047014031, 0.10628536218229066, 0.14464035865213604, 0.069527805833709475,
+    0.1092655051122508, -0.062999645243836458, -0.068816843372819889, 0.00052742423618694974,
+    0.01173079964278342, 0.077714635258343129, -0.084192360541461536, -0.016074786666353584,
+    -0.029714136148542139, 0.11259077133097628, 0.062398135945644022, -0.11121692404408944,
+    -0.030480077207885422, 0.044928803570250815, 0.1011664919618399, 0.15571228474859769,
+    -0.10735046357810929, -0.14161832822702866, -0.15672331109107018, 0.14332501239418408,
+    -0.017851901469902901, -0.081090988576679901, -0.021288810945234982, 0.06612784184706974,
+    -0.14231905912189668, -0.026625210404583634, 0.071699638952453501, 0.055879669815814936,
+    -0.13784720038431686, 0.28881218369838008, 0.016410505399848726, -0.015670471499119928,
+    -0.0077422675194437022, -0.061247630703612992, 0.30066211349509819, 0.11455550241345003,
+    0.06481341502200344, -0.020495760122610372, -0.19582367492063515, 0.029769755557524941,
+    -0.11331420462786414, -0.094936796434322276, -0.05457714320761009, 0.079133830007876507,
+    0.062331441060545167, -0.043825005792255713, 0.075920622620331349, 0.12552575748167208,
+    0.10278118638112084, 0.01950123232216552, 0.070956439024259271, -0.15561818819987025,
+    -0.018960239657055667, -0.020804074135046188, -0.05644628460984711, 0.17719671919140681,
+    -0.14601866383152487, -0.1008308233819723, -0.018801017409053045, 0.068930817798617233,
+    0.0029504669927497319, -0.095175415986336651, -0.012923964321802237, 0.050774473006384116,
+    -0.12456036671107944, 0.098505708353744462, -0.11086537196037444, -0.0037390105491870809,
+    -0.053490316738307959, -0.12956474598620638, -0.033373544609628762, -0.0016845568915025504,
+    0.014884537540961388, -0.0014771773687378442, -0.15876491280326394, -0.085942766176063543,
+    -0.23947161183832338, 0.12492193817094024, 0.067675151478095691, 0.021997080712630551,
+    -0.11550357933000131, 0.0034507038676753355, 0.078761531725813072, 0.012355933487865517,
+    -0.11891844758174708, 0.10706526036664538, 0.11454105003044575, -0.14695211036900108,
+    0.0016678554063724483, -0.023761064915689554, -0.0078024704753603367, 0.020310567630541988,
+    0.0051370935271712924, -0.014570513763132783, -0.051581472065180142, 0.07119731199409858,
+    0.07856603853442061, 0.033080225787690376, -0.083405143601757797, -0.043141500286712028,
+    -0.13474508379620662, 0.073357035683673188, -0.015618539667934745, 0.025979646838944215,
+    0.033129781427472686, 0.04353276485687043, 0.086703940897462195, -0.077791913606224075,
+    -0.18456623885560389, -0.060827391177013183, -0.050240483283123243, 0.060029497206777506,
+    -0.048846128025506655, 0.10068863202506695, 0.12061613104650791, 0.084744925337772697,
+    -0.19026440811972825, -0.25391931199103079, 0.14186545488821858, -0.17522146569341446,
+    0.0087792944307307826, -0.029492235447895573, -0.068661228504924288, 0.1054951680247672,
+    0.061515101894996892, 0.12648608424504684, -0.055104323787234198, -0.07496963076556018,
+    0.23398467492455177, -0.092631490665490118, -0.061086010863838636, -0.18987009591484827,
+    -0.033480900663349501, 0.089025924592846792, 0.11889138007857154, -0.031647022598571717,
+    -0.12750471808294542, 0.062212250159581865, -0.08120491040015522, 0.014563656216919168,
+    0.035704848110194677, -0.0060856009870467083, -0.10723629500259284, -0.15353487068362628,
+    -0.13240360169103024, 0.1498469676223631, 0.096386639525543188, 0.12493349693504835,
+    -0.049992735225206184, -0.099957834171193791, -0.06406032807234234, 0.080158079850532929,
+    0.1945356016115429, 0.061886230109439049, -0.032939934120498809, -0.084629169961879955,
+    -0.16412130374070011, -0.089312536014271901, -0.096782486708652971, -0.075621135142205712,
+    0.050420352858382401, -0.05109549499463073, -0.021498446120981597, -0.081801209792444499,
+    0.034467444707940949, 0.068565638205007093, 0.01298358354556255, 0.023542475146789438,
+    0.025775436638287536, -0.012674413580109907, -0.20521301892174462, -0.038895569343232163,
+    -0.19866467861009288, -0.058539112430012592, 0.10055739403297292, 0.0088423915139718302,
+    0.013744074644346058, 0.049005798878245077, 0.31560937731507049, 0.11623762098083387,
+    -0.05466525388080469, 0.22224796259901211, 0.029860353497668218, -0.033358685252369111,
+    -0.10764980496569668, 0.1559464333795294, 0.028109826841559136, -0.051237242118064193,
+    0.01738010922979092, -0.10468794953395766, 0.014417648705802952, -0.05740599107991317,
+    0.07699497262245221, 0.1049229448185191, 0.001488417122262465, 0.0099640882035774442,
+    0.1085140302802322, -0.074626995318179956, -0.013776663676320968, 0.18672592292343757,
+    0.077771718753731942, -0.041280113197740505, 0.067344209269018296, -0.10522566110080851,
+    0.011286274726809115, 0.18102057940594296, -0.039276177079091625, 0.1250625232469858,
+    0.033182235110476695, 0.12889054712003761, 0.16631089364107751, 0.10331454507191797,
+    0.045549488620202888, 0.10825613425187296, 0.16440419807372833, 0.11285675905039506,
+    -0.054700082563706114, -0.069153409533059707, 0.12211112771548903, -0.032238837198429515,
+    -0.10243159860281595, -0.12744126174647216, 0.19921591811308947, -0.05362365528639973,
+    -0.054701904650498998, -0.084592173370215046, 0.12147031054381152, -0.017784685143064555,
+    -0.046293125756174024, -0.021269122526108915, -0.10164643004021073, -0.15900061734096352,
+    -0.017821426626891703, 0.074060717091771727, 0.011777182580527835, -0.056828326878055627,
+    -0.018519529311305155, -0.28569708149493062, -0.083656397591825873, 0.07615953984648513,
+    0.16148258750738476, -0.12774047080404449, 0.080189229387323702, 0.0038540688666272821,
+    0.027706351985580382, -0.073174558203037143, -0.042996089040166836, 0.14742927431403352,
+    -0.029936237476014951, 0.15194645414594296, 0.044578636351389186, 0.22095229328084445,
+    0.13697520420454146, 0.15904766357599243, 0.041368452039829882, -0.1480849107659887,
+    -0.060946188873946566, 0.061742135144771997, 0.14249152448868962, 0.11931970407612805,
+    -0.085144173818225269, -0.085112302760991521, 0.033278678807278937, 0.054346595183065942,
+    0.16346363902428773, 0.011960063194666089, -0.077302012815717996, -0.21041780220491285,
+    -0.10026746898704104, -0.019075993041339133, 0.12579213457535254, -0.0029310045951124603,
+    0.091329628582872274, -0.030326156018689644, -0.12803993734669816, 0.070192463127739357,
+    0.013892177340586304, 0.14526959027351899, -0.059460609329593683, -0.23081650020145991,
+    0.1442292185386502, 0.041878034076515913, 0.10454989478645385, 0.03245190380230286,
+    -0.048600281603327272, -0.0013549018424958998, 0.13976063809018799, -0.066409684365286811,
+    -0.054294715394559045, -0.10019335722254936, 0.1750141127531569, -0.094131481251696736,
+    -0.064012514216114466, -0.093623083749509506, -0.070444477357540364, -0.019743298759011086,
+    -0.0023288796435192607, 0.15668931110791884, -0.14453266209065849, 0.03570298756832626,
+    0.22655781860561547, 0.0068229183785268547, 0.017288536199327045, 0.092623100818953821,
+    0.11304590870947635, -0.014616832522419944, 0.07326102901990178, -0.085163367879974083,
+    0.16985262930592576, -0.20644117489678671, -0.073160102330420626, 0.077614640226651002,
+    0.036939844595249065, 0.059395154774051863, -0.07981987470066236, 0.045792437837728121,
+    -0.067442843870286609, 0.025500890414593108, -0.12567100483421656, -0.0070383433309593934,
+    0.033360687441144642, -0.18209929652711904, -0.033401309640133652, 0.0080739863026671691,
+    -0.050486821090942893, -0.079621587331433485, -0.038503913332979797, -0.27740858614150177,
+    0.046159660556472498, -0.092173757232622056, -0.0078413474085695361, 0.029397280360638212,
+    0.1897927937134555, 0.049288296704515427, -0.1549069117497483, 0.15964092888859013,
+    0.05350883045687066, -0.17069027339938081, 0.014717782543792472, 0.029731667059512253,
+    0.071868811381579009, -0.059075771226324063, 0.15507342262500079, 0.099950437495470834,
+    0.089301730971486998, 0.087366230600633865, 0.041288065535548604, 0.098359225084912336,
+    0.011500780725798453, 0.068470961271781525, -0.077725801331342992, 0.099533940232410897,
+    0.024323490765894469, -0.13445883911523207, 0.016488143899248114, -0.10245148696580207,
+    0.0077930437561922975, -0.048895687764674317, 0.060209063466421221, -0.12729426349458969,
+    -0.084892541365926374, 0.10368375826422374, -0.081168926615945727, 0.0052263526170825726,
+    0.0069650414564970996, -0.093203014705439527, -0.10509096025536607, 0.19991930905042588,
+    -0.12852919629110535, 0.057090174074712154, 0.031843186364512367, -0.14669655968278661,
+    0.11568524244329968, 0.12175681019136918, 0.041292125184457684, -0.18160996030048387,
+    -0.085498477312352966, -0.055299034429021503, -0.013118941630471443, 0.068493712427027731,
+    -0.1421264198196098, -0.20351520428576936, 0.0059325717066455869, 0.048270109522461552,
+    0.029296318293967085, -0.023023040727723425, 0.22869891152063301, -0.035542877238112273,
+    -0.087697313459834392, -0.094622330748850444, 0.057146229687071871, 0.095725461034525727,
+    -0.13257856875228147, -0.1082300955431062, 0.022955300495366659, -0.1096392426577711,
+    0.078181946026202875, -0.049348255977502087, 0.013466149067580408, -0.18956983519938386,
+    0.0031418413260777761, 0.031533667384233799, 0.063661914710640921, 0.034324358683994659,
+    -0.040839198714450638, -0.1145561561004538, -0.095153824832181114, -0.15168963468444888,
+    -0.10498224537308308, 0.050486603373649443, 0.2462405634592813, -0.1459830371523306,
+    -0.10179889838655341, 0.042624523389144131, -0.095845003339349089, 0.060226663783005611,
+    0.18561238153482174, -0.12081721833139486, -0.11397014378842379, -0.16834790571691541,
+    -0.010421685812531925, 0.13402317016637652, -0.080108399367731231, 0.1015232942262202,
+    -0.049520077189095991, 0.093581863747191074, -0.078353035761596204, -0.056001094239979649,
+    -0.051451698165999107, -0.097241126797084576, -0.02487748506367303, -0.028157120577666381,
+    -0.0062302032791891615, 0.0094762609965495376, 0.0051568095192405768, 0.00075207566158873643,
+    0.042049629031380271, 0.071821724457477906, -0.22650820199943408, -0.06075010879831997,
+    0.12415882520193654, -0.14248679605961412, 0.027980288965615639, -0.10495058911502815,
+    0.082416665976212014, -0.042586273880236676, 0.0055108738967420958, 0.003348857729666645,
+    -0.156682973184264, 0.066875899549473344, -0.064298214988329161, -0.022665525812008168,
+    0.028378297835016438, 0.061453979889573386, 0.052503861047151587, -0.15023823167761394,
+    -0.25177454860707821, 0.062168111006280967, -0.0099673896067499993, 0.1712662192115581,
+    -0.035145525525447724, -0.038833737269507028, -0.045045293722715964, -0.15131093196359779,
+    -0.09199777292955183, -0.040855149769356176, -0.026845503257391087, 0.30588554766327397,
+    -0.13676351946388202, 0.19348417313394375, -0.090231219997331552, 0.12309541518699495,
+    0.16626711263480526, -0.036358388873695524, -0.059906976737889341, 0.11453836196920092,
+    -0.16427376904388369, 0.11439952951775867, 0.22646939232987501, -0.051586677405190906,
+    -0.034974221412600544, -0.0023111622877122159, 0.034057474865707628, -0.069086687854042414,
+    -0.098096986763864996, -0.094564088597307569, 0.0033024395579668874, 0.011144759008407019,
+    -0.021274377008257028, -0.06164990806607451, -0.092399726431632204, -0.1306158402603908,
+    0.0069712228486407731, -0.025837328463339099, 0.018954983584216236, 0.19648764236824318,
+    -0.074812363502006471, 0.038141343795186494, 0.069798233608415319, 0.036610576642223613,
+    -0.10979634396211579, 0.030907291231182053, -0.051667607734150404, 0.088472790025255446,
+    -0.01706507608703078, 0.018601884750435966, -0.045940448552697646, 0.050067457317095491,
+    0.063361965417343957, 0.054003599776461839, -0.067316360095316344, 0.0057471940020211382,
+    -0.042668460836037092, 0.069623015707836231, -0.035796998729276372, -0.015609465159642946,
+    0.010689848089384288, -0.11038358135011218, -0.075780278771371182, -0.18578218636593069,
+    -0.061924321583907711, 0.11706621814997305, 0.07681498611993319, -0.056066757946276698,
+    0.069778103802200689, -0.10185693894508925, -0.083408268181070042, 0.053470917155583671,
+    -0.033708797045737149, -0.068812518087352045, 0.15718829173843407, 0.049390992695807989,
+    0.093772010246429907, -0.1021971062423908, -0.11985810686046171, -0.047399479075894403,
+    -0.010747996721985599, -0.11056741429366813, 0.13203518352529139, 0.13000084174988394,
+    0.18698276645562398, 0.1770273952175544, 0.041424966775192147, 0.091451254618268502,
+    0.028259365413348326, 0.051250504036594473, -0.091914208791348928, -0.085942084269064981,
+    -0.029931303288774396, 0.0020944650525230933, -0.0039444152532163166, -0.01540318105773108,
+    0.14862352340371454, -0.19674891982845988, 0.064516181618040638, 0.14206164703989849,
+    0.14201277847541438, -0.021567676447372681, 0.2012807159213145, -0.23132041414986548,
+    0.059302502888300954, -0.24467795665313705, -0.060759881019675846, 0.075310958325091257,
+    0.066665234386978814, -0.055253647579059269, 0.089963664725692782, -0.015484392210795875,
+    -0.073214266818046367, -0.024855757910085909, 0.049507587800870403, -0.049115096286105012,
+    0.026035127883480648, 0.069375762718406925, 0.2766836195791143, 0.025594167701029021,
+    0.046433970546418055, -0.10415978470667145, -0.069012853291401999, 0.085585221876699508,
+    -0.10711378550662329, 0.054331540486647428, 0.019852776152833151, -0.23734725121840308,
+    0.08053371907408545, -0.026882888498641479, -0.16175852009918917, 0.086244707211729998,
+    0.048618468803594064, -0.12429931644919701, -0.048483291635869001, 0.079985630834503149,
+    0.036441499743471488, 0.065481716486749483, 0.014450064693541322, -0.096129427534632619,
+    0.025643710105496344, 0.046322547569411149, -0.116194806198367, -0.086576297137236635,
+    0.02307663404953077, 0.08666825339642803, -0.010760089350489365, 0.11763455011440155,
+    0.017329380554823838, 0.094182483700347333, 0.089500592311661034, -0.018216303468957237,
+    -0.04283301404365053, -0.068274447601531812, -0.10758754121155223, -0.014881312230259855,
+    0.31124492664701997, 0.040302161330346295, -0.12158729639407989, -0.10737890705518029,
+    -0.082434080616540339, -0.086183835297113168, -0.027996212696318051, 0.028000444978725472,
+    -0.00087741867809495457, 0.26239445406587336, -0.061550470540805979, -0.032815398050043167,
+    0.018033965236560884, 0.082183048995800589, -0.0023568574077637507, 0.130116754428003,
+    0.043542998495040189, 0.0034151380245822276, 0.14633708047805283, 0.0044877841755825345,
+    -0.21606839672817157, -0.15011995110670814, 0.08468638117754651, -0.0022596048129682579,
+    -0.12789919251059687, 0.087929907802192453, -0.049387373663052528, -0.043475685914678409,
+    -0.35448965438217861, -0.031102700017157363, 0.011582323438247067, 0.1469252155647903,
+    -0.07403666936877551, 0.20839526602130079, 0.046731011134591306, -0.11114830947104057,
+    -0.058899245659150216, 0.015542282524186051, 0.10891983321777052, -0.068351051832087853,
+    0.1015841280155666, -0.0054255150658549965, -0.17475056354083837, -0.081782692571698373,
+    0.16057657149945218, 0.084979454499068394, 0.067571270290690627, -0.070514975324697901,
+    0.032049945790922962, -0.068166810592655599, -0.017999219069346241, 0.067677702607428489,
+    0.11147418297339058, -0.20268376580085179, -0.20426974194979985, -0.025400281898896957,
+    0.092445741887680496, -0.12957356938730502, -0.061577131981295705, 0.042154577943556773,
+    0.10280322118398338, -0.014648546090582385, 0.0092427359568800441, 0.075003145858457188,
+    0.18931650310103931, -0.070185387331403892, 0.085420806229532034, 0.017710196715657635,
+    0.087416916780914025, 0.046432520089235811, 0.027350851313379776, -0.024705617536560216,
+    -0.016775383845959092, -0.014636560650398981, -0.086010369947783522, -0.068118332707399851,
+    -0.02942332750286844, -0.18251922166583839, 0.019965076247759336, -0.10538013953908029,
+    -0.17626921102266785, 0.062581600327906814, 0.16653751476316578, 0.070944050064960185,
+    0.12193961422585814, -0.065411600523418573, 0.04469066172823976, 0.060426377411784193,
+    -0.0095430621123498479, -0.13547760486149407, -0.010707003245572361, 0.050861845793407141,
+    -0.04575957156826866, 0.10703814707697955, 0.002370362996058353, 0.16916377393401963,
+    0.082379405304111017, 0.034745297610586763, -0.09175326514083873, 0.051593167200822403,
+    -0.0089586129092677873, 0.041901791876265408, 0.057185323704916642, 0.074455888302080872,
+    0.15362250033752514, 0.011788637677966297, -0.0095648643764674971, 0.14502713456720437,
+    -0.074445691990632598, 0.053787007712598249, 0.11863894121681724, 0.035714061611303756,
+    0.1144684407664755, 0.075479049345189564, 0.13290042524314838, 0.12980059588051318,
+    -0.12902942397363318, 0.012749415850374209, 0.17354099852420246, -0.023390240346800744,
+    0.19050350797468232, -0.025232047881791609, 0.015784636234238099, -0.021676154179317082,
+    -0.065442652945265939, 0.13068449563174483, 0.034652432687383744, 0.091397412936027905,
+    -0.094986943492265954, -0.037207058373192062, 0.15867926073815347, -0.022597924120331805,
+    0.022963229455647646, 0.066129800132140468, -0.036166226774372978, 0.03094617199856774,
+    -0.012352663019330119, -0.089897152961040575, -0.02884409190240815, 0.068250406685643375,
+    -0.039381894126587741, 0.0058152818055462342, 0.09910232687445697, -0.19607102548863925,
+    0.056676926961684006, -0.15651764221989406, 0.081435362443081208, -0.013355995779084927,
+    -0.048645512898370706, -0.11539365066174694, -0.080526203102893434, 0.043202665880857416,
+    0.1101463546887237, -0.004229899045664425, 0.054054539390544928, -0.16648613961109562,
+    -0.13227552347588251, -0.21323191895964824, -0.19111272306658236, 0.062381231576409686,
+    0.073950391637476964, -0.17452225941507191, -0.019284123066263131, -0.043141978191175302,
+    -0.014949062920849493, 0.044266713343744053, -0.091305002934608581, -0.017224974343244041,
+    0.049480058136944019, 0.06208072329304036, -0.15850114046072092, -0.084885728983048123,
+    -0.055027014070953423, -0.1375151403041138, 0.066347498894777715, -0.056450330188919269,
+    0.042397366565592974, 0.048665749567462786, -0.00051683211593258141, 0.1265109157822033,
+    -0.084186492656925446, -0.15580991351012705, 0.11745369429714568, -0.0028938100620573503,
+    0.02803605833698682, -0.094175367808889521, -0.10084322644534607, -0.055250009996403122,
+    0.035753226086756067, -0.10892832201601865, 0.2311517480120811, 0.14001799456041927,
+    0.0377114632749578, 0.1343118146407446, -0.061657035149962354, 0.21116802554341663,
+    -0.20282669783324894, -0.0025319709644327413, -0.069780743362436101, 0.070261764917932221,
+    -0.15120003541277446, -0.0944485707600691, 0.03869394703051264, -0.042822587054324283,
+    -0.074999737867663896, -0.089083401879760812, -0.18654867800498359, -0.2071898605736702,
+    0.12487994784604323, -0.061645634533471418, 0.097032072005033859, 0.065630838966240487,
+    -0.032470454118660785, -0.0096533121444525999, -0.1046210574710276, -0.075988582905437238,
+    -0.13821644895796198, 0.12997445576382288, -0.021431524562608849, -0.11029478452801912,
+    0.21958141410684176, 0.027316223625139292, 0.13126683634500702, -0.14044860867776171,
+    0.086902927076815531, -0.045510101919872703, -0.097809014089074733, -0.037120765567313072,
+    0.096360604179047196, -0.032042804799623008, -0.14010368421044506, -0.07945942761857408,
+    0.012917853231446168, -0.10837523913171046, 0.27192613620081318, 0.026009052925194648,
+    0.063792446107006309, -0.043218422182863737, 0.10971064008185771, 0.096911936969178172,
+    -0.06184667430055045, -0.099163500067668761, -0.031919519326245677, 0.048742143322573199,
+    0.088262397523017247, 0.14417068328372651, 0.03095405763470091, -0.16689688303443359,
+    -0.17590818472032094, -0.026903275056054315, -0.071929847693733423, 0.11255125476341321,
+    -0.0033882538618006789, 0.073056315749537346, 0.1722894181873347, 0.018408845044710267,
+    -0.0029682841717358303, -0.080617896575259668, -0.12153394856389772, -0.04935117541161569,
+    -0.14983321253565063, -0.081279119309426121, 0.20132351486304298, 0.27069121788962597,
+    -0.14359036445102821, -0.20459056482320909, -0.098467303920943869, -0.0015654071751350725,
+    -0.046973747959103473, 0.073351724955725978, -0.019661128177653479, 0.050416171071378961,
+    -0.075295003066146907, -0.040845023975038357, 0.059683444873851021, -0.03577420501241859,
+    0.1714817231976217, 0.1131257088029082, 0.042391988001707695, 0.089676196161944638,
+    -0.040101922631787329, 0.013189781571681831, -0.068020748358541536, -0.023165118135919784,
+    -0.22565544110994112, -0.15457725037786163, -0.13896084571992826, 0.00064418140403217617,
+    0.028079605352650947, -0.040472602582896061, -0.28352802570316443, 0.073657933914649629,
+    -0.0063384452129935064, -0.028190360501566911, 0.091756051013098444, -0.089589837718194176,
+    0.022234530528414103, 0.061544200260861152, -0.1101895798775776, 0.21353077133698725,
+    -0.014405351133227971, -0.054358163406901285, 0.063207111606888494, 0.046193611825493641,
+    -0.16240744934459395, -0.10226409875093714, 0.031442086665477272, 0.037898445916240808,
+    0.032493558107176988, -0.010273762358499354, 0.076621314474114313, -0.025030229564580644,
+    -0.00047654423450791523, -0.00028189074699570333, 0.28464764430390033, 0.025588923215261079,
+    0.13147543861446653, -0.094064927988415675, -0.029440925108148084, 0.060567923763804883,
+    -0.10262872097251939, -0.061728012993928112, -0.059956613514639982, 0.026157085535626994,
+    -0.095019993567251021, -0.17144916757338763, -0.14089949955028666, -0.031155444816316505,
+    -0.040481245374403362, 0.14139415279050854, 0.063569871462910377, 0.10367133325205273,
+    0.13933603232109149, 0.13207566126739856, 0.10352847557052254, -0.046949560933948149,
+    0.13816314931241791, -0.27084785678712536, -0.041829887712008518, -0.09955104512781493,
+    -0.015209662714190541, -0.11507632448719891, -0.14735988191028898, -0.02397132048271429,
+    -0.03500103328310146, 0.040948132527056126, -0.006541054846443844, -0.015961358115086161,
+    -0.14350479199193011, -0.00822406649670312, 0.16680661829795937, -0.046606862888111771,
+    -0.039287338391658155, -0.10720451713175611, 0.077911562346894864, 0.058452844318137145,
+    -0.0066828851416273526, -0.10618928527522541, 0.064856435843629531, -0.11041576285296931,
+    0.032380914447195146, 0.048861541394870728, 0.061860391186356931, -0.035352953469616637,
+    -0.011721350983436829, -0.12427878269031387, -0.11488427341148462, -0.030851987917668442,
+    -0.076100782300872249, 0.11367805258215682, -0.097609526323646306, -0.041715272971150449,
+    -0.065120940822588819, 0.10265171046480577, 0.044372869025550356, -0.00090142517821471802,
+    -0.0044365136089931584, -0.030733530353263386, -0.066778447982786968, -0.078072195251613949,
+    0.042520137358707882, -0.019376131692751299, 0.046192367741130606, -0.0067659485648125916,
+    0.11020682474839077, -0.078919287386302897, 0.066718212477279742, -0.017841882160776045,
+    -0.12783397733671217, -0.024142144705656947, 0.14827095814916369, -0.047007707547156934,
+    0.069779297006607857, 0.20267720240973713, 0.063871952776210286, -0.076281242441107205,
+    -0.16025006112825646, 0.087136260895165116, 0.082390947074654969, 0.034933944448901362,
+    0.10727034435110501, -0.006212910262638649, 0.034627045821211601, 0.1626440470608152,
+    0.16767863335272912, -0.06530251693642497, 0.017546929189049099, -0.1108289586424839,
+    0.040213702719561747, 0.055171503042450214, 0.12160288527560495, -0.046585763129663789,
+    0.034928637818757137, 0.016373153648528826, -0.059765461231486482, 0.19593887305174423,
+    -0.066931605996418606, -0.10733774519888402, 0.12149020439302387, 0.037830804713417751,
+    0.2067980111193341, -0.14912316837614323, 0.16446992454296738, 0.06982696327181416,
+    0.15054247640509064, 0.097892401768586851, -0.066596743710729711, 0.069083464056470367,
+    -0.12835541405619241, -0.1360456647203698, 0.23029305027905239, 0.0038867726936280622,
+    0.27228750546678276, -0.053596214898281397, -0.11331628898658017, -0.096535531693159579,
+    -0.089262228668246638, -0.028542002167437495, -0.10249967963858631, 0.02345378158565636,
+    0.017502108871065333, -0.03057630935553169, -0.068692844242812259, -0.19900704496276037,
+    0.019329411896176606, 0.0014539513690016038, 0.053711801133652072, -0.084120199365574938,
+    -0.05976970386123124, -0.1167758084908931, 0.096066228211138319, -0.0031707782906894191,
+    -0.12580274063396471, -0.13569198643159769, -0.033544566860261665, -0.066608918259761299,
+    -0.10554001243772104, -0.14499006941851461, 0.17670731873420462, 0.068368676090414818,
+    0.13901564849721923, 0.080200086635274198, -0.050115761274512609, 0.056931803282630804,
+    0.15958033303844116, 0.082227491987224677, -0.020036371499660772, -0.046342161054967045,
+    -0.095433504199207014, 0.078370021789812352, -0.14649634380165996, -0.027995878271308956,
+    0.042198747763485929, -0.086879993140483835, -0.032519177764864383, -0.18064950395462392,
+    -0.092909477381570529, 0.015163130286005334, -0.096325091691955952, -0.24858639061282345,
+    0.16227316512333201, 0.078248453300304027, 0.048912803077266205, -0.068416163768040383,
+    -0.034661045177367858, 0.029199830120140435, 0.0065756359364283696, -0.16726943335648387,
+    0.075565469517365577, -0.076622203403615655, 0.010044899400449782, 0.034181097113106552,
+    0.030771022278628598, -0.10632272751397163, 0.096157533384092206, -0.066598761701957804,
+    0.071618594506440703, -0.1133884912982016, 0.10539347895664698, -0.065261392724780681,
+    -0.15339989967273832, 0.20740118314858752, 0.14970788013641592, -0.07288085548927084,
+    0.15188040648635881, -0.012420322949928219, -0.031421899707223838, 0.042405258236746929,
+    0.10858704857198095, 0.018990486630640568, 0.069384308810340203, 0.099102796951233446,
+    0.066082595856855594, -0.059431639955085311, 0.039752009987175041, -0.088355061672660024,
+    0.067417527137375866, 0.2340950039973059, 0.097177390132144437, -0.022228821373937922,
+    0.044431676768411997, 0.2918339086337749, -0.033652705297315393, 0.19615698328828549,
+    -0.052603461071855033, -0.15527526692625274, 0.007663569414208391, 0.05032829171332473,
+    0.11523774352379423, 0.07307114393550973, 0.074786554565569069, -0.0022782973214771048,
+    0.00095721035940712646, -0.12933176718673606, 0.035650995874578165, 0.076449415908367305,
+    0.097948412704814233, 0.13912469085624676, 0.17750637832713703, 0.028044465725798908,
+    -0.093241767563247285, -0.0085591221295703845, 0.045536116977986645, 0.24193518879519502,
+    -0.088539798904240449, 0.077729145170120417, 0.02217197381565018, 0.0255958441337838,
+    -0.060956200287707291, -0.20264533864230042, 0.082204126590950541, 0.026313738548949729,
+    -0.038583422167984223, 0.085200838570989604, 0.080460511647365729, -0.0030582589285848543,
+    0.018737499881789091, 0.080465637537646892, 0.0078309100790811756, 0.1957301145249577,
+    0.075319620456453573, -0.007411539616620234, -0.034822086074160166, -0.13128030265428089,
+    0.059984815993442582, 0.037547431791436318, -0.11367619368583057, 0.020234310621850899,
+    -0.075588641223060235, 0.099082751027692914, -0.071724192680842014, -0.27413902056015882,
+    0.063618231334007777, -0.085121534330018844, -0.22301028243299589, -0.020233856188961955,
+    -0.089539566121265263, -0.10810167498434464, -0.065660282923115307, 0.15353418684502285,
+    -0.13688372241403979, 0.079459191871696977, 0.027822583027762367, -0.097649622958447299,
+    -0.064573549014784085, 0.079157110032780822, 0.10880701633763687, -0.085995597667217136,
+    -0.016840054006620229, -0.020151334536193607, -0.044903417064775568, 0.062176281021278354,
+    -0.10070304782880041, -0.094454229205300236, -0.04200203441973395, 0.011176084123112997,
+    -0.026052463942160927, -0.1227727025825662, -0.01109736177765658, 0.013990460177008229,
+    -0.12129560973968966, 0.019673825616114929, 0.17900774800992053, 0.040621522715328442,
+    -0.018485173462226889, -0.060925643506428234, -0.098957728328799205, 0.095148530612333776,
+    -0.052445821820272229, 0.063470102999827457, -0.01956364067431041, 0.048382854311067175,
+    0.040251285597279043, -0.05437887106666215, -0.20327631160009799, 0.045050158150729026,
+    -0.0085373269285605839, -0.21539820406717319, -0.13830988349036114, 0.090185084660742362,
+    -0.031066683319207058, 0.046792682447381773, -0.0032566976609026102, -0.12876854902578083,
+    -0.025314588363532578, -0.051369392193521025, 0.035589187787910502, -0.0083855953101265764,
+    -0.047854911156371756, -0.091792985036538016, -0.093886954659681679, -0.2554730294173958,
+    0.054933460013458231, 0.0081983231789468682, -0.043296041681290247, 0.012817969640746591,
+    -0.033342901234100428, -0.14108040878957712, -0.02599206652879341, -0.22786721801871726,
+    0.077331882917306374, -0.0016535102803195308, 0.088964615809217482, -0.022960052911110432,
+    -0.15652062177301609, -0.069333188831423434, -0.071068957733148239, -0.062053868971331902,
+    -0.020592964353247846, 0.057541472222178487, 0.095062036868266378, -0.068056882766267354,
+    0.10634588004738162, 0.11120046497554835, -0.11993004607187173, -0.0078984587575152299,
+    0.11539950111177076, -0.12674316754880796, -0.11020236783209401, -0.19694652489985115,
+    0.094471211602949343, -0.10896620751400996, 0.057118695965569351, -0.030016101347454752,
+    0.025838935785029479, -0.02504203838981103, -0.084565026277991145, -0.13140556385549496,
+    0.1613079628285996, 0.022985588389051011, -0.14236258525833265, -0.015803393348859003,
+    -0.16906536415165549, -0.12600300980997076, -0.14407007722433127, 0.1108189775363487,
+    0.22493000696315307, 0.051885400941711721, -0.04529104070841198, 0.017059373803145091,
+    0.06916832828306918, -0.19771636047681262, 0.066324884723998404, -0.072984603395419012,
+    -0.13137665161440565, -0.11462877049685878, -0.18090112495696456, 0.05346380795521416,
+    -0.018937363930456891, 0.049514531547488354, -0.11562645045378615, -0.014914583892215094,
+    -0.033420479387589755, 0.16170959239727922, -0.31424449962524148, -0.13983935943875314,
+    -0.075544549595583113, -0.023766005227452213, -0.11316698015030484, -0.12245561164904804,
+    -0.06864635716535275, -0.15993297622888264, 0.04553865091321526, -0.063768580714109221,
+    0.020625378695883441, 0.1440443235062884, 0.054879279255101721, 0.12075710583852195,
+    0.058906769024991673, 0.18555969494497204, 0.077267254590477313, 0.15680989365373563,
+    0.15198402420452506, -0.19583971805241224, 0.20858950164228318, -0.013797078889151177,
+    -0.09481955132651021, 0.0011152383324146639, -0.083944348065000493, 0.039077307225868899,
+    0.3144849194916145, 0.10963807793537635, -0.096030683138434297, -0.0096354399007869355,
+    -0.0096717855474709909, -0.066711793525534371, 0.042817100880638115, -0.0011269077593850691,
+    -0.0062719241839458029, -0.065288171227141908, -0.047088403140920145, -0.21222719800878334,
+    -0.16105748103317097, 0.013433894945184773, -0.055275923601622555, -0.10111550621643364,
+    0.16365304096624572, -0.18551038608890189, 0.0094108921067976234, -0.083306988448556232,
+    0.023812579653224142, 0.13098617100024815, 0.017444791082711148, 0.039247303800032558,
+    0.044695336751234029, 0.060216319674157352, -0.11203972771435229, -0.023244810678309528,
+    0.054843220774636707, 0.0053404472820541464, -0.014554474883280417, -0.027165375610380176,
+    -0.12355358733513289, -0.040271745482818151, 0.037418448515552191, -0.038328643865107342,
+    0.033902911366481922, -0.036609024259637746, 0.18768820086064431, -0.038840405156026304,
+    0.0036293140776408419, -0.079351071151012323, -0.045225815339022209, -0.083936788251522579,
+    -0.03895291846331507, 0.14198403216555033, -0.10913959797153255, -0.078395919534962943,
+    -0.046639888693374709, 0.070905633873413421, -0.010646084122926119, -0.041381559401544477,
+    -0.023744070478409946, -0.081155820959996461, -0.0071129260252224269, 0.014907083652573986,
+    -0.16705561078783565, -0.091187016666237602, -0.13844069535327425, -0.19524562916829541,
+    -0.10821575364666763, -0.17966955256902131, 0.12475811924342489, -0.060453550173452449,
+    -0.15838147191224008, 0.083596382869020922, -0.010156481147883558, -0.00314382035960248,
+    0.20922182372029832, -0.00053803109104986558, 0.19851052635322897, -0.18497159988927514,
+    -0.055317372339992954, 0.14246726800658796, 0.16855018651575973, 0.12964421393421904,
+    0.12873617432577733, -0.021162536855936234, -0.14473151270244081, 0.087252166399609241,
+    -0.17210774068384932, 0.0062764722225130912, 0.22211271980779751, -0.045441886633478645,
+    0.059476669544712965, 0.031884639574914692, -0.011017304580768945, -0.096599740061073608,
+    0.14157776064190677, -0.097333787764026208, 0.14181369640201152, 0.14096400230447975,
+    -0.20725259088424633, -0.012985151195637236, 0.10849794157608585, 0.00010973508144150524,
+    -0.053272809015978584, 0.012779967387705643, 0.026045748842714433, 0.063196418840264099,
+    0.096158794844441772, 0.054029872252241762, -0.097087039644479775, -0.15852716888923557,
+    -0.082985404205154142, -0.087083157149281901, -0.018407287487626461, 0.094253511785890032,
+    0.084541207298512264, -0.13538022666418786, -0.25351966424139821, -0.16796118995263024,
+    -0.080920588127564586, -0.15688383432140884, 0.13560089792656227, 0.0078499023123241238,
+    0.10324207464357045, -0.063371874980109988, 0.014117201309995777, -0.072902536181369951,
+    -0.056768870720429944, 0.13095851618421611, -0.00035471433467967395, 0.033750667009230823,
+    -0.048556903996743672, 0.17287183441949422, -0.14348106927584878, -0.16372492785554374,
+    0.19704204357010277, 0.082800775936350976, 0.050798493924108575, -0.027153994501508575,
+    -0.038817555769769613, -0.05550893054805333, -0.11661137463539277, 0.00019878843546865965,
+    0.048545824211456368, -0.071415113381981851, 0.090303342126418898, 0.084618529188789732,
+    -0.029498444645410873, 0.12697194983375867, -0.15599357566158975, -0.00053671574192348012,
+    0.10305141956541029, -0.027055045317270012, 0.013208438730887376, -0.10875003838716771,
+    -0.061459238564434665, -0.16087147746080682, 0.042021160905361295, -0.05185063851915743,
+    0.080753473891933492, 0.017615394711725935, 0.0092694301562996767, 0.14028900885085965,
+    0.055422813652709353, 0.10624477696457882, -0.15892137958414312, 0.22930626648832805,
+    -0.097542833220687672, -0.0017113047988562623, -0.064362856782064604, -0.067556431560838154,
+    0.17455840813615794, -0.0041792122088412462, 0.022209743966461984, 0.19434445301592607,
+    0.032885770373603178, 0.15491921550519955, 0.081186767020593992, 0.15445366682523454,
+    0.0061652103044825173, -0.074059297464580634, 0.070042727666826426, 0.008276849829741419,
+    0.21569924905249693, 0.044033306226559286, 0.013351516505329966, -0.019187516880464873,
+    0.068380995590923171, -0.080735639091833886, 0.17341121523500333, -0.011493313037374315,
+    -0.081072056950898863, 0.098670077232176662, 0.099044360869813663, 0.02798520598659909,
+    0.054441218903573646, 0.071872322851145726, 0.1132237554563541, -0.0079198328799577507,
+    0.13632119196620629, 0.011980314424509265, 0.15021376399312553, -0.15394230267793163,
+    -0.09393096221237264, 0.039745085455965688, 0.099914443020833771, 0.071860327598469248,
+    -0.067799281456233124, 0.019783074962644944, -0.014598543438775429, 0.09342084559106964,
+    -0.045642064261833114, 0.054705521760774339, 0.053816907168066426, -0.018167611215283663,
+    -0.083538332033715704, -0.18692068136007611, -0.057245311529685095, -0.048096073054338447,
+    0.088219946210883415, -0.071526382365070834, -0.093408011778705072, -0.18667212409794368,
+    -0.03273799521259204, -0.27770868871330162, 0.071864756154884649, 0.098855769356370846,
+    0.0017457394057988486, -0.091430987428780017, -0.086049208644739431, -0.030094091786054614,
+    -0.018483137027727147, -0.12114403590650064, 0.21561343361585286, 0.029369554867527056,
+    0.013061055384380987, 0.098140465291965615, -0.020989846638846996, 0.061960803177791048,
+    -0.10343744683754935, 0.11280115646858815, 0.01385508401122687, -0.025454025287348015,
+    -0.064472289473315361, 0.11170961705272678, 0.082077411069627113, -0.099871376318222294,
+    0.05930934319038772, -0.058494029536677448, 0.085957052522384225, 0.017679404685631318,
+    0.10275040174967642, 0.020909733753754305, -0.014707482670372937, -0.014080065588825361,
+    -0.11334839993313561, -0.060971127473526177, -0.13411880748857663, 0.0034277952212688231,
+    0.046988835261708516, 0.0099964440302685639, 0.15925166623005713, 0.051205549633442336,
+    -0.10347522928420914, 0.085632433689100465, -0.16337755218708713, -0.035811164286477973,
+    0.0048193827516620239, 0.13049007145309904, 0.099085349896096436, -0.15140100393110115,
+    -0.064416632066966115, 0.09784641149937702, 0.027291425337126939, 0.12512173638419155,
+    -0.060920625961187927, 0.064107878331064114, -0.21894615887052804, -0.032663138630595175,
+    -0.15229184942254667, -0.040556254972529168, -0.0083424762273500083, -0.16124760756666123,
+    0.066619080858757965, 0.15801280149621022, -0.1431659538034081, 0.061214706519983446,
+    0.13098563579043826, 0.07733540489815989, -0.030395732978414601, 0.11931530074118092,
+    0.064772793298113113, -0.037076693312100908, -0.12165434275255811, 0.014882228832831019,
+    -0.14579777469322006, -0.13848185635025317, 0.057636348622573573, -0.0399241564091724,
+    0.19352605489909422, 0.15128174351461132, 0.069642697028421047, -0.05707626543267242,
+    0.0025401779058808055, 0.13110954729281174, 0.02770329753662764, -0.023995827252148293,
+    0.13030821423107031, 0.15313809747127691, 0.11409604209238942, 0.08971026514727018,
+    -0.09584269509184333, -0.19317034334539138, 0.038365970895981087, 0.0017670656418303393,
+    0.082713912951134672, 0.085157688085919087, -0.10972895537483661, -0.10481009023316595,
+    -0.037218456307167039, -0.020243421249620738, 0.1621537125295793, 0.1763288342224642,
+    -0.20785003583534351, -0.069680228043163553, -0.07877789955968087, 0.0080824154891873355,
+    0.026536508520962756, -0.032924677983387066, 0.043924464762652576, 0.081727171709864779,
+    0.05163777701088236, -0.051911945783211719, 0.022534899384240147, -0.090145680462485847,
+    0.0057271767672629793, -0.049271827015912324, -0.20738241548207231, -0.010432820729335199,
+    0.056855247186248695, -0.074799512995409032, -0.10982066486834208, -0.0055602796644664727,
+    0.12381149525136041, -0.10569011235103044, -0.033957563356679474, 0.15753538770337683,
+    0.10869049164861135, -0.1068793363742192, 0.12142609288346419, 0.03170715136835231,
+    0.011941854345286501, 0.030067807615687739, -0.025755711161202049, -0.00021763042554623103,
+    -0.093204270599761108, 0.080162783451007316, 0.11149327419149674, -0.20548995184793997,
+    -0.10418577585273721, -0.011191486283947893, 0.1041331552776773, 0.018012926749545622,
+    -0.0020083456127070526, 0.10550636743880894, 0.02831850021845134, 0.026511513153818646,
+    0.14202202092178565, -0.084926922456344409, 0.14901248726203234, 0.22198582413126977,
+    -0.12297447373457704, 0.004297585508320107, -0.1543504635737154, 0.15626524041517542,
+    -0.16225380830073627, -0.039394700304255729, 0.058599321665413956, -0.096261712751789907,
+    0.12380350309860544, 0.013146889174308382, 0.012054335524762491, -0.034612589148786649,
+    -0.041663476007280612, -0.034531433155379834, 0.17501628585533188, 0.068405811410058054,
+    -0.25858824441825223, 0.28021215086130208, -0.055099605116716598, 0.049387884343444134,
+    -0.13942012282633628, -0.089325311914635289, 0.13266981971604247, 0.14177366892379634,
+    -0.011941203623123304, 0.023943580789723227, 0.0030826022886943716, 0.10225701150868019,
+    0.032838158801455838, 0.19869299680946284, 0.038858840994932621, 0.060882853405978495,
+    -0.1157463813010009, -0.17229477178504901, -0.072617498141843428, -0.069359824674002327,
+    -0.0037788426795261924, -0.12329566661062621, -0.021236009867547794, -0.04969200349956001,
+    -0.11014223822979188, -0.19314826534521248, 0.045953880335161068, 0.035503573865637357,
+    -0.03582197556468264, -0.080898675424804375, 0.02217232679394588, 0.025046910077050226,
+    -0.27504599659366463, 0.12284300072460264, 0.10728771020917452, -0.16055945035459571,
+    -0.032169725818743042, -0.24870481568114997, 0.023556724913801338, 0.13263942732525458,
+    -0.088896768853877359, -0.14816452408266542, -0.10836086248564268, -0.019227919757298359,
+    0.058296331421244608, 0.1411052331890417, -0.10570879765892303, 0.32208134507935915,
+    -0.10770574514679745, -0.14247051099690117, -0.1379262676274508, -0.088226770963757944,
+    0.13023341572620489, -0.031539789047952134, 0.12683074253917948, -0.026658692737416296,
+    -0.098144352586911593, -0.16138332922272453, 0.095258680323899877, -0.048460155128766044,
+    0.0407366464042744, -0.13239810844013186, 0.023832426582205704, 0.055065733038378355,
+    0.078734155206873047, -0.017242057294338597, 0.15534510222071771, -0.066494752392109585,
+    0.12329790991744766, -0.06659822441403021, -0.0010824445049062031, -0.079033125099295762,
+    0.1520980300743606, -0.075127220255642391, 0.090187525496638762, 0.10326790352997349,
+    0.10135344422831274, 0.02936354233325493, 0.029041767523135632, 0.057051670151045598,
+    -0.16267691676842905, -0.050824639464368687, 0.11641006789931306, 0.06214096431217854,
+    -0.0082188184995961814, -0.0060759632290147492, 0.15343010875016541, 0.09630099954879108,
+    -0.018125669771420126, -0.088193855754497785, 0.19078346022891285, 0.1422143295569008,
+    0.10897462850120297, 0.25041919594440082, 0.04359461884918818, -0.058356770563633691,
+    -0.079332824046323205, -0.038297340888859076, -0.078865800022634894, -0.075553858615555636,
+    0.12385329493934945, -0.14513755263201317, -0.081476798861327859, 0.010905732603913807,
+    -0.0083746001179271865, -0.087170397856085602, 0.094773953633692787, -0.078426583504076774,
+    0.021198114682853375, -0.019030811618094477, -0.1715820710291199, 0.0041644759358555675,
+    0.0031683422120772249, 0.014238279057995299, 0.066135487247904995, -0.0092973386000158708,
+    -0.18407298836077227, 0.13062094720347694, -0.19315128521317121, 0.081116276555570035,
+    -0.022338302828004034, 0.066971705782556096, -0.021532515563668905, -0.022802701997103228,
+    0.038300058784414857, 0.15050061102465676, -0.10277304724965174, -0.0023747397925636881,
+    -0.017959196246337891, -0.044010701271041279, 0.018759927130936788, -0.13373155864916664,
+    -0.047247117634101124, -0.18767891963207972, 0.058919201247702495, -0.06468775464012394,
+    0.058606681616214844, -0.011254347870801661, -0.038237413524965513, 0.011017103593964527,
+    -0.017628131589343291, -0.035005851489678434, 0.014236833309558916, 0.12968252239785322,
+    0.095160666686675291, -0.085652089600428832, 0.1207550455153579, 0.074505901447500356,
+    0.05981581654839601, 0.020920308894788377, -0.033402337215878708, 0.015242150565222497,
+    0.059138701958790722, 0.005048230400050726, 0.17951152950683869, 0.0045761282100989743,
+    -0.062200830457149844, 0.062482117749832859, 0.14949435553774262, -0.0049260490736228102,
+    -0.078378509557001486, -0.05342989703448385, 0.053708523037611214, 0.074466663048565807,
+    -0.018630943401874236, -0.11404393388993037, 0.13680670716871707, 0.052302188010809061,
+    -0.10752522536604923, 0.043335718429615859, 0.19139304358374176, -0.20595578381526228,
+    0.059519929718894395, 0.17841270373773443, 0.15581605190094039, -0.024264001993081964,
+    -0.15217110914396459, -0.080566716581965292, 0.19402570391456184, 0.0045541002568062023,
+    -0.065500655577188524, 0.12931429080341839, -0.037204652900533028, -0.064165762618171779,
+    -0.043875529569665422, -0.19221843136620986, 0.064135922526184927, -0.010157851202561526,
+    0.10250853839599018, -0.093918083037666342, 0.0024145286715550221, 0.11366726444615954,
+    0.1895782462615753, 0.16703928754949882, -0.16476286056112013, -0.038623866602364984,
+    -0.12075819910592257, 0.08336131701647323, 0.13940178077753265, 0.11916429681050787,
+    0.010187959894074445, -0.1171559082071436, -0.010015973518748887, -0.067721707832325714,
+    0.01351825832482886, -0.11345024114098599, -0.054021141713236777, 0.078296694381186804,
+    0.16356463056635037, -0.011437087022046773, 0.13168945572578863, -0.10943385407851504,
+    -0.11987704820805387, -0.048781784938483105, 0.053496548953155657, 0.036955531214500285,
+    0.080847950973520058, -0.13900419861595356, 0.058477892873917393, 0.05239150447326562,
+    0.076166893521875875, -0.057587529932360257, -0.075618994059537495, -0.052754195537638868,
+    0.023511333521178353, -0.12952673998865674, 0.044051450700275975, -0.045154801742019156,
+    0.15702153311193673, 0.051684117130981047, -0.18187410038841501, 0.074558837082440599,
+    -0.077602813589346162, 0.07436536321474406, -0.13543447145897655, -0.08909179991005016,
+    -0.04328140586888702, -0.019619821941746964, 0.042585776471302114, 0.07009121645649613,
+    0.0041364637172057817, -0.13820321794408919, 0.14401231825184704, 0.032909097456554522,
+    0.061963092265429884, -0.016192956990849813, -0.27621012517915999, -0.011853294367409868,
+    0.043981586876938657, 0.15547578569321732, -0.00064739398654028741, -0.082074251904490039,
+    -0.046188015101363937, 0.00042408102056176619, 0.011512824017113423, -0.051604030727659289,
+    -0.045103665056236669, 0.039601169370051016, -0.01172110753270628, -0.014658717967477154,
+    -0.10997814113107758, 0.085864509929306776, 0.11182285032001905, -0.021661518561540329,
+    0.070283617493042072, 0.1008290369373282, 0.011281845573646351, -0.064222891622160536,
+    0.11539982718046866, 0.11640815610097266, 0.15193020671250268, 0.026317416395428773,
+    0.12321848666263946, 0.2225917818704839, 0.0066592756738663309, -0.052267484524809109,
+    -0.2375443579785993, -0.25083136060303635, 0.20404333069800482, -0.13346312108284247,
+    -0.11052420221038527, 0.14834504149595831, -0.030432966047820396, 0.034829384038715293,
+    0.26166191856245025, -0.045295814755867553, 0.0059520874140033854, 0.03607888292006408,
+    -0.07048986696214124, 0.11816037390406604, 0.14342485554081361, -0.12560606203366276,
+    0.046309014038016759, -0.027972150270562855, 0.075508761768008872, 0.19417971921662056,
+    0.1918015882198878, -0.086804259701506847, 0.049777396620273182, -0.054466056602718402,
+    0.092392696257610527, -0.031484735622399077, -0.14527784621296441, 0.069725315777307742,
+    -0.097357560660985915, -0.18805157427797972, 0.071508782974384053, -0.29468249526276996,
+    -0.0014536772480241791, -0.15730989981945284, -0.053552888542321979, -0.093971961226171477,
+    -0.19285131791428231, 0.064009220958182469, 0.050453884838011616, -0.01645112856399783,
+    -0.02097520398298678, -0.0085581740749404774, 0.030397526100442076, -0.024810751198096118,
+    -0.045102446982523248, 0.26105723030860767, -0.11330306729103844, -0.0011136880603161011,
+    0.027175120898360008, 0.023626164483339256, -0.061718203893432681, -0.019069027705018279,
+    -0.14917174664247704, 0.059247500868074565, 0.088284641517147114, 0.22294480918501866,
+    0.20287763878751236, 0.088811244544991952, 0.20370662888961563, 0.049995251182910157,
+    -0.1271704654803823, -0.0096393356350746289, 0.090592607109178255, -0.066624495835492278,
+    -0.028258699632887362, 0.056758379297973567, 0.075942795514304579, 0.16438367230094283,
+    -0.06848719825161885, 0.015191782930739006, -0.22229884042646569, 0.067435651132141963,
+    0.043039424714082383, -0.055676993767990242, -0.010898865116292242, -0.013238165017916607,
+    -0.011930763150994842, 0.097242007940066849, -0.19363265979368166, 0.20013794150741776,
+    0.074658879507599002, 0.080117052409641995, -0.021629758306184424, -0.047368048676101518,
+    0.075762635255968366, -0.0084647637913687068, -0.021391736345175161, 0.06435788041443119,
+    -0.05295149337872921, -0.064519691912260729, 0.17972084939427407, 0.013394623927334856,
+    0.068145906360508213, -0.057767120488548991, 0.057463828961278732, 0.027895461495074988,
+    0.04618850440472258, 0.14870819523656231, 0.082088774830026273, 0.10281334820889151,
+    -0.044772776155285902, -0.045298970364562527, 0.06237317031637471, 0.04243931033971076,
+    0.049295973629665597, 0.0099315007765301035, 0.046319974177983059, 0.12262278715171691,
+    -0.1079840097938668, -0.0066534266023570701, 0.038007063755849356, -0.15696879120132676,
+    -0.072649574319003513, -0.027300400868640839, 0.085377194214159721, 0.034888345397075332,
+    -0.082404395229698335, 0.0600430851718474, -0.052032827668925634, 0.097925037626048192,
+    0.0013556510957357826, -0.010676919917955696, -0.028318541101301477, 0.086172493022119975,
+    -0.10505190726088603, -0.011547860285517934, -0.019125414097982834, -0.0097565143155001477,
+    -0.010130801311778076, -0.089940407265821462, 0.01939282915756398, -0.21064688895296607,
+    0.34852825480985222, 0.00095105109983926724, 0.051167936390539084, 0.069354013265871456,
+    -0.050851796703215976, 0.23014346798539351, 0.0053976429242414033, 0.092491207724214305,
+    0.048388593198434367, 0.045215830145821777, -0.046135404568648057, -0.034633365206816501,
+    0.076604926888847819, -0.071910279535643662, -0.05269988202925107, -0.14195406789757326,
+    0.20001297879281976, -0.037747142366884853, 0.064457567062520968, -0.016426626055594046,
+    -0.10449733322465922, 0.12062690436287588, -0.11040581720086655, -0.026966414355730162,
+    0.043250587044012287, -0.070477943793506692, 0.038622411794768108, 0.045482062758727945,
+    0.033495607528623524, -0.15096700195938123, 0.11417029820327698, -0.097218837984375986,
+    0.025672740921652604, -0.076240551565854367, -0.019081764566012311, 0.15494742252210572,
+    0.1889506266081776, 0.10247822412459115, -0.022738777867712872, -0.039889673269095177,
+    0.051447068766760778, 0.061906110366512578, 0.18014325512590953, 0.051498195424248369,
+    -0.065267832480334034, -0.029016755153467664, -0.044917400784976552, 0.085074639327712295,
+    0.14355804960212237, 0.12316094399191904, -0.0020848908951394325, 0.041803376233204577,
+    0.078239238898409294, 0.020984943833344281, -0.03945049919410782, 0.13554781432635174,
+    -0.14020603180708849, 0.090925420343721197, 0.009263035391664497, 0.045722235158676516,
+    0.062035730599463199, -0.027028637421125774, 0.039103189858110912, -0.054309724904726339,
+    0.0042981390592152511, 0.08207893946766226, -0.075019612813100461, 0.1962301846398557,
+    0.037614653245710325, 0.039455199118161879, -0.015627550409136312, -0.023979588827425454,
+    -0.0077046997984724684, -0.022150471037212658, 0.19372547850920405, 0.062276664606390787,
+    -0.20493474472423304, 0.16974254470457265, -0.043477004125718838, 0.15741693307871024,
+    -0.067983357253765475, -0.11583180874573989, -0.036826872004917972, -0.14402895270632995,
+    -0.0062153724453419676, -0.028073764594006199, 0.0023843193781918903, 0.11518249066405301,
+    0.13972109552541981, 0.091387650588110048, -0.0011991665496050405, -0.02024722809760086,
+    -0.070528543930094639, -0.098938399581079528, -0.14695927652362689, 0.076572880827313949,
+    0.025632454685288141, 0.17808586314993971, 0.03146248168012835, -0.13777605199182152,
+    0.0044492378392901035, 0.11135660143218118, -0.031559576043878226, -0.071516403362305844,
+    -0.0086773484464654563, -0.11893679315314716, -0.088412310927564353, 0.063483513901518518,
+    0.019490002990099162, 0.18743448367179386, 0.043896314820326202, 0.077812047790328492,
+    -0.023971215909118649, 0.052773895535813319, -0.10497686689984757, -0.1004845509652286,
+    -0.067672186221041833, -0.091772377558788365, 0.019152894418939366, -0.021513673044128667,
+    -0.013253563271294778, 0.033234015427629209, 0.073056343734729023, -0.039378799479338755,
+    -0.061614641309414568, -0.031778932065824599, -0.070178166865644459, 0.098719719842939369,
+    0.031115320209695648, -0.012072763339375714, 0.037350673886740016, 0.095243705329668457,
+    0.049396418980474179, 0.0050653963064579708, 0.18170972491329224, -0.089653271538684631,
+    -0.12923770094073281, -0.020804744111393637, 0.10931652893410942, -0.12542068364627654,
+    0.12681211808438816, -0.07121025774698593, 0.13364307097178171, 0.10689078784791628,
+    -0.027430519135542172, 0.013007511574379781, 0.057556758096030371, 0.053663288399945226,
+    -0.1299951285972574, 0.04285012938960106, -0.16186108400828203, -0.023419733714902725,
+    0.031025701085790381, 0.14021490011619353, -0.13335302435562016, 0.24255156373049908,
+    -0.046430981860777341, -0.0057309424602460489, -0.034341795004243766, -0.12300963443871674,
+    -0.026135804873057264, 0.22845738281422823, -0.11848811082099323, 0.21515084848823285,
+    0.099126708492387763, -0.1398069328511764, 0.12042529234102362, 0.21424912344434038,
+    -0.11982065861799132, -0.1794173601830695, -0.041800384280944458, -0.039229752582517673,
+    0.045477545775926748, 0.11287718499018905, 0.11785449410854855, -0.14732375168365139,
+    0.12190832792144959, 0.030580809006199711, 0.016942722214251148, 0.064200455615868013,
+    -0.202777123897039, -0.041101565627069549, 0.20879434997864899, 0.067468001687015985,
+    -0.075037787328233338, -0.16258218067647373, 0.15603428103007247, 0.1105831106575889,
+    -0.15889325216137373, 0.14089150034709585, -0.047379808822094943, -0.051381289654670106,
+    0.055339944619235623, -0.17578203675383139, 0.13068766249738129, 0.063717858813381864,
+    0.055938902614906069, 0.14407697027863489, -0.13832221314092313, 0.051401796331238959,
+    -0.072762085208327151, 0.008667911354842411, 0.0077224997144878021, -0.10641980695916829,
+    0.12795929466151301, -0.0057051376335712743, -0.12890226228278126, 0.29980274157011971,
+    -0.15232586343947979, -0.047513488417864569, -0.0082787474325892122, -0.051132330228672383,
+    0.029604636636226745, 0.053535334446183559, 0.11135698334531748, 0.044241289983370409,
+    -0.10016659856505493, 0.0046181845700376013, 0.1976669066706625, -0.12875448238606704,
+    -0.063495711860181325, -0.074544738395340773, -0.07256029017066469, 0.038104798296973316,
+    0.089184414373384688, -0.003272307391310287, 0.075962736086218577, 0.014618575676723828,
+    0.0593782313488119, -0.089626555102937919, 0.058855093256098584, -0.071686863614909765,
+    -0.024169848573953025, -0.067154711000442679, -0.0040322049225884034, 0.089205591555711491,
+    -0.037406569160885583, 0.11525428109685915, -0.26938774884637917, 0.0049224657010275728,
+    0.0051488189427018544, 0.11935806383671303, 0.042700452911257097, -0.10161744431744504,
+    -0.031541410152798509, 0.063959561965127393, 0.12408707768934674, 0.091671834358367441,
+    -0.2400165181406127, 0.039546654004945593, 0.08925749586766224, -0.086050132155386663,
+    -0.099243677161450522, -0.14819118258850511, -0.017159797875750501, -0.097742843325764772,
+    0.060434313116166663, 0.031096657746135688, -0.17635287485543441, 0.060153519100634371,
+    -0.18347437330658734, -0.029620317767077655, 0.041703109990589418, 0.0043540672472138801,
+    0.094853431744361602, -0.043029087613924863, -0.017770247506492885, -0.088959277594979499,
+    0.013701721095955665, 0.014357580387235244, -0.30052231349830483, -0.14311194542672964,
+    0.098392174977220401, -0.2227051406830238, 0.082515718280558079, 0.021854952418769093,
+    -0.12368163043031491, -0.12451675638095139, 0.034910502398328075, 0.090342337440123308,
+    0.027793164276020077, 0.049810407747106641, -0.11116455636731162, -0.11035464076129263,
+    0.14882328792467781, -0.20481945838757346, 0.1580433025650535, 0.00047367196376626769,
+    -0.1053905312787682, 0.059412888053644926, 0.058919560460731761, -0.053888961996098786,
+    -0.041114051092718783, -0.0079046276228108194, 0.045405499809390737, -0.06442686681592813,
+    -0.06574866628791852, -0.02204454710410295, -0.097577365146120504, -0.25650017114985568,
+    0.091467632728529966, -0.12013946998550319, -0.056918741761652202, -0.10776644619016551,
+    0.16821109645434304, -0.066103547978511742, 0.095398530515842087, 0.033865688641824349,
+    -0.086861748176703418, -0.020328316840875237, 0.060484087846069359, -0.096358832234649167,
+    0.0030316345681857962, 0.0095689953591743919, 0.025712125269548143, -0.056103571877174713,
+    -0.014789356926881337, -0.058530537820323428, 0.029048693830929652, 0.030840104515513361,
+    0.16116231559054767, -0.075409988316907164, -0.022559517344568167, -0.19553728426237343,
+    -0.012354814036040282, -0.10203469717085788, 0.016102965118639914, 0.042933420332655715,
+    0.09844173142167173, -0.0066857169891006655, 0.16754729461710949, 0.042166439511531262,
+    0.028124410793182952, 0.080282320544837901, -0.14353327137821464, 0.047905879566299339,
+    -0.10460320098246133, 0.065685816558059967, 0.12068157628625174, -0.16212389341255262,
+    0.10492599669503265, 0.1657046513084425, -0.16566147206134427, -0.15349880728463564,
+    -0.037795278126039916, -0.056433653239825812, 0.073793068091704189, -0.037489035172637103,
+    -0.067442601244857958, -0.0052758484594890393, -0.086630893992932015, 0.046335868670757396,
+    -0.14621053274535339, 0.024151299662616456, -0.099010148584118579, -0.024447107359335828,
+    -0.087727951003887916, 0.088209571830481226, 0.11343593617913519, -0.033606365443926575,
+    0.0017282814520283619, 0.052727604165455202, 0.0039501725928152527, 0.21929100589070646,
+    0.0023980905424063567, 0.022897681562453403, -0.071147560106121915, -0.0059966332063977369,
+    0.15020203824178655, -0.15324565120183198, -0.014158127200099905, -0.092255176088907695,
+    -0.30577892348417079, 0.022545549979883256, 0.023530327634613279, -0.14416897134326487,
+    0.014182740944888764, 0.083144563175445801, -0.13822024838633823, -0.019022624995854436,
+    0.13442120662314933, -0.11993168257932829, -0.075305512593918808, 0.14513988381687218,
+    0.35603835785817139, 0.12200117400740434, -0.10239714418272911, 0.11386628037284835,
+    0.11303510680174805, 0.029590264055895366, -0.025380941492664962, -0.066184873077017634,
+    0.02812390537887105, -0.0272779816113604, -0.075397967855580048, -0.010702771127544277,
+    -0.20526744275417952, -0.029071909861696155, -0.12989682125123012, 0.046338302665401392,
+    -0.070006475485734951, -0.1894906439750848, -0.26609922609921866, -0.14934973878911664,
+    0.11694621450012022, -0.076686992627315306, 0.079671942834171797, 0.030379324051084025,
+    0.027745969641973831, 0.060454585050271861, 0.097423031808082663, -0.12961661515603065,
+    0.036690251398016863, -0.082496193947649316, 0.058958540797069206, 0.069369374197257694,
+    -0.15065447424503706, 0.013418415909267876, 0.19821706153571195, -0.036699625083244009,
+    -0.10367710191359569, -0.0322339429339542, 0.15525124058708939, 0.16483693074406269,
+    -0.061367739299371088, 0.018557118082704022, -0.12258007343861033, 0.0069556063445854743,
+    0.21624815412103404, 0.014042326781232376, 0.091519746453087913, -0.092973115981125246,
+    -0.022916195871121741, 0.015097561976815874, -0.078857414312895002, -0.032028843639672309,
+    0.10565664485429356, 0.062242924867282091, -0.014051622743242077, 0.069635836509205767,
+    -0.073579439389727705, 0.12377368719151419, 0.12486819087362447, -0.14916686667350221,
+    -0.1937899066659543, -0.013961839067744678, 0.067114133179367805, -0.013417751271751047,
+    -0.093314552367713105, 0.043731287598706231, -0.032112566684770749, 0.052978086194176946,
+    -0.026864880182024955, 0.10951527718684249, -0.1388299642701887, -0.078746965642030042,
+    -0.025809218808202885, 0.1358121891682342, 0.16821222073117814, -0.043050575548260805,
+    0.010595991055920899, 0.048101911264701293, -0.039679020793100296, -0.0097588594460167651,
+    -0.098926001060417643, 0.10803895319410249, 0.058249641303121769, 0.17391656418542559,
+    0.056859886971383458, -0.11014786166090834, -0.03425083557659906, 0.16531425724800539,
+    0.075350497126080357, -0.046164147317076895, -0.09853709465416377, -0.021842636163205142,
+    0.052505170362344103, 0.085549003109595789, -0.15659088413745709, -0.044480557052643109,
+    -0.044416548653531999, -0.13144520452311365, -0.11185293185425788, -0.039777837626335362,
+    0.0015942342786177425, 0.063360333022088267, 0.017433584206006627, -0.10591795032339768,
+    -0.14244031486776984, 0.076433837037112345, 0.029135763358763268, -0.054096275341595459,
+    -0.12128694684938213, -0.078808390790279209, -0.13703232830526077, -0.12434112643529732,
+    0.097704798265513773, 0.24820304709064667, 0.11543950375887502, 0.12917155547324841,
+    -0.15747892445993997, 0.23607618371007347, -0.047107189826195404, -0.030276268060284744,
+    0.20797645330371106, 0.27540850824737317, 0.048071598809621897, -0.13280032767000524,
+    -0.057580323299377081, -0.069879494417907514, -0.11624665929288308, -0.036822653602832579,
+    -0.069002054411513858, -0.054246129715756188, -0.023363839001493164, 0.0526709684832464,
+    -0.1162693838350357, 0.093208081951056357, 0.018221742507847197, 0.051438142852297829,
+    0.089278433152838177, -0.072854026034711611, 0.081309891394251918, 0.073573274780110109,
+    -0.0093294025683495849, -0.012813637606313367, -0.041504211048241195, 0.02205006385731274,
+    0.117481143253107, -0.014427985725399177, -0.10781800316008425, -0.0028027942563687352,
+    -0.0037949526904926738, 0.12858464360730626, -0.16363080565932203, -0.13812436631862912,
+    -0.037071922879969264, -0.03509511647007274, 0.12480169168178112, 0.031347950675940733,
+    0.14737690330559844, 0.1099304332511333, 0.1366262403240226, -0.037745007291823771,
+    -0.049399358029760185, -0.077984881434978004, 0.066617530565292529, 0.081345393501685112,
+    -0.11350715971179239, -0.084550634844013456, 0.053764746126461621, 0.14996976341400137,
+    -0.060363181090184279, -0.1012137928921705, 0.21471510451494316, 0.024089323490631673,
+    -0.047589674811377179, -0.18614819560152707, 0.12830918167784797, 0.054209679567901618,
+    0.08367859052623812, -0.10837200594989727, -0.17448909530576229, -0.14507747707479629,
+    -0.18131838462729966, -0.12611882479930175, 0.13747971072522722, 0.12348330082005192,
+    0.10265736840163515, -0.024703372558973671, 0.050736302726162655, 0.036916115592169126,
+    -0.046460151728395606, 0.056491298800052554, -0.11990479365996141, -0.019451251254528498,
+    -0.059193625142649212, 0.072755873192595355, -0.018750043987098033, 0.051063126309062179,
+    -0.07944996070020334, -0.087931890204531751, -0.047417649518850219, 0.13257989597512485,
+    0.085768405720491783, -0.010921939497774624, -0.18014317163658022, 0.11058490945417522,
+    0.090797524119896403, -0.022127324952345651, 0.15135856445650911, 0.012331712067695549,
+    0.17766136083882816, 0.13509437327560248, 0.058866702290601459, 0.0048887344851697642,
+    0.076661455040703708, 0.065249543675700447, 0.00051651346655877308, 0.18599823549837066,
+    -0.04528509315602719, -0.073054856999455214, 0.025386808017715586, 0.026959950002810356,
+    -0.16266779941155673, 0.036128087740887459, 0.049805093051967918, -0.017814404106955024,
+    0.17801644485749751, -0.11527749551688343, -0.0744897644107229, 0.018306737546803363,
+    0.046627333932029461, -0.071203966551973877, 0.0053500876399512932, 0.1179905373406049,
+    0.0373254121919556, -0.020368242162178012, 0.00010477338562453596, 0.17093875969514186,
+    -0.1406596331343733, 0.11840679542934546, 0.12296867770602488, -0.033595827155812233,
+    -0.1717824203181462, -0.15801001582834145, -0.00041089042478089299, 0.062419770531062034,
+    -0.20836663824541193, 0.057308905353778299, -0.028490426708877165, -0.15241555801429507,
+    0.015815737185992457, -0.076174209470139143, 0.097998689825978855, 0.096946129965784875,
+    -0.19721364625415502, 0.17416305757726619, 0.18241939969003115, -0.023063020435624894,
+    0.028983614567869163, -0.028217081753569493, -0.15877562287090052, -0.075352160370689369,
+    0.0030629197401285239, -0.037115590565290603, 0.0040249873063347855, -0.061983302118626363,
+    0.10606248669779501, -0.0045318764553411439, 0.040514438528724092, -0.031312771100398137,
+    -0.084919523350558981, -0.060103858699206814, -0.13569593291335308, -0.082402826717981159,
+    -0.045162295612471287, 0.045915391195468523, 0.1456604182702739, 0.036023824454720584,
+    0.018244128030829521, -0.09201088359960416, -0.029294061091134759, -0.040115020468776547,
+    0.00025141170146794997, -0.068128391680677386, 0.13342429825394816, 0.0094368212442687265,
+    -0.074110747120033196, -0.0033269140092945632, 0.0071320760622059082, -0.019999138200563923,
+    -0.15610146944034858, -0.12430290635438192, 0.11996814717417667, 0.13223138850857719,
+    -0.18360209384059667, 0.1011289546500428, -0.045581391532321082, -0.016543494938720437,
+    0.091863752404419949, 0.025764369609265581, -0.1290967708933399, 0.075507580858520815,
+    0.12033483765047429, -0.014293679858022651, -0.00023139051774285005, 0.26241468698119286,
+    0.06404890700352231, -0.062154572282272044, 0.082000350203800962, 0.027378744701722149,
+    -0.050809786703787461, -0.11041701257675729, 0.05541004022592038, 0.2691475765535562,
+    -0.11163756796234652, 0.34211469513877285, -0.062542007663448224, -0.051380915850739603,
+    -0.0081460953192632989, -0.12169812476738924, 0.040779700798849919, -0.13841837783806332,
+    0.0057861591121290985, 0.17123722469496414, -0.0060040768569722004, 0.13025366599763799,
+    -0.088167817536609808, -0.17927404185688112, -0.058938010378672155, 0.043925906085646574,
+    0.11839420398819932, 0.059947506505011738, -0.082548417988062145, -0.2263202655101767,
+    0.063092881886964811, 0.13689532686863343, 0.07353267953176508, 0.099820350871931501,
+    -0.11267967373089778, -0.010931879269444724, 0.06479639763672003, 0.15840529064767897,
+    -0.016995608764180145, 0.012476179106312942, -0.051866662633937945, 0.14860128779350681,
+    -0.012534641534724129, 0.052073482357559084, 0.085589246289544355, 0.046276361634918169,
+    -0.06348506618414286, -0.024743127171262171, -0.030528539627143116, -0.051295645760567048,
+    -0.13455766079495365, 0.045005941894432508, -0.10657826986329351, -0.016430157644365201,
+    0.024104564796799642, -0.0097777387963033317, 0.034244249504823021, -0.076494783672677924,
+    0.029675898080510358, -0.034451423434908077, -0.0085119051271053438, 0.016527371374449148,
+    0.062901028747588975, -0.18696027825600808, 0.094322255566214055, 0.012318230301441416,
+    0.0033101325598168226, -0.088097283262863063, 0.1359394969313768, -0.034477042021582777,
+    -0.18471036383044451, -0.17122148760627906, 0.17756899423370248, 0.028273023418721861,
+    0.00032296418604165975, 0.13070459696278772, 0.11220523287959609, -0.037945650847071001,
+    0.18589201779069547, 0.094381326715170938, 0.023109700048143864, 0.058007758247859517,
+    0.22050870510268386, 0.0022614010090150007, 0.0089699989765538671, 0.012495435647856802,
+    -0.14969315136771719, -0.10067337037944198, 0.08066346096134569, 0.029123682333050009,
+    -0.024537254340712793, -0.10350572624119284, -0.078705226232331088, -0.074065278487709579,
+    0.067810630084304949, 0.10912061111704835, -0.078469860404756495, -0.0072129066890869965,
+    -0.19600992680171545, -0.021624282444957836, 0.17345203849906582, 0.046476743578346989,
+    0.0045334010244960114, -0.037110243098482903, -0.033489396540212331, 0.3355614103146588,
+    -0.13766740871762076, -0.14618041390275266, 0.027959761852134411, 0.025886056707089721,
+    -0.091653049706327594, 0.0055501598225003914, 0.040590258109466162, 0.0057545824527556622,
+    -0.086132801835894821, -0.19605907985771792, -0.11569060399607312, 0.013605747748084629,
+    -0.14332527081978924, -0.12029250081550918, -0.12063749376287725, -0.016973409028668684,
+    0.10709542669235034, 0.15438328158493342, -0.061167073981421127, 0.17306293282980142,
+    0.034864688669262879, -0.0043826386255131295, 0.056684435869163413, -0.0762653329715519,
+    0.0075556499130121687, 0.13557779505772299, -0.060815765786516415, 0.0015816934799460962,
+    -0.093352223017634975, 0.092999147895051537, -0.061657497042140019, -0.20659481221590911,
+    -0.0020015746791795025, -0.026366874979368023, 0.14317173994984439, 0.14247567258977592,
+    0.16244461932262388, -0.055687870849768145, -0.053836354809957535, -0.10906579918046864,
+    0.012351249547770853, -0.031689449187978953, -0.0015342163455296944, -0.16207370575891891,
+    0.085888266020792303, -0.056166038877602853, 0.14152692192595789, 0.038253688280155664,
+    0.027858743912271909, -0.036705049755863778, 0.023175106769318828, -0.07378500232718771,
+    -0.023983237062855302, -0.00083776084619809922, -0.018084601847800433, 0.044483685362141229,
+    0.2864901706969406, -0.055114834361710434, -0.067777576993338765, -0.044073164590177918,
+    0.028215605282226712, -0.12613061274406318, -0.11182001126759034, 0.13641676406504666,
+    0.01914278850733641, -0.024388478242669622, 0.043514333399166431, 0.09331844934619711,
+    0.03252601629550031, -0.041714288787584444, -0.0043916649552066551, 0.083304350446294959,
+    0.043871174384183725, -0.029662194182291837, -0.055648059122551184, 0.037674843048929631,
+    0.12559966663453961, 0.0085382914241690974, -0.10093562388180859, -0.092310736677430283,
+    -0.032651721024587049, -0.041660208141868361, -0.048674795816181934, 0.083679075383352702,
+    0.044028614157782531, 0.09471482625175387, -0.071263234278603385, 0.17795709750428171,
+    -0.20001895761648053, 0.16164951399733346, -0.0033716811771740446, -0.010493159952870342,
+    0.028940152339952827, 0.17946117174976353, -0.037613993041159297, 0.066150844680203824,
+    0.072713684938904566, 0.10535244189923293, -0.12725658345365767, 0.26992229785865879,
+    0.166773651431884, 0.19656890910963659, 0.0068064443491878575, -0.022164583152933244,
+    -0.0042910358848128518, 0.0016951122035824969, -0.10522882161836976, -0.073342585760493892,
+    0.06653963064860656, -0.14676306501871259, -0.0068190936122794728, 0.08430084680029383,
+    0.003786299628657602, 0.015280433050791291, -0.18576464452123534, -0.098283864068996446,
+    0.10429532361870242, 0.15660364800666185, -0.054547920437481474, 0.021689151091452953,
+    0.10732647705224008, 0.020659126401756048, -0.12951586077160757, 0.041387338065566548,
+    -0.14378492502069912, -0.07061415371371621, -0.043963087303079455, -0.078860470776812866,
+    -0.29900768931818528, 0.034564377906753214, 0.059343875531995972, -0.066516340708184629,
+    -0.11107401859231934, 0.034877290841573066, -0.012147389232412825, 0.026773313644249903,
+    -0.10929541750967013, 0.020389594175996215, 0.14825291655727776, 0.020690413279107256,
+    -0.20838573252734199, 0.12081052845750336, -0.070122454942581139, 0.069889450808518896,
+    -0.10439281810250228, 0.045661179750554504, 0.063383984946197222, 0.12188418015397945,
+    -0.031433433982566719, -0.027766617373435342, -0.087091542518197201, 0.012232730506306203,
+    0.0051369595432601885, 0.219429539463944, -0.038488090532957972, -0.064427365822788282,
+    -0.10030095773700168, -0.0081717494952185405, -0.038167414451431389, 0.13834947976316164,
+    0.059727697126039113, 0.1836347024362113, -0.033476538145151634, 0.025448742625895741,
+    0.1866916306171712, 0.052340241016423941, 0.15590735129370112, -0.013041544912861006,
+    -0.058818133762325413, -0.1121210548669325, -0.0022944376025331296, -0.065713350856333272,
+    -0.16146807557945755, 0.023258674105754093, 0.095071422482382151, 0.058185913255720006,
+    -0.016909583102622017, 0.037246259873172413, 0.051791086844140438, 0.11090123266763084,
+    0.020230268515389158, -0.12689578640792384, -0.016964173047564781, -0.010217134362726048,
+    -0.13353351026065563, -0.018276092385912206, 0.0046732553260558588, -0.083696015766522067,
+    0.0097992852890525072, -0.15386694741074547, -0.055020082104466697, 0.18585068410319985,
+    0.069678195448542202, -0.078538461881474772, -0.1072382292851931, -0.0037558394214342733,
+    -0.02860367330049466, -0.045516120956971058, 0.01969996940035082, -0.15953168921192001,
+    0.087826967331308639, -0.092657258548218394, 0.089893641998684992, 0.079740718815074108,
+    0.076591081175288983, -0.20478805636871406, -0.10896883155074764, -0.0055325424385586517,
+    0.13580656015608714, 0.072953082543991812, -0.016890148110458383, 0.08508498126531451,
+    -0.11843288729352608, -0.022150138057266077, 0.086889852141301613, 0.05441799859391757,
+    0.069727873823525924, 0.046258122388500078, 0.0034461724639970126, -0.2055497374666285,
+    -0.13289130283181314, -0.1463807762574669, 0.017320796275575673, -0.010259328761053645,
+    0.030117077223627518, -0.14310646185013118, 0.0042954657063584744, 0.069232950214936431,
+    0.039528202491459413, -0.05291384241492067, -0.041602909885784523, 0.018140034964538022,
+    0.1034362674908571, 0.0021676902597450661, -0.02179169160974808, -0.0006091050333874113,
+    -0.1028319790495157, -0.03020634163343484, -0.0072563854247082284, 0.15987042140270391,
+    -0.043180389655440771, -0.19829682550893671, 0.0078522222737363451, -0.023177353473367683,
+    0.084878902350163973, -0.05792742949835944, 0.00424505578656445, 0.049974571116036315,
+    -0.061287875917344074, 0.020535266895190446, -0.016445766901647334, 0.093173062023013092,
+    -0.08854531058556861, 0.15044913399362059, -0.012995655902795186, 0.0076455844981513782,
+    0.003131731253477316, -0.13440702352336023, 0.043415576849017548, -0.21892264598031402,
+    0.028819215360331742, -0.0036490707320382923, 0.080298336261396819, 0.082265869806789918,
+    -0.24147341422245516, 0.035159468427813693, -0.064714360999963028, 0.12305249913570991,
+    -0.10638163854194138, 0.1085732040203468, 0.063027898373173089, -0.123693271188219,
+    -0.12977319612282476, 0.007647479445211396, 0.054524822640426525, -0.13502785962269945,
+    0.025824643913455351, 0.0098156438251764885, 0.070525044244731508, -0.033656408494956803,
+    0.027282488850641124, -0.20911970113094736, 0.014714292291011545, 0.0087333008655769706,
+    -0.10079145009952789, 7.2520124183356026e-05, 0.05340091188344015, 0.045176402907381688,
+    -0.098581259926242629, -0.030021219574628728, 0.09706071033017788, -0.048658122572853964,
+    0.065086932084104293, 0.0079796196277864117, -0.0044536677672247218, 0.13440842002941736,
+    7.9141590780910879e-05, 0.0055071570298053105, -0.092338440538489677, -0.010441674616792655,
+    0.077178584484659474, -0.008845500335015381, -0.095098222697040088, -0.010921064658029757,
+    -0.22840962816152616, -0.099659429943547123, -0.079307453825850624, 0.1805583082274331,
+    0.23712733075248763, -0.25612602296351317, 0.24775828247256995, 0.022532991455582106,
+    -0.003590184100556395, 0.16736641609829131, 0.13845149536194618, 0.050899520014330971,
+    -0.11749182565442301, 0.04352599124472073, 0.07105555599000421, -0.082745765382714054,
+    -0.090848623068180201, -0.089739240220488514, -0.013745355962157372, 0.010876146437608628,
+    0.21103016816311224, 0.14129730466917989, 0.18349686152508493, 0.018163507806058219,
+    0.004612130199733765, -0.10781336944541083, 0.04003676255671574, 0.058653028138144152,
+    -0.06810269147097564, 0.0064517101868707604, 0.10572641021910824, -0.13153997850443952,
+    0.026971032084443021, -0.060178313018141361, 0.053212817424165143, 0.073735185211733403,
+    -0.13296190711967035, 0.098152499679401095, 0.17441896247423852, 0.12202432969473186,
+    0.037481270063043616, -0.068219865927646464, -0.1241644504346951, -0.10508955032214298,
+    0.1217893728564993, -0.067806403078953109, 0.21929021780795518, -0.043652471435948852,
+    -0.13045322988580882, -0.022283694365017169, -0.12518412172120622, -0.079682910203329779,
+    -0.062904873563323679, -0.082166699191991793, -0.0019916720552464367, 0.11242966716389949,
+    0.03386759834303657, 0.14482587550867909, -0.0070577223000410066, 0.016972967555282426,
+    -0.083354546145123012, 0.042762062939404405, -0.080999258672027563, -0.069630476827210561,
+    -0.14107835788023956, -0.055589251438175488, -0.082724895872732782, 0.1203067946446563,
+    -0.13658416448678712, -0.065298867993239113, -0.067206620664504182, -0.043508496697337522,
+    -0.080837645606696623, -0.024592561881041718, 0.067068603264925003, -0.10815747890849087,
+    0.10540543092746482, -0.086680804597664002, -0.018811692013802405, -0.014650028805339138,
+    0.055078614073742399, -0.13121019656358565, -0.21076435484711967, 0.010802559552315679,
+    -0.14115316694131563, -0.12816804454879757, 0.042939982991854524, 0.03040617715782051,
+    0.0094511461439347397, -0.052240562142611087, -0.33475259168445676, -0.11176137679428626,
+    -0.086811049423521164, 0.14398002876969135, -0.032353757148342321, 0.14400651886235311,
+    -0.079310624149574363, 0.093772977130843399, -0.018137456998993839, -0.12682083878392897,
+    -0.044209035638272866, -0.14933500899048341, -0.026185411108179991, -0.028522134966145321,
+    -0.057859196872252543, -0.02981484062257693, 0.079251756652796962, 0.11211453867368666,
+    0.074231278617143542, -0.17934861638418126, -0.028978914678163523, -0.27046579689361189,
+    -0.029056492455447037, 0.088134474345818878, 0.0062699719121546427, -0.018768906328286324,
+    0.010228814989231744, 0.18119657759943278, -0.15318568730980114, -0.0088296252850831695,
+    0.26328818114158054, -0.07063561581219259, 0.0047713525226092384, -0.053175934193936417,
+    -0.065820914110756579, 0.099577877670881457, -0.05281895681857348, -0.0049823235347861081,
+    0.0044668882045217975, 0.099246827086118483, -0.13665307844254512, 0.074918617649571889,
+    -0.083871485745539875, -0.089826957110004962, 0.20218503116036063, -0.1249997386427459,
+    0.015686423798186726, -0.022288900093832619, -0.13786078452657699, 0.054651503381795925,
+    0.017500082093989212, -0.019899986431318049, 0.020976390884094972, 0.097984872077768195,
+    0.26302559754141241, 0.014205061135351063, -0.089063310378211205, -0.034299090771350189,
+    -0.16719847194531093, 0.037337359649454012, -0.022110060365902753, 0.036834803816166779,
+    0.0081665296790428641, 0.026901174845834808, -0.058874234192708368, -0.0019959119528635723,
+    0.013933130326063518, -0.13034342567826232, 0.15564679412642712, -0.0019088135266619253,
+    -0.059593359295966812, 0.0085411540259093064, -0.035296547391396822, -0.13817141078727568,
+    0.060752871873320582, -0.0028906307399624515, -0.14181268740741892, -0.022067657437442961,
+    -0.13526326177564035, 0.0025539234363894346, 0.044622013448013267, 0.11982708642865707,
+    -0.030428589105938843, -0.01660985629771974, 0.055915336208692622, 0.096005560627815276,
+    0.016792009493209997, 0.10336873492887781, 0.098861396580404992, 0.21722671525803944,
+    -0.021830518211949632, 0.021630463207830609, -0.12572986015813015, -0.10865718227912041,
+    -0.08111002191080699, 0.021425583397997851, 0.098663540236863412, -0.017029305539949545,
+    -0.070650746349246216, 0.023105337372979498, -0.06189778438071393, -0.067514089148540166,
+    0.081399346133877226, 0.10730583624385871, -0.14896813901269831, 0.050749360178222389,
+    -0.02733054183235362, 0.051066258567957303, -0.092511442268137706, 0.13571539286947745,
+    -0.23458110016717396, 0.085477261241540384, -0.076549679348555, -0.046089706041231984,
+    0.0039475928982422781, -0.15038873171531736, -0.0086625234574113398, -0.030586756609901705,
+    -0.031036184570394709, -0.049683461014684759, -0.18074894306396411, 0.054368785271815684,
+    0.076740305334956016, 0.013745950024569284, 0.15677248097556234, 0.091336565527392194,
+    -0.047163537781122554, -0.06508387674513981, 0.022864143199046779, -0.029943750943401834,
+    -0.079941320428971577, 0.061020961055613845, 0.060325641233632474, -0.082145747717405015,
+    0.2398310327939179, -0.078758515200612444, 0.019528984237207777, -0.097020882417584067,
+    0.0009598304983287273, -0.30557390341468177, 0.015848231699550526, -0.10693680751492454,
+    -0.038448495716211915, 0.12033018018140737, -0.20325585633026017, -0.098075978049693341,
+    0.023675751104831153, -0.039132228701981041, -0.10330769730698153, -0.035578149403653857,
+    -0.13684971557108433, 0.066095038604147768, -0.04134253801887891, 0.058342113300219038,
+    -0.00071849340425638776, -0.07927136541029825, -0.085106354983407628, 0.15110230359305832,
+    0.02077183636687404, 0.014334860581413393, -0.15262932376301527, 0.034588679970174445,
+    -0.047870022572578032, -0.015211576949417941, -0.14751669259716232, 0.12500916677726406,
+    -0.12854592677979809, -0.08558230643600101, 0.053888149594010143, 0.21535086186720892,
+    -0.0081182326848959832, -0.023426210660458933, 0.06837522200013299, 0.047070781457281198,
+    0.17976033006813266, -0.026797707027262092, -0.11745436643046187, -0.0099403996648091738,
+    0.13577135425986225, -0.14120330738172504, -0.31674695378195528, -0.097099290813122824,
+    0.038831686162345905, -0.031030290989234963, 0.055105343997397721, 0.071856701741558865,
+    -0.13475487000684749, 0.033091077010182227, 0.024707867403843169, 0.10388899636580659,
+    -0.23052207691895202, 0.14442647632787337, 0.1025750204135995, 0.046499852980862233,
+    0.064521362863510082, 0.18023274588463412, 0.012201318211534449, -0.084866092869101059,
+    -0.14049877682977649, -0.0039938216155258359, -0.015461461250953001, -0.019743447779580411,
+    -0.23501338565370589, 0.020714550892573284, 0.058514374814327634, 0.15685212144844257,
+    -0.14156553843829334, 0.098092588318724278, -0.034698319856420155, -0.039715255178260016,
+    -0.21953114993708067, 0.070393032769293012, 0.032406793515545859, -0.13799425968284124,
+    0.015592404647517263, 0.012586850910886051, -0.077912458201560827, 0.16277221084008883,
+    -0.10085979452126746, -0.040666325961191657, 0.077959830725015347, -0.0023531846438632868,
+    0.043685675647966667, -0.077999483025496086, -0.13306008481287571, 0.18344268571229602,
+    0.037000435792495533, -0.016623789979878643, 0.07700873116170788, -0.15290755570508663,
+    -0.27149352726394177, -0.034819925256438899, -0.031803195370030311, 0.13936512941333243,
+    0.032877738815871214, -0.10569940915328586, 0.093869713820988687, 0.11576663992922166,
+    0.027345015709707987, 0.0809037090519103, -0.076324769198899592, -0.0466675072598631,
+    0.0061842758690147355, 0.088894893191586943, 0.19281658719175457, -0.24780769843273598,
+    -0.023874072836221026, -0.14213124516335071, -0.11927580529078979, -0.091222217096893932,
+    0.025322740026513017, 0.075024794364253022, 0.019201128614192972, -0.0090043530727736826,
+    0.028802022384874539, -0.031346640809687902, 0.047994051581574243, -0.015845169058468431,
+    -0.0236777583855006, 0.24255745709737228, -0.020396566501964874, -0.10409125271462019,
+    -0.13498160742957929, -0.15187435125907434, -0.051708105364659251, -0.010529141189495517,
+    0.12558559259178639, -0.00054747068834296118, 0.02534822834651676, 0.014352613450848022,
+    0.031505033787378525, 0.052474445069738092, 0.20886544018084913, 0.092979690632133544,
+    -0.040429480458315799, 0.12062168086196901, 0.012637043876578505, 0.083786395721118331,
+    -0.08240422636362621, -0.037159244942115019, 0.052988531076329275, -9.3107315842356678e-05,
+    0.051589245042352863, -0.14295664632973812, -0.13279215999814484, 0.17122726065812938,
+    0.15514507046829018, -0.23046746324232897, -0.082442493555651961, -0.055172248518866859,
+    0.051369448726945682, -0.19892116685518343, -0.03440998028244327, 0.11386903929545714,
+    -0.13026450732675546, -0.07029440882700598, 0.090951687072745036, -0.14261454346763122,
+    0.081142792607570444, -0.033428609157842105, 0.069592946527636521, -0.10026149281568479,
+    -0.074958218843027641, 0.056345806490509825, 0.019717799689465604, 0.15498701024737194,
+    0.10598313790039267, -0.047564281424447054, 0.079552751329225069, 0.12836712081001911,
+    0.15802201004630068, -0.068146671778940821, -0.035970635439491937, 0.10250012868830577,
+    0.021916345328538447, -0.084991014900987927, -0.00024547416507419496, 0.018479958230324386,
+    0.039057936125299973, 0.078016601354086182, 0.064471512519659366, 0.11070131404526068,
+    0.024482196107393862, -0.072759581512096425, -0.1517425028179066, -0.017250625858030028,
+    -0.12546164947130362, 0.023181296069951913, 0.050404889464022926, 0.061351636521158284,
+    0.070450973034871869, 0.055996335453576115, -0.08827651545943295, -0.029812526993956878,
+    -0.0059687152464743968, 0.18502801379314918, 0.049943991247272779, -0.040993292512145292,
+    -0.093146545865972319, 0.080738732782118405, -0.059142894914796455, 0.046455492516870957,
+    0.037261409443812073, -0.019013599818596322, 0.12748392055475596, -0.051733813004124884,
+    0.074491395786925749, 0.062346434138876007, -0.11542965625928205, -0.025866493534768782,
+    0.026380712476829396, -0.13447915027316107, 0.10589210891788275, 0.29802553659868547,
+    -0.044298530499899673, 0.21950187652886621, -0.013189081845162513, 0.14019971064771061,
+    -0.12290447956449468, -0.028335564587270209, -0.015095598768464839, -0.042203087239033495,
+    0.18640417124130282, 0.051054743338716485, -0.16865819016975689, -0.015866725278231891,
+    -0.16627459569452183, 0.037893514348100024, 0.28102034820612615, 0.036363001243909815,
+    -0.02144604239704918, -0.13260545911941382, -0.10931380837641419, -0.043412856856696484,
+    -0.17091226331223308, 0.054175176966222871, -0.2142069989169112, -0.031323063722183263,
+    -0.16755657810058178, -0.077715046981775796, -0.3167355515529468, 0.028963534388047246,
+    -0.016954331440079448, 0.06338638800601501, 0.048669633932988454, 0.10075304829520092,
+    -0.04739032995749537, 0.024479771406871517, 0.13784314947921184, -0.052745750552829047,
+    0.038972361700205474, -0.088185200392161794, -0.091788816482247459, -0.026530242266090555,
+    -0.025517118325332031, 0.037576801348066444, 0.095788192139999589, 0.18064373712988022,
+    -0.074814130809271684, 0.067613755262257907, -0.064765346971377577, 0.15606648427373659,
+    -0.020208822312941362, 0.077604962311114203, 0.0084529299814296924, 0.05756078633842563,
+    -0.044536181151874479, -0.065748264716048541, 0.13272734811566253, -0.045426506766165754,
+    0.14380076905156586, -0.0019169543583393326, 0.063304374542996061, 0.12664367950243227,
+    0.0082102812435655408, -0.048717855111140101, -0.10526233739259259, -0.11377391172643651,
+    0.12312200875042445, -0.13739603966466568, 0.1019859062298679, 0.011245644464269094,
+    0.065211395889820153, 0.092223331281724247, 0.092702841370628786, -0.10254634711435212,
+    -0.010639819086759983, 0.093469704448281912, -0.10489440510810906, 0.14620654434145317,
+    -0.027226986024173117, 0.15584849496342806, -0.14066667079906364, -0.090828204011745656,
+    0.17341411374324919, 0.1146849719971433, -0.059366824126320078, 0.1673103436419616,
+    0.17204094462439337, -0.12261927436125834, 0.12091765156157384, 0.072050653923932992,
+    -0.1618529085150697, 0.03748480808617112, 0.044233677156709214, -0.041982125086173966,
+    -0.16358637568103346, -0.057332811338593664, 0.089648532056791963, 0.10058041809840029,
+    -0.0074854207750176538, 0.22714135719875417, 0.10506782373454458, -0.034188814060046577,
+    -0.030632161490074587, -0.0024067335495762932, 0.027246276503490371, -0.045659611428239426,
+    0.086615573951641128, -0.049558771897545664, -0.14998971006775924, 0.09223446277232257,
+    -0.18462474210380855, -0.34145775279478391, 0.051514612321901292, -0.043650895409532785,
+    -0.062131333513668924, -0.10394121147155415, -0.034045355791182626, -0.0013446406983687812,
+    0.015548026868088613, 0.057604987441240964, 0.15542793713178532, 0.045735561162734674,
+    0.16663595062323866, 0.068393733903429316, 0.0049421343364440306, 0.013505412982723605,
+    0.077729022804407355, -0.053104508974505908, -0.066617765234362122, 0.13877824509763365,
+    0.013663897948791994, 0.032222978064633374, -0.070173628971145027, -0.079750211629986176,
+    0.14730556869177122, -0.13229123484070027, -0.177833440343487, 0.0065174363897638424,
+    -0.11652639881180267, -0.017485806509515832, 0.13638120695446018, 0.114800075202574,
+    -0.15518237152445469, 0.083389977718806491, -0.049623855529138582, -0.10319143367611681,
+    0.076722776791532388, -0.028631116941748927, 0.090348504450726203, 0.070993401726421809,
+    -0.079482566363348439, 0.01967630362299902, -0.0082475059127163578, -0.10032184669661487,
+    0.079278685837774671, -0.082721828369533554, 0.1567157515298401, -0.01094289206919951,
+    0.17620758971585698, 0.088866706845458485, 0.10647479182951732, -0.057753028784262903,
+    0.074659787968581762, 0.016061056279654363, -0.096130361544015969, -0.31567874969993492,
+    -0.11316719230601593, -0.16998871599310814, 0.083255357023388959, 0.11812428441450507,
+    0.023042305319483192, 0.048934718861799439, 0.16106830321173748, -0.095910124183622048,
+    0.086746841844501155, -0.063469614457510773, -0.090399274470876229, 0.053418833241463376,
+    -0.0039634257577260863, -0.053883984779139499, 0.018641260260731315, 0.012864529494375995,
+    -0.15926869301341365, -0.028062826673473696, 0.07550846361330979, 0.19225318080378984,
+    -0.020692081528368905, -0.030118946705599517, 0.0079048636855312774, 0.23588215697282094,
+    -0.14130528674060774, -0.017446481830761827, -0.028821328300350588, 0.0030367165042738931,
+    0.023661228548221329, 0.11013035976343438, -0.12103173021864932, 0.10748288760284094,
+    -0.11497492096346412, -0.013411495788389981, 0.024229907507788091, -0.013528824063877511,
+    -0.1055964490587419, -0.046241084404577776, 0.022476559269769682, -0.13416929657145593,
+    0.035329137685729047, 0.0092691479040529212, -0.16412314335324807, -0.056786023965309421,
+    -0.050910839220677864, 0.15436236813265411, 0.051862670125142563, 0.0082498900123014213,
+    -0.058082811755280725, 0.0048749631873874844, -0.022311557450111059, 0.084944081456682988,
+    0.067697344890512767, -0.013866347174792081, -0.06423090176733319, -0.10333380183254735,
+    0.17883090241039221, 0.080193026296730363, 0.089857300526496639, -0.0081913444117090815,
+    0.15551268682053088, -0.068529783836652619, -0.096846183071639114, -0.019287796281951999,
+    0.032553481094826177, -0.10414043725632477, 0.044797856561986177, 0.0051260486162604821,
+    -0.12823396996300324, 0.08812355366542636, 0.025788217219227163, -0.054381912545029602,
+    -0.045601837002891631, -0.067544431616345033, 0.09558982019423358, 0.15785092914806279,
+    0.019249301566916451, 0.016396802250606232, 0.040681014553182293, 0.27980284773451192,
+    0.027400360671108764, 0.1738040696746061, -0.032249899018329781, 0.056642117035314049,
+    -0.10093626802847293, -0.063427833098859035, 0.089205438074248244, 0.11385000955719311,
+    0.078548714434561642, -0.042314923461031204, -0.01709587199465808, 0.044328781850944451,
+    -0.038017344083297058, -0.053637711388794876, 0.12341168431568153, 0.06331901151577897,
+    -0.0072207515646235806, 0.0075861415052696293, 0.082479204280099638, 0.013007735294090829,
+    0.10371837957629425, 0.069296052277445744, 0.019978793200663213, 0.16403981728181288,
+    0.019277174860160628, -0.072293903820332683, -0.072011967858735287, -0.1408418495217903,
+    -0.086270133806622532, 0.27004274522773114, -0.021609564316152893, -0.13187338470301169,
+    0.035689323778793546, -0.091694160330569777, -0.021847753609017511, -0.13559541992131646,
+    0.0075746323962294334, 0.055809294542583078, -0.053131938156913472, -0.041456353050154764,
+    0.10934246715799126, -0.044186919011786695, 0.030268732936755038, 0.011659440930433368,
+    -0.16042190425464736, -0.092316505689623046, 0.16452310804087103, 0.098755516914034502,
+    0.033763496143406221, 0.24597378888671809, -0.021946367048988894, 0.17730622862640849,
+    -0.088356309371755648, -0.093508528355177339, -0.050707357176207439, -0.044186248504948927,
+    -0.10768256343646798, -0.077682204628825427, 0.065265791313344229, -0.071432824492289979,
+    -0.020458920800391314, -0.02692483494814768, 0.030780601877211194, 0.079470869110749201,
+    0.037448351341047882, -0.014913032108906338, -0.021392106141947725, 0.11246505981359961,
+    -0.14365779742821658, -0.10661021446832128, -0.012478620900866171, 0.17042585190610904,
+    -0.029530424137515422, -0.083795098090083814, 0.0040129769227332133, -0.010192679304457192,
+    -0.01865805745107418, -0.1850583618869209, -0.00064101635522462381, 0.15066997339927532,
+    0.17933268705534883, -0.018692620261466533, -0.10740789102154923, -0.037161471526115666,
+    -0.16588949780118739, -0.048199003053651525, -0.0077861639082206129, 0.0048038319727208897,
+    0.1145497454973845, -0.054227808033832495, -0.13455688908875893, 0.041905454144072589,
+    -0.020160972846066036, 0.023202536755716149, -0.21283369820726336, 0.0084196002247194975,
+    0.017060039764527017, -0.18070940260307966, -0.18381815769182458, 0.069730148969172068,
+    0.10896798766402058, 0.085752456491778747, -0.16289089539010104, 0.017965814240822331,
+    0.056922448947676438, 0.22035455139905333, -0.16589415715779171, 0.074449716021410581,
+    -0.027671433175701809, 0.077937224406207706, -0.16220861362386491, 0.021926591942740832,
+    0.10596492743363371, 0.055261724661664943, -0.048666733319383364, -0.079232077542372978,
+    -0.062870252261211998, 0.0066502366613173667, -0.022893978598482689, 0.057564092235283297,
+    0.04693021754032696, -0.15419485076147021, -0.1287743199194343, -0.067907680195506276,
+    0.011026225708151526, -0.046300892281438868, 0.091294125473578833, 0.00094717977188259282,
+    -0.037040520206635993, 0.19463018086254338, -0.091721204008543472, 0.020185559766348813,
+    0.163695650863035, -0.092862078487967556, -0.089335235748418867, 0.013722790067694418,
+    -0.016237003601444876, 0.097038662017656624, 0.054891895766141424, -0.15753942763109813,
+    0.072124021022415191, 0.06875464783726655, 0.14099542722097513, -0.14196825259535478,
+    -0.04645734133594099, -0.062497203443730602, -0.013493107894157036, -0.0049599587477005443,
+    3.2322827909073986e-05, -0.089888937382442857, -0.013216971083160075, -0.010993982516648623,
+    -0.032297431207196886, -0.020750325193100255, -0.084815407575571169, -0.079998698560644357,
+    -0.06894785594038208, -0.13359945045705582, -0.018227163924605199, -0.033399381164967962,
+    -0.13489898477912554, -0.068673388026003188, 0.10850067581322459, 0.054766417769235458,
+    0.014955414375992638, 0.078394785659087807, -0.076080481513833467, -0.13911011087131603,
+    0.067132341843774881, 0.024318466508502012, 0.13542794251865328, -0.037195944410552122,
+    0.083759295217436427, -0.097968289509129849, -0.014942522559657246, -0.12164612960075594,
+    -0.17948460644944952, 0.12850334789244514, 0.11244166666907637, 0.13872918699350834,
+    -0.10177306575231676, 0.20048717209821604, -0.050214495124056915, -0.12956728656011557,
+    -0.013453418447810365, -0.059421767987625274, -0.03460937325717376, -0.073431581910925844,
+    0.059398861581164565, 0.21797417277439124, -0.13395396568295009, 0.021218410116997214,
+    -0.14753817097239319, -0.065085231189994361, -0.20999497166299644, -0.054223701272629023,
+    -0.088426968563143277, -0.027701996634589398, -0.074014009812235132, 0.0098273064526759463,
+    -0.042851232744554622, 0.021490622501666171, 0.089195882270016236, 0.020388494799864657,
+    -0.061567704311934847, -0.072145378222410891, -0.14603484694980284, 0.081103639973449243,
+    0.070838347530869081, 0.14005091736949768, 0.073682662514252165, 0.012458961541342779,
+    0.02075660825517317, 0.077927016955192663, 0.15336386756030015, 0.14709456110188601,
+    -0.15369655582137165, 0.08662341670695782, 0.087358993881630598, -0.0072693846019105893,
+    0.0089442774626848336, 0.088338482299095564, 0.12977725789662803, -0.030747323513759996,
+    0.038211646680327054, -0.10591245060521004, 0.030605530422059265, -0.052320178173309986,
+    -0.024815854168079937, -0.1780251508381393, 0.071231772260273635, 0.13379362935390801,
+    -0.042948652348854748, 0.07966804119757484, -0.080101028300841315, 0.13317058341620658,
+    -0.12683277995323569, 0.14614851689999322, 0.00080055221007629745, -0.064845058613180059,
+    -0.088364772159246902, 0.092332105602751915, -0.071594284303556674, 0.089556903530182169,
+    0.15989945765639535, -0.1539836789138358, 0.066010093766007458, -0.10313246426567567,
+    -0.21511065818304939, -0.039062420057612818, 0.02577172226775009, -0.041846557228465017,
+    0.05005537455123063, -0.038009087855950682, 0.049820205771468243, 0.11174522041441674,
+    -0.17406414102780163, -0.10111113015278186, -0.10763016429986787, 0.065261927542445697,
+    0.028519892065023228, 0.10419541431174242, -0.0031753401370289351, 0.048016452794261089,
+    0.080097400072988739, -0.045218372175893418, 0.032191837639102244, 0.1268564262180418,
+    -0.12875291130613259, 0.068018187305409636, 0.088937609144482441, 0.058184623578171474,
+    -0.033622000840141712, 0.14313067937415741, 0.092082355822567644, -0.18436458446143089,
+    0.15390787240423137, -0.042360074409291751, -0.06127646741040961, 0.067573681802467284,
+    0.047392055975773277, -0.011661412615791532, -0.0041567697081273981, -0.18837475059237763,
+    0.049203965592838496, -0.053511563544526908, -0.0013101321662097071, 0.043612592960633217,
+    -0.0092956437967075291, 0.0023204150688341811, 0.16656977782033575, -0.024999054121197122,
+    -0.25098916625565759, -0.01809968012506797, 0.10587607288682915, -0.025777018055239392,
+    -0.0091862328795764246, -0.077908756841179497, -0.036637228788305908, 0.089508638184006284,
+    0.10577862628350802, -0.11806758257119573, 0.23721077952443459, 0.13579038708285107,
+    -0.035964404430265065, -0.10221357755759425, -0.11210188681558542, 0.15057210066537341,
+    0.15503801632446867, -0.030966681013494868, -0.18374060776969681, -0.057402969108781135,
+    -0.061963738462613424, 0.098812707623313664, -0.038534401477646647, -0.0055790198283440472,
+    -0.090766336606735137, 0.080908958654834551, -0.0057562590870157311, 0.077069167839911301,
+    -0.024020560265469476, -0.002567144442998397, -0.069286450750744327, -0.02580084069645313,
+    0.10823585330941898, 0.075662693582759677, -0.13208141404305732, -0.054372267092935959,
+    -0.064021436508984411, 0.057912499303517315, -0.18819999001000517, -0.034535182109867495,
+    -0.01545607164223107, -0.021861194501909903, 0.03474060339069078, -0.033665074069651503,
+    -0.013331323615281372, 0.093608628731574661, 0.018983634102706058, 0.0018921874780973606,
+    0.075535444329691892, -0.19483101135206637, 0.11015344428991578, 0.0083351278262007496,
+    0.021483781391108625, 0.17040222099731461, 0.1463651531182463, 0.1565227037887541,
+    -0.045181560047537143, -0.081531529864404623, 0.10021714002352611, -0.13785843421615487,
+    0.0062947219968733734, -0.058682553781414973, 0.10970422368928473, 0.042234963171556235,
+    -0.0080865328088834502, -0.12387975754896831, 0.014610135217569806, -0.050518378763267001,
+    0.046794192969946795, 0.12422500234369398, -0.040431871009983238, -0.026634945520792857,
+    -0.013787901883853471, 0.10493031754564219, 0.080512910824500003, -0.084155525693984323,
+    -0.047783310584551063, -0.042623244423689546, -0.10887684446258562, -0.13785816984733859,
+    -0.12012584493418269, 0.10836638659392311, -0.06854069395376676, -0.072545755271085366,
+    -0.055079156379980704, 0.018446837077206946, 0.021080398378441261, -0.057316337585845215,
+    -0.14266972905379055, 0.10977081516508544, 0.098754424132219965, -0.11404516554423957,
+    0.043715755540773692, 0.096430153681285838, 0.11882587211167481, -0.12197686170266714,
+    -0.09070141384347738, 0.074126497026044222, -0.038104031558398824, -0.055108117417795401,
+    -0.057881590641426915, -0.014268331840477343, -0.035865519488145224, -0.045794023911940533,
+    -0.12077086750927465, -0.10001487982976082, -0.090894925694834053, 0.17715704243622149,
+    0.14152600312436636, -0.010747950165452281, 0.025424398614619474, 0.042168233673503357,
+    -0.18274114291264351, 0.0061017457864401096, -0.041006413497727136, -0.10193443087564684,
+    0.070229187120425834, -0.18103330198565637, 0.00083342934500661465, 0.13268898289458048,
+    0.01537759797021695, -0.07520612324104968, 0.027015966386246967, -0.045848639881098184,
+    0.061754663820807028, -0.1975210126221785, 0.082667415422388313, 0.058970379306340956,
+    -0.033887376296895498, 0.00070761991397948101, -0.12526861115691224, 0.0052048159183151537,
+    -0.044431133690716121, 0.0081426300755578374, -0.035319780457182752, 0.035054733726367915,
+    -0.083344980944340813, -0.027429884609977199, 0.013508610457481533, 0.10371153927943873,
+    0.10291493569212896, -0.096242714716224517, -0.013016384193837343, -0.040293074739285444,
+    0.032201194663236898, 0.022467809620615203, -0.089232497041552089, -0.066610474486917204,
+    -0.10132675128885618, 0.0004180998465543325, 0.096216540590625163, 0.0097281972193095263,
+    0.090379246973764676, -0.034763434781561027, -0.02224830303243169, 0.140746985984332,
+    -0.14414948806814007, 0.0029661425373781495, -0.094313031627379848, -0.23722225624723914,
+    0.0033789252150068115, 0.16682492497487258, -0.0070725252299156339, 0.13487413071875839,
+    -0.047899437727541891, -0.16207996529112642, 0.0055869627697536089, 0.087578584127700268,
+    0.06090285432145974, 0.15798567514753462, 0.1778194838685361, 0.074906994863404436,
+    0.066007429209419807, -0.012130332824457945, -0.11752056883177669, 0.052092744244654314,
+    0.16327482174525057, -0.0056208406279234149, -0.0077364070073838677, 0.07206004988718874,
+    0.020715162051252737, 0.0067491211183325281, 0.15195381247975548, -0.11117837432456396,
+    0.039354988012558427, 0.09903827851314792, -0.011141298949266064, -0.0084374174045948099,
+    0.1441554197029111, -0.020459717427512424, -0.11335715032375134, -0.0097695283891839936,
+    0.14486349128175541, 0.10781716513217919, -0.050852717283334362, 0.10911639449691475,
+    -0.011823273201044208, 0.024687641857097299, 0.052783376262375975, -0.16666926325693296,
+    0.059116011017653403, -0.0058497461852185248, 0.02810059666733818, -0.099910800642181705,
+    0.13350261675505098, -0.082441548325233135, 0.048691355452110584, -0.12853751943859767,
+    0.1173719474373507, -0.13266942855995539, -0.10973649021758783, 0.15593040403820094,
+    0.21513815736853301, -0.071062222470963859, 0.16349852437296974, -0.044319185212470601,
+    -0.13180108722468795, -0.04821600982390363, 0.064929066092677595, 0.052349582225419362,
+    -0.061257411048650165, 0.027506375523424595, 0.096880948240016168, -0.025692672612419473,
+    0.064105786996633551, -0.043507722657331452, 0.040508219936611828, -0.019265255455724151,
+    0.044010615604915322, 0.07918090367822489, 0.034421037919335963, 0.03396930353612912,
+    0.09535751469828023, -0.042128431968551677, -0.13631165080522348, -0.060979051569661852,
+    0.036684211835464588, -0.037330419246216724, -0.038298493715915684, 0.02960681603784196,
+    0.039003270432745873, 0.038773026920057067, 0.10755939905541845, -0.025590525758740032,
+    0.087804135835479483, -0.029003261268783265, 0.069332168631207253, 0.085872594470635943,
+    0.026053174096645242, -0.019194748231029811, 0.0743757148793774, 0.016199720091780043,
+    -0.1316430522613353, -0.00085101873173694246, 0.18103095873883368, -0.076714081073394183,
+    -0.040887466195903624, -0.12438764670037923, -0.058182444153349652, 0.11327298127158342,
+    0.039401106189265116, -0.048010532878321091, 0.11652545551617828, -0.044153424506823823,
+    0.0382467699160427, -0.061345410331409313, 0.15024460384953897, -0.08561968160584052,
+    0.13384940720473681, 0.15671910414428991, -0.12663312893899389, -0.091089675052164226,
+    -0.11602158939819689, 0.13915479449643176, 0.060307712355901801, -0.20640033117151912,
+    -0.1603802026279057, 0.025076912788899192, -0.049004448240043422, 0.076882960791270522,
+    0.16687692880606461, 0.1251704468184015, -0.040088249446598001, 0.10341019000471546,
+    -0.076230994276240444, -0.14267087536407105, 0.0035339756993554888, 0.018599318033722598,
+    -0.002687383545368063, 0.066930186630356978, 0.02981341921301537, 0.028555458227708583,
+    -0.11984843134118457, -0.14254525236652649, -0.13906647029261851, 0.047374186888168822,
+    0.010429873077611845, 0.049379985316522872, -0.0534722281381649, 0.11488090928221532,
+    -0.016862551289984137, -0.018564812583520062, -0.0079545073383091702, -0.030154469843045255,
+    0.13331141918901374, -0.083917178267044229, -0.046695276598080961, 0.005026334460812268,
+    -0.15452671007704089, -0.15029936192006346, -0.0011031511990710549, 0.20794300630231874,
+    -0.046371863311467795, -0.0044358325596220256, -0.10630245070788097, -0.077435341035830052,
+    0.14734262165598527, 0.19674565350761147, 0.01861026251310989, 0.056441037274326408,
+    0.012365118044704696, 0.069486114789504477, 0.047502092111133778, -0.048002866810326082,
+    -0.059315576278963077, 0.31174538949713793, 0.12419537228440336, -0.026167763937470983,
+    0.038778464306160602, 0.17404690963727126, -0.008069359839146353, -0.13143644692861334,
+    -0.11031264886653072, -0.0721060270090296, 0.015869554730991831, -0.083207727823797331,
+    0.094764004708032576, -0.015424347231080117, -0.043239732922535259, 0.048797779430200916,
+    0.10360629386760564, 0.074748767854339329, -0.038067631914645718, -0.063528025874581867,
+    0.11151108654698548, -0.082125433804802708, 0.0043897051393306328, -0.036842376276947031,
+    0.069849487334028001, -0.12557685048778719, -0.0098531708865223448, -0.074736873463354239,
+    0.025873997588775614, 0.10233988479110925, 0.002087916836013786, 0.10317738285152933,
+    0.05414935230981488, -0.14711248625331461, 0.024093082447012717, -0.011118227484965666,
+    0.081180410798158645, -0.033890152050460066, 0.15299074273453733, -0.084212948037992633,
+    -0.035951978704923102, 0.20139547002547445, 0.12079176833084725, -0.12115391661307709,
+    -0.29266416103906229, 0.06140007166833631, 0.049159872777300592, 0.026015622740540346,
+    0.069551147424752352, 0.1579385936058626, -0.044312274953428536, 0.11768098962165149,
+    0.18814814120173554, 0.014916064376556256, 0.18432996107967184, 0.26592575799754958,
+    0.053898644308147316, -0.060225416270806964, -0.05989421692754672, -0.16225051479268168,
+    -0.021831431156886291, 0.077818562519450032, 0.18617937010369448, -0.027369803249112173,
+    0.073263152109884169, 0.13597373260150919, 0.1683831544246828, 0.05337010931799957,
+    0.038033614730495387, 0.019849689764885572, -0.18066022781863322, 0.081687830370800699,
+    -0.042902373230828579, -0.12712830523382671, -0.17017185491104089, -0.036741116133267429,
+    -0.13786801488784234, 0.16773036546522188, -0.14442575969876079, 0.019353684471310226,
+    0.054609521941834362, 0.0036296989494054889, 0.12280833658266978, 0.13641535499692919,
+    -0.07529242647731231, -0.10114157831698098, 0.039835267291362858, -0.034544135915512711,
+    -0.23258557910867073, 0.014293310986785648, -0.039357605106351778, 0.044781415024357007,
+    0.034272960311701434, 0.00063366273510602391, -0.02142888739506589, -0.017164691353988897,
+    -0.20468555772430019, -0.035406717925676894, 0.080652059682390476, -0.041813359940114807,
+    0.09843188363355089, 0.025750931113497195, -0.059078603702883398, 0.015192130815737261,
+    0.026720387606412953, -0.099550175860374901, 0.05385891408804646, -0.0076319006069446825,
+    -0.0017816827013152289, -0.0023611070829425442, 0.0049804449092743213, 0.028350394655355146,
+    -0.0023441283555912201, -0.019779915256328721, 0.088369234061959595, -0.076254804390283981,
+    0.027603838050378051, 0.14653222223399301, -0.18444019103688458, -0.14492697221242248,
+    0.071733658026874841, -0.0728963345413908, -0.024259761439703903, 0.045793277946630503,
+    -0.060916535080720209, -0.054025077207954769, 0.040350904105322369, 0.076311067047746192,
+    0.033555135220019482, 0.047407541102365468, -0.062301337022728054, -0.12252446068572818,
+    -0.23539961811612811, 0.10088482368200394, -0.047214386600882584, 0.22001664973083979,
+    0.086555188955252715, -0.007917243633862054, 0.042925535728248768, -0.07381887785143379,
+    -0.063356718804094811, 0.045747803164242568, 0.074331928390510976, 0.013883610176835679,
+    -0.069462259707206819, 0.028078472613738362, 0.12918520545389717, -0.044024201904639709,
+    0.058309467160068809, -0.11415720181408712, -0.035013980902801216, 0.098045482588275723,
+    0.11084608618180812, 0.056751007047787135, 0.11043088794605156, -0.13599246927676692,
+    0.11526837070537506, -0.028142960375850977, 0.096597968640771761, -0.014898587374071029,
+    0.064983790172106412, 0.22442099401886545, -0.10539609206112797, -0.054228622275664551,
+    0.08751264767103617, -0.11223667653703183, 0.096043758169097118, 0.097985611309224355,
+    0.17004319625542039, -0.17007774718419849, 0.0034040326930878367, 0.14484692567644231,
+    -0.22272263818523386, -0.12220815542448402, -0.19771449147595618, 0.050781413163936383,
+    0.0074375305275253909, -0.16470552107276035, 0.081573048822743119, 0.047298169833017815,
+    0.0042098659607969786, -0.10789834706445581, 0.0098614358704173476, 0.05357318809157819,
+    0.013061476096982808, -0.077867840787282067, -0.0014461647306943288, 0.15338179713056846,
+    0.057572541909761937, 0.073828530128539627, 0.25580305695142441, 0.099857999461730476,
+    0.034956552773933183, -0.039106546369289279, -0.0097323576352593508, -0.030112854793872084,
+    0.054258390760031028, -0.021375508343729973, -0.075593431941635356, 0.003094323449822719,
+    -0.17346786117398513, 0.034646359939398103, -0.14004182507141663, 0.017334675337053778,
+    -0.023401905756892837, 0.13776374396891916, -0.091658392689278334, -0.071367772345856187,
+    -0.075520561673939321, 0.010676037594720486, 0.027080013854349012, 0.047186436180089761,
+    -0.042176585887452024, 0.065305439065660761, -0.14762349373815126, 0.075366959009726106,
+    -0.15102932729491725, -0.0099965489626355607, 0.15402646852049431, -0.085651478351337851,
+    -0.06285089451196417, 0.095208952873114525, 0.019760630797293968, -0.048430907103752578,
+    -0.17902016994620118, 0.0029709887438265688, -0.086907046658762685, -0.066116875287008894,
+    -0.19003953087565509, -0.084910118794673667, 0.088658126425869829, 0.0097750700293411028,
+    0.057143271859704768, -0.18534810540930896, 0.13152634967547752, -0.073836601890603426,
+    0.060643047311017766, -0.05757220265933069, -0.0078195451177965059, 0.068025096947221558,
+    0.022380475460209298, 0.074367846052613304, -0.1235815286432979, -0.079961372282278897,
+    0.012638490574615796, 0.019510718564566598, -0.0096971925239529716, 0.098949856372814754,
+    -0.085362664393719812, -0.10432123786529844, 0.10067539810450073, 0.010046303150819004,
+    -0.18145310533905015, -0.2428343936494437, -0.0075846143571843133, -0.23710277980274327,
+    -0.121130747877357, 0.047042107466991896, -7.0852564380036024e-05, 0.092241582266930799,
+    -0.067678577051994357, -0.10509430099832684, 0.059601467963013077, 0.042234727334308816,
+    0.065910650049313471, 0.089643649215130072, 0.0072591995410339989, 0.06299889723938111,
+    0.028706725663826274, -0.036521297911899307, 0.0026930018699016433, 0.2061245234242389,
+    0.034419157629271432, -0.021642716766865876, 0.13552571660817878, -0.18781550795183585,
+    0.0013731328141891935, -0.099816812022401391, -0.025943274503314163, 0.036224117644225229,
+    0.099945395049844052, 0.062422946987957563, 0.16442478567361704, 0.19098235564327268,
+    -0.045678563281470214, 0.0082626731956767282, 0.10874450030685363, 0.26889267726609462,
+    -0.29269471686936099, -0.032738173001929452, 0.1776265166289534, 0.010959421802790864,
+    0.11517514333829111, -0.19132361802033704, 0.081456192134464978, -0.05624157930592634,
+    0.03010888591058633, -0.050877461758746891, 0.0029048734948084187, 0.10966336143012892,
+    0.11067998916459845, 0.0441350818764484, -0.031625959809843361, -0.037410921427874257,
+    -0.082119869200794365, 0.025805730009795087, 0.021516499855245334, 0.094875953130902829,
+    -0.039900270984664865, 0.19666195953471602, 0.045461285606349877, 0.043226766810531184,
+    -0.090768268769003055, 0.11446724973090458, -0.083011056415826553, -0.1938855043147415,
+    0.10215287615301022, 0.035791595362486189, -0.070323318698512008, -0.047956165369469908,
+    0.038869448022989937, 0.0052713646376386144, -0.0027629317042765921, 0.080632266395805702,
+    -0.054037038393563566, -0.056694486128807939, 0.027041636585406471, -0.044708410248449924,
+    0.030260492727533037, -0.045274355429884318, -0.058216473820776236, 0.10343490941714334,
+    0.18828892236483621, -0.10656353031637179, 0.10813473012440795, 0.007759026131674342,
+    -0.033953931297748291, 0.020233598675155499, 0.046735454649233232, 0.09175914686533572,
+    -0.096774354959674028, 0.03243665119138605, 0.10739443100136747, -0.03688622255256687,
+    0.087198957127462007, -0.099001831896990064, 0.017544600280142687, 0.027585354136748379,
+    0.0019420430395643666, -0.0021245691687105266, -0.079710894504135738, 0.017838904510944439,
+    -0.14998645099456662, 0.033692530420268887, -0.074633314710831955, 0.10891341040709873,
+    0.001004387990788947, -0.042818844273584761, -0.12161804342682236, -0.09219169596561344,
+    -0.057665594174011195, -0.059412824829373226, 0.068935381106655452, -0.10029776485139236,
+    0.017728967510663399, -0.075947462644106609, 0.17251501861950136, 0.00067112410796535459,
+    -0.036846219627323956, 0.083722603270633092, 0.11063857758752685, -0.01491365758068224,
+    -0.10439007411194151, -0.062527824103824903, 0.02990967095999756, -0.024009818675336313,
+    -0.060017656066318176, -0.20674066501331956, 0.092156009204858516, 0.059825126557399987,
+    -0.11754495820575553, -0.01225933375187022, -0.2906586098779888, -0.008335711082813918,
+    -0.053217019580484415, 0.10945431732809791, -0.21112443623731544, -0.0097322917904631902,
+    -0.17900775828766782, 0.11145325541509653, 0.061172503756961698, -0.020386395660178875,
+    -0.020762696637736194, 0.11056415481217823, -0.041588843220604965, 0.022669976045538078,
+    0.061939087561501967, 0.19521439331740159, -0.163095779004687, -0.056464064124298663,
+    0.042403166611809963, -0.082004469230677432, -0.055219987977616382, 0.0095856637434677486,
+    0.13036912210929971, -0.12753016251277227, 0.069357955709952124, -0.052370025177042305,
+    -0.10198789668794953, -0.19271750841079502, 0.079026710070609504, 0.066839053405564439,
+    -0.081829415159310429, -0.23878527982330155, -0.045165061428236029, -0.058402106351353365,
+    0.16437875979253494, -0.088369870431382072, 0.084300838940586389, -0.030466274862353329,
+    0.23637612956469753, -0.0074849125680176137, -0.014184875167329528, 0.015424660152233705,
+    0.10110064687293568, -0.055815862853723752, -0.099601805719200937, 0.039982167313783616,
+    -0.036286733534592823, 0.1035497315631779, 0.048569137369396748, -0.025319506913040798,
+    0.089603079634981292, 0.0872969769583124, 0.065441861265616616, 0.054217760963033552,
+    -0.10051264424770427, -0.031055086971091148, 0.099092374422137225, 0.0015936262308559523,
+    0.058770095216527679, -0.044285125804667293, -0.12817895733919099, -0.042684429070500234,
+    -0.015857400932986713, -0.098920680849180154, 0.04884276604097193, -0.033246455492431069,
+    -0.14999115915596639, -0.080090130508739393, -0.11458704441254046, 0.033119563967002989,
+    0.071144308320403374, -0.031537916232181731, 0.027100179392541023, -0.039132593279801599,
+    -0.021978523388602327, -0.038840186552492398, -0.086545845844177197, 0.1536535283919111,
+    -0.16094710123527958, 0.13043159601088294, 0.0062887081085914046, -0.064742698475519347,
+    -0.18924041812941192, 0.044812879259915117, 0.032107707162149862, -0.0056599773544638897,
+    0.0015575732214902322, -0.084637394335921684, 0.040181334528446216, 0.067377584358224621,
+    0.049455332296400978, -0.097596740397768139, 0.0033998031896255855, 0.026941105995706014,
+    0.18398868523983114, -0.033118395350111379, -0.20500186575043641, 0.018834088134569216,
+    0.15047733791054416, -0.076326160619217737, -0.025532547066298719, 0.12508548234468259,
+    0.055039731146521699, -0.011059161444054158, -0.13708882385362881, -0.20770785038566153,
+    -0.16508135762784748, 0.050359995996122169, -0.045306085515537171, 0.1901365183366493,
+    0.05751650757146743, -0.072212114334733027, 0.088610747940448528, 0.12023806351523374,
+    -0.0094123358249484645, -0.19504912864484852, 0.14344910723268031, -0.04576362197574655,
+    -0.095133803231834249, 0.029563291156916815, 0.20344668281648945, -0.045517867791792087,
+    0.049558434337563406, -0.092629393019816542, -0.059921553484190732, 0.057441347294640427,
+    -0.0058042597551095816, 0.109915434292068, 0.083850826619976226, -0.025236523517448872,
+    -0.040909277303128384, 0.0053207055033151303, 0.14118522045022985, -0.12761237340789131,
+    0.11196424750175336, -0.071133136365921265, -0.15851711378328559, -0.26161677041418585,
+    -0.10803450659709864, 0.12172265411021053, 0.0018913563825318374, -0.18966570074021372,
+    -0.23453038206258833, -0.031890063757764021, -0.022744647024604756, -0.017271542633408767,
+    -0.12715504789020207, 0.067428952867574984, -0.15213358560273374, 0.13900149140212706,
+    0.10986523348618715, -0.08185769267032722, -0.053009795641862201, -0.028397138260833246,
+    0.081324139217237995, -0.22856859924096457, 0.27345449768371249, -0.077609285309179862,
+    -0.036174544345931731, -0.016918306326160714, 0.015931010702866, -0.024884261256371498,
+    0.11512562941200309, 0.021187708033875083, -0.042236847787050037, 0.051284814190720299,
+    0.075294710509497417, -0.055315954841084661, 0.13043080502527579, 0.087005141620827453,
+    -0.10919156169876082, -0.10540378659767723, 0.025202817933677225, 0.04053886108988905,
+    0.14313743157895972, -0.20979968051055914, -0.18512346981589073, 0.052523526381630159,
+    0.021186812794071672, 0.047136863424873346, -0.044944921953980525, 0.17784535373200314,
+    -0.027005898999627499, 0.027111928133728331, -0.043068992083967618, 0.099364112039845506,
+    0.095049452383108857, -0.033691984003043934, 0.1054657273372281, 0.07156909411923694,
+    -0.052573777657170723, -0.11077339216108323, 0.050279227346100963, -0.02495853468134529,
+    0.13968174383018883, 0.17589943647112483, -0.19841567248318159, 0.0078091102754186377,
+    0.0053188781394248388, 0.1858971100298426, -0.039098891306771973, 0.031574087385313712,
+    0.068689329744138411, 0.10112070084099722, -0.045160155484688526, 0.078467118090410584,
+    -0.072986568180761144, -0.043764143378855425, -0.12771547817183293, 0.022289949421728208,
+    0.0055056933561259879, -0.071853823667362191, 0.093143723042319979, -0.17294840277395959,
+    0.021383226730885049, -0.095328513633765835, 0.029858455516021704, 0.020614037830624713,
+    0.011959653636336835, -0.21967487798304194, -0.1675571125095682, -0.11414901107756406,
+    -0.18479496703096343, 0.08317725517171419, -0.058452808565247455, 0.079941405330730547,
+    0.17712907264280417, 0.083809304705208254, -0.13796138125839666, 0.0072440342902102056,
+    -0.035373519655430251, 0.20418347633092099, 0.018719036036804061, -0.031496197673393879,
+    -0.0836025647810823, 0.014216282622131119, -0.12891097618903682, 0.1260871081135449,
+    0.077891242353838555, 0.0043405147096892182, 0.095328798625045466, 0.11524083249258427,
+    0.0162937009357309, 0.11384236105696388, 0.083292685677679265, -0.082520554004715307,
+    -0.092397336719806225, -0.098624721356610864, -0.03701764502137464, 0.040672912368272529,
+    0.093222721757143787, -0.076170006743509058, -0.1343588709996559, 0.071577816336862887,
+    -0.0049162942330156466, 0.082807872858486731, 0.033486842181690998, 0.14683616024757593,
+    0.0888474271706996, -0.053088112494867917, 0.025720810047657777, -0.029084639033063082,
+    0.33088698848196813, 0.0035843399657899937, 0.031906510987344039, 0.045937177240986546,
+    -0.027276862998120367, -0.012076452190486498, -0.013305621043398573, 0.096550177176453172,
+    -0.16112000996044951, 0.051190228189590431, 0.16746729943411715, -0.048210687369560572,
+    -0.047674934042589739, -0.022459232374817957, -0.044917424899932008, 0.050195989016015498,
+    0.065085774393055407, -0.09351274307117298, 0.053307594469979382, -0.0060717700472553027,
+    1.1605818232211366e-05, 0.099125197660189623, 0.083808278225573199, -0.059566405167100538,
+    0.10495235234729788, -0.00085504144267131536, 0.04348404993064512, -0.046903157207740825,
+    -0.018481361088027209, -0.029155090777037762, 0.042430514740911487, 0.11736956550615803,
+    -0.060484699228277553, -0.18052270644381943, 0.096886276472741117, 0.0022350580692146278,
+    -0.040823502595237926, -0.059553846479397425, -0.028898331080640518, 0.0339425688983011,
+    0.012062094409545421, 0.062619324255918249, 0.028043483171502095, 0.053903571428971557,
+    0.055496764342278716, 0.12910568655780916, -0.10817380177801908, -0.0033132388258436648,
+    -0.099558143140449584, 0.13416168349182528, -0.023717374218732944, 0.034636387118028591,
+    0.067363119303478283, 0.1734825717957314, 0.019331093194584481, 0.13366266142804703,
+    0.10771623609838328, -0.046537577791966302, -0.14519484785832978, 0.099096934818253629,
+    0.056211681116954286, 0.038344401833708679, -0.022747977315973222, 0.10835208508786882,
+    -0.078248948819199887, 0.048869719616802178, 0.0026437333460179353, 0.094791991232777387,
+    -0.049126450704567032, -0.0067086322793095971, -0.017834525437246444, 0.021608439824868063,
+    0.051863326577951167, -0.13630578868810392, 0.092458632421766135, 0.078273449641734771,
+    0.092360739601827654, -0.02757627609914606, 0.068721718479111349, -0.0019633084719913852,
+    -0.037710406421045999, -0.16146292023640035, -0.072667183701340607, 0.12060682741062373,
+    -0.074787918723728183, 0.01273258662062389, 0.015945452168578934, -0.057522637201400023,
+    -0.14411911381297282, 0.11111263630724162, -0.0062582153516248309, -0.15807558835658439,
+    -0.0008518866734658001, 0.076964671976441523, 0.028585910049699501, 0.060172423814237264,
+    0.030691394875624858, -0.022889210220230816, 0.093662113924855128, -0.10447537648469774,
+    -0.15216483769645089, 0.13416911912510462, -0.017975621761338319, 0.073784814327338716,
+    0.11553251434957211, -0.08791417030460652, -0.18169811033274696, -0.19766252668905707,
+    -0.057568213335965845, 0.063932062517522203, -0.027187356005881166, 0.19673078026409954,
+    0.028167856328308954, 0.099774251296414415, 0.042708095643448754, -0.09677441038156108,
+    0.090634310408374927, -0.13203983754534074, 0.025554586620174846, 0.035284920557303777,
+    0.12525166274823016, -0.0041675196187650441, 0.027312489805440612, -0.091602416115102017,
+    -0.032072938388000564, 0.0032573221906227394, 0.00041362465827388725, -0.032430444540939046,
+    0.00012449123411735374, -0.0019093638859954808, 0.15040629906431599, -0.21772209263541087,
+    -0.16545528788090236, -0.015842128225236684, -0.026238651877651144, -0.039583790469818754,
+    0.095255612092635444, -0.051772054575972573, 0.028130785854598335, -0.023819839723607902,
+    -0.066757214329232345, -0.16069275431785995, 0.050034394931265741, -0.034910950997556055,
+    -0.095918124117758352, 0.25879342457794258, -0.066677178456078984, 0.075384118864962171,
+    -0.078874043078477063, 0.049123639489736387, -0.03928678523973235, 0.073444317796166877,
+    0.1135071458519938, -0.02443822135254152, -0.045175606960738378, -0.037125699687853349,
+    -0.14436597482203981, 0.048311067627792373, -0.010297671620607888, 0.0097441189103602902,
+    0.073328222570278587, 0.040207508757069944, -0.052575442090788863, 0.1986060513283272,
+    0.037941416537211586, -0.01927560431338881, -0.0488092503001165, -0.042545361434055046,
+    -0.061081638595402256, 0.063731079598839988, -0.16906597915433225, -0.085873355206835186,
+    -0.10214374725174361, -0.088820799089813884, 0.020806478134742203, -0.20852021505332627,
+    0.11662838272426619, -0.20724552358061554, -0.028123069813754432, 0.089127539873798137,
+    0.082557969056725439, 0.13480974847940438, -0.21836001626119819, -0.058815925783679585,
+    0.054333555482022212, 0.09330715669328743, 0.019454897707660776, 0.029098213029230071,
+    -0.089558693545523455, -0.13837629491929923, 0.010686032598958188, -0.10532912031198401,
+    0.11561554144596618, -0.071420777495382046, -0.15055157057765281, 0.11025657942014995,
+    0.18698881906532014, 0.15429097403320996, -0.085165095414883596, -0.080545518891068979,
+    0.020102568125880901, 0.091330254379406478, -0.043991553495526525, 0.0078617286073304794,
+    -0.028917423750762773, -0.15483686217147938, -0.013760073724942585, -0.078644633871068598,
+    -0.10166659968965336, -0.12750479946905, 0.10429765795792641, -0.063411934161941907,
+    -0.044936730518406277, -0.077363733885004879, 0.1647321055442017, -0.22617655834071676,
+    -0.055709217799610689, -0.025140850923828392, -0.1093642754555308, -0.11068076473212736,
+    0.038291556857678537, -0.075973285904612359, 0.10245947144210427, -0.017367187785301483,
+    0.1337014495202678, 0.0066560910902878538, 0.030969355687961733, -0.0972791328954863,
+    0.053296857641785766, 0.063150281701234809, -0.027366816636111665, 0.072891511429085065,
+    -0.16507797954573541, -0.10235616308778062, 0.14698305888000562, -0.080810872413503501,
+    -0.075144357670059475, 0.010364735358143985, 0.054490076360857578, -0.19909552385722984,
+    -0.036605119849090512, 0.0010743021756903645, 0.10672963392024702, -0.059432235737356023,
+    0.038508322333273309, 0.14734736246101102, -0.080942571149418607, -0.08278821942670378,
+    0.021160843419794698, 0.011443320135576959, -0.11571975043596563, 0.19387570808858998,
+    0.079368036186232185, 0.01258347711751328, -0.10310602690936205, -0.038163344180571823,
+    -0.028408518759551738, 0.17715594227663956, -0.044475062191322259, -0.13088205337949652,
+    0.0035024440519004297, -0.010507343950909256, 0.18736944429572167, -0.060528292923138521,
+    -0.013028484682465487, 0.041904032680034023, -0.017871724809873136, -0.20917707910192529,
+    -0.12735674100390118, -0.0060138077703081379, -0.055371199712131183, 0.033714990723547562,
+    -0.019034875750483037, -0.036750473733059251, 0.032115094928883876, -0.11744899461105254,
+    0.037426876194634674, 0.066602486662048835, 0.23024319836223536, 0.0021652727000865358,
+    -0.04954075389854156, -0.055031556306304553, -0.071894117609793542, -0.074010066770443,
+    0.017367525306271881, -0.18075812229962726, 0.0037648340227052031, 0.0073298091747132496,
+    0.22440308186395652, 0.10964834473073576, -0.13726598763538062, -0.14024774699681228,
+    -0.0098833642511954624, 0.0023863810008730312, -0.045998623665886883, 0.16563023028680016,
+    -0.024606366524311234, -0.04062737579163947, 0.050287910199718365, -0.067094427377399735,
+    0.10240129676376088, 0.050346392297261539, 0.12721001568253895, -0.063935923377575282,
+    0.15073680111704338, -0.00050256791959941744, 0.066324563661035188, 0.053186831322217201,
+    0.058762228484412121, -0.0068966693531172215, 0.00078992752327950518, 0.033412429535193681,
+    -0.10814329271444197, -0.097712450653231947, 0.078477760057369506, 0.063019108384610445,
+    -0.02701434259651489, 0.034020722400025766, -0.05441495190884766, -0.050417132733416962,
+    0.11850243254961107, -0.038296579236701433, -0.08094347034685799, 0.11764529360491383,
+    -0.20175996473401009, 0.13393284102549335, 0.02707172014806581, 0.22656451205919728,
+    -0.094240071060913019, -0.1347931753323359, 0.074675807084281884, 0.0019877231308909672,
+    0.038703914095930457, 0.014378184532023053, -0.17635607056661345, -0.10929806429106026,
+    0.17165506510212855, 0.10960970644640471, -0.058620248695874913, 0.16313153039333658,
+    0.057597505128715712, -0.18606085611052986, -0.072882428483894812, 0.21890588280446308,
+    0.13880519404205691, -0.00763551435529327, -0.18265599826935752, 0.10397599945285237,
+    0.012131540163075874, 0.0055313201955734847, 0.086690197308322489, 0.0039074567358570794,
+    0.13798127822770451, -0.19463911143645632, 0.011211300291689342, -0.085756390540619398,
+    -0.12579467613510892, -0.08950294089245156, -0.031017142415716459, -0.075159326777825552,
+    0.038043186597187466, 0.063700811099191887, -0.014156801841456639, -0.09101608823361082,
+    -0.018251776119774445, -0.026587584674761435, -0.091217716768792825, 0.066035769102840938,
+    -0.043961729564922683, 0.06870017040316162, 0.15046613824600616, 0.11313826580153884,
+    0.06733129167892396, 0.0015925255286507207, 0.075153693144360226, 0.019911678525901543,
+    0.096273795784314178, 0.17462467996070269, -0.011775377233783746, 0.084353047931764999,
+    0.1331340889214179, 0.053837044428432249, -0.016248216485988176, -0.11183261185399486,
+    0.021159088830122137, 0.003071879525943233, 0.11654331505583192, 0.1969158543308136,
+    0.11334655345947356, -0.0060580098663070066, 0.1149827494676155, -0.07512880795458142,
+    -0.23756415885353829, -0.09257610562864152, 0.15628766317443657, 0.026237368168568847,
+    -0.05845024070469481, 0.022407181587357359, -0.034864765388310563, -0.017305506560023425,
+    -0.14398903096470819, -0.06112770464927271, -0.098442378474625419, -0.07011377415031296,
+    -0.21229819761067212, -0.044496895930016253, 0.085581144326731612, -0.083504508562865093,
+    0.14508085505410612, 0.058948760771708325, -0.11100159214235691, 0.061993312653551978,
+    -0.014522655511480921, -0.098573923191112675, -0.0014820992409811963, 0.10869267014398114,
+    6.0669744400722641e-05, 0.10968546592697932, -0.15485798303350126, -0.047888652238104901,
+    -0.071892172442073798, -0.0094410197986198093, -0.064506140983458068, 0.035092437173995031,
+    -0.021909359063186924, -0.13394685739015111, -0.050996668257897733, -0.1245373081722658,
+    0.13997276015825985, 0.15473400626916173, 0.026676379048116493, 0.034277746695174152,
+    0.08320824029920125, -0.079065510533966252, 0.039885336665418825, 0.055047443491343356,
+    0.09422217468550137, -0.092657744384580548, -0.18674088411007919, -0.15183381431962437,
+    0.20370109038277923, -0.15753683760788642, -0.041446146449125011, 0.10704277620821481,
+    -0.079433838655376635, 0.228809851029248, -0.11010040751292313, 0.045059708218767917,
+    0.02157557264858917, 0.063787533203952168, -0.11734936451400561, -0.040736419794052098,
+    0.010327420171396382, -0.10266547994391337, 0.12048967482454349, 0.10269901365140388,
+    0.071268330099790639, 0.0019182738616935083, 0.11110799010754396, -0.08269612565808053,
+    0.07783299309284393, 0.2129624802717226, -0.10187177444158672, 0.17393834908715225,
+    0.032631215190242695, 0.066758016652808241, 0.10027844741066962, 0.19977212476629602,
+    0.10650696756775545, 0.012436719821518651, -0.011973830355628611, 0.016099005561952005,
+    -0.10751203254311131, 0.12548328650372073, 0.04568299558767544, -0.01430090680100507,
+    0.051203197321353949, -0.29138716348590549, -0.061076815083498874, -0.12783325810979984,
+    0.011576028386948259, 0.13085199092321759, -0.034067334113087176, -0.022214183933947737,
+    0.076644501989652725, 0.099468182184588333, -0.0035815316223988453, 0.053655209606573266,
+    0.0052832447493618949, -0.070189341829329163, 0.03618105388865988, -0.11847538181396755,
+    0.16975106752230629, -0.073247703701262948, -0.11027172831087531, 0.061448538407369871,
+    0.19812471746641927, -0.069440892410209287, -0.16514930952883056, 0.071351794735350499,
+    -0.019250787302131984, -0.071979259588462782, -0.14399570687564675, -0.12761414033598692,
+    -0.088621854698980221, 0.063453142389396811, -0.082001778222954458, -0.018650367622594449,
+    0.051506310652373259, 0.12622686261706392, -0.055963995001807425, 0.025813333417359724,
+    0.15703311046789836, 0.18482957560821137, -0.073515614686249536, -0.10875558754120403,
+    0.017684644475864535, -0.051197357585056127, 0.0075061014105752989, 0.12774761212068239,
+    -0.021653011398552059, 0.00040232961815854951, 0.015553786484701855, 0.0079857915275308132,
+    -0.058976842397444378, 0.075290652539879807, -0.056119249744485455, 0.041133735247850162,
+    0.26337245284135397, 0.17665618688810689, 0.1043729103451278, -0.08427161386650199,
+    -0.084564809504948213, 0.2037799482707163, 0.044370800543141589, -0.099181885686278115,
+    -0.024075468794717555, 0.11878833037229641, 0.064218895315870259, 0.060132457388448607,
+    -0.15495634415414805, 0.10033373198878844, -0.011640615230270627, -0.028437855826508113,
+    0.040577612679381724, -0.064343926302372428, -0.13945160682711341, -0.099208139127382453,
+    0.0051397033499493879, 0.019307644519268634, -0.037373271233382015, 0.032984759157758684,
+    -0.037831756308824661, 0.054959934506278424, 0.12552333166100657, -0.16227771037736624,
+    0.065169546253351751, 0.04070924155558759, -0.048719512079337668, -0.070186109426310136,
+    0.011362037218002229, -0.046451982466067437, -0.11317224081795743, 0.050986134565449287,
+    -0.046654150456415105, -0.17843392554974857, 0.19019298066552578, 0.018548231097493796,
+    0.042870621422793576, -0.01819646162486311, -0.094955840944908707, -0.1621448857044516,
+    -0.049484551689999268, -0.113547060829635, -0.027230913468617085, -0.03717493271103537,
+    -0.10266646079433357, -0.12450034344643335, -0.026649059573903192, 0.11067537649333348,
+    -0.0482977239331287, -0.14193705777778348, 0.12828270116546162, 0.0048671393576177431,
+    -0.031029852616839368, -0.13828827039888833, 0.1507138739612971, 0.20457557326374967,
+    -0.094540359817569655, -0.047049972272550561, -0.04487580610178557, -0.091634710675145586,
+    -0.2508728794730351, -0.10590996632440436, -0.18941002051496511, -0.19387329522973445,
+    0.0042540866759080368, 0.029681369573721823, 0.10324117318035404, -0.16866923843900355,
+    0.058120560087138756, 0.13389670376542859, 0.0024493439680804683, -0.016822282802309605,
+    -0.14335116330877259, 0.18049574069872101, 0.010778758254462336, -0.065029363027540962,
+    0.036338224478680507, 0.014796409353663775, 0.17818586531990827, 0.15468742989065176,
+    -0.12374901199344518, 0.075000954677273773, -0.030746244658636991, 0.078150271978602109,
+    -0.0063602215529786196, 0.13799109219256639, 0.020016600460198333, -0.18898039172967215,
+    -0.1343649268189796, -0.13998206099243282, 0.066796650503715527, 0.33411733786759457,
+    -0.042991891279958248, -0.072454583561127037, 0.066272330990299971, 0.022238198577814373,
+    -0.061504190723350172, 0.19898620835641528, 0.055831076067866595, -0.061242956388250093,
+    0.04630773353646303, 0.14813432020409606, -0.084831929289805097, -0.024056862793301489,
+    0.048653851412764321, 0.067114571407617923, 0.0098631692712068952, 0.15553498920276812,
+    -0.17960983795714891, -0.0061841643515507258, -0.096202802633883824, 0.13105602055255158,
+    -0.075713580075357001, -0.024654576335264272, 0.10153687770284779, 0.157128965040985,
+    0.088394329070658917, 0.16079730938836123, -0.10273665423961767, 0.17070827309108305,
+    0.090475801647325604, 0.11760382191654201, 0.22006769282149408, -0.10793709291992033,
+    0.0023046471965140715, -0.10453488894858327, 0.08849757234638761, 0.18110440867775515,
+    -0.023882619970934427, -0.13805385736825015, 0.15279600022148093, -0.16955826121149342,
+    0.037476623168518623, 0.0094283440511489444, -0.097742777494935498, 0.17584991402596456,
+    -0.046605241607319728, -0.22678840961776789, 0.007747588488890499, -0.034956756559756524,
+    0.06093767794207456, -0.12838538821413722, 0.061542996820592902, 0.032612523361280572,
+    0.070655537075876657, -0.10361674655322847, -0.04831018050625465, -0.11335607352823074,
+    -0.20805581634794945, -0.13088063965788976, -0.23388993324138282, 0.15692130952199815,
+    0.039722741804650276, -0.012773439188778048, -0.070123217531524867, -0.024384617553977583,
+    0.12536564350597063, 0.21952768972636397, 0.03989966907065963, 0.095104209461969749,
+    0.071388031259696921, -0.11235834770992023, -0.064439715468860667, -0.13809709062609934,
+    0.16842701834121407, -0.052858105078576099, -0.20529888878005562, -0.14223734735765639,
+    0.066497292372146466, 0.052274246437348439, 0.068523373244343266, -0.037783283598669698,
+    0.07867875227801438, -0.040413452046275604, 0.07481529572397641, 0.30132395341409673,
+    0.053444169534977541, 0.1460962639383869, -0.064291386218615035, 0.080940140613383185,
+    0.096331282666784535, 0.064721164908669207, -0.012297937367991375, 0.085224841666631038,
+    -0.027353640007357589, -0.025668317751167607, 0.0045151172741222422, -0.0072409893892380469,
+    0.17564338911867686, 0.035422346432538755, 0.026196626223383031, -0.098711399846618475,
+    0.088063577036109786, -0.037546817690922329, 0.031037101469917932, -0.059394929099943899,
+    0.030139091061838538, -0.20283439274086831, -0.081207026489275705, 0.13004689762653171,
+    0.097185612467942759, 0.24611737446944157, 0.079131851640462922, 0.029316920298233767,
+    -0.14868770117496075, -0.05033339859656983, 0.061870861085147305, 0.01053912946739842,
+    -0.0012475497181858467, 0.007123919114639529, -0.062322866217780618, 0.11797798419322869,
+    -0.054107839555800195, 0.054711967822931432, -0.15179923356994909, 0.052230886330039313,
+    -0.039632971430931356, -0.06479818755771144, 0.044234880598891628, -0.10295366872385879,
+    0.22926550633487011, -0.042099879123032709, 0.019206967587489202, -0.015957005078391293,
+    0.096119768138780939, 0.047250820083923811, -0.17994845426421066, 0.061287521553464328,
+    -0.10342250927995346, 0.0004437219900674505, -0.16644631321846201, -0.05814748986071358,
+    0.043668337870953956, 0.047627153635132674, 0.084049457505935302, -0.03035477118390267,
+    -0.16482147198249988, -0.041964303652735513, -0.066148080448128671, -0.063755922158955064,
+    0.098470881539400673, -0.064167471002684634, -0.089014859068824156, 0.037474465114598322,
+    -0.082523557055450766, -0.21279513703557471, 0.027513148876121749, -0.072951377186418323,
+    -0.10371454037377661, 0.15211765133369004, 0.19101822777964556, -0.013738404225057831,
+    0.056907839287252689, -0.032907577786826792, 0.093050643459022045, 0.035676657861775728,
+    -0.035445274908357208, 0.073628348113227646, 0.084479846296859618, 0.087036767613687768,
+    0.21116379305600219, -0.20127315656037484, -0.026049289540534603, -0.14796302625655458,
+    -0.1572488270862521, 0.0083082879015987637, 0.084332984133224001, -0.087864524209612174,
+    0.11287903726209464, 0.063042860164995884, -0.027632229427353498, 0.058787826881039895,
+    -0.0060651597423491315, -0.065848934886318114, -0.11454116000494322, 0.078222810192319539,
+    -0.0070781032792833756, -0.078025869990170277, 0.14032707508764, 0.11623702518829575,
+    0.017989328317598245, -0.063999115255864394, -0.022125037198480323, 0.025603729077739893,
+    0.0088080563004929047, -0.032219886918315829, -0.1467034726156595, 0.0045565805808959175,
+    -0.13583872184934315, -0.04704473104046733, -0.023130796740154967, 0.049450436409891871,
+    0.1616390876860424, 0.042437475710957046, 0.15139918397168209, -0.032172313206230402,
+    -0.042221802724703536, 0.14980373961623036, 0.060629707629882915, 0.13311724974368525,
+    -0.056178913487711368, 0.021285217342016174, 0.018590433933848998, -0.14466920284465201,
+    -0.0076445700807869299, -0.082004168233519692, 0.10730002355540291, -0.056580694071436601,
+    -0.096146488768170071, -0.13000448245565982, 0.20885036145370481, 0.033629164414782815,
+    0.036170681116376516, 0.16827079422186383, 0.077695780448578819, 0.034955521809592861,
+    -0.09896836598945527, 0.10021957713523724, -0.049035830890179551, 0.037573261513853033,
+    -0.035874672152955124, 0.090020695929808797, 0.0068508134506969189, 0.29218980286769231,
+    -0.015098880421382448, -0.14094516769522503, 0.013697378209577216, 0.039475251005387464,
+    -0.17301616734805927, -0.087651113697219132, -0.066315333608930771, -0.0054891900693547369,
+    0.088766720173412944, 0.067933531097388949, 0.023710315734588403, 0.04333614002634046,
+    -0.19596564963924878, -0.04476995211250178, -0.020234703146707552, -0.034503081619754683,
+    0.12135399775707678, 0.057152115510931252, 0.28063633804852139, 0.1900456233494312,
+    0.19452428314080078, 0.10270987203454338, -0.011572281966456722, 0.046236002529737606,
+    0.064040213300872229, 0.02927385246281972, 0.089077864799607456, 0.10892624945534705,
+    -0.079586618230636674, -0.05767012702470764, 0.14516955844328985, 0.012624654301663062,
+    0.034400647943060123, 0.032913618440321098, 0.0020465104573067542, -0.03517298743299957,
+    -0.023803016439691592, 0.2697106574049562, -0.012849870635963502, -0.13362014680056863,
+    -0.094564077844788985, 0.1629167777467003, 0.06939231612606131, -0.076445099828584412,
+    -0.046304051692447577, -0.038649396051192594, -0.046760299329274321, -0.034453053970119905,
+    -0.07235247583642293, 0.077491006921824632, -0.016286050639555377, 0.058589804890992685,
+    0.15738883633980524, 0.10914680247664627, 0.078305740125883955, -0.18658079933649316,
+    0.099479138560929825, -0.0028657284949106213, -0.096256639363649657, 0.066680225310409624,
+    -0.2031969294802175, 0.055433122480451916, -0.00054921828925874421, -0.023500546894690867,
+    -0.08725068359052085, 0.00048561329527161985, 0.027957315492864288, 0.2127042623942107,
+    0.12179226521359408, -0.095573078301632655, -0.19055828075346168, -0.011844971252823321,
+    0.1230863117260191, 0.027830593380443278, 0.085623999570498224, 0.034233527870534138,
+    -0.067638116900021888, 0.014659885300913245, -0.049555387613177071, -0.12143131504059666,
+    -0.069191292249742894, 0.19366683064891177, 0.18730509639721038, 0.03414504728372874,
+    0.00019920749050347439, 0.12309557896174032, 0.028737685836639392, -0.10344975597428448,
+    0.11707790213392281, -0.20220483742408846, 0.18357185280491936, 0.062740826934641267,
+    0.12869158328188637, 0.018663946757451047, -0.04355513740612401, -0.14678280780145719,
+    0.033391949708016788, 0.10391658628840716, -0.017597461491811357, -0.2330984582846988,
+    0.025866977425212757, 0.11900616042105168, -0.080706308532492582, 0.022130643513579858,
+    0.020645389471853647, -0.05756188981709983, 0.17216218940070921, 0.088960295361702316,
+    -0.16632125320475577, -0.11547020983626442, 0.18733058311677164, 0.040752497596150669,
+    0.027483335315865148, -0.0078234295088290134, 0.0097478249911388763, 0.010192769184009852,
+    0.099704269077054014, 0.080935277100432329, -0.090706666903277333, 0.12848195259937986,
+    0.15963627972259029, 0.0022250697737889787, -0.20159960939874172, 0.09877692590670932,
+    -0.025610052045125054, 0.14592758895126839, 0.15300487325160408, -0.059049432664893695,
+    0.14375457962526447, 0.22628889190868146, -0.08825359838739831, 0.14052066890594647,
+    -0.049789555445420762, 0.18599619820577906, 0.087627468828636854, 0.13596332353949994,
+    0.015696903363053662, 0.050395527544836442, -0.17042152726094859, 0.12227511804461072,
+    -0.122580482557298, -0.1824132890612602, -0.042343357414829148, 0.066544260542905243,
+    0.11949265771208845, 0.022298232611577085, -0.084123613830415583, 0.15171047492720732,
+    -0.024073043604713875, 0.0090032944091097827, -0.14996764484838498, -0.012349976580812353,
+    -0.065293401894115866, 0.047827974287361533, 0.12490574634988914, 0.24945219618141806,
+    0.088490123793034808, -0.071660858240377642, -0.037204866185186411, 0.087117057962437905,
+    0.070407738885028562, 0.0085179986173590551, 0.054665740291533094, 0.062920446724464854,
+    -0.015609560271494707, -0.050342451849257557, 0.02285255409870587, -0.018928687257167072,
+    -0.12311785084144024, -0.033691747004210647, 0.067775855528822593, -0.066567551331975408,
+    0.072699782518816161, -0.10844951413343649, -0.11033576884837488, -0.1482292824271626,
+    -0.0071694342296397644, -0.054126608772342412, -0.11035511562152939, 0.053800993046481331,
+    0.086007495500731987, -0.012185103802549588, 0.084790724648473675, 0.030455079834267297,
+    0.018047971338006535, -0.083229404135530663, -0.074308871286366998, -0.073866580028151094,
+    -0.1687898305935657, 0.08384861681702413, -0.2065098422623336, 0.22598321420158171,
+    0.080803473497520498, 0.020269665759624047, -0.017714955564666613, 0.0074178629346809731,
+    0.093621771622290254, -0.0036323524498877682, 0.12774976822731682, -0.14904679946769703,
+    0.11906488428001986, 0.00072790805717252321, -0.059657106374097317, -0.17209764982979342,
+    0.014256270483885331, -0.028814785237894571, -0.024613198989390409, -0.06040512084373223,
+    -0.10683760372030802, -0.084181764273596152, -0.0018242931452689616, -0.017868529397875171,
+    0.030084833266993734, 0.074480407000145882, -0.03382707370359038, -0.006312023318296881,
+    0.086851152954105643, -0.040997767187627827, 0.049390465165149222, -0.11436464883988602,
+    0.10277730420671236, 0.10520978612066101, 0.050669675524999985, 0.062822110217367513,
+    0.014807157543532448, 0.076613833490873418, -0.19398858847305281, -0.048882046951192193,
+    -0.052325701516665671, 0.14747112428964224, -0.044659002554149792, 0.025998163504466067,
+    -0.20261364187131758, -0.056180009247053297, -0.057088737830852755, 0.080150821829666957,
+    0.12781707394617883, 0.1729933002352263, 0.021245215577627014, -0.04479778696906267,
+    -0.1064874752065057, -0.025429733954638625, -0.22556444296087316, 0.081475492423532025,
+    -0.011374085502473883, -0.01821776428764095, -0.12446701007309037, -0.12164808038930473,
+    -0.090965467446133, -0.21230463624212548, -0.076398367236349726, -0.22220683686611262,
+    0.245183665098687, -0.29151727077040546, 0.052783365068521326, 0.12804637435558333,
+    -0.025753117588584035, -0.051781980423225904, 0.047828538526807636, -0.056817975574398216,
+    0.011625423601925627, 0.1303803229544965, -0.0085781564710478275, -0.13288181729704102,
+    -0.05359414321712639, -0.049721712192133803, 0.091895927470648703, 0.080035305844263119,
+    0.15426473297477344, 0.10177770472047422, 0.083718101130946965, -0.18504846067839575,
+    0.090831585656701949, -0.10277252608579143, 0.041291455377637343, 0.23566908445581883,
+    -0.017820654644080114, 0.044048822480725058, 0.056392935871219303, -0.069135110551692538,
+    -0.041484150782211071, 0.024797344969476581, 0.031261900123929029, 0.033928561529072088,
+    0.18284598804234176, -0.082217229595990218, 0.21110938757710437, -0.00041634294152533084,
+    -0.036961147360106361, 0.016328608549595353, 0.11189273291626219, -0.14841965557907938,
+    -0.038801835859915521, 0.12651881475712332, -0.15841227563227392, -0.17857373989026198,
+    -0.10160108014470329, 0.026504795578355583, -0.032962039452900598, 0.060617846343775851,
+    -0.02866309753803167, 0.13553862850050027, 0.022710521535129272, -0.12147158442400342,
+    -0.12638387946396212, -0.064021368417674154, 0.08882492829032658, 0.029995907530363602,
+    -0.040327449257869075, 0.08493089250314767, 0.21198873884774763, 0.028253727354504404,
+    0.10366157844957623, -0.062092772141384561, 0.12974395365617028, -0.01649245975637275,
+    0.11103881584958912, 0.0032324602472595643, -0.0014671609573534555, -0.052291266200822854,
+    -0.041540973934442352, -0.066748228960953837, 0.068211891248455836, 0.11023189639043501,
+    -0.044275879739975633, -0.022984081983976817, 0.21602792324630313, -0.12087781639793647,
+    0.21675539853569492, 0.001024651870875089, 0.14814615811920123, 0.078068309625525731,
+    -0.11578403915203433, -0.006524297640773607, 0.04134705916444921, -0.041026253398646059,
+    -0.016430183942520799, 0.097701018406574774, -0.020144620448515067, 0.023463220551486252,
+    0.055043600478497087, 0.13485230947901281, -0.07821223666913929, 0.040610830775804706,
+    -0.098952904849818515, -0.093344464769701596, -0.082927605707288896, -0.18861296888314949,
+    0.09901685607032526, 0.031346650245985493, 0.0524072493217295, 0.032976708660900307,
+    0.15518333086502986, 0.24260594619791143, 0.21965532334891896, -0.046415222432445481,
+    0.076474833503897166, -0.049457936442051334, -0.039798934011161385, -0.010857099632144518,
+    0.018063704266664139, 0.10019777547386083, 0.034840256459673348, -0.15515941690515,
+    -0.11485693512672286, -0.017124852382052407, 0.026890819057499842, 0.0025374370802569309,
+    -0.010379929914229272, 0.075632369453870515, 0.061070654940481951, -0.042689710939375944,
+    -0.14370810391556749, -0.11038602313136409, -0.094561132547796287, 0.086092170152344799,
+    -0.074628145749718697, 0.058369195616639218, -0.053327623664607395, 0.029941401469386803,
+    -0.11081807874431973, -0.0048158746017345003, -0.21579222712378193, -0.27269204574008221,
+    -0.067689692739660273, 0.066969436610109664, 0.015031207104044398, -0.0095060194040670395,
+    0.061925329555767836, -0.025591430564555193, 0.01463428169167684, 0.095743657039445595,
+    0.08728283394449321, 0.11334928203772827, 0.0065211094619843438, -0.058248423433209906,
+    0.055654002981122309, 0.14484273167537734, 0.052389463301147556, 0.21592383969264561,
+    0.24296968310203129, -0.20506712433112698, -0.025206026220551736, 0.13442418362262218,
+    0.16158066572270516, 0.13099355605488203, -0.020523677695300429, -0.17663282223155519,
+    0.062142374575890225, 0.075633569258211603, 0.14705635095349157, -0.058134505947390447,
+    0.084109311232764772, -0.014914693837242216, 0.15675657466637158, -0.078502793806420071,
+    -0.01601047242976511, -0.017746801897826205, 0.20325440182617652, 0.014962721844060356,
+    -0.011315501803477826, -0.031611021513366352, 0.03776429445575654, 0.15390120698729559,
+    -0.062279784509095708, -0.071931804021912821, -0.10877300622993628, 0.12280604252627382,
+    0.17950647639850459, 0.034622276623299905, 0.046736065819135163, -0.035804032169839184,
+    -0.075412078757502804, 0.1161893259941613, 0.0025884169972411994, -0.069608285311572884,
+    0.040349929163580225, -0.17505546599102056, -0.025068612963375692, -0.15369560296425688,
+    0.17275429918456406, 0.038126757109168366, 0.14286793563690997, -0.013164025570587375,
+    -0.015135132245879958, -0.027749500096084644, 0.010411698895308123, -0.023284204555509887,
+    -0.028082508382842014, -0.056786621855414214, 0.010602161552854797, 0.076884688140430521,
+    0.0078980912113503637, -0.020420819754118174, 0.064339219105106607, 0.015067407342257772,
+    0.10181239231770572, 0.050811620070444548, -0.047338285844069052, -0.076222326966921591,
+    0.098226133704113761, 0.26729960769596112, 0.21918527598520832, -0.10038924936343606,
+    0.00088516256972400592, -0.019173483680137642, 0.15345751966030577, -0.030980011355700811,
+    -0.086302598570556138, 0.089023104450209126, -0.12226513884163395, -0.050472419737321583,
+    -0.02055870674180078, -0.0080020355703814047, 0.016812595292380741, 0.037269889413082076,
+    0.077814141735044806, 0.075880031113217158, -0.12762942867939361, -0.084369537309346224,
+    -0.043522066927014061, 0.10882734412126807, -0.11035815332542416, -0.071836554987532247,
+    0.010728645987456847, 0.058355148955694422, -0.16126776083912106, 0.054382975340699607,
+    -0.13925975722105552, -0.022478261684654645, 0.057630085507102163, 0.030151667780987691,
+    0.032595225865102939, 0.027427506523859963, 0.0065893155050966096, -0.022031569806999902,
+    0.051645825444529135, 0.16506941824562027, 0.12026597898762857, 0.035830690515886214,
+    -0.042844229732906511, -0.017717882725785099, 0.078967715048382542, -0.037940164521064045,
+    -0.0643727491513746, -0.14782589754517331, 0.047849638373673821, -0.15964256794246828,
+    0.1733304368670413, 0.13428547357435588, -0.047396688573850362, 0.036636898500295514,
+    0.12671369651687694, -0.042766780022690278, 0.22315238797414852, 0.057129680053880041,
+    -0.018046956566762258, 0.19634254502146986, 0.096345162024954772, -0.064842565315569006,
+    -0.14038002528890292, 0.099385435880927159, -0.046154250061589547, -0.052106750246148428,
+    0.11280924823040979, -0.073266439596775867, 0.032966448396774435, -0.034164304599898811,
+    0.018552586143700298, -0.013276701063767767, -0.092542052641956071, 0.053965148863541507,
+    -0.031748826408621061, -0.033609424777615207, 0.15063818684668329, 0.041729503068015913,
+    -0.16700083240323385, -0.10241989379904126, -0.013844340839980311, -0.039613338023077538,
+    0.028081154512783105, 0.11796764885840383, -0.21274883249248872, 0.079675240844215525,
+    -0.035579580316003868, -0.038298647354509469, 0.058848542291029392, -0.056436103358158712,
+    -0.017317272612924556, 0.12097750204418566, 0.14814804843325738, -0.038044649143866856,
+    -0.086173215360019567, -0.083008897548112068, -0.19346653424638663, -0.17404394476558741,
+    0.011737558492487084, 0.17221000509661827, 0.067799002764956193, 0.027396761581696301,
+    -0.042296368581718834, 0.12966011501135569, -0.11139022973122319, -0.16161267229228135,
+    -0.11854016286715779, -0.0098250310874000713, 0.046808844584447763, 0.054011707134105295,
+    -0.0018381314720816791, 0.17390261577895966, 0.031590260145546549, 0.040983319287027156,
+    -0.036795064277453118, -0.035671922097175811, -0.015297006375693631, -0.10506951448577617,
+    0.18998976178186566, -0.12333494677433697, 0.031183828816264903, 0.060446527475825941,
+    -0.012848372243129355, 0.06483132347559678, 0.084033502926137732, -0.19887167870174552,
+    -0.018587716278437257, -0.2004617403941788, 0.10906861431641998, 0.01618224984404255,
+    -0.018155438774126953, -0.08853818764566708, 0.07746181146174673, -0.089441598101167794,
+    0.040918236149436946, -0.02482863649251426, 0.010364739202418557, 0.11257392425649311,
+    -0.15206236201678228, 0.14439237168888766, -0.11198727655556247, 0.056645904278465074,
+    0.1232809969016664, 0.060548859476087312, -0.06923446149890812, 0.097552633591446086,
+    0.17490609757586759, 0.0038997082261710914, 0.091711559166568965, -0.16036143997823213,
+    -0.076067398976070788, 0.081941311413008741, -0.11029070364745139, 0.19888328443774,
+    -0.021647986184864885, 0.049655004904141722, 0.045008921042288527, 0.13883547363614832,
+    0.16066589845387755, 0.082974399109059738, -0.0097620981034338451, -0.10899583968223048,
+    0.09308865052302967, -0.17387354572461902, 0.043192137664665467, 0.039810199136358429,
+    -0.026701653988450848, -0.041888595268017498, 0.046906571682782047, 0.0028891605038486382,
+    -0.12864172529269405, -0.089261809827074157, -0.040488970780436805, -0.024902371866395438,
+    -0.13391012042025843, 0.05281391541646805, -0.059480684649594655, 0.021445854503357131,
+    0.087454549310886587, -0.045119228111494269, 0.13432191958399567, 0.03810808536200179,
+    -0.099857373549008241, -0.018303503152421085, -0.035552393833233865, 0.02629842370165757,
+    0.042412599656354438, -0.11137412690448301, 0.13703158995423215, -0.0010354657531289793,
+    0.15481715996715084, -0.10684657923647296, -0.016407617302269886, 0.022154785749660802,
+    0.15845038203515205, 0.0056343926182530714, -0.086942208837925444, -0.10354514875983599,
+    -0.13878224280287582, 0.064300508504491385, 0.007621245168982437, 0.025903255335172532,
+    0.15301164890196378, -0.049321848738787963, 0.069761103637069555, -0.019383630021804238,
+    -0.067892630304794047, -0.041627636689425943, -0.058291018715000212, -0.11923286787918513,
+    -0.082871045415776168, 0.0065647367531187391, -0.107646922196941, -0.016641862182590821,
+    0.0025132541215871825, 0.0011092887049833093, -0.12162446611539764, -0.029110887914784663,
+    0.16940669594883778, -0.10189057812191538, -0.16889714414166379, -0.110815347814675,
+    -0.03538463610110678, 0.035004128635224639, 0.23265123203135554, -0.19268265253988839,
+    -0.017354736687301187, 0.21202914458309541, 0.1054606770847662, 0.037271155639129187,
+    -0.06998886638894436, -0.054684415452275904, 0.090198852787781642, -0.058947841041130239,
+    0.10407407006673858, -0.14203686691312842, 0.12349721342966542, -0.04870888868316977,
+    -0.1142502599348066, 0.011174696880698613, 0.17849071732506261, -0.095245996757767931,
+    -0.081082404154286816, 0.0059964106849822547, -0.03013665239839107, -0.11280511681664616,
+    -0.15715291402080445, -0.13466772208287167, -0.037547742823512857, -0.09708386565941074,
+    0.00051604058992436419, 0.13330854341523282, -0.052237217200718417, 0.084376004589547721,
+    0.0030798408100136359, -0.13769542732193399, 0.052675028403542073, 0.12843969911079986,
+    -0.13050808958864676, 0.044269817861331162, -0.14818822396046591, 0.0040780898699168417,
+    -0.044973365561763394, -0.032194285838533995, 0.11093531917189609, 0.0051819869502175517,
+    -0.12767056127645912, 0.12238405390080526, -0.12024939281918395, -0.023926504427967753,
+    0.026967732015151243, 0.017012691600775048, -0.049048435831206771, -0.028281786402975163,
+    -0.062104406656083272, 0.11063560327573932, 0.035920916778526969, -0.1066298743978448,
+    -0.1331162306148965, -0.13396615003502402, -0.033720439383937088, -0.035156962493750124,
+    0.0039985705237902836, 0.072951637863370236, -0.093903648043296761, -0.053916500764373335,
+    0.18912733211317437, -0.066024064025168722, -0.097886848812981958, -0.01997669727010961,
+    -0.18624237222569212, -0.15378222201111258, 0.14854566162046187, -0.052705825776819253,
+    -0.055890408809877702, -0.15924179665938512, 0.050215050255128749, -0.16164915288369142,
+    -0.12710925978384252, -0.029513055667827734, 0.053039063491528295, 0.13953694282102544,
+    -0.02895303205594843, 0.018174317146373763, -0.0047551861876943026, -0.073147042339792592,
+    -0.0068076535487837809, 0.034775425168476544, 0.085720755992065134, 0.054892931377271414,
+    -0.071981717683999136, 0.079905432844358804, 0.042871744107021804, 0.056179107918498776,
+    0.093228258720113477, -0.18713891282778428, -0.059007268084649893, 0.051026106125854134,
+    -0.021259122588772432, 0.0050236573336787868, -0.046338636454826748, -0.09801686162155139,
+    -0.027543212256953987, -0.11915195284475127, 0.0064268502977803668, -0.079771994302682989,
+    -0.16355323493844906, -0.099436528212046363, 0.064766156860130666, -0.060373796271228769,
+    -0.0036770772576657298, 0.12157958360074156, -0.070500273624464857, -0.090427810481745224,
+    0.067400255163239983, -0.14644897164866905, 0.13702364932190414, 0.055763962867267425,
+    -0.1593276011422109, 0.10058339436134751, 0.081415851199956854, 0.011598262009105504,
+    -0.039424263890373103, 0.042956499871310797, 0.080044747587925999, 0.010112591274224503,
+    -0.062566585148472895, -0.0098873808062597719, -0.11145665879711589, -0.087797898705369026,
+    0.10733491858123972, 0.082071148432092011, -0.11764119355631703, 0.012434183836182399,
+    0.2171912838126891, -0.073210634187118248, 0.083527653068454111, -0.038217272806618949,
+    -0.097448415283372072, -0.072261517650958548, 0.00068775885948690982, -0.058332638091642512,
+    -0.011523285673431794, 0.017041805627692006, 0.043051758886248293, -0.095234447188006083,
+    0.1227055047159091, 0.044947409911922066, -0.18505566441907162, 0.20274352312119859,
+    0.03286332216978953, 0.068691219451884653, 0.11214634257026888, 0.039506046353666203,
+    0.052276084812849857, -0.057203814486663528, -0.26105366808910335, -0.015932128911189929,
+    0.25930773984572525, 0.013435706817227902, 0.005185928635701529, 0.001475072322271213,
+    0.14980558481563663, -0.11377799973712582, -0.01894654120206625, -0.17467479706335823,
+    0.17309887645091812, 0.23194154170474873, -0.011843823659956162, 0.078074070915217078,
+    -0.14371488621321679, 0.012493205891163681, 0.21847553827544969, 0.051131896709201805,
+    0.02150547321855974, -0.041893025649419012, 0.11864208448117081, -0.071428732484019791,
+    -0.12506498820399667, 0.0090421519823142352, 0.092422961484060359, 0.0060321708306356114,
+    -0.11060346384814315, -0.059659518507442791, -0.15692625006655989, 0.13389981785667734,
+    -0.056630112471992691, -0.029498917702837357, -0.17905582743991977, 0.039357442694650205,
+    0.022648112694719429, 0.015024061532956963, 0.079647738525397596, 0.019981577718867674,
+    0.079558614029275013, 0.11750891026872801, -0.12690736189216065, 0.10070152730140282,
+    0.19688618191908566, -0.10460333296812561, -0.037369316776480213, 0.014526085838450256,
+    -0.014911462174351206, -0.09200462250737812, 0.19060725714613513, 0.049671987550060276,
+    0.04310512940724609, -0.0098395767967572548, 0.053705477139038442, -0.046081950713476497,
+    -0.0067315157348969631, 0.051862583319162901, -0.06510137608769194, -0.014971184872156876,
+    0.032163350192816305, -0.039601356340741092, 0.041623632329055985, -0.21920971713430409,
+    -0.14845863866273615, 0.052907533021790666, 0.074197318166613332, 0.15579050563505858,
+    0.11951763077953798, 0.10926207956220524, 0.028038764066834275, -0.028892022688298685,
+    0.064456351317710894, 0.14408105566254834, 0.03548012807095146, -0.056252496435809422,
+    0.088927401730960295, -0.042032549866310651, 0.1254180895597384, -0.025253406578499508,
+    0.070188909305695421, 0.091596799592271794, -0.21987022832905129, -0.075740106763664022,
+    0.13092032413067545, 0.055905286950754647, -0.13364721831746421, 0.34874294741857353,
+    -0.22437268820519504, 0.022128786286274009, 0.039148676364595382, 0.012438447969418761,
+    -0.10190711036028464, -0.20422965234545384, -0.068634055865234272, -0.0042370856259071575,
+    -0.13248957420059118, 0.02509311164194309, 0.02450632900736318, -0.069286667611883054,
+    -0.16668864295410499, 0.018289295151362416, -0.12231401763846929, 0.13428291685383636,
+    -0.1004839640425956, -0.18012223550223266, -0.13053276655647827, -0.04244656771477464,
+    -0.20917727029271541, -0.058402004253286177, -0.14325652102772204, -0.081415397841336654,
+    -0.084140096047322158, -0.081233723905485403, -0.016449994072220312, -0.079802461861728069,
+    0.0031032023031797784, -0.22138329887654154, -0.15935982676052457, -0.011327324275942555,
+    -0.14549185375273263, 0.010263670116562536, 0.01314510365404554, -0.0088060295514563423,
+    0.12093797597829813, -0.051953152494402008, 0.014802346176975996, -0.12526768163649318,
+    -0.18651933968978948, 0.25996191528042328, 0.019075480168722053, 0.077004557005973875,
+    0.22231193643517103, 0.030939318104898583, 0.11458804537759545, 0.2301511002069577,
+    0.054040408930149358, -0.061253077907016076, -0.049127418296278855, -0.044856315667094963,
+    0.068173654461980246, 0.11293893269380693, -0.015426103916795206, -0.14909684436101764,
+    0.038338974934484765, 0.065039906570060341, -0.060159797415434431, 0.0084720249802834983,
+    -0.18970319594525142, -0.018204588744184683, -0.0046717196859745692, -0.10765141490846643,
+    0.12905465415462436, 0.18039551758993388, 0.038348757332517476, -0.046958874942609433,
+    0.029867837381674471, 0.1673431355546354, -0.14480705937060417, -0.026653528051852494,
+    -0.12801021394664366, 0.070091929973935527, 0.14696967208701714, 0.012561935925166233,
+    -0.078679284187856677, 0.24636226009070814, -0.00019137908987718055, -0.19238610411221727,
+    0.028978229327594057, -0.20953332458162438, 0.024469011281088693, 0.17311875676338964,
+    0.11457326070373758, 0.085878916085712534, -0.082931642989142712, 0.086134452997478017,
+    0.042149729794227216, 0.015988840476663414, 0.0060246081325769051, -0.12083231246188156,
+    -0.083498029426021317, 0.055417088831060099, -0.080394569481150549, -0.10110173912394074,
+    -0.090663830847232341, -0.077263115043961633, -0.056751469793049548, -0.080254885114598537,
+    0.00047472749676971768, -0.054398232254509196, 0.11040168352723979, 0.25447662632629525,
+    -0.05069137261259745, -0.076558720295505117, 0.026318341581747399, 0.0013088330040043972,
+    0.075973082234188, -0.080613551323966873, 0.016413633043077719, 0.0020753909345145403,
+    0.018905192232772941, -0.14815937490684264, 0.060025440382450237, 0.064439700943858119,
+    -0.024927817136825837, 0.036422786981243446, 0.072765893650474492, -0.00081007834011435236,
+    0.010991834902845931, 0.071781885845281529, 0.10335949400729967, 0.12204505336745207,
+    0.062018837993152047, -0.12729834766213186, -0.018767756035959104, -0.087887482807139913,
+    0.12019363184279844, 0.061214607449877161, -0.11571837689433175, 0.0057736875139351397,
+    -0.087340059847965681, 0.039463841878648757, 2.2489412479870895e-05, 0.085965159202288866,
+    -0.0048495676410027794, -0.13007824943768506, -0.090677129815669097, 0.014853821621126029,
+    -0.046192729065555681, -0.023428581395935417, 0.096302564506472579, -0.055972297953466393,
+    -0.015609777098093107, -0.093923118973827713, 0.13978124841974776, 0.00026761906234843016,
+    0.086941556778013698, -0.15041532304972538, 0.03876544589314998, 0.052589822500625598,
+    0.099905671396527299, 0.084215090154999034, -0.11238614138175013, 0.17396329296354734,
+    -0.016692507731485624, 0.10810872685383853, -0.10884593383783202, 0.080846044143996959,
+    -0.17191682354279916, -0.12075316350652046, -0.19126583308362405, 0.10255209191719786,
+    0.099280833748669028, -0.11786561507167707, -0.092501794467007251, 0.14015801371355593,
+    0.010168998350943407, -0.050151944612106099, -0.024171399414090793, 0.11661756834909613,
+    0.069232161873098011, 0.022011941451967401, -0.038765588674972956, -0.029535039977510145,
+    -0.021370776842140067, 0.038164616254571189, 0.040012804367611447, -0.095554584081734839,
+    -0.11423922840465052, 0.12747948717533975, -0.088443086065182822, 0.12273989352276367,
+    -0.013702155050761665, 0.040985808857472703, -0.016712156422703912, -0.11567867638362998,
+    0.011732114493651368, 0.020098380769601763, 0.047353809006094143, -0.029250387696492162,
+    0.16573307507593912, -0.044431540301028638, -0.11931460545887114, -0.0099066533817974804,
+    0.058533994351307524, -0.071865927855698286, 0.13672094680948652, 0.023452925047815588,
+    0.15861488979617375, -0.017450112121539584, -0.025069309346608531, 0.13422778753549863,
+    -0.062386956507339136, -0.06970821606397698, -0.10278873959344838, -0.14608267882640447,
+    0.076569917557755773, 0.017658646373686859, 0.068815397386957744, -0.084900711431337011,
+    0.11151653681110416, 0.18852241077059001, 0.091594449217927504, 0.070521860943814296,
+    0.0018679995873113228, -0.13307874869787459, 0.019635965776629273, -0.09770598731104202,
+    -0.058819783927716217, 0.16167595783686442, -0.028554554923772926, 0.16265957595268937,
+    -0.15117317638071129, -0.21881185531857536, 0.18019715147980264, -0.094391257422841851,
+    -0.024682170041775347, -0.072625619060189217, -0.021485346846113956, 0.079520100936863319,
+    0.0094046181964874253, -0.093017736927887243, 0.089057127675974124, 0.34430808078973218,
+    -0.048791711288099449, 0.16512441123140639, 0.2164209014748617, 0.050046393521886688,
+    0.018839601460853287, 0.094416502397461494, -0.051897334336903279, 0.21060708188559274,
+    0.11934572337666417, 0.03508284024808693, -0.086173828229055546, -0.033867971171442725,
+    0.061088448690973143, 0.00060056901126930777, -0.0012176742374318433, -0.26099563570030748,
+    -0.17912612290683813, 0.10674598647579156, 0.20512596090283355, -0.12789767837624649,
+    -0.016417192893081477, -0.095255032605155984, -0.094919299400342882, -0.045377810029999847,
+    -0.065985415748824092, -0.095686983263110981, -0.0432073739683577, 0.16150093891606312,
+    -0.021592078923306848, -0.071087917550699209, 0.1340380041813338, 0.11230805069646367,
+    -0.1341002884222402, 0.0060875262320028581, 0.010668072084961868, -0.0038540446468209606,
+    -0.11055437609470389, -0.070626209994201036, 0.16676456352239544, -0.14306750219597447,
+    0.075583663687004601, 0.098842120898171473, -0.1569930904205763, -0.31139958142034452,
+    -0.079173308463471578, -0.056561289875507639, -0.053485373787163386, 0.14392688355770117,
+    0.038039813628719582, -0.052465848234854832, 0.035383296280400336, -0.052301137380271985,
+    -0.14092604216199833, 0.062382116970231188, -0.093947109490369177, -0.011641074712309074,
+    0.050668018502308058, 0.019923023707785311, -0.1779334595042408, 0.12803480096260844,
+    0.27008138313913965, -0.035119784784713275, 0.036019704536282934, 0.30837783395224222,
+    -0.0053718990445453824, 0.10598055315395577, -0.085534187214593729, -0.15571695848573761,
+    -0.0077352983508509904, 0.039615456732415358, -0.039369860462325684, 0.077528153909545275,
+    0.21098764966551595, -0.020686348181301155, 0.21445841929438947, 0.07425328946419707,
+    0.057186711050162112, -0.16494253485780824, 0.15790538907357757, -0.072285731094388295,
+    -0.014728180075228393, -0.16234825259272453, 0.0016518770405303967, -0.12241980260974224,
+    0.032678399646313971, -0.044027414711906479, 0.080476357785638719, -0.033781604179644896,
+    0.064923251942510266, -0.1958620185768446, 0.013011262730003833, 0.0410206146262342,
+    0.044741013603558838, 0.095094439858231558, -0.10146551910794385, -0.012275498088826546,
+    0.093854051293662408, 0.14757678658499881, 0.031450158430375387, -0.12318611830266729,
+    -0.059460595952716022, 0.063287617330942791, -0.0065717279078947675, 0.03208217710930885,
+    0.022675373742016464, -0.1029687243452036, 0.09826771758136002, 0.050523481512859535,
+    0.16374217419205123, -0.22008146781538782, 0.062900001572838801, 0.0011873047716116187,
+    0.19651548686320247, 0.09492037107703083, 0.13465814775264709, 0.087439071177494998,
+    0.06279260311790047, 0.1203591924887428, 0.085112958450306364, -0.13008070273653785,
+    -0.046463299713763874, -0.016931889782041482, 0.20946280500828512, -0.016181049644258091,
+    0.033969037840400021, -0.00092549737628841672, 0.096075187231462897, 0.024543169124663478,
+    0.00047499837711296664, 0.056531818097024865, 0.15710936220870653, -0.13753319715187631,
+    -0.051181652694294512, -0.082981198111366797, 0.067367939214073982, 0.01825507549313149,
+    -0.029422352389390803, -0.1607282284099836, 0.13526882167385534, -0.0205862349637858,
+    0.093923395045558494, -0.061228623315702058, -0.095170009593988553, 0.14224837155111655,
+    -0.016162039081398752, 0.0014126667419549559, 0.081878493942264416, 0.047465409708707516,
+    0.18444107107503518, 0.0097857399278655152, 0.0044074624268028257, 0.061631531973142646,
+    0.0370327520241375, 0.092455501837542142, 0.039893860188947465, 0.1015732228423305,
+    0.24145906622121852, -0.0044139546098886252, -0.18668149992959182, 0.12735571249364538,
+    -0.10933800592692583, 0.010708996197420764, 0.019795221942565902, 0.045745720782642801,
+    -0.053276913250840122, 0.186682924986981, 0.13769882231434527, 0.039505793496823115,
+    -0.16785554010639622, -0.098614075790729283, -0.020915507013691069, -0.080390360777838246,
+    -0.018896546711179366, 0.13168610822050564, 0.0074380566996799513, -0.001289678168088544,
+    0.072513851254595807, 0.12230893671823684, 0.1028191740909731, 0.019281887584321273,
+    0.15093485323820399, 0.10688564663199751, 0.14254169410202716, 0.0015704231885624892,
+    -0.2032711695945936, 0.01635861446477533, -0.073221854007706311, 0.02275740909972427,
+    0.021932744046589708, 0.080462874969640233, -0.0081334700522207783, 0.0067015584537252221,
+    0.099351243898682218, -0.0060392096805596462, 0.1710021145818641, 0.026368416945075034,
+    0.077558731121696423, 0.064266604686721129, -0.18718100476556052, -0.059373318596921881,
+    -0.024471710420100209, -0.11827504582797546, 0.17630043976566581, -0.076904647610359561,
+    0.01811871559814816, 0.027305240395639661, -0.11915433244443398, -0.089122268470112551,
+    -0.042314558132162852, 0.039185361780550654, 0.097427790086848057, 0.072166340438022988,
+    0.088779699772436355, -0.021868326815156384, -0.084448818313532806, -0.049934841755623134,
+    0.12984893108762993, -0.0016041673973490121, 0.27622579100037165, 0.049692671019303053,
+    -0.035911600273375734, -0.1097274714736217, 0.011294894169969006, -0.021569060691449916,
+    0.058976021553491367, 0.08086106396794504, 0.082808413452333515, 0.098121241542987597,
+    0.067775675973314811, 0.033958453185453555, -0.082206059240134507, -0.056401859249814654,
+    0.068484539590212903, -0.0090612744892748596, 0.069546162589989746, 0.0096064568696686541,
+    0.010108653350004541, 0.041180977734113222, 0.029858989655473903, 0.038300117626216636,
+    0.057905027562578856, 0.17264213727551631, 0.077664358490262431, 0.088146394308272258,
+    0.072255173416119201, 0.04665952724597168, -0.003015136077491363, 0.082866704744547534,
+    0.16771527850603191, 0.15291145237209239, -0.058172628658270796, -0.095476003228072537,
+    0.0072804195968230517, -0.056417729681345792, 0.053238731785883966, 0.010753814581193361,
+    -0.06678148144577116, 0.12871706371744113, -0.017926120565395883, -0.063727317718343876,
+    0.078919289857931854, 0.22673843810864999, 0.040944456402326281, 0.036342747466983565,
+    -0.07322697732542803, 0.060721822486354909, 0.10718339630593841, -0.10484194253027967,
+    -0.036856698748363198, 0.032993760863320537, 0.027660960517605682, -0.045328241513935275,
+    0.027519357307032068, -0.11873047223453152, -0.057040901577750436, -0.029214723149129741,
+    0.20304268394755645, -0.031818953799236285, -0.11316633334736233, -0.077576673545740188,
+    0.10576952121217598, 0.090136639501682811, -0.045217532681600003, 0.090058824346053751,
+    0.015070424594850564, 0.050612389021317344, -0.085074441223870159, -0.048901624534101414,
+    0.026679972548193605, -0.032415392102949803, -0.20973996610149714, -0.045514672582747481,
+    -0.1220963886840583, 0.24444969916527823, -0.11888098831535435, -0.10604527155433351,
+    -0.045799210440511592, -0.085409383914072018, -0.0065549969421295692, -0.082323120241729636,
+    -0.14932805324688503, -0.0062359139349118112, 0.17318647605302095, 0.069297786752030174,
+    0.10055888739495125, -0.092717682584798483, 0.069737532456430038, 0.0072814252711097555,
+    0.20774610462140364, 0.15362726423758896, -0.0097456260992989791, 0.020326963550773541,
+    0.092599927870832516, -0.12405387555231964, -0.030267329237861865, -0.065616631351148896,
+    0.084496001320974942, 0.0042954191301498613, 0.009886569119728952, 0.016548964429392125,
+    -0.096267283323076894, -0.010104999890454651, -0.018515153279626658, -0.0053879561101620801,
+    0.048358395668982979, -0.14413450411809264, -0.043263624862291482, -0.012444452621199748,
+    0.048666524093385413, 0.079657073949649743, 0.059310138072767908, 0.17600999492369768,
+    0.071414435261069553, -0.13572397771802081, 0.20040236481784063, -0.07619751945924863,
+    -0.019696523013120359, 0.081139622072402703, -0.043181873642340149, 0.053011150776595295,
+    0.11503597084068014, -0.096606667936077723, -0.13240007656227198, -0.058663772290072448,
+    -0.16289761608248274, -0.067582587568281186, -0.054135468068930735, 0.070143479614131393,
+    -0.06810451222965036, 0.16721896491148586, 0.14022953692931078, 0.086053870985317277,
+    0.046880189397003495, -0.16310915194238251, -0.038638734923311428, 0.011885921478485603,
+    0.0077508972778680294, 0.10204185429980411, 0.1438277380591827, -0.19891706246653262,
+    -0.00095184543760540308, 0.14538885111419472, 0.076521308382798192, -0.062909929246723686,
+    -0.10836684504985997, 0.14483561094043954, 0.077534903745534331, -0.11646518230772246,
+    0.077349046797136001, 0.19737411369127911, -0.10134991147792637, 0.11375915344779637,
+    -0.0606422619377361, -0.0018162766046956038, 0.18184674391928896, 0.011053551260731145,
+    -0.17746807291157968, -0.077196471659009724, -0.02974192574871995, -0.13290847961093238,
+    -0.023838048594861938, -0.059462120408746724, -0.00697768534454421, 0.15764725533603849,
+    0.23799959095542794, -0.19218178700448033, 0.052173517816716662, 0.024553245384819775,
+    0.035611408195950621, 0.11659691728662609, 0.13767786232928295, 0.015084138122718034,
+    -0.057280283922218643, 0.32751453874602804, 0.089329848010648097, 0.011010608721361771,
+    -0.073577351557745488, -0.066342109186590087, 0.084101061742635055, 0.039188976554466765,
+    -0.11342461079473364, -0.060020226015274902, -0.09709911965191631, -0.030626531855262124,
+    0.11405862182623827, -0.094499955190835913, 0.064941141557734089, 0.041947829524197233,
+    -0.06954290818466527, -0.053325205110490541, -0.15442721567269574, 0.16261943211009183,
+    -0.088199936674540222, 0.079224467685262104, 0.033937651877942752, -0.028640048172759978,
+    -0.14933688188560088, 0.013861596894364506, -0.14708618087357114, 0.052294196326354958,
+    -0.014559840336015701, -0.13196324975755239, 0.057752028232109461, 0.1441704553949196,
+    0.031769529931125827, -0.067987200058698599, 0.0060076379892086262, -0.010542003880138316,
+    -0.027972111539424707, -0.11905442406440614, 0.069038492128989895, -0.050329786889101696,
+    0.073737993677693375, 0.11417860411993984, 0.094824447260633396, -0.023751481077799612,
+    -0.041312378925366496, -0.0049728655813589765, -0.0049443860089534121, 0.19451137088002673,
+    -0.077878577295412477, -0.20384601866408186, 0.022071454519137675, -0.050805771069834284,
+    0.24237853479755114, 0.026587885496062936, 0.050198110194204851, 0.0058695370342446013,
+    -0.099800620244084842, -0.011133233304507415, -0.20415899895371056, 0.0049639002393256212,
+    0.013454343996836282, 0.022636977931173662, -0.030409254775134408, 0.11475907465854418,
+    0.24259777672809518, -0.11684419920101882, -0.13512463314869178, -0.015902909064351666,
+    -0.10214665773434006, -0.14430457930511795, 0.0046091968397894692, -0.10209864640626239,
+    -0.080243423960049381, -0.048895800019445802, 0.10840231350435865, -0.02393074840752259,
+    -0.0049890305930147651, 0.097626529519421176, 0.085101329144116292, -0.095669208598538738,
+    0.046960594954839133, -0.12340391081198265, -0.15515346397324709, -0.012057367663316249,
+    -0.12979845892444328, 0.17229717611855191, -0.048723247596427245, -0.14589043776663552,
+    -0.15444768959019606, 0.076761815261357919, 0.011520037902880196, 0.10247982786913777,
+    -0.090607135336240638, -0.017559811085646131, -0.090709217898953018, 0.00066520574852148599,
+    0.051511386003763066, 0.050480849213281401, -0.027263089199667093, -0.13125016955078381,
+    0.054824939623473054, 0.22428718492076291, -0.048674570142264055, 0.05847494177323307,
+    0.16904536880072674, 0.085265099265863661, 0.030129689432117756, -0.033587777510956388,
+    0.075358543096000499, -0.020947557910242831, -0.011006234472746982, 0.028095203008575226,
+    -0.093151499210885502, -0.14072249407871515, 0.14451692380339962, -0.10295678512725988,
+    0.05595538801965954, -0.22202424455542688, -0.10399398238329348, -0.16469878802633739,
+    0.19619066362992799, 0.023203414126388194, -0.080691459793413425, 0.028710809739485945,
+    0.011517160145360476, 0.076274392053501283, 0.034729242132644216, 0.073511835318088734,
+    0.017901157910336179, 0.21128908690586715, 0.22499251037841544, -0.028322446988521727,
+    0.26166273729223627, -0.057628797996262922, 0.033159818751796188, -0.038320300553403186,
+    0.053074548942520422, 0.077204958472088761, -0.037522927870249925, 0.035726576519325981,
+    0.022310958778235232, -0.11473384711114767, 0.081817897465171693, -0.11235316410275073,
+    -0.030854347017431779, -0.050889424289564993, -0.041572648073208721, 0.019227882735075006,
+    -0.072245954882621768, -0.011624965145026478, 0.18415044329254379, 0.050776343709743613,
+    0.0053377875925788767, 0.19451064669474297, 0.0018998975452343087, 0.065769433464888019,
+    -0.049298760013876862, 0.057671247509592072, 0.012664730219096806, 0.021056929063190365,
+    -0.012377110763406892, -0.11797013288724552, -0.010522076881650083, -0.081910789190525107,
+    0.086974673484605511, -0.0021978617936922822, -0.020313504668393333, 0.046349142397173949,
+    0.080667081017828129, 0.062500030792090863, 0.096607448262708284, -0.062828117198145197,
+    -0.031896903447584682, -0.054373642020695861, 0.045877930671253037, 0.048162765571785622,
+    -0.035497580332273397, 0.13590145802352194, 0.038171474428362981, 0.065489606043340198,
+    0.13648546786201729, 0.0158092399377796, 0.0059021714417696316, -0.083876243061480116,
+    0.07919174091999337, -0.029681487830653889, 0.11406558374783815, 0.045945649835136562,
+    -0.074688650722442462, -0.0057562953930142642, 0.25839938787821681, -0.060890529519105965,
+    -0.053218266917791829, -0.013249385089368656, -0.13405923111986484, 0.060888704337190812,
+    0.025841576720063087, 0.057720471315668612, 0.11367568694245477, 0.13935725113927053,
+    0.028542082273309236, -0.067902361798005503, 0.11033850918650918, -0.14837431919721089,
+    -0.041206817972901384, -0.039685787486124273, 0.013872235738816487, -0.016772288489398907,
+    0.12747871508042652, -0.074761699768708806, 0.096038358247719918, -0.039287878680130936,
+    0.037327039006215548, 0.10035737193355297, -0.026373796710724817, -0.047198265723553873,
+    -0.19641890804149501, -0.065620690964616354, -0.037718439730466798, -0.045163929180795245,
+    -0.074156824074544866, 0.064200524964622849, 0.0016597239803473585, 0.026827070673699924,
+    -0.27118043038934997, -0.020923295547536754, -0.10756705049830188, -0.057781854446609188,
+    0.0089003950214184505, 0.0015818678668910115, -0.12239229612488416, -0.06174692276099341,
+    -0.17242531581923234, -0.0039608917762841344, -0.18300748413320855, 0.084279876772937426,
+    0.10151691388234448, 0.060911449247294747, 0.041277574879386589, -0.0020234029446269349,
+    -0.01238841493237563, -0.1116209553601642, -0.14088279816467417, -0.049665848244418734,
+    0.087059000720491317, -0.13431793064098391, 0.12846712760062243, -0.069124399264701333,
+    0.078368573227739907, -0.13046554371736382, -0.12642852077206249, 0.011099250737652562,
+    0.13228912304913398, 0.032853084208772546, -0.057053475739311944, 0.00030845476621469418,
+    0.10989122112451301, -0.034055640827868237, -0.01661117478456935, -0.032859517008582237,
+    -0.12517066125129603, -0.030214348523069014, 0.13776785890490736, -0.08739732740124917,
+    -0.057684105660954506, -0.00087312004233201432, 0.015282870585842316, -0.07282650773404431,
+    -0.083876278240289703, -0.16576132470057348, -0.12349739214200872, -0.11150463109330687,
+    -0.060536906282111426, 0.01015066763645116, -0.024375398314597722, -0.1756424510163315,
+    0.096716670855135856, -0.058868385223352783, -0.049974369863407975, -0.11246708362544196,
+    0.028008982481270879, 0.0096818055318524561, 0.047411914127453603, -0.018761149974089536,
+    -0.035089369167674224, -0.036306713695431196, 0.29690102054498368, 0.13111994540398603,
+    -0.17969652489344021, 0.043872059792442332, -0.076877437127336773, 0.17498473632694264,
+    0.10425333785142876, -0.013476545830422999, -0.088956242869679902, -0.091527317227753258,
+    -0.09936131364441797, -0.15139583251037902, 0.12455219869404917, -0.14997546926488137,
+    -0.012470476336916838, -0.0063278341231597411, 0.027181321121079488, -0.13791579571866439,
+    -0.076324015656035291, 0.017226915696943516, -0.044008847365584781, 0.045411272486997556,
+    0.0035749981227186502, -0.025724968067870529, -0.10067452311421698, -0.10626727130239355,
+    -0.065571933589203588, 0.1081510325618192, 0.02851017849202735, -0.068974734417373715,
+    0.0047899700776245051, -0.070825949091532114, 0.03242246243022915, 0.10447486288874613,
+    0.07296743629892441, -0.01484716844303223, 0.055844838439939849, -0.038620386067575452,
+    0.053213930751227545, -0.081314738062146966, 0.18434536197868781, -0.20176497991325715,
+    -0.04895504415657919, 0.001769449730353383, -0.047120157878102323, -0.08596796979561612,
+    0.036192442281892383, -0.18737709605531791, -0.03734929768362568, -0.01674600533264738,
+    -0.13339439814386467, -0.076920481178054514, 0.19692822433661589, -0.093637854063709836,
+    0.14829730566651375, -0.1423277940305385, 0.022641760169643175, 0.10795482435085856,
+    -0.045843011201965739, 0.10780854314386144, -0.074281594620097716, -0.031852641582529331,
+    -0.036286399564407983, 0.062334089779993052, 0.11075360853687076, 0.01663628419330344,
+    -0.0069892611740975776, 0.24351645782320652, -0.082466007662885754, -0.17195807631112792,
+    0.11228331744316265, 0.034319951459850888, -0.0029121056010956489, -0.075008399430674208,
+    -0.036584684350791548, 0.13381264169376156, 0.09643696408177925, 0.021770213135062264,
+    -0.13096771693263545, -0.092882403805399749, 0.19352835737937057, -0.14041104149318562,
+    -0.062455976419815165, 0.091623378394878677, -0.029957071489176784, 0.070497272352071774,
+    0.0018243355830198868, 0.021589112726598185, -0.027225903369869631, -0.055945967466483774,
+    -0.15517694047521674, 0.038250924440609915, -0.0013528685234203942, 0.07410417886653492,
+    0.031592627907397322, -0.14437696213151371, 0.0024455245624240562, 0.085270346577906012,
+    0.0061264833092171626, 0.074626267574847208, -0.10469120682394834, -0.043967158362694464,
+    0.05464372888140874, -0.01116496070306678, -0.020207858437044108, -0.015872321723236195,
+    0.16404116678798963, 0.089266039188922952, -0.056541984585908069, 0.071613391690023759,
+    0.095635804050185902, -0.14859988752832029, -0.080400143665507254, -0.055738604194761301,
+    0.023906901405158325, -0.08519630534397224, -0.0096239932142602874, 0.013392501159805434,
+    -0.1431401828932489, 0.14739005990136761, -0.0011241688009734638, -0.070945794077986277,
+    0.089221533509298276, 0.066086701919396182, -0.059550077189715306, -0.092386365465477335,
+    0.23543743096347966, 0.06805233444326407, 0.033152401140026974, -0.15098412008068576,
+    -0.052048695870219631, -0.10847347733491777, -0.077542466427421505, -0.11445577963044247,
+    0.047874479554191662, 0.21027521701325502, 0.12426389078438072, 0.074810919978175822,
+    -0.061735989753295133, 0.15127751488477431, -0.009156412111309218, 0.0090088808272631073,
+    -0.074715995626850551, 0.029896375319708637, -0.033839894032912647, -0.022551095103177505,
+    0.10747825760434804, 0.083527214753944978, 0.072706601865385509, 0.0016167431981259505,
+    0.074395673772619561, 0.004404016702017702, -0.19077743808420503, -0.11867171978000877,
+    0.045484095544145259, 0.013476580954408061, -0.020110298848534006, 0.17693978175539865,
+    0.040758410095955828, -0.10905249232309247, -0.1080850627360101, -0.01429338484226475,
+    0.078231995230548398, 0.11344321483749453, 0.18656691596790206, -0.050420213723170786,
+    0.0318099308847761, -0.10014587453054949, -0.041938851048364492, -0.18311048603396021,
+    -0.14348155572369983, -0.03457735340858803, -0.1425839104064677, -0.10732513410030853,
+    -0.12298518886994447, -0.092704577304601757, 0.0011007106200581424, -0.037198285519374687,
+    -0.13869702520133828, 0.070175885348411585, -0.0015520159218189787, -0.10635947397977677,
+    -0.027285519261034286, 0.041320719797352121, -0.028135529828108585, 0.026795126641461425,
+    0.030976087400627069, 0.041773615453518778, -0.03565515967702531, -0.084622116476871331,
+    -0.0020662535178697476, -0.0051577370809892465, -0.051357398751367009, -0.076394717464856016,
+    -0.065803095704687273, 0.0013240314211199829, 0.01538677560345213, 0.083703892675149938,
+    -0.0095489872979202771, 0.097032251752232637, -0.068132244352840335, -0.092921453338670981,
+    -0.070672398925624311, -0.078792783427137317, 0.12050290754364051, -0.17438103912530875,
+    0.026855670917652397, -0.02900194956930734, 0.06955492226952345, 0.036314809699127759,
+    -0.042718830070804917, 0.20122318548937551, 0.095901544828913443, -0.10954961013742801,
+    -0.10858546117869333, -0.16542442267252871, -0.044580711833935659, 0.0036764353911847461,
+    0.1346019946301682, 0.16539088520719336, -0.047855682642689294, 0.059736360877548952,
+    -0.0062591207504849701, -0.0014509419790590368, 0.11371190000449528, 0.17088761252860807,
+    -0.072876902591708911, 0.13547619360235466, -0.14115489755139971, -0.069178820998505586,
+    0.029238376272833041, 0.017437793042287177, 0.13571134881414945, -0.064337181893705297,
+    0.059627252833076551, -0.076157220564512088, 0.11154026139797604, -0.09510875646615527,
+    -0.012342431992558885, 0.006970620392457624, -0.11149878125599728, 0.053200100934680937,
+    -0.15452807039892616, 0.097262834498736669, 0.091483292466120705, -0.16162055894835706,
+    0.24332006046827795, -0.009639549917607456, -0.043322265943413672, -0.08600797187595316,
+    -0.2051405844540769, 0.028033505989376185, -0.067317668533705799, 0.072427445127270437,
+    -0.077311413538990501, 0.096899179903720711, 0.0038792054365236295, 0.07578645298048263,
+    0.038811928114340984, -0.14073594067105016, -0.027316689243330451, 0.10966752621828114,
+    0.0059551856139159927, -0.11723509559221351, -0.037899736989174211, 0.12308956146749817,
+    0.085266003988518455, -0.0036243948675569546, -0.10349773271754824, 0.26429711642121417,
+    -0.056873233486114089, -0.086913245529309693, 0.25053672411980898, 0.0016853585838165781,
+    -0.0006895089619245459, 0.085805168682217672, -0.079425726967533666, -0.13194375783378828,
+    0.19408759865406983, -0.15000547997253755, -0.076517546579798354, -0.065998550513883272,
+    -0.12328579498333629, 0.023720980283062538, -0.088152170939900562, -0.13124031085264032,
+    -0.033908622061787741, -0.010599217756317544, 0.013618040212434807, -0.035278561743722278,
+    -0.037946006484025421, -0.15639188299369353, 0.014029479893752876, -0.048634221002606934,
+    0.05909169620563326, -0.14881767982724761, 0.081762641103924907, -0.14610061798746013,
+    -0.14026304400314304, -0.10684089945431408, 0.039189571574637774, 0.0024492090345326584,
+    0.053459306446907849, 0.12950038349585283, 0.04841382304045716, -0.036121858138189675,
+    0.019001610732157271, 0.098218640922013198, -0.089192230254111243, -0.024366574929203043,
+    -0.073077481279423345, 0.017512782047845246, 0.14934224438915081, 0.072998797543628077,
+    0.07077433720533266, -0.040196319420434244, -0.18148227308355544, -0.0017874405382420602,
+    0.11221101091675115, 0.080537695688785924, -0.074535968257787896, -0.025745589270137845,
+    -0.021953466730231935, -0.10499236901868013, -0.0088365954766894943, 0.14636533763965431,
+    0.012351606585878146, 0.15658946036686433, 0.024536769869844155, -0.0083499138116148505,
+    -0.071472039284412314, -0.031078637313559317, 0.10129682885300975, -0.1996657353440946,
+    -0.00093223189239539494, -0.08272027228596171, 0.14687185879037465, -0.013834722082218871,
+    0.078750788001720737, -0.17300243791502834, 0.052931904274398617, -0.08205642975375646,
+    -0.11881213929100037, -0.045974985446929233, 0.069465857598161221, 0.062839995219402256,
+    -0.07640403393027688, -0.12946549624376411, 0.034247321027930308, -0.041615061318327408,
+    0.094425589563575732, 0.078785790151147533, 0.26864392859130848, 0.074360152839014773,
+    -0.069546362688265931, -0.0001900166107700303, -0.027263713721628176, 0.12403247102946448,
+    -0.13193914025992468, -0.071120989945583996, -0.10621210992365759, 0.030000333083602847,
+    -0.05312263271809628, -0.13653646143920015, 0.073285062294506306, -0.0067933811671965806,
+    0.20364238490166595, 0.1514563895813732, 0.0047903592589013276, -0.07011906810300185,
+    0.0072339581111840225, -0.074896476073135529, -0.026300812077742125, -0.17872891891916856,
+    0.057085022315870253, 0.11185252586677229, -0.015014046375779164, -0.2199166594259869,
+    0.11533938446510057, 0.068120246609153903, -0.089708595897867838, -0.080710558077958863,
+    0.002849020779577474, 0.11161204319983931, 0.047629329010218935, -0.037584012456066553,
+    0.20645343133311586, 0.057476749737970123, -0.044757089712805752, -0.24022409165441025,
+    -0.034438325160623222, 0.043779469806961326, 0.0098018216154698405, -0.029040217847426976,
+    -0.037944758876443364, 0.074231254218882131, -0.12370748797298139, 0.12150669010057069,
+    0.11198290037910463, -0.16407713612736854, -0.061007629311019385, 0.027788598171451274,
+    0.028274261197538411, -0.04203569227884258, -0.12228392630163994, 0.12365263528836468,
+    -0.0035319582785729984, -0.15140439572554165, -0.050090694475698465, -0.012984145002668682,
+    0.1120355149588326, 0.028072247762934679, 0.037537542882343025, 0.21812611740230214,
+    -0.090772706021489902, 0.16441661034956734, 0.047199711741533784, 0.01864949606162826,
+    -0.076923827160447378, 0.057361305296584536, 0.25000756665483004, 0.10950638176114297,
+    -0.002617952114519189, -0.023809632226222635, -0.00043613846277638707, 0.13138090132343175,
+    0.13279287752305641, 0.07943364596717721, -0.04571446562757573, -0.063831872235517936,
+    0.035087597274653347, -0.002691747294153589, -0.0051372891295023756, -0.016712539556010323,
+    0.032258849455467524, 0.013773866582565887, -0.066680514936007962, 0.080445631426418696,
+    -0.0076901512166726131, 0.0012714195578806219, -0.0061054318021907675, -0.0065877061062160546,
+    0.077517914316701797, 0.12012243637029439, 0.074586277290887154, -0.14748317431872815,
+    0.18551992042182175, 0.1046505828535491, 0.0048826022702279648, -0.16741218188736115,
+    0.094337472440488679, 0.052843394470006445, -0.043092481304657801, -0.028535003491374358,
+    -0.088843948473932594, 0.056224004996505067, -0.16390747727900171, -0.18797456585736214,
+    0.16580522827320554, -0.044732316156065044, -0.011708370076556795, -0.17371214472683222,
+    0.027009264039422578, 0.21630167713628837, 0.039446007564599164, -0.048076274962082791,
+    -0.17072621050306272, -0.09608341742114293, -0.010498866019240202, -0.14556079215171858,
+    -0.034718142764938349, 0.05432287863706501, -0.0026296228807918365, 0.016272972530742842,
+    -0.048979289873628554, -0.15504903949825066, 0.06755317315444323, -0.10587538139929753,
+    0.0056098412365271598, -0.080199138163272773, -0.042644197786657914, 0.068181899423207251,
+    -0.023199596100164307, 0.13356850514014812, 0.072094451902085743, -0.060152559181837872,
+    -0.049752903243173108, 0.14073029295741976, -0.12022720069122324, -0.20754939014927076,
+    -0.05967843492316699, -0.062383792501623986, 0.020428957783851245, 0.065802111775873653,
+    -0.019950592315256158, 0.069324753221904983, 0.10563294346914504, -0.068091395809314906,
+    -0.10690179897274284, -0.075627203480588129, -0.12584119335474006, 0.13304346078843296,
+    0.028060815588564793, 0.063439502880207832, 0.0010160023725404724, 0.09669886599622729,
+    -0.045766766092161459, -0.17935533401097725, -0.056893878893318088, 0.13174499945910459,
+    -0.016939518379952122, -0.056913819976979065, -0.027991358384673471, -0.069004818217133196,
+    -0.027907744413460403, 0.077649094748882888, 0.058367034189309143, -0.0052396669868797624,
+    -0.19572806185075955, 0.029807728731851155, 0.037153737902327379, -0.039299506882949829,
+    0.18553664268295306, 0.063643328003031241, 0.067022514881244902, -0.013262006286815099,
+    -0.008915020787020958, 0.19151875319407338, -0.1142707970823732, 0.17454285385788013,
+    0.11065376478602199, -0.10133919541915269, -0.12846647992759352, 0.0035929820605991726,
+    0.041795029544757167, 0.11583210284553778, -0.085623896714345282, -0.081916056109050783,
+    0.14264665419762712, -0.094395010084692546, 0.0084686997392164082, -0.1753206763949838,
+    -0.1546083635527562, 0.059097300091734174, 0.066238388761636888, 0.092085117302032893,
+    0.020247521389822387, -0.0330403237210019, 0.077596866877054235, -0.013314870992681303,
+    -0.022711727693117519, 0.054963526346521754, -0.1645698664543582, 0.034820028218183745,
+    0.037323465744417576, 0.0730044899508729, 0.008880722085272923, -0.0056181190544647777,
+    -0.0061960587060861331, -0.015321547845740713, -0.12912849708371921, 0.028935924637321631,
+    -0.048205129849947771, 0.14567792511189939, 0.14943018282207324, -0.012877604423735679,
+    -0.076774206934217243, 0.070556228979810676, 0.028660445937581682, -0.07776865107879101,
+    0.040457418176207481, 0.042578202823342522, -0.12264872887222032, -0.16457602944168992,
+    -0.043157608269612284, -0.026590280151599161, 0.01209314165396131, -0.094721102193894804,
+    -0.021452165918221272, -0.11126930253919123, 0.12546378694070046, 0.052449288404775501,
+    0.15339053163235039, -0.034593674441574719, 0.13414915325989565, -0.090831748441773011,
+    0.024828321344385566, 0.062425877627554228, 0.016403059923228436, -0.034412605484192699,
+    -0.015470336496265523, 0.13882397550845177, -0.024133146100972652, 0.17571444955317403,
+    0.0078294369893804183, -0.011340925780214683, -0.0007924804124130175, 0.071573095266695447,
+    -0.057621792070960819, 0.059877008617637971, -0.070885893487709462, 0.045799841101934247,
+    0.083844333896280848, -0.059044401640743038, 0.018796586793748706, 0.071892706178480106,
+    -0.077694872211871796, -0.16171221721751319, 0.048080607399787784, -0.16448393488026053,
+    0.23669355221992366, -0.16363505073742773, 0.016233330639718099, -0.041602564094195611,
+    0.055149924370751606, 0.1110294405792496, -0.078812716383133405, 0.0011113203278984404,
+    0.060473628148938516, 0.064712151755913064, 0.23270769684217585, -0.26112239926908265,
+    -0.088848942688279114, 0.06783127657223402, -0.15642516795006092, 0.2785976609748399,
+    -0.085627279291274491, -0.10535773929611583, 0.056134582253973435, -0.11091191905082634,
+    -0.069032887794881356, -0.21518367849205289, 0.073925023255134753, -0.13327754429280522,
+    -0.043737488860203705, 0.029933453912922917, 0.19612060880773238, -0.051185620750811803,
+    0.12516113853689737, 0.046515085591478621, 0.059631342774820115, 0.13068144638408902,
+    -0.054161473359632173, -0.27542995096877432, 0.013928697466874548, 0.077979639763163563,
+    0.0043280795826353075, -0.10571675456078033, 0.16485540415932162, 0.076404657217959332,
+    -0.14040542932820776, -0.22960614788608666, -0.056555116016024379, 0.078834390436447993,
+    0.011899519781487776, 0.19504306165888027, 0.16352956894409854, -0.13694445894045296,
+    -0.11587072721442972, 0.12474252147258341, -0.065715650045477914, 0.14797628593465714,
+    -0.21895706245400468, -0.087389440117148456, 0.12850547194130199, 0.033167023236119725,
+    0.04831883525905941, -0.03939641665211123, -0.063578969070265584, 0.019343281952924837,
+    -0.003480589656645178, 0.081488595020489205, -0.031684230228429103, 0.11268904374301159,
+    0.070938641386634249, 0.030768261986958968, 0.032601996180017509, 0.14543431571413462,
+    -0.038690141154337561, 0.076412884237147691, 0.018633558896402485, 0.022278559759211954,
+    -0.056990194020857719, -0.036028441648985055, -0.016843488520086776, -0.19048868897713456,
+    0.051369924573340046, 0.016743310090620356, 0.06480987515832827, -0.06519739416903092,
+    0.059215518421745918, -0.067891794527882951, -0.075180611425122876, 0.012364130687478173,
+    -0.027224217788721018, 0.19577586577356274, -0.033690019572943153, 0.043456076617465089,
+    -0.15902066248401925, 0.20504444143147296, 0.034278266063421964, -0.0099569805032352476,
+    0.014883004197187438, -0.0064678501898621683, -0.055384630754717001, -0.0053765133695968161,
+    0.032694581025044668, 0.075303233788334187, -0.18980901505767903, -0.12813635205727983,
+    0.040510974357853308, 0.006961610949998932, 0.18430440824969352, 0.107237146520014,
+    0.025602850670680185, -0.018265458622470056, -0.012127199238835477, 0.065907141179591011,
+    0.062041681015687175, -0.067533750345150786, 0.1635358256365699, -0.14499462676189853,
+    -0.036013709702005021, -0.1263849579273145, 0.09221178655929807, 0.10372176551021374,
+    -0.045705111396022881, -0.18421905056859689, -0.20780214741489905, 0.15681861806197342,
+    0.22601551062555145, 0.10172845324620135, 0.15596982751780722, 0.038759837301556868,
+    0.096384350935740937, -0.004868786493567848, -0.16157734597422441, -0.2140686281142089,
+    0.14812144761841961, -0.015607691711992276, 0.017666984057884881, -0.00991966423999786,
+    0.15150289930227578, 0.024976551093867316, -0.14504280592616159, -0.0032320542459919692,
+    -0.051359401926049764, -0.14363517538088119, -0.054476862261462367, -0.050312138267955872,
+    0.13676557445716234, 0.19161016123753052, -0.026972311369787682, 0.074017451721724178,
+    0.13624347454188063, 0.25015715430654389, -0.0033213887090767385, 0.15067781917630182,
+    0.11743233986328916, -0.05789873878922, 0.10735343042532793, 0.0092379292466755001,
+    -0.050762168217986868, -0.025798558075180701, -0.079574293901496548, 0.10533129855615848,
+    -0.067641924573742018, -0.060506822349860941, 0.015710736313341554, 0.19707459188602641,
+    0.20726804523308653, 0.1024022257997749, 0.066142246330433876, -0.054280642140359901,
+    0.064484124364080728, -0.11652193511128378, 0.024887772606539616, 0.047117243804518899,
+    -0.014663144212941378, -0.02210090531413432, -0.034823267412281353, 0.037994100247848488,
+    -0.067857441862532605, 0.031168864348050596, -0.0035122198940493797, -0.096776973460286297,
+    0.23651356092357745, 0.07182702731161307, -0.034167742991574018, -0.013521909928502461,
+    -0.13287678840507131, 0.080452034270045825, -0.14253608521771019, -0.044676120093663653,
+    0.065819281192953924, -0.0037903887981944155, 0.030403219083291955, -0.07121635341222797,
+    0.14200019461861585, 0.19755602750979528, -0.061923465284905069, 0.088846903762967652,
+    0.086439136245154452, -0.026283712529672595, -0.10183474992517093, -0.018525343562850568,
+    0.1237726312330974, -0.012940130994876432, 0.044912751001065621, 0.0064477515020663727,
+    0.12236813329215557, -0.068538551525832769, 0.16482173386135351, -0.10441278502998669,
+    -0.033712671829137071, -0.063274896131778086, 0.21300112029356769, -0.12278008196805537,
+    0.11653511786830875, -0.041404838147561664, -0.21262847205595903, 0.12379939462796595,
+    0.029215493317757621, -0.014814305166201259, 0.022224576013531464, 0.10429061429928571,
+    -0.052024229736848615, -0.016585730239584397, -0.017717520418744651, 0.074411078378423146,
+    0.030699729551299699, -0.051040982697218365, -0.2005643347390588, 0.084907050576641982,
+    0.12256430511408345, 0.0072159167366290912, 0.10193153457573759, -0.26656722440274816,
+    -0.14574020904419924, 0.059114753723269312, -0.057038548430288549, -0.018635208338638128,
+    -0.084848128114324767, 0.046901723890142751, 0.062903324109849265, 0.0086080930549429103,
+    0.0094818541167288883, -0.096567399354080652, -0.078311812770320746, -0.10121180105206701,
+    -0.060788603231298477, 0.070383449010433183, -0.10493099505440456, 0.10115347947006528,
+    -0.001648287053341929, -0.068146501764471942, -0.020206732456546833, 0.046326653129802622,
+    -0.084750691658761743, -0.038002910461957411, 0.025873468745329094, -0.036535015535087402,
+    0.06865147161982825, 0.13471417838781538, -0.061800633255876009, 0.019025047061863667,
+    0.13646243815079201, -0.25321743000363911, -0.14286992844054991, 0.088968543339902451,
+    -0.08362962790143183, 0.003085662302487923, -0.03986772010748596, -0.026132331227510665,
+    0.033253713124094759, -0.058574033305123591, -0.079685895128493736, -0.31753866372896011,
+    0.11631414970477916, 0.078055069151180712, 0.046405691503817431, 0.0048681923448823279,
+    0.13440502309573504, -0.03049459238894825, -0.21196363553701808, 0.017696636340597396,
+    0.30837344665395477, -0.23601850457616347, -0.071461255117860834, 0.030901877989234078,
+    -0.099115974811794391, 0.14037737031010492, -0.12513775788252554, 0.019471403393371049,
+    -0.051427745743672454, -0.12824882099674409, 0.086985811312389194, -0.0022664685348542865,
+    -0.054502805440833371, -0.12549504795768643, -0.25674871530706384, -0.099501274148167951,
+    0.077998482171705449, 0.072849254378015482, 0.17727338984138061, 0.021428910907503849,
+    0.1020393364260305, 0.13741174238251733, -0.019263436890932177, -0.01472430714858378,
+    0.022961042062574231, -0.13394492457740981, 0.080009496025318094, -0.14325888097508152,
+    -0.079360165821085904, -0.046635286259666564, 0.098629282800530349, 0.069212386967221706,
+    -0.0046045866481337488, -0.028548715425920176, 0.060054917098955864, -0.093445513684861495,
+    0.036486146131473843, 0.15012362480402219, -0.07914420968481016, 0.051325074630968387,
+    0.20540888838334195, -0.087271728741076721, -0.094256810429466972, 0.044745419635731178,
+    -0.12664102557996071, -0.013683520652321297, 0.069242046487854578, -0.10541600308805193,
+    0.042913133505903485, -0.038494382239902869, 0.012675717513752065, 0.013276003744100005,
+    -0.006057831395301575, 0.13973770517759021, -0.020310231896196004, -0.16471996430572103,
+    -0.032296523865058879, -0.066781805176718778, -0.026577308691596052, -0.14809115743407039,
+    -0.13726678467845427, -0.042755727276318718, -0.058807568455467141, -0.17207756729326307,
+    -0.046002439632416507, 0.10260531496721946, 0.018114760509593812, 0.11266248505650019,
+    -0.045955354220551886, -0.11573816322285516, -0.12623501717671073, 0.084515855837479462,
+    0.090819269880262926, 0.075776886848544681, 0.032250344845114153, 0.019928068745591446,
+    0.084813387212430785, -0.0097993624079161807, 0.15200024383131591, -0.080705647091171923,
+    0.10730107229374018, -0.11804574040037719, -0.11280498604867464, 0.030597237820751067,
+    -0.25578411982995214, -0.11004739334761598, 0.033533806945333963, -0.072561115408957322,
+    0.048102910698120324, -0.071328056254434655, 0.10873329641652046, -0.070141208043406331,
+    0.20460296214960105, -0.0027610457026207708, -0.0062867218198733189, -0.008199390143846793,
+    -0.0078416165211335764, 0.0075330359924000072, -0.0010980447424496522, -0.024399768507204444,
+    -0.016431735271385455, -0.24299741675887065, -0.021125353529270613, -0.026358119366260674,
+    -0.028518595930291591, 0.16724878675606075, -0.10848984016851111, -0.10444885259002164,
+    0.12814798905829647, -0.075192517797032954, 0.018954786834984069, 0.029596837868740462,
+    -0.09110036930314365, -0.021161814739840575, 0.035171914970395714, -0.055445465611520396,
+    0.031003331783896044, 0.0079478750970964612, 0.070450041484574039, 0.13095461993852747,
+    -0.22156314212990647, 0.03376870467001724, -0.0046088633323317632, 0.16890646384674601,
+    0.034530312376854576, 0.014839922725567715, -0.12703964102564397, 0.0036856119120023106,
+    -0.12414246100669324, 0.01738309965005291, 0.065079573374413016, -0.25333821974815485,
+    0.047290890925126443, -0.0081323735386251653, -0.15020947369816773, 0.057652846373335759,
+    0.10551816124134383, 0.071870975488147998, 0.021799414913744382, 0.1717215684509128,
+    0.077398238373276501, -0.084902618029646923, -0.22039649581620924, 0.14374857669403837,
+    0.093467477920851777, -0.0032034886893723587, -0.14722429838896131, -0.041610517190988128,
+    -0.039044306241553819, -0.026113826740186471, 0.12452147461960328, -0.13719971808437117,
+    -0.091252782016733758, 0.063810503208465305, -0.010715477899504935, -0.066267098022238902,
+    0.063133950020803756, 0.091740589387621974, 0.047517724449230386, 0.026912305193102733,
+    0.016265198577258031, 0.056781194195494683, 0.13638020425886296, -0.02003985155445354,
+    -0.016366559065254284, -0.050334277383468476, -0.15570811649429761, 0.083166521558481268,
+    0.1040935089491099, 0.039652327063990647, -0.17917189754482676, 0.097902491991114796,
+    0.085753112711982993, 0.079686391145590812, 0.15855955692291168, -0.034643815580140125,
+    -0.016856018903389162, 0.035803289452887209, 0.043058329269144151, -0.037017880480897755,
+    -0.012205680725075564, -0.013267858836234648, -0.14032215132872852, 0.0025957432686467392,
+    0.09630085339562218, 0.064873295148540455, 0.21244855673885424, -0.021919458006507124,
+    0.070048050031352727, -0.033191924273117714, 0.020102208585869419, -0.055137002811615578,
+    0.22900178582891184, -0.097933688568199923, -0.12179329357065211, -0.1475113100375699,
+    0.044855006763372424, 0.12782687827908268, 0.030645932590745481, 0.077507241240390462,
+    -0.0028898894898324924, -0.20948585849527307, -0.081997902410541113, 0.05097230313804138,
+    -0.10598145205643701, -0.049049223437167354, 0.037470953041296239, 0.093555459507194044,
+    -0.012493926072818917, 0.03539997906034268, 0.12088342206195622, 0.17320419913212948,
+    -0.0041135170140441674, -0.0604360893270868, -0.020159035505702451, 0.026723713685821788,
+    0.0094975274568972583, -0.16817994309250028, 0.011632572632659783, 0.1269540824540448,
+    -0.019773007356266095, 0.058559123780363292, -0.062128661021352609, 0.058493472523171733,
+    0.03975704483124172, 0.12948804573020659, 0.14477997542670615, -0.18649660866115136,
+    0.011952700459356038, 0.13946023608899538, 0.074978317613191306, -0.09474041115433679,
+    -0.10160882383454783, -0.056688641997294176, 0.079915993768877425, 0.034886754451616424,
+    0.10589813095830568, 0.10047593067190314, 0.1016508394688298, 0.047958335802783414,
+    -0.047296277544515243, 0.0032127997044137328, -0.10229873246059523, -0.030923366378093356,
+    -0.15877147206609671, 0.049484449670722949, -0.013419747877405741, 0.14311559978986557,
+    0.077617895444409279, 0.028250766105733873, -0.014040655600492367, -0.13275789444762084,
+    0.047717356250458857, 0.025499438754834743, -0.087594817322801555, 0.031270677401757652,
+    0.042459894496602264, -0.074869235104502871, 0.010312446361786999, -0.093170943411185772,
+    0.082421776838727201, 0.10569180633583873, -0.089060604502607388, -0.069025343524704991,
+    -0.012376813730085609, -0.011204423288708337, 0.04380527561831981, -0.1706712420662623,
+    -0.10713392358661156, -0.048317092458951924, 0.14156572184108096, -0.073793683552627484,
+    0.1322641909287546, 0.034732827597506184, -0.069348242221804565, -0.14204188779660307,
+    0.02927453355449184, 0.082241655209639594, 0.02705062292617081, -0.11731737449321133,
+    -0.10118033196873466, 0.06653022904255243, -0.02517966291544739, -0.03728488991179945,
+    0.06785841818118217, 0.18431216925016158, 0.0077270943307410538, 0.11482760814801199,
+    -0.067368202561504775, -0.12623648215221786, 0.18433678777996826, -0.18934558777923127,
+    -0.11987252839360352, 0.027871368732379449, 0.059438575159861277, 0.027030850502764742,
+    0.18562922406467011, -0.043284716921428566, -0.15295557107567431, 0.020198995685312963,
+    0.0033207734585214729, -0.060421733060518255, -0.13318030620982915, -0.13131091072217868,
+    -0.0076596641101408687, -0.13088104861027033, 0.25229203382672488, 0.016432799211523616,
+    -0.022029786367063764, 0.056076187672408288, 0.003081269337976038, -0.11183176882007158,
+    -0.057402140342332555, -0.041488539880134449, 0.0083490288731250979, 0.072217202375656292,
+    0.088709947110637538, 0.11818729798171418, -0.090930897305220679, -0.22242451842060507,
+    0.027404622594733488, 0.028939535727654349, -0.10283981393449732, 0.031806796891368283,
+    -0.12351527011787457, 0.09551998770336724, -0.027142113041471558, 0.13545129012276924,
+    0.34830683350797359, 0.052667805215154746, -0.044123167862259866, 0.0036021004298114031,
+    -0.037438241549636132, -0.20454796577313877, 0.2371845152804882, -0.2258880002710523,
+    0.014283867230369052, 0.12735926347700482, -0.004722981363872716, -0.012178705827622413,
+    -0.050743678861771828, 0.065307117739394113, -0.043789500621119838, 0.0085100399148332305,
+    0.06879071979195063, -0.24554913911702902, -0.04336339590732198, -0.18495500393552228,
+    -0.00066814844691574478, 0.049467802621129507, -0.16350968060669294, -0.18747716751736704,
+    0.21964470435495489, 0.021644509734462709, 0.11166695890403962, -0.035281583140149016,
+    0.017312851019625142, 0.33559381572141034, -0.0084207911078015979, 0.057422103098030343,
+    0.044759816803706672, 0.17582069806652539, 0.051875242132388401, -0.24929115566316784,
+    -0.067746682958192445, 0.043189201123481985, -0.071869171746388336, 0.11771254035362669,
+    0.066413028731511822, -0.025994410748731364, -0.1054895815002779, -0.049740860937397519,
+    0.10731573264212206, -0.0034910323931046957, -0.046755088254716998, -0.16440658570504915,
+    0.079826267918822108, -0.085030526994612249, 0.10986380488957925, -0.1313051204713358,
+    0.13598238722248301, -0.10878286112769182, -0.051055811976579588, -0.050157032194662797,
+    -0.24925196853114548, -0.021637409224306667, -0.14962920344739952, -0.18939742032222512,
+    0.095375795871053978, 0.20357395422542651, 0.079097860134212133, -0.010218192286820861,
+    0.1499771738245069, -0.0046371413964674639, 0.023922130441583693, -0.097249409473271084,
+    -0.056249748703374743, -0.13771960667201305, 0.0094036039803168242, -0.0014304873604075903,
+    0.046101644135573529, -0.099558956881373173, 0.077042094671184752, -0.042558445300739954,
+    0.046713125883474503, 0.086982794520861703, 0.026545384717045081, 0.055909314780086906,
+    0.19569436591598621, 0.057587594718500765, 0.11737451874294057, 0.033582159227012458,
+    0.089932355438990974, -0.020965619671974522, -0.043337198953334946, -0.0017239905211492788,
+    0.15593046561279209, -0.074520296173646236, -0.046818968794695583, 0.058635949099434675,
+    0.16313444409533068, -0.14806789208860932, -0.065008973425558891, -0.049053732379841106,
+    -0.17356892678885441, 0.15183543959369558, -0.12230561182262065, 0.10831094121430046,
+    0.024081971952611071, -0.085276512883218913, 0.056730734877983559, -0.11779542351063421,
+    0.042754406916240287, -0.013899802995690023, 0.025111541185244092, 0.12978974929469966,
+    0.067014977786120852, 0.072016122960615186, -0.13235654232838323, -0.17069481258176253,
+    0.048960009978396501, 0.025885541537177655, -0.012689100731047306, 0.0048724408372386426,
+    -0.060490249215139874, 0.15420485245945253, 0.025798269589735162, 0.075912815230979314,
+    0.057294329420409906, -0.10241904303488018, 0.1283863340395634, -0.26638112593381008,
+    0.10895799120540565, -0.022660215494416852, 0.18631643309361823, 0.0027796944793255672,
+    0.060799365709029364, -0.091029710574155306, 0.064924203076114878, -0.20041607851530577,
+    0.10881758886796546, -0.12901736069051883, 0.094372440540626185, 0.010329932685076168,
+    0.12756651427626492, -0.044106279841422846, -0.019965438828592117, 0.017428131208985849,
+    -0.012544794297585468, 0.07859323615266732, -0.03706125786636779, 0.05179074029617059,
+    0.080842352698148337, 0.053932873082634884, 0.024494995805308759, 0.017752728703667998,
+    -0.094713844888135335, -0.10720845118421567, -0.024623941913786907, 0.081590333349007962,
+    0.035072591193495227, -0.10870297488877823, -0.050509464102849753, -0.076598604746652935,
+    0.1051413821697296, -0.0062669518067891145, 0.16360889415330507, -0.0037016582513945281,
+    0.064736679907072367, -0.10154534421872778, -0.12100035621903918, -0.088538705229924741,
+    0.077692700942574217, 0.098493100175822523, 0.10663164714627986, 0.0022634652607630376,
+    -0.038803018833035635, 0.079035368480399618, -0.15937003101168465, -0.12599866976800997,
+    0.07934255212621516, 0.0031839335110964654, 0.02007711759198318, -0.099390938977871546,
+    0.1131123830186591, 0.079057365719261766, -0.20704027593741275, -0.14888040329410318,
+    0.0098388775222092613, -0.12151622422601163, -0.14364518623974412, -0.0013561751097453606,
+    0.053076865645428031, 0.11776090349025994, 0.058622568928894545, 0.027890814173803697,
+    0.025173816425124805, 0.12127326567732993, 0.041499636019954683, 0.045894976846328914,
+    0.1375277091004565, 0.066685542734234299, -0.036706435351646874, -0.052746726184215657,
+    -0.10197280241603175, -0.068463523141384375, 0.051001358937590814, 0.081869730510633579,
+    0.050967474219995597, -0.24961197386643577, 0.064137564372075739, -0.042416647492086908,
+    0.0053037343180976568, 0.068725399228498393, 0.0088972684327667528, -0.026476557774993918,
+    0.066561631165084192, -0.066490532102765523, -0.010591402917127301, -0.088143236355342103,
+    0.03803224990394987, 0.08226821092239095, 0.16289285856585448, -0.0092810421093597328,
+    -0.073551825708298088, 0.070679773274309368, -0.041501167965221061, 0.048889035722034672,
+    0.11134183404530805, -0.021120971744535217, 0.020385996752163297, -0.092871927829689824,
+    0.0099503144574360197, -0.015639022654897541, 0.10386432667103691, -0.014687688541192425,
+    -0.11014727443399649, 0.023221084046550322, 0.188613415001287, 0.20518529242398123,
+    -0.066595554950231783, -0.03337604540437214, 0.090951980117854589, 0.18523297449204501,
+    -0.16569876634830571, -0.057539503495674708, -0.015737350757707037, -0.05160475529919694,
+    -0.012304399365079122, -0.049176791563667818, 0.070917686342360675, -0.03738240349860357,
+    -0.027030879518488919, -0.002565930794435452, 0.085466148155901131, -0.057546462333676544,
+    0.063029998185986133, -0.089804457596682596, -0.089102454870379863, -0.080649154125143091,
+    0.040198105026859055, 0.16330299856836084, -0.10041705670778583, 0.13926139815480368,
+    -0.31166642220014673, -0.048442182206785103, 0.016519645483618086, 0.027028182738582106,
+    -0.11129608131933211, -0.029433699693634338, 0.08582639989877533, 0.053288350562419783,
+    0.023596352675792142, 0.016952428528077081, 0.066606024374359543, -0.19522344510701095,
+    0.082024496455479143, -0.039801459306362502, 0.005628464800273774, -0.019754487137751121,
+    -0.0026467018755406495, 0.085580792366897737, 0.060027102252609828, 0.087609692725088256,
+    0.01261427617604326, 0.064327645502100628, 0.13076044043846582, -0.0088768474661488021,
+    -0.087547674314049681, -0.072254486825836184, -0.11321059824402409, -0.1110223812483425,
+    0.0010059881089528276, 0.0089062151184950925, 0.050850584159983697, -0.28919343127864783,
+    0.19105637192434666, 0.080201334739433319, 0.13427104662461373, 0.0056702150358295669,
+    0.0099836496255459768, 0.23546320253479566, 0.13059981310570837, 0.063274208976703772,
+    -0.029219334338976333, -0.014287705709583052, -0.052503485576911681, 0.0094236808838750932,
+    -0.050507568073497475, 0.046323782214993732, -0.0089131509492641862, -0.13603594246729828,
+    0.10243688748084105, 0.010112970779752865, -0.065959747522750717, 0.059575586401974814,
+    -0.044140798646360668, 0.22556438862602923, 0.064461289055446194, 0.21497864089688842,
+    -0.073047429860136306, -0.026847745549422864, -0.059139346036675991, -0.19441109503527856,
+    0.051557757663115759, -0.1269373077959049, 0.19271173530928704, -0.12056306102659262,
+    0.033892089066009858, -0.15449740128948136, -0.04300934345557228, 0.064230871349480065,
+    0.020600018192133661, -0.16290190228643261, 0.18112616293577163, 0.060755704663143131,
+    0.12859114603753571, 0.12585002166467812, 0.0024104515588942231, 0.071438318568958895,
+    -0.089065372318971658, 0.016206574688824006, -0.13239815885459913, 0.0084269499512323997,
+    -0.0038086927078204735, 0.011975719432783399, -0.12968413236855067, 0.028494461312834601,
+    -0.28901734978154087, 0.11512165859348829, -0.10065880302286798, -0.14086761099442091,
+    -0.089494447778300776, -0.063417015371201008, -0.13227633330240515, -0.091546071299731649,
+    0.094872357858891893, 0.0076124579977960077, -0.065790819409747806, -0.18634988848221215,
+    0.21142252533602673, 0.0041107617786127352, 0.03601627458025599, 0.10992196702759147,
+    -0.33207298013861553, -0.010964077593637133, -0.055646372343116569, 0.077365791132920345,
+    -0.12842926560071061, -0.071604245696471475, 0.020951875996952224, 0.084138063825666978,
+    0.16285431719135002, 0.13192321682685312, 0.11621233334272739, -0.073415396122579565,
+    -0.14273007466928272, -0.063991293054047479, -0.15238263536386806, 0.17501526136767617,
+    0.089488898875792353, 0.083356020359099142, -0.11420580667734623, 0.067957574441924656,
+    0.030840560195870871, 0.022640762626457731, 0.0086286661467772034, 0.070938947902196139,
+    0.037583915000279709, 0.067878372747349078, -0.092518611810526147, 0.10056254585435313,
+    -0.051766373613306785, 0.13176107434754736, -0.01120260678594499, -0.094142599867880108,
+    0.04219680730060657, 0.0585969176001108, -0.010213670121554164, -0.064120622884594275,
+    0.055106006696315581, -0.057995771011674295, -0.069938801615418364, 0.098893562745811986,
+    -0.07447935740818433, -0.012748346583096131, -0.13338385450074672, 0.21354381580304058,
+    0.059126325084511745, 0.10184738980679189, -0.010513709187989741, 0.063209852869805933,
+    0.094284920307155642, 0.048521765943046781, 0.061225071623664452, -0.087088930954646676,
+    0.09285226030210729, 0.030003817417803714, 0.058773267820056083, 0.11028637922009615,
+    -0.16162577813071599, -0.080332676000545583, -0.1463556161257763, -0.034126902696068072,
+    -0.069963800005244547, 0.018169783047866647, -0.084232703881434112, 0.085970323165209833,
+    0.063955362465875479, -0.070405253295922357, 0.12081762468783003, -0.044416681602486616,
+    -0.18636076498398241, -0.0061366569823129843, 0.062723335491555149, 0.0026650387706868037,
+    -0.14730812932169979, -0.033557062044526687, 0.12472718467904705, -0.081627116882654949,
+    -0.058429257787605583, 0.082081712211004049, 0.041974030904310317, 0.13809102415427063,
+    -0.0002903990965951119, 0.027986760931124028, 0.055651529629066977, -0.034401674783674473,
+    -0.083540971947230813, -0.093829780472650656, -0.056171952486448677, 0.0081285063864242803,
+    -0.032846821059796805, -0.04798979669148714, 0.029577682664648976, 0.091089354759115032,
+    -0.044845939986704809, -0.017439387506453827, 0.13457410130993203, -0.10640220814701612,
+    0.038827165520831229, 0.13389672219236012, -0.085174170986004924, -0.050294586195952048,
+    0.1139392239367852, 0.025672307467677648, 0.11026017148007146, 0.16743573504816842,
+    0.13521715172373008, 0.017521020209929798, -0.072032037702083232, -0.28260700537062244,
+    0.17614620962724267, 0.018908135494852842, -0.22474247495519906, -1.5277715183843994e-05,
+    0.044683906405679714, -0.15748365170589398, -0.053265360607034226, -0.22426136453881718,
+    0.054835520933538093, 0.13260720993724928, 0.19268125753679191, 0.16356549043780699,
+    0.066123363720449066, 0.010725888742401043, 0.00093079263444841649, -0.071421149905756556,
+    -0.21962216267421686, 0.063462995019923946, 0.10593035492969193, -0.034899171068394817,
+    0.095497413904107931, -0.076937777774453237, -0.022521627795723673, -0.20894263840214128,
+    -0.036895222294468427, 0.039671155370079141, 0.041513738319584798, -0.030585348711697859,
+    0.016632162582982436, 0.26186221397377701, 0.065202454323234876, 0.010057024293170128,
+    -0.19146983665118633, 0.16848260943541635, -0.028897903697383882, 0.0042816520894945953,
+    -0.036869055348522049, 0.0030569094936843551, -0.097411728961009164, -0.03212212676407835,
+    0.036021308813187825, -0.041461785540751972, -0.015493925187642246, -0.07842656045879276,
+    -0.073904652928777376, 0.07190561562399099, 0.16389067512561048, 0.069576677950268354,
+    0.03170148641751061, 0.031683796161751099, 0.082027968443352417, -0.051753843458970474,
+    0.0053745271830376055, -0.088933600581102057, -0.11331318471589565, -0.017544625647351302,
+    -0.11756751756551037, -0.038750575692194214, -0.020980563106322327, 0.2035257156833182,
+    -0.11640464164975452, -0.015020855546207084, -0.079176004548167367, -0.12759147819565539,
+    -0.011802960149849396, 0.014221750232308787, -0.21945798901733748, 0.063214420202763161,
+    0.01660048432953834, -0.070737792390373075, 0.058036787410725994, -0.043210006388956536,
+    -0.17208880544690608, 0.058410157643416796, 0.079983026955800757, -0.13494472485287087,
+    0.057775537454859305, -0.11670214630328583, -0.016675576350675722, 0.0025752196413713776,
+    0.17831974191645558, -0.022630967174373313, 0.0049968268353221008, -0.1041880179822369,
+    -0.20497411026143347, -0.030876119083749914, 0.026061297748829034, -0.11128418843482524,
+    0.13543275687203604, -0.034087124876421938, -0.028049219946066004, 0.065778064841363865,
+    0.12764120846059793, -0.12113978024718815, -0.22684958589047918, 0.10870602366969924,
+    -0.0041186627320977005, -0.047311377413850386, 0.20225194173434413, -0.028005466673430748,
+    -0.029595393706600123, 0.034362332671674031, 0.066412081185807367, 0.018745190767832983,
+    0.090426588106353234, -0.023238822080624087, 0.054754986234859963, -0.18403085874060815,
+    0.13067941267364339, 0.2117427623253228, 0.035989955822393276, 0.037893183157983228,
+    0.16683401844650489, -0.011620534813709763, 0.18170729529705321, -0.056706962277771139,
+    -0.094299866046788569, -0.038728642035971574, -0.059924261090459771, 0.099833443290892304,
+    0.22620661686588622, 0.0024630684696644463, -0.16008983376865765, -0.11815828225689953,
+    -0.056407703341474866, 0.019040902500913007, -0.070354114657156283, 0.10306568925354496,
+    -0.015256657894014725, -0.028378002715880202, -0.062959248773018825, -0.0014677882512582174,
+    -0.082420676841505253, -0.081127876078574426, 0.031616583168874626, -0.12918275886620137,
+    0.16742218879980625, 0.097354669782312733, 0.071146602911258572, 0.042081480260255141,
+    0.20105063418986444, -0.080704965311883911, -0.13485381661101156, 0.092777558299552393,
+    0.089995019666968434, -0.13607519323036871, -0.24880409911621079, -0.043208882467945867,
+    0.0019579827443236965, -0.078945214545708936, 0.11087941209497298, 0.067135172380895849,
+    -0.00094145273730011361, -0.033482362385479317, 0.14769326839449912, 0.18600593048114758,
+    -0.064703708458084291, -0.012921657454294909, -0.17630267759069992, 0.026408625834227362,
+    0.19251360471939047, -0.15085651919869064, 0.12219767016792613, 0.055276820438360547,
+    0.035922279976130879, -0.084094906080254495, -0.016955165049977752, 0.051352221058864424,
+    -0.02221094774031851, 0.065068535035594913, 0.072512804952211754, -0.020328998899513555,
+    0.015079376637375137, 0.070279538107654776, 0.11235912826217392, -0.0093049587227941183,
+    -0.024159214035670739, -0.0056605412490858082, 0.087921479428646657, 0.096644808361363368,
+    -0.040261415505073887, -0.0080114800320345257, -0.01354475308720085, -0.12291049416268045,
+    -0.051172802925841164, 0.16520779682763581, 0.084883989065418511, -0.11341722513323904,
+    0.051734653436191193, 0.083515596071716824, -0.087058962316917718, 0.085245690111724087,
+    0.041486363984421327, 0.068782615723394988, -0.021205818648334526, 0.06384943948484173,
+    0.016978947836998531, -0.097899230156572065, -0.2088028861444928, 0.076952854593713732,
+    -0.029161511666072178, -0.028297735140245209, 0.075747403780902611, -0.079024722512628362,
+    -0.028173091037561746, -0.16304926653269028, 0.037675819624472494, 0.06184089126640413,
+    0.048230390812911243, -0.076295168227053026, -0.031692351516853789, 0.064788091026221448,
+    -0.17937410560107453, 0.1936125078418014, -0.011652586432171951, -0.13030906940631889,
+    0.0032798970081186849, -0.19450998430290811, -0.043056788640393251, 0.033022789614446095,
+    -0.014243180715470316, -0.048991850108250232, 0.076372222363854686, -0.0052084408259555695,
+    0.099608523769575658, 0.038765314190300028, 0.1137410868918402, 0.018662978129063777,
+    -0.13216845647306313, 0.0082966451618300633, -0.01945887925141826, -0.069139842882465732,
+    0.023386634260699254, 0.054997209322636763, 0.11543554494628697, -0.16644969257906383,
+    0.021803338163347667, 0.1062160061236728, 0.14534873741321594, -0.13187079786000772,
+    0.19554221475532377, -0.011838662338227947, -0.080136796373324146, 0.015973065788869371,
+    0.016651033988674263, -0.079568018253977829, 0.041808519889163495, -0.023317593946818989,
+    -0.19551724449348937, 0.13515509956508814, -0.028142927378507807, 0.090831887689754753,
+    -0.10890567794934213, -0.052929244280014137, -0.01547175023788315, -0.088231861930718067,
+    -0.13454978127063369, 0.11975123756687224, -0.10474708615751756, 0.08349321828803008,
+    0.039301269931648015, -0.15631060723808893, 0.043713649263941556, 0.17877708115494975,
+    -0.090585532822941933, 0.070436805189880533, -0.064789485437307989, -0.031508923096866981,
+    -0.05473659638331848, -0.10818833875505206, 0.058760584485777916, 0.080171396646093435,
+    -0.0361882160093491, -0.092466630813428055, 0.11813660351427914, -0.06790044392323194,
+    0.010182729393580963, 0.039812712453787993, 0.049841267215787799, -0.13298542256678456,
+    0.28477619617629596, -0.11685147238329024, 0.11541294149879924, -0.15759651675958489,
+    -0.009314808289316483, -0.0016327685061867316, -0.099087925948501673, 0.23049223921800924,
+    0.018807070436128812, 0.067853504499729114, 0.0079725794348919164, 0.1222637371918298,
+    -0.027277604695631931, 0.051590549499979058, 0.0040462066508213214, 0.08393891666108054,
+    -0.021831789623246594, -0.10595033863690362, 0.012038527755120673, 0.023407048224863721,
+    -0.11811484332965637, -0.022089635593621652, 0.020720420673105224, -0.065089779659054867,
+    0.04868317816444704, 0.022490282246902926, 0.18001117018286059, 0.1384565151018427,
+    0.2590128782106747, 0.040040613720635075, -0.16541896240368748, 0.033627306197619306,
+    -0.013727672176398404, 0.060175191277845021, -0.08257434340188971, -0.088067325273485667,
+    -0.051200461868030955, -0.089123105396022806, -0.16570069361702625, -0.11840972207155932,
+    -0.076837227906069755, 0.12258708911020647, -0.027000660150058885, -0.12267946526294618,
+    0.081841799222720044, -0.12127104462338216, 0.10025712011020851, 0.0062682902364284525,
+    0.034546275305217783, 0.095066973297764382, -0.025558301293358423, -0.12078927726279538,
+    -0.10849553268714499, 0.0758035701471656, 0.023311882307255186, 0.080317370198859941,
+    -0.057083590724727164, -0.070199211257353164, -0.022901365391965234, 0.093072312658970244,
+    -0.10617828256567133, 0.052980058515341981, 0.064914150306576698, -0.0228239448561657,
+    0.15770871523621105, -0.089659977463241947, 0.17464756618695274, 0.058107373621410122,
+    0.17912345900918059, -0.040861079420837276, -0.055123300752714675, 0.072983802421039565,
+    -0.13994216959238698, 0.065037980846206975, 0.072241194204447287, 0.14707101666355443,
+    0.019871796200493348, 0.084649333826606429, -0.090608047052483501, 0.14607131628032913,
+    -0.027112263430411614, -0.045977121714256372, 0.045519518707364141, -0.10228960795189514,
+    0.051886333388649251, 0.053857546004801082, 0.045587216980629196, 0.059897351638603283,
+    -0.11890794349700835, 0.067379751442906213, 0.061337998601612181, 0.050146756571883722,
+    -0.071116823292723091, 0.15819722090952984, 0.19933442613160407, 0.19140413915752461,
+    0.12183581758035897, 0.0040670191740540141, 0.02092679735974225, 0.0044873755838005219,
+    -0.055775760484520924, 0.043006696976411525, -0.12012308213223315, -0.1080755433803062,
+    0.098198433079455694, 0.00043560311721170823, -0.066033107232003202, -0.10431403926317394,
+    0.10190476452175827, 0.073792953948709633, 0.072810927731197461, -0.068819259541049546,
+    0.15384602106089004, -0.16773836241642825, -0.068133707111448269, 0.067511308290357661,
+    -0.038244572369358042, 0.15367954200490083, -0.15085738933619533, 0.087383878981202937,
+    -0.053631653247991476, -0.032462068614602886, -0.14152192535745237, 0.11642467888562325,
+    -0.18006546156049824, -0.13744116330956477, 0.086418684360615686, -0.19049660361696,
+    0.057763648812204166, -0.085661683189370119, -0.0097633613022794202, 0.089567426730887148,
+    0.045858956095108108, -0.080294703195933861, 0.0043312954841166979, -0.064277012321866347,
+    0.062225043956816446, 0.019639583130144751, -0.01933501911992426, 0.038094658897899258,
+    0.15089978366950935, 0.11627995944114138, -0.041915814653277698, 0.20590412703256514,
+    0.021782628282844472, 0.030327459685545625, 0.19023993360123037, 0.10521899068701591,
+    -0.020016011808559796, -0.0024028059465720873, 0.0055845956231654068, -0.20318002447626443,
+    -0.030937856531180339, -0.0086535286281933365, -0.08999031034526643, -0.17826759596435815,
+    -0.010640349930380086, -0.0025791268990877064, -0.09094208735018848, 0.086483527181399025,
+    0.093425783627786238, 0.019981127641044285, -0.028333202373051262, 0.10892656493299362,
+    0.013625621300857062, -0.050640149026606143, -0.00061402448599437562, 0.064002365420582741,
+    -0.068334206172675035, 0.17085792810691586, 0.11050542934808395, -0.045905286697260857,
+    -0.04446405080870737, -0.14445778713150556, 0.053275116203162942, -0.027996313550974969,
+    0.040369588392274496, 0.11452989925442132, 0.044457306403970456, 0.068426608417353874,
+    -0.0018866890473295725, -0.16683426462323628, -0.055405048120318143, -0.020682083854969637,
+    -0.059882475521376669, 0.041897019872972383, -0.057942094484421641, 0.27486129691039535,
+    0.051587902779180406, -0.10109383399891159, 0.1059215293984094, -0.16429794371338538,
+    0.13030896259038774, 0.043950373748148704, -0.13226049131724812, -0.16236407645465262,
+    0.21819188074185447, -0.15218870229633988, -0.24657566145355411, 0.033915072576368839,
+    0.0017378778691497421, 0.035949245580137033, -0.083330212115015789, -0.10639194505407794,
+    0.0062860058719938442, -0.023164588713676125, 0.056597893318903497, -0.053594235270582269,
+    -0.11456477981194688, 0.030538044322367463, 0.027133808086293416, 0.013992251767238345,
+    -0.023902546949477018, -0.1305129153981397, -0.099567802548095621, -0.072967845157567324,
+    0.082502947659110246, 0.10887930475801047, -0.13208240231155569, 0.093929460537329826,
+    -0.062451896914661471, -0.044069327184896236, 0.063073671629264402, -0.0063823725741650964,
+    0.10130320914192022, -0.14029536834535683, 0.077678706634817671, 0.14780185063381207,
+    0.10095616802907621, 0.21497586769563709, -0.021797928132820287, 0.0023851757157070646,
+    0.16041493527612943, -0.008856408742853334, -0.1991309024540813, -0.080025579587650456,
+    -0.016039373551408345, -0.10717617524255715, 0.091774960570685474, 0.039422749362722775,
+    -0.050621185682062315, -0.13134374134782498, 0.020863419431951778, 0.14341299246381375,
+    0.071324564866695084, -0.0061017372143035388, 0.0087449444040345395, 0.035706157538800909,
+    -0.037584858498681532, 0.14240235141528004, -0.15901602053315525, 0.082436722216056607,
+    -0.13449084932858021, -0.026398914847615865, -0.06599826238587575, -0.15848768399971333,
+    0.13174861884903988, -0.14497449029654236, 0.012862813695358296, 0.042457102218966897,
+    0.029558599791745736, 0.01530927446692442, -0.0090652980157558977, 0.020510925169496482,
+    -0.021288505717045162, 0.014079798435218312, 0.078252365523896195, -0.018496916287449146,
+    0.030119089703756798, -0.089551038451118961, 0.08572935214620829, 0.013716035134266669,
+    0.21846632618229422, -0.053863714354961241, 0.01220686573438425, -0.10146522259804622,
+    0.17352393719731971, 0.0095744107477140922, 0.0052925227696589399, 0.17893051257852896,
+    0.02517773994887226, -0.03695276611570314, 0.032168333859956592, 0.02725299227855674,
+    0.07531638303682292, -0.01178680940756935, -0.021627493435394992, -0.1076066485656314,
+    0.01028118014471721, 0.09866609618595211, 0.019352745401024201, 0.052599512203922942,
+    -0.0045544485328135589, 0.09759988116431588, -0.14714626248549573, 0.069174897753587636,
+    -0.043509901327960454, 0.051261370665215342, -0.10766441932368394, -0.019538669401144723,
+    -0.12751927029282056, 0.046981970267526464, -0.074143435999663054, 0.00777396105657695,
+    0.10725286029628694, -0.014769786910660616, 0.023305568769245163, 0.0012791981562391113,
+    -0.0049739406458027434, 0.027630795778657943, 0.074809074729799391, -0.1199222995013368,
+    0.011265338552293213, -0.01740748953079449, 0.18482515947340827, 0.013807356869915563,
+    -0.052402761748493384, -0.0022915647105020373, 0.070684133465666099, -0.041308459344723922,
+    0.049033591766467717, 0.098527223147792248, 0.11930104939288286, 0.11422324428913225,
+    -0.25617904617816695, -0.16306817019915712, -0.039840920585070237, -0.061221082187968338,
+    0.11797755589142937, 0.074048434901363105, 0.017911273335088997, -0.10079357327663513,
+    -0.077274104387402801, -0.10944981636564402, -0.091518127789815495, -0.084389044087383708,
+    -0.16353750655056931, -0.08624263938755998, -0.069182727273095115, -0.03489732603499477,
+    -0.05593505493887168, -0.101325439203636, 0.12929839391134715, 0.089274600655950581,
+    -0.1912402055262247, -0.09828840492227621, -0.13767859853412023, 0.18121776956093127,
+    -0.079746002422109843, -0.10009618244171617, 0.0014382113638167495, -0.021808530046621411,
+    -0.053218433143611514, -0.21030913922566186, -0.010034057833288958, 0.15180159446111727,
+    -0.11826601830516781, 0.055773066129089333, -0.020660398384573484, -0.32520199395904947,
+    0.052646750106368864, -0.036497791348776648, -0.085445340838779901, -0.025144060568863598,
+    0.014526053285211034, 0.036590521802921952, -0.053477462057427566, -0.0058691632226956043,
+    0.048014055293283071, -0.012117623121983031, 0.053403506121067965, 0.20946881960342431,
+    0.037692731600630268, -0.012100276144545171, 0.052935313358080431, -0.18025321916185272,
+    0.011893891751022753, 0.036939186415484326, 0.1037332656389697, -0.071499086148639174,
+    -0.072479701915191055, 0.059186579289628283, 0.087646354920767611, 0.077872365128496546,
+    -0.16551900207102535, 0.075219324969058407, -0.18628587002317931, -0.13245594629885399,
+    0.025045693954068023, -0.010918689263783955, -0.0019943950083259939, 0.087422443010018655,
+    -0.24466288107185988, 0.0048605865805742623, 0.11967473114241614, -0.044961186808248711,
+    0.060439842288780521, -0.045031476916789513, 0.03599661300893988, -0.079534826723450386,
+    0.014985728111643499, 0.069712611662546276, 0.13840373109955137, -0.058623406801110202,
+    -0.073870982502648758, 0.14641312627118608, 0.19950116576912932, 0.0097378256425026729,
+    0.089684834080671863, -0.01020692146093604, -0.13678959563082954, -0.17768207063711838,
+    -0.12288681531352892, 0.089779008609860433, 0.044106193425788719, -0.052563374906125657,
+    -0.18616136928059496, -0.12235946271203627, -0.058457231135703502, -0.016368467651970458,
+    -0.028183220515491311, 0.14935219035520314, -0.0074680553142373639, 0.11887227318666703,
+    0.12626119367809877, -0.10207883500011625, -0.061883938897720724, 0.12465760500377984,
+    0.052425743710618804, 0.12328801025933576, 0.075375865717574916, -0.015556555143235213,
+    -0.11724464408547432, -0.054732041740327309, -0.041081990378060269, 0.060461210019941779,
+    -0.040003326857339566, 0.0012219392618124084, 0.22847645033097, -0.12560055619285812,
+    0.0068737571144161227, -0.028948994841008498, 0.089044736384185363, -0.081552139276085872,
+    -0.15612925862546456, 0.10846235170678879, 0.061637968797195568, -0.067829462794640069,
+    -0.095643801646202245, -0.042021508848856332, 0.054940405119302475, 0.014367362395028232,
+    -0.062414076068815744, -0.021470015132506761, -0.037772324136709411, -0.12861660443432177,
+    -0.078270951671501846, -0.086529944122817407, -0.02748512839376668, 0.10848918212013971,
+    -0.19664718115157545, 0.27722764248094212, -0.058602909327120374, 0.064554591840298201,
+    0.18060334748752829, -0.11725220087238901, -0.023237681024950531, -0.11643014454015994,
+    0.013641241792865192, 0.1204523127137138, -0.017888126476819016, 0.24700450083716377,
+    -0.10947339503585607, 0.073462634184558673, 0.12611703028372423, 0.015080358771167344,
+    -0.11904059739210195, 0.13673824338131851, 0.19780491959743848, -0.0013371783757340481,
+    0.015076442649557563, 0.15505306369041338, 3.2233924442994141e-05, -0.011526882591278303,
+    0.046908499588294683, -0.10067762019323304, -0.017968362642749588, -0.057073760354765066,
+    0.021802775042404115, 0.0058669909035613862, -0.14658095009190428, 0.091936001187794755,
+    -0.14744815139798825, 0.038637985300356954, -0.18379350181788304, -0.10977861795456918,
+    0.098815808806085467, -0.023070489946207012, 0.0985919273051553, 0.11381281686284855,
+    0.091693342344227824, -0.099991832290373214, 0.13448910463681452, -0.050472027743045683,
+    0.03495168877515191, -0.048972684045182624, 0.064819343093882084, 0.12491060779410029,
+    0.0071419429840985085, 0.044416022214950682, -0.0094760256858445208, -0.079739749360839413,
+    0.053939198028271719, 0.19753030720858261, 0.12850833883826532, -0.061000822529931199,
+    -0.084842939300496342, 0.08103167036005049, 0.040829082262228325, -0.070565398343494568,
+    -0.087198460137683995, -0.026604825632176296, -0.092441812878572074, -0.15014892292279752,
+    0.062691360068339738, -0.0038323179944431767, 0.039234711092018877, 0.12581297360073829,
+    0.0481033285113181, -0.076570637932347141, -0.09096627291280808, 0.021903229183144572,
+    -0.0070273504340772584, 0.018513946640256636, 0.16757881551812415, 0.064504473074867896,
+    0.019145710295355139, -0.010133104621816394, -0.16425661142367212, 0.060702759909319205,
+    0.017475415065862393, 0.077118102732145408, 0.087227661177314023, 0.075163739488148751,
+    0.058836822830971761, -0.083081789153043539, -0.010181685440389731, 0.01697291556397031,
+    0.17985621700927801, 0.043223363548180668, -0.18753201987753781, 0.05158020303333475,
+    -0.061296480087744243, 0.038799800258413411, 0.039686289671314025, -0.13787647706395081,
+    0.12978891333901052, -0.069783659376277202, -0.0068453747842597817, -0.17341974416215827,
+    0.072150798701540272, -0.045854936651174225, 0.014057404211920133, 0.0012495422196775248,
+    0.039427306398480376, 0.02708865708489688, 0.1321663364887912, 0.12414923718468673,
+    0.13991291591053698, 0.10741698500532708, 0.12832420751264931, 0.1821325950689483,
+    -0.1583926728413772, -0.077395117068761066, -0.11351419174427575, -0.0020834839410178853,
+    0.062282424679086991, -0.025671868864135649, 0.0091758948648331222, 0.0078072429912381192,
+    0.054308740380442609, 0.080819056149645144, 0.11303237472079536, -0.048009015170654763,
+    -0.030960937917509326, -0.016163828738574665, -0.03277415691400927, 0.15307761941142645,
+    0.089379519337433197, -0.092960723736008055, -0.028165976346782352, -0.12393446098252048,
+    0.058556174373009605, 0.12175699787880781, 0.10463229604495032, -0.019800006910542817,
+    -0.034025369229060062, -0.033210222955149332, -0.0068464144420016752, 0.093586517882700726,
+    0.09364468899359478, 0.13139611123241596, -0.023455111311079191, 0.085863068459071795,
+    -0.083870625748283412, 0.11082998743406479, 0.025020077727567459, 0.027403411699580368,
+    -0.20318961961974094, -0.067306273289170909, -0.11737332627715862, -0.15151309203015867,
+    0.089924619038721496, -0.06276601165619794, -0.017686490472828321, -0.017809700204706656,
+    -0.059852769872689116, -0.06404210871041667, -0.023901463875285606, -0.032513290853854938,
+    -0.17997473930961994, -0.13224782108359645, -0.014575020790528435, 0.067205037085416239,
+    0.10316860840856074, 0.057352707956513781, -0.017890852468356675, -0.14124331843582524,
+    0.075151956393512118, -0.14940223116645845, -0.067349282228588367, -0.067301051672176232,
+    0.14185639974913394, 0.08757377638343164, 0.031447970280645568, 0.032703563550860501,
+    -0.095241636481190786, -0.029978195461647223, -0.091262941085359539, 0.0068507991583224787,
+    -0.070772255964285311, 0.090671106936446186, 0.10470747657018223, -0.19215202861666608,
+    0.072503423119801319, 0.19359949545468355, -0.14443720211560607, -0.012849930677511643,
+    -0.010178810265835479, -0.056552823860170034, -0.051996237044245781, -0.085414560030930536,
+    -0.1594343507511824, 0.2173994799328203, -0.14081179729439131, -0.057918885964566028,
+    0.022129064548618946, -0.0065439364808511924, 0.023772005825613743, 0.033222333093596797,
+    -0.21530518260716497, 0.20225342545836447, 0.19294018183024239, 0.058908248635952266,
+    -0.20866192164571659, 0.039451586682789967, -0.057729273068368864, -0.1690087470103846,
+    0.0058638907341322655, 0.12058754774874222, -0.099361526921904211, -0.0022288237137093811,
+    -0.073523705162731809, 0.046830312280938681, -0.061923678981442465, -0.048781285479956221,
+    -0.16104052666059038, 0.14122564458232409, 0.023761494092805223, 0.038727860078456119,
+    -0.16961066605410222, -0.0043027565817690917, 0.22676775688286918, 0.038509483441910151,
+    0.047545244501063309, 0.04134257985383194, -0.1150281891404742, -0.12461803608640455,
+    0.0021853073650372561, -0.070690255819560024, 0.21218587131676436, 0.102237084182098,
+    0.050240435295816316, -0.037572678865797828, 0.024898944108720275, -0.023314110531687401,
+    -0.17377410714683755, -0.045028113875439375, -0.055724405788699596, -0.096199205436003382,
+    0.19745704457740404, 0.013448047603211806, 0.040133188697651097, -0.071392399341125762,
+    -0.12290923651426845, 0.039920698572847274, -0.047415795518245728, 0.070883748597683566,
+    -0.10996844773429527, -0.10409813709443715, -0.18169675123547643, 0.10109984894195911,
+    0.076866940098524142, -0.17950143922881351, 0.14549426997833792, 0.053731704114232497,
+    -0.014350392111789068, -0.073810096593909455, -0.031262333892813472, -0.056155182347136984,
+    0.049260689378156482, -0.053674443520695551, 0.15513159232186588, -0.0717520375222922,
+    -0.20314468083012396, -0.028279983742644552, 0.17469268702437407, -0.091021731338747372,
+    -0.047333161018392293, -0.17597820315712687, 0.1462518516948115, 0.022899525636106661,
+    -0.0022551440491295309, -0.06096742875559133, -0.018602826218896484, -0.067384417747139963,
+    0.043170274526084892, -0.033524657897142575, -0.053750831845611968, 0.15729288105651862,
+    0.084414110484618318, 0.056134741128829858, -0.1683922295944825, 0.11438032032996805,
+    0.066031297586497548, 0.0067694290960541078, 0.0053860849558060152, -0.11297434906981045,
+    0.1172634170519824, -0.11953264062067044, -0.16122136584032218, 0.13776464587946299,
+    0.0040263989382568607, 0.11273550362802537, 0.039661179398046656, -0.27689091765880752,
+    -0.11393328026459114, -0.096177023632385575, -0.0069789522368069847, -0.049253361201694622,
+    0.025000667532982229, 0.019698655775597075, 0.04667696949213803, -0.15140268942185889,
+    0.00095400236484272181, -0.011963482441305223, -0.035876981483139433, 0.086822182749813168,
+    0.15953169248092289, -0.0086668002206385254, -0.10534892471020486, 0.15572049155085732,
+    -0.053770019611358584, 0.053704035131790999, -0.032706299346908545, 0.062583063251706469,
+    0.083931853279682084, -0.078068211220025274, -0.055241064912332244, 0.05043340977765913,
+    -0.065671465798111534, 0.040404556627646429, -0.085237655252841577, -0.04438322423656163,
+    0.014352638649273261, -0.013226837045866656, -0.026773704386511998, -0.20223299024443225,
+    -0.14445806323772745, -0.037072718310328621, 0.094018702483805533, 0.049224560087090037,
+    0.12585154562541179, -0.014863336219412332, 0.025145600801792803, -0.010451758359507015,
+    0.071657939798071751, 0.013284461891023209, -0.149146024409642, 0.047505723502764663,
+    -0.083536796006605296, 0.1384274845304124, 0.012266794806333919, -0.083103311485621403,
+    0.023011111090118577, -0.077997957428040235, -0.017734481914267321, 0.1603458650844623,
+    0.1461935215138766, 0.0090417254562694498, 0.1219819822286415, 0.035847682608369201,
+    0.095943117751130458, 0.095917597938037058, -0.029263453092804835, 0.13309000444827776,
+    0.14379630723700393, 0.19714750846128773, -0.0010641035317680632, 0.096787274963406542,
+    -0.032883627042191922, 0.12367839436557668, -0.15882817351520154, -0.0096838598445835294,
+    0.018694903030709677, 0.066770395183923081, 0.17180592080221144, 0.083210793364369498,
+    -0.16475155021700241, -0.12187341361578483, 0.048098413327138968, -0.19504797490190257,
+    -0.051089999479020272, 0.0025378698099361731, -0.15888934494073739, 0.016978691432058143,
+    0.11042027501344424, 0.16967951371745454, 0.062308174544121506, -0.021630981613391255,
+    -0.15944782299220944, 0.13407253576883243, -0.02999201270755052, -0.066620460768135756,
+    -0.069562115845100345, 0.033253539722257551, -0.045957624448219797, -0.14362831243837329,
+    -0.15027925328093827, -0.062929389805979313, -0.031856221128132911, -0.17172038536731299,
+    -0.055033655222896771, -0.20150052304369215, 0.085310242409369741, 0.0091489521962956847,
+    0.035772614441796975, 0.058116914973575941, -0.10052114392644901, 0.10559102400393947,
+    0.091653943110726679, 0.013843132988058934, -0.13279762574901452, 0.075054948934774435,
+    -0.12867196506955295, -0.072113573152026017, -0.24668856838618328, -0.051615890123699271,
+    0.11305446695142835, 0.0011482277060785721, 0.01584864411653273, -0.1951513654919384,
+    -0.025977666961602502, 0.06372992087616608, 0.10879923185382945, -0.091520143820648062,
+    0.077394443206695265, -0.13181769921732014, 0.023507080744976497, -0.042284253272961779,
+    -0.0360366975572637, 0.069584592485037525, 0.050306479508029509, -0.11432636050616639,
+    0.13381611589159961, -0.056924144390718995, -0.023627821850701256, -0.055664421538988977,
+    0.12850871046133699, -0.028935898528549008, -0.02034200017215667, -0.022846677041367093,
+    0.031214958130327167, -0.043421915421067478, -0.047328968320570611, -0.072257841099934189,
+    0.050636141886874188, -0.043983341764735978, 0.12053332464102699, -0.10113936112210194,
+    -0.029739632967791783, 0.03684678428238914, -0.042336425384210744, -0.058874067701193258,
+    -0.02832698352507514, -0.12024066567855739, -0.045714811989358672, 0.036642169684329061,
+    0.10240141155646501, -0.11957240493491542, -0.010002337360491345, 0.15841748538009426,
+    -0.012051806230559167, -0.14647175397358497, 0.19627392014435857, -0.030946869440664319,
+    0.1472897295394395, -0.012662199462945826, -0.07991883692038107, 0.11091595809959022,
+    -0.0056149946247707047, -0.038554839644797459, -0.085813665600998762, 0.011237448572155518,
+    -0.13279219155162392, -0.025611878310419327, 0.035944070721798137, 0.09855592371483865,
+    -0.069669065329124813, 0.06052045734541639, -0.024789522469918644, -0.063650772889770169,
+    0.018632188387577658, 0.057615220357611421, -0.059911650853619693, 0.070085125793626982,
+    -0.033080703202580657, -0.18809273786561087, 0.096580834092684351, -0.23916752952350004,
+    -0.006425751097172543, 0.17831143755591761, -0.010226852867730974, -0.12569084653435383,
+    0.013676064345220973, 0.11148050537470258, -0.1856523528996486, -0.029924123886386666,
+    0.087252531975478179, -0.20911482984330157, 0.051386021119420207, 0.15588316932951518,
+    0.10541421747601551, 0.0054311307452121413, 0.049883856159915356, 0.026856859858542997,
+    -0.11933285614891666, -0.26828558905215666, -0.12727257398014197, -0.00014741758940241007,
+    -0.080531167174278134, -0.049169834049260189, 0.051265910883486809, -0.035251419404854552,
+    0.087072367034837811, 0.11023087825845077, -0.040133340025344202, -0.25602726456884506,
+    0.078590934675502239, 0.15892146930601525, 0.068173863573725221, -0.053927146848280844,
+    -0.060415943352217442, -0.051966815473080942, 0.10246453373995221, -0.21701560062760411,
+    -0.11564964625068157, -0.0035102167087399895, 0.22152586089292969, 0.05818011106411438,
+    0.036974725831211142, 0.055867963870602853, 0.183952614145584, 0.0059232874153342411,
+    0.068650664455657803, 0.13120270305723017, -0.080894029730439299, 0.011137059650871918,
+    0.027891500871748225, 0.19905860001840714, -0.042119880790914416, -0.074233293846143314,
+    -0.0082295679110882501, 0.054645308210890781, 0.030321113493447818, 0.084499413500119899,
+    0.25515047829459964, 0.049968011086963297, -0.065087896657954253, 0.068344885869019184,
+    -0.075801366636235143, -0.12527150444016941, -0.053602779139600702, 0.019281073871038272,
+    -0.11175413936366667, -0.031257029925767642, -0.016594190170812238, -0.14402089528599962,
+    0.24313276893161731, 0.070064306187672343, 0.17065626444588031, 0.11352148698049394,
+    0.10869126113731679, -0.0026293833448814735, -0.045078509706230965, 0.097238782880362945,
+    0.015530609441375699, -0.06473854970443349, 0.11263988149638478, -0.010710088943792082,
+    0.083532784433468926, 0.0060299993758177834, 0.075248084734363604, 0.132416795035837,
+    0.0063530917680289754, -0.014025282865987946, 0.12953563472519955, 0.078349942753475413,
+    -0.17774952764030444, 0.02918940698263128, 0.0012916764106037, -0.10481101042014813,
+    0.17405198844010197, 0.039671852040540849, 0.124472169009555, -0.077843981894688774,
+    -0.0032011267866387683, -0.071865064192124878, -0.11857854292386655, -0.032413486574783247,
+    -0.034643414378557093, 0.04758795534039207, -0.10235855851339344, -0.16459557768584332,
+    -0.18225297631124865, -0.081781367418691811, 0.068576657538185259, 0.00844091133326943,
+    -0.00052960308679293625, 0.0097770269382370587, -0.010065870976001853, 0.044370540170227901,
+    0.13883423597117756, -0.10940552163751383, 0.013797097215279084, 0.032928091162726714,
+    0.058080511421228054, -0.22983441432081775, 0.052747246055619361, 0.058547683127329803,
+    -0.35185037812707148, -0.016874429820493721, -0.21328354006485314, 0.0087344442650382232,
+    0.088393906770370068, -0.033738314341635371, -0.029987775685945489, 0.182883149559534,
+    -0.099970282237763761, 0.0082857060494321566, -0.13431835922986762, 0.033360774338516974,
+    -0.30584525600546525, 0.0069886409314484661, 0.14053785596255453, 0.034698661319732413,
+    -0.05502416224945042, 0.038809486631030496, -0.051264453947863962, -0.034395507314195786,
+    -0.0021703223860692357, -0.1233424718759826, 0.12312182918110567, 0.065074121792617498,
+    -0.003922524675737323, -0.059504695230364495, 0.16989032616097968, 0.10433599983670452,
+    0.023617210093464788, 0.13580599602873622, 0.13294891156155428, 0.20156896088029408,
+    -0.14389800406804001, 0.16533718919324042, 0.076357039941690269, 0.10517290419596485,
+    0.19718483033188378, -0.026939130446997851, 0.09249172340616589, 0.10563977331052105,
+    -0.047632464010519807, 0.22517631911998087, -0.034633123594736699, -0.01305634162840592,
+    -0.049705253744455655, 0.10596240394389593, 0.08110231983212482, 0.037891009987948643,
+    0.044216787099048555, -0.064506474558633106, 0.055704717601253097, -0.11430486179754902,
+    -0.2434412514597144, -0.038044924881829645, 0.037419949074556244, -0.201347636068585,
+    -0.22910583161189627, -0.057648439460545313, -0.11616290306948569, -0.063017360046419849,
+    -0.16492919707859177, 0.024525276631722794, -0.067490362555646652, -0.021864750023858646,
+    -0.066490630430561262, -0.049609206772269945, -0.1511830596124567, -0.031963480816109564,
+    0.031705478077698836, 0.14354232258718369, 0.00025224488743106846, -0.02091459445350698,
+    0.059410335785611258, -0.12281929730935713, 0.07082200545839952, 0.071917168764800768,
+    -0.046094442622860603, 0.11701217519502753, -0.13466903205208097, -0.070983309647002876,
+    -0.17682373396781528, 0.17523688198818732, 0.2247725808911531, 0.057963056318188821,
+    0.059517967997742699, 0.17307261274376368, -0.072533560801693625, 0.048840649383693979,
+    -0.16917359185558195, 0.10965908240177667, -0.077465504758554918, 0.020874713433067318,
+    0.041006250403807523, -0.15782703438855028, 0.044170586717457175, 0.0037745682529571251,
+    0.057842678974365472, 0.095064121590297243, 0.027448553280348155, 0.13310063049956661,
+    -0.027134022256448162, -0.039678856500074404, 0.16837647597923058, -0.064961603136887466,
+    0.10285843370121737, -0.19638991280150533, 0.058769867171377124, 0.062770259116436494,
+    -0.077956064638651332, 0.11786922279479327, -0.13613501287147009, 0.091914318487102631,
+    0.021553624721824455, -0.13689762804576885, 0.099449200108562189, -0.078541202965137599,
+    0.12880689591889141, -0.038790689307836079, -0.033767360453545371, -0.081020605607168436,
+    0.22612568499925773, 0.021809224295086457, -0.17656789984976215, -0.19319718181890294,
+    -0.074980189492838065, -0.16041141680067669, 0.01637246613494173, -0.081518344719333488,
+    -0.13842658821534873, 0.022229123612265513, -0.023746928387312315, 0.005045538198573919,
+    -0.22507320214796639, 0.12924958362558861, 0.020436002530465517, -0.12901007462742092,
+    -0.019113881783873566, 0.098376535316866853, 0.20060873919958883, -0.071604853059419715,
+    0.11129595225902983, 0.076591615885098996, 0.14944060271895346, -0.04729640811155942,
+    0.0036914175585162569, -0.016805272326770058, -0.010869733763402114, 0.12794083845717197,
+    -0.097276549777134, 0.16326666980570384, -0.034831983285195649, -0.10697698098114874,
+    -0.0022438993941014235, 0.080096687502334007, -0.023099996455114576, 0.026535195838026156,
+    0.24933629497146248, -0.094623278885890796, 0.10653898536136992, 0.019462726221494094,
+    -0.036518094006973492, -0.10737588807644873, -0.1253339032588113, 0.08765228996128116,
+    -0.15258381707703145, -0.013879199133691251, 0.1539297116083545, -0.004084168070571304,
+    -0.0086827558390076172, -0.081239018924019094, -0.016136988257559246, -0.068528251086808573,
+    0.024050279242189495, 0.147145535196611, 0.15802041892521465, 0.014568412702109977,
+    -0.1529828788811167, 0.17942897343772488, 0.0044303752798574266, 0.029606996541597409,
+    -0.014855855554907541, -0.15211680187325405, 0.080340055277073538, -0.037391936912160167,
+    -0.17768720647231059, 0.11644799944783427, -0.10273797536579639, -0.019861042969644919,
+    -0.044210024090970863, 0.035209604544390385, -0.10930368100050641, 0.040163732417303095,
+    -0.052975736814074102, 0.075119567679412177, 0.041619359127822088, 0.098152012937379476,
+    0.030999736204695774, 0.099847839159280874, -0.068115493801986296, 0.019560267915393094,
+    -0.04039209886260086, -0.031693952892771403, -0.098455100438052903, -0.15774868728028069,
+    -0.088137308463863848, 0.088784566173606236, 0.026949619691613993, -0.0091221077830494369,
+    0.050141840797106874, -0.062670732243806745, 0.01480333831840365, 0.031945372297483232,
+    0.021515374398137489, 0.18717048984725179, 0.11334190309080897, -0.16795301310871474,
+    -0.20051161695922429, 0.13180989516708533, -0.0085499918383767585, -0.046575948800413984,
+    -0.034016031102864115, 0.043604594716146104, -0.064692185296803567, -0.053997454423424456,
+    0.055442102066677192, -0.030748346216128781, 0.10883475280726168, 0.093323813555178062,
+    -0.0076665498872367441, -0.10577759097968126, -0.035969653207279108, 0.013158293110619364,
+    0.080631706234567585, 0.16131507988936464, -0.034675828192203363, -0.06156352880531258,
+    0.020321555599092871, 0.036316912898998743, 0.041868534056278273, 0.010363667131411299,
+    0.035870220449868422, 0.064948884510965324, 0.10587724490595657, 0.02569521338761481,
+    -0.2086323130698583, 0.11548379405083525, 0.083526993566928651, -0.14442139651746549,
+    0.003909302633868102, 0.0037666689808461516, 0.025235421231810676, 0.07898989770141164,
+    -0.11850740749937774, 0.069133397124581802, 0.036191823611688663, 0.026149772795840846,
+    0.083137842083273364, -0.095368140814284852, -0.23890491292768556, -0.036563318432711205,
+    0.044794424319262185, -0.066214457388740641, -0.10060423719201975, -0.14968738956967062,
+    0.037143737591298, -0.015676111688564847, -0.20019268539479149, 0.016830420924897508,
+    0.046683233362240673, -0.019471978770840486, 0.068666485599189517, 0.11063215793280679,
+    -0.035561658504430542, -0.0087729211060189778, -0.046759540204105055, 0.039351088359268996,
+    -0.076488166665330079, 0.087419729724294279, 0.20447612081988203, -0.010048001572425294,
+    -0.12352729336942252, 0.17203866795957476, -0.066697819604764841, -0.089785097702385477,
+    0.023083311589458429, 0.042335997720981337, 0.17734944039023312, 0.13475922560826736,
+    -0.030312380523566225, -0.032046562786849857, 0.21445298412447283, -0.16462750636481782,
+    0.031821602909111062, 0.097743891799270538, -0.081672568363349241, 0.10514247793305072,
+    -0.20947636631984742, 0.037465083724323403, -0.059169740217146237, 0.015708423797850462,
+    0.21346179477185412, 0.024531731641409281, 0.0072538537204879959, -0.054395385057997771,
+    -0.038653996004138401, -0.07802233129804903, -0.061620120058803976, 0.0081169367175927386,
+    0.014787993779517349, 0.11371172794289293, 0.051488846980762802, 0.016930383556850722,
+    -0.031122253575233762, 0.021525994684472232, -0.10221107906224103, -0.078086580579533008,
+    -0.16833770840740736, 0.09782604862901409, 0.071101709925315032, -0.10943806152179153,
+    0.04201734181927811, 0.1160609829930158, -0.15756576970460148, -0.10407672934829207,
+    -0.054547331480250698, -0.0090629694501876794, -0.16282975297456981, -0.046681103328556663,
+    0.0072703377265932127, -0.079452196022632093, 0.13560214199013432, 0.13073230768877228,
+    -0.043027729824224877, -0.093721490917216252, 0.1944506956043362, 0.01194975323988404,
+    -0.074387133408953962, -0.00918692312300615, -0.180094666283628, 0.069974940540154879,
+    0.03164380630903111, 0.055712863960371853, 0.26523895027831246, 0.093352895357596652,
+    0.020015222314869983, -0.15730043953684797, -0.015087277160313516, -0.092054837113878393,
+    0.045719062855842443, 0.042258884829347088, 0.13531922282348424, -0.01975001098493526,
+    -0.03778613521107748, 0.018009997717136614, -0.19074223287856368, 0.13968969857462779,
+    -0.14714088395682168, 0.12881795750247707, -0.0015673192411669594, 0.13616420448400657,
+    -0.049663798531380088, -0.040130305898922983, 0.24156033862940016, 0.12384946743716836,
+    -0.16566364519264337, -0.10120521937065205, 0.0013119935648172947, -0.019215523441266077,
+    -0.031181393253354887, -0.080483791835845905, 0.079851078924103314, -0.16789303231211136,
+    -0.0076495126187901474, 0.0085920670513465087, -0.042902744160114629, -0.10741336252187478,
+    0.053324473666519046, -0.07401662017254608, 0.023426702159219537, 0.14569249852997801,
+    0.053863065186661431, -0.15250741559189585, 0.076144767884632258, -0.057121395221521654,
+    -0.0077218027055500479, 0.073982600106161492, 0.056111807466285704, 0.076428081559296174,
+    0.018438915631813126, 0.099024745981551851, 0.071259688360425497, 0.00050978133741523416,
+    0.07056298645255886, 0.0016367597702513597, 0.04020280365178952, 0.13092732934292381,
+    -0.044720611658085323, -0.31751676698789566, 0.010529515700989332, 0.075956777730169026,
+    0.023894055258105534, -0.10257387070357095, -0.32829470217762236, 0.09351802623915087,
+    -0.064597075643133717, -0.048067311630595938, 0.051938715257035341, 0.069353946028423333,
+    0.0076246320257649007, 0.07921356027308607, -0.19174510795723257, -0.042799574454676644,
+    -0.043777489155228007, 0.089019705985475525, -0.21641306980310027, 0.055984232648785472,
+    0.098432415388057734, 0.087497066378732294, 0.18267012658771184, 0.16718954950482767,
+    0.019710607757254847, -0.022138674548599305, -0.044395969830557144, -0.058680482247144367,
+    0.025823127169279952, -0.17951908877696426, 0.039521825279901064, -0.19072878094360629,
+    -0.024093876239199698, 0.099984942311054051, 0.086564434963833092, -0.11618887026460543,
+    -0.089082361722772008, 0.19622890132807058, 0.033133119131933286, -0.10281499933381891,
+    -0.028956772733001786, -0.17540540358221329, 0.14390045975368929, 0.052894840526339887,
+    -0.091328635178863929, 0.035428145896411703, 0.025434852564222451, 0.14326621738607492,
+    0.053905935394987239, 0.062163179009564161, -0.067260505825097239, 0.082662895074169296,
+    0.1012307524157971, -0.076275320865669072, -0.054713026262155663, -0.093533694034126785,
+    -0.047600800312904326, 0.029542886753044974, -0.018891915854765327, -0.30311777314896299,
+    0.13028677318048484, 0.086539617131617036, 0.050322605643902063, 0.062819938669844061,
+    -0.039290330676336457, -0.11895865852477856, 0.041021752742928047, 0.058740224723889484,
+    0.096138753406703581, 0.099301000011328744, 0.15359197315196085, 0.0062230645571311133,
+    -0.02418204239493486, -0.031191780753627191, 0.016790832179321997, -0.0083783567034288169,
+    0.029086053976525694, 0.15498605606819671, -0.14227653549573099, -0.14147922386597772,
+    -0.078099778521464241, 0.0015627696035700148, -0.052767704884303948, 0.19680506438063006,
+    -0.033419209024105861, 0.010531659763032787, -0.0063886533704487882, -0.030764049937661964,
+    -0.071066160755278746, 0.032407288713079435, 0.10233220751402998, -0.033200001094041386,
+    -0.028887219784842679, -0.094990395813845413, -0.082458786767394876, 0.08475278303627426,
+    -0.1231957915000081, 0.056541439359597018, -0.056213993375354966, 0.072886696159696021,
+    -0.0072569117213588611, -0.09638748399011976, 0.029729948063672827, -0.015177986978829714,
+    0.043701203641685435, 0.099820200990485358, 0.091214529725329008, -0.12738434772021018,
+    -0.073102224351193068, -0.12383227659153001, -0.073032768282624172, 0.0039560618809837194,
+    -0.248263256046342, -0.12337102764354263, 0.032316177681071846, 0.050868971073700447,
+    0.13709633735639379, 0.092936863674052017, -0.011872890608864798, -0.081120269277249787,
+    0.14972139552061181, -0.031755780365115352, -0.31321729127685094, -0.14250277123181754,
+    -0.11875936912034822, -0.019255174918459989, -0.15732005016629447, -0.074827116758874823,
+    0.13269414560730236, -0.057800734968859582, 0.15343563901842391, -0.10396354320601807,
+    0.040866234091197925, -0.033368683682479847, -0.054961460144047118, 0.17726569763711067,
+    -0.070391455949616377, -0.014278303052677641, 0.047499814250661909, -0.097385120348918955,
+    -0.062702877819078004, 0.094510517369192748, -0.041091636583582253, 0.056220511546655492,
+    -0.13009988099593059, 0.034414303888813662, 0.19358620388519066, 0.0863093730701886,
+    0.054412299978435705, -0.023902191417623373, -0.042851847187695143, 0.050435660979799193,
+    -0.15865496709267357, -0.032064842707033671, -0.032168058131555391, -0.046277067914613404,
+    0.014761486852874496, -0.099597276088410139, -0.022814880814636517, 0.11243311406183655,
+    -0.14728198390041644, 0.050144254776909897, 0.065514672963499554, 0.072310299841126385,
+    -0.013793838536817007, -0.073563783415416056, -0.093093014035489627, -0.15537729284230928,
+    0.07646397067791344, 0.035025825447364378, -0.049832498237496567, -0.074158666352483971,
+    0.088731870753418693, 0.013451123001068514, 0.073821804054584994, -0.044808883405278693,
+    0.10813857254140374, -0.13561575346645513, 0.047834917277237932, 0.27211686808569396,
+    0.12006605530911436, 0.057627690667605383, 0.012275565606131016, 0.10258981124342643,
+    0.05087354309038581, -0.018815927796081031, 0.006768907806610009, 0.1032240731068817,
+    -0.017945186858033996, 0.087427650121290876, -0.017524968943015005, 0.19686375586818705,
+    0.1194124341076241, 0.011427982827179266, -0.049881488870646223, -0.033761647024225294,
+    -0.085284046456297252, -0.1667033726482173, 0.10217798916114909, 0.014772916281908945,
+    0.0081010976731248491, -0.13589581923319799, -0.095664581594215245, -0.2591367280194587,
+    0.04473996432706541, -0.20322261023485139, -0.065565643715309693, 0.089361853329424895,
+    0.042329925034777081, 0.14348593159646958, -0.030285906782414884, 0.029222278718536152,
+    -0.072985814315402325, -0.013016108219941609, -0.10468011360271777, 0.018011983230906969,
+    -0.0063932383091857966, -0.10618417027275594, 0.015129188274200553, -0.029229484855010136,
+    0.040610848151138731, -0.077467918125867577, -0.094947854248152289, -0.051219047431026524,
+    -0.14010798128355925, 0.058473043568491805, 0.033355452791074443, 0.0046059337282771933,
+    0.17734571185597181, -0.18321732191501064, -0.15104936640040006, -0.089022039593045124,
+    0.10587497350705655, -0.076561536065388305, -0.033516186941392835, -0.085222516313480212,
+    -0.055630736744974187, 0.069693539644027011, 0.09611278091502351, -0.14445614762670519,
+    -0.11863347566404409, 0.018842665771148709, -0.042846669114643521, -0.05711895139373277,
+    -0.169331435784811, -0.050890768020737567, 0.099320178594004993, -0.045792755515052325,
+    0.065428769447345478, 0.20049827848141266, -0.0016096264735014445, 0.009019965441435504,
+    -0.073933720270053918, 0.022732399594228916, 0.068922073234164868, 0.088492370518209032,
+    0.05059510897172767, 0.26847747855323506, -0.017611183017527256, 0.01440660972847535,
+    0.024053367160762465, -0.03179050949068718, 0.0044455588575020768, -0.097773192174870752,
+    0.12310321784112035, 0.05374394860280373, 0.23673867049484065, 0.060179766738314468,
+    0.090368192887885446, 0.13938764061787651, -0.033093794949452783, -0.14211256578662534,
+    0.065972266595354781, -0.030984233596406403, 0.023053750820786117, -0.1558344996974286,
+    -0.15985451438827644, -0.03559123458996815, -0.18598962267647776, 0.057015768495250752,
+    0.063855442021953548, 0.15631489404122867, 0.11130651616425631, 0.038393103144741064,
+    -0.1317522984755975, -0.019791725799764223, -0.028611112452510124, -0.06776636926995723,
+    -0.098821012437031591, -0.12995053118415906, -0.0049768851615728535, -0.053639900893565212,
+    0.099323391230156099, 0.044494312212071056, -0.082910769141173679, -0.067599657701321911,
+    -0.072570824897164737, -0.10638075784894148, 0.097383194108673313, 0.04929946644191191,
+    -0.14546074197859052, 0.071674134226926783, 0.15802737750105658, -0.034369361848319416,
+    0.029351515892565041, -0.068334078761810954, 0.029472771545245427, -0.10412552180098103,
+    -0.041821699091062481, 0.024360288997738417, 0.030729439775346524, -0.047098047296171452,
+    -0.036602448227394516, 0.19962185732739082, 0.1022798544863512, -0.2685532328182017,
+    0.032473145554120363, 0.18502555579866986, -0.16917543268857327, 0.0176905057203001,
+    0.16740908593012757, -0.055074133112675019, -0.10140209771449918, 0.044701806807313241,
+    0.070975187063964759, -0.095474558169702697, -0.12722632086526869, 0.016906381517887516,
+    -0.1251090802924156, 0.027904087280796342, 0.044255747664473433, 0.16771687388056145,
+    -0.13796540529155929, -0.053305465270386848, -0.25366606609830827, 0.053103653308551983,
+    0.18152420392159563, 0.12331934079832695, -0.085237993648306101, -0.18201174865136599,
+    0.14533143289642161, 0.10429439335471125, 0.16124718627025936, 0.044707310417190532,
+    0.048695084505991276, 0.024233580298197149, 0.086989366863866005, -0.028654812664301421,
+    0.084234025426495926, 0.063476177589321503, 0.1254158328770956, 0.060841240838008119,
+    0.046282015864441362, -0.10099745986562714, -0.17859194465091854, 0.079361954592819736,
+    -0.11778149905128131, -0.066512859113693215, 0.012367563012093755, -0.014352371340745419,
+    -0.061449773522599477, -0.080838836135605718, 0.10965374921427487, 0.12494929964069955,
+    0.042580751901387812, 0.09262428555168796, -0.14227379006339172, 0.039463783139124992,
+    0.024636299280993076, -0.0096778452733307114, 0.16295944491990824, -0.049666807224500634,
+    0.027080401496395498, -0.028098607967228403, 0.013467141492711733, 0.023884536947917659,
+    -0.016611455675380641, -0.20856011031676822, 0.20323083556545465, -0.14940581375457726,
+    -0.065481131455461569, 0.04860715041847178, 0.019233919821089185, 0.16203391300618275,
+    0.078125631693826053, -0.11756268574075704, 0.15256592273909969, 0.052010563664864937,
+    -0.09358996911821317, 0.10223101087992073, -0.17265256003935081, 0.00029359137983801342,
+    -0.1023028217320899, -0.017347840356822773, -0.082904924703148045, 0.1612264732827377,
+    -0.13945189445745698, 0.081958354049586332, 0.064108273177767947, -0.037469689334556106,
+    0.012586533568412146, 0.071880420177904594, -0.098137149550090105, -0.012201427737667719,
+    -0.060847247621415683, 0.019478574452464814, -0.050158291901077762, -0.034073778449892636,
+    0.13808786586782656, 0.03176580743279192, 0.076939180347146086, -0.088144398854573036,
+    -0.01558188354788622, 0.069970175581337904, 0.040091182274707274, 0.0037948033726918663,
+    -0.14405120081360681, 0.018057366196188484, -0.072748536244230444, 0.13282238895993934,
+    0.029302089930311179, -0.078587243189551445, -0.10800726489454528, -0.04570788131449318,
+    -0.15929129995585944, -0.22460456170043677, 0.13386026853854169, 0.20621169288470187,
+    0.10228846082967689, 0.23722757051334514, -0.016619897685322918, -0.024978374436303782,
+    -0.038657756859522829, -0.071300210591722701, 0.007530866212055092, -0.0078826609069318314,
+    0.10231395482368753, -0.11909856753595868, 0.06747065017714915, -0.24137355526999291,
+    -0.31478104356437353, -0.014569771716886889, 0.10103219898044988, 0.046117984528124392,
+    -0.029067151414168463, 0.16209754767188217, 0.11362904498280534, 0.085579857731415437,
+    0.10409092432102032, 0.093909608701243222, -0.11629412023706127, 0.13245226497668602,
+    -0.051010654723439776, -0.12597113523644374, 0.031980755064505643, -0.066806342719700221,
+    0.034363753150276295, 0.12582579488761592, -0.13928127668384163, -0.031523003749236798,
+    0.083951072736998117, -0.061959813224909947, 0.030951101631104164, -0.24163360761372957,
+    0.089135439753324677, 0.031357092126937026, -0.047927038208512462, 0.043230853848691332,
+    0.02269130173703203, 0.081072091846287775, 0.14435718019274771, 0.02107031837271137,
+    -0.1207071066334425, -0.14396386699724567, -0.24921676859717859, -0.084984487881067161,
+    -0.089399116440544935, -0.087988429211989558, -0.11129159248795063, 0.17229244662552567,
+    -0.018217342828009072, 0.046147370341172403, -0.0292409907985203, 0.01193951717502165,
+    -0.096563767179909596, 0.047244997391653838, 0.1426928226443773, -0.037869651391745529,
+    0.0044261595685470131, -0.050880907274514865, 0.076775416251618489, -0.078565383835683705,
+    -0.017277043948035482, -0.031384378988827927, -0.009276116088186204, 0.0091913164364434193,
+    0.025217890421435074, -0.033446588624755524, -0.088048183879471775, -0.21147745332936255,
+    -0.062831516397617179, -0.041842147988248792, 0.052263722793011197, -0.13640651259127695,
+    0.075482613130247206, 0.048354363996075997, -0.0025145149224485392, 0.010255380917520276,
+    -0.12602202311847779, 0.10658637863050385, 0.0031196466860119545, -0.11904862734510546,
+    -0.019195933938745583, 0.055499316941306408, -0.12489015712510539, 0.15272637765218963,
+    0.03128457589032882, 0.031278440718780186, 0.084766704297943973, -0.079906088072623518,
+    -0.074977467568488554, -0.028349734827916386, -0.023310448994114191, -0.072145809983315726,
+    0.15421621266941837, -0.058073310650428082, 0.017677307864977371, -0.080276899360087403,
+    -0.17966673365353192, -0.071325792337430735, 0.084996028217296404, -0.075003500492072134,
+    0.057823055675516155, 0.097909987422265476, 0.10092126148611849, -0.17096293276582863,
+    -0.14616803324300198, 0.24035723481473659, -0.12160647637330947, 0.0092516597037368906,
+    -0.14462700575364443, 0.20616673042021111, 0.18254739717914115, 0.10310523816202116,
+    -0.010611377227033441, -0.016924344209870854, 0.033388531184269141, -0.179337750880319,
+    0.0085168048370751117, 0.043793168991921649, -0.23975357280571929, 0.065101526674928981,
+    0.036445835522538619, -0.0013880104868886211, -0.070659497038901745, 0.11782749215435753,
+    -0.070614153853682096, -0.23645480293487525, 0.24715816385840483, 0.086197543657352063,
+    -0.18315267729356691, -0.003558820775273377, 0.012284741432341253, -0.011047003049139163,
+    -0.026730708641945124, -0.022730511811597933, 0.096905345461652276, 0.063496777699864823,
+    -0.114272016725675, -0.037027380763957639, -0.16796096483451345, -0.063668830277505181,
+    0.093120507520706886, -0.042114575892877398, -0.067486701491658849, -0.08313175798968557,
+    -0.30966968899255148, 0.027982581109910479, 0.050138594625127882, 0.12654976253805042,
+    0.03464832575571624, 0.044833773153936121, 0.2340566602084071, -0.037133373448535831,
+    0.045300931658775044, -0.14024400125707043, 0.0024244157722998136, -0.094159960043046761,
+    0.2020631840611401, -0.12590940482617893, 0.16927525838601534, 0.077927350392467773,
+    0.092553378395848568, -0.10619402936276685, 0.14191236960341708, 0.10424142275310988,
+    0.17879153611133705, 0.076875406987609932, -0.057817593830097574, -0.0266794877386205,
+    0.094284104310664224, 0.012302788500351856, -0.19387456609972822, 0.049376588780836464,
+    0.17743552947484156, 0.03925017941381221, 0.3481461351889758, -0.047283405412676865,
+    0.12670559068934259, 0.041069912041244952, 0.070111596466945994, -0.14060758508815935,
+    -0.010868736680343133, 0.0082482741418100341, 0.11894646460953007, 0.15696133755766525,
+    -0.11139676031016124, -0.11897188119141501, -0.010342864964583432, -0.11490195332089943,
+    -0.09477939966757877, -0.026332521435700373, 0.097838722140384984, -0.090450324426805576,
+    0.0048996368033883686, -0.091271969294221988, -0.19414743851594815, -0.2614171532554751,
+    0.079770011609779576, 0.09246247071083713, -0.16474735955392616, -0.053232138068546556,
+    -0.053142672553524201, -0.10350840426669093, 0.036254526354166171, -0.088886905062619828,
+    -0.022360275908935082, -0.07930586244778387, -0.078010830988214888, -0.058508146143734792,
+    -0.058516941134784041, -0.074581947317818406, 0.058870023470014972, -0.15511159732442786,
+    0.0013775058694426, -0.052716442430917013, 0.1254422678315868, -0.19385964044709178,
+    0.051138936140808909, -0.2155933762914243, 0.14627585099350746, -0.065397777491593576,
+    -0.13687533458864351, 0.02189902172472126, -0.13452914671085833, 0.11932523231540175,
+    0.071389007915040506, 0.15031995579506227, 0.12131463601977646, 0.11338525108710563,
+    -0.074621707668386189, 0.074687616906616308, 0.21461395588060864, 0.023707110225142963,
+    -0.074826829573631279, 0.020882293433072286, 0.1466463760178443, 0.15603567853567632,
+    -0.057676690666061015, -0.14074740175208963, 0.019455058119520505, -0.00039718955927843264,
+    0.041702424054110204, 0.12684109467559798, 0.11768163385516826, 0.044639321650609867,
+    0.0053522251556180509, -0.10816852486146221, 0.007960854750894376, 0.15554740298889347,
+    0.071204123236319417, 0.011274327349274253, 0.010535705013724962, -0.035252354750976898,
+    -0.040966160504776403, -0.027958181182489605, 0.0072398337265269057, 0.18610947023412605,
+    0.10472179688239162, 0.084093709428972457, 0.061415317688229873, -0.16100797057286972,
+    0.10619697912864996, -0.049866994198364913, 0.063460796571013042, 0.22160047400748897,
+    -0.12713703216862599, -0.090265978665816121, 0.10919761673253504, -0.11775956071966416,
+    0.040611123044400524, -0.14114526095978946, -0.011068407082836481, -0.0026186123173234364,
+    -0.092791371622627336, 0.064105772512077067, -0.1796640175000907, -0.081421225962447261,
+    -0.11195987525361177, -0.00036958874103085534, -0.030047978796918836, 0.035389620657401116,
+    -0.045408691587872238, 0.033796500339684878, 0.056445819653152887, 0.036720162808520286,
+    0.078682938035329553, 0.063097185708646072, 0.048892919103838584, 0.0055924642146609436,
+    -0.0054311047523293221, -0.1400622696939981, 0.027073045261905706, -0.12754130222524959,
+    0.10695240980082051, -0.070554315522762603, 0.043932649876963319, 0.035687062682602591,
+    0.0079445479785644514, -0.034374624367779202, -0.013061025492178449, -0.14356332769231259,
+    0.23589457459071556, -0.0084616313086207009, -0.042965980621686814, 0.16455955363814673,
+    -0.0074449015399452928, 0.016960568823945379, -0.21846197546749022, 0.041757163024978075,
+    0.024028847294964087, -0.16983850874448647, 0.0023183997709686085, 0.16053754304985562,
+    0.046487868472754768, 0.048695767842305338, -0.15346285688766725, -0.024317978211184733,
+    0.034414078824442529, 0.050488302498055131, -0.010765037668643762, -0.023983432426818333,
+    -0.036659338590225826, -0.060714932070233665, -0.053695361219144061, 0.099927165696134468,
+    0.10246010808432249, -0.044184404397951432, -0.02124731562648597, 0.030039855669822094,
+    0.010143174508720588, 0.17268670766712521, 0.10827519550002655, 0.13000323810339443,
+    -0.098037657652601279, 0.070433539549272853, -0.15722549238987515, -0.14680383059757002,
+    0.1563286448301543, 0.04244400299381091, 0.05800916723950636, 0.29325730634910563,
+    0.01035742228112976, 0.080424563866018955, -0.1153867185990252, 0.0050493499403637147,
+    -0.028598821023002416, 0.10940780552996503, 0.063436572580246778, 0.076795962909153456,
+    0.03176561638867411, 0.014212866221297433, 0.27171126108168947, -0.075473931460325355,
+    0.03275185381446568, -0.3683281537189822, 0.085394171303679017, -0.027059986076700789,
+    0.25137192295390293, 0.050343734691154121, -0.0016467013321585793, 0.062472057634199198,
+    -0.011406972865783535, 0.035924200172862956, 0.23674284601455209, -0.038981246327078743,
+    -0.037268548162360568, 0.060310876529377569, -0.05325440153379539, -0.16320173486572009,
+    0.024309072930417001, 0.050198658722196976, -0.066231095224033004, 0.18262963382099673,
+    -0.18820548141247892, -0.055975682251382525, 0.12998222622206415, 0.084517823617938054,
+    -0.057179023874571903, 0.15186765857427839, -0.07523296482972737, -0.032842711751009217,
+    0.15876282289988009, 0.062260198594872682, 0.061549468467058728, -0.036104484811688362,
+    0.18865817921668826, -0.03846446264223078, -0.010897713613388432, -0.023704331822427368,
+    0.082881879193610911, 0.0099044699416991674, -0.029076813211881186, -0.016579080709211963,
+    -0.13718771962563533, -0.077703603315406017, 0.20173103825789659, -0.0089864356651611233,
+    0.04346246688439364, -0.057096617807093457, -0.10452204122383973, 0.14831735244460287,
+    -0.09999245466032447, 0.033036813656685142, -0.043466308373475558, -0.050325113665566253,
+    0.035062090911931271, -0.088040550470627588, 0.068929421017810383, -0.0557584977372464,
+    0.046252205065265284, -0.17698990973642215, -0.098769926688461712, 0.18803470681821288,
+    -0.15197112840257135, -0.038496202908560054, 0.085085092283594996, -0.056129038131542776,
+    0.02203182434306724, -0.05338050672964674, 0.0090715414372818208, -0.014303849502758781,
+    0.0006835956544499407, 0.12303329118690116, 0.19486751528077015, 0.0954694375806487,
+    -0.28605321607615097, 0.0027263273969726741, 0.016414542876282939, 0.014336293180952708,
+    -0.057164096341357246, 0.063896211718527593, 0.12596330886341656, -0.002864516935331499,
+    0.11762053131193591, -0.05492514065148222, 0.12703491827618379, -0.11828253250090381,
+    0.14936265406120403, 0.12444421043370764, 0.041946909163085785, -0.10695979362514604,
+    0.1046183433779428, 0.0028623884830616402, 0.027158507057213049, 0.081131750034860853,
+    0.054259397330904506, 0.085787989554020533, -0.011980974042797186, 0.084831006090246477,
+    0.076677070647245785, 0.028065219241622086, 0.00069729026407982717, 0.13422838868167639,
+    -0.0029653390871906852, -0.045577881375914148, 0.054766026135160122, -0.11472766585247168,
+    0.075781187831046481, 0.17566354512585128, -0.19769670755365612, 0.00074586907142215359,
+    0.039189343996152377, 0.035707068033113902, -0.029680792521429383, 0.16366501935693592,
+    -0.00813986579102325, -0.11219670254490781, 0.056684742684993253, -0.11025961809152807,
+    -0.081197310379493168, 0.022769948545646002, 0.20648777086289363, -0.15174962888587984,
+    0.09592813039639124, 0.15112494933326862, -0.029528958757479053, 0.00057470110616326725,
+    -0.072715887985989977, 0.028847348805881079, -0.19029271521541832, -0.068651480072082147,
+    0.042202362837549967, -0.13985168678738907, 0.016230535616088858, -0.053561534914767193,
+    0.067593217122828189, -0.16404199825897514, 0.022625644607157765, -0.04724070126338592,
+    0.05059978929419464, -0.046545027184673494, 0.014596856911891484, -0.0025694951891728226,
+    0.039656833337290295, 0.024347711403206577, -0.050568517635702005, -0.11596503235899876,
+    -0.099907873482200843, -0.10790534120130363, -0.021739836065413538, -0.020460224677069858,
+    -0.043672042352719008, -0.069153089391826267, -0.034494866307540707, -0.00091836533918414765,
+    -0.21468973677502154, 0.022981384611597336, 0.013179888543205854, -0.075829791016007925,
+    0.072717036225750029, 0.10161014151428792, -0.14660374085198014, 0.013320759291982417,
+    -0.0052120409104926312, 0.015341840249397899, 0.037836303039575817, 0.12543755078222671,
+    0.023707592158391085, -0.091782826957227392, -0.29232983890094494, 0.049608599932954842,
+    -0.17833022667080228, -0.084922261303116406, 0.11165476109216248, -0.046357380901776997,
+    0.037028293279133997, 0.036940851618898728, 0.16669967310631834, -0.003985770171029141,
+    0.20827131639677499, -0.056894127283396594, 0.085204041289242777, 0.16477391248471723,
+    -0.045257462945282725, -0.17701735632968604, -0.026038227687988882, 0.14316167468137533,
+    -0.0023705097526670023, -0.075829981146273082, 0.16190081781643723, -0.14065091033147645,
+    0.033592539547362424, 0.091070382041814835, -0.19245039740475553, 0.02856657008841958,
+    -0.15356275774677455, 0.018250685836029144, 0.056937253305290383, -0.031475009285557687,
+    0.19680865966863034, -0.036766953484079733, -0.17531944989916082, -0.082084355883169619,
+    0.10657508201855512, 0.08343164179406376, -0.089263441963572984, -0.061996738525937949,
+    -0.092100817257259909, 0.11456049186082909, 0.11295063807767364, -0.039356357418362249,
+    0.061480466331080917, 0.17966594606329184, -0.13764603956633303, 0.052512903917986929,
+    -0.050724206148339633, 0.038708934168498514, -0.14096824726918622, -0.059546778586625292,
+    -0.12303805603070672, -0.099164766630095061, 0.17102569900384043, 0.021417045052126247,
+    -0.12489694721325965, -0.11138252767151098, -0.10232862244879078, -0.064245933758447393,
+    -0.0072032879245984022, 0.048478604552782883, 0.021497449091190779, -0.092096609749441227,
+    -0.062022515140920637, -0.04425002257679099, -0.0019482584914780091, 0.0037509863982653105,
+    0.017938930699587512, -0.059158490764799052, -0.058995000235699147, -0.016004742408922353,
+    -0.10347817825499349, 0.099851089735115126, -0.062981927915070943, -0.032695381513293882,
+    0.089707603849775441, -0.042452226084698029, 0.14847708676907317, -0.0019132159075201161,
+    0.1387157403176057, -0.1145731262807943, -0.092564140037228182, -0.0036775838656704519,
+    0.15973127134186027, 0.01923776506779977, 0.043830239249956528, 0.21556884788715008,
+    -0.077320948607540851, -0.14613195014130037, 0.16029472749618817, 0.086053109116410509,
+    -0.1039775056868336, -0.013652948321309749, 0.081862482052977997, 0.067850906365838709,
+    -0.075807688722411323, 0.019816052510173831, -0.0060333543116796841, 0.14715222175970813,
+    0.12964760110611734, -0.16164009238295787, 0.019782440444874132, -0.057228779049778702,
+    0.0089012469566214156, -0.06218668947975349, -0.035948619653483532, -0.077281921638338261,
+    0.076510145833846147, -0.14986062189110244, 0.05092220039273973, 0.087303091716085551,
+    -0.24348289799499512, -0.11896274445481042, 0.01263187239768724, -0.0032939844776220823,
+    0.23244131295104628, 0.092539042976239161, -0.017608416645484546, 0.031576052087830375,
+    -0.05185708734088313, 0.10543944296979108, 0.035575845708844152, -0.22582472302243062,
+    -0.12227705653235388, 0.12320128121104083, -0.22954373094417535, 0.10273069719837319,
+    0.063787697300970933, 0.18619920533416551, 0.099187462880148333, -0.093413752392710422,
+    -0.0041449171471635788, 0.10020149553008506, -0.049379125225528758, 0.049325201190731111,
+    -0.008351666471947088, 0.12092777139588928, -0.13539318509337486, 0.18279504056998266,
+    -0.072311999586263664, 0.019378033395333383, 0.15445894006937924, -0.10002816450067491,
+    -0.1139852478841118, -0.00079648111731626784, 0.13218428391498974, -0.069719845991474946,
+    0.083419591105401189, 0.055731244211689755, -0.064183945883279928, -0.20966807278903948,
+    0.12348616263607871, -0.21434420355570155, 0.22792278330793911, 0.15136911115617557,
+    0.17601766306909361, -0.09748904535254059, 0.1096078728135676, -0.014010585345841948,
+    0.066161825889423598, -0.038683728387106001, 0.1508350661313535, 0.1216368778342206,
+    0.077683920239397103, -0.008993526043899986, 0.018449114258347936, 0.091005467985465563,
+    -0.13079434320387875, 0.2423907520430594, 0.11559822692254655, -0.059132155026014391,
+    -0.014629149763711317, -0.15861098271801846, 0.051516159206114367, 0.10738907286231085,
+    0.061133016213361972, -0.1592146867236279, -0.12473641701495798, -0.015813925784518991,
+    -0.0086453444560956345, 0.07973643426473917, 0.026332570779948446, 0.075298346219296181,
+    0.09644928733435873, -0.19160771642297481, -0.11125366557047549, 0.045299659645997671,
+    -0.14757230643762928, -0.070806381109679864, 0.083171995308666341, -0.079626834694169132,
+    -0.024573521175996548, -0.08165017175544198, 0.16454859215889567, -0.022918926649274529,
+    0.042358478138073356, -0.059947794630825939, 0.01552619624928182, -0.071390914627223995,
+    -0.21275474529408492, 0.080449943631324919, 0.030560774380985301, 0.021928719613309191,
+    -0.10145348756656479, -0.074507670946652976, -0.13644877565016297, -0.11904309080920221,
+    0.076385832122806349, -0.05871376618860244, 0.085004783463119377, 0.12472942282400915,
+    0.042506734401766652, -0.11675497260887399, 0.053636474831792298, 0.027995070722694557,
+    0.15991462323130717, 0.014392161578114045, -0.11636303623558154, 0.14604556533497878,
+    0.017146481889657374, -0.011253427766352426, 0.16274515180703045, -0.14396264462947747,
+    -0.068476961118926968, 0.11876881342445061, 0.16722328817781604, -0.10641958742728511,
+    -0.10892913738931943, 0.074236857059597122, -0.17958806571180636, -0.0094938310100843217,
+    0.0014957134037416155, 0.031746472324674826, 0.091365850601324919, -0.023537998878327318,
+    0.091758584173965721, -0.16423080732996276, 0.084598312647444399, 0.0080101580001796461,
+    -0.20016925421291615, -0.00022725107534084514, 0.122660179187127, 0.13698458156919391,
+    -0.0017840396115270042, 0.056119234483170778, -0.1069013911931645, -0.016310632823655163,
+    -0.071317895293639383, 0.019286082556843831, -0.047572416100001659, 0.069042976620817834,
+    -0.096080017049316332, 0.023552165823421702, -0.054801036604063366, -0.12200171245464646,
+    -0.040693335479606046, -0.095421208896836793, 0.18758804899824247, -0.077541114873531047,
+    -0.09552450691786879, 0.26178386534905629, 0.17257904743977778, 0.053045753730981415,
+    -0.090145927041114488, -0.16125874763915224, -0.0028367187352426248, -0.0092281609181756302,
+    0.0088108033337205762, 0.10717478309695265, 0.037991492169404603, 0.19812898030083914,
+    -0.026586593002007847, 0.042299325932090522, 0.028247921870268398, 0.12919396303622666,
+    -0.10893471608779864, 0.083224069647515705, 0.081036867310309305, 0.066127238914123074,
+    -0.04350201588640356, -0.026289287289007337, 0.015963643473938641, -0.062063876542731981,
+    0.080168687648626641, -0.0042206917942986472, -0.089210563155851227, 0.030346501715971159,
+    -0.062700748098696857, 0.075627995128607226, -0.020093411530515297, 0.098043586795112991,
+    -0.088886266354198648, -0.0463215864730398, 0.029469577495249141, -0.11332541344150474,
+    -0.12189624565873949, 0.017768288484391662, -0.15196237544888877, -0.031653499770818896,
+    -0.020723966413390273, -0.19223940790311683, 0.17132896868677314, 0.095039839698713519,
+    -0.097050586157051755, -0.032245631032229487, -0.03437038625462268, -0.14249152038096935,
+    -0.029148513657291809, -0.085080512090160307, -0.092882884154831175, 0.01892406646444348,
+    -0.14832799231261179, -0.043281183154403241, -0.075953276005673948, 0.11435076552836491,
+    0.031277738780897846, 0.084115281675995621, 0.038648776847262173, 0.1720162998733096,
+    0.0037862809738823432, -0.018528408711575226, 0.011606481944155709, -0.071966316187918267,
+    -0.061990029249347579, -0.02059976259219742, -0.056565892255884632, -0.18261148503260649,
+    0.11908080049943082, -0.20781349511201139, 0.12865379356094994, 0.023977879169109925,
+    0.31993600941714456, -0.059955262971138575, -0.10855839397262707, -0.063367249293597119,
+    0.070139888184191604, -0.025837891404493354, -0.06682705611172908, -0.018231893689906398,
+    -0.06927875973799863, -0.13783310049572525, -0.14027286511034404, -0.20901796564807296,
+    -0.029579391728653277, -0.019137342257928638, 0.0047651950143010767, -0.077342932973606796,
+    0.17197849171414778, -0.12308231082339186, 0.098758296979044966, -0.020690472969652207,
+    -0.0078261846036311433, -0.0054338426332969751, 0.056389417043887592, 0.12973587113764665,
+    0.036982495065735539, -0.059023379242996436, 0.1616386797469534, 0.14666575685516389,
+    0.039761177020684858, -0.0046879469635189202, -0.002880155303817248, -0.091742066967160626,
+    0.0087275494711399112, -0.0096338538243301991, 0.071805678098358, 0.020330062637091948,
+    -0.054697747846028766, 0.26948762776309765, 0.0890616479250326, 0.0078537334991439067,
+    0.0091187722449999706, 0.030219503138023518, -0.078383307816461897, -0.090960143741506294,
+    0.043273266733892486, -0.10475179596272588, -0.19544971725443319, 0.11345553111950235,
+    0.070668798376555847, 0.033670048794072337, -0.1570785184978741, 0.15338328080995273,
+    0.027739729051368092, 0.17456809182601368, 0.086270006823669657, 0.0018952696505489528,
+    -0.054470934334475349, -0.09464242971758538, -0.069643093342943413, -0.0019719688389104109,
+    -0.21082971657421007, -0.023869962641605402, -0.12158247949983882, -0.022899716419935302,
+    0.11298605113327849, -0.11211751710609769, 0.0896410886538197, -0.092333026805664006,
+    -0.17427482818878237, 0.052939862418978384, 0.11625393482570318, 0.13948556877649929,
+    -0.11665042548376757, 0.060623143522977513, -0.15642848910212834, -0.065447914628004936,
+    -0.027975956356815827, 0.1535992346469916, -0.15058492412344948, 0.029172850675090983,
+    0.066616767195024171, -0.19265601023483958, 0.041611957574912303, 0.11299229088297177,
+    -0.0441550606329408, -0.13025794442254793, 0.052918890311177892, 0.20289106912143079,
+    0.11607053192763772, -0.10632192082665734, 0.025589975236329297, -0.065915325652003948,
+    0.031964472559557526, 0.046839720755751928, -0.062674095087415158, 0.045749406622112965,
+    0.16403557078756145, -0.045301938401382247, -0.16850918528420461, 0.10716061299046598,
+    -0.079053291484125959, 0.0080716965929654681, -0.051184514419378171, 0.11517655269572158,
+    0.10499019733080535, -0.076175266757671015, 0.054905024766359535, 0.29249359478130971,
+    0.025854556184430787, 0.02016361679930586, 0.1409150022917337, -0.13504249209583899,
+    0.14966806086571943, -0.11813948188882913, 0.16564298724542248, 0.10088904215682898,
+    -0.061755303191546117, -0.093715124001267941, 0.059198939895166752, 0.14997744231341273,
+    0.04798345543675795, -0.053467042794655931, -0.13679276798769519, 0.050570509612500668,
+    0.037664126597512018, 0.035942526650572675, 0.00052864938447411873, 0.053954604348339805,
+    0.054536080360023581, 0.10467912000354625, 0.066927598137944855, -0.012707725702387008,
+    -0.067681816651257817, -0.091932636443316521, 0.016763623083834393, 0.12295390311659235,
+    0.048728380622088251, 0.051125659012935025, 0.15786546198758838, 0.13703940446192056,
+    0.057335228642894989, -0.025394445341527166, -0.17780273912393832, -0.045346159691575225,
+    -0.0077020779704448971, -0.13768676266235821, 0.067528202553147773, 0.061769242138656366,
+    -0.025173332352337052, 0.08049110017195632, 0.090763522476298167, 0.070799891324959105,
+    0.073537379898372182, 0.12624286998437442, 0.066948429378910296, -0.087907330245632867,
+    -0.073910441908728711, -0.049789644564457662, 0.045442328665266311, 0.017221520073816558,
+    0.020387154106633502, -0.15014405727202151, -0.082224468862428651, -0.16383117338969819,
+    -0.03533622374486544, 0.16863304675640678, -0.047323202763043123, -0.019707528908315924,
+    0.047149811300228404, 0.12186225403950736, -0.012437512889344561, 0.070973283502598128,
+    0.2582451469706003, -0.034208560444468204, 0.096680242801409522, -0.068118956976753506,
+    0.18700487016603765, 0.10404451166871544, 0.022392722034783812, -0.065487186363071118,
+    0.033044691812689923, -0.0061566677139912856, 0.073939003796687636, -0.047380398556912826,
+    -0.010990784150772386, 0.036697677269195539, 0.0081345921146379879, -0.043757100699106266,
+    0.049836761322399517, -0.0068315369750780322, -0.15176903795715291, -0.1249705013370174,
+    -0.048572401540168925, 0.052248853047161127, -0.0053144996627783646, 0.0051009554315596993,
+    0.03482603052317431, -0.0029951528857431464, -0.1322246748191121, -0.096452617392319445,
+    -0.10073635662135541, -0.10975956380794356, 0.091547123846484474, 0.01037155423874722,
+    -0.011231500925581148, 0.13274658240623119, -0.022673540854963148, 0.053133236027056038,
+    -0.19310875332678254, -0.07284345322636554, -0.060194112364614853, -0.04464553405988099,
+    0.13704209718146637, 0.013124633932685429, 0.12671070337235477, 0.026220663470879785,
+    -0.10352831010490132, 0.019780195224165905, -0.012062324954746946, 0.099599732405676711,
+    0.10480967786342976, 0.063717497348085045, -0.036719332702989403, -0.023175270226396927,
+    0.028970392885713504, 0.20922640242231877, 0.055862026092079693, 0.013136342311849097,
+    0.022437291884183232, -0.0023830777622511502, -0.0094346218789019033, 0.12727861662231874,
+    0.040827462793175555, 0.039796499139328909, -0.10279110799700381, 0.16658987982083812,
+    0.093807767570749601, -0.028282390120323381, -0.096826986319680966, 0.032645660014835362,
+    0.15226557312726824, 0.0026667913205698284, 0.0087583462151880464, 0.1009445676804908,
+    -0.00091931089994722558, -0.044107405857688589, 0.10455282222433768, 0.143722795242785,
+    0.048332533507053278, -0.028177873438893157, 0.23595103723468022, -0.11788693233761595,
+    0.038505130479937338, 0.27739791383311235, 0.068058207217892547, 0.093166964882675049,
+    0.062496096102171009, -0.1781322124396599, -0.023474842330023334, 0.10045626980904304,
+    0.070665613953202297, 0.043711383381670924, -0.09359791268747028, -0.012955832982683865,
+    0.10292472162693678, -0.026610912236432256, -0.010213044246160048, 0.027577328673612782,
+    -0.10237699434192418, 0.30746353757656669, 0.055467913109465056, -0.10421696641196904,
+    0.0071900944682358478, -0.065771415257667304, -0.044047280764973787, -0.12299450583135008,
+    -0.11741572517740297, 0.0020777665392560643, 0.11513653429710721, -0.076728006548488742,
+    -0.17425305536178132, -0.027532695369773458, 0.048480502023636227, 0.20639716827181245,
+    -0.13605923043192755, -0.070042593538198625, 0.026581954639327519, -0.083549225497523888,
+    0.097297397948796147, 0.15068668117386044, -0.036843274121299029, 0.038507093733898809,
+    0.017324477666883741, -0.084762403859381497, 0.037639495856874705, 0.086253330100894698,
+    0.015823321538014256, -0.0082896510102282231, 0.072608842049195682, -0.13260230221270139,
+    0.05245079835935279, 0.013475940943791637, -0.16509336450383685, 0.16675877211065149,
+    -0.050036475650604165, -0.050449804913108291, -0.080180870208454824, -0.099087732971002845,
+    0.029561137323818144, 0.04843399927287214, 0.032459185277972494, 0.11631902129799632,
+    -0.025519573922517854, -0.090677696669843211, -0.030858091913738214, 0.076620566320537417,
+    -0.073319327613604948, -0.12412404139217559, 0.017349497114959048, -0.13888701061396277,
+    -0.11651310017255652, 0.029574664959116662, -0.12052364813622347, -0.087470162021695025,
+    0.026075552160983229, -0.056713533035834707, 0.18307249437250642, -0.051126457691915254,
+    -0.0079831394299799685, -0.054214961451168713, 0.098152121380988777, -0.088651884836568856,
+    0.087155171838607257, 0.14527331186680689, -0.047800325908341129, 0.0037519184460738752,
+    -0.028193991215427219, -0.20509165812404204, 0.016541354111321051, 0.11382038812485314,
+    0.033182573989420205, -0.064700476902146767, -0.24086236301453434, -0.0047382012798341151,
+    -0.026062898977190503, -0.049409643233132787, -0.093040259483892079, -0.12092839223652874,
+    -0.17668948298741638, 0.07154713643858189, 0.057247389711262787, 0.22826480247695119,
+    -0.13459789661514385, -0.047065468728724393, -0.1114557351996915, -0.053780154027749195,
+    -0.07339920366193696, 0.13539626704180041, -0.10053004860009487, -0.0080453214294110894,
+    -0.045041045569622559, -0.059350340094237758, 0.044919598917518684, -0.15074539256968908,
+    -0.1404561698690015, 0.083122769579581146, -0.090582329259977723, 0.17572865000564977,
+    -0.16591522820697269, 0.054572942056221374, -0.2062647119654728, -0.18431603452767717,
+    -0.03526624059061774, 0.0023300770561654745, -0.24049820471727834, -0.10301278014651001,
+    -0.079171712282871842, -0.17473279812000486, -0.046626475025375709, 0.028453842372003615,
+    0.029901537789590201, -0.043088160348920976, 0.060524523176271196, -0.040753067399117368,
+    -0.039181336689599951, -0.12527845785869632, 0.10579351894357066, -0.069966755965685953,
+    -0.0048517120682268298, 0.055741310842972271, -0.11669791540150148, -0.055920816335624339,
+    -0.040571436075098125, -0.027682640688519028, 0.13353499980607048, -0.0039077922174752013,
+    0.072312535873840206, -0.22604764694604751, 0.054288306988610348, 0.015432696707560043,
+    -0.12191076752807978, -0.10858973624859336, -0.1273742688472394, 0.0071297449061743547,
+    -0.1271118633880674, 0.062865201707740681, -0.09402799269895494, -0.033614538866384033,
+    -0.22008233044929737, -0.034592444286018521, -0.058802774283684467, 0.16029300270838212,
+    0.1725234185345369, -0.16166365908482133, 0.093968513398834178, 0.084628829808091666,
+    0.14474377100648769, -0.014870003304674369, 0.1583787887083368, -0.08313785339782731,
+    -0.2028412368898537, -0.11581515909590796, 0.036129824514476841, -0.069895801685968692,
+    0.014245091581292014, -0.077735295997517939, -0.12022625827251837, 0.094637449677353797,
+    -0.024209182676503453, 0.02106895414882352, 0.031042418458204449, -0.011132499508428616,
+    0.034089921916314853, -0.010777863707209952, 0.054980152948545503, 0.13539179526156128,
+    -0.028301794569836974, -0.17572336840661265, -0.019411798016689543, -0.029950747855492146,
+    -0.0027191094956427369, 0.054614855891271685, -0.18003289550427518, -0.13054701723651324,
+    0.066783736690187084, -0.0081352790081870765, -0.094265263344793154, -0.011985363543454794,
+    -0.094834556668819028, -0.03099040355180413, -0.02393843064056966, -0.065900675486349022,
+    0.086760234660878732, -0.071838767804103823, 0.097173391596004799, 0.041801209447339643,
+    -0.0064056574264023921, 0.031219441643778819, -0.029266534980346537, -0.052469488792886432,
+    0.13347825604863223, -0.076008716924213807, -0.074839539491701121, 0.05100248431407009,
+    -0.12604571669046841, 0.11160523749813474, -0.040906678712930938, 0.17171326361864797,
+    -0.052254904065335631, 0.042828563794402044, -0.031287264676817209, 0.051093108351798679,
+    0.13794487812310272, 0.063627159485700316, -0.066333711104757137, -0.063013204611207324,
+    -0.032165556927753129, -0.012295943190770559, -0.18799102493513917, -0.094403560064944908,
+    -0.093505747738187775, 0.14356330948839011, 0.15926362237616112, 0.0784876151602516,
+    0.017033327686068769, 0.034178462090569212, 0.018114289929841831, 0.15969407426641188,
+    -0.23308121959048425, 0.072031975863315695, -0.042277043459319881, 0.083714492834510268,
+    0.17854255337149302, 0.078295585524241387, 0.070406523085321124, 0.065737122753576668,
+    0.011969706270976892, 0.068601120521889866, -0.0085701227146425668, -0.025406417704561417,
+    -0.075049828633314247, 0.15703214553849063, 0.036176313510410875, 0.11363079408150784,
+    0.27536125923725097, -0.00071354310354699549, -0.045711870617939312, 0.10247856771536831,
+    -0.083397142051521433, -0.019568873728704944, 0.007784739266720327, 0.084289897704563035,
+    0.051712572664985398, 0.047663019529687344, -0.094134640256213445, 0.077723755752065027,
+    -0.086436067881785844, 0.10818222351528994, 0.04585998578570006, 0.063342044847566184,
+    -0.025924117717819602, 0.019423701071124958, 0.054739985142650209, -0.043601237266329862,
+    0.15990960759092318, -0.0086424791715906824, 0.082075042793495645, -0.12618608873912607,
+    0.078777708033811372, 0.1007639693978401, 0.057507669429136946, 0.087560703431682305,
+    0.024348975028593803, 0.088520154434833964, 0.033671953602100575, 0.14691590165151314,
+    0.11902070418971913, 0.013859910426209293, 0.084640054463166414, -0.0025085831605603012,
+    0.033970479989890834, 0.12599240036498818, -0.12791733548770509, -0.09150822090950031,
+    -0.024745628593890678, 0.14968067253286371, 0.15788344993931155, 0.0078270069381100125,
+    0.066300058338237017, -0.016027169371623316, -0.14257166347393813, 0.044305762117781283,
+    0.19615028755562192, 0.038872159713317207, -0.07441229532281779, -0.14349801152598071,
+    0.11377089417130776, 0.1250204794719226, -0.11508913101397183, -0.029640959349002034,
+    -0.083037876877671599, 0.02948128753321641, -0.019045645837594188, 0.006529733514957242,
+    -0.22180096295005869, -0.079185752540644291, -0.17880541396821614, -0.10378765417379474,
+    -0.048866310011184071, 0.041008589818640015, 0.06732050142124911, -0.12390049734946595,
+    -0.13425949358843292, 0.028831449615636669, 0.053365077671556869, -0.15533792501191596,
+    -0.15622245643670507, 0.14276241442489626, 0.066856156132131028, -0.050942834115094059,
+    -0.17983310727232696, 0.022013208216332372, 0.22246092355830627, -0.039256682994327628,
+    0.0032653827101150491, -0.062222481935117056, 0.19209053973414247, 0.062072601800056734,
+    0.14329605437875217, 0.069113716078732818, -0.087651078142950395, 0.038336244386409007,
+    0.14049680880563736, -0.083894890376567624, -0.16552348242761919, 0.038729070833261721,
+    -0.032823741235591238, 0.13120297202994322, -0.036892716468886519, 0.014771644814282781,
+    -0.14775549919200975, 0.15217259794408905, 0.04254646485797603, -0.2440813752240234,
+    -0.066387031890060469, 0.18447783171821233, 0.084556094436528423, -0.010928328767109037,
+    0.24314418671714524, -0.18443942112871059, 0.10394591206720216, -0.011618578136615348,
+    -0.20026238777813271, 0.039841537951806762, 0.16147904230900725, 0.033728661833382946,
+    0.11485531983223886, 0.10875742718128746, 0.079166209592521269, -0.30117152645746864,
+    0.18483186195291421, 0.15365124665352853, 0.031484636904807253, -0.047417620145013384,
+    0.20854734285888596, 0.049203437925797865, -0.099383052401468372, -0.010375207163131235,
+    0.11424758305409922, -0.031031758127104802, -0.043805957167312094, 0.027622675653789456,
+    -0.030297972068577442, 0.057613550046525498, 0.085417860906983847, -0.10764064145706785,
+    0.029230382926024576, 0.055066656031518862, 0.022437473756753524, 0.21288635507754564,
+    -0.032909692652842763, -0.00027906780937312942, 0.18978489514436409, -0.090938468181663179,
+    0.098647714137093973, -0.03301227532555643, 0.071262591099796907, -0.058675212715773521,
+    0.026168451880582727, -0.034836001435478707, 0.074646468975153799, -0.013008297749052428,
+    -0.040889808405073808, -0.089821477908783906, -0.11196269013749809, 0.10483439649105072,
+    0.00041217816689886731, -0.094909835950499136, 0.14593573746137936, 0.071358030883879195,
+    0.12351644377620674, 0.063080465908035691, 0.013584612299351609, -0.11213735156334061,
+    -0.029037196975667541, 0.14758880923473375, 0.045096204924226307, -0.11996089152162012,
+    0.0081016368498654564, 0.10811759123463507, -0.04381214523399625, -0.15965452806263183,
+    0.0736247594922156, 0.15496021214338634, 0.081011833999360724, -0.024738885841850855,
+    0.11249230070608834, -0.061263444070327661, -0.0043720692294709424, -0.045516448186741339,
+    0.12199464027959808, 0.1294649920306194, 0.025310997141374223, -0.09589412708915665,
+    -0.02221700164789003, 0.043203569338657669, 0.061088685887886761, 0.11762336636600451,
+};
+
+constexpr NumType layer2_biases[100] = {
+    0.0094887432387503762, 0.010216533550119113, 0.010007618817778487, 0.0099966562290983094,
+    0.01, 0.0073765711764134387, 0.0098181226194917464, 0.011271194125803038,
+    0.011320055748602268, 0.0099265904721150631, 0.01, 0.010052124618599599,
+    0.012041424727928345, 0.01, 0.015099539586641824, 0.010221557740484263,
+    0.010111718560457632, 0.0099043588917768991, 0.01052041695156708, 0.00093960066654919406,
+    0.0079688787348147685, 0.010004672794696924, 0.0095712928663307609, 0.013622332678543552,
+    0.01019223516848476, 0.01, 0.010089230432831596, 0.011967787632557653,
+    0.01, 0.011040192046726204, 0.011304154765749298, 0.01,
+    0.01, 0.01, 0.011696530011044834, 0.01,
+    0.0083066571677237536, 0.0086870333495736949, 0.0078320648457447309, 0.010069687224149552,
+    0.010065511782182134, 0.0095031523256817185, 0.0093338427349362769, 0.0098518802201172841,
+    0.0089995598864057672, 0.0098058702604854626, 0.01, 0.011323271109134652,
+    0.0089782473740749238, 0.0099951220964506707, 0.0074385320294904295, 0.0096629271460794506,
+    0.009715189671965066, 0.013940662711983553, 0.0099546561535261095, 0.018113827933429236,
+    0.017834667716243022, 0.0097045331435155324, 0.0085306124979675768, 0.01,
+    0.01, 0.015105856803092749, 0.01, 0.011238525216308077,
+    0.010235396802766932, 0.010101428255866121, 0.010061434793850481, 0.01,
+    0.0088140145013344516, 0.01020373009561858, 0.0098778102310311949, 0.011015451663368193,
+    0.0088123395107318064, 0.01, 0.012726415767003665, 0.01,
+    0.0097585217264393263, 0.01, 0.01, 0.011292186107413801,
+    0.012299808262815281, 0.0075205183495959012, 0.012248214459368979, 0.010602988494892513,
+    0.0078101657069147524, 0.0077120781533202027, 0.012518703209968656, 0.0056190752119461727,
+    0.0099407738208075729, 0.0092374763339654418, 0.010049637119357146, 0.01,
+    0.010056026079948217, 0.010597937814431992, 0.010511685389325924, 0.01031140507387681,
+    0.0099782695175592798, 0.009131161760783978, 0.01, 0.0097927517579587502,
+};
+
+constexpr NumType layer4_weights[200] = {
+    0.070560190091969108, 0.090088349456985892, 0.016192540012422145, -0.013128889860807985,
+    0.049213362996935711, -0.016567564815783555, -0.05128029056095916, 0.13934767565432227,
+    0.056172489887897588, 0.030805793705098391, 0.047783501764547577, 0.040322407827084031,
+    0.15054944116058555, 0.040366739281515351, 0.08926542622277113, -0.045657764680180547,
+    0.13950613170222698, -0.12410278830183268, 0.0031246418983622085, -0.10611869160646591,
+    -0.20347794364742991, 0.01582842651252719, -0.063650868092848645, 0.083167275578400868,
+    -0.038820018022412292, -0.015959285531885286, 0.067512031658216287, 0.10003992656658468,
+    0.045668710828359799, 0.18424836679395384, 0.055467185227729178, 0.071566160679644192,
+    0.16801333025510945, 0.081247681733400703, 0.091840572150768782, -0.071290673035316984,
+    0.047436382259749471, -0.032020121678075962, -0.1611866544503506, -0.051502893576159503,
+    0.010427056349973797, 0.073793508814685868, 0.13132202383431588, -0.042790600078362606,
+    0.11512226286943421, -0.055329662487436586, 0.033013944295505797, -0.048853186898433015,
+    -0.012740741795464706, -0.020505428321283239, 0.031170645468347212, -0.033372271288384193,
+    -0.092285110139098889, 0.30694512487414988, -0.14893272850666389, 0.19482566624891354,
+    0.19497524932306443, -0.20922573715074735, 0.07490259009399175, -0.012809488712873535,
+    0.048120251020856514, 0.055599556569335587, -0.032285232065332618, -0.026874777903958223,
+    0.068469434623846581, 0.11946473739596877, -0.022280197456538742, -0.096432261053202517,
+    -0.11113482281290953, 0.12152981055097863, -0.053708102860304724, 0.098391711861069514,
+    -0.10265308593194256, 0.099750298764419723, 0.15359236458803821, 0.067479352436179807,
+    -0.057279370464931208, 0.011805875410371499, 0.017897382079737099, 0.0058863374098798481,
+    0.10834727935635072, -0.085482002344554706, 0.14607887830581442, 0.054023650902076406,
+    -0.063722265456723728, 0.079986537732826268, 0.072843964635558076, -0.1185519028279898,
+    -0.10545244653949827, 0.035215896961440771, -0.0062040835772836393, -0.041542266666673537,
+    -0.020820027386568869, -0.010495886574568826, 0.053210666679584996, 0.0083929635575594238,
+    -0.0089743989297038189, 0.027654315942044167, 0.022396466420969992, -0.034603011898263501,
+    0.069845962636702522, 0.056878021663916659, 0.00092990750929819162, 0.016034216524181504,
+    -0.052128564712120143, 0.10633909553989461, -0.04250754303532097, 0.059193206319996375,
+    -0.023739242586430578, 0.017971537183520171, -0.19372348433703301, 0.015929119716215835,
+    0.015394675387706034, -0.039102452929718305, -0.16866241185255834, -0.12009868460715242,
+    0.096932097008193302, 0.051346784381576346, -0.035135368013804326, 0.29233700279910957,
+    -0.12947763747352936, 0.0020396603072473803, 0.03745421841697303, -0.10092013827719669,
+    -0.086257945708959408, 0.16892424505075573, -0.067346197613553885, -0.048479917302299572,
+    -0.060765510478614775, 0.094558808050974857, -0.021555906966367996, 0.090497967999878234,
+    -0.02617749978507113, 0.10718688994652339, -0.0092854209591331349, -0.20226728084885914,
+    0.13867560778497592, 0.11116590279356317, 0.15216659702440477, -0.069191718091127438,
+    0.00076333293717098234, 0.11671813997944999, 0.17748487491418352, 0.030442607572159351,
+    0.11349584577480575, 0.070876602874557465, 0.048658451594338875, -0.12164618003056611,
+    0.0037728209068905931, -0.018047174767740155, 0.14705779218090589, 0.047007898659588106,
+    0.0095479275150788575, 0.0093828965085746771, -0.015999348735720811, -0.20882139057849558,
+    -0.19636725567921079, 0.022129153980377136, 0.14934156596486697, -0.022143567523084058,
+    -0.05795013523332021, -0.28957006359925813, 0.0026062624245255231, -0.10143734290727316,
+    0.023349426112554854, 0.05455866199369503, -0.056316862246442445, 0.085683974836963925,
+    0.0068254502655586725, 0.10675675769341185, -0.072842541140398523, -0.091240472926752969,
+    -0.051572093286736204, -0.02625905497709129, -0.017455304271987358, -0.24826306911104323,
+    -0.036079709077062518, -0.032376084694703385, -0.14610383020155332, -0.071168116037299819,
+    -0.04307525441598279, 0.051978951516980378, 0.011381703881218832, -0.0026067050568411719,
+    0.22848370470743384, 0.17140110513945978, -0.080439559395337715, 0.096291823893915593,
+    0.068217070101898813, 0.048655000098810089, -0.074666856553615102, 0.069005795428618122,
+    -0.1652344741060148, -0.053411744828660852, 0.011253446134136312, -0.019325458134154806,
+    0.01746161448166493, 0.062334983686776646, -0.071821659871636398, -0.038001793207059563,
+};
+
+constexpr NumType layer4_biases[2] = {
+    0.031260460479844696, -0.011260460479844697,
+};
+
+void dense(NumType* dst, const NumType* src, const NumType* weights,
+           const NumType* bias, std::size_t input_size, std::size_t output_size)
+{
+    for (std::size_t i = 0; i < output_size; ++i)
+    {
+        dst[i] = bias[i];
+        for (std::size_t j = 0; j < input_size; ++j)
+        {
+            dst[i] += weights[(i * input_size) + j] * src[j];
+        }
+    }
+}
+
+void relu(NumType* dst, const NumType* src, std::size_t length)
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] = src[i] < NumType{0} ? NumType{0} : src[i];
+    }
+}
+
+void stable_softmax(NumType* dst, const NumType* src, std::size_t length)
+{
+    NumType d = src[0];
+    for (std::size_t i = 1; i < length; ++i)
+    {
+        if (d < src[i]) d = src[i];
+    }
+    NumType sum_exp_z{0};
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] = std::exp(src[i] - d);
+        sum_exp_z += dst[i];
+    }
+    NumType inv_sum_exp_z = NumType{1} / sum_exp_z;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        dst[i] *= inv_sum_exp_z;
+    }
+}
+
+} // namespace
+
+/**
+ * \brief Model inference.
+ * \param input  Array of INPUT_SIZE elements.
+ * \param output Array of OUTPUT_SIZE elements.
+ */
+void predict(const NumType* input, NumType* output)
+{
+    NumType buffer0[200];
+    NumType buffer1[200];
+    // h1 (Dense).
+    dense(buffer0, input, layer0_weights, layer0_biases, 4, 200);
+    // h1_relu (Relu).
+    relu(buffer1, buffer0, 200);
+    // h2 (Dense).
+    dense(buffer0, buffer1, layer2_weights, layer2_biases, 200, 100);
+    // h2_relu (Relu).
+    relu(buffer1, buffer0, 100);
+    // out (Dense).
+    dense(buffer0, buffer1, layer4_weights, layer4_biases, 100, 2);
+    // out_softmax (Softmax).
+    stable_softmax(output, buffer0, 2);
+}
+
+} // namespace from_json
@@ -0,0 +1,96 @@
+#include "codegen_model.cpp"
+#include "codegen_json.cpp"
+#include <cstdio>
+#include <limits>
+using from_model::NumType;
+static_assert(from_model::INPUT_SIZE == 4, "input size");
+static_assert(from_model::OUTPUT_SIZE == 2, "output size");
+static const NumType inputs[] = {
+0.84486437037649087,0.73459437670428063,0.026280194725318839,0.74568334107419409,
+0.1879561513465054,0.88375618331152939,0.28528851241090325,0.91006477283110532,
+0.78725544272130499,0.37444558119111632,0.99107958654756478,0.98742533750302897,
+0.91476725047475127,0.20161143345365085,0.67645111465920094,0.94236840968565949,
+0.79171726660498432,0.84738739897209903,0.73230817093800038,0.023424042476325291,
+0.6119252075173488,0.82305309077333788,0.28457286617425603,0.85165438397749205,
+0.36060797706965458,0.65620417062409031,0.17818441915038452,0.48265300414535472,
+0.51013803203254537,0.3568713591570653,0.7941462949242204,0.23362783538219534,
+0.79361923272942869,0.94012932160240859,0.32162800837776268,0.056872157650220245,
+0.78946877094480561,0.70069655030029976,0.70274315539675947,0.55113395241837326,
+0.86254695028936801,0.71358936811174423,0.59112720539170216,0.68844334912767247,
+0.26013104483991933,0.7813474767294073,0.36072438473423341,0.015088225725448989,
+0.2010173731710046,0.85670461103448736,0.41505315469628551,0.28275557349617231,
+0.93652606508435898,0.53646528561565532,0.39160664873622808,0.80926017765805569,
+0.25062538367328435,0.82145621803450852,0.11386640783399748,0.73512022341510008,
+0.28423089343461522,0.077443720816615436,0.082301368705959721,0.73903208402260212,
+0.53837225555108359,0.48826926391514519,0.89892632337021683,0.95220230865574307,
+0.059989683888969358,0.20825156709700987,0.60042889595828286,0.41541512791528101,
+0.44134911720067338,0.54941500632572104,0.42285729364999386,0.931205689254615,
+0.96569943827145499,0.21822250517348885,0.021295943790242244,0.28865519640062853,
+0.80568281245679707,0.82863734455536919,0.15760883871767639,0.17306131057536056,
+0.81991598809788457,0.60544310203066931,0.16985843158883773,0.32828650943584869,
+0.14938973979024617,0.061577288555890564,0.6836234168069053,0.32139694117458301,
+0.77060696155947628,0.29047003387811793,0.68464448918568854,0.28815654221781767,
+0.33688854300707927,0.99836347722183927,0.6108800407715187,0.73873854231439928,
+0.9967712835049124,0.43987488160822119,0.58841842976146363,0.05287523974789593,
+0.48889304225676344,0.99588567022992425,0.29959320632538933,0.73610630394126575,
+0.57928836358299551,0.82927396966809963,0.78679025870169561,0.21532436869244687,
+0.76944148790579037,0.98126165332990944,0.20026010749883649,0.59817281277776102,
+0.76253906487946366,0.95040553448357967,0.5532580150422276,0.12737211006030458,
+0.027183175824638306,0.42714787954145156,0.20021427817814563,0.11059317555944548,
+0.50244077429686473,0.96839294918460639,0.16997831428115762,0.89890649828014479,
+0.93741402755313441,0.26736242546249711,0.078516794443701465,0.70280195931444434,
+0.72229849654176959,0.76862532527160798,0.99587826814696589,0.52996179603189242,
+0.042665889064523455,0.74608965199174837,0.8049951924938572,0.36239411326957538,
+0.87135104612260306,0.30219434200540002,0.97012175345157969,0.37625757025362105,
+0.9716225396487419,0.8732306383275803,0.43277213028468131,0.0027918683149605328,
+0.51612556410861832,0.3062758774541986,0.21912887360674438,0.8550705446728134,
+0.38182284833601754,0.34797302890515919,0.67295153409475905,0.8265032030768158,
+0.53882130007170037,0.49696847785593046,0.50697776930764626,0.13073095370049981,
+0.13690266699117259,0.65638430265635395,0.6821610911264645,0.40787523570735518,
+0.26182392801444865,0.14949735485871612,0.97213905651214094,0.053592003499600194,
+0.80493081941513356,0.31040995524661241,0.90505387969375783,0.46307031811720933,
+0.858268935807319,0.41250249918835385,0.32021445933457116,0.49905495681707052,
+0.1086765419879297,0.83988537908165406,0.6318983422341633,0.66855715091321455,
+0.83498757684539715,0.97457787798934425,0.41099932412857298,0.73946245574375769,
+0.85240096619676042,0.5153324938548336,0.82905832279911329,0.96195720549959118,
+0.12628689749362054,0.86162076792216147,0.53337882285291516,0.70268977297149604,
+0.80465934316529575,0.952421147331033,0.59842103095238774,0.71680171180428431,
+0.18995868607628286,0.62973836901368818,0.26461827789873588,0.92255167742483457,
+0.57216486094193031,0.74094368828513524,0.88657719193355589,0.81197278787476379,
+0.17291730303421771,0.96343586226458477,0.30088816445321398,0.48336038508410328,
+0.52790041736940196,0.27778122446217302,0.46039767768243467,0.7729916179645886,
+0.43546304059210905,0.48658224839849612,0.10026678709328235,0.51102432930907815,
+0.81244379597017335,0.80002110837647267,0.88706179214038061,0.37152458974223418,
+0.8651005059093787,0.53200173005336726,0.16761996727394457,0.31150133493731896,
+0.23976349957680476,0.10575417025795825,0.39319872514022247,0.49606183546716542,
+0.17176821274662879,0.15877472999808989,0.11196923862540081,0.042090260287842018,
+0.39287954077456788,0.25877789616673119,0.8941663899266965,0.81282685790806986,
+0.86053668060187061,0.24113168086228154,0.75035276125194283,0.90724818429819887,
+0.90351631975345892,0.11437128860890677,0.53541189283959401,0.54377534885175238,
+0.82020052322143189,0.35047458841818341,0.92379376449107165,0.1592675803874084,
+0.78064980204824563,0.77847686935472493,0.7626417490486781,0.2165607964157259,
+0.43359644761012772,0.27081321559578603,0.18126344580899839,0.88031069621385649,
+};
+static void print(const NumType* out)
+{
+    for (std::size_t j = 0; j < from_model::OUTPUT_SIZE; ++j)
+    {
+        std::printf("%.*Lg ",
+            std::numeric_limits<NumType>::max_digits10,
+            static_cast<long double>(out[j]));
+    }
+}
+int main()
+{
+    NumType out[from_model::OUTPUT_SIZE];
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        const NumType* in = inputs + i * from_model::INPUT_SIZE;
+        from_model::predict(in, out);
+        print(out);
+        from_json::predict(in, out);
+        print(out);
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fnn.dir/test_fnn.cpp.o"
+  "CMakeFiles/test_fnn.dir/test_fnn.cpp.o.d"
+  "test_fnn"
+  "test_fnn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_layer_descriptor.dir/test_layer_descriptor.cpp.o"
+  "CMakeFiles/test_layer_descriptor.dir/test_layer_descriptor.cpp.o.d"
+  "test_layer_descriptor"
+  "test_layer_descriptor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_layer_descriptor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/middleware
+# Build directory: /root/repo/_rel_build/tests/middleware
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_fnn "test_fnn")
+set_tests_properties(test_fnn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/middleware/CMakeLists.txt;9;add_test;/root/repo/tests/middleware/CMakeLists.txt;0;")
+add_test(test_rnn "test_rnn")
+set_tests_properties(test_rnn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/middleware/CMakeLists.txt;9;add_test;/root/repo/tests/middleware/CMakeLists.txt;0;")
+add_test(test_layer_descriptor "test_layer_descriptor")
+set_tests_properties(test_layer_descriptor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/middleware/CMakeLists.txt;9;add_test;/root/repo/tests/middleware/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cifar.dir/test_cifar.cpp.o"
+  "CMakeFiles/test_cifar.dir/test_cifar.cpp.o.d"
+  "test_cifar"
+  "test_cifar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cifar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_json_document.dir/test_json_document.cpp.o"
+  "CMakeFiles/test_json_document.dir/test_json_document.cpp.o.d"
+  "test_json_document"
+  "test_json_document.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_json_document.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
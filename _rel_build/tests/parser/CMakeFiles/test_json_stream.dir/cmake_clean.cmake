@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_json_stream.dir/test_json_stream.cpp.o"
+  "CMakeFiles/test_json_stream.dir/test_json_stream.cpp.o.d"
+  "test_json_stream"
+  "test_json_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_json_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
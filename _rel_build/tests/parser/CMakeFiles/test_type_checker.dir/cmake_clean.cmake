@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_type_checker.dir/test_type_checker.cpp.o"
+  "CMakeFiles/test_type_checker.dir/test_type_checker.cpp.o.d"
+  "test_type_checker"
+  "test_type_checker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_checker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
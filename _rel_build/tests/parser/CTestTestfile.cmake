@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/parser
+# Build directory: /root/repo/_rel_build/tests/parser
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_type_checker "test_type_checker")
+set_tests_properties(test_type_checker PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_parser "test_parser")
+set_tests_properties(test_parser PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_csv "test_csv")
+set_tests_properties(test_csv PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_mnist "test_mnist")
+set_tests_properties(test_mnist PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_cifar "test_cifar")
+set_tests_properties(test_cifar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_json "test_json")
+set_tests_properties(test_json PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_json_stream "test_json_stream")
+set_tests_properties(test_json_stream PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
+add_test(test_json_document "test_json_document")
+set_tests_properties(test_json_document PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/parser/CMakeLists.txt;14;add_test;/root/repo/tests/parser/CMakeLists.txt;0;")
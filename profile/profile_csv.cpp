@@ -0,0 +1,117 @@
+/***************************************************************************
+ *            profile_json.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "profile.hpp"
+
+#include "dnn/dlmath.hpp"
+#include "parser/csv.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+class ProfileCsv : public Profile {
+public:
+
+    ProfileCsv() : Profile(10, "profile_csv")
+        , _seed(std::random_device{}())
+    { }
+
+    void run() {
+        profile_entries(1000000, 8);
+    }
+
+private:
+
+    void profile_entries(SizeType rows, SizeType cols)
+    {
+        const std::filesystem::path fp{"profile_csv.csv"};
+        std::ofstream out{fp, std::ios::trunc};
+        for (SizeType c = 0; c < cols; ++c)
+        {
+            out << (c ? "," : "") << "col" << c;
+        }
+        out << "\n";
+        for (SizeType r = 0; r < rows; ++r)
+        {
+            for (SizeType c = 0; c < cols; ++c)
+            {
+                out << (c ? "," : "") << DLMath::rand(-1.0, 1.0, _seed);
+            }
+            out << "\n";
+        }
+        out.close();
+        auto mb = static_cast<double>(std::filesystem::file_size(fp))
+            / (1024.0 * 1024.0);
+
+        auto csv = CSV(fp.string());
+        auto tag = std::to_string(rows) + "x" + std::to_string(cols);
+        _throughput(
+            "csv row by row entry of " + std::to_string(mb) + " MB",
+            [&](SizeType i) {
+                (void) i;
+                std::vector<NumType> data;
+                data.reserve(csv.entries_amount() * csv.cols_size());
+                for (SizeType r = 0; r < csv.entries_amount(); ++r)
+                {
+                    auto row = csv.entry(r);
+                    data.insert(data.end(), row.begin(), row.end());
+                }
+            },
+            "csv_entry_" + tag, mb);
+
+        std::vector<NumType> buffer(csv.entries_amount() * csv.cols_size());
+        _throughput(
+            "csv parallel entries of " + std::to_string(mb) + " MB",
+            [&](SizeType i) {
+                (void) i;
+                csv.entries(buffer.data());
+            },
+            "csv_entries_" + tag, mb);
+
+        std::filesystem::remove(fp);
+    }
+
+    void _throughput(const std::string& msg,
+                     std::function<void(SizeType)> function,
+                     const std::string& name, double mb)
+    {
+        auto start = std::chrono::steady_clock::now();
+        profile(msg, std::move(function), name);
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        std::cout << "throughput: "
+                  << mb * static_cast<double>(num_tries()) / elapsed.count()
+                  << " MB/s" << std::endl;
+    }
+
+    RneType _seed;
+};
+
+int main() {
+    ProfileCsv().run();
+}
@@ -0,0 +1,144 @@
+/***************************************************************************
+ *            profile_json.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "profile.hpp"
+
+#include "dnn/dlmath.hpp"
+#include "parser/json.hpp"
+#include "parser/json_document.hpp"
+
+#include <chrono>
+#include <string>
+#include <sstream>
+#include <vector>
+
+
+class ProfileJson : public Profile {
+public:
+
+    ProfileJson() : Profile(10, "profile_json")
+        , _seed(std::random_device{}())
+    { }
+
+    void run() {
+        // Fixtures of tests/parser/test_json.cpp repeated in a large list.
+        Json leaves = std::vector<JsonItem>({10, 10.0, "string", true});
+        Json dict = std::map<std::string, JsonItem>({
+            {"a", 10}, {"b", "string"}, {"c", true}, {"d", leaves}});
+        std::vector<JsonItem> fixtures;
+        for (SizeType i = 0; i < 20000; ++i)
+        {
+            fixtures.emplace_back(i % 2 ? leaves : dict);
+        }
+        profile_json("fixtures", _text(Json(fixtures)));
+
+        // Model dump like text: layers of weights.
+        std::vector<JsonItem> layers;
+        for (SizeType l = 0; l < 8; ++l)
+        {
+            std::vector<double> weights(64 * 1024);
+            for (auto& w: weights) w = DLMath::rand(-1.0, 1.0, _seed);
+            layers.emplace_back(std::map<std::string, JsonItem>({
+                {"type", "dense"},
+                {"name", "layer_" + std::to_string(l)},
+                {"weights", JsonList(weights)}}));
+        }
+        profile_json("weights", _text(Json(layers)));
+
+        profile_tree(1000000);
+    }
+
+private:
+
+    static std::string _text(const Json& json)
+    {
+        std::stringstream ss;
+        ss << json;
+        return ss.str();
+    }
+
+    void profile_json(const std::string& type, const std::string& text)
+    {
+        auto mb = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+
+        _throughput(
+            "json document parse of " + type + " " + std::to_string(mb)
+            + " MB",
+            [&](SizeType i) {
+                (void) i;
+                auto doc = JsonDocument::view(text);
+                (void) doc;
+            },
+            "json_document_" + type, mb);
+
+        _throughput(
+            "json stream operator>> of " + type + " " + std::to_string(mb)
+            + " MB",
+            [&](SizeType i) {
+                (void) i;
+                std::stringstream ss(text);
+                Json json;
+                ss >> json;
+            },
+            "json_stream_" + type, mb);
+    }
+
+    void profile_tree(SizeType weights_size)
+    {
+        std::vector<double> weights(weights_size);
+        for (auto& w: weights) w = DLMath::rand(-1.0, 1.0, _seed);
+
+        profile(
+            "json tree round trip of " + std::to_string(weights_size)
+            + " weights",
+            [&](SizeType i) {
+                (void) i;
+                Json model;
+                model["weights"] = JsonList(weights);
+                Json copy = model;
+                auto loaded = copy["weights"].as_vec<double>();
+                (void) loaded;
+            },
+            "json_tree_" + std::to_string(weights_size));
+    }
+
+    void _throughput(const std::string& msg,
+                     std::function<void(SizeType)> function,
+                     const std::string& name, double mb)
+    {
+        auto start = std::chrono::steady_clock::now();
+        profile(msg, std::move(function), name);
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        std::cout << "throughput: "
+                  << mb * static_cast<double>(num_tries()) / elapsed.count()
+                  << " MB/s" << std::endl;
+    }
+
+    RneType _seed;
+};
+
+int main() {
+    ProfileJson().run();
+}
@@ -0,0 +1,597 @@
+/***************************************************************************
+ *            data/compact_dataset.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  data/compact_dataset.hpp
+ *  \brief Dataset stored in a compact type and decoded when read.
+ */
+
+#ifndef EDGE_LEARNING_DATA_COMPACT_DATASET_HPP
+#define EDGE_LEARNING_DATA_COMPACT_DATASET_HPP
+
+#include "dataset.hpp"
+#include "parser/mnist.hpp"
+#include "parser/cifar.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Dataset with a storage type separate from the compute type.
+ *
+ * The values are stored as S, e.g. the std::uint8_t pixels of MNIST and
+ * CIFAR, and each feature has a scale and an offset: the value read is
+ * T(stored) * scale + offset. The normalizations only update the scale and
+ * the offset of the features, so the stored values are never rewritten and
+ * a 1 byte pixel is not widened to 8 bytes until a batch of entries is
+ * gathered in a Dataset<T> for training.
+ *
+ * \tparam S The arithmetic storage type.
+ * \tparam T The compute type of the values read.
+ */
+template<typename S, typename T = NumType>
+class CompactDataset {
+public:
+    static_assert(std::is_arithmetic_v<S>, "S has to be arithmetic");
+
+    using Storage = std::vector<S>;
+
+    /**
+     * \brief Empty construct a new CompactDataset object.
+     */
+    CompactDataset()
+        : _data{}
+        , _feature_size{0}
+        , _sequence_size{0}
+        , _feature_amount{0}
+        , _scale{}
+        , _offset{}
+        , _labels_idx{}
+        , _input_idx{}
+    {
+
+    }
+
+    /**
+     * \brief Construct a new CompactDataset object. The sizes are the ones
+     * of Dataset: the trailing values that do not fill a sequence are
+     * dropped.
+     * \param data          Storage The stored values.
+     * \param feature_size  SizeType The size of the features in number of
+     *                      elements.
+     * \param sequence_size SizeType The size of the sequence in number of
+     *                      feature entry.
+     * \param labels_idx    std::set<SizeType> The index of the feature to
+     *                      use as ground truth.
+     */
+    CompactDataset(Storage data,
+                   SizeType feature_size = 1,
+                   SizeType sequence_size = 1,
+                   std::set<SizeType> labels_idx = {})
+        : _data{std::move(data)}
+        , _feature_size{std::min(feature_size, _data.size())}
+        , _sequence_size{std::min(sequence_size,
+            SizeType(_data.size() / std::max(_feature_size, SizeType(1))))}
+        , _feature_amount{
+            SizeType(_data.size()
+                / std::max(_feature_size * _sequence_size, SizeType(1)))
+            * _sequence_size}
+        , _scale(_feature_size, T(1))
+        , _offset(_feature_size, T(0))
+        , _labels_idx{}
+        , _input_idx{}
+    {
+        _data.resize(_feature_amount * _feature_size);
+        label_idx(std::move(labels_idx));
+    }
+
+    /**
+     * \brief Parse a dataset from a given parser and label encoding, then
+     * narrow the values to the storage type. With the default encoding, the
+     * Mnist and Cifar parsers fill the storage directly without a NumType
+     * copy of the dataset if S holds all the byte values. The other values
+     * are checked to be in the range of S before the narrowing.
+     * \param dataset_parser DatasetParser& The dataset to parse.
+     * \param label_encoding DatasetParser::LabelEncoding The label encoding.
+     * \param sequence_size  SizeType The sequence size of the return dataset.
+     * \return CompactDataset<S, T> The resulting dataset parsed.
+     */
+    static CompactDataset<S, T> parse(
+        DatasetParser& dataset_parser,
+        DatasetParser::LabelEncoding label_encoding =
+            DatasetParser::LabelEncoding::DEFAULT_ENCODING,
+        SizeType sequence_size = 1)
+    {
+        Storage data;
+        if (!_parse_bytes(dataset_parser, label_encoding, data))
+        {
+            auto values = dataset_parser.data_to_encoding(label_encoding);
+            data.resize(values.size());
+            std::transform(values.begin(), values.end(), data.begin(),
+                           _narrow);
+        }
+        auto feature_size = dataset_parser.encoding_feature_size(
+            label_encoding);
+        auto labels_idx = dataset_parser.encoding_labels_idx(label_encoding);
+        return CompactDataset<S, T>(
+            std::move(data), feature_size, sequence_size,
+            std::move(labels_idx));
+    }
+
+    /**
+     * \brief Getter of feature_size.
+     * \return const SizeType& The feature size.
+     */
+    const SizeType& feature_size() const { return _feature_size; };
+
+    /**
+     * \brief Getter of sequence_size.
+     * \return const SizeType& The sequence size.
+     */
+    const SizeType& sequence_size() const { return _sequence_size; };
+
+    /**
+     * \brief Amount of entries in the dataset.
+     * \return SizeType The amount of entries.
+     */
+    SizeType size() const { return _feature_amount; };
+
+    /**
+     * \brief Check if the dataset is empty.
+     * \return bool True if the dataset is empty.
+     */
+    [[nodiscard]] bool empty() const { return _data.empty(); };
+
+    /**
+     * \brief Getter of the stored values.
+     * \return const Storage& The stored values, without scale and offset.
+     */
+    const Storage& data() const { return _data; };
+
+    /**
+     * \brief Getter of the scale of each feature.
+     * \return const std::vector<T>& The feature scales.
+     */
+    const std::vector<T>& scale() const { return _scale; };
+
+    /**
+     * \brief Getter of the offset of each feature.
+     * \return const std::vector<T>& The feature offsets.
+     */
+    const std::vector<T>& offset() const { return _offset; };
+
+    /**
+     * \brief Set the decoding of a feature: T(stored) * scale + offset.
+     * \param idx    SizeType The feature index.
+     * \param scale  T The scale of the feature.
+     * \param offset T The offset of the feature.
+     * \return CompactDataset<S, T>& The reference to this.
+     */
+    CompactDataset<S, T>& affine(SizeType idx, T scale, T offset)
+    {
+        if (idx >= _feature_size)
+        {
+            throw std::runtime_error("Feature index out of range");
+        }
+        _scale[idx] = scale;
+        _offset[idx] = offset;
+        return *this;
+    }
+
+    /**
+     * \brief Getter of the input feature indexes.
+     * \return std::vector<SizeType> The input feature indexes.
+     */
+    std::vector<SizeType> input_idx() const
+    {
+        return {_input_idx.begin(), _input_idx.end()};
+    }
+
+    /**
+     * \brief Getter of the label feature indexes.
+     * \return std::vector<SizeType> The label feature indexes.
+     */
+    std::vector<SizeType> label_idx() const
+    {
+        return {_labels_idx.begin(), _labels_idx.end()};
+    }
+
+    /**
+     * \brief Setter of the label feature indexes.
+     * \param set std::set<SizeType> The label feature indexes.
+     */
+    void label_idx(std::set<SizeType> set)
+    {
+        _labels_idx = std::move(set);
+        for (auto it = _labels_idx.begin(); it != _labels_idx.end(); )
+        {
+            if (*it >= _feature_size) _labels_idx.erase(it++); else ++it;
+        }
+        _input_idx.clear();
+        for (SizeType idx_val = 0; idx_val < _feature_size; ++idx_val)
+        {
+            if (_labels_idx.find(idx_val) == _labels_idx.end())
+            {
+                _input_idx.insert(idx_val);
+            }
+        }
+    }
+
+    /**
+     * \brief Retrieve the decoded entry of the dataset at row index.
+     * \param row_idx SizeType The row index of the dataset.
+     * \return std::vector<T> The decoded features of the entry.
+     */
+    std::vector<T> entry(SizeType row_idx) const
+    {
+        if (row_idx >= _feature_amount) return {};
+        std::vector<T> ret(_feature_size);
+        _decode_row(row_idx, ret.data());
+        return ret;
+    }
+
+    /**
+     * \brief Retrieve the decoded input features at row index.
+     * \param row_idx SizeType The row index of the dataset.
+     * \return std::vector<T> The decoded input features.
+     */
+    std::vector<T> input(SizeType row_idx) const
+    {
+        if (row_idx >= _feature_amount) return {};
+        return _field_from_row_idx(row_idx, _input_idx);
+    }
+
+    /**
+     * \brief Retrieve the decoded label features at row index.
+     * \param row_idx SizeType The row index of the dataset.
+     * \return std::vector<T> The decoded label features.
+     */
+    std::vector<T> label(SizeType row_idx) const
+    {
+        if (row_idx >= _feature_amount || _labels_idx.empty()) return {};
+        return _field_from_row_idx(row_idx, _labels_idx);
+    }
+
+    /**
+     * \brief Gather the decoded entries from index to index in a Dataset,
+     * e.g. a training batch.
+     * \param from SizeType The index entry from take the batch.
+     * \param to   SizeType The index entry to take the batch.
+     * \return Dataset<T> The decoded batch.
+     */
+    Dataset<T> batch(SizeType from, SizeType to) const
+    {
+        if (to > _feature_amount) to = _feature_amount;
+        if (from > to)
+        {
+            throw std::runtime_error("The argument 'from' exceeds 'to'");
+        }
+
+        std::vector<T> ret((to - from) * _feature_size);
+        for (SizeType row_idx = from; row_idx < to; ++row_idx)
+        {
+            _decode_row(row_idx, ret.data() + (row_idx - from) * _feature_size);
+        }
+        return Dataset<T>(std::move(ret), _feature_size, _sequence_size,
+                          _labels_idx);
+    }
+
+    /**
+     * \brief Gather the decoded entries at the given indexes in a Dataset,
+     * e.g. a shuffled training batch.
+     * \param rows const std::vector<SizeType>& The indexes of the entries.
+     * \return Dataset<T> The decoded batch.
+     */
+    Dataset<T> gather(const std::vector<SizeType>& rows) const
+    {
+        std::vector<T> ret(rows.size() * _feature_size);
+        for (SizeType i = 0; i < rows.size(); ++i)
+        {
+            if (rows[i] >= _feature_amount)
+            {
+                throw std::runtime_error("Entry index out of range");
+            }
+            _decode_row(rows[i], ret.data() + i * _feature_size);
+        }
+        return Dataset<T>(std::move(ret), _feature_size, 1, _labels_idx);
+    }
+
+    /**
+     * \brief Decode the whole dataset.
+     * \return Dataset<T> The decoded dataset.
+     */
+    Dataset<T> to_dataset() const
+    {
+        return batch(0, _feature_amount);
+    }
+
+    /**
+     * \brief Retrieve a subsequence of the dataset from index to index,
+     * with the same scale and offset.
+     * \param from SizeType The index entry from take the subsequence.
+     * \param to   SizeType The index entry to take the subsequence.
+     * \return CompactDataset<S, T> The subsequence dataset.
+     */
+    CompactDataset<S, T> subdata(SizeType from, SizeType to) const
+    {
+        if (to > _feature_amount) to = _feature_amount;
+        if (from > to)
+        {
+            throw std::runtime_error("The argument 'from' exceeds 'to'");
+        }
+
+        CompactDataset<S, T> ret(
+            Storage(_data.begin() + long(from * _feature_size),
+                    _data.begin() + long(to * _feature_size)),
+            _feature_size, _sequence_size, _labels_idx);
+        ret._scale = _scale;
+        ret._offset = _offset;
+        return ret;
+    }
+
+    /**
+     * \brief Shuffle the entries of the dataset.
+     * \param rne RneType Random generator value.
+     * \return CompactDataset<S, T>& The reference to this.
+     */
+    CompactDataset<S, T>& shuffle(
+        RneType rne = RneType(std::random_device{}()))
+    {
+        auto shuffle_indexes = DLMath::unique_rand_sequence(
+            0, _feature_amount, rne);
+        Storage new_data(_data.size());
+
+        for (std::size_t curr_idx = 0; curr_idx < _feature_amount; ++curr_idx)
+        {
+            std::copy_n(_data.begin() + long(curr_idx * _feature_size),
+                        _feature_size,
+                        new_data.begin() + long(
+                            shuffle_indexes[curr_idx] * _feature_size));
+        }
+
+        _data = std::move(new_data);
+        return *this;
+    }
+
+    /**
+     * \brief Min max normalization of the features as metadata: the scale
+     * and the offset of the features are updated so that the values read
+     * are (value - min) / (max - min).
+     * \param min     T The minimum value.
+     * \param max     T The maximum value.
+     * \param idx_vec std::vector<SizeType> The features to normalize, all
+     * the features if empty.
+     * \return CompactDataset<S, T>& The reference to this.
+     */
+    CompactDataset<S, T>& min_max_normalization(
+        T min, T max, std::vector<SizeType> idx_vec = {})
+    {
+        if (min == max) {
+            throw std::runtime_error(
+                "normalization error: min and max cannot be equal");
+        }
+
+        if (idx_vec.empty())
+        {
+            idx_vec = std::vector<SizeType>(_feature_size);
+            std::iota(idx_vec.begin(), idx_vec.end(), 0);
+        }
+
+        for (const auto& col: idx_vec)
+        {
+            _normalize(col, min, max);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Min max normalization of each feature with its own minimum and
+     * maximum value as metadata. The constant features are not changed.
+     * \return CompactDataset<S, T>& The reference to this.
+     */
+    CompactDataset<S, T>& min_max_normalization()
+    {
+        if (_feature_amount == 0) return *this;
+
+        // Min and max of the stored values, then decoded.
+        Storage min_vec(_data.begin(), _data.begin() + long(_feature_size));
+        Storage max_vec(min_vec);
+        for (std::size_t row = 1; row < _feature_amount; ++row)
+        {
+            const auto* row_data = _data.data() + row * _feature_size;
+            for (std::size_t col = 0; col < _feature_size; ++col)
+            {
+                min_vec[col] = std::min(min_vec[col], row_data[col]);
+                max_vec[col] = std::max(max_vec[col], row_data[col]);
+            }
+        }
+
+        for (std::size_t col = 0; col < _feature_size; ++col)
+        {
+            auto lo = _decode(col, min_vec[col]);
+            auto hi = _decode(col, max_vec[col]);
+            if (lo == hi) continue;
+            _normalize(col, std::min(lo, hi), std::max(lo, hi));
+        }
+        return *this;
+    }
+
+private:
+    /**
+     * \brief Decode a stored value of a feature.
+     * \param col   SizeType The feature index.
+     * \param value S The stored value.
+     * \return T The decoded value.
+     */
+    T _decode(SizeType col, S value) const
+    {
+        return static_cast<T>(value) * _scale[col] + _offset[col];
+    }
+
+    /**
+     * \brief Decode the entry at row index.
+     * \param row_idx SizeType The row entry index.
+     * \param dst     T* The destination of the feature_size() values.
+     */
+    void _decode_row(SizeType row_idx, T* dst) const
+    {
+        const auto* src = _data.data() + row_idx * _feature_size;
+        for (SizeType col = 0; col < _feature_size; ++col)
+        {
+            dst[col] = static_cast<T>(src[col]) * _scale[col] + _offset[col];
+        }
+    }
+
+    /**
+     * \brief Retrieve the decoded features of a row at the given indexes.
+     * \param row_idx SizeType The row entry index.
+     * \param set_idx const std::set<SizeType>& The feature indexes.
+     * \return std::vector<T> The decoded features.
+     */
+    std::vector<T> _field_from_row_idx(
+        SizeType row_idx, const std::set<SizeType>& set_idx) const
+    {
+        std::vector<T> dst(set_idx.size());
+        const auto* src = _data.data() + row_idx * _feature_size;
+        SizeType i = 0;
+        for (const auto& idx: set_idx)
+        {
+            dst[i++] = static_cast<T>(src[idx]) * _scale[idx] + _offset[idx];
+        }
+        return dst;
+    }
+
+    /**
+     * \brief Compose the decoding of a feature with (value - min) /
+     * (max - min).
+     * \param col SizeType The feature index.
+     * \param min T The minimum value.
+     * \param max T The maximum value.
+     */
+    void _normalize(SizeType col, T min, T max)
+    {
+        if (col >= _feature_size)
+        {
+            throw std::runtime_error("Feature index out of range");
+        }
+        _scale[col] = _scale[col] / (max - min);
+        _offset[col] = (_offset[col] - min) / (max - min);
+    }
+
+    /**
+     * \brief Narrow a parsed value to the storage type.
+     * \param v NumType The parsed value.
+     * \return S The stored value.
+     */
+    static S _narrow(NumType v)
+    {
+        if constexpr (std::is_floating_point_v<S>)
+        {
+            if (!std::isfinite(v)) return static_cast<S>(v);
+        }
+        const auto lo = static_cast<NumType>(std::numeric_limits<S>::lowest());
+        const auto hi = static_cast<NumType>(std::numeric_limits<S>::max());
+        // The integers truncate: the values in (lo - 1, hi + 1) fit.
+        const bool in_range = std::is_integral_v<S>
+            ? v > lo - 1 && v < hi + 1 : v >= lo && v <= hi;
+        if (!in_range)
+        {
+            throw std::runtime_error(
+                "Parsed value " + std::to_string(v)
+                + " out of the range of the storage type");
+        }
+        return static_cast<S>(v);
+    }
+
+    /**
+     * \brief Fill the storage with the entries of the Mnist and Cifar
+     * parsers, converted from the bytes without a NumType copy.
+     * \param dataset_parser DatasetParser& The dataset to parse.
+     * \param label_encoding DatasetParser::LabelEncoding The label encoding.
+     * \param data           Storage& The storage to fill.
+     * \return bool False if the parser or the encoding need the NumType
+     * entries, and data is left untouched.
+     */
+    static bool _parse_bytes(
+        DatasetParser& dataset_parser,
+        DatasetParser::LabelEncoding label_encoding,
+        Storage& data)
+    {
+        constexpr bool holds_bytes =
+            std::numeric_limits<S>::lowest() <= 0
+            && std::numeric_limits<S>::max() >= 255;
+        if constexpr (holds_bytes)
+        {
+            if (label_encoding
+                != DatasetParser::LabelEncoding::DEFAULT_ENCODING)
+            {
+                return false;
+            }
+            auto fill = [&data](const auto& parser) {
+                data.resize(parser.entries_amount() * parser.feature_size());
+                parser.entries(data.data());
+            };
+            if (auto mnist = dynamic_cast<const Mnist*>(&dataset_parser))
+            {
+                fill(*mnist);
+                return true;
+            }
+            if (auto cifar = dynamic_cast<const Cifar*>(&dataset_parser))
+            {
+                fill(*cifar);
+                return true;
+            }
+        }
+        (void) dataset_parser;
+        (void) label_encoding;
+        (void) data;
+        return false;
+    }
+
+    Storage _data; ///< \brief The stored values.
+
+    SizeType _feature_size;   ///< \brief Size of a single entry.
+    SizeType _sequence_size;  ///< \brief Entries of a sequence.
+    SizeType _feature_amount; ///< \brief Amount of entries.
+
+    std::vector<T> _scale;  ///< \brief Scale of each feature.
+    std::vector<T> _offset; ///< \brief Offset of each feature.
+
+    std::set<SizeType> _labels_idx; ///< \brief Label feature indexes.
+    std::set<SizeType> _input_idx;  ///< \brief Input feature indexes.
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DATA_COMPACT_DATASET_HPP
@@ -378,10 +378,13 @@ public:
      */
     std::vector<T> entry(SizeType row_idx) const
     {
-        if (row_idx >= _feature_amount) return {};
-        return {_data.begin() + long(row_idx * _feature_size),
-                _data.begin() + long(row_idx * _feature_size)
-                    + long(_feature_size)};
+        std::vector<T> ret;
+        if (row_idx < _feature_amount)
+        {
+            auto first = _data.begin() + long(row_idx * _feature_size);
+            ret.assign(first, first + long(_feature_size));
+        }
+        return ret;
     }
 
     /**
@@ -526,6 +529,47 @@ public:
         return _field_from_seq_idx(seq_idx, _labels_idx);
     }
 
+    /**
+     * \brief Replace the label features, as a one hot vector, with a single
+     * label feature holding the class index, i.e. the index of the maximum
+     * label value. The class index label is the last feature of the entry
+     * and it is the target of a class index CategoricalCrossEntropyLossLayer.
+     * \return Dataset<T> The dataset with class index labels.
+     */
+    Dataset<T> to_class_index() const
+    {
+        if (_labels_idx.empty()) return *this;
+
+        const auto class_index_size = _input_idx.size() + 1;
+        auto ret = Vec(std::size_t(class_index_size * _feature_amount));
+        for (std::size_t row_i = 0; row_i < _feature_amount; ++row_i)
+        {
+            const auto* row = _data.data() + row_i * _feature_size;
+            auto* ret_row = ret.data() + row_i * class_index_size;
+            std::size_t input_col_i = 0;
+            for (const auto& col_i: _input_idx)
+            {
+                ret_row[input_col_i++] = row[col_i];
+            }
+
+            std::size_t class_index = 0;
+            std::size_t label_col_i = 0;
+            auto max_label = row[*_labels_idx.begin()];
+            for (const auto& col_i: _labels_idx)
+            {
+                if (row[col_i] > max_label)
+                {
+                    max_label = row[col_i];
+                    class_index = label_col_i;
+                }
+                ++label_col_i;
+            }
+            ret_row[input_col_i] = static_cast<T>(class_index);
+        }
+        return Dataset<T>(ret, class_index_size, _sequence_size,
+                          {_input_idx.size()});
+    }
+
     /**
      * \brief Retrieve a subsequence of the dataset from index to index.
      * \param from SizeType The index entry from take the subsequence.
@@ -681,11 +725,17 @@ public:
         DatasetParser::LabelEncoding label_encoding = DatasetParser::LabelEncoding::DEFAULT_ENCODING,
         SizeType sequence_size = 1)
     {
+        // The data encoding reads the parser once and caches the label maps
+        // used by the feature size and the label indexes requests.
+        auto data = dataset_parser.data_to_encoding(label_encoding);
+        auto feature_size = dataset_parser.encoding_feature_size(
+            label_encoding);
+        auto labels_idx = dataset_parser.encoding_labels_idx(label_encoding);
         return Dataset<T>(
-                dataset_parser.data_to_encoding(label_encoding),
-                dataset_parser.encoding_feature_size(label_encoding),
+                std::move(data),
+                feature_size,
                 sequence_size,
-                dataset_parser.encoding_labels_idx(label_encoding)
+                std::move(labels_idx)
             );
     }
 
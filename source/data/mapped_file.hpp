@@ -0,0 +1,173 @@
+/***************************************************************************
+ *            data/mapped_file.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  data/mapped_file.hpp
+ *  \brief Memory mapping of a whole file.
+ */
+
+#ifndef EDGE_LEARNING_DATA_MAPPED_FILE_HPP
+#define EDGE_LEARNING_DATA_MAPPED_FILE_HPP
+
+#include "path.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#    define EDGE_LEARNING_DATA_MAPPED_FILE_MMAP 0
+#else
+#    define EDGE_LEARNING_DATA_MAPPED_FILE_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief A whole file mapped in memory: the pages are loaded by the kernel
+ * when they are first read and they are shared with the page cache, so
+ * opening a big file costs neither a read nor a copy.
+ *
+ * With the COPY_ON_WRITE mode the mapped bytes can be modified in memory:
+ * the modified pages become private copies and the file is never written.
+ * Where memory mapping is not available the file is read in a buffer.
+ */
+class MappedFile
+{
+public:
+    enum class Mode
+    {
+        READ_ONLY,     ///< \brief The mapped bytes can only be read.
+        COPY_ON_WRITE  ///< \brief The writes are private to the mapping.
+    };
+
+    /**
+     * \brief Map a whole file.
+     * \param path std::filesystem::path The file to map.
+     * \param mode Mode The protection of the mapping.
+     */
+    explicit MappedFile(const std::filesystem::path& path,
+                        Mode mode = Mode::READ_ONLY)
+        : _data{nullptr}
+        , _size{0}
+        , _buffer{}
+    {
+#if EDGE_LEARNING_DATA_MAPPED_FILE_MMAP
+        int fd = ::open(path.string().c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("MappedFile error: cannot open "
+                                     + path.string());
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("MappedFile error: cannot stat "
+                                     + path.string());
+        }
+        _size = static_cast<std::size_t>(st.st_size);
+        if (_size > 0)
+        {
+            auto prot = mode == Mode::COPY_ON_WRITE
+                ? PROT_READ | PROT_WRITE : PROT_READ;
+            void* addr = ::mmap(nullptr, _size, prot, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("MappedFile error: cannot map "
+                                         + path.string());
+            }
+            _data = static_cast<std::uint8_t*>(addr);
+        }
+        ::close(fd);
+#else
+        (void) mode;
+        std::ifstream ifs{path, std::ios::binary | std::ios::ate};
+        if (!ifs)
+        {
+            throw std::runtime_error("MappedFile error: cannot open "
+                                     + path.string());
+        }
+        _size = static_cast<std::size_t>(ifs.tellg());
+        // 64-bit words keep the buffer aligned for any numeric type.
+        _buffer.resize((_size + sizeof(std::uint64_t) - 1)
+                       / sizeof(std::uint64_t));
+        ifs.seekg(0);
+        ifs.read(reinterpret_cast<char*>(_buffer.data()),
+                 static_cast<std::streamsize>(_size));
+        _data = reinterpret_cast<std::uint8_t*>(_buffer.data());
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+#if EDGE_LEARNING_DATA_MAPPED_FILE_MMAP
+        if (_data) ::munmap(_data, _size);
+#endif
+    }
+
+    /**
+     * \brief Getter of the mapped bytes.
+     * \return std::uint8_t* The first byte of the file, aligned to a page.
+     */
+    [[nodiscard]] std::uint8_t* data() const { return _data; }
+
+    /**
+     * \brief Getter of the file size.
+     * \return std::size_t The amount of mapped bytes.
+     */
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+    /**
+     * \brief Advise the kernel that the file is read sequentially, so that
+     * the pages are read ahead.
+     */
+    void sequential() const
+    {
+#if EDGE_LEARNING_DATA_MAPPED_FILE_MMAP
+        if (_data) ::madvise(_data, _size, MADV_SEQUENTIAL);
+#endif
+    }
+
+private:
+    std::uint8_t* _data; ///< \brief First mapped byte.
+    std::size_t _size;   ///< \brief Amount of mapped bytes.
+    /// \brief File content when the memory mapping is not available.
+    std::vector<std::uint64_t> _buffer;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DATA_MAPPED_FILE_HPP
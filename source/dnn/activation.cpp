@@ -73,6 +73,7 @@ const std::vector<NumType>& ReluLayer::forward(
 const std::vector<NumType>& ReluLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     /*
      * Calculate dg(z)/dz and put in _activation_gradients.
@@ -112,6 +113,7 @@ const std::vector<NumType>& EluLayer::forward(
 const std::vector<NumType>& EluLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     /*
      * Calculate dg(z)/dz and put in _activation_gradients.
@@ -130,6 +132,24 @@ const std::vector<NumType>& EluLayer::backward(
                     gradients.data(), size);
     return ActivationLayer::backward(_input_gradients);
 }
+
+Json EluLayer::dump() const
+{
+    Json out = ActivationLayer::dump();
+
+    Json others;
+    others["alpha"] = _alpha;
+    out[dump_fields.at(DumpFields::OTHERS)] = others;
+    return out;
+}
+
+void EluLayer::load(const Json& in)
+{
+    ActivationLayer::load(in);
+
+    _alpha = in.at(dump_fields.at(DumpFields::OTHERS))
+        .at("alpha").as<NumType>();
+}
 // =============================================================================
 
 // ================================ Softmax ====================================
@@ -151,6 +171,7 @@ const std::vector<NumType>& SoftmaxLayer::forward(
 const std::vector<NumType>& SoftmaxLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     /*
      * Calculate dJ/dz.
@@ -184,6 +205,7 @@ const std::vector<NumType>& TanhLayer::forward(
 const std::vector<NumType>& TanhLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     // Calculate dg(z)/dz and put in _activation_gradients.
     DLMath::tanh_1_opt<NumType>(_input_gradients.data(),
@@ -215,6 +237,7 @@ const std::vector<NumType>& SigmoidLayer::forward(
 const std::vector<NumType>& SigmoidLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     // Calculate dg(z)/dz and put in _activation_gradients.
     DLMath::sigmoid_1_opt<NumType>(_input_gradients.data(),
@@ -244,6 +267,7 @@ const std::vector<NumType>& LinearLayer::forward(
 const std::vector<NumType>& LinearLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType size = _input_gradients.size();
     // Linear activation: dg(z)/dz = 1.
     std::copy(
@@ -139,10 +139,23 @@ public:
     { return TYPE; }
     [[nodiscard]] SharedPtr clone() const override
     { return std::make_shared<EluLayer>(*this); }
+    [[nodiscard]] NumType alpha() const { return _alpha; }
     const std::vector<NumType>& forward(
         const std::vector<NumType>& inputs) override;
     const std::vector<NumType>& backward(
         const std::vector<NumType>& gradients) override;
+
+    /**
+     * \brief Save the layer infos to disk.
+     * \return Json Layer dump.
+     */
+    Json dump() const override;
+
+    /**
+     * \brief Load the layer infos from disk.
+     * \param in const Json& Json to read.
+     */
+    void load(const Json& in) override;
 private:
     NumType _alpha;
 };
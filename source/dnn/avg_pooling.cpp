@@ -51,6 +51,7 @@ const std::vector<NumType>& AveragePoolingLayer::forward(
 const std::vector<NumType>& AveragePoolingLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     std::fill(_input_gradients.begin(), _input_gradients.end(), 0);
     auto gradients_op = [&](
         NumType* dst, DLMath::Shape2d dst_shape, DLMath::Coord2d dst_coord,
@@ -26,6 +26,7 @@
 
 #include "dlmath.hpp"
 
+#include <cmath>
 #include <tuple>
 #include <cstdio>
 #include <stdexcept>
@@ -57,14 +58,23 @@ const std::vector<NumType>& CategoricalCrossEntropyLossLayer::forward(
     {
         throw std::runtime_error("_target is empty, set_target not called");
     }
-    _loss = DLMath::cross_entropy(_target.data(), inputs.data(), in_size);
-    _cumulative_loss += _loss;
-    
+    if (_is_class_index())
+    {
+        _active = _class_index();
+        _loss = DLMath::sparse_cross_entropy(_active, inputs.data());
+        _cumulative_loss += _loss;
+    }
+    else
+    {
+        _loss = DLMath::cross_entropy(_target.data(), inputs.data(), in_size);
+        _cumulative_loss += _loss;
+        _active = _argactive();
+    }
+
     auto max = DLMath::max_and_argmax(inputs.data(), in_size);
     // NumType max_value = std::get<0>(max);
     SizeType max_index = std::get<1>(max);
 
-    _active = _argactive();
     if (max_index == _active)
     {
         ++_correct;
@@ -84,8 +94,16 @@ const std::vector<NumType>& CategoricalCrossEntropyLossLayer::backward(
     // Parameter ignored because it is a loss layer.
     (void) gradients;
 
-    DLMath::cross_entropy_1(_gradients.data(), _target.data(), _last_input,
-        _inv_batch_size, _gradients.size());
+    if (_is_class_index())
+    {
+        DLMath::sparse_cross_entropy_1(_gradients.data(), _active,
+            _last_input, _inv_batch_size, _gradients.size());
+    }
+    else
+    {
+        DLMath::cross_entropy_1(_gradients.data(), _target.data(),
+            _last_input, _inv_batch_size, _gradients.size());
+    }
 
     return LossLayer::backward(_gradients);
 }
@@ -103,4 +121,16 @@ SizeType CategoricalCrossEntropyLossLayer::_argactive() const
     throw std::runtime_error("_target is an array of 0.0 values");
 }
 
+SizeType CategoricalCrossEntropyLossLayer::_class_index() const
+{
+    auto class_index = _target[0];
+    if (class_index < NumType{0.0}
+        || class_index != std::floor(class_index)
+        || class_index >= static_cast<NumType>(_shared_fields->input_size()))
+    {
+        throw std::runtime_error("_target is not a valid class index");
+    }
+    return static_cast<SizeType>(class_index);
+}
+
 } // namespace EdgeLearning
\ No newline at end of file
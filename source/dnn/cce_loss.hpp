@@ -36,6 +36,14 @@
 
 namespace EdgeLearning {
 
+/**
+ * \brief Categorical Cross-Entropy loss layer.
+ * The target is either the dense one hot vector of the classes or, when the
+ * input size is greater than 1, a single value with the class index (see
+ * DatasetParser::LabelEncoding::CLASS_INDEX_ENCODING). With a class index
+ * target the loss and the accuracy cost O(1) per sample instead of
+ * O(classes).
+ */
 class CategoricalCrossEntropyLossLayer : public LossLayer {
 public:
     static const std::string TYPE;
@@ -69,12 +77,28 @@ public:
     }
 
 private:
+    /**
+     * \brief Check if the target is a class index instead of a one hot
+     * vector.
+     * \return bool True if the target is a class index.
+     */
+    [[nodiscard]] bool _is_class_index() const
+    {
+        return _target.size() == 1 && _shared_fields->input_size() > 1;
+    }
+
     /**
      * \brief Find the argument of _target array that is active.
      * \return SizeType
      */
     SizeType _argactive() const;
 
+    /**
+     * \brief Validate and return the class index of the _target.
+     * \return SizeType
+     */
+    SizeType _class_index() const;
+
     /// \brief Last active classification in the target one-hot encoding.
     SizeType _active; 
 };
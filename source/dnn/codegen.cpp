@@ -0,0 +1,708 @@
+/***************************************************************************
+ *            dnn/codegen.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "codegen.hpp"
+
+#include "dense.hpp"
+#include "activation.hpp"
+#include "dropout.hpp"
+#include "concatenate.hpp"
+#include "loss.hpp"
+#include "cce_loss.hpp"
+#include "mse_loss.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace EdgeLearning {
+
+CodeGenerator::CodeGenerator(const Model& model)
+    : _name{model.name()}
+    , _num_type{NUM_TYPE_NAME}
+    , _layers{}
+{
+    const auto& graph = model._state.graph;
+    std::vector<LayerCode> layers;
+    for (SizeType idx = 0; idx < graph.size(); ++idx)
+    {
+        auto layer = graph.layers()[idx];
+
+        LayerCode lc;
+        lc.type = layer->type();
+        lc.name = layer->name();
+        lc.input_size = layer->input_size();
+        lc.output_size = layer->output_size();
+        lc.alpha = NumType(1.0);
+        lc.axis = 0;
+        for (auto pred: graph.forward_predecessors(idx))
+        {
+            lc.inputs.push_back(pred);
+        }
+        if (layer->is_type<DenseLayer>())
+        {
+            auto weights_size = lc.input_size * lc.output_size;
+            lc.weights.resize(weights_size);
+            lc.biases.resize(lc.output_size);
+            for (SizeType i = 0; i < weights_size; ++i)
+            {
+                lc.weights[i] = layer->param(i);
+            }
+            for (SizeType i = 0; i < lc.output_size; ++i)
+            {
+                lc.biases[i] = layer->param(weights_size + i);
+            }
+        }
+        else if (layer->is_type<EluLayer>())
+        {
+            lc.alpha = std::dynamic_pointer_cast<EluLayer>(layer)->alpha();
+        }
+        else if (layer->is_type<ConcatenateLayer>())
+        {
+            lc.input_shapes = layer->input_shapes();
+            lc.axis =
+                std::dynamic_pointer_cast<ConcatenateLayer>(layer)->axis();
+        }
+        layers.push_back(std::move(lc));
+    }
+    _build(std::move(layers));
+}
+
+CodeGenerator::CodeGenerator(const Json& model_dump)
+    : _name{model_dump.at("name").as<std::string>()}
+    , _num_type{model_dump.at("num_type").as<std::string>()}
+    , _layers{}
+{
+    if (_num_type != "float" && _num_type != "double"
+        && _num_type != "long double")
+    {
+        throw std::runtime_error(
+            "code generation error: num_type " + _num_type
+            + " not supported");
+    }
+
+    const auto& type_key = Layer::dump_fields.at(Layer::DumpFields::TYPE);
+    const auto& name_key = Layer::dump_fields.at(Layer::DumpFields::NAME);
+    const auto& input_key =
+        Layer::dump_fields.at(Layer::DumpFields::INPUT_SIZE);
+    const auto& output_key =
+        Layer::dump_fields.at(Layer::DumpFields::OUTPUT_SIZE);
+    const auto& weights_key =
+        Layer::dump_fields.at(Layer::DumpFields::WEIGHTS);
+    const auto& biases_key =
+        Layer::dump_fields.at(Layer::DumpFields::BIASES);
+    const auto& others_key =
+        Layer::dump_fields.at(Layer::DumpFields::OTHERS);
+
+    auto to_shape = [](const Json& shape) {
+        return DLMath::Shape3d(shape.at(0).as<SizeType>(),
+                               shape.at(1).as<SizeType>(),
+                               shape.at(2).as<SizeType>());
+    };
+
+    std::vector<LayerCode> layers;
+    const auto& layers_json = model_dump.at("layers");
+    for (SizeType l = 0; l < layers_json.size(); ++l)
+    {
+        const auto& layer_json = layers_json.at(l);
+
+        LayerCode lc;
+        lc.type = layer_json.at(type_key).as<std::string>();
+        lc.name = layer_json.at(name_key).as<std::string>();
+        lc.alpha = NumType(1.0);
+        lc.axis = 0;
+        const auto& input_shapes_json = layer_json.at(input_key);
+        lc.input_size = 0;
+        for (SizeType i = 0; i < input_shapes_json.size(); ++i)
+        {
+            lc.input_shapes.push_back(to_shape(input_shapes_json.at(i)));
+            lc.input_size += lc.input_shapes.back().size();
+        }
+        lc.output_size = to_shape(layer_json.at(output_key).at(0)).size();
+        if (lc.type == DenseLayer::TYPE)
+        {
+            const auto& weights_json = layer_json.at(weights_key);
+            const auto& biases_json = layer_json.at(biases_key);
+            lc.weights.resize(lc.input_size * lc.output_size);
+            lc.biases.resize(lc.output_size);
+            for (SizeType i = 0; i < lc.output_size; ++i)
+            {
+                weights_json.at(i).as_vec(
+                    lc.weights.data() + i * lc.input_size, lc.input_size);
+            }
+            biases_json.as_vec(lc.biases.data(), lc.output_size);
+        }
+        else if (lc.type == EluLayer::TYPE)
+        {
+            lc.alpha = layer_json.at(others_key).at("alpha").as<NumType>();
+        }
+        else if (lc.type == ConcatenateLayer::TYPE)
+        {
+            lc.axis = layer_json.at(others_key).at("axis").as<SizeType>();
+        }
+        layers.push_back(std::move(lc));
+    }
+
+    // The inputs of a layer follow the order of its producers.
+    const auto& arcs_json = model_dump.at("arcs");
+    for (SizeType i = 0; i < arcs_json.size(); ++i)
+    {
+        auto from = arcs_json.at(i).at(0).as<SizeType>();
+        auto to = arcs_json.at(i).at(1).as<SizeType>();
+        if (from >= layers.size() || to >= layers.size())
+        {
+            throw std::runtime_error(
+                "code generation error: arc out of the layers range");
+        }
+        layers[to].inputs.push_back(from);
+    }
+    for (auto& lc: layers)
+    {
+        std::sort(lc.inputs.begin(), lc.inputs.end());
+    }
+    _build(std::move(layers));
+}
+
+void CodeGenerator::generate(std::ostream& out,
+                             const std::string& namespace_name) const
+{
+    const auto npos = std::numeric_limits<SizeType>::max();
+
+    // Identity layers alias the array of their producer: owner is the
+    // layer that writes the array, npos for the model input.
+    std::vector<SizeType> owner(_layers.size(), npos);
+    std::vector<SizeType> last_use(_layers.size(), 0);
+    for (SizeType i = 0; i < _layers.size(); ++i)
+    {
+        const auto& l = _layers[i];
+        if (!_is_identity(l.type))
+        {
+            owner[i] = i;
+        }
+        else if (!l.inputs.empty())
+        {
+            owner[i] = owner[l.inputs.front()];
+        }
+        for (auto in: l.inputs)
+        {
+            if (owner[in] != npos) last_use[owner[in]] = i;
+        }
+    }
+
+    // The array that ends in the output layer is written in output.
+    std::vector<std::string> array(_layers.size(), "input");
+    auto output_owner = owner.back();
+    if (output_owner != npos) array[output_owner] = "output";
+
+    // Plan the straight-line body: the stack buffers are reused as soon as
+    // the last consumer of their content has run.
+    std::set<std::string> kernels;
+    std::vector<std::string> body;
+    std::vector<SizeType> buffer_size;
+    std::vector<bool> buffer_free;
+    std::vector<SizeType> buffer_of(_layers.size(), npos);
+    for (SizeType i = 0; i < _layers.size(); ++i)
+    {
+        const auto& l = _layers[i];
+        if (_is_identity(l.type))
+        {
+            if (owner[i] != npos) array[i] = array[owner[i]];
+            continue;
+        }
+
+        if (i != output_owner)
+        {
+            SizeType b = 0;
+            while (b < buffer_free.size() && !buffer_free[b]) ++b;
+            if (b == buffer_free.size())
+            {
+                buffer_free.push_back(false);
+                buffer_size.push_back(0);
+            }
+            buffer_free[b] = false;
+            buffer_size[b] = std::max(buffer_size[b], l.output_size);
+            buffer_of[i] = b;
+            array[i] = "buffer" + std::to_string(b);
+        }
+        const auto& dst = array[i];
+        const auto& src = l.inputs.empty()
+            ? std::string("input") : array[l.inputs.front()];
+
+        std::ostringstream call;
+        call.precision(std::numeric_limits<NumType>::max_digits10);
+        auto id = "layer" + std::to_string(i);
+        if (l.type == DenseLayer::TYPE)
+        {
+            kernels.insert("dense");
+            call << "dense(" << dst << ", " << src << ", "
+                 << id << "_weights, " << id << "_biases, "
+                 << l.input_size << ", " << l.output_size << ");";
+        }
+        else if (l.type == ReluLayer::TYPE)
+        {
+            kernels.insert("relu");
+            call << "relu(" << dst << ", " << src << ", "
+                 << l.output_size << ");";
+        }
+        else if (l.type == EluLayer::TYPE)
+        {
+            kernels.insert("elu");
+            call << "elu(" << dst << ", " << src << ", "
+                 << l.output_size << ", " << l.alpha << ");";
+        }
+        else if (l.type == SoftmaxLayer::TYPE)
+        {
+            kernels.insert("softmax");
+            call << "stable_softmax(" << dst << ", " << src << ", "
+                 << l.output_size << ");";
+        }
+        else if (l.type == TanhLayer::TYPE)
+        {
+            kernels.insert("tanh");
+            call << "tanh(" << dst << ", " << src << ", "
+                 << l.output_size << ");";
+        }
+        else if (l.type == SigmoidLayer::TYPE)
+        {
+            kernels.insert("sigmoid");
+            call << "sigmoid(" << dst << ", " << src << ", "
+                 << l.output_size << ");";
+        }
+        else if (l.type == ConcatenateLayer::TYPE)
+        {
+            // Same slices of ConcatenateLayer.
+            kernels.insert("concatenate");
+            auto axis_size = SizeType{0};
+            for (const auto& shape: l.input_shapes)
+            {
+                axis_size += shape.at(l.axis);
+            }
+            SizeType inner = 1;
+            SizeType outer = 1;
+            for (SizeType d = 0; d < DLMath::Shape3d::SIZE; ++d)
+            {
+                if (d < l.axis) outer *= l.input_shapes.front().at(d);
+                if (d > l.axis) inner *= l.input_shapes.front().at(d);
+            }
+            SizeType axis_offset = 0;
+            for (SizeType k = 0; k < l.inputs.size(); ++k)
+            {
+                const auto& shape = l.input_shapes[k];
+                call << (k == 0 ? "" : "\n    ")
+                     << "concatenate_slice(" << dst << ", "
+                     << array[l.inputs[k]] << ", "
+                     << axis_offset * inner << ", "
+                     << shape.at(l.axis) * inner << ", "
+                     << axis_size * inner << ", " << outer << ");";
+                axis_offset += shape.at(l.axis);
+            }
+        }
+        body.push_back("    // " + l.name + " (" + l.type + ").");
+        body.push_back("    " + call.str());
+
+        // Release the buffers of the arrays that are no more read.
+        for (SizeType j = 0; j < i; ++j)
+        {
+            if (buffer_of[j] != npos && last_use[j] == i)
+            {
+                buffer_free[buffer_of[j]] = true;
+            }
+        }
+    }
+    if (output_owner == npos)
+    {
+        body.push_back("    // Identity model.");
+        body.push_back("    for (std::size_t i = 0; i < OUTPUT_SIZE; ++i) "
+                       "output[i] = input[i];");
+    }
+
+    auto ns = namespace_name.empty() ? _identifier(_name) : namespace_name;
+    out << "// Generated by EdgeLearning from model \"" << _name << "\".\n"
+        << "// Self-contained inference code: no heap allocation.\n"
+        << "//\n";
+    for (SizeType i = 0; i < _layers.size(); ++i)
+    {
+        out << "// layer" << i << ": " << _layers[i].name
+            << " (" << _layers[i].type << " " << _layers[i].input_size
+            << " -> " << _layers[i].output_size << ")\n";
+    }
+    out << "\n"
+        << "#include <cmath>\n"
+        << "#include <cstddef>\n"
+        << "\n"
+        << "namespace " << ns << " {\n"
+        << "\n"
+        << "using NumType = " << _num_type << ";\n"
+        << "\n"
+        << "constexpr std::size_t INPUT_SIZE = " << input_size() << ";\n"
+        << "constexpr std::size_t OUTPUT_SIZE = " << output_size() << ";\n"
+        << "\n"
+        << "namespace {\n";
+
+    // Parameters.
+    auto write_array = [&out](const std::string& name,
+                              const std::vector<NumType>& values) {
+        out << "\nconstexpr NumType " << name << "[" << values.size()
+            << "] = {";
+        auto flags = out.flags();
+        auto precision = out.precision(
+            std::numeric_limits<NumType>::max_digits10);
+        for (SizeType i = 0; i < values.size(); ++i)
+        {
+            out << (i % 4 == 0 ? "\n    " : " ") << values[i] << ",";
+        }
+        out.precision(precision);
+        out.flags(flags);
+        out << "\n};\n";
+    };
+    for (SizeType i = 0; i < _layers.size(); ++i)
+    {
+        if (_layers[i].type != DenseLayer::TYPE) continue;
+        auto id = "layer" + std::to_string(i);
+        write_array(id + "_weights", _layers[i].weights);
+        write_array(id + "_biases", _layers[i].biases);
+    }
+
+    // Kernels, same operations and order of DLMath.
+    if (kernels.count("dense"))
+    {
+        out << "\n"
+            << "void dense(NumType* dst, const NumType* src, "
+               "const NumType* weights,\n"
+            << "           const NumType* bias, "
+               "std::size_t input_size, std::size_t output_size)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < output_size; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = bias[i];\n"
+            << "        for (std::size_t j = 0; j < input_size; ++j)\n"
+            << "        {\n"
+            << "            dst[i] += weights[(i * input_size) + j] "
+               "* src[j];\n"
+            << "        }\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("relu"))
+    {
+        out << "\n"
+            << "void relu(NumType* dst, const NumType* src, "
+               "std::size_t length)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = src[i] < NumType{0} ? NumType{0} : src[i];\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("elu"))
+    {
+        out << "\n"
+            << "void elu(NumType* dst, const NumType* src, "
+               "std::size_t length, NumType alpha)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = src[i] > 0 ? src[i] "
+               ": alpha * (std::exp(src[i]) - 1);\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("tanh"))
+    {
+        out << "\n"
+            << "void tanh(NumType* dst, const NumType* src, "
+               "std::size_t length)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = std::tanh(src[i]);\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("sigmoid"))
+    {
+        out << "\n"
+            << "void sigmoid(NumType* dst, const NumType* src, "
+               "std::size_t length)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = 1 / (1 + std::exp(-src[i]));\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("softmax"))
+    {
+        out << "\n"
+            << "void stable_softmax(NumType* dst, const NumType* src, "
+               "std::size_t length)\n"
+            << "{\n"
+            << "    NumType d = src[0];\n"
+            << "    for (std::size_t i = 1; i < length; ++i)\n"
+            << "    {\n"
+            << "        if (d < src[i]) d = src[i];\n"
+            << "    }\n"
+            << "    NumType sum_exp_z{0};\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] = std::exp(src[i] - d);\n"
+            << "        sum_exp_z += dst[i];\n"
+            << "    }\n"
+            << "    NumType inv_sum_exp_z = NumType{1} / sum_exp_z;\n"
+            << "    for (std::size_t i = 0; i < length; ++i)\n"
+            << "    {\n"
+            << "        dst[i] *= inv_sum_exp_z;\n"
+            << "    }\n"
+            << "}\n";
+    }
+    if (kernels.count("concatenate"))
+    {
+        out << "\n"
+            << "void concatenate_slice(NumType* dst, const NumType* src, "
+               "std::size_t offset,\n"
+            << "                       std::size_t block, "
+               "std::size_t stride, std::size_t count)\n"
+            << "{\n"
+            << "    for (std::size_t i = 0; i < count; ++i)\n"
+            << "    {\n"
+            << "        for (std::size_t j = 0; j < block; ++j)\n"
+            << "        {\n"
+            << "            dst[offset + (i * stride) + j] = "
+               "src[(i * block) + j];\n"
+            << "        }\n"
+            << "    }\n"
+            << "}\n";
+    }
+    out << "\n"
+        << "} // namespace\n"
+        << "\n"
+        << "/**\n"
+        << " * \\brief Model inference.\n"
+        << " * \\param input  Array of INPUT_SIZE elements.\n"
+        << " * \\param output Array of OUTPUT_SIZE elements.\n"
+        << " */\n"
+        << "void predict(const NumType* input, NumType* output)\n"
+        << "{\n";
+    for (SizeType b = 0; b < buffer_size.size(); ++b)
+    {
+        out << "    NumType buffer" << b << "[" << buffer_size[b] << "];\n";
+    }
+    for (const auto& line: body)
+    {
+        out << line << "\n";
+    }
+    out << "}\n"
+        << "\n"
+        << "} // namespace " << ns << "\n";
+}
+
+std::string CodeGenerator::generate(const std::string& namespace_name) const
+{
+    std::ostringstream oss;
+    generate(oss, namespace_name);
+    return oss.str();
+}
+
+SizeType CodeGenerator::input_size() const
+{
+    return _layers.front().input_size;
+}
+
+SizeType CodeGenerator::output_size() const
+{
+    return _layers.back().output_size;
+}
+
+void CodeGenerator::_build(std::vector<LayerCode> layers)
+{
+    const auto npos = std::numeric_limits<SizeType>::max();
+
+    // Drop the loss layers.
+    std::vector<SizeType> kept_idx(layers.size(), npos);
+    std::vector<LayerCode> kept;
+    for (SizeType i = 0; i < layers.size(); ++i)
+    {
+        if (_is_loss(layers[i].type)) continue;
+        kept_idx[i] = kept.size();
+        kept.push_back(std::move(layers[i]));
+    }
+    if (kept.empty())
+    {
+        throw std::runtime_error("code generation error: no layers in model");
+    }
+
+    std::vector<std::vector<SizeType>> consumers(kept.size());
+    std::vector<SizeType> pending(kept.size(), 0);
+    for (SizeType i = 0; i < kept.size(); ++i)
+    {
+        auto& l = kept[i];
+        if (l.type != DenseLayer::TYPE
+            && l.type != ReluLayer::TYPE
+            && l.type != EluLayer::TYPE
+            && l.type != SoftmaxLayer::TYPE
+            && l.type != TanhLayer::TYPE
+            && l.type != SigmoidLayer::TYPE
+            && l.type != ConcatenateLayer::TYPE
+            && !_is_identity(l.type))
+        {
+            throw std::runtime_error(
+                "code generation error: layer type " + l.type
+                + " not supported");
+        }
+        for (auto& in: l.inputs)
+        {
+            if (kept_idx[in] == npos)
+            {
+                throw std::runtime_error(
+                    "code generation error: layer " + l.name
+                    + " reads a loss layer");
+            }
+            in = kept_idx[in];
+            consumers[in].push_back(i);
+            ++pending[i];
+        }
+    }
+
+    // Topological sort, the smallest layer index first.
+    std::set<SizeType> ready;
+    for (SizeType i = 0; i < kept.size(); ++i)
+    {
+        if (pending[i] == 0) ready.insert(i);
+    }
+    std::vector<SizeType> order;
+    std::vector<SizeType> position(kept.size(), npos);
+    while (!ready.empty())
+    {
+        auto i = *ready.begin();
+        ready.erase(ready.begin());
+        position[i] = order.size();
+        order.push_back(i);
+        for (auto c: consumers[i])
+        {
+            if (--pending[c] == 0) ready.insert(c);
+        }
+    }
+    if (order.size() != kept.size())
+    {
+        throw std::runtime_error(
+            "code generation error: the model graph has a cycle");
+    }
+
+    // With a single sink every layer reaches it: the sink is the last one.
+    auto sinks = std::count_if(
+        consumers.begin(), consumers.end(),
+        [](const std::vector<SizeType>& c) { return c.empty(); });
+    if (sinks != 1)
+    {
+        throw std::runtime_error(
+            "code generation error: the model must have one output layer");
+    }
+
+    // All the input layers read the model input.
+    auto input_size = kept[order.front()].input_size;
+    for (const auto& l: kept)
+    {
+        if (l.inputs.empty() && l.input_size != input_size)
+        {
+            throw std::runtime_error(
+                "code generation error: input layer " + l.name
+                + " input size does not match the model input size");
+        }
+        if (l.inputs.size() > 1 && l.type != ConcatenateLayer::TYPE)
+        {
+            throw std::runtime_error(
+                "code generation error: layer " + l.name
+                + " has multiple inputs");
+        }
+        if (l.type == ConcatenateLayer::TYPE)
+        {
+            if (l.input_shapes.size() != l.inputs.size())
+            {
+                throw std::runtime_error(
+                    "code generation error: layer " + l.name
+                    + " inputs do not match its input shapes");
+            }
+            for (SizeType k = 0; k < l.inputs.size(); ++k)
+            {
+                if (l.input_shapes[k].size() != kept[l.inputs[k]].output_size)
+                {
+                    throw std::runtime_error(
+                        "code generation error: layer " + l.name
+                        + " input shape does not match its producer");
+                }
+            }
+        }
+        else if (!l.inputs.empty()
+            && kept[l.inputs.front()].output_size != l.input_size)
+        {
+            throw std::runtime_error(
+                "code generation error: layer " + l.name
+                + " input size does not match the previous output size");
+        }
+    }
+
+    _layers.clear();
+    for (auto i: order)
+    {
+        _layers.push_back(std::move(kept[i]));
+        for (auto& in: _layers.back().inputs)
+        {
+            in = position[in];
+        }
+    }
+}
+
+bool CodeGenerator::_is_identity(const std::string& type)
+{
+    return type == LinearLayer::TYPE || type == DropoutLayer::TYPE;
+}
+
+bool CodeGenerator::_is_loss(const std::string& type)
+{
+    return type == LossLayer::TYPE
+        || type == CategoricalCrossEntropyLossLayer::TYPE
+        || type == MeanSquaredLossLayer::TYPE;
+}
+
+std::string CodeGenerator::_identifier(const std::string& s)
+{
+    std::string ret;
+    for (auto c: s)
+    {
+        ret += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+    }
+    if (ret.empty() || std::isdigit(static_cast<unsigned char>(ret.front())))
+    {
+        ret = "model_" + ret;
+    }
+    return ret;
+}
+
+} // namespace EdgeLearning
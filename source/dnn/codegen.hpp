@@ -0,0 +1,165 @@
+/***************************************************************************
+ *            dnn/codegen.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/codegen.hpp
+ *  \brief Standalone C++ source generator for trained models.
+ */
+
+#ifndef EDGE_LEARNING_DNN_CODEGEN_HPP
+#define EDGE_LEARNING_DNN_CODEGEN_HPP
+
+#include "model.hpp"
+#include "type.hpp"
+#include "parser/json.hpp"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Generator of a self-contained C++ source file that performs the
+ * inference of a trained model without depending on the library.
+ *
+ * The generated source contains the model parameters as constexpr arrays and
+ * a straight-line `predict(const NumType* input, NumType* output)` function
+ * that applies the same kernels of DLMath layer by layer, in topological
+ * order of the model graph. The layer outputs live in stack buffers that are
+ * reused as soon as their last consumer has run, so a chain of layers needs
+ * only two buffers, and there is no heap allocation.
+ *
+ * The supported layers are Dense, activation (Relu, Elu, Softmax, Tanh,
+ * Sigmoid, Linear), Dropout and Concatenate. All the input layers read the
+ * model input, like Model::predict, and the model must have a single output
+ * layer. Loss layers are ignored.
+ */
+class CodeGenerator
+{
+public:
+    /**
+     * \brief Construct the generator from a model. The parameters are read
+     * directly from the layers, so the generated code is bit-exact with
+     * Model::predict.
+     * \param model const Model& The model to generate.
+     */
+    CodeGenerator(const Model& model);
+
+    /**
+     * \brief Construct the generator from the Json produced by Model::dump.
+     * The layers are connected by the dumped arcs, NumType is the dumped
+     * num_type and the parameters keep the precision of the Json leaves.
+     * \param model_dump const Json& The model dump.
+     */
+    CodeGenerator(const Json& model_dump);
+
+    /**
+     * \brief Write the generated source file in the output stream.
+     * \param out       std::ostream& The output stream.
+     * \param namespace_name const std::string& The namespace that encloses
+     *                  the generated code. If empty, the sanitized model
+     *                  name is used.
+     */
+    void generate(std::ostream& out,
+                  const std::string& namespace_name = std::string()) const;
+
+    /**
+     * \brief Return the generated source file as a string.
+     * \param namespace_name const std::string& The namespace that encloses
+     *                  the generated code.
+     * \return std::string The generated source.
+     */
+    [[nodiscard]] std::string generate(
+        const std::string& namespace_name = std::string()) const;
+
+    /**
+     * \brief Getter of the input size of the generated model.
+     * \return SizeType The input size.
+     */
+    [[nodiscard]] SizeType input_size() const;
+
+    /**
+     * \brief Getter of the output size of the generated model.
+     * \return SizeType The output size.
+     */
+    [[nodiscard]] SizeType output_size() const;
+
+private:
+    /**
+     * \brief Layer description used to emit the code.
+     */
+    struct LayerCode
+    {
+        std::string type;             ///< Layer type.
+        std::string name;             ///< Layer name.
+        SizeType input_size;          ///< Layer input size.
+        SizeType output_size;         ///< Layer output size.
+        std::vector<NumType> weights; ///< Row-major weights.
+        std::vector<NumType> biases;  ///< Biases.
+        NumType alpha;                ///< Elu saturation value.
+        /// Producer layers, in input order.
+        std::vector<SizeType> inputs;
+        /// Concatenate input shapes, in input order.
+        std::vector<DLMath::Shape3d> input_shapes;
+        SizeType axis;                ///< Concatenate axis.
+    };
+
+    /**
+     * \brief Check the layers, drop the loss layers and sort the others in
+     * topological order.
+     * \param layers std::vector<LayerCode> The layers, with the inputs as
+     * indexes of this vector.
+     */
+    void _build(std::vector<LayerCode> layers);
+
+    /**
+     * \brief Check if the layer type is an identity at inference time.
+     * \param type const std::string& The layer type.
+     * \return bool True if the layer does not transform its input.
+     */
+    static bool _is_identity(const std::string& type);
+
+    /**
+     * \brief Check if the layer type is a loss.
+     * \param type const std::string& The layer type.
+     * \return bool True if the layer is a loss layer.
+     */
+    static bool _is_loss(const std::string& type);
+
+    /**
+     * \brief Convert a string in a valid C++ identifier.
+     * \param s const std::string& The string to convert.
+     * \return std::string The identifier.
+     */
+    static std::string _identifier(const std::string& s);
+
+    std::string _name;              ///< Model name.
+    std::string _num_type;          ///< NumType of the generated code.
+    std::vector<LayerCode> _layers; ///< Layers in execution order.
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_CODEGEN_HPP
@@ -27,7 +27,6 @@
 #include "dlmath.hpp"
 
 #include <algorithm>
-#include <cstdio>
 
 namespace EdgeLearning {
 
@@ -58,21 +57,6 @@ static inline void concatenate_check_shape(
     }
 }
 
-static inline DLMath::Shape3d concatenate_input_shape(
-        std::vector<DLMath::Shape3d> shapes, SizeType axis)
-{
-    concatenate_check_shape(shapes, axis);
-    DLMath::Shape3d ret(shapes[0]);
-    for (SizeType shape_idx = 1; shape_idx < shapes.size(); ++shape_idx)
-    {
-        if (ret[axis] < shapes[shape_idx][axis])
-        {
-            ret[axis] = shapes[shape_idx][axis];
-        }
-    }
-    return ret;
-}
-
 static inline DLMath::Shape3d concatenate_output_shape(
         std::vector<DLMath::Shape3d> shapes, SizeType axis)
 {
@@ -88,50 +72,69 @@ static inline DLMath::Shape3d concatenate_output_shape(
 ConcatenateLayer::ConcatenateLayer(std::string name,
                                    std::vector<DLMath::Shape3d> shapes,
                                    SizeType axis)
-    : FeedforwardLayer(concatenate_input_shape(shapes, axis),
+    : FeedforwardLayer(concatenate_output_shape(shapes, axis),
                        concatenate_output_shape(shapes, axis),
                        std::move(name), "concatenate_layer_")
     , _axis{axis}
-    , _current_input_layer{0}
-    , _current_output_shape{0, 0, 0}
+    , _slices{}
+    , _slice_gradients{}
 {
-
+    _set_input_shape(LayerShape(shapes));
 }
 
 const std::vector<NumType>& ConcatenateLayer::forward(
     const std::vector<NumType>& inputs)
 {
-    if (_current_input_layer == 0)
+    SizeType offset = 0;
+    for (SizeType input_idx = 0; input_idx < _slices.size(); ++input_idx)
     {
-        _current_output_shape = input_shapes()[0];
+        const auto& slice = _slices[input_idx];
+        auto src = inputs.data() + offset;
+        for (SizeType i = 0; i < slice.count; ++i)
+        {
+            std::copy(src + i * slice.block, src + (i + 1) * slice.block,
+                      _output_activations.data() + slice.offset
+                      + i * slice.stride);
+        }
+        offset += slice.block * slice.count;
     }
+    return FeedforwardLayer::forward(_output_activations);
+}
 
-    DLMath::append<NumType>(
-        _output_activations.data(), _shared_fields->output_shape().shape(),
-        inputs.data(), input_shapes().at(_current_input_layer).at(_axis),
-        _axis, _current_output_shape[_axis]);
-
-    if (_current_input_layer > 0)
+const std::vector<NumType>& ConcatenateLayer::forward_input(
+    const std::vector<NumType>& inputs, SizeType input_idx)
+{
+    const auto& slice = _slices.at(input_idx);
+    if (inputs.size() != slice.block * slice.count)
     {
-        _current_output_shape[_axis] +=
-            input_shapes()[_current_input_layer].at(_axis);
+        throw std::runtime_error("concatenate layer error: input size "
+                                 "differs from its shape");
     }
-
-    if (_current_input_layer < input_layers())
+    auto src = inputs.data();
+    for (SizeType i = 0; i < slice.count; ++i)
     {
-        _current_input_layer++;
-        return _output_activations;
+        std::copy(src + i * slice.block, src + (i + 1) * slice.block,
+                  _output_activations.data() + slice.offset
+                  + i * slice.stride);
     }
-    _current_input_layer = 0;
     return FeedforwardLayer::forward(_output_activations);
 }
 
 const std::vector<NumType>& ConcatenateLayer::backward(
     const std::vector<NumType>& gradients)
 {
-    (void) gradients;
-
-    return _input_gradients;
+    _allocate_gradients();
+    for (SizeType input_idx = 0; input_idx < _slices.size(); ++input_idx)
+    {
+        const auto& slice = _slices[input_idx];
+        auto dst = _slice_gradients[input_idx].data();
+        for (SizeType i = 0; i < slice.count; ++i)
+        {
+            auto src = gradients.data() + slice.offset + i * slice.stride;
+            std::copy(src, src + slice.block, dst + i * slice.block);
+        }
+    }
+    return FeedforwardLayer::backward(_slice_gradients.front());
 }
 
 void ConcatenateLayer::print() const 
@@ -143,17 +146,70 @@ void ConcatenateLayer::print() const
 
 Json ConcatenateLayer::dump() const
 {
-    return FeedforwardLayer::dump();
+    Json out = FeedforwardLayer::dump();
+
+    Json others;
+    others["axis"] = _axis;
+
+    out[dump_fields.at(DumpFields::OTHERS)] = others;
+    return out;
 }
 
 void ConcatenateLayer::load(const Json& in)
 {
     FeedforwardLayer::load(in);
+
+    _axis = in.at(dump_fields.at(DumpFields::OTHERS))
+        .at("axis").as<SizeType>();
+    _update_slices();
 }
 
 void ConcatenateLayer::_set_input_shape(LayerShape input_shape)
 {
-    FeedforwardLayer::input_shape(input_shape);
+    FeedforwardLayer::_set_input_shape(input_shape);
+    _update_slices();
+}
+
+void ConcatenateLayer::_update_slices()
+{
+    const auto& shapes = input_shapes();
+    auto output_shape = concatenate_output_shape(shapes, _axis);
+    _shared_fields->output_shape() = output_shape;
+    _shared_fields->output_size() = output_shape.size();
+    _output_activations.resize(output_shape.size());
+
+    SizeType inner = 1;
+    SizeType outer = 1;
+    for (SizeType i = 0; i < DLMath::Shape3d::SIZE; ++i)
+    {
+        if (i < _axis) outer *= output_shape.at(i);
+        if (i > _axis) inner *= output_shape.at(i);
+    }
+
+    _slices.clear();
+    SizeType axis_offset = 0;
+    for (const auto& shape: shapes)
+    {
+        _slices.push_back({axis_offset * inner, shape.at(_axis) * inner,
+                           output_shape.at(_axis) * inner, outer});
+        axis_offset += shape.at(_axis);
+    }
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void ConcatenateLayer::_resize_gradients()
+{
+    _slice_gradients.clear();
+    for (const auto& shape: input_shapes())
+    {
+        _slice_gradients.emplace_back(shape.size());
+    }
+}
+
+void ConcatenateLayer::_free_gradients()
+{
+    FeedforwardLayer::_free_gradients();
+    std::vector<std::vector<NumType>>().swap(_slice_gradients);
 }
 
 } // namespace EdgeLearning
@@ -37,20 +37,46 @@
 
 namespace EdgeLearning {
 
+/**
+ * \brief Concatenation of the outputs of multiple producer layers on an axis.
+ *
+ * The producers are the forward predecessors of the layer in the model, in
+ * layer order, and each one feeds its input with Layer::forward_input. The
+ * layer precomputes the slice of the output owned by each input: the forward
+ * copies every input into its slice of the output and the backward copies
+ * the matching slice of the gradients in a buffer of each producer, read with
+ * Layer::input_gradient. The producers own their output vectors, so the
+ * inputs are copied once in each direction.
+ *
+ * On the height axis (0) the slice of an input is a single contiguous block,
+ * hence concatenation is a single block copy in both directions. On the width
+ * and channel axes the slices interleave along the outer axes, e.g. the
+ * channels of every pixel, and the copy is a block for each outer index.
+ */
 class ConcatenateLayer : public FeedforwardLayer
 {
 public:
     static const std::string TYPE;
 
+    /**
+     * \brief Construct the concatenate layer.
+     * \param name   std::string The name of the layer.
+     * \param shapes std::vector<DLMath::Shape3d> Shapes of the inputs, in the
+     *               order of the producer layer indexes in the model
+     *               (DLGraph::Arc::input_idx), not in the order the edges
+     *               are created. forward_input throws if an input does not
+     *               match its shape.
+     * \param axis   SizeType The concatenation axis.
+     */
     ConcatenateLayer(std::string name = std::string(),
-                     std::vector<DLMath::Shape3d> shapes = {},
+                     std::vector<DLMath::Shape3d> shapes = {{0}},
                      SizeType axis = 0);
 
     [[nodiscard]] inline const std::string& type() const override
     { return TYPE; }
 
     /**
-     * \brief No initialization is needed for Pooling layers.
+     * \brief No initialization is needed for Concatenate layers.
      * \param init  Not used.
      * \param pdf   Not used.
      * \param rne   Not used.
@@ -66,23 +92,53 @@ public:
     };
 
     /**
-     * \brief The input data should have size _input_size.
-     * \param inputs const std::vector<NumType>& Layer input in forward.
+     * \brief Forward all the inputs at once.
+     * \param inputs const std::vector<NumType>& The inputs one after the
+     * other, of size output_size().
      */
     const std::vector<NumType>& forward(
         const std::vector<NumType>& inputs) override;
 
     /**
-     * \brief The gradient data should have size _output_size.
-     * Compute dJ/dz = dJ/dg(z) * dg(z)/dz
-     * where dJ/dg(z) is the input gradients, dg(z)/dz is the activation_grad 
-     * computed in the function and dJ/dz will be the result saved in 
-     * _activation_gradients.
-     * \param gradients const std::vector<NumType>& Layer gradients in backward.
+     * \brief Write an input into its slice of the output.
+     * \param inputs    const std::vector<NumType>& The input, of the size of
+     * the shape of input_idx.
+     * \param input_idx SizeType Index of the input.
+     * \return const std::vector<NumType>& The concatenated output.
+     */
+    const std::vector<NumType>& forward_input(
+        const std::vector<NumType>& inputs, SizeType input_idx) override;
+
+    const std::vector<NumType>& training_forward_input(
+        const std::vector<NumType>& inputs, SizeType input_idx) override
+    {
+        return forward_input(inputs, input_idx);
+    }
+
+    /**
+     * \brief Split the gradients in the slices of the inputs, read with
+     * input_gradient().
+     * \param gradients const std::vector<NumType>& Gradients of the output.
+     * \return const std::vector<NumType>& The gradients of the first input.
      */
     const std::vector<NumType>& backward(
         const std::vector<NumType>& gradients) override;
 
+    /**
+     * \brief Getter of the gradients of the first input.
+     * \return const std::vector<NumType>& The gradients of the first input.
+     */
+    const std::vector<NumType>& last_input_gradient() override
+    {
+        return input_gradient(0);
+    }
+
+    const std::vector<NumType>& input_gradient(SizeType input_idx) override
+    {
+        _allocate_gradients();
+        return _slice_gradients.at(input_idx);
+    }
+
     /**
      * \brief No params in concatenate layer.
      * \return SizeType 0.
@@ -119,13 +175,19 @@ public:
     void print() const override;
 
     /**
-     * \brief Save the layer infos and weights to disk.
+     * \brief Getter of the concatenation axis.
+     * \return SizeType The axis.
+     */
+    [[nodiscard]] SizeType axis() const { return _axis; }
+
+    /**
+     * \brief Save the layer infos to disk.
      * \return Json Layer dump.
      */
     Json dump() const override;
 
     /**
-     * \brief Load the layer infos and weights from disk.
+     * \brief Load the layer infos from disk.
      * \param in const Json& Json to read.
      */
     void load(const Json& in) override;
@@ -133,16 +195,40 @@ public:
 protected:
     /**
      * \brief Setter of input_shape class field.
-     * \param input_shape DLMath::Shape3d Shape param used to take the size and
-     * assign it to input_shape.
-     * The operation also performs a resize of the weights and its gradients.
+     * \param input_shape LayerShape The shapes of the inputs. The output
+     * shape and the slices are computed accordingly.
      */
     void _set_input_shape(LayerShape input_shape) override;
 
+    /**
+     * \brief The input gradients are a buffer for each input, of the size of
+     * its shape.
+     */
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
 private:
+    /**
+     * \brief Slice of the output owned by an input: count blocks of size
+     * block, the first at offset and each one stride after the previous.
+     */
+    struct Slice
+    {
+        SizeType offset;
+        SizeType block;
+        SizeType stride;
+        SizeType count;
+    };
+
+    /**
+     * \brief Compute the output shape and the slices of the input shapes.
+     */
+    void _update_slices();
+
     SizeType _axis;
-    SizeType _current_input_layer;
-    DLMath::Shape3d _current_output_shape;
+    std::vector<Slice> _slices;
+    /// \brief Gradients of each input. Size: input_size(input_idx).
+    std::vector<std::vector<NumType>> _slice_gradients;
 };
 
 } // namespace EdgeLearning
@@ -71,10 +71,6 @@ ConvolutionalLayer::ConvolutionalLayer(std::string name,
 
     // The bias is incremented to the result of each filter.
     _biases.resize(n_filters);
-
-    _weight_gradients.resize(_kernel_shape.size() * input_shape.channels()
-                             * n_filters);
-    _bias_gradients.resize(n_filters);
 }
 
 void ConvolutionalLayer::init(InitializationFunction init,
@@ -112,6 +108,7 @@ const std::vector<NumType>& ConvolutionalLayer::forward(
 const std::vector<NumType>& ConvolutionalLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     /*
      * Bias gradient. Calculate dJ/db = dJ/dz.
      *
@@ -202,8 +199,18 @@ NumType& ConvolutionalLayer::param(SizeType index)
     return _biases[index - _weights.size()];
 }
 
+void ConvolutionalLayer::map_params(NumType* data,
+                                    const std::shared_ptr<const void>& owner)
+{
+    auto weights_size = _weights.size();
+    auto biases_size = _biases.size();
+    _weights.view(data, weights_size, owner);
+    _biases.view(data + weights_size, biases_size, owner);
+}
+
 NumType& ConvolutionalLayer::gradient(SizeType index)
 {
+    _allocate_gradients();
     if (index >= param_count())
     {
         throw std::runtime_error("index overflow");
@@ -298,6 +305,73 @@ Json ConvolutionalLayer::dump() const
         biases.append(_biases[i]);
     }
 
+    out[dump_fields.at(DumpFields::WEIGHTS)] = weights;
+    out[dump_fields.at(DumpFields::BIASES)] = biases;
+    out[dump_fields.at(DumpFields::OTHERS)] = _dump_others();
+    return out;
+}
+
+void ConvolutionalLayer::load(const Json& in)
+{
+    _load_fields(in);
+
+    for (SizeType r = 0; r < _kernel_shape.height(); ++r)
+    {
+        SizeType r_offset = r * _kernel_shape.width()
+                          * _shared_fields->input_shape().channels()
+                          * _n_filters;
+        for (SizeType c = 0; c < _kernel_shape.width(); ++c)
+        {
+            SizeType c_offset = c * _shared_fields->input_shape().channels()
+                              * _n_filters;
+            for (SizeType ch = 0;
+                 ch < _shared_fields->input_shape().channels();
+                 ++ch)
+            {
+                SizeType ch_offset = ch * _n_filters;
+                // Read the weights of all the filters at once.
+                in.at(dump_fields.at(DumpFields::WEIGHTS))
+                    .at(r).at(c).at(ch).as_vec(
+                        _weights.data() + r_offset + c_offset + ch_offset,
+                        _n_filters);
+            }
+        }
+    }
+
+    in.at(dump_fields.at(DumpFields::BIASES)).as_vec(
+        _biases.data(), _n_filters);
+}
+
+void ConvolutionalLayer::dump_stream(JsonWriter& out) const
+{
+    out.begin_object();
+    out.members(FeedforwardLayer::dump());
+    out.key(dump_fields.at(DumpFields::OTHERS));
+    out.value(_dump_others());
+    out.key(dump_fields.at(DumpFields::WEIGHTS));
+    out.tensor(_weights.data(), {
+        _kernel_shape.height(), _kernel_shape.width(),
+        _shared_fields->input_shape().channels(), _n_filters});
+    out.key(dump_fields.at(DumpFields::BIASES));
+    out.tensor(_biases.data(), {_n_filters});
+    out.end_object();
+}
+
+void ConvolutionalLayer::load_stream(JsonReader& in)
+{
+    _load_stream(in, true,
+        [this](const Json& fields) { _load_fields(fields); },
+        [this](DumpFields field) -> ParamBuffers {
+            if (field == DumpFields::WEIGHTS)
+            {
+                return {{_weights.data(), _weights.size()}};
+            }
+            return {{_biases.data(), _biases.size()}};
+        });
+}
+
+Json ConvolutionalLayer::_dump_others() const
+{
     Json others;
     std::vector<std::size_t> kernel_size = {
         _kernel_shape.height(), _kernel_shape.width()
@@ -308,14 +382,10 @@ Json ConvolutionalLayer::dump() const
     others["stride"] = Json(stride);
     std::vector<std::size_t> padding = { _padding.height(), _padding.width() };
     others["padding"] = Json(padding);
-
-    out[dump_fields.at(DumpFields::WEIGHTS)] = weights;
-    out[dump_fields.at(DumpFields::BIASES)] = biases;
-    out[dump_fields.at(DumpFields::OTHERS)] = others;
-    return out;
+    return others;
 }
 
-void ConvolutionalLayer::load(const Json& in)
+void ConvolutionalLayer::_load_fields(const Json& in)
 {
     FeedforwardLayer::load(in);
 
@@ -335,39 +405,7 @@ void ConvolutionalLayer::load(const Json& in)
                     * _shared_fields->input_shape().channels()
                     * _n_filters);
     _biases.resize(_n_filters);
-    _weight_gradients.resize(_kernel_shape.size()
-                             * _shared_fields->input_shape().channels()
-                             * _n_filters);
-    _bias_gradients.resize(_n_filters);
-
-    for (SizeType r = 0; r < _kernel_shape.height(); ++r)
-    {
-        SizeType r_offset = r * _kernel_shape.width()
-                          * _shared_fields->input_shape().channels()
-                          * _n_filters;
-        for (SizeType c = 0; c < _kernel_shape.width(); ++c)
-        {
-            SizeType c_offset = c * _shared_fields->input_shape().channels()
-                              * _n_filters;
-            for (SizeType ch = 0;
-                 ch < _shared_fields->input_shape().channels();
-                 ++ch)
-            {
-                SizeType ch_offset = ch * _n_filters;
-                for (SizeType f = 0; f < _n_filters; ++f)
-                {
-                    _weights[r_offset + c_offset + ch_offset + f] = in.at(
-                        dump_fields.at(DumpFields::WEIGHTS))
-                            .at(r).at(c).at(ch).at(f);
-                }
-            }
-        }
-    }
-
-    for (SizeType i = 0; i < _n_filters; ++i)
-    {
-        _biases[i] = in.at(dump_fields.at(DumpFields::BIASES)).at(i);
-    }
+    if (_gradients_allocated) _resize_gradients();
 }
 
 DLMath::Shape3d ConvolutionalLayer::calculate_output_shape(
@@ -382,8 +420,6 @@ void ConvolutionalLayer::_set_input_shape(LayerShape input_shape)
 {
     FeedforwardLayer::_set_input_shape(input_shape);
     _weights.resize(_kernel_shape.size() * input_shape.shape().channels() * _n_filters);
-    _weight_gradients.resize(_kernel_shape.size() * input_shape.shape().channels()
-                             * _n_filters);
 
     // Update input and output shape accordingly (see this constructor).
     _shared_fields->input_shape() = input_shape;
@@ -392,6 +428,23 @@ void ConvolutionalLayer::_set_input_shape(LayerShape input_shape)
 
     // Update output size accordingly (see Layer and FeedforwardLayer constr.).
     _output_activations.resize(output_size());
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void ConvolutionalLayer::_resize_gradients()
+{
+    FeedforwardLayer::_resize_gradients();
+    _weight_gradients.resize(_kernel_shape.size()
+                             * _shared_fields->input_shape().channels()
+                             * _n_filters);
+    _bias_gradients.resize(_n_filters);
+}
+
+void ConvolutionalLayer::_free_gradients()
+{
+    FeedforwardLayer::_free_gradients();
+    Params().swap(_weight_gradients);
+    Params().swap(_bias_gradients);
 }
 
 } // namespace EdgeLearning
@@ -106,6 +106,9 @@ public:
     NumType& param(SizeType index) override;
     NumType& gradient(SizeType index) override;
 
+    void map_params(NumType* data,
+                    const std::shared_ptr<const void>& owner) override;
+
     [[nodiscard]] SharedPtr clone() const override
     {
         return std::make_shared<ConvolutionalLayer>(*this);
@@ -139,6 +142,9 @@ public:
      */
     void load(const Json& in) override;
 
+    void dump_stream(JsonWriter& out) const override;
+    void load_stream(JsonReader& in) override;
+
     static DLMath::Shape3d calculate_output_shape(
         DLMath::Shape3d input_shape, DLMath::Shape2d kernel_shape,
         DLMath::Shape2d stride, DLMath::Shape2d padding, SizeType n_filters);
@@ -154,7 +160,23 @@ protected:
      */
     void _set_input_shape(LayerShape input_shape) override;
 
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
 private:
+    /**
+     * \brief Load the fields that are not parameters and size the
+     * parameters.
+     * \param in const Json& Json to read.
+     */
+    void _load_fields(const Json& in);
+
+    /**
+     * \brief Dump of the hyperparameters of the layer.
+     * \return Json The others field of the dump.
+     */
+    [[nodiscard]] Json _dump_others() const;
+
     /// \brief Kernel shape. Size: height_kernel * width_kernel.
     DLMath::Shape2d _kernel_shape;
 
@@ -169,7 +191,7 @@ private:
     /// \brief Biases of the layer. Size: n_filters.
     SharedParams _biases;
 
-    // == Loss Gradients ==
+    // == Loss Gradients, allocated at the first training use ==
     /// \brief Weight gradients.
     /// Size: height_k * width_k * channels * n_filters.
     Params _weight_gradients;
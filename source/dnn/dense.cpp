@@ -46,9 +46,6 @@ DenseLayer::DenseLayer(std::string name,
 
     // Each node in this layer is assigned a bias.
     _biases.resize(output_size);
-
-    _weight_gradients.resize(output_size * input_size);
-    _bias_gradients.resize(output_size);
 }
 
 void DenseLayer::init(InitializationFunction init,
@@ -102,6 +99,7 @@ const std::vector<NumType>& DenseLayer::forward(
 const std::vector<NumType>& DenseLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     SizeType out_size = gradients.size();
     SizeType in_size = _shared_fields->input_size();
 
@@ -127,8 +125,18 @@ NumType& DenseLayer::param(SizeType index)
     return _biases[index - _weights.size()];
 }
 
+void DenseLayer::map_params(NumType* data,
+                            const std::shared_ptr<const void>& owner)
+{
+    auto weights_size = _weights.size();
+    auto biases_size = _biases.size();
+    _weights.view(data, weights_size, owner);
+    _biases.view(data + weights_size, biases_size, owner);
+}
+
 NumType& DenseLayer::gradient(SizeType index)
 {
+    _allocate_gradients();
     if (index >= param_count())
     {
         throw std::runtime_error("index overflow");
@@ -170,14 +178,9 @@ Json DenseLayer::dump() const
     Json weights;
     for (SizeType i = 0; i < output_size(); ++i)
     {
-        SizeType offset = i * input_size();
-
-        Json weights_row;
-        for (SizeType j = 0; j < input_size(); ++j)
-        {
-            weights_row.append(_weights[offset + j]);
-        }
-        weights.append(weights_row);
+        // A packed row of weights.
+        const auto* row = _weights.data() + i * input_size();
+        weights.append(JsonList(std::vector<NumType>(row, row + input_size())));
     }
 
     Json biases;
@@ -193,33 +196,70 @@ Json DenseLayer::dump() const
 
 void DenseLayer::load(const Json& in)
 {
-    FeedforwardLayer::load(in);
-
-    _weights.resize(output_size() * input_size());
-    _biases.resize(output_size());
-    _weight_gradients.resize(output_size() * input_size());
-    _bias_gradients.resize(output_size());
+    _load_fields(in);
 
+    // Read a whole row of weights at once.
+    const auto& weights = in.at(dump_fields.at(DumpFields::WEIGHTS));
     for (SizeType i = 0; i < output_size(); ++i)
     {
-        for (SizeType j = 0; j < input_size(); ++j)
-        {
-            _weights[i * input_size() + j] = in.at(
-                dump_fields.at(DumpFields::WEIGHTS)).at(i).at(j);
-        }
+        weights.at(i).as_vec(_weights.data() + i * input_size(),
+                             input_size());
     }
 
-    for (SizeType i = 0; i < output_size(); ++i)
-    {
-        _biases[i] = in.at(dump_fields.at(DumpFields::BIASES)).at(i);
-    }
+    in.at(dump_fields.at(DumpFields::BIASES)).as_vec(
+        _biases.data(), output_size());
+}
+
+void DenseLayer::dump_stream(JsonWriter& out) const
+{
+    out.begin_object();
+    out.members(FeedforwardLayer::dump());
+    out.key(dump_fields.at(DumpFields::WEIGHTS));
+    out.tensor(_weights.data(), {output_size(), input_size()});
+    out.key(dump_fields.at(DumpFields::BIASES));
+    out.tensor(_biases.data(), {output_size()});
+    out.end_object();
+}
+
+void DenseLayer::load_stream(JsonReader& in)
+{
+    _load_stream(in, false,
+        [this](const Json& fields) { _load_fields(fields); },
+        [this](DumpFields field) -> ParamBuffers {
+            if (field == DumpFields::WEIGHTS)
+            {
+                return {{_weights.data(), _weights.size()}};
+            }
+            return {{_biases.data(), _biases.size()}};
+        });
+}
+
+void DenseLayer::_load_fields(const Json& in)
+{
+    FeedforwardLayer::load(in);
+
+    _weights.resize(output_size() * input_size());
+    _biases.resize(output_size());
 }
 
 void DenseLayer::_set_input_shape(LayerShape input_shape)
 {
     FeedforwardLayer::_set_input_shape(input_shape);
     _weights.resize(output_size() * input_shape.size());
-    _weight_gradients.resize(output_size() * input_shape.size());
+}
+
+void DenseLayer::_resize_gradients()
+{
+    FeedforwardLayer::_resize_gradients();
+    _weight_gradients.resize(output_size() * input_size());
+    _bias_gradients.resize(output_size());
+}
+
+void DenseLayer::_free_gradients()
+{
+    FeedforwardLayer::_free_gradients();
+    Params().swap(_weight_gradients);
+    Params().swap(_bias_gradients);
 }
 
 } // namespace EdgeLearning
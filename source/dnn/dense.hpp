@@ -106,6 +106,9 @@ public:
     NumType& param(SizeType index) override;
     NumType& gradient(SizeType index) override;
 
+    void map_params(NumType* data,
+                    const std::shared_ptr<const void>& owner) override;
+
     [[nodiscard]] SharedPtr clone() const override
     {
         return std::make_shared<DenseLayer>(*this);
@@ -125,6 +128,9 @@ public:
      */
     void load(const Json& in) override;
 
+    void dump_stream(JsonWriter& out) const override;
+    void load_stream(JsonReader& in) override;
+
 protected:
     /**
      * \brief Setter of input_shape class field.
@@ -134,7 +140,16 @@ protected:
      */
     void _set_input_shape(LayerShape input_shape) override;
 
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
 private:
+    /**
+     * \brief Load the fields that are not parameters and size the
+     * parameters.
+     * \param in const Json& Json to read.
+     */
+    void _load_fields(const Json& in);
 
     // == Layer parameters ==
     /// \brief Weights of the layer. Size: _output_size * _input_size.
@@ -142,7 +157,7 @@ private:
     /// \brief Biases of the layer. Size: _output_size. 
     SharedParams _biases;
 
-    // == Loss Gradients ==
+    // == Loss Gradients, allocated at the first training use ==
     /// \brief Weight gradients of the layer. Size: _output_size * _input_size.
     Params _weight_gradients;
     /// \brief Biase gradients of the layer. Size: _output_size. 
@@ -24,11 +24,15 @@
 
 #include "dlgraph.hpp"
 
+#include <algorithm>
+
 
 namespace EdgeLearning {
 
 DLGraph::DLGraph()
     : _layers()
+    , _layers_map()
+    , _is_loss_layer()
     , _forward_graph(_layers)
     , _training_forward_graph(_layers)
     , _backward_graph(_layers)
@@ -39,55 +43,63 @@ DLGraph::DLGraph()
 
 DLGraph::DLGraph(const DLGraph& obj)
     : _layers()
+    , _layers_map()
+    , _is_loss_layer(obj._is_loss_layer)
     , _forward_graph(_layers)
     , _training_forward_graph(_layers)
     , _backward_graph(_layers)
     , _loss_layers_idx(obj._loss_layers_idx)
-    , _input_layers_idx()
-    , _output_layers_idx()
+    , _input_layers_idx(obj._input_layers_idx)
+    , _output_layers_idx(obj._output_layers_idx)
 {
     for(const auto& l: obj._layers)
     {
         _layers.push_back(l->clone());
+        _layers_map[_layers.back().get()] = _layers.size() - 1;
     }
-    _forward_graph._edges = obj._forward_graph._edges;
-    _training_forward_graph._edges = obj._training_forward_graph._edges;
-    _backward_graph._edges = obj._backward_graph._edges;
-    _compute_input_layers();
-    _compute_output_layers();
+    _forward_graph._successors = obj._forward_graph._successors;
+    _forward_graph._predecessors = obj._forward_graph._predecessors;
+    _training_forward_graph._successors =
+        obj._training_forward_graph._successors;
+    _training_forward_graph._predecessors =
+        obj._training_forward_graph._predecessors;
+    _backward_graph._successors = obj._backward_graph._successors;
+    _backward_graph._predecessors = obj._backward_graph._predecessors;
 }
 
 DLGraph& DLGraph::operator=(const DLGraph& obj)
 {
     if (this == &obj) return *this;
     _loss_layers_idx = obj._loss_layers_idx;
+    _is_loss_layer = obj._is_loss_layer;
+    _input_layers_idx = obj._input_layers_idx;
+    _output_layers_idx = obj._output_layers_idx;
 
     _layers.clear();
+    _layers_map.clear();
     for(const auto& l: obj._layers)
     {
         _layers.push_back(l->clone());
+        _layers_map[_layers.back().get()] = _layers.size() - 1;
     }
 
     _forward_graph = Graph(_layers);
     _training_forward_graph = Graph(_layers);
     _backward_graph = Graph(_layers);
-    _forward_graph._edges = obj._forward_graph._edges;
-    _training_forward_graph._edges = obj._training_forward_graph._edges;
-    _backward_graph._edges = obj._backward_graph._edges;
-    _compute_input_layers();
-    _compute_output_layers();
+    _forward_graph._successors = obj._forward_graph._successors;
+    _forward_graph._predecessors = obj._forward_graph._predecessors;
+    _training_forward_graph._successors =
+        obj._training_forward_graph._successors;
+    _training_forward_graph._predecessors =
+        obj._training_forward_graph._predecessors;
+    _backward_graph._successors = obj._backward_graph._successors;
+    _backward_graph._predecessors = obj._backward_graph._predecessors;
     return *this;
 }
 
 void DLGraph::add_node(std::shared_ptr<Layer> layer)
 {
-    if (std::find(_layers.begin(), _layers.end(), layer)
-        != _layers.cend())
-    {
-        return;
-    }
-
-    _layers.push_back(layer);
+    _add_node(std::move(layer), false);
 }
 
 void DLGraph::add_edge(std::shared_ptr<Layer> from, std::shared_ptr<Layer> to)
@@ -132,30 +144,30 @@ void DLGraph::add_edge(
 void DLGraph::add_arc_forward(
     std::vector<std::shared_ptr<Layer>> froms, std::shared_ptr<Layer> to)
 {
+    auto to_idx = _index_of(to.get());
     for (const auto& from: froms)
     {
-        _forward_graph.add_arc(from, to);
-        _training_forward_graph.add_arc(from, to);
+        _add_forward_arc(_index_of(from.get()), to_idx);
     }
-    _compute_input_layers();
-    _compute_output_layers();
 }
 
 void DLGraph::add_arc_forward(
     std::vector<std::shared_ptr<Layer>> froms, std::shared_ptr<LossLayer> to)
 {
+    auto to_idx = _index_of(to.get());
     for (const auto& from: froms)
     {
-        _training_forward_graph.add_arc(from, to);
+        _training_forward_graph.add_arc_idx(_index_of(from.get()), to_idx);
     }
 }
 
 void DLGraph::add_arc_backward(
     std::vector<std::shared_ptr<Layer>> froms, std::shared_ptr<Layer> to)
 {
+    auto to_idx = _index_of(to.get());
     for (const auto& from: froms)
     {
-        _backward_graph.add_arc(from, to);
+        _backward_graph.add_arc_idx(_index_of(from.get()), to_idx);
     }
 }
 
@@ -169,28 +181,26 @@ void DLGraph::add_edge(
 void DLGraph::add_arc_forward(
     std::shared_ptr<Layer> from, std::vector<std::shared_ptr<Layer>> tos)
 {
+    auto from_idx = _index_of(from.get());
     for (const auto& to: tos)
     {
-        _forward_graph.add_arc(from, to);
-        _training_forward_graph.add_arc(from, to);
+        _add_forward_arc(from_idx, _index_of(to.get()));
     }
-    _compute_input_layers();
-    _compute_output_layers();
 }
 
 void DLGraph::add_arc_backward(
     std::shared_ptr<Layer> from, std::vector<std::shared_ptr<Layer>> tos)
 {
+    auto from_idx = _index_of(from.get());
     for (const auto& to: tos)
     {
-        _backward_graph.add_arc(from, to);
+        _backward_graph.add_arc_idx(from_idx, _index_of(to.get()));
     }
 }
 
 void DLGraph::add_loss(std::shared_ptr<LossLayer> layer)
 {
-    add_node(layer);
-    _loss_layers_idx.push_back(_layers.size() - 1);
+    _add_node(std::move(layer), true);
 }
 
 bool DLGraph::has_training_forward(std::size_t layer_idx) const
@@ -338,9 +348,7 @@ std::vector<std::shared_ptr<Layer>> DLGraph::forward_layers() const
     std::vector<std::shared_ptr<Layer>> ret;
     for (std::size_t l_idx = 0; l_idx < _layers.size(); ++l_idx)
     {
-        if (std::find(_loss_layers_idx.begin(),
-                      _loss_layers_idx.end(),
-                      l_idx) == _loss_layers_idx.cend())
+        if (!_is_loss_layer[l_idx])
         {
             ret.push_back(_layers[l_idx]);
         }
@@ -353,9 +361,7 @@ std::vector<SizeType> DLGraph::forward_layers_idx() const
     std::vector<SizeType> ret;
     for (std::size_t l_idx = 0; l_idx < _layers.size(); ++l_idx)
     {
-        if (std::find(_loss_layers_idx.begin(),
-                      _loss_layers_idx.end(),
-                      l_idx) == _loss_layers_idx.cend())
+        if (!_is_loss_layer[l_idx])
         {
             ret.push_back(l_idx);
         }
@@ -380,95 +386,17 @@ std::vector<SizeType> DLGraph::loss_layers_idx() const
 
 std::vector<DLGraph::Arc> DLGraph::training_forward_run() const
 {
-    std::vector<DLGraph::Arc> ret;
-    std::vector<SizeType> layers_idx(_input_layers_idx);
-    std::vector<SizeType> done_list;
-    while(!layers_idx.empty())
-    {
-        auto curr_layers_idx = layers_idx;
-        layers_idx.clear();
-        for (auto from_layer_idx: curr_layers_idx)
-        {
-            for (const auto& to_layer_idx: training_forward(from_layer_idx))
-            {
-                DLGraph::Arc arc;
-                arc.from = _layers[from_layer_idx];
-                arc.to   = _layers[to_layer_idx];
-                ret.push_back(arc);
-
-                done_list.push_back(from_layer_idx);
-                if (DLMath::index_of(curr_layers_idx, to_layer_idx) == -1
-                    && DLMath::index_of(done_list, to_layer_idx) == -1
-                    && DLMath::index_of(layers_idx, to_layer_idx) == -1)
-                {
-                    layers_idx.push_back(to_layer_idx);
-                }
-            }
-        }
-    }
-    return ret;
+    return _run(_training_forward_graph, _input_layers_idx, false);
 }
 
 std::vector<DLGraph::Arc> DLGraph::forward_run() const
 {
-    std::vector<DLGraph::Arc> ret;
-    std::vector<SizeType> layers_idx(_input_layers_idx);
-    std::vector<SizeType> done_list;
-    while(!layers_idx.empty())
-    {
-        auto curr_layers_idx = layers_idx;
-        layers_idx.clear();
-        for (auto from_layer_idx: curr_layers_idx)
-        {
-            for (const auto& to_layer_idx: forward(from_layer_idx))
-            {
-                DLGraph::Arc arc;
-                arc.from = _layers[from_layer_idx];
-                arc.to   = _layers[to_layer_idx];
-                ret.push_back(arc);
-
-                done_list.push_back(from_layer_idx);
-                if (DLMath::index_of(curr_layers_idx, to_layer_idx) == -1
-                    && DLMath::index_of(done_list, to_layer_idx) == -1
-                    && DLMath::index_of(layers_idx, to_layer_idx) == -1)
-                {
-                    layers_idx.push_back(to_layer_idx);
-                }
-            }
-        }
-    }
-    return ret;
+    return _run(_forward_graph, _input_layers_idx, false);
 }
 
 std::vector<DLGraph::Arc> DLGraph::backward_run() const
 {
-    std::vector<DLGraph::Arc> ret;
-    std::vector<SizeType> layers_idx(_loss_layers_idx);
-    std::vector<SizeType> done_list;
-    while(!layers_idx.empty())
-    {
-        auto curr_layers_idx = layers_idx;
-        layers_idx.clear();
-        for (auto from_layer_idx: curr_layers_idx)
-        {
-            for (const auto& to_layer_idx: backward(from_layer_idx))
-            {
-                DLGraph::Arc arc;
-                arc.from = _layers[from_layer_idx];
-                arc.to   = _layers[to_layer_idx];
-                ret.push_back(arc);
-
-                done_list.push_back(from_layer_idx);
-                if (DLMath::index_of(curr_layers_idx, to_layer_idx) == -1
-                    && DLMath::index_of(done_list, to_layer_idx) == -1
-                    && DLMath::index_of(layers_idx, to_layer_idx) == -1)
-                {
-                    layers_idx.push_back(to_layer_idx);
-                }
-            }
-        }
-    }
-    return ret;
+    return _run(_backward_graph, _loss_layers_idx, true);
 }
 
 SizeType DLGraph::size() const
@@ -488,40 +416,120 @@ std::shared_ptr<Layer> DLGraph::operator[](SizeType idx)
 
 std::int64_t DLGraph::index_of(const Layer& l) const
 {
-    std::vector<const Layer*> layer_pointers;
-    for (const auto& l_graph: _layers)
+    auto it = _layers_map.find(&l);
+    return it != _layers_map.end() ? static_cast<std::int64_t>(it->second)
+                                   : -1;
+}
+
+SizeType DLGraph::_index_of(const Layer* layer) const
+{
+    auto it = _layers_map.find(layer);
+    if (it == _layers_map.end())
     {
-        layer_pointers.push_back(l_graph.get());
+        throw std::runtime_error(
+            "add_arc error: params are not included in nodes");
     }
-    return DLMath::index_of(layer_pointers, &l);
+    return it->second;
 }
 
-void DLGraph::_compute_input_layers()
+SizeType DLGraph::_add_node(std::shared_ptr<Layer> layer, bool is_loss)
 {
-    _input_layers_idx.clear();
-    for (std::size_t l_idx = 0; l_idx < _layers.size(); ++l_idx)
+    auto it = _layers_map.find(layer.get());
+    if (it != _layers_map.end())
     {
-        if (!_forward_graph.has_predecessors(l_idx)
-            && std::find(_loss_layers_idx.begin(), _loss_layers_idx.end(), l_idx)
-               == _loss_layers_idx.cend())
-        {
-            _input_layers_idx.push_back(l_idx);
-        }
+        if (is_loss) _loss_layers_idx.push_back(it->second);
+        return it->second;
     }
+
+    auto idx = _layers.size();
+    _layers.push_back(std::move(layer));
+    _layers_map[_layers.back().get()] = idx;
+    _is_loss_layer.push_back(is_loss);
+    if (is_loss)
+    {
+        _loss_layers_idx.push_back(idx);
+    }
+    else
+    {
+        // A layer without arcs is both an input and an output layer.
+        _input_layers_idx.push_back(idx);
+        _output_layers_idx.push_back(idx);
+    }
+    return idx;
 }
 
-void DLGraph::_compute_output_layers()
+void DLGraph::_add_forward_arc(SizeType from_idx, SizeType to_idx)
 {
-    _output_layers_idx.clear();
-    for (std::size_t l_idx = 0; l_idx < _layers.size(); ++l_idx)
+    auto erase = [](std::vector<SizeType>& v, SizeType idx) {
+        auto it = std::lower_bound(v.begin(), v.end(), idx);
+        if (it != v.end() && *it == idx) v.erase(it);
+    };
+    if (!_forward_graph.has_successors(from_idx))
+    {
+        erase(_output_layers_idx, from_idx);
+    }
+    if (!_forward_graph.has_predecessors(to_idx))
     {
-        if (!_forward_graph.has_successors(l_idx)
-            && std::find(_loss_layers_idx.begin(), _loss_layers_idx.end(), l_idx)
-               == _loss_layers_idx.cend())
+        erase(_input_layers_idx, to_idx);
+    }
+    _forward_graph.add_arc_idx(from_idx, to_idx);
+    _training_forward_graph.add_arc_idx(from_idx, to_idx);
+}
+
+std::vector<DLGraph::Arc> DLGraph::_run(
+    const Graph<std::shared_ptr<Layer>>& graph,
+    const std::vector<SizeType>& begin_layers_idx, bool backward) const
+{
+    auto input_idx = [&](SizeType producer_idx, SizeType consumer_idx) {
+        const auto& predecessors = backward
+            ? _forward_graph.predecessors_list(consumer_idx)
+            : graph.predecessors_list(consumer_idx);
+        auto it = std::lower_bound(predecessors.begin(), predecessors.end(),
+                                   producer_idx);
+        return (it == predecessors.end() || *it != producer_idx)
+            ? SizeType{0}
+            : static_cast<SizeType>(it - predecessors.begin());
+    };
+
+    // Breadth-first visit: a layer is queued only once for each level and
+    // never after it has propagated to its successors.
+    std::vector<DLGraph::Arc> ret;
+    std::vector<bool> is_current(_layers.size(), false);
+    std::vector<bool> is_queued(_layers.size(), false);
+    std::vector<bool> is_done(_layers.size(), false);
+    std::vector<SizeType> layers_idx(begin_layers_idx);
+    while(!layers_idx.empty())
+    {
+        auto curr_layers_idx = std::move(layers_idx);
+        layers_idx.clear();
+        for (auto l_idx: curr_layers_idx) is_current[l_idx] = true;
+        for (auto from_layer_idx: curr_layers_idx)
         {
-            _output_layers_idx.push_back(l_idx);
+            for (const auto& to_layer_idx:
+                 graph.successors_list(from_layer_idx))
+            {
+                DLGraph::Arc arc;
+                arc.from = _layers[from_layer_idx];
+                arc.to   = _layers[to_layer_idx];
+                arc.input_idx = backward
+                    ? input_idx(to_layer_idx, from_layer_idx)
+                    : input_idx(from_layer_idx, to_layer_idx);
+                ret.push_back(arc);
+
+                is_done[from_layer_idx] = true;
+                if (!is_current[to_layer_idx]
+                    && !is_done[to_layer_idx]
+                    && !is_queued[to_layer_idx])
+                {
+                    is_queued[to_layer_idx] = true;
+                    layers_idx.push_back(to_layer_idx);
+                }
+            }
         }
+        for (auto l_idx: curr_layers_idx) is_current[l_idx] = false;
+        for (auto l_idx: layers_idx) is_queued[l_idx] = false;
     }
+    return ret;
 }
 
 } // namespace EdgeLearning
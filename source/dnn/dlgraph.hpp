@@ -33,101 +33,188 @@
 #include "loss.hpp"
 #include "dlmath.hpp"
 
+#include <algorithm>
 #include <vector>
 #include <set>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 
 namespace EdgeLearning {
 
+/**
+ * \brief Directed graph over an external vector of nodes.
+ * Successors and predecessors of each node are kept in sorted index lists,
+ * so that both directions are queried in O(degree). The nodes are looked up
+ * through a hash map that indexes lazily the nodes appended to the external
+ * vector.
+ * \tparam T Type of the nodes, it has to be hashable.
+ */
 template<typename T>
 class Graph
 {
 public:
+    using AdjacencyList = std::vector<std::size_t>;
+
     Graph(std::vector<T>& nodes_init)
-        : _edges{}
+        : _successors{}
+        , _predecessors{}
         , _nodes{nodes_init}
+        , _nodes_map{}
+        , _indexed_nodes{0}
     { }
 
     Graph(const Graph<T>& obj)
-        : _edges{obj._edges}
+        : _successors{obj._successors}
+        , _predecessors{obj._predecessors}
         , _nodes{obj._nodes}
+        , _nodes_map{}
+        , _indexed_nodes{0}
     { }
 
     Graph& operator=(const Graph& obj)
     {
         if (this == &obj) return *this;
-        _edges = obj._edges;
+        _successors = obj._successors;
+        _predecessors = obj._predecessors;
         _nodes = obj._nodes;
+        _nodes_map.clear();
+        _indexed_nodes = 0;
         return *this;
     }
 
     void add_arc(const T& from, const T& to)
     {
-        auto from_idx = DLMath::index_of(_nodes, from);
-        auto to_idx = DLMath::index_of(_nodes, to);
+        auto from_idx = index_of(from);
+        auto to_idx = index_of(to);
         if (from_idx == -1 || to_idx == -1)
         {
             throw std::runtime_error(
                 "add_arc error: params are not included in nodes");
         }
-        _edges[static_cast<std::size_t>(from_idx)].insert(
-            static_cast<std::size_t>(to_idx));
+        add_arc_idx(static_cast<std::size_t>(from_idx),
+                    static_cast<std::size_t>(to_idx));
+    }
+
+    /**
+     * \brief Add an arc between two node indexes, without any check on the
+     * nodes vector.
+     * \param from_idx std::size_t Index of the source node.
+     * \param to_idx   std::size_t Index of the destination node.
+     */
+    void add_arc_idx(std::size_t from_idx, std::size_t to_idx)
+    {
+        auto size = std::max(from_idx, to_idx) + 1;
+        if (_successors.size() < size)
+        {
+            _successors.resize(size);
+            _predecessors.resize(size);
+        }
+        if (_insert(_successors[from_idx], to_idx))
+        {
+            _insert(_predecessors[to_idx], from_idx);
+        }
+    }
+
+    /**
+     * \brief Index of a node in O(1) on average.
+     * \param node const T& The node to search.
+     * \return std::int64_t Index of the node or -1 if not found.
+     */
+    std::int64_t index_of(const T& node)
+    {
+        if (_indexed_nodes > _nodes.size())
+        {
+            _nodes_map.clear();
+            _indexed_nodes = 0;
+        }
+        for (; _indexed_nodes < _nodes.size(); ++_indexed_nodes)
+        {
+            _nodes_map.emplace(_nodes[_indexed_nodes], _indexed_nodes);
+        }
+
+        auto it = _nodes_map.find(node);
+        if (it != _nodes_map.end() && _nodes[it->second] == node)
+        {
+            return static_cast<std::int64_t>(it->second);
+        }
+        // The nodes vector could have been changed in place: fall back to
+        // a linear search and index it again.
+        _nodes_map.clear();
+        _indexed_nodes = 0;
+        return DLMath::index_of(_nodes, node);
     }
 
     [[nodiscard]] bool has_successors(std::size_t idx) const
     {
-        return _edges.count(idx) > 0 && !_edges.at(idx).empty();
+        return !successors_list(idx).empty();
     }
 
     [[nodiscard]] std::set<std::size_t> successors(std::size_t idx) const
     {
-        return _edges.count(idx) > 0 ? _edges.at(idx) : std::set<std::size_t>();
+        const auto& list = successors_list(idx);
+        return std::set<std::size_t>(list.begin(), list.end());
+    }
+
+    /**
+     * \brief Sorted successor indexes of a node, without copies.
+     * \param idx std::size_t Index of the node.
+     * \return const AdjacencyList& The successors.
+     */
+    [[nodiscard]] const AdjacencyList& successors_list(std::size_t idx) const
+    {
+        return idx < _successors.size() ? _successors[idx] : _empty_list();
     }
 
     [[nodiscard]] bool has_predecessors(std::size_t idx) const
     {
-        for (const auto& edge: _edges)
-        {
-            if (std::find(edge.second.begin(), edge.second.end(), idx)
-                != edge.second.cend())
-            {
-                return true;
-            }
-        }
-        return false;
+        return !predecessors_list(idx).empty();
     }
 
     [[nodiscard]] std::set<std::size_t> predecessors(std::size_t idx) const
     {
-        std::set<std::size_t> ret;
-        for (const auto& edge: _edges)
+        const auto& list = predecessors_list(idx);
+        return std::set<std::size_t>(list.begin(), list.end());
+    }
+
+    /**
+     * \brief Sorted predecessor indexes of a node, without copies.
+     * \param idx std::size_t Index of the node.
+     * \return const AdjacencyList& The predecessors.
+     */
+    [[nodiscard]] const AdjacencyList& predecessors_list(std::size_t idx) const
+    {
+        return idx < _predecessors.size() ? _predecessors[idx] : _empty_list();
+    }
+
+    [[nodiscard]] const std::vector<T>& nodes() const { return _nodes; }
+
+    /**
+     * \brief Map of the nodes with at least a successor to their successors.
+     * \return std::map<std::size_t, std::set<std::size_t>> The edges.
+     */
+    [[nodiscard]] std::map<std::size_t, std::set<std::size_t>> edges() const
+    {
+        std::map<std::size_t, std::set<std::size_t>> ret;
+        for (std::size_t idx = 0; idx < _successors.size(); ++idx)
         {
-            const auto& node = edge.first;
-            const auto& successors = edge.second;
-            if (std::find(successors.begin(), successors.end(), idx)
-                != successors.cend())
+            if (!_successors[idx].empty())
             {
-                ret.insert(node);
+                ret[idx] = successors(idx);
             }
         }
         return ret;
     }
 
-    [[nodiscard]] const std::vector<T>& nodes() const { return _nodes; }
-    [[nodiscard]] const std::map<std::size_t, std::set<std::size_t>>& edges() const
-    { return _edges; }
-
     [[nodiscard]] std::vector<std::int64_t> adjacent_matrix() const
     {
         std::vector<std::int64_t> ret(_nodes.size() * _nodes.size(),
                                       std::int64_t(0));
-        for (const auto& edge: _edges)
+        for (std::size_t idx = 0; idx < _successors.size(); ++idx)
         {
-            auto row = edge.first * _nodes.size();
-            const auto& successors = edge.second;
-            for (const auto& successor: successors)
+            auto row = idx * _nodes.size();
+            for (const auto& successor: _successors[idx])
             {
                 auto col = successor;
                 ret[row + col] = std::int64_t(1);
@@ -139,8 +226,34 @@ public:
 private:
     friend class DLGraph;
 
-    std::map<std::size_t, std::set<std::size_t>> _edges;
+    static const AdjacencyList& _empty_list()
+    {
+        static const AdjacencyList empty;
+        return empty;
+    }
+
+    /**
+     * \brief Insert an index in a sorted adjacency list.
+     * \return bool False if the index was already in the list.
+     */
+    static bool _insert(AdjacencyList& list, std::size_t idx)
+    {
+        auto it = std::lower_bound(list.begin(), list.end(), idx);
+        if (it != list.end() && *it == idx) return false;
+        list.insert(it, idx);
+        return true;
+    }
+
+    /// \brief Successors of each node index.
+    std::vector<AdjacencyList> _successors;
+    /// \brief Predecessors of each node index.
+    std::vector<AdjacencyList> _predecessors;
     std::vector<T>& _nodes;
+
+    /// \brief Index of each node, built lazily.
+    std::unordered_map<T, std::size_t> _nodes_map;
+    /// \brief Amount of nodes indexed in _nodes_map.
+    std::size_t _indexed_nodes;
 };
 
 class DLGraph
@@ -148,9 +261,16 @@ class DLGraph
 public:
     using SharedPtr = std::shared_ptr<DLGraph>;
 
+    /**
+     * \brief Arc of a run. input_idx is the index of the input of the
+     * consumer layer that the arc feeds: the position of the producer among
+     * the forward predecessors of the consumer, in layer order. In the
+     * backward run the consumer is the source of the arc.
+     */
     struct Arc {
         std::shared_ptr<Layer> from;
         std::shared_ptr<Layer> to;
+        SizeType input_idx = 0;
     };
 
     DLGraph();
@@ -227,10 +347,40 @@ public:
     std::int64_t index_of(const Layer& l) const;
 
 private:
-    void _compute_input_layers();
-    void _compute_output_layers();
+    /**
+     * \brief Index of a layer of the graph.
+     * \param layer const Layer* The layer to search.
+     * \return SizeType The layer index, it throws if not found.
+     */
+    SizeType _index_of(const Layer* layer) const;
+
+    /**
+     * \brief Append a layer to the graph.
+     * \param layer   std::shared_ptr<Layer> The layer to add.
+     * \param is_loss bool True if the layer is a loss layer.
+     * \return SizeType The index of the layer.
+     */
+    SizeType _add_node(std::shared_ptr<Layer> layer, bool is_loss);
+
+    /**
+     * \brief Add a forward arc to the forward graphs and update
+     * incrementally the input and output layers.
+     */
+    void _add_forward_arc(SizeType from_idx, SizeType to_idx);
+
+    /**
+     * \brief Compute the arcs in breadth-first order from the given layers.
+     * \param backward bool True if the arcs go from consumer to producer.
+     */
+    std::vector<Arc> _run(const Graph<std::shared_ptr<Layer>>& graph,
+                          const std::vector<SizeType>& begin_layers_idx,
+                          bool backward) const;
 
     std::vector<std::shared_ptr<Layer>> _layers;
+    /// \brief Index of each layer.
+    std::unordered_map<const Layer*, SizeType> _layers_map;
+    /// \brief True for the loss layers.
+    std::vector<bool> _is_loss_layer;
     Graph<std::shared_ptr<Layer>> _forward_graph;
     Graph<std::shared_ptr<Layer>> _training_forward_graph;
     Graph<std::shared_ptr<Layer>> _backward_graph;
@@ -536,6 +536,141 @@ public:
         return matarr_mul_no_check<T>(arr_dst, mat_src, arr_src, rows, cols);
     }
 
+    /**
+     * \brief Multiplication between two matrices.
+     * Used for Y = A * B, where A is rows x inner and B is inner x cols.
+     * \tparam T      Type of each source and destination elements.
+     * \param mat_dst Matrix destination of size rows x cols.
+     * \param lhs     Matrix source, left operand.
+     * \param rhs     Matrix source, right operand.
+     * \param rows    Amount of rows of the left operand.
+     * \param inner   Amount of columns of the left operand.
+     * \param cols    Amount of columns of the right operand.
+     * \return T* The destination matrix pointer.
+     */
+    template <typename T>
+    static T* matmat_mul_no_check(
+        T* mat_dst, const T* lhs, const T* rhs,
+        SizeType rows, SizeType inner, SizeType cols)
+    {
+        for (SizeType i = 0; i < rows; ++i)
+        {
+            T* dst_row = mat_dst + (i * cols);
+            std::fill(dst_row, dst_row + cols, T{0});
+            for (SizeType k = 0; k < inner; ++k)
+            {
+                const T lhs_ik = lhs[(i * inner) + k];
+                const T* rhs_row = rhs + (k * cols);
+                for (SizeType j = 0; j < cols; ++j)
+                {
+                    dst_row[j] += lhs_ik * rhs_row[j];
+                }
+            }
+        }
+        return mat_dst;
+    }
+
+    template <typename T>
+    static T* matmat_mul(T* mat_dst, const T* lhs, const T* rhs,
+        SizeType rows, SizeType inner, SizeType cols)
+    {
+        if (lhs == mat_dst || rhs == mat_dst)
+        {
+            throw std::runtime_error("lhs, rhs and mat_dst have to be "
+                                     "different in order to perform "
+                                     "matmat_mul");
+        }
+        return matmat_mul_no_check<T>(mat_dst, lhs, rhs, rows, inner, cols);
+    }
+
+    /**
+     * \brief Multiplication between a matrix and a transposed matrix.
+     * Used for Y = X * W^T, that is the matarr_mul of each row of X with W,
+     * where X is rows x inner and W is cols x inner.
+     * \tparam T      Type of each source and destination elements.
+     * \param mat_dst Matrix destination of size rows x cols.
+     * \param lhs     Matrix source, left operand.
+     * \param rhs     Matrix source, right operand to transpose.
+     * \param rows    Amount of rows of the left operand.
+     * \param inner   Amount of columns of both operands.
+     * \param cols    Amount of rows of the right operand.
+     * \return T* The destination matrix pointer.
+     */
+    template <typename T>
+    static T* matmat_mul_t_no_check(
+        T* mat_dst, const T* lhs, const T* rhs,
+        SizeType rows, SizeType inner, SizeType cols)
+    {
+        for (SizeType i = 0; i < rows; ++i)
+        {
+            matarr_mul_no_check<T>(mat_dst + (i * cols), rhs,
+                                   lhs + (i * inner), cols, inner);
+        }
+        return mat_dst;
+    }
+
+    template <typename T>
+    static T* matmat_mul_t(T* mat_dst, const T* lhs, const T* rhs,
+        SizeType rows, SizeType inner, SizeType cols)
+    {
+        if (lhs == mat_dst || rhs == mat_dst)
+        {
+            throw std::runtime_error("lhs, rhs and mat_dst have to be "
+                                     "different in order to perform "
+                                     "matmat_mul_t");
+        }
+        return matmat_mul_t_no_check<T>(mat_dst, lhs, rhs, rows, inner, cols);
+    }
+
+    /**
+     * \brief Accumulation of the outer products between the rows of two
+     * matrices, that is Y += A^T * B, where A is count x rows and B is
+     * count x cols. Used to accumulate the weight gradients of a sequence.
+     * \tparam T      Type of each source and destination elements.
+     * \param mat_dst Matrix destination of size rows x cols.
+     * \param lhs     Matrix source, left operand.
+     * \param rhs     Matrix source, right operand.
+     * \param count   Amount of rows of both operands.
+     * \param rows    Amount of columns of the left operand.
+     * \param cols    Amount of columns of the right operand.
+     * \return T* The destination matrix pointer.
+     */
+    template <typename T>
+    static T* outer_product_acc_no_check(
+        T* mat_dst, const T* lhs, const T* rhs,
+        SizeType count, SizeType rows, SizeType cols)
+    {
+        for (SizeType t = 0; t < count; ++t)
+        {
+            const T* lhs_row = lhs + (t * rows);
+            const T* rhs_row = rhs + (t * cols);
+            for (SizeType i = 0; i < rows; ++i)
+            {
+                const T lhs_ti = lhs_row[i];
+                T* dst_row = mat_dst + (i * cols);
+                for (SizeType j = 0; j < cols; ++j)
+                {
+                    dst_row[j] += lhs_ti * rhs_row[j];
+                }
+            }
+        }
+        return mat_dst;
+    }
+
+    template <typename T>
+    static T* outer_product_acc(T* mat_dst, const T* lhs, const T* rhs,
+        SizeType count, SizeType rows, SizeType cols)
+    {
+        if (lhs == mat_dst || rhs == mat_dst)
+        {
+            throw std::runtime_error("lhs, rhs and mat_dst have to be "
+                                     "different in order to perform "
+                                     "outer_product_acc");
+        }
+        return outer_product_acc_no_check<T>(
+            mat_dst, lhs, rhs, count, rows, cols);
+    }
+
     /**
      * \brief ReLU Function.
      * relu(x) = max(0, x)
@@ -1125,6 +1260,42 @@ public:
         return dst;
     }
 
+    /**
+     * \brief Cross-Entropy Function with a class index target, i.e. the
+     * index of the active value of a one hot target.
+     * cross_entropy(y, y_hat) = - log( max(y_hat_y, epsilon) )
+     * \tparam T Type of the inputs and return type.
+     * \param y     Target class index.
+     * \param y_hat Estimated array values.
+     * \return T The resulting Cross-Entropy.
+     */
+    template <typename T>
+    static T sparse_cross_entropy(SizeType y, const T* y_hat)
+    {
+        return cross_entropy(T(1), y_hat[y]);
+    }
+
+    /**
+     * \brief Cross-Entropy Function first derivative with a class index
+     * target, i.e. the index of the active value of a one hot target.
+     * cross_entropy'(y, y_hat)_i = i == y ? - 1 / max(y_hat_i, epsilon) : 0
+     * \tparam T Type of the inputs and return type.
+     * \param dst    Destination array.
+     * \param y      Target class index.
+     * \param y_hat  Estimated array values.
+     * \param norm   Normalizer term.
+     * \param length Length of the arrays.
+     * \return T* The destination array pointer.
+     */
+    template <typename T>
+    static T* sparse_cross_entropy_1(T* dst, SizeType y, const T* y_hat,
+        T norm, SizeType length)
+    {
+        std::fill(dst, dst + length, T(0));
+        dst[y] = cross_entropy_1(T(1), y_hat[y], norm);
+        return dst;
+    }
+
     /**
      * \brief Squared Error Function.
      * squared_error(y, y_hat) = (y - y_hat)^2
@@ -1898,6 +2069,182 @@ public:
         return input_gradients;
     }
 
+    /**
+     * \brief Fused LSTM cell of a single time step.
+     * The packed gates are in order input, forget, cell and output, each of
+     * hidden_size elements. The gate pre-activations are the sum of the input
+     * products, the hidden products and the biases, then:
+     * c(t+1) = f * c(t) + i * g and h(t+1) = o * tanh(c(t+1)).
+     * \tparam T               Type of each source and destination elements.
+     * \param gates            Input products of size 4 * hidden_size. It is
+     *                         overwritten with the activated gates.
+     * \param hidden_gates     Hidden products of size 4 * hidden_size.
+     * \param biases           Gate biases of size 4 * hidden_size.
+     * \param cell_state       Previous cell state.
+     * \param next_cell_state  Next cell state to write.
+     * \param cell_activations tanh of the next cell state to write.
+     * \param next_hidden_state Next hidden state to write.
+     * \param hidden_size      Hidden size.
+     * \return T* The next hidden state pointer.
+     */
+    template <typename T>
+    static T* lstm_cell(
+        T* gates, const T* hidden_gates, const T* biases,
+        const T* cell_state, T* next_cell_state, T* cell_activations,
+        T* next_hidden_state, SizeType hidden_size)
+    {
+        T* i_gate = gates;
+        T* f_gate = gates + hidden_size;
+        T* g_gate = gates + 2 * hidden_size;
+        T* o_gate = gates + 3 * hidden_size;
+        for (SizeType k = 0; k < hidden_size; ++k)
+        {
+            i_gate[k] = sigmoid(i_gate[k] + hidden_gates[k] + biases[k]);
+            f_gate[k] = sigmoid(f_gate[k] + hidden_gates[hidden_size + k]
+                                + biases[hidden_size + k]);
+            g_gate[k] = tanh(g_gate[k] + hidden_gates[2 * hidden_size + k]
+                             + biases[2 * hidden_size + k]);
+            o_gate[k] = sigmoid(o_gate[k] + hidden_gates[3 * hidden_size + k]
+                                + biases[3 * hidden_size + k]);
+            next_cell_state[k] = f_gate[k] * cell_state[k]
+                + i_gate[k] * g_gate[k];
+            cell_activations[k] = tanh(next_cell_state[k]);
+            next_hidden_state[k] = o_gate[k] * cell_activations[k];
+        }
+        return next_hidden_state;
+    }
+
+    /**
+     * \brief Fused LSTM cell derivative of a single time step.
+     * \tparam T               Type of each source and destination elements.
+     * \param gate_gradients   Gradients of the gate pre-activations to write,
+     *                         of size 4 * hidden_size.
+     * \param cell_gradient    Gradient of the next cell state. It is
+     *                         overwritten with the gradient of the previous
+     *                         cell state.
+     * \param hidden_gradient  Gradient of the next hidden state.
+     * \param gates            Activated gates computed by lstm_cell.
+     * \param cell_state       Previous cell state.
+     * \param cell_activations tanh of the next cell state.
+     * \param hidden_size      Hidden size.
+     * \return T* The gate gradients pointer.
+     */
+    template <typename T>
+    static T* lstm_cell_1(
+        T* gate_gradients, T* cell_gradient, const T* hidden_gradient,
+        const T* gates, const T* cell_state, const T* cell_activations,
+        SizeType hidden_size)
+    {
+        const T* i_gate = gates;
+        const T* f_gate = gates + hidden_size;
+        const T* g_gate = gates + 2 * hidden_size;
+        const T* o_gate = gates + 3 * hidden_size;
+        for (SizeType k = 0; k < hidden_size; ++k)
+        {
+            T dc = cell_gradient[k] + hidden_gradient[k] * o_gate[k]
+                * tanh_1_opt(cell_activations[k]);
+            gate_gradients[k] = dc * g_gate[k] * sigmoid_1_opt(i_gate[k]);
+            gate_gradients[hidden_size + k] =
+                dc * cell_state[k] * sigmoid_1_opt(f_gate[k]);
+            gate_gradients[2 * hidden_size + k] =
+                dc * i_gate[k] * tanh_1_opt(g_gate[k]);
+            gate_gradients[3 * hidden_size + k] = hidden_gradient[k]
+                * cell_activations[k] * sigmoid_1_opt(o_gate[k]);
+            cell_gradient[k] = dc * f_gate[k];
+        }
+        return gate_gradients;
+    }
+
+    /**
+     * \brief Fused GRU cell of a single time step.
+     * The packed gates are in order reset, update and new, each of
+     * hidden_size elements:
+     * r = sigmoid(x_r + h_r), z = sigmoid(x_z + h_z),
+     * n = tanh(x_n + r * h_n) and h(t+1) = (1 - z) * n + z * h(t),
+     * where x_* and h_* are the input and hidden products plus their biases.
+     * \tparam T                Type of each source and destination elements.
+     * \param gates             Input products of size 3 * hidden_size. It is
+     *                          overwritten with the activated gates.
+     * \param hidden_gates      Hidden products of size 3 * hidden_size. The
+     *                          biases are summed in place.
+     * \param input_biases      Input biases of size 3 * hidden_size.
+     * \param hidden_biases     Hidden biases of size 3 * hidden_size.
+     * \param hidden_state      Previous hidden state.
+     * \param next_hidden_state Next hidden state to write.
+     * \param hidden_size       Hidden size.
+     * \return T* The next hidden state pointer.
+     */
+    template <typename T>
+    static T* gru_cell(
+        T* gates, T* hidden_gates, const T* input_biases,
+        const T* hidden_biases, const T* hidden_state, T* next_hidden_state,
+        SizeType hidden_size)
+    {
+        T* r_gate = gates;
+        T* z_gate = gates + hidden_size;
+        T* n_gate = gates + 2 * hidden_size;
+        for (SizeType k = 0; k < 3 * hidden_size; ++k)
+        {
+            hidden_gates[k] += hidden_biases[k];
+        }
+        for (SizeType k = 0; k < hidden_size; ++k)
+        {
+            r_gate[k] = sigmoid(r_gate[k] + input_biases[k] + hidden_gates[k]);
+            z_gate[k] = sigmoid(z_gate[k] + input_biases[hidden_size + k]
+                                + hidden_gates[hidden_size + k]);
+            n_gate[k] = tanh(n_gate[k] + input_biases[2 * hidden_size + k]
+                             + r_gate[k] * hidden_gates[2 * hidden_size + k]);
+            next_hidden_state[k] = (T{1} - z_gate[k]) * n_gate[k]
+                + z_gate[k] * hidden_state[k];
+        }
+        return next_hidden_state;
+    }
+
+    /**
+     * \brief Fused GRU cell derivative of a single time step.
+     * \tparam T                   Type of each source and destination
+     *                             elements.
+     * \param gate_gradients       Gradients of the input pre-activations to
+     *                             write, of size 3 * hidden_size.
+     * \param hidden_gate_gradients Gradients of the hidden products to write,
+     *                             of size 3 * hidden_size.
+     * \param hidden_gradient      Gradient of the next hidden state. It is
+     *                             overwritten with the direct gradient of the
+     *                             previous hidden state.
+     * \param gates                Activated gates computed by gru_cell.
+     * \param hidden_gates         Hidden products with biases of gru_cell.
+     * \param hidden_state         Previous hidden state.
+     * \param hidden_size          Hidden size.
+     * \return T* The gate gradients pointer.
+     */
+    template <typename T>
+    static T* gru_cell_1(
+        T* gate_gradients, T* hidden_gate_gradients, T* hidden_gradient,
+        const T* gates, const T* hidden_gates, const T* hidden_state,
+        SizeType hidden_size)
+    {
+        const T* r_gate = gates;
+        const T* z_gate = gates + hidden_size;
+        const T* n_gate = gates + 2 * hidden_size;
+        for (SizeType k = 0; k < hidden_size; ++k)
+        {
+            T dh = hidden_gradient[k];
+            T dn = dh * (T{1} - z_gate[k]) * tanh_1_opt(n_gate[k]);
+            T dz = dh * (hidden_state[k] - n_gate[k])
+                * sigmoid_1_opt(z_gate[k]);
+            T dr = dn * hidden_gates[2 * hidden_size + k]
+                * sigmoid_1_opt(r_gate[k]);
+            gate_gradients[k] = dr;
+            gate_gradients[hidden_size + k] = dz;
+            gate_gradients[2 * hidden_size + k] = dn;
+            hidden_gate_gradients[k] = dr;
+            hidden_gate_gradients[hidden_size + k] = dz;
+            hidden_gate_gradients[2 * hidden_size + k] = dn * r_gate[k];
+            hidden_gradient[k] = dh * z_gate[k];
+        }
+        return gate_gradients;
+    }
+
 private:
     /**
      * \brief Sum of multiplication between the kernel and the source matrix
@@ -72,6 +72,7 @@ const std::vector<NumType>& DropoutLayer::training_forward(
 const std::vector<NumType>& DropoutLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     // Input size is equal to the output size.
     DLMath::arr_mul(_input_gradients.data(), gradients.data(),
                     _scale, input_size());
@@ -70,7 +70,8 @@ public:
         const std::vector<NumType>& inputs) override
     {
         _last_input = inputs.data();
-        return FeedforwardLayer::forward(inputs);
+        _output_activations = inputs;
+        return FeedforwardLayer::forward(_output_activations);
     }
 
     /**
@@ -85,6 +86,12 @@ public:
     const std::vector<NumType>& training_forward(
         const std::vector<NumType>& inputs) override;
 
+    /**
+     * \brief The training forward draws a new dropout mask at each call.
+     * \return bool False.
+     */
+    [[nodiscard]] bool recomputable() const override { return false; }
+
     /**
      * \brief The gradient data should have size _output_size.
      * Compute dJ/dz = dJ/dg(z) * dg(z)/dz
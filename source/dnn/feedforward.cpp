@@ -36,7 +36,6 @@ FeedforwardLayer::FeedforwardLayer(
     , _input_gradients{}
 {
     _output_activations.resize(output_shape.size());
-    _input_gradients.resize(input_shape.size());
 }
 
 Json FeedforwardLayer::dump() const
@@ -48,13 +47,23 @@ void FeedforwardLayer::load(const Json& in)
 {
     Layer::load(in);
     _output_activations.resize(output_size());
-    _input_gradients.resize(input_size());
+    if (_gradients_allocated) _resize_gradients();
 }
 
 void FeedforwardLayer::_set_input_shape(LayerShape input_shape)
 {
     Layer::_set_input_shape(input_shape);
-    _input_gradients.resize(input_shape.size());
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void FeedforwardLayer::_resize_gradients()
+{
+    _input_gradients.resize(input_size());
+}
+
+void FeedforwardLayer::_free_gradients()
+{
+    std::vector<NumType>().swap(_input_gradients);
 }
 
 } // namespace EdgeLearning
@@ -52,6 +52,7 @@ public:
 
     const std::vector<NumType>& last_input_gradient() override
     {
+        _allocate_gradients();
         return _input_gradients;
     }
 
@@ -65,6 +66,22 @@ public:
         return _output_activations;
     }
 
+    /**
+     * \brief A feedforward layer has no state between calls.
+     * \return bool True.
+     */
+    [[nodiscard]] bool recomputable() const override { return true; }
+
+    void release_output() override
+    {
+        std::vector<NumType>().swap(_output_activations);
+    }
+
+    void restore_output() override
+    {
+        _output_activations.resize(_shared_fields->output_shape().size());
+    }
+
     /**
      * \brief Save the layer infos to disk.
      * \return Json Layer dump.
@@ -78,6 +95,8 @@ public:
     void load(const Json& in) override;
 
 protected:
+    friend class FusedLayer;
+
     /**
      * \brief Setter of input_shape class field.
      * \param input_shape DLMath::Shape3d Shape param used to take the size and
@@ -86,11 +105,15 @@ protected:
      */
     virtual void _set_input_shape(LayerShape input_shape) override;
 
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
     /// \brief Activations of the layer. Size: _output_size.
     std::vector<NumType> _output_activations;
 
     /**
-     * \brief Input gradients of the layer. Size: _input_size.
+     * \brief Input gradients of the layer. Size: _input_size, allocated at
+     * the first training use.
      * This buffer is used to store temporary gradients used in a **singe**
      * backpropagation pass. Note that this does not accumulate like the weight
      * and bias gradients do.
@@ -0,0 +1,199 @@
+/***************************************************************************
+ *            dnn/fused.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "fused.hpp"
+
+#include "dlmath.hpp"
+
+#include <stdexcept>
+
+
+namespace EdgeLearning {
+
+const std::string FusedLayer::TYPE = "Fused";
+
+FusedLayer::FusedLayer(std::string name, Layer::SharedPtr layer,
+                       Activation activation)
+    : FeedforwardLayer(
+        layer ? layer->input_shape().shape() : DLMath::Shape3d{0, 0, 0},
+        layer ? layer->output_shape().shape() : DLMath::Shape3d{0, 0, 0},
+        std::move(name), "fused_layer_")
+    , _layer{std::move(layer)}
+    , _activation{activation}
+    , _activation_gradients{}
+{
+    if (_layer && !std::dynamic_pointer_cast<FeedforwardLayer>(_layer))
+    {
+        throw std::runtime_error(
+            "FusedLayer error: the fused layer must be feedforward");
+    }
+    // The activations are written in the output of the wrapped layer.
+    std::vector<NumType>().swap(_output_activations);
+}
+
+FusedLayer::FusedLayer(const FusedLayer& obj)
+    : FeedforwardLayer(obj)
+    , _layer{obj._layer ? obj._layer->clone() : nullptr}
+    , _activation{obj._activation}
+    , _activation_gradients{obj._activation_gradients}
+{
+    std::vector<NumType>().swap(_output_activations);
+}
+
+void FusedLayer::init(InitializationFunction init,
+                      ProbabilityDensityFunction pdf,
+                      RneType rne)
+{
+    _layer->init(init, pdf, rne);
+}
+
+const std::vector<NumType>& FusedLayer::forward(
+    const std::vector<NumType>& inputs)
+{
+    _layer->forward(inputs);
+    return _activate();
+}
+
+const std::vector<NumType>& FusedLayer::training_forward(
+    const std::vector<NumType>& inputs)
+{
+    Layer::training_forward(inputs);
+    _layer->training_forward(inputs);
+    return _activate();
+}
+
+const std::vector<NumType>& FusedLayer::backward(
+    const std::vector<NumType>& gradients)
+{
+    _allocate_gradients();
+    const auto& activations = _layer_output();
+    SizeType size = _activation_gradients.size();
+    // Calculate dg(z)/dz from the activations.
+    switch (_activation)
+    {
+        case Activation::TanH:
+        {
+            DLMath::tanh_1_opt<NumType>(_activation_gradients.data(),
+                                        activations.data(), size);
+            break;
+        }
+        case Activation::Sigmoid:
+        {
+            DLMath::sigmoid_1_opt<NumType>(_activation_gradients.data(),
+                                           activations.data(), size);
+            break;
+        }
+        case Activation::ReLU:
+        default:
+        {
+            DLMath::relu_1<NumType>(_activation_gradients.data(),
+                                    activations.data(), size);
+            break;
+        }
+    }
+    // Calculate dJ/dz = dJ/dg(z) * dg(z)/dz.
+    DLMath::arr_mul(_activation_gradients.data(), _activation_gradients.data(),
+                    gradients.data(), size);
+    return _layer->backward(_activation_gradients);
+}
+
+void FusedLayer::print() const
+{
+    std::cout << _shared_fields->name() << std::endl;
+    _layer->print();
+}
+
+Json FusedLayer::dump() const
+{
+    Json out = FeedforwardLayer::dump();
+
+    Json others;
+    others["activation"] = static_cast<int>(_activation);
+    others["layer"] = _layer->dump();
+    out[dump_fields.at(DumpFields::OTHERS)] = others;
+    return out;
+}
+
+void FusedLayer::load(const Json& in)
+{
+    FeedforwardLayer::load(in);
+
+    const auto& others = in.at(dump_fields.at(DumpFields::OTHERS));
+    _activation = static_cast<Activation>(others.at("activation").as<int>());
+    if (!_layer)
+    {
+        throw std::runtime_error("FusedLayer load error: no layer to load");
+    }
+    _layer->load(others.at("layer"));
+    std::vector<NumType>().swap(_output_activations);
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void FusedLayer::_resize_gradients()
+{
+    FeedforwardLayer::_resize_gradients();
+    _activation_gradients.resize(output_size());
+}
+
+void FusedLayer::_free_gradients()
+{
+    FeedforwardLayer::_free_gradients();
+    std::vector<NumType>().swap(_activation_gradients);
+    if (_layer) _layer->free_gradients();
+}
+
+const std::vector<NumType>& FusedLayer::_activate()
+{
+    auto& z = _layer_output();
+    SizeType size = z.size();
+    // The element-wise activations read and write the same position.
+    switch (_activation)
+    {
+        case Activation::TanH:
+        {
+            DLMath::tanh<NumType>(z.data(), z.data(), size);
+            break;
+        }
+        case Activation::Sigmoid:
+        {
+            DLMath::sigmoid<NumType>(z.data(), z.data(), size);
+            break;
+        }
+        case Activation::ReLU:
+        default:
+        {
+            DLMath::relu<NumType>(z.data(), z.data(), size);
+            break;
+        }
+    }
+    return z;
+}
+
+std::vector<NumType>& FusedLayer::_layer_output()
+{
+    return std::static_pointer_cast<FeedforwardLayer>(_layer)
+        ->_output_activations;
+}
+
+} // namespace EdgeLearning
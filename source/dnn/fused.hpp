@@ -0,0 +1,186 @@
+/***************************************************************************
+ *            dnn/fused.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/fused.hpp
+ *  \brief Layer fused with its activation.
+ */
+
+#ifndef EDGE_LEARNING_DNN_FUSED_HPP
+#define EDGE_LEARNING_DNN_FUSED_HPP
+
+#include "feedforward.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief A parametric layer (Dense or Convolutional) fused with the
+ * activation that follows it. The activation is applied in place on the
+ * output buffer of the wrapped layer, saving a layer dispatch, an arc of the
+ * graph and the activation buffer. The parameters and the output are the ones
+ * of the wrapped layer.
+ */
+class FusedLayer : public FeedforwardLayer
+{
+public:
+    static const std::string TYPE;
+
+    enum class Activation : int
+    {
+        ReLU,
+        TanH,
+        Sigmoid
+    };
+
+    /**
+     * \brief Fuse a layer with an activation.
+     * \param name       std::string The name of the fused layer.
+     * \param layer      Layer::SharedPtr The feedforward layer producing
+     *                   the pre-activations.
+     * \param activation Activation The activation applied to the output.
+     */
+    FusedLayer(std::string name = std::string(),
+               Layer::SharedPtr layer = nullptr,
+               Activation activation = Activation::ReLU);
+
+    /**
+     * \brief Copy constructor: the wrapped layer is cloned.
+     * \param obj const FusedLayer& The layer to copy.
+     */
+    FusedLayer(const FusedLayer& obj);
+
+    [[nodiscard]] inline const std::string& type() const override
+    { return TYPE; }
+
+    void init(
+        InitializationFunction init = InitializationFunction::KAIMING,
+        ProbabilityDensityFunction pdf = ProbabilityDensityFunction::NORMAL,
+        RneType rne = RneType(std::random_device{}()))
+        override;
+
+    const std::vector<NumType>& forward(
+        const std::vector<NumType>& inputs) override;
+
+    const std::vector<NumType>& training_forward(
+        const std::vector<NumType>& inputs) override;
+
+    const std::vector<NumType>& backward(
+        const std::vector<NumType>& gradients) override;
+
+    const std::vector<NumType>& last_input_gradient() override
+    {
+        return _layer->last_input_gradient();
+    }
+
+    /**
+     * \brief The activations live in the output buffer of the wrapped layer.
+     * \return The reference to the wrapped layer output.
+     */
+    const std::vector<NumType>& last_output() override
+    {
+        return _layer->last_output();
+    }
+
+    void release_output() override { _layer->release_output(); }
+    void restore_output() override { _layer->restore_output(); }
+
+    [[nodiscard]] SizeType param_count() const noexcept override
+    {
+        return _layer->param_count();
+    }
+
+    NumType& param(SizeType index) override { return _layer->param(index); }
+    NumType& gradient(SizeType index) override
+    {
+        return _layer->gradient(index);
+    }
+    void map_params(NumType* data,
+                    const std::shared_ptr<const void>& owner) override
+    {
+        _layer->map_params(data, owner);
+    }
+
+    [[nodiscard]] SharedPtr clone() const override
+    {
+        return std::make_shared<FusedLayer>(*this);
+    }
+
+    void print() const override;
+
+    /**
+     * \brief Getter of the wrapped layer.
+     * \return Layer::SharedPtr The layer producing the pre-activations.
+     */
+    [[nodiscard]] Layer::SharedPtr layer() const { return _layer; }
+
+    /**
+     * \brief Getter of the fused activation.
+     * \return Activation The activation.
+     */
+    [[nodiscard]] Activation activation() const { return _activation; }
+
+    /**
+     * \brief Save the layer infos to disk.
+     * \return Json Layer dump.
+     */
+    Json dump() const override;
+
+    /**
+     * \brief Load the layer infos from disk.
+     * \param in const Json& Json to read.
+     */
+    void load(const Json& in) override;
+
+protected:
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
+private:
+    /**
+     * \brief Apply the activation in place on the pre-activations left by
+     * the wrapped layer in its output buffer.
+     * \return const std::vector<NumType>& The activations.
+     */
+    const std::vector<NumType>& _activate();
+
+    /**
+     * \brief The output buffer of the wrapped layer.
+     * \return std::vector<NumType>& The pre-activations after the wrapped
+     * layer forward, the activations after _activate().
+     */
+    std::vector<NumType>& _layer_output();
+
+    Layer::SharedPtr _layer;
+    Activation _activation;
+
+    /// \brief Gradients of the pre-activations. Size: output_size().
+    std::vector<NumType> _activation_gradients;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_FUSED_HPP
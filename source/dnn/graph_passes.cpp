@@ -0,0 +1,330 @@
+/***************************************************************************
+ *            dnn/graph_passes.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "graph_passes.hpp"
+
+#include "dense.hpp"
+#include "convolutional.hpp"
+#include "activation.hpp"
+#include "dropout.hpp"
+#include "fused.hpp"
+#include "dlmath.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+
+namespace EdgeLearning {
+
+namespace {
+
+void replace_idx(std::vector<SizeType>& v, SizeType from, SizeType to)
+{
+    auto it = std::find(v.begin(), v.end(), from);
+    if (it == v.end()) return;
+    if (std::find(v.begin(), v.end(), to) != v.end())
+    {
+        v.erase(it);
+    }
+    else
+    {
+        *it = to;
+    }
+}
+
+void erase_idx(std::vector<SizeType>& v, SizeType idx)
+{
+    v.erase(std::remove(v.begin(), v.end(), idx), v.end());
+}
+
+} // namespace
+
+void GraphPasses::Report::print() const
+{
+    std::cout << "Layers: " << layers_before << " -> " << layers_after
+        << std::endl;
+    for (const auto& name: removed)
+        std::cout << "\tremoved: " << name << std::endl;
+    for (const auto& name: merged)
+        std::cout << "\tmerged: " << name << std::endl;
+    for (const auto& name: fused)
+        std::cout << "\tfused: " << name << std::endl;
+}
+
+GraphPasses::GraphPasses(std::vector<Pass> passes)
+    : _passes{std::move(passes)}
+    , _nodes{}
+    , _report{}
+{ }
+
+Model GraphPasses::run(const Model& model)
+{
+    const auto& graph = model._state.graph;
+    _report = Report{};
+    _nodes.clear();
+
+    // Forward graph without the loss layers.
+    std::vector<SizeType> node_idx(graph.size(), graph.size());
+    for (auto l_idx: graph.forward_layers_idx())
+    {
+        node_idx[l_idx] = _nodes.size();
+        _nodes.push_back({graph.layers()[l_idx]->clone(), {}, {}, true});
+    }
+    for (auto l_idx: graph.forward_layers_idx())
+    {
+        auto& node = _nodes[node_idx[l_idx]];
+        for (auto s_idx: graph.forward(l_idx))
+        {
+            if (node_idx[s_idx] == graph.size()) continue;
+            node.successors.push_back(node_idx[s_idx]);
+            _nodes[node_idx[s_idx]].predecessors.push_back(node_idx[l_idx]);
+        }
+    }
+    _report.layers_before = _nodes.size();
+
+    for (auto pass: _passes)
+    {
+        switch (pass)
+        {
+            case Pass::REMOVE_IDENTITY:
+            {
+                _remove([](const Layer& l) {
+                    return l.is_type<LinearLayer>();
+                });
+                break;
+            }
+            case Pass::REMOVE_DROPOUT:
+            {
+                _remove([](const Layer& l) {
+                    return l.is_type<DropoutLayer>();
+                });
+                break;
+            }
+            case Pass::MERGE_DENSE:
+            {
+                _merge_dense();
+                break;
+            }
+            case Pass::FUSE_ACTIVATION:
+            default:
+            {
+                _fuse_activation();
+                break;
+            }
+        }
+    }
+
+    Model ret{model.name()};
+    for (const auto& node: _nodes)
+    {
+        if (!node.alive) continue;
+        ret._state.graph.add_node(node.layer);
+        ++_report.layers_after;
+    }
+    ret._state.invalidate();
+    for (const auto& node: _nodes)
+    {
+        if (!node.alive) continue;
+        for (auto s_idx: node.successors)
+        {
+            ret.create_edge(node.layer, _nodes[s_idx].layer);
+        }
+    }
+    _nodes.clear();
+    return ret;
+}
+
+template <typename Predicate>
+void GraphPasses::_remove(Predicate is_pass_through)
+{
+    for (SizeType idx = 0; idx < _nodes.size(); ++idx)
+    {
+        auto& node = _nodes[idx];
+        if (!node.alive || !is_pass_through(*node.layer)
+            || node.predecessors.size() > 1 || node.successors.size() > 1)
+        {
+            continue;
+        }
+
+        if (node.predecessors.size() == 1 && node.successors.size() == 1)
+        {
+            auto p_idx = node.predecessors.front();
+            auto s_idx = node.successors.front();
+            replace_idx(_nodes[p_idx].successors, idx, s_idx);
+            replace_idx(_nodes[s_idx].predecessors, idx, p_idx);
+        }
+        else if (node.predecessors.size() == 1)
+        {
+            // Output layer: the predecessor becomes the output.
+            auto p_idx = node.predecessors.front();
+            if (_nodes[p_idx].successors.size() != 1) continue;
+            erase_idx(_nodes[p_idx].successors, idx);
+        }
+        else if (node.successors.size() == 1)
+        {
+            // Input layer: the successor becomes the input.
+            auto s_idx = node.successors.front();
+            if (_nodes[s_idx].predecessors.size() != 1) continue;
+            erase_idx(_nodes[s_idx].predecessors, idx);
+        }
+        else
+        {
+            // The only layer of the model.
+            continue;
+        }
+
+        node.alive = false;
+        node.predecessors.clear();
+        node.successors.clear();
+        _report.removed.push_back(node.layer->name());
+    }
+}
+
+void GraphPasses::_merge_dense()
+{
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (SizeType a_idx = 0; a_idx < _nodes.size(); ++a_idx)
+        {
+            auto& a = _nodes[a_idx];
+            if (!a.alive || !a.layer->is_type<DenseLayer>()
+                || a.successors.size() != 1)
+            {
+                continue;
+            }
+            auto b_idx = a.successors.front();
+            auto& b = _nodes[b_idx];
+            if (!b.layer->is_type<DenseLayer>()
+                || b.predecessors.size() != 1)
+            {
+                continue;
+            }
+
+            // W = Wb * Wa and b = Wb * ba + bb: merge only if the merged
+            // product is not more expensive than the two products.
+            auto in_size = a.layer->input_size();
+            auto hidden_size = a.layer->output_size();
+            auto out_size = b.layer->output_size();
+            if (out_size * in_size > hidden_size * (in_size + out_size))
+            {
+                continue;
+            }
+
+            std::vector<NumType> wa(hidden_size * in_size);
+            std::vector<NumType> ba(hidden_size);
+            std::vector<NumType> wb(out_size * hidden_size);
+            std::vector<NumType> bb(out_size);
+            for (SizeType i = 0; i < wa.size(); ++i)
+                wa[i] = a.layer->param(i);
+            for (SizeType i = 0; i < ba.size(); ++i)
+                ba[i] = a.layer->param(wa.size() + i);
+            for (SizeType i = 0; i < wb.size(); ++i)
+                wb[i] = b.layer->param(i);
+            for (SizeType i = 0; i < bb.size(); ++i)
+                bb[i] = b.layer->param(wb.size() + i);
+
+            std::vector<NumType> w(out_size * in_size);
+            std::vector<NumType> bias(out_size);
+            DLMath::matmat_mul(w.data(), wb.data(), wa.data(),
+                               out_size, hidden_size, in_size);
+            DLMath::matarr_mul(bias.data(), wb.data(), ba.data(),
+                               out_size, hidden_size);
+            DLMath::arr_sum(bias.data(), bias.data(), bb.data(), out_size);
+
+            auto layer = std::make_shared<DenseLayer>(
+                a.layer->name() + "_" + b.layer->name(), in_size, out_size);
+            for (SizeType i = 0; i < w.size(); ++i)
+                layer->param(i) = w[i];
+            for (SizeType i = 0; i < bias.size(); ++i)
+                layer->param(w.size() + i) = bias[i];
+
+            _report.merged.push_back(
+                a.layer->name() + " + " + b.layer->name());
+            _replace_chain(a_idx, b_idx, layer);
+            merged = true;
+        }
+    }
+}
+
+void GraphPasses::_fuse_activation()
+{
+    for (SizeType l_idx = 0; l_idx < _nodes.size(); ++l_idx)
+    {
+        auto& node = _nodes[l_idx];
+        if (!node.alive || node.successors.size() != 1
+            || !(node.layer->is_type<DenseLayer>()
+                 || node.layer->is_type<ConvolutionalLayer>()))
+        {
+            continue;
+        }
+        auto a_idx = node.successors.front();
+        const auto& activation = _nodes[a_idx];
+        if (activation.predecessors.size() != 1) continue;
+
+        FusedLayer::Activation fused_activation;
+        if (activation.layer->is_type<ReluLayer>())
+        {
+            fused_activation = FusedLayer::Activation::ReLU;
+        }
+        else if (activation.layer->is_type<TanhLayer>())
+        {
+            fused_activation = FusedLayer::Activation::TanH;
+        }
+        else if (activation.layer->is_type<SigmoidLayer>())
+        {
+            fused_activation = FusedLayer::Activation::Sigmoid;
+        }
+        else
+        {
+            continue;
+        }
+
+        auto layer = std::make_shared<FusedLayer>(
+            node.layer->name() + "_" + activation.layer->name(),
+            node.layer, fused_activation);
+        _report.fused.push_back(
+            node.layer->name() + " + " + activation.layer->name());
+        _replace_chain(l_idx, a_idx, layer);
+    }
+}
+
+void GraphPasses::_replace_chain(SizeType first, SizeType second,
+                                 Layer::SharedPtr layer)
+{
+    auto& f = _nodes[first];
+    auto& s = _nodes[second];
+    f.layer = std::move(layer);
+    f.successors = s.successors;
+    for (auto s_idx: f.successors)
+    {
+        replace_idx(_nodes[s_idx].predecessors, second, first);
+    }
+    s.alive = false;
+    s.predecessors.clear();
+    s.successors.clear();
+}
+
+} // namespace EdgeLearning
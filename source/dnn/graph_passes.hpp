@@ -0,0 +1,133 @@
+/***************************************************************************
+ *            dnn/graph_passes.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/graph_passes.hpp
+ *  \brief Optimization passes of the model graph for inference.
+ */
+
+#ifndef EDGE_LEARNING_DNN_GRAPH_PASSES_HPP
+#define EDGE_LEARNING_DNN_GRAPH_PASSES_HPP
+
+#include "model.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Pipeline of graph passes that compiles a trained model into an
+ * equivalent inference-only model.
+ *
+ * The passes work on the forward graph of the model, the loss layers are
+ * dropped. The layers of the compiled model are clones of the original ones,
+ * so they share the parameters, except for the merged Dense layers whose
+ * parameters are computed once: compile the model again after training.
+ */
+class GraphPasses
+{
+public:
+    enum class Pass
+    {
+        REMOVE_IDENTITY,  ///< \brief Remove the Linear activation layers.
+        REMOVE_DROPOUT,   ///< \brief Remove the Dropout layers.
+        MERGE_DENSE,      ///< \brief Merge consecutive Dense layers.
+        FUSE_ACTIVATION,  ///< \brief Fuse Dense/Conv with ReLU/Tanh/Sigmoid.
+    };
+
+    /**
+     * \brief Layers removed, merged and fused by the passes.
+     */
+    struct Report
+    {
+        SizeType layers_before = 0;       ///< \brief Forward layers before.
+        SizeType layers_after = 0;        ///< \brief Forward layers after.
+        std::vector<std::string> removed; ///< \brief Removed layers.
+        std::vector<std::string> merged;  ///< \brief Merged layer pairs.
+        std::vector<std::string> fused;   ///< \brief Fused layer pairs.
+
+        /**
+         * \brief Print the report.
+         */
+        void print() const;
+    };
+
+    /**
+     * \brief Construct the pipeline.
+     * \param passes std::vector<Pass> The passes in order of execution.
+     */
+    GraphPasses(std::vector<Pass> passes = {
+        Pass::REMOVE_IDENTITY, Pass::REMOVE_DROPOUT,
+        Pass::MERGE_DENSE, Pass::FUSE_ACTIVATION});
+
+    /**
+     * \brief Run the passes on a model.
+     * \param model const Model& The model to compile.
+     * \return Model The inference model.
+     */
+    Model run(const Model& model);
+
+    /**
+     * \brief Getter of the report of the last run.
+     * \return const Report& The report.
+     */
+    [[nodiscard]] const Report& report() const { return _report; }
+
+private:
+    /**
+     * \brief Node of the forward graph under optimization.
+     */
+    struct Node
+    {
+        Layer::SharedPtr layer;
+        std::vector<SizeType> predecessors;
+        std::vector<SizeType> successors;
+        bool alive;
+    };
+
+    /**
+     * \brief Remove the pass-through layers that satisfy a predicate.
+     */
+    template <typename Predicate>
+    void _remove(Predicate is_pass_through);
+
+    void _merge_dense();
+    void _fuse_activation();
+
+    /**
+     * \brief Replace the chain of nodes first -> second with a single layer
+     * placed in the slot of first.
+     */
+    void _replace_chain(SizeType first, SizeType second,
+                        Layer::SharedPtr layer);
+
+    std::vector<Pass> _passes;
+    std::vector<Node> _nodes;
+    Report _report;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_GRAPH_PASSES_HPP
@@ -0,0 +1,516 @@
+/***************************************************************************
+ *            dnn/gru.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "gru.hpp"
+
+#include "dlmath.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+namespace EdgeLearning {
+
+const std::string GruLayer::TYPE = "Gru";
+
+GruLayer::GruLayer(std::string name,
+    SizeType input_size, SizeType output_size, SizeType hidden_size,
+    SizeType time_steps)
+    : Layer(std::move(name),
+            input_size,
+            output_size,
+            "gru_layer_")
+    , _hidden_size{hidden_size}
+    , _time_steps{time_steps}
+{
+    _resize();
+}
+
+void GruLayer::init(InitializationFunction init,
+                     ProbabilityDensityFunction pdf,
+                     RneType rne)
+{
+    auto dist_i = DLMath::initialization_pdf<NumType>(
+        init, pdf, _shared_fields->input_size());
+    auto dist_h = DLMath::initialization_pdf<NumType>(init, pdf, _hidden_size);
+
+    for (NumType& w: _weights_i_to_g)
+    {
+        w = dist_i(rne);
+    }
+    for (NumType& w: _weights_h_to_g)
+    {
+        w = dist_h(rne);
+    }
+    for (NumType& w: _weights_h_to_o)
+    {
+        w = dist_h(rne);
+    }
+
+    for (NumType& b: _biases_i_to_g)
+    {
+        b = 0.01;
+    }
+    for (NumType& b: _biases_h_to_g)
+    {
+        b = 0.01;
+    }
+    for (NumType& b: _biases_to_o)
+    {
+        b = 0.01;
+    }
+
+    reset_hidden_state();
+}
+
+const std::vector<NumType>& GruLayer::forward(
+    const std::vector<NumType>& inputs)
+{
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    const auto gates_size = GATES * _hidden_size;
+    if (inputs.size() < input_size * _time_steps)
+    {
+        throw std::runtime_error("forward error: input size too small");
+    }
+    if (_time_steps == 0)
+    {
+        return Layer::forward(_output_activations);
+    }
+
+    // Start the sequence from the hidden state carried by the last call.
+    const auto last = _time_steps * _hidden_size;
+    std::copy(_hidden_state.begin() + static_cast<std::int64_t>(last),
+              _hidden_state.end(), _hidden_state.begin());
+
+    // Input to gates products of the whole sequence. G = X * W_ig^T
+    DLMath::matmat_mul_t_no_check<NumType>(
+        _gates.data(), inputs.data(), _weights_i_to_g.data(),
+        _time_steps, input_size, gates_size);
+
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
+        // Hidden to gates product of all the gates. W_hg * h(t)
+        DLMath::matarr_mul_no_check<NumType>(
+            _hidden_gates.data() + t * gates_size, _weights_h_to_g.data(),
+            _hidden_state.data() + t * _hidden_size,
+            gates_size, _hidden_size);
+
+        DLMath::gru_cell<NumType>(
+            _gates.data() + t * gates_size,
+            _hidden_gates.data() + t * gates_size,
+            _biases_i_to_g.data(), _biases_h_to_g.data(),
+            _hidden_state.data() + t * _hidden_size,
+            _hidden_state.data() + (t + 1) * _hidden_size,
+            _hidden_size);
+    }
+
+    // a(t) = W_ho * h(t + 1) + b_o
+    DLMath::matmat_mul_t_no_check<NumType>(
+        _output_activations.data(), _hidden_state.data() + _hidden_size,
+        _weights_h_to_o.data(), _time_steps, _hidden_size, output_size);
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
+        DLMath::arr_sum<NumType>(
+            _output_activations.data() + t * output_size,
+            _output_activations.data() + t * output_size,
+            _biases_to_o.data(), output_size);
+    }
+
+    return Layer::forward(_output_activations);
+}
+
+const std::vector<NumType>& GruLayer::backward(
+    const std::vector<NumType>& gradients)
+{
+    _allocate_gradients();
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    const auto gates_size = GATES * _hidden_size;
+    if (gradients.size() < output_size * _time_steps)
+    {
+        throw std::runtime_error("backward error: gradients size too small");
+    }
+    if (_time_steps == 0)
+    {
+        return Layer::backward(_input_gradients);
+    }
+
+    // Output projection gradients of all the time steps.
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
+        DLMath::arr_sum<NumType>(
+            _biases_to_o_gradients.data(), _biases_to_o_gradients.data(),
+            gradients.data() + t * output_size, output_size);
+    }
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_h_to_o_gradients.data(), gradients.data(),
+        _hidden_state.data() + _hidden_size,
+        _time_steps, output_size, _hidden_size);
+    DLMath::matmat_mul_no_check<NumType>(
+        _hidden_gradients.data(), gradients.data(), _weights_h_to_o.data(),
+        _time_steps, output_size, _hidden_size);
+
+    // Loop the time steps in reverse.
+    std::fill(_hidden_state_gradient.begin(), _hidden_state_gradient.end(),
+              NumType{0.0});
+    for (SizeType t = _time_steps; t > 0; --t)
+    {
+        NumType* curr_hidden_gradients =
+            _hidden_gradients.data() + (t - 1) * _hidden_size;
+        NumType* curr_hidden_gate_gradients =
+            _hidden_gate_gradients.data() + (t - 1) * gates_size;
+
+        DLMath::arr_sum<NumType>(
+            curr_hidden_gradients, curr_hidden_gradients,
+            _hidden_state_gradient.data(), _hidden_size);
+
+        DLMath::gru_cell_1<NumType>(
+            _gate_gradients.data() + (t - 1) * gates_size,
+            curr_hidden_gate_gradients, curr_hidden_gradients,
+            _gates.data() + (t - 1) * gates_size,
+            _hidden_gates.data() + (t - 1) * gates_size,
+            _hidden_state.data() + (t - 1) * _hidden_size,
+            _hidden_size);
+
+        // Hidden state gradient for the previous time step.
+        // dh(t) = z * dh(t+1) + W_hg^T * dg_h
+        DLMath::matmat_mul_no_check<NumType>(
+            _hidden_state_gradient.data(), curr_hidden_gate_gradients,
+            _weights_h_to_g.data(), 1, gates_size, _hidden_size);
+        DLMath::arr_sum<NumType>(
+            _hidden_state_gradient.data(), _hidden_state_gradient.data(),
+            curr_hidden_gradients, _hidden_size);
+    }
+
+    // Gate parameters gradients of all the time steps.
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
+        DLMath::arr_sum<NumType>(
+            _biases_i_to_g_gradients.data(), _biases_i_to_g_gradients.data(),
+            _gate_gradients.data() + t * gates_size, gates_size);
+        DLMath::arr_sum<NumType>(
+            _biases_h_to_g_gradients.data(), _biases_h_to_g_gradients.data(),
+            _hidden_gate_gradients.data() + t * gates_size, gates_size);
+    }
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_i_to_g_gradients.data(), _gate_gradients.data(),
+        _last_input, _time_steps, gates_size, input_size);
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_h_to_g_gradients.data(), _hidden_gate_gradients.data(),
+        _hidden_state.data(), _time_steps, gates_size, _hidden_size);
+
+    // Input gradient of all the time steps.
+    DLMath::matmat_mul_no_check<NumType>(
+        _input_gradients.data(), _gate_gradients.data(),
+        _weights_i_to_g.data(), _time_steps, gates_size, input_size);
+
+    return Layer::backward(_input_gradients);
+}
+
+const std::vector<NumType>& GruLayer::last_input_gradient()
+{
+    _allocate_gradients();
+    return _input_gradients;
+}
+
+const std::vector<NumType>& GruLayer::last_output()
+{
+    return _output_activations;
+}
+
+NumType& GruLayer::param(SizeType index)
+{
+    if (index >= param_count())
+    {
+        throw std::runtime_error("index overflow");
+    }
+    SizeType acc_size = 0;
+    if (index < _weights_i_to_g.size())
+    {
+        return _weights_i_to_g[index];
+    }
+    acc_size += _weights_i_to_g.size();
+    if (index < acc_size + _weights_h_to_g.size())
+    {
+        return _weights_h_to_g[index - acc_size];
+    }
+    acc_size += _weights_h_to_g.size();
+    if (index < acc_size + _biases_i_to_g.size())
+    {
+        return _biases_i_to_g[index - acc_size];
+    }
+    acc_size += _biases_i_to_g.size();
+    if (index < acc_size + _biases_h_to_g.size())
+    {
+        return _biases_h_to_g[index - acc_size];
+    }
+    acc_size += _biases_h_to_g.size();
+    if (index < acc_size + _weights_h_to_o.size())
+    {
+        return _weights_h_to_o[index - acc_size];
+    }
+    acc_size += _weights_h_to_o.size();
+    return _biases_to_o[index - acc_size];
+}
+
+NumType& GruLayer::gradient(SizeType index)
+{
+    _allocate_gradients();
+    if (index >= param_count())
+    {
+        throw std::runtime_error("index overflow");
+    }
+    SizeType acc_size = 0;
+    if (index < _weights_i_to_g_gradients.size())
+    {
+        return _weights_i_to_g_gradients[index];
+    }
+    acc_size += _weights_i_to_g_gradients.size();
+    if (index < acc_size + _weights_h_to_g_gradients.size())
+    {
+        return _weights_h_to_g_gradients[index - acc_size];
+    }
+    acc_size += _weights_h_to_g_gradients.size();
+    if (index < acc_size + _biases_i_to_g_gradients.size())
+    {
+        return _biases_i_to_g_gradients[index - acc_size];
+    }
+    acc_size += _biases_i_to_g_gradients.size();
+    if (index < acc_size + _biases_h_to_g_gradients.size())
+    {
+        return _biases_h_to_g_gradients[index - acc_size];
+    }
+    acc_size += _biases_h_to_g_gradients.size();
+    if (index < acc_size + _weights_h_to_o_gradients.size())
+    {
+        return _weights_h_to_o_gradients[index - acc_size];
+    }
+    acc_size += _weights_h_to_o_gradients.size();
+    return _biases_to_o_gradients[index - acc_size];
+}
+
+void GruLayer::print() const
+{
+    const auto gates_size = GATES * _hidden_size;
+    std::cout << _shared_fields->name() << std::endl;
+    _matrix_print("Weights input to gates", _weights_i_to_g,
+                  gates_size, _shared_fields->input_size());
+    _matrix_print("Weights hidden to gates", _weights_h_to_g,
+                  gates_size, _hidden_size);
+    _matrix_print("Weights hidden to output", _weights_h_to_o,
+                  _shared_fields->output_size(), _hidden_size);
+    _matrix_print("Biases input to gates", _biases_i_to_g, gates_size, 1);
+    _matrix_print("Biases hidden to gates", _biases_h_to_g, gates_size, 1);
+    _matrix_print("Biases to output", _biases_to_o,
+                  _shared_fields->output_size(), 1);
+    std::cout << std::endl;
+}
+
+void GruLayer::time_steps(SizeType time_steps)
+{
+    // Keep the hidden state carried to the next sequence.
+    const auto last = static_cast<std::int64_t>(_time_steps * _hidden_size);
+    std::vector<NumType> hidden_state(_hidden_state.begin() + last,
+                                      _hidden_state.end());
+    _time_steps = time_steps;
+    _resize();
+    this->hidden_state(hidden_state);
+}
+
+Json GruLayer::dump() const
+{
+    const auto gates_size = GATES * _hidden_size;
+    Json out = Layer::dump();
+
+    Json weights;
+    weights.append(_matrix_dump(_weights_i_to_g, gates_size,
+                                _shared_fields->input_size()));
+    weights.append(_matrix_dump(_weights_h_to_g, gates_size, _hidden_size));
+    weights.append(_matrix_dump(_weights_h_to_o,
+                                _shared_fields->output_size(), _hidden_size));
+
+    Json biases_i_to_g;
+    Json biases_h_to_g;
+    for (SizeType i = 0; i < gates_size; ++i)
+    {
+        biases_i_to_g.append(_biases_i_to_g[i]);
+        biases_h_to_g.append(_biases_h_to_g[i]);
+    }
+    Json biases_to_o;
+    for (SizeType i = 0; i < _shared_fields->output_size(); ++i)
+    {
+        biases_to_o.append(_biases_to_o[i]);
+    }
+    Json biases;
+    biases.append(biases_i_to_g);
+    biases.append(biases_h_to_g);
+    biases.append(biases_to_o);
+
+    out[dump_fields.at(DumpFields::WEIGHTS)] = weights;
+    out[dump_fields.at(DumpFields::BIASES)] = biases;
+    out[dump_fields.at(DumpFields::OTHERS)] = _dump_others();
+    return out;
+}
+
+void GruLayer::load(const Json& in)
+{
+    _load_fields(in);
+
+    const auto gates_size = GATES * _hidden_size;
+    const auto& weights = in.at(dump_fields.at(DumpFields::WEIGHTS));
+    _matrix_load(_weights_i_to_g, weights.at(0),
+                 gates_size, _shared_fields->input_size());
+    _matrix_load(_weights_h_to_g, weights.at(1), gates_size, _hidden_size);
+    _matrix_load(_weights_h_to_o, weights.at(2),
+                 _shared_fields->output_size(), _hidden_size);
+
+    const auto& biases = in.at(dump_fields.at(DumpFields::BIASES));
+    biases.at(0).as_vec(_biases_i_to_g.data(), gates_size);
+    biases.at(1).as_vec(_biases_h_to_g.data(), gates_size);
+    biases.at(2).as_vec(_biases_to_o.data(), _shared_fields->output_size());
+}
+
+void GruLayer::dump_stream(JsonWriter& out) const
+{
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    const auto gates_size = GATES * _hidden_size;
+    out.begin_object();
+    out.members(Layer::dump());
+    out.key(dump_fields.at(DumpFields::OTHERS));
+    out.value(_dump_others());
+    out.key(dump_fields.at(DumpFields::WEIGHTS));
+    out.begin_array();
+    out.tensor(_weights_i_to_g.data(), {gates_size, input_size});
+    out.tensor(_weights_h_to_g.data(), {gates_size, _hidden_size});
+    out.tensor(_weights_h_to_o.data(), {output_size, _hidden_size});
+    out.end_array();
+    out.key(dump_fields.at(DumpFields::BIASES));
+    out.begin_array();
+    out.tensor(_biases_i_to_g.data(), {gates_size});
+    out.tensor(_biases_h_to_g.data(), {gates_size});
+    out.tensor(_biases_to_o.data(), {output_size});
+    out.end_array();
+    out.end_object();
+}
+
+void GruLayer::load_stream(JsonReader& in)
+{
+    _load_stream(in, true,
+        [this](const Json& fields) { _load_fields(fields); },
+        [this](DumpFields field) -> ParamBuffers {
+            if (field == DumpFields::WEIGHTS)
+            {
+                return {{_weights_i_to_g.data(), _weights_i_to_g.size()},
+                        {_weights_h_to_g.data(), _weights_h_to_g.size()},
+                        {_weights_h_to_o.data(), _weights_h_to_o.size()}};
+            }
+            return {{_biases_i_to_g.data(), _biases_i_to_g.size()},
+                    {_biases_h_to_g.data(), _biases_h_to_g.size()},
+                    {_biases_to_o.data(), _biases_to_o.size()}};
+        });
+}
+
+Json GruLayer::_dump_others() const
+{
+    Json others;
+    others["hidden_size"] = _hidden_size;
+    others["time_steps"] = _time_steps;
+    return others;
+}
+
+void GruLayer::_load_fields(const Json& in)
+{
+    Layer::load(in);
+
+    _hidden_size = in.at(dump_fields.at(DumpFields::OTHERS))
+        .at("hidden_size").as<SizeType>();
+    _time_steps = in.at(dump_fields.at(DumpFields::OTHERS))
+        .at("time_steps").as<SizeType>();
+    _resize();
+}
+
+void GruLayer::_set_input_shape(LayerShape input_shape)
+{
+    Layer::_set_input_shape(input_shape);
+    _resize();
+}
+
+void GruLayer::_resize()
+{
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    const auto gates_size = GATES * _hidden_size;
+
+    _weights_i_to_g.resize(gates_size * input_size);
+    _weights_h_to_g.resize(gates_size * _hidden_size);
+    _biases_i_to_g.resize(gates_size);
+    _biases_h_to_g.resize(gates_size);
+    _weights_h_to_o.resize(output_size * _hidden_size);
+    _biases_to_o.resize(output_size);
+
+    _hidden_state.resize(_hidden_size * (_time_steps + 1));
+    _output_activations.resize(output_size * _time_steps);
+
+    _gates.resize(_time_steps * gates_size);
+    _hidden_gates.resize(_time_steps * gates_size);
+
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void GruLayer::_resize_gradients()
+{
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    const auto gates_size = GATES * _hidden_size;
+
+    _weights_i_to_g_gradients.resize(gates_size * input_size);
+    _weights_h_to_g_gradients.resize(gates_size * _hidden_size);
+    _biases_i_to_g_gradients.resize(gates_size);
+    _biases_h_to_g_gradients.resize(gates_size);
+    _weights_h_to_o_gradients.resize(output_size * _hidden_size);
+    _biases_to_o_gradients.resize(output_size);
+    _input_gradients.resize(input_size * _time_steps);
+
+    _gate_gradients.resize(_time_steps * gates_size);
+    _hidden_gate_gradients.resize(_time_steps * gates_size);
+    _hidden_gradients.resize(_time_steps * _hidden_size);
+    _hidden_state_gradient.resize(_hidden_size);
+}
+
+void GruLayer::_free_gradients()
+{
+    for (auto* buffer: {&_weights_i_to_g_gradients, &_weights_h_to_g_gradients,
+                        &_biases_i_to_g_gradients, &_biases_h_to_g_gradients,
+                        &_weights_h_to_o_gradients, &_biases_to_o_gradients,
+                        &_input_gradients, &_gate_gradients,
+                        &_hidden_gate_gradients, &_hidden_gradients,
+                        &_hidden_state_gradient})
+    {
+        std::vector<NumType>().swap(*buffer);
+    }
+}
+
+} // namespace EdgeLearning
@@ -0,0 +1,266 @@
+/***************************************************************************
+ *            dnn/gru.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/gru.hpp
+ *  \brief Gated Recurrent Unit layer.
+ */
+
+#ifndef EDGE_LEARNING_DNN_GRU_HPP
+#define EDGE_LEARNING_DNN_GRU_HPP
+
+#include "layer.hpp"
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief GRU layer with the weights of the 3 gates (reset, update and new)
+ * packed in a single matrix, so that one matrix product per time step
+ * computes all the gates. The gate nonlinearities and the state update are
+ * computed by the fused kernel DLMath::gru_cell. The hidden state of each
+ * time step is projected to the output like in RecurrentLayer.
+ */
+class GruLayer : public Layer
+{
+public:
+    static const std::string TYPE;
+
+    /// \brief Amount of packed gates.
+    static constexpr SizeType GATES = 3;
+
+    GruLayer(std::string name = std::string(),
+        SizeType input_size = 0, SizeType output_size = 0,
+        SizeType hidden_size = 0, SizeType time_steps = 0);
+
+    [[nodiscard]] inline const std::string& type() const override
+    { return TYPE; }
+
+    void init(
+        InitializationFunction init = InitializationFunction::KAIMING,
+        ProbabilityDensityFunction pdf = ProbabilityDensityFunction::NORMAL,
+        RneType rne = RneType(std::random_device{}()))
+        override;
+
+    /**
+     * \brief The input data should have size input_size() * time_steps().
+     * \param inputs
+     */
+    const std::vector<NumType>& forward(
+        const std::vector<NumType>& inputs) override;
+
+    /**
+     * \brief The gradient data should have size output_size() * time_steps().
+     * \param gradients
+     */
+    const std::vector<NumType>& backward(
+        const std::vector<NumType>& gradients) override;
+
+    const std::vector<NumType>& last_input_gradient() override;
+    const std::vector<NumType>& last_output() override;
+
+    /**
+     * \brief Packed weights input to gates and hidden to gates, packed input
+     * and hidden biases, weights and biases hidden to output.
+     * \return SizeType
+     */
+    [[nodiscard]] SizeType param_count() const noexcept override
+    {
+        return GATES * _hidden_size
+                * (_shared_fields->input_size() + _hidden_size + 2UL)
+             + (_hidden_size + 1UL) * _shared_fields->output_size();
+    }
+
+    NumType& param(SizeType index) override;
+    NumType& gradient(SizeType index) override;
+
+    [[nodiscard]] SharedPtr clone() const override
+    {
+        return std::make_shared<GruLayer>(*this);
+    }
+
+    void print() const override;
+
+    void hidden_state(std::vector<NumType> hidden_state)
+    {
+        if (hidden_state.size() > _hidden_size)
+        {
+            throw std::runtime_error("hidden state exceeds the hidden size");
+        }
+        std::copy(hidden_state.begin(), hidden_state.end(),
+                  _hidden_state.data() + _time_steps * _hidden_size);
+    }
+
+    void time_steps(SizeType time_steps);
+
+    [[nodiscard]] SizeType time_steps() const
+    {
+        return _time_steps;
+    }
+
+    [[nodiscard]] SizeType hidden_size() const
+    {
+        return _hidden_size;
+    }
+
+    /**
+     * \brief Reset the hidden state. It is the boundary between two
+     * independent sequences.
+     */
+    void reset_hidden_state()
+    {
+        std::fill(_hidden_state.begin(), _hidden_state.end(), NumType{0.0});
+    }
+
+    /**
+     * \brief Save the layer infos to disk.
+     * \return Json Layer dump.
+     */
+    Json dump() const override;
+
+    /**
+     * \brief Load the layer infos from disk.
+     * \param in const Json& Json to read.
+     */
+    void load(const Json& in) override;
+
+    void dump_stream(JsonWriter& out) const override;
+    void load_stream(JsonReader& in) override;
+
+protected:
+
+    void _set_input_shape(LayerShape input_shape) override;
+
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
+private:
+    /**
+     * \brief Load the fields that are not parameters and size the
+     * parameters.
+     * \param in const Json& Json to read.
+     */
+    void _load_fields(const Json& in);
+
+    /**
+     * \brief Dump of the hyperparameters of the layer.
+     * \return Json The others field of the dump.
+     */
+    [[nodiscard]] Json _dump_others() const;
+
+    /**
+     * \brief Resize parameters, gradients and workspace to the current
+     * input, output, hidden sizes and time steps.
+     */
+    void _resize();
+
+    SizeType _hidden_size;
+    SizeType _time_steps;
+
+    /**
+     * \brief Hidden states of the sequence.
+     * Slot 0 is the initial state and slot t + 1 is the state after the
+     * time step t, so the last slot is the state carried to the next call.
+     * Size: _hidden_size * (_time_steps + 1).
+     */
+    std::vector<NumType> _hidden_state;
+
+    // == Layer parameters ==
+    /**
+     * \brief Packed weights input to gates of the layer.
+     * Size: (GATES * _hidden_size) * input_size().
+     */
+    SharedParams _weights_i_to_g;
+    /**
+     * \brief Packed weights hidden to gates of the layer.
+     * Size: (GATES * _hidden_size) * _hidden_size.
+     */
+    SharedParams _weights_h_to_g;
+    /**
+     * \brief Packed input biases to gates of the layer.
+     * Size: GATES * _hidden_size.
+     */
+    SharedParams _biases_i_to_g;
+    /**
+     * \brief Packed hidden biases to gates of the layer. The new gate one
+     * is scaled by the reset gate. Size: GATES * _hidden_size.
+     */
+    SharedParams _biases_h_to_g;
+    /**
+     * \brief Weights hidden to output of the layer.
+     * Size: output_size() * _hidden_size.
+     */
+    SharedParams _weights_h_to_o;
+    /// \brief Biases to output of the layer. Size: output_size().
+    SharedParams _biases_to_o;
+
+    /// \brief Activations of the layer. Size: output_size() * _time_steps.
+    std::vector<NumType> _output_activations;
+
+    Params _weights_i_to_g_gradients;
+    Params _weights_h_to_g_gradients;
+    Params _biases_i_to_g_gradients;
+    Params _biases_h_to_g_gradients;
+    Params _weights_h_to_o_gradients;
+    Params _biases_to_o_gradients;
+
+    /// \brief Input gradients of the layer. Size: input_size() * _time_steps.
+    std::vector<NumType> _input_gradients;
+
+    // == Workspace of a sequence ==
+    /**
+     * \brief Input to gates products, then activated gates, of each time
+     * step. Size: _time_steps * GATES * _hidden_size.
+     */
+    std::vector<NumType> _gates;
+    /**
+     * \brief Hidden to gates products with biases of each time step.
+     * Size: _time_steps * GATES * _hidden_size.
+     */
+    std::vector<NumType> _hidden_gates;
+    /**
+     * \brief Gradients of the input to gates pre-activations of each time
+     * step. Size: _time_steps * GATES * _hidden_size.
+     */
+    std::vector<NumType> _gate_gradients;
+    /**
+     * \brief Gradients of the hidden to gates products of each time step.
+     * Size: _time_steps * GATES * _hidden_size.
+     */
+    std::vector<NumType> _hidden_gate_gradients;
+    /**
+     * \brief Hidden state gradients coming from the outputs.
+     * Size: _time_steps * _hidden_size.
+     */
+    std::vector<NumType> _hidden_gradients;
+    /// \brief Hidden state gradient of the next step. Size: _hidden_size.
+    std::vector<NumType> _hidden_state_gradient;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_GRU_HPP
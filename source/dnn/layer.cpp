@@ -27,6 +27,8 @@
 #include "dlmath.hpp"
 #include "dlgraph.hpp"
 
+#include <iostream>
+#include <set>
 #include <stdexcept>
 
 
@@ -100,6 +102,7 @@ Layer::Layer(std::string name, LayerShape input_shape, LayerShape output_shape,
              std::string prefix_name)
     : _shared_fields(std::make_shared<Fields>(name, input_shape, output_shape))
     , _last_input{}
+    , _gradients_allocated{false}
 { 
     if (_shared_fields->name().empty())
     {
@@ -117,6 +120,7 @@ const std::vector<NumType>& Layer::forward(
 const std::vector<NumType>& Layer::training_forward(
     const std::vector<NumType>& inputs)
 {
+    _allocate_gradients();
     _last_input = inputs.data();
     return forward(inputs);
 }
@@ -127,6 +131,20 @@ const std::vector<NumType>& Layer::backward(
     return gradients;
 }
 
+const std::vector<NumType>& Layer::forward_input(
+    const std::vector<NumType>& inputs, SizeType input_idx)
+{
+    (void) input_idx;
+    return forward(inputs);
+}
+
+const std::vector<NumType>& Layer::training_forward_input(
+    const std::vector<NumType>& inputs, SizeType input_idx)
+{
+    (void) input_idx;
+    return training_forward(inputs);
+}
+
 std::vector<NumType> Layer::last_input()
 {
     return _last_input
@@ -252,4 +270,104 @@ void Layer::_set_input_shape(LayerShape input_shape)
     _shared_fields->input_size() = _shared_fields->input_shape().size();
 }
 
+void Layer::_load_stream(JsonReader& in, bool others,
+                         const std::function<void(const Json&)>& load_fields,
+                         const std::function<ParamBuffers(DumpFields)>& buffers)
+{
+    std::vector<DumpFields> required = {
+        DumpFields::TYPE, DumpFields::NAME,
+        DumpFields::INPUT_SIZE, DumpFields::OUTPUT_SIZE
+    };
+    if (others) required.push_back(DumpFields::OTHERS);
+
+    Json fields;
+    std::set<std::string> keys;
+    std::map<DumpFields, Params> pending;
+    bool loaded = false;
+
+    in.begin_object();
+    std::string key;
+    while (in.next_key(key))
+    {
+        bool is_weights = key == dump_fields.at(DumpFields::WEIGHTS);
+        if (!is_weights && key != dump_fields.at(DumpFields::BIASES))
+        {
+            fields[key] = in.read();
+            keys.insert(key);
+            continue;
+        }
+
+        auto field = is_weights ? DumpFields::WEIGHTS : DumpFields::BIASES;
+        if (!loaded && std::all_of(required.begin(), required.end(),
+            [&](DumpFields f) { return keys.count(dump_fields.at(f)) > 0; }))
+        {
+            load_fields(fields);
+            loaded = true;
+        }
+        if (loaded)
+        {
+            in.read_numbers(buffers(field));
+        }
+        else
+        {
+            in.read_numbers(pending[field]);
+        }
+    }
+    if (!loaded) load_fields(fields);
+
+    for (const auto& [field, values]: pending)
+    {
+        auto field_buffers = buffers(field);
+        SizeType total = 0;
+        for (const auto& buffer: field_buffers) total += buffer.second;
+        if (total != values.size())
+        {
+            throw std::runtime_error(
+                "The loaded " + dump_fields.at(field)
+                + " size do not correspond with the layer");
+        }
+        auto it = values.begin();
+        for (const auto& [data, size]: field_buffers)
+        {
+            std::copy(it, it + static_cast<std::int64_t>(size), data);
+            it += static_cast<std::int64_t>(size);
+        }
+    }
+}
+
+Json Layer::_matrix_dump(const SharedParams& m, SizeType rows, SizeType cols)
+{
+    Json out;
+    for (SizeType i = 0; i < rows; ++i)
+    {
+        const auto* row = m.data() + i * cols;
+        out.append(JsonList(std::vector<NumType>(row, row + cols)));
+    }
+    return out;
+}
+
+void Layer::_matrix_load(SharedParams& m, const Json& in,
+                         SizeType rows, SizeType cols)
+{
+    for (SizeType i = 0; i < rows; ++i)
+    {
+        in.at(i).as_vec(m.data() + i * cols, cols);
+    }
+}
+
+void Layer::_matrix_print(const std::string& title, const SharedParams& m,
+                          SizeType rows, SizeType cols)
+{
+    std::cout << title << " (" << rows << " x " << cols << ")" << std::endl;
+    for (SizeType i = 0; i < rows; ++i)
+    {
+        for (SizeType j = 0; j < cols; ++j)
+        {
+            std::cout << "\t[" << ((i * cols) + j) << "]"
+                << m[(i * cols) + j];
+        }
+        std::cout << std::endl;
+    }
+}
+
 } // namespace EdgeLearning
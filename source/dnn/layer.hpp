@@ -32,6 +32,7 @@
 #include "type.hpp"
 #include "dlmath.hpp"
 #include "parser/json.hpp"
+#include "parser/json_stream.hpp"
 
 #include <cstdint>
 #include <string>
@@ -39,6 +40,7 @@
 #include <vector>
 #include <algorithm>
 #include <map>
+#include <functional>
 
 
 namespace EdgeLearning {
@@ -195,6 +197,27 @@ public:
     virtual const std::vector<NumType>& backward(
         const std::vector<NumType>& gradients);
 
+    /**
+     * \brief Forward propagation of one input of a layer with multiple
+     * inputs (see input_layers()). The inputs are indexed as the producer
+     * layers in the model. By default it calls the forward method.
+     * \param inputs    const std::vector<NumType>& Vector of inputs.
+     * \param input_idx SizeType Index of the input.
+     * \return const std::vector<NumType>& The computed activations.
+     */
+    virtual const std::vector<NumType>& forward_input(
+        const std::vector<NumType>& inputs, SizeType input_idx);
+
+    /**
+     * \brief Training forward propagation of one input of a layer with
+     * multiple inputs. By default it calls the training_forward method.
+     * \param inputs    const std::vector<NumType>& Vector of inputs.
+     * \param input_idx SizeType Index of the input.
+     * \return const std::vector<NumType>& The computed activations.
+     */
+    virtual const std::vector<NumType>& training_forward_input(
+        const std::vector<NumType>& inputs, SizeType input_idx);
+
     /**
      * \brief Getter of layer type.
      * \return std::string The layer type.
@@ -220,12 +243,63 @@ public:
     std::vector<NumType> last_input();
     virtual const std::vector<NumType>& last_input_gradient() = 0;
 
+    /**
+     * \brief Return the last gradient of one input of a layer with multiple
+     * inputs. By default it returns last_input_gradient().
+     * \param input_idx SizeType Index of the input.
+     * \return const std::vector<NumType>& The gradient of the input.
+     */
+    virtual const std::vector<NumType>& input_gradient(SizeType input_idx)
+    {
+        (void) input_idx;
+        return last_input_gradient();
+    }
+
     /**
      * \brief Return the last output of the layer.
      * \return const NumType* The last output of the layer of output size.
      */
     virtual const std::vector<NumType>& last_output() = 0;
 
+    /**
+     * \brief Check if the training forward can be called again on the same
+     * inputs to recompute the same output, as done by the model checkpointing.
+     * Layers with a state carried between calls or with random outputs are
+     * not recomputable.
+     * \return bool False by default.
+     */
+    [[nodiscard]] virtual bool recomputable() const { return false; }
+
+    /**
+     * \brief Free the memory of the last output. The next forward has to be
+     * preceded by restore_output(). By default the output is kept.
+     */
+    virtual void release_output() { }
+
+    /**
+     * \brief Allocate again the last output freed by release_output().
+     */
+    virtual void restore_output() { }
+
+    /**
+     * \brief Free the gradient buffers, e.g. of a layer used only for
+     * inference. The gradient buffers are allocated lazily: the first
+     * training_forward, backward or access to the gradients allocates them
+     * again.
+     */
+    void free_gradients()
+    {
+        _free_gradients();
+        _gradients_allocated = false;
+    }
+
+    /**
+     * \brief Check if the gradient buffers are allocated.
+     * \return bool False for a layer never trained or after free_gradients.
+     */
+    [[nodiscard]] bool gradients_allocated() const
+    { return _gradients_allocated; }
+
     /**
      * \brief Virtual method that return the number of tunable parameters. 
      * This methos should be overridden to reflect the quantity of tunable 
@@ -249,6 +323,24 @@ public:
      */
     virtual NumType& gradient(SizeType index) = 0;
 
+    /**
+     * \brief Take the parameters from an external buffer, e.g. a memory
+     * mapped model file, with the order of param(). The default copies the
+     * values: the layers with contiguous parameters read them in place.
+     * \param data  NumType* The first of param_count() values.
+     * \param owner const std::shared_ptr<const void>& Keeps the buffer alive
+     * as long as the layer reads it.
+     */
+    virtual void map_params(NumType* data,
+                            const std::shared_ptr<const void>& owner)
+    {
+        (void) owner;
+        for (SizeType i = 0; i < param_count(); ++i)
+        {
+            param(i) = data[i];
+        }
+    }
+
     /**
      * \brief Clone the layer with its custom parameters.
      * \return std::shared_prt<Layer> The pointer to the cloned layer.
@@ -336,6 +428,22 @@ public:
      */
     virtual void load(const Json& in);
 
+    /**
+     * \brief Save the layer infos in a streaming JSON writer, with the same
+     * format of dump(). The layers with parameters write them straight to
+     * the stream, the others write dump().
+     * \param out JsonWriter& The writer to use.
+     */
+    virtual void dump_stream(JsonWriter& out) const { out.value(dump()); }
+
+    /**
+     * \brief Load the layer infos from a streaming JSON reader. The layers
+     * with parameters read them straight in their buffers, the others read
+     * the layer object in a Json for load().
+     * \param in JsonReader& The reader to use.
+     */
+    virtual void load_stream(JsonReader& in) { load(in.read()); }
+
 protected:
     friend class Model;
 
@@ -346,6 +454,78 @@ protected:
      */
     virtual void _set_input_shape(LayerShape input_shape);
 
+    /**
+     * \brief Allocate the gradient buffers at the first training use.
+     */
+    void _allocate_gradients()
+    {
+        if (_gradients_allocated) return;
+        _gradients_allocated = true;
+        _resize_gradients();
+    }
+
+    /**
+     * \brief Resize the gradient buffers to the current shapes. It has to be
+     * called only if the gradients are allocated.
+     */
+    virtual void _resize_gradients() { }
+
+    /**
+     * \brief Release the memory of the gradient buffers.
+     */
+    virtual void _free_gradients() { }
+
+    /// \brief Parameter buffers and their sizes, in the order of a dump.
+    using ParamBuffers = std::vector<std::pair<NumType*, SizeType>>;
+
+    /**
+     * \brief Streamed load of a layer object with the parameters dumped in
+     * the weights and biases fields. The other fields are read in a Json and
+     * passed to load_fields, that has to size the parameters; the parameter
+     * fields are then read straight in the buffers returned by buffers.
+     * A parameter field that precedes the other fields is read in a
+     * temporary vector and copied at the end.
+     * \param in          JsonReader& The reader to use.
+     * \param others      bool True if the layer dumps the others field.
+     * \param load_fields const std::function<void(const Json&)>& Load the
+     * fields that are not parameters.
+     * \param buffers     const std::function<ParamBuffers(DumpFields)>&
+     * Parameter buffers of the weights or of the biases field.
+     */
+    void _load_stream(JsonReader& in, bool others,
+                      const std::function<void(const Json&)>& load_fields,
+                      const std::function<ParamBuffers(DumpFields)>& buffers);
+
+    /**
+     * \brief Dump a row-major matrix of parameters as a list of rows.
+     * \param m    const SharedParams& The matrix.
+     * \param rows SizeType The number of rows.
+     * \param cols SizeType The number of columns.
+     * \return Json The list of rows.
+     */
+    static Json _matrix_dump(const SharedParams& m,
+                             SizeType rows, SizeType cols);
+
+    /**
+     * \brief Load a row-major matrix of parameters from a list of rows.
+     * \param m    SharedParams& The matrix to fill.
+     * \param in   const Json& The list of rows.
+     * \param rows SizeType The number of rows.
+     * \param cols SizeType The number of columns.
+     */
+    static void _matrix_load(SharedParams& m, const Json& in,
+                             SizeType rows, SizeType cols);
+
+    /**
+     * \brief Print a row-major matrix of parameters on the standard output.
+     * \param title const std::string& The matrix title.
+     * \param m     const SharedParams& The matrix.
+     * \param rows  SizeType The number of rows.
+     * \param cols  SizeType The number of columns.
+     */
+    static void _matrix_print(const std::string& title, const SharedParams& m,
+                              SizeType rows, SizeType cols);
+
     std::shared_ptr<Fields> _shared_fields; ///< Layer shared fields.
 
     /**
@@ -353,6 +533,9 @@ protected:
      * gradients with respect to the weights during backpropagation.
      */
     const NumType* _last_input;
+
+    /// \brief True if the gradient buffers are allocated.
+    bool _gradients_allocated;
 };
 
 } // namespace EdgeLearning
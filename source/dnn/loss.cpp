@@ -53,6 +53,12 @@ void LossLayer::set_target(const std::vector<NumType>& target)
     _target = target;
 }
 
+void LossLayer::batch_size(SizeType batch_size)
+{
+    _inv_batch_size =
+        NumType{1.0} / static_cast<NumType>(std::max(batch_size, SizeType{1}));
+}
+
 NumType LossLayer::accuracy() const
 {
     return static_cast<NumType>(_correct) 
@@ -115,6 +115,12 @@ public:
      */
     void set_target(const std::vector<NumType>& target);
 
+    /**
+     * \brief Setter of the batch size used to scale the gradients.
+     * \param batch_size SizeType The batch size, 0 is considered as 1.
+     */
+    void batch_size(SizeType batch_size);
+
     /**
      * \brief Calculate and return the accuracy until the last forward
      * iteration.
@@ -50,6 +50,7 @@ const std::vector<NumType>& MaxPoolingLayer::forward(
 const std::vector<NumType>& MaxPoolingLayer::backward(
     const std::vector<NumType>& gradients)
 {
+    _allocate_gradients();
     std::fill(_input_gradients.begin(), _input_gradients.end(), 0);
     auto gradients_op = [&](
         NumType* dst, DLMath::Shape2d dst_shape, DLMath::Coord2d dst_coord,
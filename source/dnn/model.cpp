@@ -31,6 +31,9 @@
 #include "betterthreads/task_manager.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
 
 namespace EdgeLearning {
 
@@ -68,21 +71,21 @@ void Model::create_back_arc(
     Layer::SharedPtr src, Layer::SharedPtr dst)
 {
     _state.graph.add_arc_backward(dst, src);
-    _state.update();
+    _state.invalidate();
 }
 
 void Model::create_front_arc(
     Layer::SharedPtr src, Layer::SharedPtr dst)
 {
     _state.graph.add_arc_forward(src, dst);
-    _state.update();
+    _state.invalidate();
 }
 
 void Model::create_front_arc(
     Layer::SharedPtr src, std::shared_ptr<LossLayer> dst)
 {
     _state.graph.add_arc_forward(src, dst);
-    _state.update();
+    _state.invalidate();
 }
 
 void Model::create_edge(
@@ -116,7 +119,7 @@ RneType::result_type Model::init(InitializationFunction init,
     RneType rne{seed};
     for (const auto& layer_idx: _state.graph.forward_layers_idx())
     {
-        auto layer = _state.layers[layer_idx];
+        auto layer = _state.layers()[layer_idx];
         switch (init)
         {
             case InitializationFunction::KAIMING:
@@ -135,7 +138,7 @@ RneType::result_type Model::init(InitializationFunction init,
                 bool init_done = false;
                 for (const auto& next_layer_idx: _state.graph.forward(layer_idx))
                 {
-                    if (_state.layers[next_layer_idx]->is_type<ReluLayer>())
+                    if (_state.layers()[next_layer_idx]->is_type<ReluLayer>())
                     {
                         layer->init(Layer::InitializationFunction::KAIMING,
                                     pdf, rne);
@@ -168,7 +171,7 @@ void Model::train(Optimizer& optimizer, Model& model_from)
 #if 0 // Enable thread optimization.
     auto& tm = BetterThreads::TaskManager::instance();
     std::vector<BetterThreads::Future<void>> futures;
-    for (const auto& layer: model_from._state.layers)
+    for (const auto& layer: model_from._state.layers())
     {
         futures.push_back(tm.enqueue(
             [&]() {
@@ -177,7 +180,7 @@ void Model::train(Optimizer& optimizer, Model& model_from)
     }
     for (auto& f: futures) f.get();
 #else
-    for (const auto& layer: model_from._state.layers)
+    for (const auto& layer: model_from._state.layers())
     {
         optimizer.train(*layer);
     }
@@ -186,7 +189,7 @@ void Model::train(Optimizer& optimizer, Model& model_from)
 
 void Model::reset_score()
 {
-    for (const auto& loss_layer: _state.loss_layers)
+    for (const auto& loss_layer: _state.loss_layers())
     {
         loss_layer->reset_score();
     }
@@ -198,87 +201,163 @@ void Model::step(const std::vector<NumType>& input,
     const std::vector<NumType> not_used;
 
     // Set target.
-    for (auto loss_layer: _state.loss_layers)
+    for (auto loss_layer: _state.loss_layers())
     {
         loss_layer->set_target(target);
     }
 
-    // Forward.
-    for (auto input_layer: _state.input_layers)
+    if (_state.checkpoint_policy() != CheckpointPolicy::NONE)
     {
-        input_layer->training_forward(input);
+        _checkpointed_step(input);
+        return;
     }
-    for (const auto& forward_arc: _state.training_forward_run)
+
+    // Forward.
+    for (auto input_layer: _state.input_layers())
     {
-        forward_arc.to->training_forward(forward_arc.from->last_output());
+        input_layer->training_forward(input);
     }
+    _state.training_forward_run().execute([](const DLGraph::Arc& arc) {
+        arc.to->training_forward_input(arc.from->last_output(), arc.input_idx);
+    });
 
     // Backward.
-    for (auto loss_layer: _state.loss_layers)
+    for (auto loss_layer: _state.loss_layers())
     {
         loss_layer->backward(not_used);
     }
-    for (const auto& backward_arc: _state.backward_run)
-    {
-        backward_arc.to->backward(backward_arc.from->last_input_gradient());
-    }
+    _state.backward_run().execute([](const DLGraph::Arc& arc) {
+        arc.to->backward(arc.from->input_gradient(arc.input_idx));
+    });
 }
 
 const std::vector<NumType>& Model::predict(const std::vector<NumType>& input)
 {
-    if (_state.output_layers.empty())
+    if (_state.output_layers().empty())
     {
         throw std::runtime_error("No output layers in model");
     }
-    for (auto input_layer: _state.input_layers)
+    if (_state.checkpoint_policy() != CheckpointPolicy::NONE)
     {
-        input_layer->forward(input);
+        // The outputs released by the last checkpointed step.
+        for (const auto& layer: _state.layers())
+        {
+            layer->restore_output();
+        }
     }
-    for (const auto& forward_arc: _state.forward_run)
+    for (auto input_layer: _state.input_layers())
     {
-        forward_arc.to->forward(forward_arc.from->last_output());
+        input_layer->forward(input);
     }
-    return _state.output_layers.front()->last_output();
+    _state.forward_run().execute([](const DLGraph::Arc& arc) {
+        arc.to->forward_input(arc.from->last_output(), arc.input_idx);
+    });
+    return _state.output_layers().front()->last_output();
 }
 
 SizeType Model::input_size(SizeType input_layer_idx)
 {
-    if (input_layer_idx >= _state.input_layers.size()
-        || !_state.input_layers[input_layer_idx])
+    if (input_layer_idx >= _state.input_layers().size()
+        || !_state.input_layers()[input_layer_idx])
     {
         return 0;
     }
-    return _state.input_layers[input_layer_idx]->input_size();
+    return _state.input_layers()[input_layer_idx]->input_size();
 }
 
 SizeType Model::output_size(SizeType output_layer_idx)
 {
-    if (output_layer_idx >= _state.output_layers.size()
-        || !_state.output_layers[output_layer_idx])
+    if (output_layer_idx >= _state.output_layers().size()
+        || !_state.output_layers()[output_layer_idx])
     {
         return 0;
     }
-    return _state.output_layers[output_layer_idx]->output_size();
+    return _state.output_layers()[output_layer_idx]->output_size();
 }
 
 const std::vector<Layer::SharedPtr>& Model::layers() const
 {
-    return _state.layers;
+    return _state.layers();
 }
 
 const std::vector<Layer::SharedPtr>& Model::input_layers() const
 {
-    return _state.input_layers;
+    return _state.input_layers();
 }
 
 const std::vector<Layer::SharedPtr>& Model::output_layers() const
 {
-    return _state.output_layers;
+    return _state.output_layers();
 }
 
 const std::vector<std::shared_ptr<LossLayer>>& Model::loss_layers() const
 {
-    return _state.loss_layers;
+    return _state.loss_layers();
+}
+
+void Model::parallel_threshold(SizeType threshold)
+{
+    _state.parallel_threshold(threshold);
+}
+
+SizeType Model::parallel_threshold() const
+{
+    return _state.parallel_threshold();
+}
+
+bool Model::parallel() const
+{
+    return _state.training_forward_run().parallel()
+        || _state.backward_run().parallel();
+}
+
+void Model::checkpointing(CheckpointPolicy policy)
+{
+    _state.checkpoint_policy(policy);
+}
+
+Model::CheckpointPolicy Model::checkpointing() const
+{
+    return _state.checkpoint_policy();
+}
+
+void Model::checkpoint(Layer::SharedPtr layer)
+{
+    auto idx = _state.graph.index_of(*layer);
+    if (idx == -1)
+    {
+        throw std::runtime_error("Checkpoint layer not in model");
+    }
+    _state.checkpoint(static_cast<SizeType>(idx));
+    _state.checkpoint_policy(CheckpointPolicy::MANUAL);
+}
+
+std::vector<Layer::SharedPtr> Model::kept_layers() const
+{
+    const auto& plan = _state.checkpoint_plan();
+    if (_state.checkpoint_policy() == CheckpointPolicy::NONE)
+    {
+        return _state.layers();
+    }
+    std::vector<Layer::SharedPtr> ret;
+    for (SizeType i = 0; i < _state.layers().size(); ++i)
+    {
+        if (plan.kept[i]) ret.push_back(_state.layers()[i]);
+    }
+    return ret;
+}
+
+SizeType Model::activations_size() const
+{
+    const auto& loss_layers = _state.loss_layers();
+    SizeType size = 0;
+    for (const auto& layer: _state.layers())
+    {
+        if (std::find(loss_layers.begin(), loss_layers.end(), layer)
+            != loss_layers.end()) continue;
+        size += layer->last_output().size();
+    }
+    return size;
 }
 
 [[nodiscard]] std::string const& Model::name() const noexcept
@@ -288,7 +367,7 @@ const std::vector<std::shared_ptr<LossLayer>>& Model::loss_layers() const
 
 void Model::print() const
 {
-    for (auto& layer: _state.layers)
+    for (auto& layer: _state.layers())
     {
         layer->print();
     }
@@ -297,45 +376,301 @@ void Model::print() const
 NumType Model::accuracy() const
 {
     NumType sum = 0.0;
-    for (const auto& loss_layer: _state.loss_layers) {
+    for (const auto& loss_layer: _state.loss_layers()) {
         sum += loss_layer->accuracy();
     }
-    return sum / _state.loss_layers.size();
+    return sum / _state.loss_layers().size();
 }
 
 NumType Model::avg_loss() const
 {
     NumType sum = 0.0;
-    for (const auto& loss_layer: _state.loss_layers) {
+    for (const auto& loss_layer: _state.loss_layers()) {
         sum += loss_layer->avg_loss();
     }
-    return sum / _state.loss_layers.size();
+    return sum / _state.loss_layers().size();
 }
 
 void Model::dump(std::ofstream& out)
 {
-    Json model;
-    model["name"] = _shared_fields->name();
+    JsonWriter writer{out};
+    writer.begin_object();
+    writer.key("layers");
+    writer.begin_array();
+    for (const auto& layer: _state.layers())
+    {
+        layer->dump_stream(writer);
+    }
+    writer.end_array();
+    // Arcs [from, to] in layer indexes: the inputs of a layer follow the
+    // order of its producers.
+    const auto& graph = _state.graph;
+    writer.key("arcs");
+    writer.begin_array();
+    for (SizeType from = 0; from < graph.size(); ++from)
+    {
+        for (auto to: graph.training_forward(from))
+        {
+            writer.begin_array();
+            writer.value(from);
+            writer.value(to);
+            writer.end_array();
+        }
+    }
+    writer.end_array();
+    writer.key("num_type");
+    writer.value(NUM_TYPE_NAME);
+    writer.key("name");
+    writer.value(_shared_fields->name());
+    writer.end_object();
+    writer.flush();
+}
 
-    Json layers_json;
-    for (auto& layer: _state.layers)
+void Model::load(std::ifstream& in, bool inference_only)
+{
+    JsonReader reader{in};
+    reader.begin_object();
+    std::string key;
+    SizeType l_i = 0;
+    while (reader.next_key(key))
     {
-        layers_json.append(layer->dump());
+        if (key == "name")
+        {
+            _shared_fields->name() = reader.read_string();
+        }
+        else if (key == "layers")
+        {
+            reader.begin_array();
+            while (reader.next_item())
+            {
+                if (l_i == _state.layers().size())
+                {
+                    throw std::runtime_error(
+                        "The loaded model has more layers than the model");
+                }
+                _state.layers()[l_i++]->load_stream(reader);
+            }
+        }
+        else
+        {
+            reader.skip();
+        }
+    }
+    if (l_i != _state.layers().size())
+    {
+        throw std::runtime_error(
+            "The loaded model has less layers than the model");
     }
-    model["layers"] = layers_json;
-    out << model;
+    if (inference_only) free_gradients();
 }
 
-void Model::load(std::ifstream& in)
+void Model::free_gradients()
 {
-    Json model;
-    in >> model;
+    for (const auto& layer: _state.layers())
+    {
+        layer->free_gradients();
+    }
+}
 
-    _shared_fields->name() = model["name"].as<std::string>();
-    for (std::size_t l_i = 0; l_i < _state.layers.size(); ++l_i)
+void Model::_checkpointed_step(const std::vector<NumType>& input)
+{
+    const std::vector<NumType> not_used;
+    const auto& plan = _state.checkpoint_plan();
+    const auto& layers = _state.layers();
+
+    auto forward = [&](SizeType idx) {
+        const auto& layer = layers[idx];
+        layer->restore_output();
+        if (plan.forward_arcs[idx].empty())
+        {
+            layer->training_forward(input);
+        }
+        for (const auto& arc: plan.forward_arcs[idx])
+        {
+            layer->training_forward_input(arc.from->last_output(),
+                                          arc.input_idx);
+        }
+    };
+
+    // Forward: an output not kept is released once its consumers have run.
+    std::vector<SizeType> pending{plan.consumers};
+    for (auto idx: plan.order)
+    {
+        forward(idx);
+        if (plan.consumers[idx] == 0 && !plan.kept[idx])
+        {
+            layers[idx]->release_output();
+        }
+        for (auto pred: plan.predecessors[idx])
+        {
+            if (--pending[pred] == 0 && !plan.kept[pred])
+            {
+                layers[pred]->release_output();
+            }
+        }
+    }
+
+    // Backward: segment by segment, starting from the last one.
+    auto it = plan.order.rbegin();
+    while (it != plan.order.rend())
     {
-        auto layer_json = Json(model["layers"][l_i]);
-        _state.layers[l_i]->load(layer_json);
+        auto begin = it;
+        auto segment = plan.segment[*it];
+        while (it != plan.order.rend() && plan.segment[*it] == segment) ++it;
+
+        // Recompute the segment from the outputs kept.
+        for (auto r = it; r != begin;)
+        {
+            --r;
+            if (plan.recompute[*r]) forward(*r);
+        }
+        for (auto b = begin; b != it; ++b)
+        {
+            if (plan.loss[*b])
+            {
+                layers[*b]->backward(not_used);
+            }
+            for (const auto& arc: plan.backward_arcs[*b])
+            {
+                arc.to->backward(arc.from->input_gradient(arc.input_idx));
+            }
+        }
+        for (auto b = begin; b != it; ++b)
+        {
+            if (!plan.kept[*b]) layers[*b]->release_output();
+        }
+    }
+}
+
+void Model::State::_update_checkpoint_plan() const
+{
+    _checkpoint_plan = CheckpointPlan{};
+    if (_checkpoint_policy == CheckpointPolicy::NONE) return;
+
+    auto& plan = _checkpoint_plan;
+    const auto& layers = graph.layers();
+    const auto n = layers.size();
+    auto index = [&](const Layer::SharedPtr& layer) {
+        return static_cast<SizeType>(graph.index_of(*layer));
+    };
+
+    plan.segment.assign(n, 0);
+    plan.kept.assign(n, true);
+    plan.recompute.assign(n, false);
+    plan.consumers.assign(n, 0);
+    plan.forward_arcs.resize(n);
+    plan.backward_arcs.resize(n);
+    plan.predecessors.resize(n);
+    plan.loss.assign(n, false);
+
+    std::vector<std::vector<SizeType>> successors(n);
+    std::vector<SizeType> in_degree(n, 0);
+    std::vector<bool> reached(n, false);
+    for (const auto& arc: _training_forward_run.run())
+    {
+        auto from = index(arc.from);
+        auto to = index(arc.to);
+        plan.forward_arcs[to].push_back(arc);
+        plan.predecessors[to].push_back(from);
+        successors[from].push_back(to);
+        ++plan.consumers[from];
+        ++in_degree[to];
+        reached[from] = reached[to] = true;
+    }
+    for (const auto& arc: _backward_run.run())
+    {
+        plan.backward_arcs[index(arc.to)].push_back(arc);
+    }
+    for (const auto& layer: _input_layers)
+    {
+        reached[index(layer)] = true;
+    }
+    for (const auto& layer: _loss_layers)
+    {
+        plan.loss[index(layer)] = true;
+    }
+
+    // Topological order, the smallest layer index first.
+    std::priority_queue<SizeType, std::vector<SizeType>,
+                        std::greater<SizeType>> ready;
+    for (SizeType i = 0; i < n; ++i)
+    {
+        if (reached[i] && in_degree[i] == 0) ready.push(i);
+    }
+    while (!ready.empty())
+    {
+        auto idx = ready.top();
+        ready.pop();
+        plan.order.push_back(idx);
+        for (auto succ: successors[idx])
+        {
+            if (--in_degree[succ] == 0) ready.push(succ);
+        }
+    }
+    if (plan.order.size() != static_cast<SizeType>(
+        std::count(reached.begin(), reached.end(), true)))
+    {
+        throw std::runtime_error(
+            "Checkpointing requires an acyclic training graph");
+    }
+
+    // Checkpoints of the policy.
+    std::vector<bool> checkpoint(n, false);
+    if (_checkpoint_policy == CheckpointPolicy::SQRT)
+    {
+        auto count = static_cast<SizeType>(std::count_if(
+            plan.order.begin(), plan.order.end(),
+            [&](SizeType idx) { return !plan.loss[idx]; }));
+        auto every = std::max<SizeType>(1, static_cast<SizeType>(
+            std::ceil(std::sqrt(static_cast<NumType>(count)))));
+        SizeType pos = 0;
+        for (auto idx: plan.order)
+        {
+            if (!plan.loss[idx] && ++pos % every == 0) checkpoint[idx] = true;
+        }
+    }
+    else
+    {
+        for (auto idx: _checkpoints)
+        {
+            if (idx < n) checkpoint[idx] = true;
+        }
+    }
+
+    // Segments end with a checkpoint.
+    SizeType segment = 0;
+    for (auto idx: plan.order)
+    {
+        plan.segment[idx] = segment;
+        if (checkpoint[idx]) ++segment;
+    }
+    auto last_segment = plan.order.empty()
+        ? 0 : plan.segment[plan.order.back()];
+
+    // An output is kept if it cannot be recomputed within its segment.
+    for (auto idx: plan.order)
+    {
+        bool keep = checkpoint[idx] || plan.loss[idx]
+                 || !layers[idx]->recomputable()
+                 || plan.segment[idx] == last_segment;
+        for (auto succ: successors[idx])
+        {
+            keep = keep || plan.segment[succ] != plan.segment[idx]
+                 || plan.loss[succ] || !layers[succ]->recomputable();
+        }
+        plan.kept[idx] = keep;
+    }
+
+    // The layers kept that read a released output are run again as well,
+    // since the recomputed output is a new allocation.
+    for (auto idx: plan.order)
+    {
+        plan.recompute[idx] = !plan.kept[idx];
+        if (plan.loss[idx] || !layers[idx]->recomputable()) continue;
+        for (auto pred: plan.predecessors[idx])
+        {
+            plan.recompute[idx] = plan.recompute[idx] || !plan.kept[pred];
+        }
     }
 }
 
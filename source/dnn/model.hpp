@@ -34,7 +34,9 @@
 #include "optimizer.hpp"
 #include "type.hpp"
 #include "dlgraph.hpp"
+#include "scheduler.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <memory>
@@ -65,37 +67,209 @@ public:
      */
     using ProbabilityDensityFunction = Layer::ProbabilityDensityFunction;
 
-    struct State {
+    /**
+     * \brief Enumeration class for the activation checkpointing of step.
+     */
+    enum class CheckpointPolicy
+    {
+        NONE,   ///< \brief Every layer keeps its activations.
+        MANUAL, ///< \brief Only the layers marked by checkpoint() are kept.
+        SQRT    ///< \brief A layer every sqrt(N) of the N layers is kept.
+    };
+
+    /**
+     * \brief Execution plan of a checkpointed step.
+     * The layers, in a topological order of the training forward, are split
+     * in segments ending with a checkpoint. The outputs of the layers not
+     * kept are released as soon as their consumers have run, and they are
+     * recomputed from the outputs kept before the backward of their segment.
+     */
+    struct CheckpointPlan
+    {
+        /// \brief Layer indexes in topological order.
+        std::vector<SizeType> order;
+        /// \brief Segment of each layer.
+        std::vector<SizeType> segment;
+        /// \brief True for the layers that never release their output.
+        std::vector<bool> kept;
+        /// \brief True for the layers run again before their backward.
+        std::vector<bool> recompute;
+        /// \brief Amount of training forward consumers of each layer.
+        std::vector<SizeType> consumers;
+        /// \brief Training forward arcs entering each layer.
+        std::vector<std::vector<DLGraph::Arc>> forward_arcs;
+        /// \brief Backward arcs propagating the gradient to each layer.
+        std::vector<std::vector<DLGraph::Arc>> backward_arcs;
+        /// \brief Producer of each training forward arc entering a layer.
+        std::vector<std::vector<SizeType>> predecessors;
+        /// \brief True for the loss layers.
+        std::vector<bool> loss;
+    };
+
+    /**
+     * \brief Graph of the model and the views of it used by the execution.
+     * The views are recomputed lazily at the first access after a change of
+     * the graph, so building a model computes the run orders once instead of
+     * once for each added layer or edge. The run orders are executed by
+     * RunScheduler, which runs the independent branches concurrently.
+     */
+    class State {
+    public:
         State()
             : graph{}
-            , layers(graph.layers())
-            , input_layers(graph.input_layers())
-            , output_layers(graph.output_layers())
-            , loss_layers(graph.loss_layers())
-            , training_forward_run(graph.training_forward_run())
-            , forward_run(graph.forward_run())
-            , backward_run(graph.backward_run())
+            , _outdated{true}
+            , _input_layers{}
+            , _output_layers{}
+            , _loss_layers{}
+            , _training_forward_run{}
+            , _forward_run{}
+            , _backward_run{}
+            , _parallel_threshold{RunScheduler::DEFAULT_PARALLEL_THRESHOLD}
+            , _checkpoint_policy{CheckpointPolicy::NONE}
+            , _checkpoints{}
+            , _checkpoint_plan{}
+        { }
+
+        /**
+         * \brief The copied graph clones the layers, so the views are
+         * recomputed on the copy.
+         */
+        State(const State& obj)
+            : graph{obj.graph}
+            , _outdated{true}
+            , _input_layers{}
+            , _output_layers{}
+            , _loss_layers{}
+            , _training_forward_run{}
+            , _forward_run{}
+            , _backward_run{}
+            , _parallel_threshold{obj._parallel_threshold}
+            , _checkpoint_policy{obj._checkpoint_policy}
+            , _checkpoints{obj._checkpoints}
+            , _checkpoint_plan{}
         { }
 
-        void update()
+        State& operator=(const State& obj)
+        {
+            if (this == &obj) return *this;
+            graph = obj.graph;
+            _outdated = true;
+            _parallel_threshold = obj._parallel_threshold;
+            _checkpoint_policy = obj._checkpoint_policy;
+            _checkpoints = obj._checkpoints;
+            return *this;
+        }
+
+        /**
+         * \brief Mark the views as outdated after a change of the graph.
+         */
+        void invalidate() { _outdated = true; }
+
+        /**
+         * \brief Recompute the views, only if the graph changed since the
+         * last update.
+         */
+        void update() const
+        {
+            if (!_outdated) return;
+            _input_layers = graph.input_layers();
+            _output_layers = graph.output_layers();
+            _loss_layers = graph.loss_layers();
+            _training_forward_run = RunScheduler(
+                graph.training_forward_run(), _parallel_threshold);
+            _forward_run = RunScheduler(
+                graph.forward_run(), _parallel_threshold);
+            _backward_run = RunScheduler(
+                graph.backward_run(), _parallel_threshold);
+            _update_checkpoint_plan();
+            _outdated = false;
+        }
+
+        /**
+         * \brief Set the minimum concurrent work of a run to execute its
+         * independent branches in parallel.
+         * \param threshold SizeType The work estimate threshold.
+         */
+        void parallel_threshold(SizeType threshold)
+        {
+            _parallel_threshold = threshold;
+            if (_outdated) return;
+            _training_forward_run.parallel_threshold(threshold);
+            _forward_run.parallel_threshold(threshold);
+            _backward_run.parallel_threshold(threshold);
+        }
+
+        [[nodiscard]] SizeType parallel_threshold() const
+        { return _parallel_threshold; }
+
+        /**
+         * \brief Set the checkpointing policy of step.
+         * \param policy CheckpointPolicy The policy.
+         */
+        void checkpoint_policy(CheckpointPolicy policy)
+        {
+            _checkpoint_policy = policy;
+            invalidate();
+        }
+
+        [[nodiscard]] CheckpointPolicy checkpoint_policy() const
+        { return _checkpoint_policy; }
+
+        /**
+         * \brief Mark a layer as checkpoint of the MANUAL policy.
+         * \param layer_idx SizeType Index of the layer.
+         */
+        void checkpoint(SizeType layer_idx)
         {
-            layers = graph.layers();
-            input_layers = graph.input_layers();
-            output_layers = graph.output_layers();
-            loss_layers = graph.loss_layers();
-            training_forward_run = graph.training_forward_run();
-            forward_run = graph.forward_run();
-            backward_run = graph.backward_run();
+            if (std::find(_checkpoints.begin(), _checkpoints.end(), layer_idx)
+                == _checkpoints.end())
+            {
+                _checkpoints.push_back(layer_idx);
+            }
+            invalidate();
         }
 
+        /**
+         * \brief Checkpoint plan of step, empty if the policy is NONE.
+         */
+        const CheckpointPlan& checkpoint_plan() const
+        { update(); return _checkpoint_plan; }
+
+        const std::vector<Layer::SharedPtr>& layers() const
+        { return graph.layers(); }
+        const std::vector<Layer::SharedPtr>& input_layers() const
+        { update(); return _input_layers; }
+        const std::vector<Layer::SharedPtr>& output_layers() const
+        { update(); return _output_layers; }
+        const std::vector<std::shared_ptr<LossLayer>>& loss_layers() const
+        { update(); return _loss_layers; }
+        const RunScheduler& training_forward_run() const
+        { update(); return _training_forward_run; }
+        const RunScheduler& forward_run() const
+        { update(); return _forward_run; }
+        const RunScheduler& backward_run() const
+        { update(); return _backward_run; }
+
         DLGraph graph;
-        std::vector<Layer::SharedPtr> layers;
-        std::vector<Layer::SharedPtr> input_layers;
-        std::vector<Layer::SharedPtr> output_layers;
-        std::vector<std::shared_ptr<LossLayer>> loss_layers;
-        std::vector<DLGraph::Arc> training_forward_run;
-        std::vector<DLGraph::Arc> forward_run;
-        std::vector<DLGraph::Arc> backward_run;
+
+    private:
+        mutable bool _outdated;
+        mutable std::vector<Layer::SharedPtr> _input_layers;
+        mutable std::vector<Layer::SharedPtr> _output_layers;
+        mutable std::vector<std::shared_ptr<LossLayer>> _loss_layers;
+        mutable RunScheduler _training_forward_run;
+        mutable RunScheduler _forward_run;
+        mutable RunScheduler _backward_run;
+        SizeType _parallel_threshold;
+        CheckpointPolicy _checkpoint_policy;
+        /// \brief Indexes of the layers marked as checkpoint.
+        std::vector<SizeType> _checkpoints;
+        mutable CheckpointPlan _checkpoint_plan;
+
+        /**
+         * \brief Compute the checkpoint plan of the current policy.
+         */
+        void _update_checkpoint_plan() const;
     };
 
     class Fields {
@@ -153,8 +327,8 @@ public:
         _state.graph.add_node(
             std::make_shared<Layer_t>(std::forward<T>(args)...)
         );
-        _state.update();
-        return std::dynamic_pointer_cast<Layer_t>(_state.layers.back());
+        _state.invalidate();
+        return std::dynamic_pointer_cast<Layer_t>(_state.layers().back());
     }
 
     /**
@@ -173,8 +347,9 @@ public:
         _state.graph.add_loss(
             std::make_shared<LossLayer_t>(std::forward<T>(args)...)
         );
-        _state.update();
-        return std::dynamic_pointer_cast<LossLayer_t>(_state.layers.back());
+        _state.invalidate();
+        return std::dynamic_pointer_cast<LossLayer_t>(
+            _state.layers().back());
     }
 
     /**
@@ -294,6 +469,69 @@ public:
      */
     const std::vector<std::shared_ptr<LossLayer>>& loss_layers() const;
 
+    /**
+     * \brief Set the minimum work estimate of the independent branches of a
+     * run to execute them concurrently in step and predict. Smaller runs
+     * are executed sequentially.
+     * \param threshold SizeType The work estimate threshold. 0 runs in
+     * parallel every graph with independent branches.
+     */
+    void parallel_threshold(SizeType threshold);
+
+    /**
+     * \brief Getter of the parallel execution threshold.
+     * \return SizeType The work estimate threshold.
+     */
+    [[nodiscard]] SizeType parallel_threshold() const;
+
+    /**
+     * \brief Check if step runs the independent branches concurrently.
+     * \return bool True if the training forward or the backward run is
+     * executed in parallel.
+     */
+    [[nodiscard]] bool parallel() const;
+
+    /**
+     * \brief Set the activation checkpointing of step. With a policy other
+     * than NONE the output of the layers between two checkpoints is freed
+     * after the forward and recomputed segment by segment during the
+     * backward, trading one more forward for the activation memory. The
+     * layers that are not recomputable (e.g. dropout and recurrent layers)
+     * always keep their output, as well as their inputs. The training
+     * graph has to be acyclic and it is executed sequentially.
+     * \param policy CheckpointPolicy The checkpointing policy.
+     */
+    void checkpointing(CheckpointPolicy policy);
+
+    /**
+     * \brief Getter of the checkpointing policy.
+     * \return CheckpointPolicy The checkpointing policy of step.
+     */
+    [[nodiscard]] CheckpointPolicy checkpointing() const;
+
+    /**
+     * \brief Mark a layer of the model as checkpoint and set the MANUAL
+     * checkpointing policy.
+     * \param layer Layer::SharedPtr The layer keeping its output.
+     */
+    void checkpoint(Layer::SharedPtr layer);
+
+    /**
+     * \brief Layers keeping their output after the forward of a
+     * checkpointed step: the checkpoints and the layers that cannot be
+     * recomputed, together with the last segment and the loss layers.
+     * \return std::vector<Layer::SharedPtr> The layers kept, all the layers
+     * if the policy is NONE.
+     */
+    [[nodiscard]] std::vector<Layer::SharedPtr> kept_layers() const;
+
+    /**
+     * \brief Amount of activations currently allocated by the layers,
+     * except the loss layers.
+     * \return SizeType The sum of the sizes of the last outputs.
+     */
+    [[nodiscard]] SizeType activations_size() const;
+
     /**
      * \brief Model name provided for debugging purposes.
      * \return std::string const& Model name string.
@@ -318,19 +556,39 @@ public:
     [[nodiscard]] NumType avg_loss() const;
 
     /**
-     * \brief Save the model weights to disk.
+     * \brief Save the model weights to disk. The JSON is streamed layer by
+     * layer, without building the whole document in memory.
      * \param out Out file stream.
      */
     void dump(std::ofstream& out);
 
     /**
-     * \brief Load the model weights to disk.
-     * \param in In file stream.
+     * \brief Load the model weights to disk. The weights are read straight
+     * from the JSON stream in the layer buffers.
+     * \param in             In file stream.
+     * \param inference_only True to free the gradient buffers of the layers,
+     * for a model that is only used by predict.
+     */
+    void load(std::ifstream& in, bool inference_only = false);
+
+    /**
+     * \brief Free the gradient buffers of all the layers. The buffers are
+     * allocated again at the first step.
      */
-    void load(std::ifstream& in);
+    void free_gradients();
 
 private:
     friend class Layer;
+    friend class CodeGenerator;
+    friend class GraphPasses;
+    friend class PipelineTrainer;
+    friend class ModelFile;
+
+    /**
+     * \brief Step with the checkpoint plan of the model.
+     * \param input  const std::vector<NumType>& Input of the model.
+     */
+    void _checkpointed_step(const std::vector<NumType>& input);
 
     std::shared_ptr<Fields> _shared_fields;
     State _state;
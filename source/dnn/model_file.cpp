@@ -0,0 +1,237 @@
+/***************************************************************************
+ *            dnn/model_file.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "model_file.hpp"
+
+#include "data/mapped_file.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace EdgeLearning {
+
+constexpr char ModelFile::MAGIC[4];
+
+Json ModelFile::_graph_metadata(Model& model)
+{
+    const auto& graph = model._state.graph;
+    Json layers;
+    for (const auto& layer: graph.layers())
+    {
+        layers.append(layer->Layer::dump());
+    }
+    Json arcs;
+    for (SizeType from = 0; from < graph.size(); ++from)
+    {
+        for (auto to: graph.training_forward(from))
+        {
+            arcs.append(Json(std::vector<SizeType>{from, to}));
+        }
+    }
+    Json metadata;
+    metadata["name"] = model.name();
+    metadata["layers"] = layers;
+    metadata["arcs"] = arcs;
+    return metadata;
+}
+
+void ModelFile::dump(Model& model, const std::filesystem::path& path)
+{
+    const auto& layers = model.layers();
+    auto metadata = _graph_metadata(model);
+
+    // The metadata size only depends on the offsets written in it: compute
+    // the offsets from the metadata size until they do not change anymore.
+    std::vector<std::uint64_t> offsets(layers.size(), 0);
+    std::string metadata_str;
+    std::uint64_t data_offset = 0;
+    while (true)
+    {
+        for (SizeType i = 0; i < layers.size(); ++i)
+        {
+            metadata["layers"][i]["params"] = layers[i]->param_count();
+            metadata["layers"][i]["offset"] = offsets[i];
+        }
+        std::ostringstream oss;
+        oss << metadata;
+        metadata_str = oss.str();
+
+        bool changed = false;
+        data_offset = _align(sizeof(Header) + metadata_str.size());
+        auto offset = data_offset;
+        for (SizeType i = 0; i < layers.size(); ++i)
+        {
+            // A layer without parameters has no tensor: offset 0.
+            auto count = layers[i]->param_count();
+            auto layer_offset = count == 0 ? 0 : offset;
+            changed |= offsets[i] != layer_offset;
+            offsets[i] = layer_offset;
+            if (count > 0) offset = _align(offset + count * sizeof(NumType));
+        }
+        if (!changed) break;
+    }
+
+    std::ofstream out{path, std::ios::binary};
+    if (!out)
+    {
+        throw std::runtime_error("cannot open the model file " + path.string());
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.num_size = sizeof(NumType);
+    header.endianness = ENDIANNESS;
+    header.metadata_size = metadata_str.size();
+    header.data_offset = data_offset;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(metadata_str.data(),
+              static_cast<std::streamsize>(metadata_str.size()));
+
+    std::uint64_t position = sizeof(Header) + metadata_str.size();
+    std::vector<NumType> params;
+    for (SizeType i = 0; i < layers.size(); ++i)
+    {
+        auto count = layers[i]->param_count();
+        if (count == 0) continue;
+        params.resize(count);
+        for (SizeType p = 0; p < count; ++p)
+        {
+            params[p] = layers[i]->param(p);
+        }
+        for (; position < offsets[i]; ++position) out.put('\0');
+        out.write(reinterpret_cast<const char*>(params.data()),
+                  static_cast<std::streamsize>(count * sizeof(NumType)));
+        position += count * sizeof(NumType);
+    }
+    if (!out)
+    {
+        throw std::runtime_error(
+            "cannot write the model file " + path.string());
+    }
+}
+
+void ModelFile::load(Model& model, const std::filesystem::path& path,
+                     bool inference_only)
+{
+    auto file = std::make_shared<MappedFile>(
+        path, MappedFile::Mode::COPY_ON_WRITE);
+
+    Header header{};
+    if (file->size() < sizeof(Header))
+    {
+        throw std::runtime_error("model file too short: " + path.string());
+    }
+    std::memcpy(&header, file->data(), sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        throw std::runtime_error("not a model file: " + path.string());
+    }
+    if (header.version != VERSION)
+    {
+        throw std::runtime_error("model file version not supported");
+    }
+    if (header.endianness != ENDIANNESS)
+    {
+        throw std::runtime_error("model file endianness differs");
+    }
+    if (header.num_size != sizeof(NumType))
+    {
+        throw std::runtime_error("model file numeric type size differs");
+    }
+    if (sizeof(Header) + header.metadata_size > file->size())
+    {
+        throw std::runtime_error("model file metadata truncated");
+    }
+
+    Json metadata;
+    std::istringstream iss{std::string(
+        reinterpret_cast<const char*>(file->data()) + sizeof(Header),
+        header.metadata_size)};
+    iss >> metadata;
+
+    // The file has to describe the graph of the model.
+    auto expected = _graph_metadata(model);
+    const auto& layers = model.layers();
+    if (metadata["layers"].size() != layers.size()
+        || metadata["arcs"].size() != expected["arcs"].size())
+    {
+        throw std::runtime_error("model file graph differs from the model");
+    }
+    for (SizeType i = 0; i < expected["arcs"].size(); ++i)
+    {
+        if (metadata["arcs"][i][0].as<SizeType>()
+                != expected["arcs"][i][0].as<SizeType>()
+            || metadata["arcs"][i][1].as<SizeType>()
+                != expected["arcs"][i][1].as<SizeType>())
+        {
+            throw std::runtime_error("model file graph differs from the model");
+        }
+    }
+    for (SizeType i = 0; i < layers.size(); ++i)
+    {
+        auto layer_metadata = metadata["layers"][i];
+        if (layer_metadata["type"].as<std::string>() != layers[i]->type()
+            || layer_metadata["params"].as<SizeType>()
+                != layers[i]->param_count())
+        {
+            throw std::runtime_error(
+                "model file layer " + std::to_string(i)
+                + " differs from the model");
+        }
+        auto offset = layer_metadata["offset"].as<std::uint64_t>();
+        auto bytes = layers[i]->param_count() * sizeof(NumType);
+        if (bytes > 0 && (offset < header.data_offset
+                          || offset + bytes > file->size()))
+        {
+            throw std::runtime_error("model file parameters truncated");
+        }
+        if (bytes > 0 && offset % ALIGNMENT != 0)
+        {
+            throw std::runtime_error("model file parameters misaligned");
+        }
+    }
+
+    for (SizeType i = 0; i < layers.size(); ++i)
+    {
+        if (layers[i]->param_count() == 0) continue;
+        auto offset = metadata["layers"][i]["offset"].as<std::uint64_t>();
+        layers[i]->map_params(
+            reinterpret_cast<NumType*>(file->data() + offset), file);
+    }
+    model._shared_fields->name() = metadata["name"].as<std::string>();
+    if (inference_only) model.free_gradients();
+}
+
+void ModelFile::convert(Model& model, std::ifstream& json,
+                        const std::filesystem::path& path)
+{
+    model.load(json);
+    dump(model, path);
+}
+
+} // namespace EdgeLearning
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *            dnn/model_file.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/model_file.hpp
+ *  \brief Binary memory mappable model file.
+ */
+
+#ifndef EDGE_LEARNING_DNN_MODEL_FILE_HPP
+#define EDGE_LEARNING_DNN_MODEL_FILE_HPP
+
+#include "model.hpp"
+#include "data/path.hpp"
+
+#include <cstdint>
+#include <fstream>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Versioned binary format of the parameters of a Model.
+ *
+ * The file starts with a fixed header: magic "ELMF", version, size of
+ * NumType, endianness check value, metadata size and data offset, all
+ * little or big endian like the machine that wrote the file. The metadata
+ * is a JSON with the model name, the layers (type, name, shapes, amount
+ * of parameters and their offset in the file) and the training forward
+ * arcs of the graph. Then the raw parameters of each layer follow, in the
+ * order of Layer::param and aligned to ALIGNMENT bytes.
+ *
+ * The load memory maps the file copy-on-write and the layers read their
+ * parameters straight from the mapped pages (see Layer::map_params), so
+ * loading costs neither a parse nor a copy. A training after the load
+ * writes private copies of the pages and never modifies the file.
+ */
+class ModelFile
+{
+public:
+    /// \brief Magic number at the beginning of the file.
+    static constexpr char MAGIC[4] = {'E', 'L', 'M', 'F'};
+    /// \brief Version of the format written by dump.
+    static constexpr std::uint32_t VERSION = 1;
+    /// \brief Alignment in bytes of the parameters of each layer.
+    static constexpr std::uint64_t ALIGNMENT = 64;
+
+    /**
+     * \brief Write the model parameters in a binary model file.
+     * \param model Model& The model to save.
+     * \param path  const std::filesystem::path& The file to write.
+     */
+    static void dump(Model& model, const std::filesystem::path& path);
+
+    /**
+     * \brief Map the parameters of a binary model file in the model. The
+     * model has to have the same graph of the dumped model.
+     * \param model          Model& The model to load.
+     * \param path           const std::filesystem::path& The file to map.
+     * \param inference_only bool Free the gradient buffers after the load.
+     */
+    static void load(Model& model, const std::filesystem::path& path,
+                     bool inference_only = false);
+
+    /**
+     * \brief Convert a JSON dump of Model::dump in a binary model file.
+     * \param model Model& A model with the graph of the dumped model.
+     * \param json  std::ifstream& The JSON dump to read.
+     * \param path  const std::filesystem::path& The binary file to write.
+     */
+    static void convert(Model& model, std::ifstream& json,
+                        const std::filesystem::path& path);
+
+private:
+    /// \brief Value written in the native endianness of the machine.
+    static constexpr std::uint32_t ENDIANNESS = 0x01020304;
+
+    /// \brief Fixed size header at the beginning of the file.
+    struct Header
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t num_size;
+        std::uint32_t endianness;
+        std::uint64_t metadata_size;
+        std::uint64_t data_offset;
+    };
+
+    /**
+     * \brief Description of the graph of a model: the base dump of each
+     * layer and the training forward arcs.
+     * \param model Model& The model to describe.
+     * \return Json The metadata without the parameters offsets.
+     */
+    static Json _graph_metadata(Model& model);
+
+    /**
+     * \brief Round an offset up to ALIGNMENT.
+     * \param offset std::uint64_t The offset to align.
+     * \return std::uint64_t The aligned offset.
+     */
+    static std::uint64_t _align(std::uint64_t offset)
+    {
+        return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_MODEL_FILE_HPP
@@ -0,0 +1,446 @@
+/***************************************************************************
+ *            dnn/pipeline.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <stdexcept>
+#include <unordered_map>
+
+
+namespace EdgeLearning {
+
+double PipelineTrainer::Report::utilization() const
+{
+    if (stages == 0 || seconds <= 0.0) return 0.0;
+    double busy = 0.0;
+    for (auto s: stage_seconds) busy += s;
+    return std::min(1.0, busy / (static_cast<double>(stages) * seconds));
+}
+
+double PipelineTrainer::Report::ideal_bubble(
+    SizeType micro_batches_per_round) const
+{
+    if (stages == 0 || micro_batches_per_round == 0) return 0.0;
+    return static_cast<double>(stages - 1)
+        / static_cast<double>(micro_batches_per_round + stages - 1);
+}
+
+PipelineTrainer::PipelineTrainer(Model& model, Optimizer& optimizer,
+                                 SizeType stages, SizeType micro_batches)
+    : _model{model}
+    , _optimizer{optimizer}
+    , _stages{}
+    , _replicas{}
+    , _copies{}
+    , _runs{}
+    , _workers{}
+    , _mutex{}
+    , _cv{}
+    , _generation{0}
+    , _round_micro_batches{0}
+    , _round_inputs{}
+    , _forward_done{}
+    , _backward_done{}
+    , _stage_seconds{}
+    , _finished_stages{0}
+    , _error{}
+    , _stop{false}
+    , _report{}
+{
+    if (stages == 0)
+    {
+        throw std::runtime_error("stages has to be greater than 0");
+    }
+    if (micro_batches == 0)
+    {
+        throw std::runtime_error("micro batches has to be greater than 0");
+    }
+    if (_model.layers().empty())
+    {
+        throw std::runtime_error("the model has no layers");
+    }
+
+    _stages = _partition(std::min(stages, _model.layers().size()));
+
+    // The copies share the parameters and own the activations: the vector
+    // is never resized, so the replicas do not move.
+    _copies.reserve(micro_batches - 1);
+    _replicas.push_back(&_model);
+    for (SizeType i = 1; i < micro_batches; ++i)
+    {
+        _copies.emplace_back(_model);
+        _replicas.push_back(&_copies.back());
+    }
+    for (auto replica: _replicas)
+    {
+        _runs.push_back(_stage_runs(*replica, _stages));
+    }
+
+    _round_inputs.resize(micro_batches, nullptr);
+    _forward_done.resize(_stages.size(), 0);
+    _backward_done.resize(_stages.size(), 0);
+    _stage_seconds.resize(_stages.size(), 0.0);
+    _report.stages = _stages.size();
+    _report.stage_seconds.resize(_stages.size(), 0.0);
+
+    for (SizeType s = 0; s < _stages.size(); ++s)
+    {
+        _workers.emplace_back(&PipelineTrainer::_worker, this, s);
+    }
+}
+
+PipelineTrainer::~PipelineTrainer()
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& worker: _workers) worker.join();
+}
+
+void PipelineTrainer::train(const std::vector<std::vector<NumType>>& inputs,
+                            const std::vector<std::vector<NumType>>& targets)
+{
+    if (inputs.size() != targets.size())
+    {
+        throw std::runtime_error("inputs and targets sizes differ");
+    }
+
+    auto stages_amount = _stages.size();
+    _report.micro_batches = inputs.size();
+    _report.rounds = 0;
+    _report.seconds = 0.0;
+    std::fill(_report.stage_seconds.begin(), _report.stage_seconds.end(),
+              0.0);
+    for (auto replica: _replicas) replica->reset_score();
+
+    auto begin = std::chrono::steady_clock::now();
+    for (SizeType offset = 0; offset < inputs.size();
+         offset += _replicas.size())
+    {
+        auto count = std::min(_replicas.size(), inputs.size() - offset);
+        for (SizeType r = 0; r < count; ++r)
+        {
+            for (const auto& loss_layer: _replicas[r]->loss_layers())
+            {
+                loss_layer->set_target(targets[offset + r]);
+            }
+            _round_inputs[r] = &inputs[offset + r];
+        }
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _round_micro_batches = count;
+            std::fill(_forward_done.begin(), _forward_done.end(), 0);
+            std::fill(_backward_done.begin(), _backward_done.end(), 0);
+            _finished_stages = 0;
+            ++_generation;
+            _cv.notify_all();
+            _cv.wait(lock, [&]() {
+                return _finished_stages == stages_amount;
+            });
+            error = _error;
+            _error = nullptr;
+        }
+        if (error) std::rethrow_exception(error);
+
+        for (SizeType s = 0; s < stages_amount; ++s)
+        {
+            _report.stage_seconds[s] += _stage_seconds[s];
+        }
+        ++_report.rounds;
+    }
+    _report.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    // Average loss over the micro-batches of every replica.
+    NumType loss = 0.0;
+    for (SizeType r = 0; r < _replicas.size(); ++r)
+    {
+        auto samples = inputs.size() / _replicas.size()
+            + (r < inputs.size() % _replicas.size() ? 1 : 0);
+        if (samples == 0 || _replicas[r]->loss_layers().empty()) continue;
+        loss += _replicas[r]->avg_loss() * NumType(samples);
+    }
+    _report.loss = inputs.empty() ? 0.0 : loss / NumType(inputs.size());
+
+    _accumulate();
+    _model.train(_optimizer);
+}
+
+std::vector<Layer::SharedPtr> PipelineTrainer::stage_layers(
+    SizeType stage_idx) const
+{
+    std::vector<Layer::SharedPtr> ret;
+    for (auto l_idx: _stages.at(stage_idx))
+    {
+        ret.push_back(_model.layers()[l_idx]);
+    }
+    return ret;
+}
+
+std::vector<std::vector<SizeType>> PipelineTrainer::_partition(
+    SizeType stages) const
+{
+    const auto& graph = _model._state.graph;
+    const auto& layers = _model.layers();
+
+    // Training forward order by Kahn's algorithm.
+    std::vector<SizeType> pending(layers.size());
+    std::deque<SizeType> ready;
+    for (SizeType l_idx = 0; l_idx < layers.size(); ++l_idx)
+    {
+        pending[l_idx] = graph.training_forward_predecessors(l_idx).size();
+        if (pending[l_idx] == 0) ready.push_back(l_idx);
+    }
+    std::vector<SizeType> order;
+    while (!ready.empty())
+    {
+        auto l_idx = ready.front();
+        ready.pop_front();
+        order.push_back(l_idx);
+        for (auto s_idx: graph.training_forward(l_idx))
+        {
+            if (--pending[s_idx] == 0) ready.push_back(s_idx);
+        }
+    }
+    if (order.size() != layers.size())
+    {
+        throw std::runtime_error("the model graph has cycles");
+    }
+
+    // Contiguous chunks of about the same work.
+    std::vector<SizeType> work(order.size());
+    SizeType total_work = 0;
+    for (SizeType i = 0; i < order.size(); ++i)
+    {
+        const auto& l = layers[order[i]];
+        work[i] = l->param_count() + l->input_size() + l->output_size();
+        total_work += work[i];
+    }
+    std::vector<std::vector<SizeType>> ret(stages);
+    SizeType stage_idx = 0;
+    SizeType cumulative_work = 0;
+    for (SizeType i = 0; i < order.size(); ++i)
+    {
+        // Move to the next stage when the current one has its share of the
+        // work, keeping at least a layer for each of the next stages.
+        auto remaining_layers = order.size() - i;
+        auto remaining_stages = stages - stage_idx - 1;
+        if (!ret[stage_idx].empty()
+            && (remaining_layers <= remaining_stages
+                || cumulative_work * stages
+                   >= total_work * (stage_idx + 1)))
+        {
+            ++stage_idx;
+        }
+        ret[stage_idx].push_back(order[i]);
+        cumulative_work += work[i];
+    }
+    return ret;
+}
+
+std::vector<PipelineTrainer::StageRun> PipelineTrainer::_stage_runs(
+    const Model& replica,
+    const std::vector<std::vector<SizeType>>& stages) const
+{
+    const auto& layers = replica.layers();
+    std::unordered_map<const Layer*, SizeType> layer_idx;
+    for (SizeType l_idx = 0; l_idx < layers.size(); ++l_idx)
+    {
+        layer_idx[layers[l_idx].get()] = l_idx;
+    }
+    std::vector<SizeType> stage_of(layers.size());
+    for (SizeType s = 0; s < stages.size(); ++s)
+    {
+        for (auto l_idx: stages[s]) stage_of[l_idx] = s;
+    }
+
+    std::vector<std::vector<DLGraph::Arc>> forward_arcs(layers.size());
+    for (const auto& arc: replica._state.training_forward_run().run())
+    {
+        forward_arcs[layer_idx.at(arc.to.get())].push_back(arc);
+    }
+    std::vector<std::vector<DLGraph::Arc>> backward_arcs(layers.size());
+    for (const auto& arc: replica._state.backward_run().run())
+    {
+        backward_arcs[layer_idx.at(arc.to.get())].push_back(arc);
+    }
+
+    std::vector<StageRun> ret(stages.size());
+    for (const auto& input_layer: replica._state.input_layers())
+    {
+        ret[stage_of[layer_idx.at(input_layer.get())]].input_layers
+            .push_back(input_layer);
+    }
+    for (const auto& loss_layer: replica._state.loss_layers())
+    {
+        ret[stage_of[layer_idx.at(loss_layer.get())]].loss_layers
+            .push_back(loss_layer);
+    }
+    for (SizeType s = 0; s < stages.size(); ++s)
+    {
+        for (auto l_idx: stages[s])
+        {
+            ret[s].forward.insert(ret[s].forward.end(),
+                                  forward_arcs[l_idx].begin(),
+                                  forward_arcs[l_idx].end());
+        }
+        for (auto it = stages[s].rbegin(); it != stages[s].rend(); ++it)
+        {
+            ret[s].backward.insert(ret[s].backward.end(),
+                                   backward_arcs[*it].begin(),
+                                   backward_arcs[*it].end());
+        }
+    }
+    return ret;
+}
+
+void PipelineTrainer::_worker(SizeType stage_idx)
+{
+    const std::vector<NumType> not_used;
+    auto last_stage = stage_idx + 1 == _stages.size();
+    SizeType generation = 0;
+    while (true)
+    {
+        SizeType micro_batches;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _cv.wait(lock, [&]() {
+                return _stop || _generation != generation;
+            });
+            if (_stop) return;
+            generation = _generation;
+            micro_batches = _round_micro_batches;
+        }
+
+        // Wait until the condition holds, false if another stage failed.
+        auto wait = [&](auto condition) {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _cv.wait(lock, [&]() { return _error || condition(); });
+            return !_error;
+        };
+        auto done = [&](std::vector<SizeType>& counter) {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                ++counter[stage_idx];
+            }
+            _cv.notify_all();
+        };
+
+        double busy = 0.0;
+        try
+        {
+            bool ok = true;
+            for (SizeType mb = 0; ok && mb < micro_batches; ++mb)
+            {
+                if (stage_idx > 0)
+                {
+                    ok = wait([&]() {
+                        return _forward_done[stage_idx - 1] > mb;
+                    });
+                    if (!ok) break;
+                }
+                auto begin = std::chrono::steady_clock::now();
+                const auto& run = _runs[mb][stage_idx];
+                for (const auto& input_layer: run.input_layers)
+                {
+                    input_layer->training_forward(*_round_inputs[mb]);
+                }
+                for (const auto& arc: run.forward)
+                {
+                    arc.to->training_forward_input(arc.from->last_output(),
+                                                   arc.input_idx);
+                }
+                busy += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin).count();
+                done(_forward_done);
+            }
+
+            // The backward streams the micro-batches in reverse order.
+            for (SizeType i = 0; ok && i < micro_batches; ++i)
+            {
+                auto mb = micro_batches - 1 - i;
+                if (!last_stage)
+                {
+                    ok = wait([&]() {
+                        return _backward_done[stage_idx + 1] > i;
+                    });
+                    if (!ok) break;
+                }
+                auto begin = std::chrono::steady_clock::now();
+                const auto& run = _runs[mb][stage_idx];
+                for (const auto& loss_layer: run.loss_layers)
+                {
+                    loss_layer->backward(not_used);
+                }
+                for (const auto& arc: run.backward)
+                {
+                    arc.to->backward(arc.from->input_gradient(arc.input_idx));
+                }
+                busy += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin).count();
+                done(_backward_done);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (!_error) _error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stage_seconds[stage_idx] = busy;
+            ++_finished_stages;
+        }
+        _cv.notify_all();
+    }
+}
+
+void PipelineTrainer::_accumulate()
+{
+    const auto& layers = _model.layers();
+    for (SizeType r = 1; r < _replicas.size(); ++r)
+    {
+        const auto& replica_layers = _replicas[r]->layers();
+        for (SizeType l_idx = 0; l_idx < layers.size(); ++l_idx)
+        {
+            auto& from = *replica_layers[l_idx];
+            auto& to = *layers[l_idx];
+            for (SizeType p = 0; p < from.param_count(); ++p)
+            {
+                to.gradient(p) += from.gradient(p);
+                from.gradient(p) = 0.0;
+            }
+        }
+    }
+}
+
+} // namespace EdgeLearning
@@ -0,0 +1,235 @@
+/***************************************************************************
+ *            dnn/pipeline.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/pipeline.hpp
+ *  \brief Pipeline-parallel trainer with micro-batches.
+ */
+
+#ifndef EDGE_LEARNING_DNN_PIPELINE_HPP
+#define EDGE_LEARNING_DNN_PIPELINE_HPP
+
+#include "model.hpp"
+#include "optimizer.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief GPipe-style pipeline-parallel trainer.
+ *
+ * The layers of the model are split in stages(): contiguous chunks of the
+ * training forward order with about the same work. Each stage runs on its
+ * own worker thread for the whole lifetime of the trainer. The samples of a
+ * batch are the micro-batches: they stream through the stages, so that
+ * stage k forwards micro-batch i while stage k + 1 forwards micro-batch
+ * i - 1, then the backward streams back from the last stage.
+ *
+ * Each in-flight micro-batch needs its own activations, hence the trainer
+ * keeps micro_batches() replicas of the model: the trained model and copies
+ * sharing its parameters. The batches larger than micro_batches() are
+ * trained in consecutive rounds. The gradients of all the replicas and rounds
+ * are accumulated in the model before a single optimizer step per batch.
+ */
+class PipelineTrainer
+{
+public:
+    /**
+     * \brief Utilization of the pipeline.
+     */
+    struct Report
+    {
+        SizeType stages = 0;        ///< \brief Amount of stages.
+        SizeType micro_batches = 0; ///< \brief Micro-batches trained.
+        SizeType rounds = 0;        ///< \brief Pipeline fill and drain rounds.
+        double seconds = 0.0;       ///< \brief Wall time of the rounds.
+        /// \brief Busy time of each stage.
+        std::vector<double> stage_seconds;
+        NumType loss = 0.0;         ///< \brief Average loss of the last batch.
+
+        /**
+         * \brief Fraction of the stage time spent computing.
+         * \return double Busy time over stages() times the wall time.
+         */
+        [[nodiscard]] double utilization() const;
+
+        /**
+         * \brief Fraction of the stage time spent idle in the pipeline
+         * bubble, measured.
+         * \return double 1 - utilization().
+         */
+        [[nodiscard]] double bubble() const { return 1.0 - utilization(); }
+
+        /**
+         * \brief Bubble of a perfectly balanced pipeline: with S stages and
+         * M micro-batches per round it is (S - 1) / (M + S - 1).
+         * \param micro_batches_per_round SizeType Micro-batches in a round.
+         * \return double The ideal bubble fraction.
+         */
+        [[nodiscard]] double ideal_bubble(
+            SizeType micro_batches_per_round) const;
+    };
+
+    /**
+     * \brief Split the model in stages and start the stage workers.
+     * \param model         Model& The model to train.
+     * \param optimizer     Optimizer& The optimizer applied after each batch.
+     * \param stages        SizeType Amount of stages, at most the amount of
+     *                      layers.
+     * \param micro_batches SizeType Micro-batches in flight in a round.
+     */
+    PipelineTrainer(Model& model, Optimizer& optimizer,
+                    SizeType stages, SizeType micro_batches);
+
+    PipelineTrainer(const PipelineTrainer&) = delete;
+    PipelineTrainer& operator=(const PipelineTrainer&) = delete;
+
+    /**
+     * \brief Stop and join the stage workers.
+     */
+    ~PipelineTrainer();
+
+    /**
+     * \brief Train a batch: one micro-batch for each sample and one
+     * optimizer step.
+     * \param inputs  const std::vector<std::vector<NumType>>& The inputs.
+     * \param targets const std::vector<std::vector<NumType>>& The targets.
+     */
+    void train(const std::vector<std::vector<NumType>>& inputs,
+               const std::vector<std::vector<NumType>>& targets);
+
+    /**
+     * \brief Train a batch from a stream, e.g. a Dataset<NumType>.
+     * \tparam Stream Type with size(), input(i) and label(i).
+     * \param batch const Stream& The batch to train.
+     */
+    template <typename Stream>
+    void train(const Stream& batch)
+    {
+        std::vector<std::vector<NumType>> inputs;
+        std::vector<std::vector<NumType>> targets;
+        for (SizeType i = 0; i < batch.size(); ++i)
+        {
+            inputs.push_back(batch.input(i));
+            targets.push_back(batch.label(i));
+        }
+        train(inputs, targets);
+    }
+
+    [[nodiscard]] SizeType stages() const { return _stages.size(); }
+    [[nodiscard]] SizeType micro_batches() const
+    { return _replicas.size(); }
+
+    /**
+     * \brief Getter of the layers of a stage in the trained model.
+     * \param stage_idx SizeType The stage index.
+     * \return std::vector<Layer::SharedPtr> The layers of the stage.
+     */
+    [[nodiscard]] std::vector<Layer::SharedPtr> stage_layers(
+        SizeType stage_idx) const;
+
+    /**
+     * \brief Getter of the report of the last batch.
+     * \return const Report& The report.
+     */
+    [[nodiscard]] const Report& report() const { return _report; }
+
+private:
+    /**
+     * \brief Work of a stage on a replica of the model.
+     */
+    struct StageRun
+    {
+        /// \brief Input layers of the stage, fed with the sample.
+        std::vector<Layer::SharedPtr> input_layers;
+        /// \brief Training forward arcs to the layers of the stage.
+        std::vector<DLGraph::Arc> forward;
+        /// \brief Loss layers of the stage, starting the backward.
+        std::vector<std::shared_ptr<LossLayer>> loss_layers;
+        /// \brief Backward arcs to the layers of the stage.
+        std::vector<DLGraph::Arc> backward;
+    };
+
+    /**
+     * \brief Layers of the model assigned to each stage, by index.
+     */
+    std::vector<std::vector<SizeType>> _partition(SizeType stages) const;
+
+    /**
+     * \brief Build the stage runs of a replica.
+     */
+    std::vector<StageRun> _stage_runs(
+        const Model& replica,
+        const std::vector<std::vector<SizeType>>& stages) const;
+
+    /**
+     * \brief Loop of the worker thread of a stage.
+     */
+    void _worker(SizeType stage_idx);
+
+    /**
+     * \brief Accumulate the gradients of the replicas in the model.
+     */
+    void _accumulate();
+
+    Model& _model;
+    Optimizer& _optimizer;
+    /// \brief Layer indexes of each stage in the forward order.
+    std::vector<std::vector<SizeType>> _stages;
+    /// \brief The model, then its copies sharing the parameters.
+    std::vector<Model*> _replicas;
+    std::vector<Model> _copies;
+    /// \brief Stage runs of each replica: [replica][stage].
+    std::vector<std::vector<StageRun>> _runs;
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    /// \brief Incremented to start a round on all the workers.
+    SizeType _generation;
+    /// \brief Replicas used in the current round.
+    SizeType _round_micro_batches;
+    /// \brief Input of each replica in the current round.
+    std::vector<const std::vector<NumType>*> _round_inputs;
+    /// \brief Micro-batches forwarded by each stage in the current round.
+    std::vector<SizeType> _forward_done;
+    /// \brief Micro-batches backwarded by each stage in the current round.
+    std::vector<SizeType> _backward_done;
+    /// \brief Busy time of each stage in the current round.
+    std::vector<double> _stage_seconds;
+    /// \brief Stages that finished the current round.
+    SizeType _finished_stages;
+    std::exception_ptr _error;
+    bool _stop;
+
+    Report _report;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_PIPELINE_HPP
@@ -66,16 +66,19 @@ RecurrentLayer::RecurrentLayer(std::string name,
     // The outputs of each neuron within the layer is an "activation".
     _output_activations.resize(output_size * _time_steps);
 
-    // The hidden state is of hidden_size for each time step of the sequences.
+    // The hidden state is of hidden_size for the initial state and for each
+    // time step of the sequences.
     _hidden_state = std::vector<NumType>(
-        _hidden_size * std::max(_time_steps, SizeType(1U)), 0.0);
+        _hidden_size * (_time_steps + 1), 0.0);
 
-    _weights_i_to_h_gradients.resize(ih_size);
-    _weights_h_to_h_gradients.resize(hh_size);
-    _weights_h_to_o_gradients.resize(ho_size);
-    _biases_to_h_gradients.resize(_hidden_size);
-    _biases_to_o_gradients.resize(output_size);
-    _input_gradients.resize(input_size * _time_steps);
+    // Scratch buffers of the whole sequence and of a single hidden state.
+    // The gradient buffers are allocated at the first training use.
+    _input_projections.resize(_hidden_size * _time_steps);
+    _hidden_buffer.resize(_hidden_size);
+
+    // Buffers of a single time step used by the streaming inference.
+    _step_hidden_state.resize(_hidden_size);
+    _step_output_activations.resize(output_size);
 }
 
 void RecurrentLayer::init(InitializationFunction init,
@@ -118,43 +121,50 @@ void RecurrentLayer::init(InitializationFunction init,
 const std::vector<NumType>& RecurrentLayer::forward(
     const std::vector<NumType>& inputs)
 {
-    const NumType* curr_sequence; //< Ptr to the current sequence to forward.
-    SizeType curr_hs_idx;         //< Current hidden state index.
-    SizeType next_hs_idx;         //< Next hidden state index.
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    if (inputs.size() < input_size * _time_steps)
+    {
+        throw std::runtime_error("forward error: input size too small");
+    }
+    if (_time_steps == 0)
+    {
+        return Layer::forward(_output_activations);
+    }
+
+    // Start the sequence from the hidden state carried by the last call.
+    std::copy(_last_hidden_state(), _last_hidden_state() + _hidden_size,
+              _hidden_state.begin());
 
-    auto *tmp_mul = new NumType[_hidden_size];
+    /*
+     * Compute the product of the whole sequence with the input_to_hidden
+     * weights, that does not depend on the recurrence.
+     * P = X * W_ih^T 
+     */
+    DLMath::matmat_mul_t_no_check<NumType>(
+        _input_projections.data(), inputs.data(), _weights_i_to_h.data(),
+        _time_steps, input_size, _hidden_size);
 
     // Loop the time sequences.
     for (SizeType t = 0; t < _time_steps; ++t)
     {
-        curr_sequence = inputs.data() + t * _shared_fields->input_size();
-        curr_hs_idx = t;
-        next_hs_idx = (t == (_time_steps - 1)) ? 0 : t + 1;
-
-        /*
-         * Compute the product of the input with its input_to_hidden weights.
-         * h(t+1) = W_ih * x 
-         */
-        DLMath::matarr_mul<NumType>(
-            _hidden_state.data() + next_hs_idx * _hidden_size, 
-            _weights_i_to_h.data(),
-            curr_sequence, _hidden_size, _shared_fields->input_size());
+        NumType* curr_hidden_state = _hidden_state.data() + t * _hidden_size;
+        NumType* next_hidden_state = curr_hidden_state + _hidden_size;
 
         /*
          * Compute the product of the hidden state with its 
          * hidden_to_hidden weights and the sum with the to_hidden bias.
-         * h(t+1) += W_hh * h(t) + b_h
+         * h(t+1) = P(t) + W_hh * h(t) + b_h
          */
-        DLMath::matarr_mul<NumType>(tmp_mul, _weights_h_to_h.data(),
-            _hidden_state.data() + curr_hs_idx * _hidden_size, 
+        DLMath::matarr_mul_no_check<NumType>(
+            _hidden_buffer.data(), _weights_h_to_h.data(), curr_hidden_state,
             _hidden_size, _hidden_size);
         DLMath::arr_sum<NumType>(
-            _hidden_state.data() + next_hs_idx * _hidden_size,
-            _hidden_state.data() + next_hs_idx * _hidden_size,
-            tmp_mul, _hidden_size);
+            next_hidden_state,
+            _input_projections.data() + t * _hidden_size,
+            _hidden_buffer.data(), _hidden_size);
         DLMath::arr_sum<NumType>(
-            _hidden_state.data() + next_hs_idx * _hidden_size,
-            _hidden_state.data() + next_hs_idx * _hidden_size,
+            next_hidden_state, next_hidden_state,
             _biases_to_h.data(), _hidden_size);
 
         // Calculate hidden activations.
@@ -168,9 +178,7 @@ const std::vector<NumType>& RecurrentLayer::forward(
             //      * h(t+1) = relu(h(t+1))
             //      */ 
             //     DLMath::relu<NumType>(
-            //         _hidden_state.data() + next_hs_idx * _hidden_size,
-            //         _hidden_state.data() + next_hs_idx * _hidden_size, 
-            //         _hidden_size);
+            //         next_hidden_state, next_hidden_state, _hidden_size);
             //     break;
             // }
             // case Activation::Linear:
@@ -186,178 +194,195 @@ const std::vector<NumType>& RecurrentLayer::forward(
                  * h(t+1) = tanh(h(t+1))
                  */ 
                 DLMath::tanh<NumType>(
-                    _hidden_state.data() + next_hs_idx * _hidden_size,
-                    _hidden_state.data() + next_hs_idx * _hidden_size, 
-                    _hidden_size);
+                    next_hidden_state, next_hidden_state, _hidden_size);
                 break;
             }
         }
+    }
 
-        /*
-         * Compute the product of the hidden state with the 
-         * hidden_to_output weights and the sum with the to_output bias.
-         * a(t) = W_ho * h(t + 1) + b_o
-         */
-        DLMath::matarr_mul<NumType>(
-            _output_activations.data() + t * _shared_fields->output_size(),
-            _weights_h_to_o.data(),
-            _hidden_state.data() + next_hs_idx * _hidden_size, 
-            _shared_fields->output_size(), _hidden_size);
+    /*
+     * Compute the product of the hidden states with the hidden_to_output
+     * weights and the sum with the to_output bias.
+     * a(t) = W_ho * h(t + 1) + b_o
+     */
+    DLMath::matmat_mul_t_no_check<NumType>(
+        _output_activations.data(), _hidden_state.data() + _hidden_size,
+        _weights_h_to_o.data(), _time_steps, _hidden_size, output_size);
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
         DLMath::arr_sum<NumType>(
-            _output_activations.data() + t * _shared_fields->output_size(),
-            _output_activations.data() + t * _shared_fields->output_size(),
-            _biases_to_o.data(), _shared_fields->output_size());
+            _output_activations.data() + t * output_size,
+            _output_activations.data() + t * output_size,
+            _biases_to_o.data(), output_size);
     }
 
-    delete[] tmp_mul;
-
     return Layer::forward(_output_activations);
 }
 
 const std::vector<NumType>& RecurrentLayer::backward(
     const std::vector<NumType>& gradients)
 {
-    const NumType* curr_sequence_gradients; //< Ptr to the current gradients.
-    SizeType curr_hs_idx; //< Current hidden state index.
-    SizeType prev_hs_idx; //< Previous hidden state index.
-
-    std::vector<NumType> next_hidden_state(
-        static_cast<std::size_t>(_hidden_size), NumType{0.0});
-    auto *tmp_mul = new NumType[_hidden_size];
-
-    // Loop the gradient sequences in reverse.
-    for (SizeType t = _time_steps; t > 0; --t)
+    _allocate_gradients();
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    if (gradients.size() < output_size * _time_steps)
+    {
+        throw std::runtime_error("backward error: gradients size too small");
+    }
+    if (_time_steps == 0)
     {
-        SizeType t_idx = t - 1;
-        curr_hs_idx = (t >= _time_steps) ? 0 : t;
-        prev_hs_idx = t_idx;
-        curr_sequence_gradients = gradients.data() + (t_idx * _shared_fields->output_size());
+        return Layer::backward(_input_gradients);
+    }
 
-        // Bias gradient to output.
-        DLMath::arr_sum(
+    // Bias gradient to output.
+    for (SizeType t = 0; t < _time_steps; ++t)
+    {
+        DLMath::arr_sum<NumType>(
             _biases_to_o_gradients.data(), 
             _biases_to_o_gradients.data(),
-            curr_sequence_gradients, _shared_fields->output_size());
+            gradients.data() + t * output_size, output_size);
+    }
 
-        // Weight gradient hidden to output.
-        for (SizeType i = 0; i < _shared_fields->output_size(); ++i)
-        {
-            for (SizeType j = 0; j < _hidden_size; ++j)
-            {
-                _weights_h_to_o_gradients[(i * _hidden_size) + j] +=
-                    curr_sequence_gradients[i]
-                    * _hidden_state[(SizeType(curr_hs_idx) * _hidden_size) + j];
-            }
-        }
+    // Weight gradient hidden to output, of all the time steps.
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_h_to_o_gradients.data(), gradients.data(),
+        _hidden_state.data() + _hidden_size,
+        _time_steps, output_size, _hidden_size);
 
-        // Hidden state gradient for next time step gradient propagation.
-        for (SizeType j = 0; j < _hidden_size; ++j)
-        {
-            tmp_mul[j] = NumType(0.0);
-            for (SizeType i = 0; i < _shared_fields->output_size(); ++i)
-            {
-                tmp_mul[j] += _weights_h_to_o[(i * _hidden_size) + j] 
-                    * curr_sequence_gradients[i];
-            }
-        }
-        DLMath::arr_sum(
-            tmp_mul, 
-            tmp_mul, 
-            next_hidden_state.data(), _hidden_size);
+    // Hidden state gradients coming from the outputs of all the time steps.
+    DLMath::matmat_mul_no_check<NumType>(
+        _hidden_gradients.data(), gradients.data(), _weights_h_to_o.data(),
+        _time_steps, output_size, _hidden_size);
+
+    // Loop the gradient sequences in reverse.
+    std::fill(_hidden_state_gradient.begin(), _hidden_state_gradient.end(),
+              NumType{0.0});
+    for (SizeType t = _time_steps; t > 0; --t)
+    {
+        NumType* curr_hidden_gradients =
+            _hidden_gradients.data() + (t - 1) * _hidden_size;
 
-        // Calculate gradient of hidden activation and put in next_hidden_state.
+        // Sum the gradient propagated from the next time step.
+        DLMath::arr_sum<NumType>(
+            curr_hidden_gradients, curr_hidden_gradients,
+            _hidden_state_gradient.data(), _hidden_size);
+
+        // Calculate gradient of hidden activation.
         switch (_hidden_activation)
         {
             // TODO: to test.
             // case Activation::ReLU:
             // {
-            //     DLMath::relu_1<NumType>(next_hidden_state.data(), 
-            //         _hidden_state.data() + curr_hs_idx * _hidden_size, 
+            //     DLMath::relu_1<NumType>(_hidden_buffer.data(), 
+            //         _hidden_state.data() + t * _hidden_size, 
             //         _hidden_size);
             //     break;
             // }
             // case Activation::Linear:
             // {
-            //     std::fill(next_hidden_state.begin(), next_hidden_state.end(),
+            //     std::fill(_hidden_buffer.begin(), _hidden_buffer.end(),
             //         NumType{1.0});
             //     break;
             // }
             case HiddenActivation::TanH:
             default:
             {
-                DLMath::tanh_1<NumType>(
-                    next_hidden_state.data(), 
-                    _hidden_state.data() + curr_hs_idx * _hidden_size, 
+                DLMath::tanh_1_opt<NumType>(
+                    _hidden_buffer.data(), 
+                    _hidden_state.data() + t * _hidden_size, 
                     _hidden_size);
                 break;
             }
         }
-        DLMath::arr_mul<NumType>(next_hidden_state.data(), 
-            next_hidden_state.data(), tmp_mul, _hidden_size);
+        DLMath::arr_mul<NumType>(curr_hidden_gradients, 
+            curr_hidden_gradients, _hidden_buffer.data(), _hidden_size);
 
         // Bias gradient to hidden.
         DLMath::arr_sum<NumType>(
             _biases_to_h_gradients.data(), 
             _biases_to_h_gradients.data(), 
-            next_hidden_state.data(), _hidden_size);
+            curr_hidden_gradients, _hidden_size);
 
-        // Weight gradient input to hidden.
-        for (SizeType i = 0; i < _hidden_size; ++i)
-        {
-            for (SizeType j = 0; j < _shared_fields->input_size(); ++j)
-            {
-                _weights_i_to_h_gradients[(i * _shared_fields->input_size()) + j] +=
-                    next_hidden_state[i] 
-                    * _last_input[(t_idx * _shared_fields->input_size()) + j];
-            }
-        }
-
-        // Weight gradient hidden to hidden.
+        // Hidden state gradient for the previous time step.
+        std::fill(_hidden_state_gradient.begin(), _hidden_state_gradient.end(),
+                  NumType{0.0});
         for (SizeType i = 0; i < _hidden_size; ++i)
         {
             for (SizeType j = 0; j < _hidden_size; ++j)
             {
-                _weights_h_to_h_gradients[(i * _hidden_size) + j] += 
-                    next_hidden_state[i] 
-                    * _hidden_state[(SizeType(prev_hs_idx) * _hidden_size) + j];
+                _hidden_state_gradient[j] +=
+                    _weights_h_to_h[(i * _hidden_size) + j] 
+                    * curr_hidden_gradients[i];
             }
         }
+    }
 
-        // Input gradient.
-        NumType* curr_input_gradients = _input_gradients.data() 
-            + (t_idx * _shared_fields->input_size());
-        std::fill(curr_input_gradients, curr_input_gradients + _shared_fields->input_size(), 0);
-        for (SizeType i = 0; i < _hidden_size; ++i)
-        {
-            for (SizeType j = 0; j < _shared_fields->input_size(); ++j)
-            {
-                curr_input_gradients[j] += 
-                    next_hidden_state[i] 
-                        * _weights_i_to_h[(i * _shared_fields->input_size()) + j];
-            }
-        }
+    // Weight gradient input to hidden, of all the time steps.
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_i_to_h_gradients.data(), _hidden_gradients.data(),
+        _last_input, _time_steps, _hidden_size, input_size);
 
-        // Update next hidden state for next time step.
-        for (SizeType j = 0; j < _hidden_size; ++j)
+    // Weight gradient hidden to hidden, of all the time steps.
+    DLMath::outer_product_acc_no_check<NumType>(
+        _weights_h_to_h_gradients.data(), _hidden_gradients.data(),
+        _hidden_state.data(), _time_steps, _hidden_size, _hidden_size);
+
+    // Input gradient, of all the time steps.
+    DLMath::matmat_mul_no_check<NumType>(
+        _input_gradients.data(), _hidden_gradients.data(),
+        _weights_i_to_h.data(), _time_steps, _hidden_size, input_size);
+
+    return Layer::backward(_input_gradients);
+}
+
+const std::vector<NumType>& RecurrentLayer::step(
+    const std::vector<NumType>& input)
+{
+    if (input.size() < _shared_fields->input_size())
+    {
+        throw std::runtime_error("step error: input size too small");
+    }
+
+    NumType* last_hidden_state = _last_hidden_state();
+
+    // h = W_ih * x + W_hh * h + b_h
+    DLMath::matarr_mul_no_check<NumType>(
+        _step_hidden_state.data(), _weights_i_to_h.data(), input.data(),
+        _hidden_size, _shared_fields->input_size());
+    DLMath::matarr_mul_no_check<NumType>(
+        _hidden_buffer.data(), _weights_h_to_h.data(), last_hidden_state,
+        _hidden_size, _hidden_size);
+    DLMath::arr_sum<NumType>(
+        _step_hidden_state.data(), _step_hidden_state.data(),
+        _hidden_buffer.data(), _hidden_size);
+    DLMath::arr_sum<NumType>(
+        _step_hidden_state.data(), _step_hidden_state.data(),
+        _biases_to_h.data(), _hidden_size);
+
+    switch (_hidden_activation)
+    {
+        case HiddenActivation::TanH:
+        default:
         {
-            tmp_mul[j] = NumType(0.0);
-            for (SizeType i = 0; i < _hidden_size; ++i)
-            {
-                tmp_mul[j] += _weights_h_to_h[(i * _hidden_size) + j] 
-                    * next_hidden_state[i];
-            }
+            DLMath::tanh<NumType>(last_hidden_state,
+                                  _step_hidden_state.data(), _hidden_size);
+            break;
         }
-        next_hidden_state = std::vector<NumType>(tmp_mul, 
-            tmp_mul + _hidden_size);
     }
 
-    delete[] tmp_mul;
-
-    return Layer::backward(_input_gradients);
+    // a = W_ho * h + b_o
+    DLMath::matarr_mul_no_check<NumType>(
+        _step_output_activations.data(), _weights_h_to_o.data(),
+        last_hidden_state, _shared_fields->output_size(), _hidden_size);
+    DLMath::arr_sum<NumType>(
+        _step_output_activations.data(), _step_output_activations.data(),
+        _biases_to_o.data(), _shared_fields->output_size());
+    return _step_output_activations;
 }
 
 const std::vector<NumType>& RecurrentLayer::last_input_gradient()
 {
+    _allocate_gradients();
     return _input_gradients;
 }
 
@@ -398,6 +423,7 @@ NumType& RecurrentLayer::param(SizeType index)
 
 NumType& RecurrentLayer::gradient(SizeType index)
 {
+    _allocate_gradients();
     if (index >= param_count())
     {
         throw std::runtime_error("index overflow");
@@ -538,18 +564,86 @@ Json RecurrentLayer::dump() const
     biases.append(biases_to_h);
     biases.append(biases_to_o);
 
-    Json others;
-    others["hidden_activation"] = static_cast<int>(_hidden_activation);
-    others["hidden_size"] = _hidden_size;
-    others["time_steps"] = _time_steps;
-
     out[dump_fields.at(DumpFields::WEIGHTS)] = weights;
     out[dump_fields.at(DumpFields::BIASES)] = biases;
-    out[dump_fields.at(DumpFields::OTHERS)] = others;
+    out[dump_fields.at(DumpFields::OTHERS)] = _dump_others();
     return out;
 }
 
 void RecurrentLayer::load(const Json& in)
+{
+    _load_fields(in);
+
+    // Read a whole row of weights at once.
+    const auto& weights = in.at(dump_fields.at(DumpFields::WEIGHTS));
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    for (SizeType i = 0; i < _hidden_size; ++i)
+    {
+        weights.at(0).at(i).as_vec(
+            _weights_i_to_h.data() + i * input_size, input_size);
+        weights.at(1).at(i).as_vec(
+            _weights_h_to_h.data() + i * _hidden_size, _hidden_size);
+    }
+    for (SizeType i = 0; i < output_size; ++i)
+    {
+        weights.at(2).at(i).as_vec(
+            _weights_h_to_o.data() + i * _hidden_size, _hidden_size);
+    }
+
+    const auto& biases = in.at(dump_fields.at(DumpFields::BIASES));
+    biases.at(0).as_vec(_biases_to_h.data(), _hidden_size);
+    biases.at(1).as_vec(_biases_to_o.data(), output_size);
+}
+
+void RecurrentLayer::dump_stream(JsonWriter& out) const
+{
+    const auto input_size = _shared_fields->input_size();
+    const auto output_size = _shared_fields->output_size();
+    out.begin_object();
+    out.members(Layer::dump());
+    out.key(dump_fields.at(DumpFields::OTHERS));
+    out.value(_dump_others());
+    out.key(dump_fields.at(DumpFields::WEIGHTS));
+    out.begin_array();
+    out.tensor(_weights_i_to_h.data(), {_hidden_size, input_size});
+    out.tensor(_weights_h_to_h.data(), {_hidden_size, _hidden_size});
+    out.tensor(_weights_h_to_o.data(), {output_size, _hidden_size});
+    out.end_array();
+    out.key(dump_fields.at(DumpFields::BIASES));
+    out.begin_array();
+    out.tensor(_biases_to_h.data(), {_hidden_size});
+    out.tensor(_biases_to_o.data(), {output_size});
+    out.end_array();
+    out.end_object();
+}
+
+void RecurrentLayer::load_stream(JsonReader& in)
+{
+    _load_stream(in, true,
+        [this](const Json& fields) { _load_fields(fields); },
+        [this](DumpFields field) -> ParamBuffers {
+            if (field == DumpFields::WEIGHTS)
+            {
+                return {{_weights_i_to_h.data(), _weights_i_to_h.size()},
+                        {_weights_h_to_h.data(), _weights_h_to_h.size()},
+                        {_weights_h_to_o.data(), _weights_h_to_o.size()}};
+            }
+            return {{_biases_to_h.data(), _biases_to_h.size()},
+                    {_biases_to_o.data(), _biases_to_o.size()}};
+        });
+}
+
+Json RecurrentLayer::_dump_others() const
+{
+    Json others;
+    others["hidden_activation"] = static_cast<int>(_hidden_activation);
+    others["hidden_size"] = _hidden_size;
+    others["time_steps"] = _time_steps;
+    return others;
+}
+
+void RecurrentLayer::_load_fields(const Json& in)
 {
     Layer::load(in);
 
@@ -570,61 +664,44 @@ void RecurrentLayer::load(const Json& in)
     _biases_to_h.resize(_hidden_size);
     _biases_to_o.resize(_shared_fields->output_size());
     _output_activations.resize(_shared_fields->output_size() * _time_steps);
-    _hidden_state.resize(_hidden_size * std::max(_time_steps, SizeType(1U)));
-    _weights_i_to_h_gradients.resize(ih_size);
-    _weights_h_to_h_gradients.resize(hh_size);
-    _weights_h_to_o_gradients.resize(ho_size);
-    _biases_to_h_gradients.resize(_hidden_size);
-    _biases_to_o_gradients.resize(_shared_fields->output_size());
-    _input_gradients.resize(_shared_fields->input_size() * _time_steps);
-
-    for (SizeType i = 0; i < _hidden_size; ++i)
-    {
-        SizeType offset = i * _shared_fields->input_size();
-        for (SizeType j = 0; j < _shared_fields->input_size(); ++j)
-        {
-            _weights_i_to_h[offset + j] = in.at(
-                dump_fields.at(DumpFields::WEIGHTS)).at(0).at(i).at(j);
-        }
-    }
-
-    for (SizeType i = 0; i < _hidden_size; ++i)
-    {
-        SizeType offset = i * _hidden_size;
-        for (SizeType j = 0; j < _hidden_size; ++j)
-        {
-            _weights_h_to_h[offset + j] = in.at(
-                dump_fields.at(DumpFields::WEIGHTS)).at(1).at(i).at(j);
-        }
-    }
-
-    for (SizeType i = 0; i < _shared_fields->output_size(); ++i)
-    {
-        SizeType offset = i * _hidden_size;
-        for (SizeType j = 0; j < _hidden_size; ++j)
-        {
-            _weights_h_to_o[offset + j] = in.at(
-                dump_fields.at(DumpFields::WEIGHTS)).at(2).at(i).at(j);
-        }
-    }
-
-    for (SizeType i = 0; i < _hidden_size; ++i)
-    {
-        _biases_to_h[i] = in.at(dump_fields.at(DumpFields::BIASES)).at(0).at(i);
-    }
-
-    for (SizeType i = 0; i < _shared_fields->output_size(); ++i)
-    {
-        _biases_to_o[i] = in.at(dump_fields.at(DumpFields::BIASES)).at(1).at(i);
-    }
+    _hidden_state.resize(_hidden_size * (_time_steps + 1));
+    _input_projections.resize(_hidden_size * _time_steps);
+    _hidden_buffer.resize(_hidden_size);
+    _step_hidden_state.resize(_hidden_size);
+    _step_output_activations.resize(_shared_fields->output_size());
+    if (_gradients_allocated) _resize_gradients();
 }
 
 void RecurrentLayer::_set_input_shape(LayerShape input_shape) {
     Layer::_set_input_shape(input_shape);
     auto ih_size = _shared_fields->input_size() * _hidden_size;
     _weights_i_to_h.resize(ih_size);
-    _weights_i_to_h_gradients.resize(ih_size);
+    if (_gradients_allocated) _resize_gradients();
+}
+
+void RecurrentLayer::_resize_gradients()
+{
+    _hidden_gradients.resize(_hidden_size * _time_steps);
+    _hidden_state_gradient.resize(_hidden_size);
+    _weights_i_to_h_gradients.resize(
+        _shared_fields->input_size() * _hidden_size);
+    _weights_h_to_h_gradients.resize(_hidden_size * _hidden_size);
+    _weights_h_to_o_gradients.resize(
+        _hidden_size * _shared_fields->output_size());
+    _biases_to_h_gradients.resize(_hidden_size);
+    _biases_to_o_gradients.resize(_shared_fields->output_size());
     _input_gradients.resize(_shared_fields->input_size() * _time_steps);
 }
 
+void RecurrentLayer::_free_gradients()
+{
+    for (auto* buffer: {&_hidden_gradients, &_hidden_state_gradient,
+                        &_weights_i_to_h_gradients, &_weights_h_to_h_gradients,
+                        &_weights_h_to_o_gradients, &_biases_to_h_gradients,
+                        &_biases_to_o_gradients, &_input_gradients})
+    {
+        std::vector<NumType>().swap(*buffer);
+    }
+}
+
 } // namespace EdgeLearning
@@ -68,19 +68,33 @@ public:
         override;
 
     /**
-     * \brief The input data should have size input_size().
+     * \brief The input data should have size input_size() * time_steps().
+     * The input to hidden products of all the time steps are computed with a
+     * single matrix product, and only the hidden to hidden recurrence is
+     * sequential.
      * \param inputs
      */
     const std::vector<NumType>& forward(
         const std::vector<NumType>& inputs) override;
 
     /**
-     * \brief The gradient data should have size output_size().
+     * \brief The gradient data should have size output_size() * time_steps().
+     * The weight gradients are accumulated for all the time steps at once.
      * \param gradients
      */
     const std::vector<NumType>& backward(
         const std::vector<NumType>& gradients) override;
 
+    /**
+     * \brief Streaming inference: advance the recurrence of exactly one time
+     * step starting from the last hidden state, that is kept across calls.
+     * It does not allocate memory and it costs O(H*H + H*I + O*H).
+     * Use reset_hidden_state() to start a new stream session.
+     * \param input const std::vector<NumType>& Input of size input_size().
+     * \return const std::vector<NumType>& The output of size output_size().
+     */
+    const std::vector<NumType>& step(const std::vector<NumType>& input);
+
     const std::vector<NumType>& last_input_gradient() override;
     const std::vector<NumType>& last_output() override;
 
@@ -112,16 +126,21 @@ public:
             throw std::runtime_error("hidden state exceeds the hidden size");
         }
         std::copy(hidden_state.begin(), hidden_state.end(),
-                  _hidden_state.begin());
+                  _last_hidden_state());
     }
 
     void time_steps(SizeType time_steps)
     {
+        // Keep the hidden state carried to the next sequence.
+        std::vector<NumType> last_hidden_state(
+            _last_hidden_state(), _last_hidden_state() + _hidden_size);
         _time_steps = time_steps;
-        _hidden_state.resize(
-            _hidden_size * std::max(_time_steps, SizeType(1U)));
+        _hidden_state.resize(_hidden_size * (_time_steps + 1));
+        std::copy(last_hidden_state.begin(), last_hidden_state.end(),
+                  _last_hidden_state());
+        _input_projections.resize(_hidden_size * _time_steps);
         _output_activations.resize(_shared_fields->output_size() * _time_steps);
-        _input_gradients.resize(_shared_fields->input_size() * _time_steps);
+        if (_gradients_allocated) _resize_gradients();
     }
 
     [[nodiscard]] SizeType time_steps() const
@@ -129,6 +148,10 @@ public:
         return _time_steps;
     }
 
+    /**
+     * \brief Reset the hidden state. It is the boundary between two
+     * independent sequences, both for forward() and step().
+     */
     void reset_hidden_state()
     {
         for (NumType& s: _hidden_state)
@@ -149,14 +172,49 @@ public:
      */
     void load(const Json& in) override;
 
+    void dump_stream(JsonWriter& out) const override;
+    void load_stream(JsonReader& in) override;
+
 protected:
 
     void _set_input_shape(LayerShape input_shape) override;
 
+    void _resize_gradients() override;
+    void _free_gradients() override;
+
 private:
+    /**
+     * \brief Load the fields that are not parameters and size the
+     * parameters.
+     * \param in const Json& Json to read.
+     */
+    void _load_fields(const Json& in);
+
+    /**
+     * \brief Dump of the hyperparameters of the layer.
+     * \return Json The others field of the dump.
+     */
+    [[nodiscard]] Json _dump_others() const;
+
+    /**
+     * \brief Pointer to the hidden state of the last time step, that is
+     * carried to the next forward() call and advanced by step().
+     * \return NumType* The last hidden state of size _hidden_size.
+     */
+    NumType* _last_hidden_state()
+    {
+        return _hidden_state.data() + _time_steps * _hidden_size;
+    }
+
     HiddenActivation _hidden_activation;
     SizeType _hidden_size;
 
+    /**
+     * \brief Hidden states of the sequence.
+     * Slot 0 is the initial state and slot t + 1 is the state after the
+     * time step t, so the last slot is the state carried to the next call.
+     * Size: _hidden_size * (_time_steps + 1).
+     */
     std::vector<NumType> _hidden_state;
     SizeType _time_steps;
 
@@ -185,6 +243,11 @@ private:
     /// \brief Activations of the layer. Size: output_size().
     std::vector<NumType> _output_activations;
 
+    /// \brief Hidden state computed by step(). Size: _hidden_size.
+    std::vector<NumType> _step_hidden_state;
+    /// \brief Activations computed by step(). Size: output_size().
+    std::vector<NumType> _step_output_activations;
+
     /**
      * \brief Weights gradients input to hidden of the layer. 
      * Size: _hidden_size * input_size().
@@ -213,6 +276,22 @@ private:
      * and bias gradients do.
      */
     std::vector<NumType> _input_gradients;
+
+    // == Scratch buffers ==
+    /**
+     * \brief Input to hidden products of each time step.
+     * Size: _time_steps * _hidden_size.
+     */
+    std::vector<NumType> _input_projections;
+    /**
+     * \brief Gradients of the hidden pre-activations of each time step.
+     * Size: _time_steps * _hidden_size.
+     */
+    std::vector<NumType> _hidden_gradients;
+    /// \brief Temporary hidden products. Size: _hidden_size.
+    std::vector<NumType> _hidden_buffer;
+    /// \brief Hidden state gradient of the next time step. Size: _hidden_size.
+    std::vector<NumType> _hidden_state_gradient;
 };
 
 } // namespace EdgeLearning
@@ -0,0 +1,248 @@
+/***************************************************************************
+ *            dnn/scheduler.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scheduler.hpp"
+
+#include "betterthreads/task_manager.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace EdgeLearning {
+
+RunScheduler::RunScheduler(std::vector<Arc> run, SizeType parallel_threshold)
+    : _run{std::move(run)}
+    , _nodes{}
+    , _order{}
+    , _roots{}
+    , _acyclic{true}
+    , _width{0}
+    , _concurrent_work{0}
+    , _parallel_threshold{parallel_threshold}
+    , _parallel{false}
+{
+    std::unordered_map<const Layer*, SizeType> node_idx;
+    for (SizeType a_idx = 0; a_idx < _run.size(); ++a_idx)
+    {
+        auto it = node_idx.find(_run[a_idx].to.get());
+        if (it == node_idx.end())
+        {
+            it = node_idx.emplace(_run[a_idx].to.get(), _nodes.size()).first;
+            _nodes.push_back({{}, {}, 0});
+        }
+        _nodes[it->second].arcs.push_back(a_idx);
+    }
+
+    // A layer depends on the predecessors produced in the same run: the
+    // other ones (e.g. the input layers) are done before the run.
+    for (SizeType n_idx = 0; n_idx < _nodes.size(); ++n_idx)
+    {
+        for (auto a_idx: _nodes[n_idx].arcs)
+        {
+            auto it = node_idx.find(_run[a_idx].from.get());
+            if (it == node_idx.end()) continue;
+            auto& successors = _nodes[it->second].successors;
+            if (std::find(successors.begin(), successors.end(), n_idx)
+                == successors.end())
+            {
+                successors.push_back(n_idx);
+                ++_nodes[n_idx].dependencies;
+            }
+        }
+    }
+
+    // Levels of the run by Kahn's algorithm.
+    std::vector<SizeType> pending(_nodes.size());
+    std::vector<SizeType> level;
+    for (SizeType n_idx = 0; n_idx < _nodes.size(); ++n_idx)
+    {
+        pending[n_idx] = _nodes[n_idx].dependencies;
+        if (pending[n_idx] == 0) level.push_back(n_idx);
+    }
+    _roots = level;
+    while (!level.empty())
+    {
+        _width = std::max(_width, level.size());
+        SizeType level_work = 0;
+        SizeType max_work = 0;
+        std::vector<SizeType> next_level;
+        for (auto n_idx: level)
+        {
+            _order.push_back(n_idx);
+            const auto& layer = _run[_nodes[n_idx].arcs.front()].to;
+            SizeType work = _nodes[n_idx].arcs.size()
+                * (layer->param_count() + layer->input_size()
+                   + layer->output_size());
+            level_work += work;
+            max_work = std::max(max_work, work);
+            for (auto s_idx: _nodes[n_idx].successors)
+            {
+                if (--pending[s_idx] == 0) next_level.push_back(s_idx);
+            }
+        }
+        _concurrent_work += level_work - max_work;
+        level = std::move(next_level);
+    }
+    _acyclic = _order.size() == _nodes.size();
+
+    this->parallel_threshold(_parallel_threshold);
+}
+
+void RunScheduler::parallel_threshold(SizeType threshold)
+{
+    _parallel_threshold = threshold;
+    _parallel = _acyclic && _width > 1
+        && _concurrent_work >= _parallel_threshold;
+}
+
+bool RunScheduler::parallel() const
+{
+    return _parallel
+        && BetterThreads::TaskManager::instance().concurrency() > 1;
+}
+
+void RunScheduler::execute(const ArcFunction& f) const
+{
+    if (!_acyclic)
+    {
+        for (const auto& arc: _run) f(arc);
+    }
+    else if (parallel())
+    {
+        _execute_parallel(f);
+    }
+    else
+    {
+        for (auto n_idx: _order) _execute_node(n_idx, f);
+    }
+}
+
+void RunScheduler::_execute_node(SizeType node_idx, const ArcFunction& f) const
+{
+    for (auto a_idx: _nodes[node_idx].arcs) f(_run[a_idx]);
+}
+
+void RunScheduler::_execute_parallel(const ArcFunction& f) const
+{
+    auto& tm = BetterThreads::TaskManager::instance();
+
+    // The calling thread coordinates: it dispatches the ready layers, runs
+    // one of them itself and releases the successors of the done layers.
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<SizeType> completed;
+    std::exception_ptr error;
+
+    std::vector<SizeType> pending(_nodes.size());
+    for (SizeType n_idx = 0; n_idx < _nodes.size(); ++n_idx)
+    {
+        pending[n_idx] = _nodes[n_idx].dependencies;
+    }
+    std::vector<SizeType> ready(_roots);
+    std::vector<BetterThreads::Future<void>> futures;
+    SizeType done = 0;
+    SizeType in_flight = 0;
+
+    auto complete = [&](SizeType n_idx) {
+        ++done;
+        for (auto s_idx: _nodes[n_idx].successors)
+        {
+            if (--pending[s_idx] == 0) ready.push_back(s_idx);
+        }
+    };
+    auto run_node = [&](SizeType n_idx) {
+        try
+        {
+            _execute_node(n_idx, f);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+    };
+
+    while (done < _nodes.size())
+    {
+        bool failed;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            failed = static_cast<bool>(error);
+        }
+        if (failed)
+        {
+            // Stop dispatching and wait the layers still running.
+            ready.clear();
+            if (in_flight == 0) break;
+        }
+
+        while (ready.size() > 1)
+        {
+            auto n_idx = ready.back();
+            ready.pop_back();
+            ++in_flight;
+            futures.push_back(tm.enqueue([&, n_idx]() {
+                run_node(n_idx);
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    completed.push_back(n_idx);
+                }
+                cv.notify_one();
+            }));
+        }
+
+        if (!ready.empty())
+        {
+            auto n_idx = ready.back();
+            ready.pop_back();
+            run_node(n_idx);
+            complete(n_idx);
+        }
+        else if (in_flight > 0)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [&]() { return !completed.empty(); });
+        }
+
+        std::vector<SizeType> completed_nodes;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            completed_nodes.swap(completed);
+        }
+        for (auto n_idx: completed_nodes)
+        {
+            --in_flight;
+            complete(n_idx);
+        }
+    }
+
+    for (auto& future: futures) future.get();
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace EdgeLearning
@@ -0,0 +1,149 @@
+/***************************************************************************
+ *            dnn/scheduler.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/scheduler.hpp
+ *  \brief Dependency-counting scheduler of the runs of a DLGraph.
+ */
+
+#ifndef EDGE_LEARNING_DNN_SCHEDULER_HPP
+#define EDGE_LEARNING_DNN_SCHEDULER_HPP
+
+#include "dlgraph.hpp"
+
+#include <functional>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Scheduler of a run of arcs (DLGraph::forward_run,
+ * DLGraph::training_forward_run or DLGraph::backward_run).
+ *
+ * The arcs are grouped by destination layer: a layer is ready when all the
+ * layers producing its inputs in the run are done, then all its incoming
+ * arcs are executed in run order. The ready layers of independent branches
+ * are dispatched to the BetterThreads task manager and a counter of pending
+ * dependencies for each layer releases its successors.
+ *
+ * Dispatching a layer costs more than a small layer computation, hence the
+ * scheduler runs concurrently only if the work of the concurrent layers,
+ * estimated from their sizes, is at least parallel_threshold() and the task
+ * manager concurrency is more than one thread. Otherwise, or if the run has
+ * cycles, the layers are executed sequentially in the same dependency
+ * order.
+ */
+class RunScheduler
+{
+public:
+    using Arc = DLGraph::Arc;
+    using ArcFunction = std::function<void(const Arc&)>;
+
+    /// \brief Default minimum concurrent work to run in parallel.
+    static constexpr SizeType DEFAULT_PARALLEL_THRESHOLD = 1UL << 16;
+
+    /**
+     * \brief Build the schedule of a run.
+     * \param run                std::vector<Arc> The arcs in run order.
+     * \param parallel_threshold SizeType Minimum concurrent work estimate to
+     *                           run in parallel. 0 always runs in parallel
+     *                           when the graph has independent branches.
+     */
+    RunScheduler(std::vector<Arc> run = {},
+                 SizeType parallel_threshold = DEFAULT_PARALLEL_THRESHOLD);
+
+    /**
+     * \brief Execute the run: call the function on every arc.
+     * \param f const ArcFunction& The function called on each arc.
+     */
+    void execute(const ArcFunction& f) const;
+
+    /**
+     * \brief Setter of the minimum concurrent work to run in parallel.
+     * \param threshold SizeType The work estimate threshold.
+     */
+    void parallel_threshold(SizeType threshold);
+
+    [[nodiscard]] SizeType parallel_threshold() const
+    { return _parallel_threshold; }
+
+    /**
+     * \brief Getter of the arcs in run order.
+     * \return const std::vector<Arc>& The run.
+     */
+    [[nodiscard]] const std::vector<Arc>& run() const { return _run; }
+
+    /**
+     * \brief Getter of the maximum amount of layers ready at the same time.
+     * \return SizeType The width of the run.
+     */
+    [[nodiscard]] SizeType width() const { return _width; }
+
+    /**
+     * \brief Getter of the work estimate of the layers that can run
+     * concurrently: for each level of the run, the work of the level
+     * except its most expensive layer.
+     * \return SizeType The concurrent work estimate.
+     */
+    [[nodiscard]] SizeType concurrent_work() const
+    { return _concurrent_work; }
+
+    /**
+     * \brief Check if the run is executed concurrently.
+     * \return bool True if the independent branches run in parallel: the
+     * run is large enough and the task manager concurrency is more than 1.
+     */
+    [[nodiscard]] bool parallel() const;
+
+private:
+    /**
+     * \brief Destination layer of the run.
+     */
+    struct Node
+    {
+        std::vector<SizeType> arcs;       ///< Incoming arcs in run order.
+        std::vector<SizeType> successors; ///< Nodes depending on the node.
+        SizeType dependencies;            ///< Amount of predecessor nodes.
+    };
+
+    void _execute_node(SizeType node_idx, const ArcFunction& f) const;
+    void _execute_parallel(const ArcFunction& f) const;
+
+    std::vector<Arc> _run;
+    std::vector<Node> _nodes;
+    /// \brief Nodes in dependency order, level by level.
+    std::vector<SizeType> _order;
+    /// \brief Nodes without dependencies in the run.
+    std::vector<SizeType> _roots;
+    bool _acyclic;
+    SizeType _width;
+    SizeType _concurrent_work;
+    SizeType _parallel_threshold;
+    /// \brief True if the run is large enough to run in parallel.
+    bool _parallel;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_SCHEDULER_HPP
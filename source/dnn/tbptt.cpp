@@ -0,0 +1,133 @@
+/***************************************************************************
+ *            dnn/tbptt.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tbptt.hpp"
+
+#include "recurrent.hpp"
+#include "lstm.hpp"
+#include "gru.hpp"
+
+#include <stdexcept>
+
+
+namespace EdgeLearning {
+
+template <typename F>
+bool TruncatedBpttTrainer::_apply_recurrent(const Layer::SharedPtr& layer,
+                                            F&& f)
+{
+    if (auto r = std::dynamic_pointer_cast<RecurrentLayer>(layer))
+    {
+        f(*r);
+    }
+    else if (auto lstm = std::dynamic_pointer_cast<LstmLayer>(layer))
+    {
+        f(*lstm);
+    }
+    else if (auto gru = std::dynamic_pointer_cast<GruLayer>(layer))
+    {
+        f(*gru);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+TruncatedBpttTrainer::TruncatedBpttTrainer(
+    Model& model, Optimizer& optimizer, SizeType chunk_steps)
+    : _model{model}
+    , _optimizer{optimizer}
+    , _chunk_steps{chunk_steps}
+    , _recurrent_layers{}
+    , _chunk_input{}
+    , _chunk_target{}
+    , _input_size{0}
+    , _target_size{0}
+    , _pending_steps{0}
+    , _trained_chunks{0}
+{
+    if (_chunk_steps == 0)
+    {
+        throw std::runtime_error("chunk steps has to be greater than 0");
+    }
+
+    for (const auto& layer: _model.layers())
+    {
+        auto recurrent = _apply_recurrent(layer, [this](auto& l) {
+            l.time_steps(_chunk_steps);
+        });
+        if (recurrent) _recurrent_layers.push_back(layer);
+    }
+    if (_recurrent_layers.empty())
+    {
+        throw std::runtime_error("the model has no recurrent layers");
+    }
+}
+
+bool TruncatedBpttTrainer::push(const std::vector<NumType>& input,
+                                const std::vector<NumType>& target)
+{
+    if (_pending_steps == 0 && _trained_chunks == 0 && _input_size == 0)
+    {
+        // The first time step fixes the sizes of the chunk buffers.
+        _input_size = input.size();
+        _target_size = target.size();
+        _chunk_input.resize(_chunk_steps * _input_size);
+        _chunk_target.resize(_chunk_steps * _target_size);
+    }
+    if (input.size() != _input_size || target.size() != _target_size)
+    {
+        throw std::runtime_error("time step size differs from the stream");
+    }
+
+    std::copy(input.begin(), input.end(),
+              _chunk_input.data() + _pending_steps * _input_size);
+    std::copy(target.begin(), target.end(),
+              _chunk_target.data() + _pending_steps * _target_size);
+    if (++_pending_steps < _chunk_steps)
+    {
+        return false;
+    }
+
+    _model.step(_chunk_input, _chunk_target);
+    _model.train(_optimizer);
+    _pending_steps = 0;
+    ++_trained_chunks;
+    return true;
+}
+
+void TruncatedBpttTrainer::reset()
+{
+    _pending_steps = 0;
+    for (const auto& layer: _recurrent_layers)
+    {
+        _apply_recurrent(layer, [](auto& l) {
+            l.reset_hidden_state();
+        });
+    }
+}
+
+} // namespace EdgeLearning
@@ -0,0 +1,154 @@
+/***************************************************************************
+ *            dnn/tbptt.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  dnn/tbptt.hpp
+ *  \brief Truncated backpropagation through time trainer.
+ */
+
+#ifndef EDGE_LEARNING_DNN_TBPTT_HPP
+#define EDGE_LEARNING_DNN_TBPTT_HPP
+
+#include "model.hpp"
+#include "optimizer.hpp"
+
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief Truncated backpropagation through time over an unbounded stream.
+ *
+ * The stream is fed one time step at a time and it is trained in chunks of
+ * chunk_steps() time steps: each chunk is a Model::step followed by a
+ * Model::train. The time steps of every recurrent layer of the model
+ * (RecurrentLayer, LstmLayer and GruLayer) are set to chunk_steps(), so the
+ * memory is bounded by the chunk no matter how long the stream is.
+ *
+ * The recurrent layers carry the hidden state of the last time step to the
+ * next forward, while the backward stops at the first time step of the
+ * chunk: the state flows across chunks without gradient flow.
+ *
+ * The model inputs and the loss targets are the concatenation of the
+ * chunk_steps() time steps, hence the input and loss layers of the model
+ * have to be sized for a whole chunk.
+ */
+class TruncatedBpttTrainer
+{
+public:
+    /**
+     * \brief Construct the trainer and set the time steps of the recurrent
+     * layers of the model.
+     * \param model       Model& The model to train.
+     * \param optimizer   Optimizer& The optimizer applied after each chunk.
+     * \param chunk_steps SizeType The amount of time steps of a chunk.
+     */
+    TruncatedBpttTrainer(Model& model, Optimizer& optimizer,
+                         SizeType chunk_steps);
+
+    /**
+     * \brief Append a time step of the stream. When the chunk is complete,
+     * the model is trained on it.
+     * \param input  const std::vector<NumType>& Input of the time step.
+     * \param target const std::vector<NumType>& Target of the time step.
+     * \return bool True if a chunk has been trained.
+     */
+    bool push(const std::vector<NumType>& input,
+              const std::vector<NumType>& target);
+
+    /**
+     * \brief Push all the rows of a stream, e.g. a Dataset<NumType>, one
+     * time step per row. The incomplete chunk at the end of the stream is
+     * kept pending for the next push.
+     * \tparam Stream Type with size(), input(i) and label(i).
+     * \param stream const Stream& The stream to train.
+     * \return SizeType The amount of chunks trained.
+     */
+    template <typename Stream>
+    SizeType train(const Stream& stream)
+    {
+        SizeType chunks = 0;
+        for (SizeType i = 0; i < stream.size(); ++i)
+        {
+            chunks += push(stream.input(i), stream.label(i)) ? 1 : 0;
+        }
+        return chunks;
+    }
+
+    /**
+     * \brief Start a new stream: discard the pending time steps and reset
+     * the hidden state of the recurrent layers.
+     */
+    void reset();
+
+    /**
+     * \brief Getter of the chunk size in time steps.
+     * \return SizeType The time steps of a chunk.
+     */
+    [[nodiscard]] SizeType chunk_steps() const { return _chunk_steps; }
+
+    /**
+     * \brief Getter of the time steps waiting for a complete chunk.
+     * \return SizeType The pending time steps.
+     */
+    [[nodiscard]] SizeType pending_steps() const { return _pending_steps; }
+
+    /**
+     * \brief Getter of the amount of chunks trained since construction.
+     * \return SizeType The trained chunks.
+     */
+    [[nodiscard]] SizeType trained_chunks() const { return _trained_chunks; }
+
+private:
+    /**
+     * \brief Call a function on a layer casted to its recurrent type.
+     * \tparam F The function type, callable with RecurrentLayer&,
+     * LstmLayer& and GruLayer&.
+     * \param layer const Layer::SharedPtr& The layer.
+     * \param f     F&& The function to call.
+     * \return bool True if the layer is recurrent and f has been called.
+     */
+    template <typename F>
+    static bool _apply_recurrent(const Layer::SharedPtr& layer, F&& f);
+
+    Model& _model;
+    Optimizer& _optimizer;
+    SizeType _chunk_steps;
+
+    /// \brief Recurrent layers of the model.
+    std::vector<Layer::SharedPtr> _recurrent_layers;
+
+    /// \brief Inputs of the current chunk. Size: _chunk_steps * input size.
+    std::vector<NumType> _chunk_input;
+    /// \brief Targets of the current chunk. Size: _chunk_steps * target size.
+    std::vector<NumType> _chunk_target;
+    SizeType _input_size;     ///< Input size of a time step.
+    SizeType _target_size;    ///< Target size of a time step.
+    SizeType _pending_steps;  ///< Time steps in the current chunk.
+    SizeType _trained_chunks; ///< Amount of trained chunks.
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_DNN_TBPTT_HPP
@@ -31,7 +31,13 @@
 
 #include "type.hpp"
 #include "dnn/dlmath.hpp"
+#include "dnn/scheduler.hpp"
 #include "dnn/model.hpp"
+#include "dnn/model_file.hpp"
+#include "dnn/codegen.hpp"
+#include "dnn/tbptt.hpp"
+#include "dnn/pipeline.hpp"
+#include "dnn/graph_passes.hpp"
 #include "dnn/layer.hpp"
 #include "dnn/optimizer.hpp"
 #include "dnn/cce_loss.hpp"
@@ -39,11 +45,15 @@
 #include "dnn/dense.hpp"
 #include "dnn/activation.hpp"
 #include "dnn/recurrent.hpp"
+#include "dnn/lstm.hpp"
+#include "dnn/gru.hpp"
 #include "dnn/convolutional.hpp"
 #include "dnn/pooling.hpp"
 #include "dnn/max_pooling.hpp"
 #include "dnn/avg_pooling.hpp"
 #include "dnn/dropout.hpp"
+#include "dnn/concatenate.hpp"
+#include "dnn/fused.hpp"
 #include "dnn/optimizer.hpp"
 #include "dnn/gd_optimizer.hpp"
 #include "middleware/definitions.hpp"
@@ -53,6 +63,8 @@
 #include "data/dataset.hpp"
 #include "parser/type_checker.hpp"
 #include "parser/parser.hpp"
+#include "parser/json_document.hpp"
+#include "parser/json_stream.hpp"
 #include "parser/csv.hpp"
 #include "parser/mnist.hpp"
 
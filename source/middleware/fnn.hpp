@@ -31,6 +31,7 @@
 
 #include "nn.hpp"
 #include "layer_descriptor.hpp"
+#include "dnn/graph_passes.hpp"
 #if ENABLE_MLPACK
 #include "mlpack_fnn.hpp"
 #endif
@@ -166,12 +167,16 @@ public:
     EdgeFeedforwardNeuralNetwork(std::string name)
         : StaticNeuralNetwork<T>(name)
         , _m(StaticNeuralNetwork<T>::_name)
+        , _inference_m(StaticNeuralNetwork<T>::_name)
+        , _inference_outdated{true}
+        , _optimization_report{}
         , _output_shape{0}
         , _is_first_add{true}
     { }
 
     void add(LayerDescriptor ld) override
     {
+        _inference_outdated = true;
         if (_is_first_add)
         {
             _is_first_add = false;
@@ -224,17 +229,19 @@ public:
         _m.init(MapInit<Framework::EDGE_LEARNING, IT>::type,
                 Model::ProbabilityDensityFunction::NORMAL, seed);
         _fit(optimizer, data, epochs, batch_size, learning_rate);
+        _inference_outdated = true;
     }
 
     Dataset<T> predict(Dataset<T> &data) override
     {
-        auto output_size = _m.output_size();
+        _compile_inference();
+        auto output_size = _inference_m.output_size();
         std::vector<T> ret;
         ret.resize(data.size() * output_size);
 
         for (std::size_t i = 0; i < data.size(); ++i)
         {
-            auto res = _m.predict(data.entry(i));
+            auto res = _inference_m.predict(data.entry(i));
             std::copy(res.begin(), res.end(),
                       ret.begin() + long(i * output_size));
         }
@@ -244,7 +251,33 @@ public:
     SizeType input_size() override { return _m.input_size(); }
     SizeType output_size() override { return _m.output_size(); }
 
+    /**
+     * \brief Getter of the report of the graph passes applied to compile the
+     * inference model used by predict.
+     * \return const GraphPasses::Report& The layers removed, merged and fused.
+     */
+    const GraphPasses::Report& optimization_report()
+    {
+        _compile_inference();
+        return _optimization_report;
+    }
+
 private:
+    /**
+     * \brief Compile the inference model from the trained model, if the
+     * model changed since the last compilation. The inference model keeps
+     * no gradient buffers.
+     */
+    void _compile_inference()
+    {
+        if (!_inference_outdated) return;
+        GraphPasses passes;
+        _inference_m = passes.run(_m);
+        _inference_m.free_gradients();
+        _optimization_report = passes.report();
+        _inference_outdated = false;
+    }
+
     void _fit(OptimizerType optimizer,
               Dataset<T>& data,
               SizeType epochs, SizeType batch_size, NumType learning_rate)
@@ -372,6 +405,10 @@ private:
     }
 
     Model _m;
+    /// \brief Inference model compiled from _m by GraphPasses.
+    Model _inference_m;
+    bool _inference_outdated;
+    GraphPasses::Report _optimization_report;
     LayerShape _output_shape;
     bool _is_first_add;
 };
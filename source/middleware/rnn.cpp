@@ -24,8 +24,29 @@
 
 #include "middleware/rnn.hpp"
 
+#include <numeric>
+
 namespace EdgeLearning {
 
+std::vector<std::vector<SizeType>> bucket_by_length(
+    const std::vector<SizeType>& lengths, SizeType bucket_size)
+{
+    bucket_size = std::max(bucket_size, SizeType{1});
+    std::vector<SizeType> order(lengths.size());
+    std::iota(order.begin(), order.end(), SizeType{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&lengths](SizeType a, SizeType b) {
+                         return lengths[a] < lengths[b];
+                     });
 
+    std::vector<std::vector<SizeType>> buckets;
+    buckets.reserve((order.size() + bucket_size - 1) / bucket_size);
+    for (SizeType i = 0; i < order.size(); i += bucket_size)
+    {
+        auto end = std::min(i + bucket_size, order.size());
+        buckets.emplace_back(order.data() + i, order.data() + end);
+    }
+    return buckets;
+}
 
 } // namespace EdgeLearning
@@ -0,0 +1,415 @@
+/***************************************************************************
+ *            middleware/rnn.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  middleware/rnn.hpp
+ *  \brief Recurrent Neural Network on variable length sequences.
+ */
+
+#ifndef EDGE_LEARNING_MIDDLEWARE_RNN_HPP
+#define EDGE_LEARNING_MIDDLEWARE_RNN_HPP
+
+#include "definitions.hpp"
+
+#include "dnn/recurrent.hpp"
+#include "dnn/lstm.hpp"
+#include "dnn/gru.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+enum class RecurrentType
+{
+    Simple,
+    LSTM,
+    GRU
+};
+
+template <RecurrentType RT> struct MapRecurrent;
+
+template <>
+struct MapRecurrent<RecurrentType::Simple> {
+    using type = RecurrentLayer;
+};
+
+template <>
+struct MapRecurrent<RecurrentType::LSTM> {
+    using type = LstmLayer;
+};
+
+template <>
+struct MapRecurrent<RecurrentType::GRU> {
+    using type = GruLayer;
+};
+
+/**
+ * \brief Group the sequences in buckets of similar length.
+ * The sequences are sorted by length (stable on the index) and split in
+ * consecutive buckets of at most bucket_size sequences, so that the padding
+ * to the longest sequence of each bucket is minimized.
+ * \param lengths     const std::vector<SizeType>& Time steps of each sequence.
+ * \param bucket_size SizeType Maximum amount of sequences in a bucket.
+ * \return std::vector<std::vector<SizeType>> The sequence indexes of each
+ * bucket, sorted by increasing length.
+ */
+std::vector<std::vector<SizeType>> bucket_by_length(
+    const std::vector<SizeType>& lengths, SizeType bucket_size);
+
+/**
+ * \brief Performance metrics of a training or a prediction on variable
+ * length sequences.
+ */
+struct SequenceReport {
+    SizeType sequences = 0;    ///< \brief Amount of processed sequences.
+    SizeType buckets = 0;      ///< \brief Amount of processed buckets.
+    SizeType real_steps = 0;   ///< \brief Time steps of the sequences.
+    SizeType padded_steps = 0; ///< \brief Time steps including the padding.
+    NumType loss = 0.0;        ///< \brief Average loss (training only).
+    NumType seconds = 0.0;     ///< \brief Elapsed time.
+
+    /**
+     * \brief Fraction of computed time steps that are not padding.
+     * \return NumType real_steps / padded_steps, 1.0 without padding.
+     */
+    [[nodiscard]] NumType padding_efficiency() const
+    {
+        return padded_steps == 0 ? NumType{1.0}
+            : static_cast<NumType>(real_steps)
+            / static_cast<NumType>(padded_steps);
+    }
+
+    /**
+     * \brief Throughput of the processing.
+     * \return NumType Sequences per second.
+     */
+    [[nodiscard]] NumType sequences_per_second() const
+    {
+        return seconds <= 0.0 ? NumType{0.0}
+            : static_cast<NumType>(sequences) / seconds;
+    }
+};
+
+/**
+ * \brief Recurrent neural network trained on variable length sequences.
+ * Each sequence is a vector of time steps of input_size() elements and its
+ * label has output_size() elements for each time step. The sequences are
+ * grouped in buckets of similar length by bucket_by_length(): each bucket is
+ * padded at the end to its longest sequence, so that the recurrent layer is
+ * resized once per bucket, and it is trained as a batch with one optimizer
+ * step. The loss gradients are averaged over the real time steps of the
+ * bucket, so that the step size depends neither on the amount of sequences
+ * of the bucket nor on their lengths. The padded time steps receive no
+ * gradient, hence they do not contribute to the training.
+ * \tparam RT The recurrent layer type.
+ * \tparam LT The loss type applied to each time step.
+ * \tparam IT The initialization type.
+ * \tparam T  Learning Parameters type.
+ */
+template<
+    RecurrentType RT = RecurrentType::LSTM,
+    LossType LT = LossType::MSE,
+    InitType IT = InitType::AUTO,
+    typename T = NumType>
+class EdgeRecurrentNeuralNetwork {
+public:
+    using RecurrentLayerType = typename MapRecurrent<RT>::type;
+    using LossLayerType = typename MapLoss<Framework::EDGE_LEARNING, LT>::type;
+    using Sequences = std::vector<std::vector<T>>;
+
+    /**
+     * \brief Construct the recurrent network.
+     * \param name        std::string The name of the model.
+     * \param input_size  SizeType Input size of a time step.
+     * \param output_size SizeType Output size of a time step.
+     * \param hidden_size SizeType Hidden state size.
+     */
+    EdgeRecurrentNeuralNetwork(std::string name, SizeType input_size,
+                               SizeType output_size, SizeType hidden_size)
+        : _name{std::move(name)}
+        , _layer{_name + "_recurrent", input_size, output_size,
+                 hidden_size, 1}
+        , _is_init{false}
+        , _report{}
+        , _padded_input{}
+        , _output_gradients{}
+        , _step_output{}
+        , _step_label{}
+    {
+        if (input_size == 0 || output_size == 0 || hidden_size == 0)
+        {
+            throw std::runtime_error("RNN sizes have to be greater than 0");
+        }
+    }
+
+    /**
+     * \brief Perform the training of the model with the given sequences.
+     * \param inputs        const Sequences& The input sequences.
+     * \param labels        const Sequences& The labels of each time step of
+     *                      the input sequences.
+     * \param optimizer     The optimizer to use for training.
+     * \param epochs        The number of iterations over the sequences.
+     * \param bucket_size   The number of sequences of a bucket, trained as
+     *                      a batch.
+     * \param learning_rate The optimization step size.
+     * \param seed          Seed random generator. If 0, it is unpredictable.
+     * \return const SequenceReport& The metrics of the training.
+     */
+    const SequenceReport& fit(const Sequences& inputs,
+                              const Sequences& labels,
+                              OptimizerType optimizer = OptimizerType::ADAM,
+                              SizeType epochs = 1,
+                              SizeType bucket_size = 1,
+                              NumType learning_rate = 0.03,
+                              RneType::result_type seed = 0)
+    {
+        if (inputs.size() != labels.size())
+        {
+            throw std::runtime_error(
+                "Training error: inputs and labels amount differ");
+        }
+        auto lengths = _lengths(inputs);
+        for (SizeType i = 0; i < labels.size(); ++i)
+        {
+            if (labels[i].size() != lengths[i] * output_size())
+            {
+                throw std::runtime_error(
+                    "Training error: label size differs from the sequence");
+            }
+        }
+
+        if (!_is_init)
+        {
+            if (seed == 0)
+            {
+                std::random_device rd{};
+                seed = rd();
+            }
+            _layer.init(IT == InitType::HE_INIT
+                            ? Layer::InitializationFunction::KAIMING
+                            : Layer::InitializationFunction::XAVIER,
+                        Layer::ProbabilityDensityFunction::NORMAL,
+                        RneType{seed});
+            _is_init = true;
+        }
+
+        switch (optimizer) {
+            case OptimizerType::GRADIENT_DESCENT:
+            {
+                using optimizer_type = typename MapOptimizer<
+                    Framework::EDGE_LEARNING,
+                    OptimizerType::GRADIENT_DESCENT>::type;
+                auto o = optimizer_type(learning_rate);
+                _fit(o, inputs, labels, lengths, epochs, bucket_size);
+                break;
+            }
+            case OptimizerType::ADAM:
+            default:
+            {
+                using optimizer_type = typename MapOptimizer<
+                    Framework::EDGE_LEARNING, OptimizerType::ADAM>::type;
+                auto o = optimizer_type(learning_rate);
+                _fit(o, inputs, labels, lengths, epochs, bucket_size);
+                break;
+            }
+        }
+        return _report;
+    }
+
+    /**
+     * \brief Perform the prediction of the given sequences. The sequences are
+     * processed by length buckets, so the recurrent layer is resized once
+     * for each distinct length.
+     * \param inputs const Sequences& The input sequences.
+     * \return Sequences The output of each time step of each sequence.
+     */
+    Sequences predict(const Sequences& inputs)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        auto lengths = _lengths(inputs);
+        Sequences ret(inputs.size());
+        _report = SequenceReport{};
+        for (const auto& bucket: bucket_by_length(lengths, inputs.size()))
+        {
+            for (auto i: bucket)
+            {
+                if (_layer.time_steps() != lengths[i])
+                {
+                    _layer.time_steps(lengths[i]);
+                    ++_report.buckets;
+                }
+                _layer.reset_hidden_state();
+                const auto& out = _layer.forward(inputs[i]);
+                ret[i].assign(out.begin(), out.end());
+                _report.real_steps += lengths[i];
+            }
+        }
+        _report.sequences = inputs.size();
+        _report.padded_steps = _report.real_steps;
+        _report.seconds = _elapsed(begin);
+        return ret;
+    }
+
+    /**
+     * \brief Getter of the metrics of the last fit or predict.
+     * \return const SequenceReport& The metrics.
+     */
+    [[nodiscard]] const SequenceReport& report() const { return _report; }
+
+    [[nodiscard]] SizeType input_size() const { return _layer.input_size(); }
+    [[nodiscard]] SizeType output_size() const { return _layer.output_size(); }
+
+    /**
+     * \brief Getter of the recurrent layer.
+     * \return RecurrentLayerType& The layer.
+     */
+    RecurrentLayerType& layer() { return _layer; }
+
+private:
+    template <typename O>
+    void _fit(O& o, const Sequences& inputs, const Sequences& labels,
+              const std::vector<SizeType>& lengths,
+              SizeType epochs, SizeType bucket_size)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        auto buckets = bucket_by_length(lengths, bucket_size);
+        LossLayerType loss{_name + "_loss", output_size()};
+
+        _report = SequenceReport{};
+        for (SizeType e = 0; e < epochs; ++e)
+        {
+            for (const auto& bucket: buckets)
+            {
+                _train_bucket(o, loss, bucket, inputs, labels, lengths);
+            }
+        }
+        _report.sequences = inputs.size() * epochs;
+        _report.buckets = buckets.size() * epochs;
+        _report.loss = _report.real_steps == 0 ? NumType{0.0} : loss.avg_loss();
+        _report.seconds = _elapsed(begin);
+    }
+
+    template <typename O>
+    void _train_bucket(O& o, LossLayerType& loss,
+                       const std::vector<SizeType>& bucket,
+                       const Sequences& inputs, const Sequences& labels,
+                       const std::vector<SizeType>& lengths)
+    {
+        auto steps = lengths[bucket.back()];
+        auto in_size = input_size();
+        auto out_size = output_size();
+        if (steps == 0) return;
+
+        // Average the gradients over the real time steps of this bucket,
+        // that can be smaller than the others.
+        SizeType real_steps = 0;
+        for (auto i: bucket) real_steps += lengths[i];
+        loss.batch_size(real_steps);
+
+        // Resize once for the whole bucket.
+        _layer.time_steps(steps);
+        _padded_input.resize(steps * in_size);
+        _output_gradients.resize(steps * out_size);
+        _step_output.resize(out_size);
+        _step_label.resize(out_size);
+
+        for (auto i: bucket)
+        {
+            const auto& input = inputs[i];
+            const auto& label = labels[i];
+            std::copy(input.begin(), input.end(), _padded_input.begin());
+            std::fill(_padded_input.data() + input.size(),
+                      _padded_input.data() + _padded_input.size(), T{0});
+
+            _layer.reset_hidden_state();
+            const auto& out = _layer.training_forward(_padded_input);
+
+            std::fill(_output_gradients.begin(), _output_gradients.end(),
+                      NumType{0.0});
+            for (SizeType t = 0; t < lengths[i]; ++t)
+            {
+                std::copy(out.data() + t * out_size,
+                          out.data() + (t + 1) * out_size,
+                          _step_output.begin());
+                std::copy(label.data() + t * out_size,
+                          label.data() + (t + 1) * out_size,
+                          _step_label.begin());
+                loss.set_target(_step_label);
+                loss.training_forward(_step_output);
+                const auto& g = loss.backward(_step_output);
+                std::copy(g.begin(), g.end(),
+                          _output_gradients.data() + t * out_size);
+            }
+            _layer.backward(_output_gradients);
+
+            _report.real_steps += lengths[i];
+            _report.padded_steps += steps;
+        }
+        o.train(_layer);
+    }
+
+    std::vector<SizeType> _lengths(const Sequences& inputs) const
+    {
+        std::vector<SizeType> lengths(inputs.size());
+        auto in_size = input_size();
+        for (SizeType i = 0; i < inputs.size(); ++i)
+        {
+            if (inputs[i].size() % in_size != 0)
+            {
+                throw std::runtime_error(
+                    "sequence size is not a multiple of the input size");
+            }
+            lengths[i] = inputs[i].size() / in_size;
+        }
+        return lengths;
+    }
+
+    static NumType _elapsed(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration<NumType>(
+            std::chrono::steady_clock::now() - begin).count();
+    }
+
+    std::string _name;
+    RecurrentLayerType _layer;
+    bool _is_init;
+    SequenceReport _report;
+
+    /// \brief Input of a sequence padded to the bucket length.
+    std::vector<T> _padded_input;
+    /// \brief Output gradients of a sequence, zero on the padding.
+    std::vector<NumType> _output_gradients;
+    /// \brief Output and label of a time step for the loss.
+    std::vector<NumType> _step_output;
+    std::vector<NumType> _step_label;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_MIDDLEWARE_RNN_HPP
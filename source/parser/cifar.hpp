@@ -31,8 +31,10 @@
 
 #include "parser.hpp"
 #include "data/path.hpp"
+#include "data/mapped_file.hpp"
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <fstream>
@@ -100,6 +102,20 @@ public:
                   IMAGE_SIDE * IMAGE_SIDE * IMAGE_CHANNELS);
     }
 
+    /**
+     * \brief Cifar Image constructor.
+     * \param data The side * side * channels bytes of the Cifar image.
+     * \param idx The image index in the dataset.
+     * \param order The order of shape of Cifar image requested later in output.
+     */
+    CifarImage(const std::uint8_t* data, std::size_t idx,
+               CifarShapeOrder order = CifarShapeOrder::CHN_ROW_COL)
+        : Parser()
+        , _image(data, data + IMAGE_SIDE * IMAGE_SIDE * IMAGE_CHANNELS)
+        , _idx{idx}
+        , _order{order}
+    { }
+
     /**
      * \brief CifarImage default deconstruct.
      */
@@ -236,6 +252,23 @@ public:
         }
     }
 
+    /**
+     * \brief Cifar Label constructor.
+     * \param data    The label bytes: the coarse label followed by the fine
+     * label in case of Cifar-100.
+     * \param idx     The label index in the dataset.
+     * \param dataset The dataset format in input data.
+     */
+    CifarLabel(const std::uint8_t* data, std::size_t idx,
+               CifarDataset dataset = CifarDataset::CIFAR_10)
+        : Parser()
+        , _dataset_format{dataset}
+        , _coarse_label{data[0]}
+        , _fine_label{dataset == CifarDataset::CIFAR_100 ? data[1]
+                                                         : std::uint8_t{0}}
+        , _idx{idx}
+    { }
+
     /**
      * \brief CifarLabel default deconstruct.
      */
@@ -338,12 +371,20 @@ struct CifarItem
 
 /**
  * \brief Cifar Dataset core class.
+ * The batch file is memory mapped once: the images are accessed as bytes in
+ * the mapped file without reads or copies.
+ * The records beyond the end of a truncated file are zeros.
  */
 class Cifar : public DatasetParser
 {
 public:
     /// @brief The dataset size.
     static const std::uint32_t SIZE = 10000;
+    /// @brief The size in bytes of an image.
+    static const std::size_t IMAGE_BYTES = CifarImage::IMAGE_SIDE
+        * CifarImage::IMAGE_SIDE * CifarImage::IMAGE_CHANNELS;
+    /// @brief Minimum amount of entries converted by each worker of entries().
+    static const std::size_t PARALLEL_CHUNK_ENTRIES = 64;
 
     /**
      * \brief Cifar core class constructor.
@@ -355,13 +396,22 @@ public:
           CifarDataset dataset = CifarDataset::CIFAR_10,
           fs::path fine_label_meta_fp = fs::path())
         : DatasetParser()
-        , _batch_ifs{batch_fp}
+        , _batch{}
         , _order{order}
         , _dataset{dataset}
         , _coarse_label_names{}
         , _fine_label_names{}
         , _label_offset{}
     {
+        try
+        {
+            _batch = std::make_unique<MappedFile>(batch_fp);
+        }
+        catch (const std::runtime_error&)
+        {
+            throw std::runtime_error("Batch malformed: could not open file");
+        }
+
         std::ifstream coarse_label_meta_ifs(coarse_label_meta_fp);
         std::string line;
         while (std::getline(coarse_label_meta_ifs, line))
@@ -402,12 +452,9 @@ public:
 
     /**
      * \brief Cifar object deconstruct.
-     * Clone image and label file streams.
+     * Unmap the batch file.
      */
-    ~Cifar()
-    {
-        _batch_ifs.close();
-    }
+    ~Cifar() = default;
 
     /**
      * \brief Getter of the data amount in the dataset.
@@ -476,20 +523,25 @@ public:
     const std::vector<std::string>& fine_label_names() const
     { return _fine_label_names; }
 
+    /**
+     * \brief Get the bytes of an image in the mapped file, without copies.
+     * The bytes are in the CHN_ROW_COL order of the batch file.
+     * \param idx The index of the Cifar image.
+     * \return const std::uint8_t* The IMAGE_BYTES bytes of the image.
+     */
+    const std::uint8_t* image_data(std::size_t idx) const
+    {
+        return _record(idx) + _label_offset;
+    }
+
     /**
      * \brief Get an image from the Cifar dataset at index.
      * \param idx The index of the Cifar image.
      * \return CifarImage The image object at idx index.
      */
-    CifarImage image(std::size_t idx)
+    CifarImage image(std::size_t idx) const
     {
-        idx = idx % SIZE;
-        _batch_ifs.seekg(
-            static_cast<std::int64_t>(
-                (idx * (height() * width() * channels() + _label_offset))
-                + _label_offset),
-            _batch_ifs.beg);
-        return CifarImage{_batch_ifs, idx, _order};
+        return CifarImage{image_data(idx), idx % SIZE, _order};
     }
 
     /**
@@ -497,13 +549,9 @@ public:
      * \param idx The index of the Cifar label.
      * \return CifarLabel The label object at idx index.
      */
-    CifarLabel label(std::size_t idx)
+    CifarLabel label(std::size_t idx) const
     {
-        idx = idx % SIZE;
-        _batch_ifs.seekg(static_cast<std::int64_t>(
-            idx * (height() * width() * channels() + _label_offset)),
-            _batch_ifs.beg);
-        return CifarLabel{_batch_ifs, idx, _dataset};
+        return CifarLabel{_record(idx), idx % SIZE, _dataset};
     }
 
     /**
@@ -518,27 +566,40 @@ public:
 
     std::vector<NumType> entry(SizeType i) override
     {
-        auto cifar_image = image(i).data();
-        auto cifar_label = label(i);
-        std::vector<NumType> ret(cifar_image.begin(), cifar_image.end());
+        std::vector<NumType> ret(feature_size());
+        _entry(i, ret.data());
+        return ret;
+    }
 
-        switch(_dataset)
-        {
-            case CifarDataset::CIFAR_100:
-            {
-                ret.push_back(cifar_label.fine_label());
-                break;
-            }
-            case CifarDataset::CIFAR_10:
-            default:
-            {
-                ret.push_back(cifar_label.data());
-                break;
-            }
-        }
+    std::vector<NumType> entries() override
+    {
+        std::vector<NumType> ret(entries_amount() * feature_size());
+        entries(ret.data());
         return ret;
     }
 
+    /**
+     * \brief Convert all the entries in a preallocated row-major buffer, with
+     * the images in the requested shape order.
+     * The entries are split in chunks converted in parallel.
+     * \tparam T The arithmetic type of the buffer.
+     * \param dst     The buffer of entries_amount() * feature_size() elements.
+     * \param workers The maximum amount of parallel chunks, 0 to use the
+     * task manager concurrency.
+     */
+    template<typename T>
+    void entries(T* dst, std::size_t workers = 0) const
+    {
+        _parallel_chunks(
+            entries_amount(), PARALLEL_CHUNK_ENTRIES, workers,
+            [this, dst](SizeType from, SizeType to) {
+                for (SizeType i = from; i < to; ++i)
+                {
+                    _entry(i, dst + i * feature_size());
+                }
+            });
+    }
+
     SizeType entries_amount() const override
     {
         return size();
@@ -577,8 +638,62 @@ public:
     }
 
 private:
+    /// @brief Record of the entries beyond the end of a truncated file.
+    static constexpr std::uint8_t ZERO_RECORD[IMAGE_BYTES + 2] = {};
+
+    /**
+     * \brief Get the bytes of a record in the mapped file: the labels
+     * followed by the image.
+     * \param idx The index of the record.
+     * \return const std::uint8_t* The record bytes.
+     */
+    const std::uint8_t* _record(std::size_t idx) const
+    {
+        const auto record_size = IMAGE_BYTES + _label_offset;
+        auto offset = (idx % SIZE) * record_size;
+        if (offset + record_size > _batch->size()) return ZERO_RECORD;
+        return _batch->data() + offset;
+    }
+
+    /**
+     * \brief Convert an entry, the image in the requested shape order
+     * followed by the label (the fine label in case of Cifar-100).
+     * \tparam T The arithmetic type of the entry.
+     * \param i   The index of the entry.
+     * \param dst The buffer of feature_size() elements.
+     */
+    template<typename T>
+    void _entry(SizeType i, T* dst) const
+    {
+        const auto* record = _record(i);
+        const auto* image = record + _label_offset;
+        switch (_order)
+        {
+            case CifarShapeOrder::ROW_COL_CHN:
+            {
+                const auto pixels = height() * width();
+                for (SizeType p = 0; p < pixels; ++p)
+                {
+                    for (SizeType c = 0; c < channels(); ++c)
+                    {
+                        dst[p * channels() + c] =
+                            static_cast<T>(image[c * pixels + p]);
+                    }
+                }
+                break;
+            }
+            case CifarShapeOrder::CHN_ROW_COL:
+            default:
+            {
+                _bytes_to(image, dst, IMAGE_BYTES);
+                break;
+            }
+        }
+        dst[IMAGE_BYTES] = static_cast<T>(
+            _dataset == CifarDataset::CIFAR_100 ? record[1] : record[0]);
+    }
 
-    std::ifstream _batch_ifs; ///< \brief Images input stream.
+    std::unique_ptr<MappedFile> _batch; ///< \brief Mapped batch file.
     CifarShapeOrder _order;   ///< \brief Images shape order in output.
     CifarDataset _dataset;    ///< \brief Dataset type format.
 
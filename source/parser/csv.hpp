@@ -30,16 +30,22 @@
 #define EDGE_LEARNING_PARSER_CSV_HPP
 
 #include "parser.hpp"
+#include "data/mapped_file.hpp"
+#include "betterthreads/task_manager.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cstddef>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <sstream>
-#include <fstream>
 #include <vector>
 #include <iostream>
-#include <limits>
+#include <memory>
 #include <stdexcept>
 #include <iterator>
+#include <type_traits>
 
 namespace EdgeLearning {
 
@@ -439,6 +445,88 @@ private:
     char _separator;           ///< The separator of each field.
 };
 
+/**
+ * \brief The lines of a CSV file.
+ * The file is memory mapped and the offsets of the lines are indexed in a
+ * single pass, so that any line is accessed in O(1) without copying the file.
+ */
+class CSVLines
+{
+public:
+    /**
+     * \brief Map the file and index the offset of each line.
+     * \param fn The path of the CSV file.
+     * The constructor throws a std::runtime_error if the file fails on open.
+     */
+    explicit CSVLines(const std::string& fn)
+        : _file{fn}
+        , _offsets{0}
+        , _lines_amount{0}
+    {
+        const auto* begin = reinterpret_cast<const char*>(_file.data());
+        const auto size = _file.size();
+        for (std::size_t off = 0; off < size; )
+        {
+            const auto* nl = static_cast<const char*>(
+                std::memchr(begin + off, '\n', size - off));
+            if (!nl) break;
+            off = static_cast<std::size_t>(nl - begin) + 1;
+            _offsets.push_back(off);
+        }
+        _lines_amount = _offsets.size() - 1;
+        // A last line without the newline is indexed as it had one.
+        if (_offsets.back() < size) _offsets.push_back(size + 1);
+    }
+
+    /**
+     * \brief Amount of lines terminated by a newline.
+     * \return std::size_t
+     */
+    std::size_t size() const { return _lines_amount; }
+
+    /**
+     * \brief Get a line without the newline character.
+     * \param idx The index of the line.
+     * \return std::string_view The line in the mapped file, empty if idx is
+     * beyond the end of the file.
+     */
+    std::string_view operator[](std::size_t idx) const
+    {
+        if (idx + 1 >= _offsets.size()) return {};
+        return std::string_view{
+            reinterpret_cast<const char*>(_file.data()) + _offsets[idx],
+            _offsets[idx + 1] - _offsets[idx] - 1};
+    }
+
+    /**
+     * \brief Get the offset of a line in the file.
+     * \param idx The index of the line, up to size().
+     * \return std::size_t The offset of the first character of the line.
+     */
+    std::size_t offset(std::size_t idx) const
+    {
+        return _offsets[std::min(idx, _offsets.size() - 1)];
+    }
+
+    /**
+     * \brief Get the index of the first line that starts at or after an
+     * offset in the file.
+     * \param off The offset in the file.
+     * \return std::size_t The index of the line.
+     */
+    std::size_t line_at(std::size_t off) const
+    {
+        return static_cast<std::size_t>(
+            std::lower_bound(_offsets.begin(), _offsets.end(), off)
+            - _offsets.begin());
+    }
+
+private:
+    MappedFile _file;                  ///< The mapped CSV file.
+    std::vector<std::size_t> _offsets; ///< Line offsets and the end offset.
+    std::size_t _lines_amount;         ///< Lines terminated by a newline.
+};
+
 /**
  * \brief Iterator pattern for CSV class.
  */
@@ -450,23 +538,22 @@ public:
     
     /**
      * \brief Construct a new CSVIterator object.
-     * \param fn          Filename of CSV file.
+     * \param lines       The indexed lines of the CSV file.
      * \param idx         Index of CSV row.
      * \param cols_amount Number of columns.
      * \param types       The list of types of each field.
      * \param separator   The separator of each field.
      * Initialize the internal CSVRow with the types list, the separator, the 
      * column amount and the requested row index. 
-     * Open a file stream to input path fn. 
      */
-    CSVIterator(std::string fn, std::size_t idx, std::size_t cols_amount,
-        std::vector<TypeChecker::Type>& types, char separator = ',')
-        : _fn{fn}
-        , _row{std::string(), 0, cols_amount, types, separator}
+    CSVIterator(std::shared_ptr<const CSVLines> lines, std::size_t idx,
+        std::size_t cols_amount, std::vector<TypeChecker::Type>& types,
+        char separator = ',')
+        : _lines{std::move(lines)}
+        , _row{std::string((*_lines)[0]), 0, cols_amount, types, separator}
         , _req_row_idx{idx}
-        , _stream{fn}
     {
-        std::getline(_stream, _row._line);
+
     }
 
     /**
@@ -474,23 +561,17 @@ public:
      * \param obj Object to copy.
      */
     CSVIterator(const CSVIterator& obj)
-        : _fn{obj._fn}
-        , _row{std::string(), 0, obj._row._cols_amount, 
-            obj._row._types, obj._row._separator}
+        : _lines{obj._lines}
+        , _row{obj._row}
         , _req_row_idx{obj._req_row_idx}
-        , _stream{obj._fn}
     {
-        std::getline(_stream, _row._line);
+
     }
 
     /**
      * \brief Destroy the CSVIterator object
-     * Clone file stream.
      */
-    ~CSVIterator()
-    {
-        _stream.close();
-    }
+    ~CSVIterator() = default;
 
     /**
      * \brief Access the requested CSVRow reference in CSV file and index.
@@ -584,30 +665,17 @@ private:
      */
     void update_row()
     {
-        if (_req_row_idx < _row._idx) 
-        {
-            _row._idx = 0;
-            _stream.seekg(0);
-            std::getline(_stream, _row._line);
-        }
-
-        for (std::size_t i = _row._idx + 1; i < _req_row_idx; ++i)
-        {
-            _stream.ignore(
-                std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-
         if (_row._idx != _req_row_idx)
         {
-            std::getline(_stream, _row._line);
+            _row._line = std::string((*_lines)[_req_row_idx]);
             _row._idx = _req_row_idx;
         }
     }
 
     /**
-     * \brief Path of the CSV file.
+     * \brief Indexed lines of the CSV file, shared with the CSV object.
      */
-    std::string _fn; 
+    std::shared_ptr<const CSVLines> _lines;
 
     /**
      * \brief CSVRow object updated and returned on iterator request.
@@ -615,58 +683,58 @@ private:
     CSVRow _row;
     
     /**
-     * \brief
+     * \brief Index of the requested row.
      */
     std::size_t _req_row_idx;
-    
-    /**
-     * \brief Input stream used to read the CSV file.
-     */
-    std::ifstream _stream;
 };
 
 
 class CSV : public DatasetParser
 {
 public:
+    /**
+     * \brief Minimum amount of bytes parsed by each worker of entries().
+     */
+    static constexpr std::size_t PARALLEL_CHUNK_BYTES = 1UL << 20;
+
+    /**
+     * \brief Default amount of rows sampled to infer the column types.
+     */
+    static constexpr std::size_t TYPES_SAMPLE_ROWS = 100;
+
     /**
      * \brief Construct a new CSV object.
-     * \param fn        The path of the CSV file.
-     * \param types     The list of types of each field.
-     * \param separator The separator of each field.
+     * \param fn           The path of the CSV file.
+     * \param types        The list of types of each field.
+     * \param separator    The separator of each field.
+     * \param labels_idx   The indexes of the label columns.
+     * \param types_sample The amount of rows sampled to infer the types.
      * If the list of types is not compliant to the colums amount of the CSV 
-     * file or it contains the TypeChecker::Type::AUTO, then the types list is automatically
-     * computed using the second line of the CSV file.
+     * file or it contains the TypeChecker::Type::AUTO, then the types list is
+     * inferred once from types_sample rows evenly spaced in the file (see
+     * TypeChecker::merge) and cached, so that the rows never infer it again.
+     * The file is memory mapped and its lines are indexed once, so that each
+     * row is accessed in O(1).
      * The constructor throws a std::runtime_error if the file fails on open.
      */
     CSV(std::string fn, std::vector<TypeChecker::Type> types = { TypeChecker::Type::AUTO }, 
-        char separator = ',', std::set<SizeType> labels_idx = {})
+        char separator = ',', std::set<SizeType> labels_idx = {},
+        std::size_t types_sample = TYPES_SAMPLE_ROWS)
         : DatasetParser()
         , _fn{fn}
-        , _types{types}
+        , _lines{std::make_shared<const CSVLines>(fn)}
+        , _types{}
         , _row_header{_types}
         , _row_cache{_types}
         , _separator{separator}
         , _labels_idx{labels_idx}
     {
-        auto file = std::ifstream{fn};
-        if(!file.is_open() || !file.good()) 
-        {
-            throw std::runtime_error("Could not open file");
-        }
-
         // Get number of rows.
-        file.unsetf(std::ios_base::skipws);
-        _rows_amount = static_cast<std::size_t>(
-            std::count(std::istream_iterator<char>(file), 
-                std::istream_iterator<char>(), '\n'));
-        file.clear();
-        file.seekg(0);
+        _rows_amount = _lines->size();
 
         // Get first two lines.
-        std::string header, first_line;
-        std::getline(file, header);
-        std::getline(file, first_line);
+        auto header = std::string((*_lines)[0]);
+        auto first_line = std::string((*_lines)[1]);
 
         // Get number of columns.
         _cols_amount = static_cast<std::size_t>(
@@ -676,13 +744,7 @@ public:
             || types.size() == 0
             || types.size() != _cols_amount) 
         {
-            std::stringstream ss{first_line};
-            for (std::size_t i = 0; i < _cols_amount; ++i)
-            {
-                std::string s;
-                std::getline(ss, s, separator);
-                _types.push_back(_tc(s));
-            }
+            _types = _infer_types(types_sample);
         }
         else 
         {
@@ -691,7 +753,6 @@ public:
 
         _row_header = CSVRow{header,     0, _cols_amount, _types, separator};
         _row_cache  = CSVRow{first_line, 1, _cols_amount, _types, separator};
-        file.close();
     }
 
     /**
@@ -735,17 +796,8 @@ public:
         // Handle overflow with a circular indexing.
         idx = idx % _rows_amount; 
 
-        auto file = std::ifstream{_fn};
-        // file.seekg(_row_header._line.size() + 1);
-        for (std::size_t i = 0; i < idx; ++i)
-        {
-            file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-
-        std::string line;
-        std::getline(file, line);
-        _row_cache = CSVRow{line, idx, _cols_amount, _types, _separator};
-        file.close();
+        _row_cache = CSVRow{std::string((*_lines)[idx]), idx, _cols_amount,
+                            _types, _separator};
         return CSVRow{_row_cache};
     }
 
@@ -756,7 +808,7 @@ public:
      */
     CSVIterator begin()
     { 
-        return CSVIterator{_fn, 1, _cols_amount, _types, _separator}; 
+        return CSVIterator{_lines, 1, _cols_amount, _types, _separator}; 
     }
     
     /**
@@ -765,7 +817,7 @@ public:
      */
     CSVIterator end()
     { 
-        return CSVIterator{_fn, _rows_amount - 1, _cols_amount, _types, 
+        return CSVIterator{_lines, _rows_amount - 1, _cols_amount, _types, 
                            _separator}; 
     }
 
@@ -777,16 +829,10 @@ public:
     {
         std::vector<std::string> ret;
         ret.resize(_rows_amount);
-
-        auto file = std::ifstream{_fn};
-        std::string line;
         for (std::size_t i = 0; i < _rows_amount; ++i)
         {
-            if (!std::getline(file, line)) break;
-            ret[i] = line;
+            ret[i] = std::string((*_lines)[i]);
         }
-
-        file.close();
         return ret;
     }
 
@@ -797,16 +843,12 @@ public:
     operator std::vector<CSVRow>()
     {
         std::vector<CSVRow> ret{};
-
-        auto file = std::ifstream{_fn};
-        std::string line;
+        ret.reserve(_rows_amount);
         for (std::size_t i = 0; i < _rows_amount; ++i)
         {
-            if (!std::getline(file, line)) break;
-            ret.push_back(CSVRow{line, i, _cols_amount, _types, _separator});
+            ret.push_back(CSVRow{std::string((*_lines)[i]), i, _cols_amount,
+                                 _types, _separator});
         }
-
-        file.close();
         return ret;
     }
 
@@ -821,16 +863,11 @@ public:
     {
         std::vector<std::vector<T>> ret;
         ret.resize(_rows_amount);
-
-        auto file = std::ifstream{_fn};
-        std::string line;
         for (std::size_t i = 0; i < _rows_amount; ++i)
         {
-            if (!std::getline(file, line)) break;
-            ret[i] = std::vector<T>(CSVRow{line, i, _cols_amount, _types, _separator});
+            ret[i] = std::vector<T>(CSVRow{std::string((*_lines)[i]), i,
+                                           _cols_amount, _types, _separator});
         }
-
-        file.close();
         return ret;
     }
 
@@ -844,17 +881,13 @@ public:
     operator std::vector<T>()
     {
         std::vector<T> ret{};
-
-        auto file = std::ifstream{_fn};
-        std::string line;
+        ret.reserve(_rows_amount * _cols_amount);
         for (std::size_t i = 0; i < _rows_amount; ++i)
         {
-            if (!std::getline(file, line)) break;
-            auto line_vec = std::vector<T>(CSVRow{line, i, _cols_amount, _types, _separator});
+            auto line_vec = std::vector<T>(CSVRow{std::string((*_lines)[i]),
+                i, _cols_amount, _types, _separator});
             ret.insert(ret.end(), line_vec.begin(), line_vec.end());
         }
-
-        file.close();
         return ret;
     }
 
@@ -884,7 +917,65 @@ public:
 
     std::vector<NumType> entry(SizeType i) override
     {
-        return std::vector<NumType>(operator[](i + 1));
+        std::vector<NumType> ret(_cols_amount);
+        _parse_numeric((*_lines)[i + 1], ret.data());
+        return ret;
+    }
+
+    std::vector<NumType> entries() override
+    {
+        std::vector<NumType> ret(entries_amount() * _cols_amount);
+        entries(ret.data());
+        return ret;
+    }
+
+    /**
+     * \brief Parse the fields of all the entries (the rows after the header)
+     * as numbers in a preallocated row-major buffer.
+     * The rows are split in chunks of contiguous lines parsed in parallel
+     * with std::from_chars. Fields that are not numbers are set to 0.
+     * \tparam T The arithmetic type of the buffer.
+     * \param dst     The buffer of entries_amount() * cols_size() elements.
+     * \param workers The maximum amount of parallel chunks, 0 to use the
+     * task manager concurrency.
+     */
+    template<typename T>
+    void entries(T* dst, std::size_t workers = 0) const
+    {
+        static_assert(std::is_arithmetic_v<T>, "T has to be arithmetic");
+        const std::size_t first = 1;
+        const std::size_t last = _rows_amount;
+        if (last <= first) return;
+
+        // Chunks of about the same amount of bytes aligned to the lines.
+        auto& tm = BetterThreads::TaskManager::instance();
+        if (workers == 0) workers = tm.concurrency();
+        const auto begin_off = _lines->offset(first);
+        const auto bytes = _lines->offset(last) - begin_off;
+        workers = std::max<std::size_t>(1, std::min(
+            workers, bytes / PARALLEL_CHUNK_BYTES));
+
+        auto parse_rows = [this, dst](std::size_t from, std::size_t to) {
+            for (std::size_t r = from; r < to; ++r)
+            {
+                _parse_numeric((*_lines)[r],
+                               dst + (r - 1) * _cols_amount);
+            }
+        };
+
+        std::vector<BetterThreads::Future<void>> futures;
+        std::size_t from = first;
+        for (std::size_t w = 1; w < workers; ++w)
+        {
+            auto to = std::clamp(
+                _lines->line_at(begin_off + w * (bytes / workers)),
+                from, last);
+            futures.push_back(tm.enqueue(parse_rows, from, to));
+            from = to;
+        }
+        // The calling thread parses the last chunk.
+        parse_rows(from, last);
+        for (auto& f: futures) f.get();
     }
 
     SizeType entries_amount() const override
@@ -903,7 +994,72 @@ public:
     }
 
 private:
+    /**
+     * \brief Infer the type of each column from a sample of rows.
+     * \param sample The amount of rows after the header to sample, evenly
+     * spaced in the file. At least one row is sampled.
+     * \return std::vector<TypeChecker::Type> The type of each column.
+     */
+    std::vector<TypeChecker::Type> _infer_types(std::size_t sample) const
+    {
+        std::vector<TypeChecker::Type> ret(_cols_amount,
+                                           TypeChecker::Type::NONE);
+        const std::size_t entries = _rows_amount > 1 ? _rows_amount - 1 : 1;
+        sample = std::clamp<std::size_t>(sample, 1, entries);
+        const std::size_t step = entries / sample;
+        for (std::size_t s = 0; s < sample; ++s)
+        {
+            auto line = (*_lines)[1 + s * step];
+            std::size_t begin = 0;
+            for (std::size_t c = 0; c < _cols_amount; ++c)
+            {
+                // The missing fields are empty, like with std::getline.
+                std::string_view field;
+                if (begin <= line.size())
+                {
+                    auto end = std::min(line.find(_separator, begin),
+                                        line.size());
+                    field = line.substr(begin, end - begin);
+                    begin = end + 1;
+                }
+                ret[c] = TypeChecker::merge(ret[c], TypeChecker::parse(field));
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * \brief Parse the fields of a line as numbers.
+     * \tparam T The arithmetic type of the fields.
+     * \param line The CSV line.
+     * \param dst  The buffer of cols_size() elements.
+     */
+    template<typename T>
+    void _parse_numeric(std::string_view line, T* dst) const
+    {
+        const char* p = line.data();
+        const char* end = p + line.size();
+        for (std::size_t c = 0; c < _cols_amount; ++c)
+        {
+            const char* sep = p < end
+                ? static_cast<const char*>(std::memchr(p, _separator,
+                      static_cast<std::size_t>(end - p)))
+                : nullptr;
+            const char* field_end = sep ? sep : end;
+
+            // Like the stream extraction: leading spaces and sign allowed.
+            while (p < field_end && (*p == ' ' || *p == '\t')) ++p;
+            if (p < field_end && *p == '+') ++p;
+            T v{};
+            if (std::from_chars(p, field_end, v).ec != std::errc{}) v = T{};
+            dst[c] = v;
+
+            p = sep ? sep + 1 : end;
+        }
+    }
+
     std::string _fn;          ///< The CSV file path.
+    std::shared_ptr<const CSVLines> _lines; ///< The indexed lines of the file.
     std::vector<TypeChecker::Type> _types; ///< The types vector of each field.
     CSVRow _row_header;       ///< The header of the CSV file.
     CSVRow _row_cache;        ///< A Row cache used for optimization.
@@ -30,8 +30,11 @@
 #define EDGE_LEARNING_PARSER_JSON_HPP
 
 #include "parser.hpp"
+#include "json_document.hpp"
 #include "data/path.hpp"
 
+#include <charconv>
+#include <cmath>
 #include <cstddef>
 #include <string>
 #include <sstream>
@@ -45,6 +48,7 @@
 #include <tuple>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
 
 namespace EdgeLearning {
 
@@ -139,6 +143,23 @@ public:
     [[nodiscard]] virtual JsonType json_type() const { return _json_type; }
 
 protected:
+    /**
+     * \brief Parse the next JSON value of a stream in a single pass. Only
+     * the characters of the value are read and the stream is left after it.
+     * \param is std::istream& The input stream.
+     * \return JsonDocument The parsed document.
+     */
+    static JsonDocument _parse_stream(std::istream& is);
+
+    /**
+     * \brief Format a float in the shortest representation that reads back
+     * to the same value, with a fraction if it is integral so that it is
+     * read back as a float.
+     * \param val double The value.
+     * \return std::string The formatted value.
+     */
+    static std::string _format_float(double val);
+
     JsonType _json_type; ///< \brief TypeChecker::Type of the instantiated object.
 };
 
@@ -152,13 +173,16 @@ protected:
  * \return T The type cast of the JsonObject.
  */
 template <typename T>
-T convert_json_object(JsonObject::Shared jo_ptr);
+T convert_json_object(const JsonObject::Shared& jo_ptr);
 
 /**
  * \brief An item of a JSON that contains a generic shared ptr of a JsonObject
  * that can be a JsonDict, a JsonList or a JsonLeaf.
  * The json type of this class acquired the json type of the contained
  * JsonObject.
+ * The copies share the contained object (copy-on-write): a list or a dict
+ * is copied only when a shared item is modified through a subscript
+ * operator or append.
  */
 class JsonItem : public JsonObject
 {
@@ -247,24 +271,43 @@ public:
      */
     JsonItem(std::map<std::string, JsonItem> dict);
 
+    /**
+     * \brief Constructor of a JsonItem with a value of a JsonDocument.
+     * \param value const JsonDocument::Value& The parsed value.
+     */
+    explicit JsonItem(const JsonDocument::Value& value);
+
     /**
      * \brief Default deconstruct.
      */
     ~JsonItem() = default;
 
     /**
-     * \brief Copy constructor.
+     * \brief Copy constructor: the contained object is shared.
      * \param obj const JsonItem& The object to copy.
      */
     JsonItem(const JsonItem& obj);
 
     /**
-     * \brief Copy assignment overloading.
+     * \brief Move constructor: the moved object is left empty.
+     * \param obj JsonItem&& The object to move.
+     */
+    JsonItem(JsonItem&& obj) noexcept;
+
+    /**
+     * \brief Copy assignment overloading: the contained object is shared.
      * \param obj JsonItem The object to copy.
      * \return JsonItem& The assigned object.
      */
     JsonItem& operator=(const JsonItem& obj);
 
+    /**
+     * \brief Move assignment overloading.
+     * \param obj JsonItem&& The object to move.
+     * \return JsonItem& The assigned object.
+     */
+    JsonItem& operator=(JsonItem&& obj) noexcept;
+
     /**
      * \brief Subscript operator overloading for contained list json.
      * It can be used to write the object and if the JsonItem is empty or there
@@ -295,11 +338,12 @@ public:
      * \brief Constant read-only subscript method for contained list json.
      * If the JsonItem is empty or there are no json list, then it throws a
      * runtime_error exception.
+     * The item of a packed list is read from the numbers, without unpacking.
      * \param idx std::size_t The index of the list.
-     * \return JsonItem& The JsonItem at the index.
+     * \return JsonItem The JsonItem at the index, sharing its value.
      */
-    [[nodiscard]] const JsonItem& at(std::size_t idx) const;
-    [[nodiscard]] const JsonItem& at(int idx) const
+    [[nodiscard]] JsonItem at(std::size_t idx) const;
+    [[nodiscard]] JsonItem at(int idx) const
     {
         return at(static_cast<std::size_t>(idx));
     }
@@ -357,6 +401,17 @@ public:
     template<typename T>
     void as_vec(std::vector<T>& ptr) const;
 
+    /**
+     * \brief Convert the contained list in an array, e.g. a row of weights,
+     * with a single copy if the list is packed.
+     * \tparam T Arithmetic type of the array.
+     * \param dst  T* The array.
+     * \param size std::size_t The size of the array, that has to be equal
+     * to the size of the list.
+     */
+    template<typename T>
+    void as_vec(T* dst, std::size_t size) const;
+
     /**
      * \brief Convert the json object in the templated map values type and put
      * in the ptr.
@@ -460,6 +515,40 @@ public:
     operator std::string() const;
 
 private:
+    friend class JsonList;
+    friend class JsonDict;
+
+    /**
+     * \brief Constructor of a JsonItem that shares a JsonObject, e.g. a leaf
+     * allocated in the block of the leaves of a list.
+     * \param value Shared The object to contain.
+     */
+    explicit JsonItem(Shared value)
+        : JsonObject(value ? value->json_type() : JsonType::NONE)
+        , _value{std::move(value)}
+    { }
+
+    /**
+     * \brief Copy the contained list or dict if it is shared with other
+     * items, before to modify it.
+     */
+    void _detach();
+
+    /**
+     * \brief Shallow copy of a list or a dict: the items of the copy share
+     * their values with the original.
+     * \param value const Shared& The object to copy.
+     * \return Shared The copy, or the same object if it is a leaf.
+     */
+    static Shared _clone(const Shared& value);
+
+    /**
+     * \brief Check if an item is inside the subtree of an object.
+     * \param value const JsonObject* The root of the subtree.
+     * \param item  const JsonItem* The item to search.
+     * \return bool True if the item is in the subtree.
+     */
+    static bool _contains(const JsonObject* value, const JsonItem* item);
 
     Shared _value; ///< \brief The shared ptr of the JsonObject.
 };
@@ -477,7 +566,9 @@ public:
     JsonLeaf()
         : JsonObject(JsonType::LEAF)
         , _val{}
+        , _num{}
         , _type{TypeChecker::Type::NONE}
+        , _native{false}
     { }
 
     /**
@@ -489,7 +580,9 @@ public:
     JsonLeaf(const std::string& val, TypeChecker::Type type = TypeChecker::Type::AUTO)
         : JsonObject(JsonType::LEAF)
         , _val{val}
+        , _num{}
         , _type{type}
+        , _native{false}
     {
         if (_type == TypeChecker::Type::AUTO)
         {
@@ -509,44 +602,40 @@ public:
     { }
 
     /**
-     * \brief Construct a JsonLeaf with an integer.
+     * \brief Construct a JsonLeaf with a leaf of a JsonDocument: a number is
+     * an int if written without fraction and exponent, otherwise a float.
+     * \param value const JsonDocument::Value& The parsed value.
+     */
+    explicit JsonLeaf(const JsonDocument::Value& value);
+
+    /**
+     * \brief Construct a JsonLeaf with an integer, stored natively.
      * \param val An integer value: int, unsigned int, long,
      * unsigned long, long long, unsigned long long.
      */
-    JsonLeaf(int val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
-    JsonLeaf(unsigned int val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
-    JsonLeaf(long val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
-    JsonLeaf(unsigned long val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
-    JsonLeaf(long long val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
-    JsonLeaf(unsigned long long val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::INT)
-    { }
+    JsonLeaf(int val) : JsonLeaf() { _assign(val); }
+    JsonLeaf(unsigned int val) : JsonLeaf() { _assign(val); }
+    JsonLeaf(long val) : JsonLeaf() { _assign(val); }
+    JsonLeaf(unsigned long val) : JsonLeaf() { _assign(val); }
+    JsonLeaf(long long val) : JsonLeaf() { _assign(val); }
+    JsonLeaf(unsigned long long val) : JsonLeaf() { _assign(val); }
 
     /**
-     * \brief Construct a JsonLeaf with a double.
+     * \brief Construct a JsonLeaf with a double, stored natively.
      * \param val double A double as a value.
      */
-    JsonLeaf(double val)
-        : JsonLeaf(std::to_string(val), TypeChecker::Type::FLOAT)
-    { }
+    JsonLeaf(double val) : JsonLeaf() { _assign(val); }
 
     /**
-     * \brief Construct a JsonLeaf with a bool.
+     * \brief Construct a JsonLeaf with a bool, stored natively.
      * \param val bool A boolean as a value.
      */
-    JsonLeaf(bool val)
-        : JsonLeaf(val ? "true" : "false", TypeChecker::Type::BOOL)
-    { }
+    JsonLeaf(bool val) : JsonLeaf() { _assign(val); }
+
+    JsonLeaf(const JsonLeaf&) = default;
+    JsonLeaf(JsonLeaf&&) = default;
+    JsonLeaf& operator=(const JsonLeaf&) = default;
+    JsonLeaf& operator=(JsonLeaf&&) = default;
 
     /**
      * \brief Default deconstruct.
@@ -561,25 +650,59 @@ public:
     template<typename T>
     void value(T val)
     {
-        _val = _tc(val);
-        _type = _tc(_val);
+        _val.clear();
+        _assign(val);
     }
 
     /**
-     * \brief Getter of the value of a JsonLeaf object.
-     * \return const std::string& The value field in string.
+     * \brief Getter of the value of a JsonLeaf object. A native float is
+     * formatted in the shortest representation that reads back to the same
+     * value.
+     * \return std::string The value field in string.
      */
-    [[nodiscard]] const std::string& value() const { return _val; }
+    [[nodiscard]] std::string value() const
+    {
+        if (!_native) return _val;
+        switch (_type)
+        {
+            case TypeChecker::Type::FLOAT: return _format_float(_num.f);
+            case TypeChecker::Type::INT: return std::to_string(_num.i);
+            case TypeChecker::Type::BOOL: return _num.b ? "true" : "false";
+            default: return _val;
+        }
+    }
 
     /**
      * \brief Convert the field in the templated type and put in the ptr.
+     * A native number is converted without formatting it in string.
      * \tparam T  Field type requested.
      * \param ref T& Reference in which put the result.
      */
     template<typename T>
     void as(T& ptr) const
     {
-        _tc(_val, ptr);
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        {
+            if (_native && _type == TypeChecker::Type::FLOAT)
+            {
+                ptr = static_cast<T>(_num.f);
+                return;
+            }
+            if (_native && _type == TypeChecker::Type::INT)
+            {
+                ptr = static_cast<T>(_num.i);
+                return;
+            }
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            if (_native && _type == TypeChecker::Type::BOOL)
+            {
+                ptr = _num.b;
+                return;
+            }
+        }
+        _tc(value(), ptr);
     }
 
     /**
@@ -663,12 +786,62 @@ public:
     operator std::string() const;
 
 private:
-    std::string _val;   ///< \brief Value of the JsonLeaf.
+    /**
+     * \brief Store a number or a boolean natively. An unsigned integer that
+     * does not fit a long long is stored in string.
+     * \tparam T The arithmetic type of the value.
+     * \param val T The value.
+     */
+    template<typename T>
+    void _assign(T val)
+    {
+        static_assert(std::is_arithmetic_v<T>, "JsonLeaf: arithmetic value");
+        _native = true;
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            _type = TypeChecker::Type::BOOL;
+            _num.b = val;
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            _type = TypeChecker::Type::FLOAT;
+            _num.f = static_cast<double>(val);
+        }
+        else
+        {
+            _type = TypeChecker::Type::INT;
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if (static_cast<unsigned long long>(val) > static_cast<
+                    unsigned long long>(std::numeric_limits<long long>::max()))
+                {
+                    _native = false;
+                    _val = std::to_string(val);
+                    return;
+                }
+            }
+            _num.i = static_cast<long long>(val);
+        }
+    }
+
+    std::string _val;   ///< \brief Value of the JsonLeaf, if not native.
+    /// \brief Native value of a number or of a boolean.
+    union Native
+    {
+        double f;
+        long long i;
+        bool b;
+    } _num;
     TypeChecker::Type _type;         ///< \brief TypeChecker::Type of the value field.
+    bool _native; ///< \brief True if the value is stored in _num.
 };
 
 /**
  * \brief The list class of a JSON, identified by two squared bracket: [ ... ].
+ * A list of numbers all integers or all floating points, e.g. a weight
+ * matrix row, is packed in a contiguous vector of double instead of an item
+ * per number. The packed list is converted in items only when an item is
+ * accessed by reference.
  */
 class JsonList : public JsonObject
 {
@@ -679,6 +852,8 @@ public:
     JsonList()
         : JsonObject(JsonType::LIST)
         , _list()
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
     { }
 
     /**
@@ -688,8 +863,16 @@ public:
     JsonList(std::vector<JsonItem> list)
         : JsonObject(JsonType::LIST)
         , _list(std::move(list))
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
     { }
 
+    /**
+     * \brief Constructor of a JsonList with a list of a JsonDocument.
+     * \param value const JsonDocument::Value& The parsed list.
+     */
+    explicit JsonList(const JsonDocument::Value& value);
+
     /**
      * \brief Constructor of a JsonList with a vector of integer.
      * \param val A vector of integers: int, unsigned int, long,
@@ -697,28 +880,52 @@ public:
      */
     JsonList(std::vector<int> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<int>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<int>(val);
+    }
     JsonList(std::vector<unsigned int> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<unsigned int>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<unsigned int>(val);
+    }
     JsonList(std::vector<long> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<long>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<long>(val);
+    }
     JsonList(std::vector<unsigned long> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<unsigned long>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<unsigned long>(val);
+    }
     JsonList(std::vector<long long> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<long long>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<long long>(val);
+    }
     JsonList(std::vector<unsigned long long> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<unsigned long long>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<unsigned long long>(val);
+    }
 
     /**
      * \brief Constructor of a JsonList with a vector of floating point.
@@ -726,8 +933,12 @@ public:
      */
     JsonList(std::vector<double> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<double>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<double>(val);
+    }
 
     /**
      * \brief Constructor of a JsonList with a vector of boolean.
@@ -735,8 +946,12 @@ public:
      */
     JsonList(std::vector<bool> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<bool>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<bool>(val);
+    }
 
     /**
      * \brief Constructor of a JsonList with a vector of string.
@@ -744,8 +959,17 @@ public:
      */
     JsonList(std::vector<std::string> val)
         : JsonObject(JsonType::LIST)
-        , _list(_convert_vec<std::string>(val))
-    { }
+        , _list{}
+        , _packed{}
+        , _packed_type{TypeChecker::Type::NONE}
+    {
+        _convert_vec<std::string>(val);
+    }
+
+    JsonList(const JsonList&) = default;
+    JsonList(JsonList&&) = default;
+    JsonList& operator=(const JsonList&) = default;
+    JsonList& operator=(JsonList&&) = default;
 
     /**
      * \brief Default deconstruct.
@@ -760,28 +984,30 @@ public:
      */
     JsonItem& operator[](std::size_t idx)
     {
-        if (idx >= _list.size())
+        if (idx >= size())
         {
             throw std::runtime_error(
                 "operator[] failed: idx >= list size");
         }
+        unpack();
         return _list[idx];
     }
 
     /**
      * \brief Constant read-only subscript method to access a JsonItem contained
-     * in the list.
+     * in the list. The item of a packed list is read from the numbers,
+     * without unpacking.
      * \param idx unsigned long The index to access.
-     * \return const JsonItem& The item accessed at the index.
+     * \return JsonItem The item accessed at the index, sharing its value.
      */
-    [[nodiscard]] const JsonItem& at(unsigned long idx) const
+    [[nodiscard]] JsonItem at(unsigned long idx) const
     {
-        if (idx >= _list.size())
+        if (idx >= size())
         {
             throw std::runtime_error(
                 "method at() failed: idx >= list size");
         }
-        return _list.at(idx);
+        return _item(idx);
     }
 
     /**
@@ -790,14 +1016,74 @@ public:
      */
     void append(JsonItem ji)
     {
-        _list.push_back(ji);
+        unpack();
+        _list.push_back(std::move(ji));
     }
 
     /**
-     * \brief Getter of the vector of JsonItem contained in the object.
+     * \brief Getter of the vector of JsonItem contained in the object. A
+     * packed list has no items: call unpack() before.
      * \return const std::vector<JsonItem>& The contained vector of JsonItem.
      */
-    [[nodiscard]] const std::vector<JsonItem>& value() const { return _list; }
+    [[nodiscard]] const std::vector<JsonItem>& value() const
+    {
+        if (is_packed())
+        {
+            throw std::runtime_error("method value() failed: the list is "
+                                     "packed, call unpack() before");
+        }
+        return _list;
+    }
+
+    /**
+     * \brief Convert a packed list in items, before to access them by
+     * reference. Do nothing if the list is not packed.
+     */
+    void unpack();
+
+    /**
+     * \brief Check if the list is packed.
+     * \return bool True if the numbers are in packed().
+     */
+    [[nodiscard]] bool is_packed() const
+    {
+        return _packed_type != TypeChecker::Type::NONE;
+    }
+
+    /**
+     * \brief Getter of the numbers of a packed list.
+     * \return const std::vector<double>& The numbers, empty if the list is
+     * not packed.
+     */
+    [[nodiscard]] const std::vector<double>& packed() const { return _packed; }
+
+    /**
+     * \brief Convert the numbers of the list in an array.
+     * \tparam T The arithmetic type of the array.
+     * \param dst  T* The array.
+     * \param size std::size_t The size of the array, that has to be equal
+     * to the size of the list.
+     */
+    template<typename T>
+    void as(T* dst, std::size_t size) const
+    {
+        if (size != this->size())
+        {
+            throw std::runtime_error("method as() failed: list size "
+                                     + std::to_string(this->size())
+                                     + " != " + std::to_string(size));
+        }
+        if (is_packed())
+        {
+            std::transform(_packed.begin(), _packed.end(), dst,
+                           [](double v) { return static_cast<T>(v); });
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            dst[i] = static_cast<T>(_list[i]);
+        }
+    }
 
     /**
      * \brief Convert the json object in the templated vector type and put in
@@ -827,13 +1113,16 @@ public:
      * \brief Return the length of the list.
      * \return unsigned long The length of the list.
      */
-    [[nodiscard]] unsigned long size() const { return _list.size(); }
+    [[nodiscard]] unsigned long size() const
+    {
+        return is_packed() ? _packed.size() : _list.size();
+    }
 
     /**
      * \brief Check if the list is empty.
      * \return bool True if the list is empty, otherwise false.
      */
-    [[nodiscard]] bool empty() const { return _list.empty(); }
+    [[nodiscard]] bool empty() const { return size() == 0; }
 
     /**
      * \brief Overloading of equals operator.
@@ -872,10 +1161,23 @@ public:
     template<typename T>
     operator std::vector<T>() const
     {
-        std::vector<T> ret(_list.size());
-        for (unsigned long i = 0; i < _list.size(); ++i)
+        if constexpr (std::is_same_v<T, double>)
         {
-            ret[i] = static_cast<T>(_list.at(i));
+            if (is_packed()) return _packed;
+        }
+        std::vector<T> ret(size());
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        {
+            if (is_packed())
+            {
+                as(ret.data(), ret.size());
+                return ret;
+            }
+        }
+        for (unsigned long i = 0; i < ret.size(); ++i)
+        {
+            ret[i] = is_packed()
+                ? static_cast<T>(_leaf(i)) : static_cast<T>(_list.at(i));
         }
         return ret;
     }
@@ -894,9 +1196,61 @@ private:
      * \return std::vector<JsonItem> Output JsonItem vector.
      */
     template<typename T>
-    std::vector<JsonItem> _convert_vec(const std::vector<T>& list);
+    void _convert_vec(const std::vector<T>& list);
 
-    std::vector<JsonItem> _list; ///< \brief The list of items.
+    /**
+     * \brief Check if a number can be packed as a double without loss.
+     * \tparam T The arithmetic type of the number.
+     * \param v T The number.
+     * \return bool True if packable.
+     */
+    template<typename T>
+    static bool _packable(T v)
+    {
+        if constexpr (std::is_floating_point_v<T>) return true;
+        // The integers are exact in a double up to 2^53.
+        constexpr long long max = 1LL << 53;
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            return static_cast<unsigned long long>(v)
+                <= static_cast<unsigned long long>(max);
+        }
+        else
+        {
+            return v <= max && v >= -max;
+        }
+    }
+
+    /**
+     * \brief Leaf of a number of the packed list.
+     * \param idx std::size_t The index of the number.
+     * \return JsonLeaf The leaf of the packed type.
+     */
+    [[nodiscard]] JsonLeaf _leaf(std::size_t idx) const
+    {
+        if (_packed_type == TypeChecker::Type::INT)
+        {
+            return JsonLeaf(static_cast<long long>(_packed[idx]));
+        }
+        return JsonLeaf(_packed[idx]);
+    }
+
+    /**
+     * \brief Item at an index, read from the packed numbers if packed.
+     * \param idx std::size_t The index of the item.
+     * \return JsonItem The item.
+     */
+    [[nodiscard]] JsonItem _item(std::size_t idx) const
+    {
+        return is_packed() ? JsonItem(_leaf(idx)) : _list[idx];
+    }
+
+    /// \brief The list of items, if not packed.
+    std::vector<JsonItem> _list;
+    /// \brief The numbers of a packed list.
+    std::vector<double> _packed;
+    /// \brief INT or FLOAT if packed, otherwise NONE.
+    TypeChecker::Type _packed_type;
 };
 
 /**
@@ -923,6 +1277,12 @@ public:
         , _map(std::move(map))
     { }
 
+    /**
+     * \brief Constructor of a JsonDict with a dictionary of a JsonDocument.
+     * \param value const JsonDocument::Value& The parsed dictionary.
+     */
+    explicit JsonDict(const JsonDocument::Value& value);
+
     /**
      * \brief Constructor of a JsonDict with a map of string-integer pairs.
      * \param val A map of integer values: int, unsigned int, long,
@@ -980,6 +1340,11 @@ public:
         , _map(_convert_map<std::string>(val))
     { }
 
+    JsonDict(const JsonDict&) = default;
+    JsonDict(JsonDict&&) = default;
+    JsonDict& operator=(const JsonDict&) = default;
+    JsonDict& operator=(JsonDict&&) = default;
+
     /**
      * \brief Default deconstruct.
      */
@@ -1177,7 +1542,8 @@ inline JsonItem::JsonItem(const JsonList& value)
 { }
 
 inline JsonItem::JsonItem(std::vector<JsonItem> list)
-    : JsonItem(JsonList(list))
+    : JsonObject(JsonObject::JsonType::LIST)
+    , _value(std::make_shared<JsonList>(std::move(list)))
 { }
 
 inline JsonItem::JsonItem(const JsonDict& value)
@@ -1186,50 +1552,224 @@ inline JsonItem::JsonItem(const JsonDict& value)
 { }
 
 inline JsonItem::JsonItem(std::map<std::string, JsonItem> dict)
-    : JsonItem(JsonDict(dict))
+    : JsonObject(JsonObject::JsonType::DICT)
+    , _value(std::make_shared<JsonDict>(std::move(dict)))
 { }
 
-inline JsonItem::JsonItem(const JsonItem& obj)
-    : JsonObject(obj)
+inline JsonItem::JsonItem(const JsonDocument::Value& value)
+    : JsonObject()
     , _value{}
 {
-    if (!obj._value) return;
-    switch(obj._value->json_type())
+    switch (value.type())
     {
-        case JsonObject::JsonType::LEAF:
+        case JsonDocument::Type::LIST:
+            _value = std::make_shared<JsonList>(value);
+            break;
+        case JsonDocument::Type::DICT:
+            _value = std::make_shared<JsonDict>(value);
+            break;
+        case JsonDocument::Type::NONE:
+            return;
+        default:
+            _value = std::make_shared<JsonLeaf>(value);
+            break;
+    }
+    _json_type = _value->json_type();
+}
+
+inline JsonLeaf::JsonLeaf(const JsonDocument::Value& value)
+    : JsonLeaf()
+{
+    switch (value.type())
+    {
+        case JsonDocument::Type::NUMBER:
         {
-            auto obj_jl = std::dynamic_pointer_cast<JsonLeaf>(obj._value);
-            if (obj_jl) _value = std::make_shared<JsonLeaf>(*obj_jl);
+            auto text = value.text();
+            auto last = text.data() + text.size();
+            _type = value.is_integer()
+                ? TypeChecker::Type::INT : TypeChecker::Type::FLOAT;
+            auto res = _type == TypeChecker::Type::INT
+                ? std::from_chars(text.data(), last, _num.i)
+                : std::from_chars(text.data(), last, _num.f);
+            _native = res.ec == std::errc() && res.ptr == last;
+            // Numbers out of range stay in string.
+            if (!_native) _val = std::string(text);
             break;
         }
-        case JsonObject::JsonType::LIST:
-        {
-            auto obj_jl = std::dynamic_pointer_cast<JsonList>(obj._value);
-            if (obj_jl) _value = std::make_shared<JsonList>(*obj_jl);
+        case JsonDocument::Type::STRING:
+            _val = value.as_string();
+            _type = TypeChecker::Type::STRING;
+            break;
+        case JsonDocument::Type::BOOL:
+            _assign(value.as_bool());
+            break;
+        case JsonDocument::Type::NONE:
             break;
+        default:
+            throw std::runtime_error("JsonLeaf: leaf value expected");
+    }
+}
+
+inline JsonList::JsonList(const JsonDocument::Value& value)
+    : JsonList()
+{
+    if (value.type() != JsonDocument::Type::LIST)
+    {
+        throw std::runtime_error("JsonList: list expected");
+    }
+
+    // Pack the numbers if all integers or all floating points.
+    if (value.size() > 0)
+    {
+        auto item = value.first_child();
+        bool integer = item.is_integer();
+        _packed.resize(value.size());
+        std::size_t i = 0;
+        for (; i < value.size(); ++i, item = item.next())
+        {
+            if (item.type() != JsonDocument::Type::NUMBER
+                || item.is_integer() != integer)
+            {
+                break;
+            }
+            auto text = item.text();
+            auto last = text.data() + text.size();
+            if (integer)
+            {
+                long long v = 0;
+                auto res = std::from_chars(text.data(), last, v);
+                if (res.ec != std::errc() || res.ptr != last
+                    || !_packable(v))
+                {
+                    break;
+                }
+                _packed[i] = static_cast<double>(v);
+            }
+            else
+            {
+                auto res = std::from_chars(text.data(), last, _packed[i]);
+                if (res.ec != std::errc() || res.ptr != last) break;
+            }
         }
-        case JsonObject::JsonType::DICT:
+        if (i == value.size())
         {
-            auto obj_jd = std::dynamic_pointer_cast<JsonDict>(obj._value);
-            if (obj_jd) _value = std::make_shared<JsonDict>(*obj_jd);
-            break;
+            _packed_type = integer
+                ? TypeChecker::Type::INT : TypeChecker::Type::FLOAT;
+            return;
         }
-        case JsonObject::JsonType::NONE:
-        default:
+        _packed.clear();
+    }
+
+    _list.reserve(value.size());
+    // The leaves are allocated in a single block shared by the items.
+    auto leaves = std::make_shared<std::vector<JsonLeaf>>();
+    leaves->reserve(value.size());
+    auto item = value.first_child();
+    for (std::size_t i = 0; i < value.size(); ++i, item = item.next())
+    {
+        if (item.type() == JsonDocument::Type::LIST
+            || item.type() == JsonDocument::Type::DICT
+            || item.type() == JsonDocument::Type::NONE)
         {
-            break;
+            _list.emplace_back(item);
         }
-    };
+        else
+        {
+            leaves->emplace_back(item);
+            _list.push_back(
+                JsonItem(JsonObject::Shared(leaves, &leaves->back())));
+        }
+    }
+}
+
+inline JsonDict::JsonDict(const JsonDocument::Value& value)
+    : JsonObject(JsonType::DICT)
+    , _map{}
+{
+    if (value.type() != JsonDocument::Type::DICT)
+    {
+        throw std::runtime_error("JsonDict: dictionary expected");
+    }
+    auto key = value.first_child();
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        auto item = key.next();
+        _map.emplace(std::piecewise_construct,
+                     std::forward_as_tuple(key.as_string()),
+                     std::forward_as_tuple(item));
+        key = item.next();
+    }
+}
+
+inline JsonItem::JsonItem(const JsonItem& obj)
+    : JsonObject(obj)
+    , _value{obj._value}
+{ }
+
+inline JsonItem::JsonItem(JsonItem&& obj) noexcept
+    : JsonObject(obj._json_type)
+    , _value{std::move(obj._value)}
+{
+    obj._json_type = JsonObject::JsonType::NONE;
 }
 
 inline JsonItem& JsonItem::operator=(const JsonItem& obj)
 {
-    JsonItem tmp(obj);
-    _value = tmp._value;
-    _json_type = tmp.json_type();
+    // Assigning an item inside obj, e.g. j["k"] = j, shares a copy of obj
+    // to avoid a cycle.
+    _value = _contains(obj._value.get(), this)
+        ? _clone(obj._value) : obj._value;
+    _json_type = obj._json_type;
     return *this;
 }
 
+inline JsonItem& JsonItem::operator=(JsonItem&& obj) noexcept
+{
+    if (this == &obj) return *this;
+    _value = std::move(obj._value);
+    _json_type = obj._json_type;
+    obj._json_type = JsonObject::JsonType::NONE;
+    return *this;
+}
+
+inline void JsonItem::_detach()
+{
+    // The leaves are not modified in place.
+    if (_value && _value.use_count() > 1) _value = _clone(_value);
+}
+
+inline JsonItem::Shared JsonItem::_clone(const Shared& value)
+{
+    if (auto jl = dynamic_cast<const JsonList*>(value.get()))
+    {
+        return std::make_shared<JsonList>(*jl);
+    }
+    if (auto jd = dynamic_cast<const JsonDict*>(value.get()))
+    {
+        return std::make_shared<JsonDict>(*jd);
+    }
+    return value;
+}
+
+inline bool JsonItem::_contains(const JsonObject* value, const JsonItem* item)
+{
+    auto visit = [item](const JsonItem& e) {
+        return &e == item || (e._json_type != JsonObject::JsonType::LEAF
+                              && _contains(e._value.get(), item));
+    };
+    if (auto jl = dynamic_cast<const JsonList*>(value))
+    {
+        if (jl->is_packed()) return false;
+        return std::any_of(jl->value().begin(), jl->value().end(), visit);
+    }
+    if (auto jd = dynamic_cast<const JsonDict*>(value))
+    {
+        return std::any_of(jd->value().begin(), jd->value().end(),
+                           [&visit](const auto& e) { return visit(e.second); });
+    }
+    return false;
+}
+
 inline JsonItem& JsonItem::operator[](std::size_t idx)
 {
     if (!_value)
@@ -1237,6 +1777,7 @@ inline JsonItem& JsonItem::operator[](std::size_t idx)
         throw std::runtime_error("Try to call a subscript operator in empty "
                                  "JsonItem");
     }
+    _detach();
     switch(_value->json_type())
     {
         case JsonObject::JsonType::LIST:
@@ -1264,6 +1805,7 @@ inline JsonItem& JsonItem::operator[](std::string key)
         _json_type = JsonObject::JsonType::DICT;
         _value = std::make_shared<JsonDict>();
     }
+    _detach();
     switch(_value->json_type())
     {
         case JsonObject::JsonType::DICT:
@@ -1284,7 +1826,7 @@ inline JsonItem& JsonItem::operator[](std::string key)
                              "json object");
 }
 
-inline const JsonItem& JsonItem::at(std::size_t idx) const
+inline JsonItem JsonItem::at(std::size_t idx) const
 {
     if (!_value)
     {
@@ -1345,12 +1887,13 @@ inline void JsonItem::append(JsonItem ji)
         _json_type = JsonObject::JsonType::LIST;
         _value = std::make_shared<JsonList>();
     }
+    _detach();
     switch(_value->json_type())
     {
         case JsonObject::JsonType::LIST:
         {
             auto jl = std::dynamic_pointer_cast<JsonList>(_value);
-            if (jl) return (*jl).append(ji);
+            if (jl) return (*jl).append(std::move(ji));
             break;
         }
         case JsonObject::JsonType::DICT:
@@ -1404,15 +1947,25 @@ inline void JsonItem::as(T& ptr) const
 template<typename T>
 inline void JsonItem::as_vec(std::vector<T>& ptr) const
 {
-    ptr = static_cast<std::vector<T>>(
-        convert_json_object<JsonList>(_value));
+    ptr = as_vec<T>();
+}
+
+template<typename T>
+inline void JsonItem::as_vec(T* dst, std::size_t size) const
+{
+    auto jl = dynamic_cast<const JsonList*>(_value.get());
+    if (!jl)
+    {
+        throw std::runtime_error("Try to convert a non-list json object in "
+                                 "an array");
+    }
+    jl->as(dst, size);
 }
 
 template<typename T>
 inline void JsonItem::as_map(std::map<std::string, T>& ptr) const
 {
-    ptr = static_cast<std::map<std::string, T>>(
-        convert_json_object<JsonDict>(_value));
+    ptr = as_map<T>();
 }
 
 template<typename T>
@@ -1424,6 +1977,11 @@ inline T JsonItem::as() const
 template<typename T>
 inline std::vector<T> JsonItem::as_vec() const
 {
+    // Convert the contained list without copying it.
+    if (auto jl = dynamic_cast<const JsonList*>(_value.get()))
+    {
+        return static_cast<std::vector<T>>(*jl);
+    }
     return static_cast<std::vector<T>>(
         convert_json_object<JsonList>(_value));
 }
@@ -1431,6 +1989,10 @@ inline std::vector<T> JsonItem::as_vec() const
 template<typename T>
 inline std::map<std::string, T> JsonItem::as_map() const
 {
+    if (auto jd = dynamic_cast<const JsonDict*>(_value.get()))
+    {
+        return static_cast<std::map<std::string, T>>(*jd);
+    }
     return static_cast<std::map<std::string, T>>(
         convert_json_object<JsonDict>(_value));
 }
@@ -1481,46 +2043,38 @@ inline std::ostream& operator<<(std::ostream& os, const JsonLeaf& obj)
     }
     else
     {
-        os << obj._val;
+        os << obj.value();
     }
     return os;
 }
 
 inline std::istream& operator>>(std::istream &os, JsonLeaf& obj)
 {
-    char c;
-    os.read(&c, 1);
-    if (c == '\"')
-    {
-        obj._type = TypeChecker::Type::STRING;
-        std::getline(os, obj._val, '\"');
-        if (!os.eof())
-        {
-            os.read(&c, 1);
-            if (c != ',') os.seekg(-1, os.cur);
-        }
-    }
-    else
-    {
-        os.seekg(-1, os.cur);
-        std::getline(os, obj._val, ',');
-        auto obj_val_len = obj._val.size();
-        auto pos_square = obj._val.find(']');
-        auto pos_bracket = obj._val.find('}');
-        auto pos = std::min(pos_square, pos_bracket);
-        if (pos != std::string::npos)
-        {
-            obj._val = obj._val.substr(0, pos);
-            if (!os.eof()) os.seekg(-1, os.cur); // ','
-            os.seekg(-long(obj_val_len - pos), os.cur);
-        }
-        obj._type = obj._tc(obj._val);
-    }
+    auto doc = JsonObject::_parse_stream(os);
+    obj = JsonLeaf{doc.root()};
     return os;
 }
 
 inline std::ostream& operator<<(std::ostream& os, const JsonList& obj)
 {
+    if (obj.is_packed())
+    {
+        os << "[";
+        for (std::size_t i = 0; i < obj._packed.size(); ++i)
+        {
+            if (i > 0) os << ",";
+            if (obj._packed_type == TypeChecker::Type::INT)
+            {
+                os << static_cast<long long>(obj._packed[i]);
+            }
+            else
+            {
+                os << JsonList::_format_float(obj._packed[i]);
+            }
+        }
+        os << "]";
+        return os;
+    }
     os << "[";
     if (obj._list.empty())
     {
@@ -1537,33 +2091,8 @@ inline std::ostream& operator<<(std::ostream& os, const JsonList& obj)
 
 inline std::istream& operator>>(std::istream &os, JsonList& obj)
 {
-    char c;
-    os.read(&c, 1);
-
-    std::string more_items;
-    while (true) {
-        std::getline(os, more_items, ']');
-        os.seekg(-long(more_items.size() + 1), os.cur);
-        JsonItem ji;
-        os >> ji;
-        obj._list.push_back(ji);
-
-        os.read(&c, 1);
-        if (c == ']')
-        {
-            break;
-        }
-        else
-        {
-            os.seekg(-1, os.cur);
-        }
-    }
-
-    if (!os.eof())
-    {
-        os.read(&c, 1);
-        if (c != ',') os.seekg(-1, os.cur);
-    }
+    auto doc = JsonObject::_parse_stream(os);
+    obj = JsonList{doc.root()};
     return os;
 }
 
@@ -1585,39 +2114,9 @@ inline std::ostream& operator<<(std::ostream& os, const JsonDict& obj)
 
 inline std::istream& operator>>(std::istream& os, JsonDict& obj)
 {
-    char c;
-    os.read(&c, 1);
-
-    std::string more_items;
-    while (true)
-    {
-        std::getline(os, more_items, '}');
-        os.seekg(-long(more_items.size() + 1), os.cur);
-        os.read(&c, 1);
-        std::string key;
-        std::getline(os, key, '\"');
-        os.read(&c, 1);
-
-        JsonItem ji;
-        os >> ji;
-        obj._map[key] = ji;
-
-        os.read(&c, 1);
-        if (c == '}')
-        {
-            break;
-        }
-        else
-        {
-            os.seekg(-1, os.cur);
-        }
-    }
-
-    if (!os.eof())
-    {
-        os.read(&c, 1);
-        if (c != ',') os.seekg(-1, os.cur);
-    }
+    auto doc = JsonObject::_parse_stream(os);
+    JsonDict jd{doc.root()};
+    obj._map = std::move(jd._map);
     return os;
 }
 
@@ -1629,37 +2128,83 @@ inline std::ostream& operator<<(std::ostream& os, const JsonItem& obj)
 
 inline std::istream& operator>>(std::istream& os, JsonItem& obj)
 {
-    char c;
-    os.read(&c, 1);
-    os.seekg(-1, os.cur);
-    switch(c)
+    auto doc = JsonObject::_parse_stream(os);
+    JsonItem ji{doc.root()};
+    obj._value = std::move(ji._value);
+    obj._json_type = ji._json_type;
+    return os;
+}
+
+inline std::string JsonObject::_format_float(double val)
+{
+    if (!std::isfinite(val)) return std::to_string(val);
+    // Enough for the shortest representation of any double.
+    char chars[32];
+    auto end = std::to_chars(chars, chars + sizeof(chars), val).ptr;
+    std::string ret(chars, end);
+    if (ret.find_first_of(".e") == std::string::npos) ret += ".0";
+    return ret;
+}
+
+inline JsonDocument JsonObject::_parse_stream(std::istream& is)
+{
+    // Read only the characters of the next value, so that the following
+    // values stay in the stream even if it is not seekable.
+    using Traits = std::istream::traits_type;
+    auto* sb = is.rdbuf();
+    auto is_space = [](char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    };
+    auto c = sb->sgetc();
+    while (!Traits::eq_int_type(c, Traits::eof())
+           && is_space(Traits::to_char_type(c)))
     {
-        case '[':
-        {
-            auto jl = std::make_shared<JsonList>();
-            os >> *jl;
-            obj._value = jl;
-            obj._json_type = JsonObject::JsonType::LIST;
-            break;
-        }
-        case '{':
+        c = sb->snextc();
+    }
+
+    std::string buffer;
+    std::size_t depth = 0;
+    bool in_string = false;
+    for (; !Traits::eq_int_type(c, Traits::eof()); c = sb->sgetc())
+    {
+        auto ch = Traits::to_char_type(c);
+        if (in_string)
         {
-            auto jd = std::make_shared<JsonDict>();
-            os >> *jd;
-            obj._value = jd;
-            obj._json_type = JsonObject::JsonType::DICT;
-            break;
+            buffer.push_back(ch);
+            sb->sbumpc();
+            if (ch == '\\')
+            {
+                c = sb->sbumpc();
+                if (Traits::eq_int_type(c, Traits::eof())) break;
+                buffer.push_back(Traits::to_char_type(c));
+            }
+            else if (ch == '"')
+            {
+                in_string = false;
+                if (depth == 0) break;
+            }
+            continue;
         }
-        default:
+        // A scalar ends at the first delimiter, that is left in the stream.
+        if (depth == 0 && !buffer.empty()
+            && (ch == ',' || ch == ']' || ch == '}' || is_space(ch)))
         {
-            auto jd = std::make_shared<JsonLeaf>();
-            os >> *jd;
-            obj._value = jd;
-            obj._json_type = JsonObject::JsonType::LEAF;
             break;
         }
+        buffer.push_back(ch);
+        sb->sbumpc();
+        if (ch == '"') in_string = true;
+        else if (ch == '{' || ch == '[') ++depth;
+        else if ((ch == '}' || ch == ']') && depth > 0 && --depth == 0) break;
     }
-    return os;
+
+    JsonDocument doc{std::move(buffer), true};
+
+    // Leave the stream after the parsed value and its separator.
+    c = sb->sgetc();
+    if (Traits::eq_int_type(c, Traits::eof())) is.setstate(std::ios::eofbit);
+    else if (Traits::to_char_type(c) == ',') sb->sbumpc();
+    return doc;
 }
 
 inline bool JsonObject::operator==(const JsonObject& rhs) const
@@ -1698,15 +2243,53 @@ inline bool JsonObject::operator==(const JsonObject& rhs) const
 
 inline bool JsonLeaf::operator==(const JsonLeaf& rhs) const
 {
-    return _val == rhs._val;
+    if (_native && rhs._native && _type == rhs._type)
+    {
+        switch (_type)
+        {
+            case TypeChecker::Type::INT: return _num.i == rhs._num.i;
+            case TypeChecker::Type::BOOL: return _num.b == rhs._num.b;
+            default: return _num.f == rhs._num.f;
+        }
+    }
+    else if (!_native && !rhs._native)
+    {
+        return _val == rhs._val;
+    }
+    // A native float and a float text are compared by value.
+    if (_type == TypeChecker::Type::FLOAT && rhs._type == _type)
+    {
+        return as<double>() == rhs.as<double>();
+    }
+    return value() == rhs.value();
 }
 
 inline bool JsonList::operator==(const JsonList& rhs) const
 {
-    if (_list.size() != rhs._list.size()) return false;
-    for (unsigned long i = 0; i < _list.size(); ++i)
+    if (size() != rhs.size()) return false;
+    if (is_packed() && rhs.is_packed() && _packed_type == rhs._packed_type)
+    {
+        for (std::size_t i = 0; i < _packed.size(); ++i)
+        {
+            if (_packed[i] != rhs._packed[i] && _leaf(i) != rhs._leaf(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (!is_packed() && !rhs.is_packed())
+    {
+        for (unsigned long i = 0; i < _list.size(); ++i)
+        {
+            if (_list[i] != rhs._list[i]) return false;
+        }
+        return true;
+    }
+    // Compare the items without unpacking the packed numbers.
+    for (std::size_t i = 0; i < size(); ++i)
     {
-        if (_list[i] != rhs._list[i]) return false;
+        if (_item(i) != rhs._item(i)) return false;
     }
     return true;
 }
@@ -1730,12 +2313,14 @@ inline bool JsonDict::operator==(const JsonDict& rhs) const
 
 inline bool JsonItem::operator==(const JsonItem& rhs) const
 {
+    if (_value == rhs._value) return true;
+    if (!_value || !rhs._value) return false;
     return *_value == *rhs._value;
 }
 
 inline JsonLeaf::operator std::string() const
 {
-    return _val;
+    return value();
 }
 
 inline JsonList::operator std::string() const
@@ -1785,14 +2370,44 @@ inline JsonItem::operator std::string() const
 }
 
 template<typename T>
-inline std::vector<JsonItem> JsonList::_convert_vec(const std::vector<T>& list)
+inline void JsonList::_convert_vec(const std::vector<T>& list)
 {
-    std::vector<JsonItem> tmp(list.size());
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+        if (std::all_of(list.begin(), list.end(), _packable<T>))
+        {
+            _packed.assign(list.begin(), list.end());
+            _packed_type = std::is_floating_point_v<T>
+                ? TypeChecker::Type::FLOAT : TypeChecker::Type::INT;
+            return;
+        }
+    }
+
+    // The leaves are allocated in a single block shared by the items.
+    auto leaves = std::make_shared<std::vector<JsonLeaf>>();
+    leaves->reserve(list.size());
+    _list.reserve(list.size());
     for (unsigned long i = 0; i < list.size(); ++i)
     {
-        tmp[i] = JsonItem(list[i]);
+        leaves->emplace_back(list[i]);
+        _list.push_back(JsonItem(JsonObject::Shared(leaves, &leaves->back())));
     }
-    return tmp;
+}
+
+inline void JsonList::unpack()
+{
+    if (!is_packed()) return;
+    auto leaves = std::make_shared<std::vector<JsonLeaf>>();
+    leaves->reserve(_packed.size());
+    _list.clear();
+    _list.reserve(_packed.size());
+    for (std::size_t i = 0; i < _packed.size(); ++i)
+    {
+        leaves->push_back(_leaf(i));
+        _list.push_back(JsonItem(JsonObject::Shared(leaves, &leaves->back())));
+    }
+    _packed = std::vector<double>();
+    _packed_type = TypeChecker::Type::NONE;
 }
 
 template<typename T>
@@ -1808,7 +2423,7 @@ inline std::map<std::string, JsonItem> JsonDict::_convert_map(
 }
 
 template<typename T>
-inline T convert_json_object(JsonObject::Shared jo_ptr)
+inline T convert_json_object(const JsonObject::Shared& jo_ptr)
 {
     if (!jo_ptr)
     {
@@ -1818,7 +2433,7 @@ inline T convert_json_object(JsonObject::Shared jo_ptr)
     {
         case JsonObject::JsonType::LEAF:
         {
-            auto jl = std::dynamic_pointer_cast<JsonLeaf>(jo_ptr);
+            auto jl = dynamic_cast<const JsonLeaf*>(jo_ptr.get());
             if (jl) return static_cast<T>(*jl);
             break;
         }
@@ -1834,7 +2449,8 @@ inline T convert_json_object(JsonObject::Shared jo_ptr)
 }
 
 template<>
-inline JsonList convert_json_object<JsonList>(JsonObject::Shared jo_ptr)
+inline JsonList convert_json_object<JsonList>(
+    const JsonObject::Shared& jo_ptr)
 {
     if (!jo_ptr)
     {
@@ -1861,7 +2477,8 @@ inline JsonList convert_json_object<JsonList>(JsonObject::Shared jo_ptr)
 }
 
 template<>
-inline JsonDict convert_json_object<JsonDict>(JsonObject::Shared jo_ptr)
+inline JsonDict convert_json_object<JsonDict>(
+    const JsonObject::Shared& jo_ptr)
 {
     if (!jo_ptr)
     {
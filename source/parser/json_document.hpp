@@ -0,0 +1,674 @@
+/***************************************************************************
+ *            parser/json_document.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  parser/json_document.hpp
+ *  \brief Single pass JSON parser in a compact document.
+ */
+
+#ifndef EDGE_LEARNING_PARSER_JSON_DOCUMENT_HPP
+#define EDGE_LEARNING_PARSER_JSON_DOCUMENT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include "arm_neon.h"
+#endif
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief JSON document parsed in a single pass over a contiguous buffer,
+ * e.g. a whole file or a memory mapping.
+ *
+ * The values are stored in a contiguous vector of nodes in document order:
+ * the children of a list, and the key and value pairs of a dictionary,
+ * follow their container and each node knows where its subtree ends, so
+ * the siblings are reached without walking the subtrees. A node does not
+ * copy its text: strings, numbers and booleans are offsets in the source
+ * buffer, converted only when they are read. The string scanning uses SIMD
+ * instructions when available (SSE2 or NEON).
+ */
+class JsonDocument
+{
+    struct Node;
+
+public:
+    /// \brief Type of a value.
+    enum class Type : std::uint8_t
+    {
+        NONE,   ///< \brief null.
+        BOOL,
+        NUMBER,
+        STRING,
+        LIST,
+        DICT
+    };
+
+    /**
+     * \brief Read only handle of a value of the document.
+     */
+    class Value
+    {
+    public:
+        [[nodiscard]] Type type() const { return _node().type; }
+
+        /**
+         * \brief Amount of children.
+         * \return std::size_t The items of a list, the members of a
+         * dictionary, 0 otherwise.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            const auto& n = _node();
+            return n.type == Type::LIST || n.type == Type::DICT
+                ? n.length : 0;
+        }
+
+        /**
+         * \brief Raw text of a leaf in the source buffer: the string
+         * without quotes and escapes not resolved, the number or the
+         * boolean as written.
+         * \return std::string_view The view of the text.
+         */
+        [[nodiscard]] std::string_view text() const
+        {
+            const auto& n = _node();
+            if (n.type == Type::LIST || n.type == Type::DICT) return {};
+            return _doc->_data().substr(n.offset, n.length);
+        }
+
+        /**
+         * \brief Check if a number is written as an integer.
+         * \return bool True if the number has only sign and digits.
+         */
+        [[nodiscard]] bool is_integer() const
+        {
+            return type() == Type::NUMBER
+                && text().find_first_not_of("+-0123456789")
+                   == std::string_view::npos;
+        }
+
+        /**
+         * \brief Convert a number.
+         * \tparam T Arithmetic type.
+         * \return T The converted value.
+         */
+        template <typename T>
+        [[nodiscard]] T as_number() const
+        {
+            if (type() != Type::NUMBER)
+            {
+                throw std::runtime_error("JsonDocument: not a number");
+            }
+            auto t = text();
+            T val{};
+            auto [ptr, ec] = std::from_chars(t.data(), t.data() + t.size(),
+                                             val);
+            if (ec != std::errc() || ptr != t.data() + t.size())
+            {
+                // An integer type reading a number with fraction or
+                // exponent: convert through double.
+                double d = 0;
+                auto [dptr, dec] = std::from_chars(
+                    t.data(), t.data() + t.size(), d);
+                if (dec != std::errc() || dptr != t.data() + t.size())
+                {
+                    throw std::runtime_error(
+                        "JsonDocument: number not representable");
+                }
+                val = static_cast<T>(d);
+            }
+            return val;
+        }
+
+        [[nodiscard]] bool as_bool() const
+        {
+            if (type() != Type::BOOL)
+            {
+                throw std::runtime_error("JsonDocument: not a boolean");
+            }
+            return text() == "true";
+        }
+
+        /**
+         * \brief Convert a string resolving the escape sequences.
+         * \return std::string The string.
+         */
+        [[nodiscard]] std::string as_string() const
+        {
+            if (type() != Type::STRING)
+            {
+                throw std::runtime_error("JsonDocument: not a string");
+            }
+            if (!_node().escaped) return std::string(text());
+            return _unescape(text());
+        }
+
+        /**
+         * \brief First child of a list or of a dictionary: in a dictionary
+         * the children alternate key and value.
+         * \return Value The first child, or the end of the container.
+         */
+        [[nodiscard]] Value first_child() const
+        {
+            return Value{_doc, _idx + 1};
+        }
+
+        /**
+         * \brief Next value after the subtree of this one.
+         * \return Value The next sibling.
+         */
+        [[nodiscard]] Value next() const
+        {
+            return Value{_doc, _node().next};
+        }
+
+        /**
+         * \brief Item of a list.
+         * \param i std::size_t The item index.
+         * \return Value The item.
+         */
+        [[nodiscard]] Value operator[](std::size_t i) const
+        {
+            if (type() != Type::LIST || i >= size())
+            {
+                throw std::runtime_error("JsonDocument: item not found");
+            }
+            auto v = first_child();
+            for (; i > 0; --i) v = v.next();
+            return v;
+        }
+
+        /**
+         * \brief Value of a member of a dictionary.
+         * \param key std::string_view The key to search.
+         * \return Value The member value, it throws if not found.
+         */
+        [[nodiscard]] Value operator[](std::string_view key) const
+        {
+            if (type() != Type::DICT)
+            {
+                throw std::runtime_error("JsonDocument: not a dictionary");
+            }
+            auto k = first_child();
+            for (std::size_t i = 0; i < size(); ++i)
+            {
+                auto v = k.next();
+                if (k._node().escaped ? k.as_string() == key
+                                      : k.text() == key)
+                {
+                    return v;
+                }
+                k = v.next();
+            }
+            throw std::runtime_error(
+                "JsonDocument: key " + std::string(key) + " not found");
+        }
+
+        /**
+         * \brief Check if a dictionary has a member.
+         * \param key std::string_view The key to search.
+         * \return bool True if the key is found.
+         */
+        [[nodiscard]] bool contains(std::string_view key) const
+        {
+            if (type() != Type::DICT) return false;
+            auto k = first_child();
+            for (std::size_t i = 0; i < size(); ++i)
+            {
+                if (k._node().escaped ? k.as_string() == key
+                                      : k.text() == key)
+                {
+                    return true;
+                }
+                k = k.next().next();
+            }
+            return false;
+        }
+
+    private:
+        friend class JsonDocument;
+
+        Value(const JsonDocument* doc, std::uint32_t idx)
+            : _doc{doc}, _idx{idx}
+        { }
+
+        [[nodiscard]] const Node& _node() const
+        {
+            return _doc->_nodes[_idx];
+        }
+
+        const JsonDocument* _doc;
+        std::uint32_t _idx;
+    };
+
+    /**
+     * \brief Parse a buffer owned by the document.
+     * \param text   std::string The JSON text.
+     * \param prefix bool If true, only the first value is parsed and the
+     * rest of the text is ignored: see consumed().
+     */
+    explicit JsonDocument(std::string text, bool prefix = false)
+        : _owned{std::move(text)}
+        , _view{}
+        , _owning{true}
+        , _nodes{}
+        , _consumed{0}
+    {
+        _parse(prefix);
+    }
+
+    /**
+     * \brief Parse a buffer that is not copied, e.g. a memory mapped file:
+     * it has to outlive the document.
+     * \param text   std::string_view The JSON text.
+     * \param prefix bool If true, only the first value is parsed.
+     * \return JsonDocument The parsed document.
+     */
+    static JsonDocument view(std::string_view text, bool prefix = false)
+    {
+        return JsonDocument{text, prefix, ViewTag{}};
+    }
+
+    /**
+     * \brief The root value.
+     * \return Value The first value of the text.
+     */
+    [[nodiscard]] Value root() const { return Value{this, 0}; }
+
+    /**
+     * \brief Bytes of the text parsed: the first value and the white
+     * spaces around it.
+     * \return std::size_t The parsed bytes.
+     */
+    [[nodiscard]] std::size_t consumed() const { return _consumed; }
+
+    /**
+     * \brief Amount of values of the document.
+     * \return std::size_t The nodes.
+     */
+    [[nodiscard]] std::size_t node_count() const { return _nodes.size(); }
+
+private:
+    struct Node
+    {
+        /// \brief Text offset of a leaf, without the quotes of a string.
+        std::uint32_t offset;
+        /// \brief Text length of a leaf or children of a container.
+        std::uint32_t length;
+        /// \brief Index of the next sibling: the end of the subtree.
+        std::uint32_t next;
+        Type type;
+        /// \brief True for a string with escape sequences.
+        bool escaped;
+    };
+
+    /// \brief Select the constructor of a text not owned.
+    struct ViewTag {};
+
+    JsonDocument(std::string_view text, bool prefix, ViewTag)
+        : _owned{}
+        , _view{text}
+        , _owning{false}
+        , _nodes{}
+        , _consumed{0}
+    {
+        _parse(prefix);
+    }
+
+    [[nodiscard]] std::string_view _data() const
+    {
+        return _owning ? std::string_view{_owned} : _view;
+    }
+
+    [[noreturn]] static void _error(const char* what, std::size_t pos)
+    {
+        throw std::runtime_error(std::string("JsonDocument: ") + what
+                                 + " at offset " + std::to_string(pos));
+    }
+
+    static bool _is_space(char c)
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    static std::size_t _skip_spaces(std::string_view s, std::size_t pos)
+    {
+        while (pos < s.size() && _is_space(s[pos])) ++pos;
+        return pos;
+    }
+
+    /**
+     * \brief Position of the first quote or backslash from pos.
+     */
+    static std::size_t _find_quote(std::string_view s, std::size_t pos)
+    {
+        const char* data = s.data();
+#if defined(__SSE2__)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        for (; pos + 16 <= s.size(); pos += 16)
+        {
+            __m128i chunk = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(data + pos));
+            int mask = _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(chunk, quote),
+                _mm_cmpeq_epi8(chunk, backslash)));
+            if (mask != 0)
+            {
+                return pos + static_cast<std::size_t>(__builtin_ctz(
+                    static_cast<unsigned int>(mask)));
+            }
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        const uint8x16_t quote = vdupq_n_u8('"');
+        const uint8x16_t backslash = vdupq_n_u8('\\');
+        for (; pos + 16 <= s.size(); pos += 16)
+        {
+            uint8x16_t chunk = vld1q_u8(
+                reinterpret_cast<const std::uint8_t*>(data + pos));
+            uint8x16_t match = vorrq_u8(vceqq_u8(chunk, quote),
+                                        vceqq_u8(chunk, backslash));
+            if (vmaxvq_u8(match) != 0) break;
+        }
+#endif
+        for (; pos < s.size(); ++pos)
+        {
+            if (data[pos] == '"' || data[pos] == '\\') return pos;
+        }
+        return pos;
+    }
+
+    static bool _is_number_char(char c)
+    {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+'
+            || c == '.' || c == 'e' || c == 'E';
+    }
+
+    std::uint32_t _push(Type type, std::size_t offset, std::size_t length)
+    {
+        if (_nodes.size() >= std::numeric_limits<std::uint32_t>::max())
+        {
+            _error("too many values", offset);
+        }
+        _nodes.push_back({static_cast<std::uint32_t>(offset),
+                          static_cast<std::uint32_t>(length),
+                          0, type, false});
+        auto idx = static_cast<std::uint32_t>(_nodes.size() - 1);
+        _nodes[idx].next = idx + 1;
+        return idx;
+    }
+
+    /**
+     * \brief Parse a string starting at the opening quote.
+     * \return std::size_t The position after the closing quote.
+     */
+    std::size_t _string(std::string_view s, std::size_t pos)
+    {
+        auto begin = pos + 1;
+        bool escaped = false;
+        auto end = _find_quote(s, begin);
+        while (end < s.size() && s[end] == '\\')
+        {
+            escaped = true;
+            end = _find_quote(s, end + 2);
+        }
+        if (end >= s.size()) _error("unterminated string", pos);
+        auto idx = _push(Type::STRING, begin, end - begin);
+        _nodes[idx].escaped = escaped;
+        return end + 1;
+    }
+
+    void _parse(bool prefix)
+    {
+        auto s = _data();
+        if (s.size() >= std::numeric_limits<std::uint32_t>::max())
+        {
+            _error("text too long", 0);
+        }
+        // Conservative estimate of the values, the vector grows if needed.
+        _nodes.reserve(s.size() / 64 + 16);
+
+        // Open containers: node index and true if a key is expected.
+        std::vector<std::uint32_t> stack;
+        std::size_t pos = _skip_spaces(s, 0);
+        bool value_expected = true;
+        while (true)
+        {
+            if (value_expected)
+            {
+                if (pos >= s.size()) _error("value expected", pos);
+                char c = s[pos];
+                if (c == '{' || c == '[')
+                {
+                    auto type = c == '{' ? Type::DICT : Type::LIST;
+                    stack.push_back(_push(type, pos, 0));
+                    pos = _skip_spaces(s, pos + 1);
+                    char close = c == '{' ? '}' : ']';
+                    if (pos < s.size() && s[pos] == close)
+                    {
+                        ++pos;
+                        _close(stack);
+                        value_expected = false;
+                    }
+                    else if (type == Type::DICT)
+                    {
+                        pos = _key(s, pos, stack.back());
+                    }
+                    else
+                    {
+                        ++_nodes[stack.back()].length;
+                    }
+                    if (!value_expected && stack.empty()) break;
+                    continue;
+                }
+                if (c == '"')
+                {
+                    pos = _string(s, pos);
+                }
+                else if (c == 't' || c == 'f'
+                         || (c == 'n' && s.substr(pos, 2) == "nu"))
+                {
+                    auto word = c == 't' ? std::string_view{"true"}
+                              : c == 'f' ? std::string_view{"false"}
+                              : std::string_view{"null"};
+                    if (s.substr(pos, word.size()) != word)
+                    {
+                        _error("unexpected literal", pos);
+                    }
+                    _push(c == 'n' ? Type::NONE : Type::BOOL,
+                          pos, word.size());
+                    pos += word.size();
+                }
+                else if (_is_number_char(c) || c == 'n' || c == 'i')
+                {
+                    // The letters accept nan and inf written by
+                    // std::to_string, as the previous stream parser did.
+                    auto begin = pos;
+                    while (pos < s.size() && (_is_number_char(s[pos])
+                           || (s[pos] >= 'a' && s[pos] <= 'z')))
+                    {
+                        ++pos;
+                    }
+                    _push(Type::NUMBER, begin, pos - begin);
+                }
+                else
+                {
+                    _error("unexpected character", pos);
+                }
+                value_expected = false;
+                if (stack.empty()) break;
+            }
+
+            // After a value: a separator or the end of the container.
+            pos = _skip_spaces(s, pos);
+            if (pos >= s.size()) _error("unterminated container", pos);
+            auto top = stack.back();
+            char c = s[pos++];
+            if (c == ',')
+            {
+                pos = _skip_spaces(s, pos);
+                if (_nodes[top].type == Type::DICT)
+                {
+                    pos = _key(s, pos, top);
+                }
+                else
+                {
+                    ++_nodes[top].length;
+                }
+                value_expected = true;
+            }
+            else if ((c == '}' && _nodes[top].type == Type::DICT)
+                     || (c == ']' && _nodes[top].type == Type::LIST))
+            {
+                _close(stack);
+                if (stack.empty()) break;
+            }
+            else
+            {
+                _error("',' or closing bracket expected", pos - 1);
+            }
+        }
+
+        pos = _skip_spaces(s, pos);
+        if (!prefix && pos != s.size()) _error("trailing characters", pos);
+        _consumed = pos;
+    }
+
+    /**
+     * \brief Parse the key of a dictionary member and the colon.
+     * \return std::size_t The position of the member value.
+     */
+    std::size_t _key(std::string_view s, std::size_t pos, std::uint32_t dict)
+    {
+        if (pos >= s.size() || s[pos] != '"') _error("key expected", pos);
+        pos = _skip_spaces(s, _string(s, pos));
+        if (pos >= s.size() || s[pos] != ':') _error("':' expected", pos);
+        ++_nodes[dict].length;
+        return _skip_spaces(s, pos + 1);
+    }
+
+    void _close(std::vector<std::uint32_t>& stack)
+    {
+        _nodes[stack.back()].next = static_cast<std::uint32_t>(_nodes.size());
+        stack.pop_back();
+    }
+
+    static void _utf8(std::string& out, std::uint32_t cp)
+    {
+        if (cp < 0x80)
+        {
+            out.push_back(static_cast<char>(cp));
+        }
+        else if (cp < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    static std::uint32_t _hex4(std::string_view s, std::size_t pos)
+    {
+        std::uint32_t cp = 0;
+        if (pos + 4 > s.size()
+            || std::from_chars(s.data() + pos, s.data() + pos + 4, cp, 16).ptr
+               != s.data() + pos + 4)
+        {
+            throw std::runtime_error("JsonDocument: invalid \\u escape");
+        }
+        return cp;
+    }
+
+    static std::string _unescape(std::string_view s)
+    {
+        std::string out;
+        out.reserve(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            if (s[i] != '\\' || i + 1 == s.size())
+            {
+                out.push_back(s[i]);
+                continue;
+            }
+            switch (s[++i])
+            {
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                case 'u':
+                {
+                    auto cp = _hex4(s, i + 1);
+                    i += 4;
+                    if (cp >= 0xD800 && cp < 0xDC00 && i + 6 < s.size()
+                        && s[i + 1] == '\\' && s[i + 2] == 'u')
+                    {
+                        auto low = _hex4(s, i + 3);
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                    _utf8(out, cp);
+                    break;
+                }
+                default: out.push_back(s[i]); break;
+            }
+        }
+        return out;
+    }
+
+    std::string _owned;     ///< \brief Text owned by the document.
+    std::string_view _view; ///< \brief Text not owned by the document.
+    bool _owning;           ///< \brief True if the text is _owned.
+    std::vector<Node> _nodes;
+    std::size_t _consumed;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_PARSER_JSON_DOCUMENT_HPP
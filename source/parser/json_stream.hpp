@@ -0,0 +1,753 @@
+/***************************************************************************
+ *            parser/json_stream.hpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*! \file  parser/json_stream.hpp
+ *  \brief Streaming JSON writer and pull reader.
+ */
+
+#ifndef EDGE_LEARNING_PARSER_JSON_STREAM_HPP
+#define EDGE_LEARNING_PARSER_JSON_STREAM_HPP
+
+#include "json.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+
+namespace EdgeLearning {
+
+/**
+ * \brief JSON writer that emits the tokens straight to an output stream,
+ * without building a Json tree. The numbers are written with the shortest
+ * representation that reads back to the same value (std::to_chars), the
+ * non-finite ones as null. The control characters of the strings are
+ * escaped as \\uXXXX.
+ *
+ * The output is buffered and flushed when the buffer is full, on flush()
+ * and on destruction. The caller is in charge of the structure: every
+ * begin_object and begin_array have to be closed, and inside an object
+ * every value has to be preceded by a key.
+ */
+class JsonWriter
+{
+public:
+    /// \brief Size of the output buffer in bytes.
+    static constexpr std::size_t BUFFER_SIZE = 1 << 16;
+
+    /**
+     * \brief Construct a writer on an output stream.
+     * \param os std::ostream& The stream to write.
+     */
+    explicit JsonWriter(std::ostream& os)
+        : _os{os}
+        , _buffer{}
+        , _first{}
+        , _after_key{false}
+    {
+        _buffer.reserve(BUFFER_SIZE);
+    }
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    ~JsonWriter()
+    {
+        if (!_buffer.empty()) _os.write(_buffer.data(),
+            static_cast<std::streamsize>(_buffer.size()));
+    }
+
+    void begin_object() { _open('{'); }
+    void end_object() { _close('}'); }
+    void begin_array() { _open('['); }
+    void end_array() { _close(']'); }
+
+    /**
+     * \brief Write the key of the next value of an object.
+     * \param key const std::string& The key.
+     */
+    void key(const std::string& key)
+    {
+        _separator();
+        _string(key);
+        _put(':');
+        _after_key = true;
+    }
+
+    /**
+     * \brief Write a number with the shortest round trip representation,
+     * or null if it is not finite.
+     * \tparam T Integer or floating point type.
+     * \param val T The number to write.
+     */
+    template <typename T, typename std::enable_if_t<
+        std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    void value(T val)
+    {
+        _separator();
+        _number(val);
+    }
+
+    void value(bool val)
+    {
+        _separator();
+        _write(val ? "true" : "false");
+    }
+
+    void value(const std::string& val)
+    {
+        _separator();
+        _string(val);
+    }
+
+    void value(const char* val) { value(std::string(val)); }
+
+    /**
+     * \brief Write a Json tree as a value, e.g. a small metadata object.
+     * \param val const Json& The tree to write.
+     */
+    void value(const Json& val)
+    {
+        _separator();
+        std::ostringstream oss;
+        oss << val;
+        _write(oss.str());
+    }
+
+    /**
+     * \brief Write all the members of a Json dictionary in the current
+     * object.
+     * \param dict const Json& The dictionary to merge in the object.
+     */
+    void members(const Json& dict)
+    {
+        std::ostringstream oss;
+        oss << dict;
+        auto str = oss.str();
+        if (str.size() <= 2) return;
+        _separator();
+        _write(str.substr(1, str.size() - 2));
+    }
+
+    /**
+     * \brief Write a row-major tensor as nested arrays, one level for each
+     * dimension of the shape.
+     * \tparam T The numeric type.
+     * \param data  const T* The first value of the tensor.
+     * \param shape const std::vector<std::size_t>& The dimensions.
+     */
+    template <typename T>
+    void tensor(const T* data, const std::vector<std::size_t>& shape)
+    {
+        std::size_t size = 1;
+        for (auto d: shape) size *= d;
+        _tensor(data, shape, 0, size);
+    }
+
+    /**
+     * \brief Write the buffered output to the stream.
+     */
+    void flush()
+    {
+        _os.write(_buffer.data(),
+                  static_cast<std::streamsize>(_buffer.size()));
+        _buffer.clear();
+        _os.flush();
+    }
+
+private:
+    void _put(char c)
+    {
+        if (_buffer.size() == BUFFER_SIZE) flush();
+        _buffer.push_back(c);
+    }
+
+    void _write(const std::string& str)
+    {
+        if (_buffer.size() + str.size() > BUFFER_SIZE) flush();
+        _buffer.append(str);
+    }
+
+    void _separator()
+    {
+        if (_after_key)
+        {
+            _after_key = false;
+            return;
+        }
+        if (_first.empty()) return;
+        if (!_first.back()) _put(',');
+        _first.back() = false;
+    }
+
+    void _open(char c)
+    {
+        _separator();
+        _put(c);
+        _first.push_back(true);
+    }
+
+    void _close(char c)
+    {
+        if (_first.empty())
+        {
+            throw std::runtime_error("JsonWriter: close without open");
+        }
+        _first.pop_back();
+        _put(c);
+    }
+
+    void _string(const std::string& str)
+    {
+        static constexpr char HEX[] = "0123456789abcdef";
+        _put('"');
+        for (auto c: str)
+        {
+            auto u = static_cast<unsigned char>(c);
+            if (u < 0x20)
+            {
+                _write("\\u00");
+                _put(HEX[u >> 4]);
+                _put(HEX[u & 0xF]);
+                continue;
+            }
+            if (c == '"' || c == '\\') _put('\\');
+            _put(c);
+        }
+        _put('"');
+    }
+
+    template <typename T>
+    void _number(T val)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (!std::isfinite(val))
+            {
+                _write("null");
+                return;
+            }
+        }
+        // Enough for the shortest representation of any double.
+        char chars[32];
+        auto [end, ec] = std::to_chars(chars, chars + sizeof(chars), val);
+        if (ec != std::errc())
+        {
+            throw std::runtime_error("JsonWriter: number not representable");
+        }
+        if (_buffer.size() + sizeof(chars) > BUFFER_SIZE) flush();
+        _buffer.append(chars, end);
+    }
+
+    template <typename T>
+    void _tensor(const T* data, const std::vector<std::size_t>& shape,
+                 std::size_t dim, std::size_t size)
+    {
+        begin_array();
+        if (dim + 1 == shape.size())
+        {
+            for (std::size_t i = 0; i < size; ++i) value(data[i]);
+        }
+        else if (shape[dim] > 0)
+        {
+            auto step = size / shape[dim];
+            for (std::size_t i = 0; i < shape[dim]; ++i)
+            {
+                _tensor(data + i * step, shape, dim + 1, step);
+            }
+        }
+        end_array();
+    }
+
+    std::ostream& _os;
+    std::string _buffer;
+    /// \brief For each open container, true until its first value.
+    std::vector<bool> _first;
+    /// \brief True between a key and its value.
+    bool _after_key;
+};
+
+/**
+ * \brief Pull JSON reader: the caller walks the document token by token
+ * and reads the numbers straight into its buffers, without building the
+ * JsonDict and JsonList nodes. A subtree can still be read as a Json with
+ * read(), e.g. for small metadata objects.
+ *
+ * The numbers are parsed with std::from_chars.
+ */
+class JsonReader
+{
+public:
+    /// \brief Size of the input buffer in bytes.
+    static constexpr std::size_t BUFFER_SIZE = 1 << 16;
+
+    /**
+     * \brief Construct a reader on an input stream.
+     * \param is std::istream& The stream to read.
+     */
+    explicit JsonReader(std::istream& is)
+        : _is{is}
+        , _buffer(BUFFER_SIZE)
+        , _pos{0}
+        , _end{0}
+        , _first{}
+    { }
+
+    /**
+     * \brief Enter an object.
+     */
+    void begin_object() { _expect('{'); _pending_first(); }
+
+    /**
+     * \brief Read the key of the next member of the current object.
+     * \param key std::string& The read key.
+     * \return bool False if the object is over: the closing bracket is
+     * consumed and key is not modified.
+     */
+    bool next_key(std::string& key)
+    {
+        if (!_next('}')) return false;
+        key = _string();
+        _expect(':');
+        return true;
+    }
+
+    /**
+     * \brief Enter an array.
+     */
+    void begin_array() { _expect('['); _pending_first(); }
+
+    /**
+     * \brief Move to the next value of the current array.
+     * \return bool False if the array is over: the closing bracket is
+     * consumed.
+     */
+    bool next_item() { return _next(']'); }
+
+    /**
+     * \brief Read a number. A null, written for a non-finite number, reads
+     * as NaN.
+     * \return double The read value.
+     */
+    double read_number()
+    {
+        _skip_spaces();
+        if (_peek() == 'n')
+        {
+            if (_word() != "null")
+            {
+                throw std::runtime_error("JsonReader: number expected");
+            }
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        char chars[64];
+        std::size_t len = 0;
+        for (int c = _peek(); _is_number_char(c); c = _peek())
+        {
+            if (len == sizeof(chars))
+            {
+                throw std::runtime_error("JsonReader: number too long");
+            }
+            chars[len++] = static_cast<char>(_get());
+        }
+        double val = 0;
+        auto [ptr, ec] = std::from_chars(chars, chars + len, val);
+        if (ec != std::errc() || ptr != chars + len)
+        {
+            throw std::runtime_error("JsonReader: number expected");
+        }
+        return val;
+    }
+
+    /**
+     * \brief Read a string.
+     * \return std::string The read string.
+     */
+    std::string read_string() { return _string(); }
+
+    /**
+     * \brief Read the numbers of a value, flattening the nested arrays,
+     * straight into a list of buffers filled one after the other.
+     * \tparam T The numeric type of the buffers.
+     * \param buffers const std::vector<std::pair<T*, std::size_t>>& The
+     * buffers and their size. The total size has to match the numbers read.
+     */
+    template <typename T>
+    void read_numbers(const std::vector<std::pair<T*, std::size_t>>& buffers)
+    {
+        std::size_t buffer = 0;
+        std::size_t pos = 0;
+        _read_numbers([&](double val) {
+            while (buffer < buffers.size() && pos == buffers[buffer].second)
+            {
+                ++buffer;
+                pos = 0;
+            }
+            if (buffer == buffers.size())
+            {
+                throw std::runtime_error("JsonReader: too many numbers");
+            }
+            buffers[buffer].first[pos++] = static_cast<T>(val);
+        });
+        while (buffer < buffers.size() && pos == buffers[buffer].second)
+        {
+            ++buffer;
+            pos = 0;
+        }
+        if (buffer != buffers.size())
+        {
+            throw std::runtime_error("JsonReader: too few numbers");
+        }
+    }
+
+    /**
+     * \brief Read the numbers of a value, flattening the nested arrays, at
+     * the end of a vector.
+     * \tparam T The numeric type of the vector.
+     * \param values std::vector<T>& The vector to fill.
+     */
+    template <typename T>
+    void read_numbers(std::vector<T>& values)
+    {
+        _read_numbers([&](double val) {
+            values.push_back(static_cast<T>(val));
+        });
+    }
+
+    /**
+     * \brief Read a whole value as a Json tree.
+     * \return Json The read value.
+     */
+    Json read()
+    {
+        _skip_spaces();
+        switch (_peek())
+        {
+            case '{':
+            {
+                std::map<std::string, Json> dict;
+                begin_object();
+                std::string key;
+                while (next_key(key)) dict[key] = read();
+                return Json(dict);
+            }
+            case '[':
+            {
+                std::vector<Json> list;
+                begin_array();
+                while (next_item()) list.push_back(read());
+                return Json(list);
+            }
+            case '"':
+                return Json(JsonLeaf(_string(), TypeChecker::Type::STRING));
+            case 't':
+            case 'f':
+            case 'n':
+            {
+                auto word = _word();
+                if (word == "null") return Json();
+                return Json(JsonLeaf(word, TypeChecker::Type::BOOL));
+            }
+            default:
+            {
+                auto number = _number_text();
+                bool is_float =
+                    number.find_first_of(".eE") != std::string::npos;
+                return Json(JsonLeaf(number, is_float
+                    ? TypeChecker::Type::FLOAT : TypeChecker::Type::INT));
+            }
+        }
+    }
+
+    /**
+     * \brief Skip a whole value.
+     */
+    void skip()
+    {
+        _skip_spaces();
+        switch (_peek())
+        {
+            case '{':
+            {
+                begin_object();
+                std::string key;
+                while (next_key(key)) skip();
+                break;
+            }
+            case '[':
+            {
+                begin_array();
+                while (next_item()) skip();
+                break;
+            }
+            case '"': _string(); break;
+            case 't':
+            case 'f':
+            case 'n': _word(); break;
+            default: _number_text(); break;
+        }
+    }
+
+private:
+    static bool _is_number_char(int c)
+    {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+'
+            || c == '.' || c == 'e' || c == 'E';
+    }
+
+    int _peek()
+    {
+        if (_pos == _end)
+        {
+            _is.read(_buffer.data(),
+                     static_cast<std::streamsize>(_buffer.size()));
+            _end = static_cast<std::size_t>(_is.gcount());
+            _pos = 0;
+            if (_end == 0) return EOF;
+        }
+        return static_cast<unsigned char>(_buffer[_pos]);
+    }
+
+    int _get()
+    {
+        auto c = _peek();
+        if (c != EOF) ++_pos;
+        return c;
+    }
+
+    void _skip_spaces()
+    {
+        for (int c = _peek();
+             c == ' ' || c == '\n' || c == '\t' || c == '\r';
+             c = _peek())
+        {
+            ++_pos;
+        }
+    }
+
+    void _expect(char c)
+    {
+        _skip_spaces();
+        if (_get() != c)
+        {
+            throw std::runtime_error(
+                std::string("JsonReader: '") + c + "' expected");
+        }
+    }
+
+    /// \brief Mark that the container just opened has no values yet.
+    void _pending_first() { _first.push_back(true); }
+
+    /**
+     * \brief Move to the next value of the current container.
+     * \param close char The closing bracket of the container.
+     * \return bool False if the container is over.
+     */
+    bool _next(char close)
+    {
+        _skip_spaces();
+        if (_peek() == close)
+        {
+            ++_pos;
+            _first.pop_back();
+            return false;
+        }
+        if (!_first.back()) _expect(',');
+        _first.back() = false;
+        return true;
+    }
+
+    std::string _string()
+    {
+        _expect('"');
+        std::string str;
+        for (int c = _get(); c != '"'; c = _get())
+        {
+            if (c == EOF)
+            {
+                throw std::runtime_error("JsonReader: unterminated string");
+            }
+            if (c == '\\')
+            {
+                _escape(str);
+                continue;
+            }
+            str.push_back(static_cast<char>(c));
+        }
+        return str;
+    }
+
+    /**
+     * \brief Decode the escape sequence after a backslash in a string.
+     * \param str std::string& The string to append the character to.
+     */
+    void _escape(std::string& str)
+    {
+        auto c = _get();
+        switch (c)
+        {
+            case '"':
+            case '\\':
+            case '/': str.push_back(static_cast<char>(c)); break;
+            case 'b': str.push_back('\b'); break;
+            case 'f': str.push_back('\f'); break;
+            case 'n': str.push_back('\n'); break;
+            case 'r': str.push_back('\r'); break;
+            case 't': str.push_back('\t'); break;
+            case 'u':
+            {
+                auto code = _hex4();
+                // Surrogate pair of a code point out of the BMP.
+                if (code >= 0xD800 && code < 0xDC00)
+                {
+                    if (_get() != '\\' || _get() != 'u')
+                    {
+                        throw std::runtime_error(
+                            "JsonReader: unpaired surrogate");
+                    }
+                    auto low = _hex4();
+                    if (low < 0xDC00 || low >= 0xE000)
+                    {
+                        throw std::runtime_error(
+                            "JsonReader: unpaired surrogate");
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10)
+                        + (low - 0xDC00);
+                }
+                _utf8(str, code);
+                break;
+            }
+            default:
+                throw std::runtime_error("JsonReader: invalid escape");
+        }
+    }
+
+    std::uint32_t _hex4()
+    {
+        std::uint32_t code = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            auto c = _get();
+            int digit;
+            if (c >= '0' && c <= '9') digit = c - '0';
+            else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+            else throw std::runtime_error("JsonReader: invalid \\u escape");
+            code = (code << 4) | static_cast<std::uint32_t>(digit);
+        }
+        return code;
+    }
+
+    static void _utf8(std::string& str, std::uint32_t code)
+    {
+        auto put = [&str](std::uint32_t byte) {
+            str.push_back(static_cast<char>(byte));
+        };
+        if (code < 0x80)
+        {
+            put(code);
+        }
+        else if (code < 0x800)
+        {
+            put(0xC0 | (code >> 6));
+            put(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000)
+        {
+            put(0xE0 | (code >> 12));
+            put(0x80 | ((code >> 6) & 0x3F));
+            put(0x80 | (code & 0x3F));
+        }
+        else
+        {
+            put(0xF0 | (code >> 18));
+            put(0x80 | ((code >> 12) & 0x3F));
+            put(0x80 | ((code >> 6) & 0x3F));
+            put(0x80 | (code & 0x3F));
+        }
+    }
+
+    std::string _word()
+    {
+        std::string word;
+        for (int c = _peek(); c >= 'a' && c <= 'z'; c = _peek())
+        {
+            word.push_back(static_cast<char>(_get()));
+        }
+        if (word != "true" && word != "false" && word != "null")
+        {
+            throw std::runtime_error("JsonReader: unexpected " + word);
+        }
+        return word;
+    }
+
+    std::string _number_text()
+    {
+        std::string number;
+        for (int c = _peek(); _is_number_char(c); c = _peek())
+        {
+            number.push_back(static_cast<char>(_get()));
+        }
+        if (number.empty())
+        {
+            throw std::runtime_error("JsonReader: value expected");
+        }
+        return number;
+    }
+
+    template <typename F>
+    void _read_numbers(F&& f)
+    {
+        _skip_spaces();
+        if (_peek() == '[')
+        {
+            begin_array();
+            while (next_item()) _read_numbers(f);
+        }
+        else
+        {
+            f(read_number());
+        }
+    }
+
+    std::istream& _is;
+    std::vector<char> _buffer;
+    std::size_t _pos;   ///< \brief Next character in the buffer.
+    std::size_t _end;   ///< \brief End of the valid characters.
+    /// \brief For each open container, true until its first value.
+    std::vector<bool> _first;
+};
+
+} // namespace EdgeLearning
+
+#endif // EDGE_LEARNING_PARSER_JSON_STREAM_HPP
@@ -31,8 +31,11 @@
 
 #include "parser.hpp"
 #include "data/path.hpp"
+#include "data/mapped_file.hpp"
 
 #include <cstddef>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <fstream>
@@ -79,6 +82,20 @@ static inline uint32_t read_uint32_endian_order(std::ifstream& ifs)
     return ret;
 }
 
+/**
+ * \brief Read from memory an uint32 value in the right endian order
+ * according to the processor characteristics.
+ * \param data The input bytes.
+ * \return uint32_t The uint32 value in the right endian order.
+ */
+static inline uint32_t read_uint32_endian_order(const std::uint8_t* data)
+{
+    std::uint32_t ret;
+    std::memcpy(&ret, data, 4);
+    uint32_endian_order(ret);
+    return ret;
+}
+
 /**
  * \brief Class for a single image of the Mnist dataset.
  */
@@ -103,6 +120,17 @@ public:
                   IMAGE_SIDE * IMAGE_SIDE);
     }
 
+    /**
+     * \brief Mnist Image constructor.
+     * \param data The side * side bytes of the Mnist image.
+     * \param idx The image index in the dataset.
+     */
+    MnistImage(const std::uint8_t* data, std::size_t idx)
+        : Parser()
+        , _image(data, data + IMAGE_SIDE * IMAGE_SIDE)
+        , _idx{idx}
+    { }
+
     /**
      * \brief MnistImage default deconstruct.
      */
@@ -191,6 +219,17 @@ public:
         data.read(reinterpret_cast<char *>(&_label), 1);
     }
 
+    /**
+     * \brief Mnist Label constructor.
+     * \param label The Mnist label value.
+     * \param idx The label index in the dataset.
+     */
+    MnistLabel(std::uint8_t label, std::size_t idx)
+        : Parser()
+        , _label{label}
+        , _idx{idx}
+    { }
+
     /**
      * \brief MnistLabel default deconstruct.
      */
@@ -247,6 +286,9 @@ struct MnistItem
 
 /**
  * \brief MNIST Dataset core class.
+ * The image and the label files are memory mapped once: the images are
+ * accessed as bytes in the mapped files without reads or copies.
+ * The images and the labels beyond the end of a truncated file are zeros.
  */
 class Mnist : public DatasetParser
 {
@@ -259,6 +301,11 @@ public:
     static const std::size_t IMAGE_HEADER_SIZE = 16;
     /// \brief The header size in bytes of the label file.
     static const std::size_t LABEL_HEADER_SIZE = 8;
+    /// \brief The size in bytes of an image.
+    static const std::size_t IMAGE_BYTES =
+        MnistImage::IMAGE_SIDE * MnistImage::IMAGE_SIDE;
+    /// \brief Minimum amount of entries converted by each worker of entries().
+    static const std::size_t PARALLEL_CHUNK_ENTRIES = 256;
 
     /**
      * \brief Mnist core class constructor.
@@ -267,54 +314,34 @@ public:
      */
     Mnist(fs::path image_fp, fs::path label_fp)
         : DatasetParser()
-        , _image_ifs{image_fp}
-        , _label_ifs{label_fp}
+        , _images{_map(image_fp, "Images malformed: could not open file")}
+        , _labels{_map(label_fp, "Labels malformed: could not open file")}
+        , _size{0}
     {
-        if(!_image_ifs.is_open() || !_image_ifs.good())
-        {
-            _image_ifs.close();
-            _label_ifs.close();
-            throw std::runtime_error("Images malformed: could not open file");
-        }
-        if(!_label_ifs.is_open() || !_label_ifs.good())
+        if (_is_malformed(*_images, IMAGE_HEADER_SIZE, IMAGE_MAGIC))
         {
-            _image_ifs.close();
-            _label_ifs.close();
-            throw std::runtime_error("Labels malformed: could not open file");
-        }
-
-        if (_is_malformed(_image_ifs, IMAGE_MAGIC))
-        {
-            _image_ifs.close();
-            _label_ifs.close();
             throw std::runtime_error("Images malformed: magic number error");
         }
-        auto image_count = read_uint32_endian_order(_image_ifs);
+        auto image_count = read_uint32_endian_order(_images->data() + 4);
 
-        if (_is_malformed(_label_ifs, LABEL_MAGIC))
+        if (_is_malformed(*_labels, LABEL_HEADER_SIZE, LABEL_MAGIC))
         {
-            _image_ifs.close();
-            _label_ifs.close();
             throw std::runtime_error("Labels malformed: magic number error");
         }
-        auto label_count = read_uint32_endian_order(_label_ifs);
+        auto label_count = read_uint32_endian_order(_labels->data() + 4);
 
         if (label_count != image_count)
         {
-            _image_ifs.close();
-            _label_ifs.close();
             throw std::runtime_error("Data malformed: "
                                      "labels amount not match images amount");
         }
         _size = image_count;
 
         std::uint32_t columns, rows;
-        rows = read_uint32_endian_order(_image_ifs);
-        columns = read_uint32_endian_order(_image_ifs);
+        rows = read_uint32_endian_order(_images->data() + 8);
+        columns = read_uint32_endian_order(_images->data() + 12);
         if (rows != MnistImage::IMAGE_SIDE || columns != MnistImage::IMAGE_SIDE)
         {
-            _image_ifs.close();
-            _label_ifs.close();
             throw std::runtime_error("Data malformed: "
                                      "not expected image shape");
         }
@@ -322,13 +349,9 @@ public:
 
     /**
      * \brief Mnist object deconstruct.
-     * Clone image and label file streams.
+     * Unmap image and label files.
      */
-    ~Mnist()
-    {
-        _image_ifs.close();
-        _label_ifs.close();
-    }
+    ~Mnist() = default;
 
     /**
      * \brief Getter of the data amount in the dataset.
@@ -363,17 +386,37 @@ public:
         return {side(), side()};
     }
 
+    /**
+     * \brief Get the bytes of an image in the mapped file, without copies.
+     * \param idx The index of the Mnist image.
+     * \return const std::uint8_t* The IMAGE_BYTES bytes of the image.
+     */
+    const std::uint8_t* image_data(std::size_t idx) const
+    {
+        auto offset = IMAGE_HEADER_SIZE + (idx % _size) * IMAGE_BYTES;
+        if (offset + IMAGE_BYTES > _images->size()) return ZERO_IMAGE;
+        return _images->data() + offset;
+    }
+
+    /**
+     * \brief Get a label value in the mapped file.
+     * \param idx The index of the Mnist label.
+     * \return std::uint8_t The label value.
+     */
+    std::uint8_t label_data(std::size_t idx) const
+    {
+        auto offset = LABEL_HEADER_SIZE + (idx % _size);
+        return offset < _labels->size() ? _labels->data()[offset] : 0;
+    }
+
     /**
      * \brief Get an image from the Mnist dataset at index.
      * \param idx The index of the Mnist image.
      * \return MnistImage The image object at idx index.
      */
-    MnistImage image(std::size_t idx)
+    MnistImage image(std::size_t idx) const
     {
-        idx = idx % _size;
-        _image_ifs.seekg(static_cast<std::int64_t>(
-            IMAGE_HEADER_SIZE + idx * height() * width()), _image_ifs.beg);
-        return MnistImage{_image_ifs, idx};
+        return MnistImage{image_data(idx), idx % _size};
     }
 
     /**
@@ -381,12 +424,9 @@ public:
      * \param idx The index of the Mnist label.
      * \return MnistLabel The label object at idx index.
      */
-    MnistLabel label(std::size_t idx)
+    MnistLabel label(std::size_t idx) const
     {
-        idx = idx % _size;
-        _label_ifs.seekg(static_cast<std::int64_t>(
-            LABEL_HEADER_SIZE + idx), _label_ifs.beg);
-        return MnistLabel{_label_ifs, idx};
+        return MnistLabel{label_data(idx), idx % _size};
     }
 
     /**
@@ -401,13 +441,39 @@ public:
 
     std::vector<NumType> entry(SizeType i) override
     {
-        auto mnist_image = image(i).data();
-        auto mnist_label = label(i).data();
-        std::vector<NumType> ret(mnist_image.begin(), mnist_image.end());
-        ret.push_back(mnist_label);
+        std::vector<NumType> ret(feature_size());
+        _entry(i, ret.data());
         return ret;
     }
 
+    std::vector<NumType> entries() override
+    {
+        std::vector<NumType> ret(entries_amount() * feature_size());
+        entries(ret.data());
+        return ret;
+    }
+
+    /**
+     * \brief Convert all the entries in a preallocated row-major buffer.
+     * The entries are split in chunks converted in parallel.
+     * \tparam T The arithmetic type of the buffer.
+     * \param dst     The buffer of entries_amount() * feature_size() elements.
+     * \param workers The maximum amount of parallel chunks, 0 to use the
+     * task manager concurrency.
+     */
+    template<typename T>
+    void entries(T* dst, std::size_t workers = 0) const
+    {
+        _parallel_chunks(
+            entries_amount(), PARALLEL_CHUNK_ENTRIES, workers,
+            [this, dst](SizeType from, SizeType to) {
+                for (SizeType i = from; i < to; ++i)
+                {
+                    _entry(i, dst + i * feature_size());
+                }
+            });
+    }
+
     SizeType entries_amount() const override
     {
         return size();
@@ -424,22 +490,58 @@ public:
     }
 
 private:
+    /// \brief Image of the entries beyond the end of a truncated file.
+    static constexpr std::uint8_t ZERO_IMAGE[IMAGE_BYTES] = {};
+
+    /**
+     * \brief Map a Mnist file.
+     * \param fp    The file path.
+     * \param error The error message if the file could not be opened.
+     * \return std::unique_ptr<MappedFile> The mapped file.
+     */
+    static std::unique_ptr<MappedFile> _map(
+        const fs::path& fp, const std::string& error)
+    {
+        try
+        {
+            return std::make_unique<MappedFile>(fp);
+        }
+        catch (const std::runtime_error&)
+        {
+            throw std::runtime_error(error);
+        }
+    }
+
     /**
-     * \brief Check if the Mnist file stream is malformed in relation to the
-     * number to compare.
-     * \param data The data stream from which obtain the value to compare.
-     * \param num_to_check The value to compare.
+     * \brief Check if the Mnist file is malformed in relation to the
+     * header size and the magic number.
+     * \param file The mapped Mnist file.
+     * \param header_size The size of the header of the file.
+     * \param num_to_check The magic number to compare.
      * \return bool True if the Mnist file is malformed otherwise false.
      */
-    static bool _is_malformed(
-        std::ifstream& data, std::uint32_t num_to_check)
+    static bool _is_malformed(const MappedFile& file, std::size_t header_size,
+                              std::uint32_t num_to_check)
+    {
+        return file.size() < header_size
+            || read_uint32_endian_order(file.data()) != num_to_check;
+    }
+
+    /**
+     * \brief Convert an entry, the image followed by the label.
+     * \tparam T The arithmetic type of the entry.
+     * \param i   The index of the entry.
+     * \param dst The buffer of feature_size() elements.
+     */
+    template<typename T>
+    void _entry(SizeType i, T* dst) const
     {
-        auto magic = read_uint32_endian_order(data);
-        return magic != num_to_check;
+        _bytes_to(image_data(i), dst, IMAGE_BYTES);
+        dst[IMAGE_BYTES] = static_cast<T>(label_data(i));
     }
 
-    std::ifstream _image_ifs; ///< \brief Images input stream.
-    std::ifstream _label_ifs; ///< \brief Labels input stream.
+    std::unique_ptr<MappedFile> _images; ///< \brief Mapped images file.
+    std::unique_ptr<MappedFile> _labels; ///< \brief Mapped labels file.
 
     std::uint32_t _size; ///< \brief Number of elements in the MNIST dataset.
 };
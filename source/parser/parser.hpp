@@ -31,9 +31,21 @@
 
 #include "type_checker.hpp"
 #include "type.hpp"
+#include "betterthreads/task_manager.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
 #include <set>
 #include <map>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 
 namespace EdgeLearning {
@@ -75,7 +87,12 @@ public:
      */
     enum class LabelEncoding {
         ONE_HOT_ENCODING, ///< \brief One hot vector encoding for each label.
-        DEFAULT_ENCODING  ///< \brief No manipulation performed.
+        DEFAULT_ENCODING, ///< \brief No manipulation performed.
+        /**
+         * \brief Each label is replaced by its index in the one hot vector,
+         * the target of a class index CategoricalCrossEntropyLossLayer.
+         */
+        CLASS_INDEX_ENCODING
     };
 
     /**
@@ -88,6 +105,8 @@ public:
      */
     DatasetParser()
         : Parser()
+        , _one_hot_maps{}
+        , _one_hot_cached{false}
     { }
 
     virtual ~DatasetParser() = default;
@@ -100,6 +119,25 @@ public:
      */
     virtual std::vector<NumType> entry(SizeType i) = 0;
 
+    /**
+     * \brief Retrieve all the entries of the dataset in a row-major vector.
+     * All features with labels included.
+     * \return std::vector<NumType> The entries_amount() * feature_size()
+     * features of the dataset.
+     */
+    virtual std::vector<NumType> entries()
+    {
+        std::vector<NumType> ret(entries_amount() * feature_size());
+        for (SizeType i = 0; i < entries_amount(); ++i)
+        {
+            auto row = entry(i);
+            std::copy(row.begin(), row.end(),
+                      ret.begin() + static_cast<std::ptrdiff_t>(
+                          i * feature_size()));
+        }
+        return ret;
+    }
+
     /**
      * \brief Get the number of entries contained in the dataset.
      * \return SizeType The amount of entries of the dataset.
@@ -120,20 +158,32 @@ public:
 
     /**
      * \brief Get the unique set of values of an input feature index of the
-     * dataset.
+     * dataset. The values of the label features come from the one hot maps
+     * cached by the first label encoding request, the values of the other
+     * features are collected reading one entry at a time.
      * \param idx SizeType The feature index.
      * \return std::set<NumType> The unique set of feature values.
      */
     std::set<NumType> unique(SizeType idx)
     {
-        std::vector<NumType> ret;
-
-        for (SizeType i = 0; i < entries_amount(); ++i)
+        auto label_indexes = labels_idx();
+        auto label_it = label_indexes.find(idx);
+        if (label_it != label_indexes.end())
         {
-            ret.push_back(entry(i)[idx]);
+            const auto& one_hot_label_map = _one_hot_maps_cached()[
+                static_cast<SizeType>(
+                    std::distance(label_indexes.begin(), label_it))];
+            std::set<NumType> ret;
+            for (const auto& [value, one_hot_idx]: one_hot_label_map)
+            {
+                (void) one_hot_idx;
+                ret.insert(ret.end(), value);
+            }
+            return ret;
         }
 
-        return {ret.begin(), ret.end()};
+        if (idx >= feature_size()) return {};
+        return std::move(_unique_values({idx}).front());
     }
 
     /**
@@ -145,6 +195,14 @@ public:
      */
     OneHotLabelMap unique_map(SizeType idx)
     {
+        auto label_indexes = labels_idx();
+        auto label_it = label_indexes.find(idx);
+        if (label_it != label_indexes.end())
+        {
+            return _one_hot_maps_cached()[static_cast<SizeType>(
+                std::distance(label_indexes.begin(), label_it))];
+        }
+
         auto unique_set = unique(idx);
         OneHotLabelMap value_to_index;
 
@@ -170,13 +228,13 @@ public:
             case LabelEncoding::ONE_HOT_ENCODING:
             {
                 SizeType entry_size = feature_size() - labels_idx().size();
-                for (const auto& label_idx: labels_idx())
+                for (const auto& one_hot_label_map: _one_hot_maps_cached())
                 {
-                    auto one_hot_label_map = unique(label_idx);
                     entry_size += one_hot_label_map.size();
                 }
                 return entry_size;
             }
+            case LabelEncoding::CLASS_INDEX_ENCODING:
             case LabelEncoding::DEFAULT_ENCODING:
             default:
             {
@@ -185,6 +243,16 @@ public:
         }
     }
 
+    /**
+     * \brief Drop the one hot maps cached by the label encoding requests,
+     * e.g. to release the memory of a parsed dataset.
+     */
+    void clear_encoding_cache()
+    {
+        _one_hot_maps = {};
+        _one_hot_cached = false;
+    }
+
     /**
      * \brief Calculate the resulting set of indexes from the encoding chosen.
      * \param label_encoding LabelEncoding The encoding of the label features.
@@ -206,6 +274,7 @@ public:
                 }
                 return encoding_label_indexes;
             }
+            case LabelEncoding::CLASS_INDEX_ENCODING:
             case LabelEncoding::DEFAULT_ENCODING:
             default:
             {
@@ -227,79 +296,268 @@ public:
             case LabelEncoding::ONE_HOT_ENCODING:
             {
                 auto label_indexes = labels_idx();
-                std::vector<OneHotLabelMap> one_hot_label_maps;
-                SizeType entry_size = feature_size() - label_indexes.size();
-                for (const auto& label_idx: label_indexes)
-                {
-                    auto one_hot_label_map = unique_map(
-                        label_idx);
-                    one_hot_label_maps.push_back(one_hot_label_map);
-                    entry_size += one_hot_label_map.size();
-                }
+                auto data = entries();
+                (void) _one_hot_maps_cached(data.data());
+                auto entry_size = encoding_feature_size(label_encoding);
 
                 std::vector<NumType> ret(entry_size * entries_amount());
                 std::vector<SizeType> label_indexes_vec(
                     label_indexes.begin(), label_indexes.end());
-                for (SizeType row_idx = 0; row_idx < entries_amount();
-                     ++row_idx)
-                {
-                    auto row = entry(row_idx);
-
-                    // Copy the input.
-                    for (SizeType col_idx = 0; col_idx < feature_size();
-                         ++col_idx)
+                _parallel_chunks(entries_amount(), PARALLEL_CHUNK_ROWS, 0,
+                                 [&](SizeType from, SizeType to) {
+                    for (SizeType row_idx = from; row_idx < to; ++row_idx)
                     {
-                        if (label_indexes.find(
-                            col_idx) == label_indexes.end())
-                        {
-                            ret[row_idx * entry_size + col_idx] = row[col_idx];
-                        }
+                        _encode_one_hot(
+                            data.data() + row_idx * feature_size(),
+                            ret.data() + row_idx * entry_size,
+                            label_indexes, label_indexes_vec);
                     }
+                });
+                return ret;
+            }
+            case LabelEncoding::CLASS_INDEX_ENCODING:
+            {
+                auto label_indexes = labels_idx();
+                std::vector<SizeType> label_indexes_vec(
+                    label_indexes.begin(), label_indexes.end());
+                auto data = entries();
+                const auto& one_hot_label_maps =
+                    _one_hot_maps_cached(data.data());
 
-                    // Copy the one hot vector for each label.
-                    SizeType col_offset = feature_size() - label_indexes.size();
-                    for (SizeType i = 0; i < label_indexes_vec.size(); ++i)
+                _parallel_chunks(entries_amount(), PARALLEL_CHUNK_ROWS, 0,
+                                 [&](SizeType from, SizeType to) {
+                    for (SizeType row_idx = from; row_idx < to; ++row_idx)
                     {
-                        const OneHotLabelMap& one_hot_label_map =
-                            one_hot_label_maps[i];
-                        auto label_value = row[label_indexes_vec[i]];
-
-                        // Init the one hot label vector.
-                        auto one_hot_size = one_hot_label_map.size();
-                        auto one_hot_idx = one_hot_label_map.at(
-                            label_value);
-                        for(SizeType col_idx = 0; col_idx < one_hot_size;
-                            ++col_idx)
+                        auto* row = data.data() + row_idx * feature_size();
+                        for (SizeType i = 0; i < label_indexes_vec.size(); ++i)
                         {
-                            ret[row_idx * entry_size + col_offset + col_idx] =
-                                col_idx == one_hot_idx ?
-                                NumType(1) : NumType(0);
+                            auto& label_value = row[label_indexes_vec[i]];
+                            label_value = static_cast<NumType>(
+                                one_hot_label_maps[i].at(label_value));
                         }
-
-                        col_offset += one_hot_size;
                     }
-                }
-                return ret;
+                });
+                return data;
             }
             case LabelEncoding::DEFAULT_ENCODING:
             default:
             {
-                std::vector<NumType> ret(feature_size() * entries_amount());
-                for (SizeType row_idx = 0; row_idx < entries_amount();
-                     ++row_idx)
+                return entries();
+            }
+        }
+    }
+
+protected:
+    /// \brief Minimum amount of rows of a parallel chunk of the encoding.
+    static constexpr SizeType PARALLEL_CHUNK_ROWS = 1024;
+
+    /**
+     * \brief Split the range [0, size) in contiguous chunks processed in
+     * parallel by the task manager. The calling thread processes the last
+     * chunk.
+     * \param size      SizeType The size of the range.
+     * \param min_chunk SizeType The minimum size of a chunk.
+     * \param workers   SizeType The maximum amount of chunks, 0 to use the
+     * task manager concurrency.
+     * \param fn        The function applied to each chunk [from, to).
+     */
+    static void _parallel_chunks(
+        SizeType size, SizeType min_chunk, SizeType workers,
+        const std::function<void(SizeType, SizeType)>& fn)
+    {
+        auto& tm = BetterThreads::TaskManager::instance();
+        if (workers == 0) workers = tm.concurrency();
+        workers = std::max<SizeType>(1, std::min(
+            workers, size / std::max<SizeType>(1, min_chunk)));
+
+        std::vector<BetterThreads::Future<void>> futures;
+        const SizeType chunk = size / workers;
+        for (SizeType w = 0; w + 1 < workers; ++w)
+        {
+            futures.push_back(tm.enqueue(fn, w * chunk, (w + 1) * chunk));
+        }
+        fn((workers - 1) * chunk, size);
+        for (auto& f: futures) f.get();
+    }
+
+    /**
+     * \brief Convert bytes to numbers, 16 bytes per step with SSE2.
+     * \tparam T The arithmetic type of the numbers.
+     * \param src const std::uint8_t* The bytes.
+     * \param dst T* The numbers.
+     * \param n   SizeType The amount of bytes.
+     */
+    template<typename T>
+    static void _bytes_to(const std::uint8_t* src, T* dst, SizeType n)
+    {
+        static_assert(std::is_arithmetic_v<T>, "T has to be arithmetic");
+        SizeType i = 0;
+#if defined(__SSE2__)
+        if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const SizeType blocks_end = n - n % 16;
+            for (; i < blocks_end; i += 16)
+            {
+                auto b = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(src + i));
+                auto lo = _mm_unpacklo_epi8(b, zero);
+                auto hi = _mm_unpackhi_epi8(b, zero);
+                const __m128i w[4] = {
+                    _mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                    _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+                for (SizeType k = 0; k < 4; ++k)
                 {
-                    auto row = entry(row_idx);
-                    for (SizeType col_idx = 0; col_idx < feature_size();
-                         ++col_idx)
+                    if constexpr (std::is_same_v<T, float>)
                     {
-                        ret[row_idx * feature_size() + col_idx] = row[col_idx];
+                        _mm_storeu_ps(dst + i + 4 * k, _mm_cvtepi32_ps(w[k]));
+                    }
+                    else
+                    {
+                        _mm_storeu_pd(dst + i + 4 * k, _mm_cvtepi32_pd(w[k]));
+                        _mm_storeu_pd(dst + i + 4 * k + 2, _mm_cvtepi32_pd(
+                            _mm_srli_si128(w[k], 8)));
                     }
                 }
-                return ret;
             }
         }
+#endif
+        // The tail runs on its own counter, bounded by n - i.
+        const SizeType tail = n - i;
+        src += i;
+        dst += i;
+        for (SizeType k = 0; k < tail; ++k)
+        {
+            dst[k] = static_cast<T>(src[k]);
+        }
+    }
+
+private:
+    /**
+     * \brief Encode an entry with the cached one hot maps.
+     * \param row               const NumType* The entry to encode.
+     * \param dst               NumType* The encoded entry.
+     * \param label_indexes     const std::set<SizeType>& The label indexes.
+     * \param label_indexes_vec const std::vector<SizeType>& The label
+     * indexes in order.
+     */
+    void _encode_one_hot(const NumType* row, NumType* dst,
+                         const std::set<SizeType>& label_indexes,
+                         const std::vector<SizeType>& label_indexes_vec) const
+    {
+        // Copy the input.
+        for (SizeType col_idx = 0; col_idx < feature_size(); ++col_idx)
+        {
+            if (label_indexes.find(col_idx) == label_indexes.end())
+            {
+                dst[col_idx] = row[col_idx];
+            }
+        }
+
+        // Copy the one hot vector for each label.
+        SizeType col_offset = feature_size() - label_indexes.size();
+        for (SizeType i = 0; i < label_indexes_vec.size(); ++i)
+        {
+            const OneHotLabelMap& one_hot_label_map = _one_hot_maps[i];
+            auto label_value = row[label_indexes_vec[i]];
+
+            // Init the one hot label vector.
+            auto one_hot_size = one_hot_label_map.size();
+            auto one_hot_idx = one_hot_label_map.at(label_value);
+            for (SizeType col_idx = 0; col_idx < one_hot_size; ++col_idx)
+            {
+                dst[col_offset + col_idx] =
+                    col_idx == one_hot_idx ? NumType(1) : NumType(0);
+            }
+
+            col_offset += one_hot_size;
+        }
+    }
+
+    /**
+     * \brief Collect the unique values of some features of the dataset.
+     * \param cols const std::vector<SizeType>& The feature indexes.
+     * \param data const NumType* The entries already read, processed in
+     * parallel chunks of rows, or nullptr to read one entry at a time
+     * without a copy of the dataset.
+     * \return std::vector<std::set<NumType>> The values of each feature.
+     */
+    std::vector<std::set<NumType>> _unique_values(
+        const std::vector<SizeType>& cols, const NumType* data = nullptr)
+    {
+        std::vector<std::set<NumType>> values(cols.size());
+        if (!data)
+        {
+            for (SizeType row_idx = 0; row_idx < entries_amount(); ++row_idx)
+            {
+                auto row = entry(row_idx);
+                for (SizeType i = 0; i < cols.size(); ++i)
+                {
+                    values[i].insert(row[cols[i]]);
+                }
+            }
+            return values;
+        }
+
+        const auto entry_size = feature_size();
+        std::mutex values_mutex;
+        _parallel_chunks(entries_amount(), PARALLEL_CHUNK_ROWS, 0,
+                         [&](SizeType from, SizeType to) {
+            std::vector<std::set<NumType>> chunk_values(cols.size());
+            for (SizeType row_idx = from; row_idx < to; ++row_idx)
+            {
+                const auto* row = data + row_idx * entry_size;
+                for (SizeType i = 0; i < cols.size(); ++i)
+                {
+                    chunk_values[i].insert(row[cols[i]]);
+                }
+            }
+            std::lock_guard<std::mutex> lock(values_mutex);
+            for (SizeType i = 0; i < chunk_values.size(); ++i)
+            {
+                values[i].merge(chunk_values[i]);
+            }
+        });
+        return values;
+    }
+
+    /**
+     * \brief Get the one hot maps of the label features, ordered as
+     * labels_idx(). The maps are cached for the next requests, since the
+     * parsed dataset does not change. The first call collects the label
+     * values from the entries read by the caller, or reads one entry at a
+     * time if there are none, so no copy of the dataset is kept.
+     * \param data const NumType* The entries already read, or nullptr.
+     * \return const std::vector<OneHotLabelMap>& The cached one hot maps.
+     */
+    const std::vector<OneHotLabelMap>& _one_hot_maps_cached(
+        const NumType* data = nullptr)
+    {
+        if (_one_hot_cached) return _one_hot_maps;
+
+        auto label_indexes = labels_idx();
+        auto label_values = _unique_values(
+            std::vector<SizeType>(label_indexes.begin(), label_indexes.end()),
+            data);
+
+        _one_hot_maps.clear();
+        for (const auto& values: label_values)
+        {
+            OneHotLabelMap value_to_index;
+            SizeType i = 0;
+            for (const auto& v: values)
+            {
+                value_to_index.emplace_hint(value_to_index.end(), v, i++);
+            }
+            _one_hot_maps.push_back(std::move(value_to_index));
+        }
+        _one_hot_cached = true;
+        return _one_hot_maps;
     }
 
+    /// \brief One hot maps of the label features, ordered as labels_idx().
+    std::vector<OneHotLabelMap> _one_hot_maps;
+    bool _one_hot_cached; ///< True if the one hot maps are cached.
 
 };
 
@@ -30,32 +30,12 @@
 #define EDGE_LEARNING_PARSER_TYPE_CHECKER_HPP
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
-#include <regex>
 
 namespace EdgeLearning {
 
-/**
- * \brief Regex to detect float values in string.
- */
-const std::regex _float_regex   { "^[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?$" };
-
-/**
- * \brief Regex to detect int values in string.
- */
-const std::regex _integer_regex { "^[-+]?(0|[1-9][0-9]*)$" };
-
-/**
- * \brief Regex to detect bool values in string.
- */
-const std::regex _boolean_regex { "^(true|false)$" };
-
-/**
- * \brief Regex to detect strings
- */
-const std::regex _string_regex  { "^\".*\"$" };
-
 /**
  * \brief Convert a string in the templated type T and put the result in the
  * reference.
@@ -262,37 +242,93 @@ public:
     }
     
     /**
-     * \brief Parse the type of the given string field.
+     * \brief Parse the type of the given string field in a single pass.
+     * Quoted fields are strings, "true" and "false" are booleans, 
+     * [-+]?(0|[1-9][0-9]*) are integers and 
+     * [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)? are floats. Everything else is
+     * a string.
      * \param field The string to parse.
      * \return TypeChecker::Type The type of the converted string.
      */
-    static TypeChecker::Type parse(const std::string &field)
+    static TypeChecker::Type parse(std::string_view field)
     {
-        if (field.empty())
+        const auto size = field.size();
+        if (size == 0)
         {
             return TypeChecker::Type::NONE;
         }
-
-        if (std::regex_match(field, _string_regex))
+        if (size >= 2 && field.front() == '"' && field.back() == '"')
         {
             return TypeChecker::Type::STRING;
         }
-        else if (std::regex_match(field, _boolean_regex))
+        if (field == "true" || field == "false")
         {
             return TypeChecker::Type::BOOL;
         }
-        else if (std::regex_match(field, _integer_regex))
+
+        std::size_t i = 0;
+        if (field[i] == '-' || field[i] == '+') ++i;
+        const auto int_begin = i;
+        while (i < size && _is_digit(field[i])) ++i;
+        const auto int_digits = i - int_begin;
+        if (i == size)
         {
-            return TypeChecker::Type::INT;
+            if (int_digits == 0) return TypeChecker::Type::STRING;
+            // Leading zeros are allowed only in floats.
+            return int_digits == 1 || field[int_begin] != '0'
+                ? TypeChecker::Type::INT : TypeChecker::Type::FLOAT;
         }
-        else if (std::regex_match(field, _float_regex))
+
+        if (field[i] == '.')
         {
-            return TypeChecker::Type::FLOAT;
+            const auto frac_begin = ++i;
+            while (i < size && _is_digit(field[i])) ++i;
+            if (i == frac_begin) return TypeChecker::Type::STRING;
         }
-        else 
+        else if (int_digits == 0)
         {
             return TypeChecker::Type::STRING;
         }
+
+        if (i < size && (field[i] == 'e' || field[i] == 'E'))
+        {
+            ++i;
+            if (i < size && (field[i] == '-' || field[i] == '+')) ++i;
+            const auto exp_begin = i;
+            while (i < size && _is_digit(field[i])) ++i;
+            if (i == exp_begin) return TypeChecker::Type::STRING;
+        }
+
+        return i == size ? TypeChecker::Type::FLOAT : TypeChecker::Type::STRING;
+    }
+
+    /**
+     * \brief The type able to represent the values of two types, used to 
+     * infer the type of a column from the types of its fields.
+     * Missing fields (NONE) and AUTO do not change the type, integers and 
+     * floats are floats, any other mix is a string.
+     * \param lhs The first type.
+     * \param rhs The second type.
+     * \return TypeChecker::Type The merged type.
+     */
+    static TypeChecker::Type merge(TypeChecker::Type lhs, TypeChecker::Type rhs)
+    {
+        if (lhs == rhs) return lhs;
+        if (lhs == TypeChecker::Type::NONE || lhs == TypeChecker::Type::AUTO)
+        {
+            return rhs;
+        }
+        if (rhs == TypeChecker::Type::NONE || rhs == TypeChecker::Type::AUTO)
+        {
+            return lhs;
+        }
+        if ((lhs == TypeChecker::Type::INT || lhs == TypeChecker::Type::FLOAT)
+            && (rhs == TypeChecker::Type::INT 
+                || rhs == TypeChecker::Type::FLOAT))
+        {
+            return TypeChecker::Type::FLOAT;
+        }
+        return TypeChecker::Type::STRING;
     }
 
     /**
@@ -311,6 +347,9 @@ public:
         }
         return ret;
     }
+
+private:
+    static bool _is_digit(char c) { return c >= '0' && c <= '9'; }
 };
 
 /**
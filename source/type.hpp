@@ -29,9 +29,12 @@
 #ifndef EDGE_LEARNING_DNN_TYPE_HPP
 #define EDGE_LEARNING_DNN_TYPE_HPP
 
+#include <algorithm>
 #include <random>
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 
@@ -39,6 +42,13 @@ namespace EdgeLearning {
 
 using NumType = double;
 
+/**
+ * \brief Name of NumType as a C++ type, e.g. for generated source code.
+ */
+inline constexpr const char* NUM_TYPE_NAME =
+    std::is_same_v<NumType, float> ? "float"
+    : std::is_same_v<NumType, double> ? "double" : "long double";
+
 /**
  * Random number engine: 64-bit Mersenne Twister by Matsumoto and
  * Nishimura, 1998.
@@ -55,6 +65,8 @@ using Params = std::vector<NumType>;
 
 /**
  * \brief Learning parameters of a layer that can be shared.
+ * The values are owned by a vector or, after view(), they are read from an
+ * external buffer (e.g. a memory mapped model file) kept alive by an owner.
  */
 class SharedParams {
 public:
@@ -63,38 +75,95 @@ public:
         using pointer   = NumType*;
         using reference = NumType&;
 
-        Iterator(Params::iterator ptr) : _iter(ptr) {}
+        Iterator(pointer ptr) : _ptr(ptr) {}
 
-        reference operator*() const { return _iter.operator*(); }
-        pointer operator->() { return _iter.operator->(); }
-        Iterator& operator++() { _iter++; return *this; }
+        reference operator*() const { return *_ptr; }
+        pointer operator->() { return _ptr; }
+        Iterator& operator++() { _ptr++; return *this; }
         Iterator operator++(int)
         { Iterator tmp = *this; ++(*this); return tmp; }
         friend bool operator== (const Iterator& a, const Iterator& b)
-        { return a._iter == b._iter; };
+        { return a._ptr == b._ptr; };
         friend bool operator!= (const Iterator& a, const Iterator& b)
-        { return a._iter != b._iter; };
+        { return a._ptr != b._ptr; };
 
     private:
-        Params::iterator _iter;
+        pointer _ptr;
     };
 
     SharedParams()
-        : _p(std::make_shared<Params>())
+        : _p(std::make_shared<Storage>())
     { }
 
-    void resize(std::size_t length) const { (*_p).resize(length); }
-    NumType& operator[](std::size_t i) const { return (*_p)[i]; }
+    /**
+     * \brief Resize the values. A view of a different size is replaced by
+     * an owned copy of its values.
+     * \param length std::size_t The amount of values.
+     */
+    void resize(std::size_t length) const
+    {
+        if (_p->view)
+        {
+            if (length == _p->view_size) return;
+            _p->values.assign(_p->view,
+                              _p->view + std::min(length, _p->view_size));
+            _p->view = nullptr;
+            _p->view_size = 0;
+            _p->owner.reset();
+        }
+        _p->values.resize(length);
+    }
+
+    /**
+     * \brief Read and write the values straight from an external buffer.
+     * The view is shared by all the copies of the parameters.
+     * \param data  NumType* The first value.
+     * \param size  std::size_t The amount of values.
+     * \param owner std::shared_ptr<const void> Object keeping the buffer
+     * alive as long as the view.
+     */
+    void view(NumType* data, std::size_t size,
+              std::shared_ptr<const void> owner) const
+    {
+        Params().swap(_p->values);
+        _p->view = data;
+        _p->view_size = size;
+        _p->owner = std::move(owner);
+    }
+
+    /**
+     * \brief Check if the values are a view of an external buffer.
+     * \return bool True after view() and until a resize.
+     */
+    [[nodiscard]] bool is_view() const { return _p->view != nullptr; }
+
+    NumType& operator[](std::size_t i) const { return _data()[i]; }
     [[nodiscard]] const NumType& at(std::size_t i) const
-    { return (*_p).at(i); }
-    NumType* data() { return (*_p).data(); }
-    std::size_t size() { return (*_p).size(); }
+    {
+        if (i >= _size()) throw std::out_of_range("SharedParams index");
+        return _data()[i];
+    }
+    NumType* data() const { return _data(); }
+    std::size_t size() const { return _size(); }
 
-    Iterator begin() { return Iterator((*_p).begin()); }
-    Iterator end()   { return Iterator((*_p).end());   }
+    Iterator begin() { return Iterator(_data()); }
+    Iterator end()   { return Iterator(_data() + _size()); }
 
 private:
-    std::shared_ptr<Params> _p;
+    struct Storage
+    {
+        Params values;
+        NumType* view = nullptr;
+        std::size_t view_size = 0;
+        std::shared_ptr<const void> owner;
+    };
+
+    [[nodiscard]] NumType* _data() const
+    { return _p->view ? _p->view : _p->values.data(); }
+    [[nodiscard]] std::size_t _size() const
+    { return _p->view ? _p->view_size : _p->values.size(); }
+
+    std::shared_ptr<Storage> _p;
 };
 
 } // namespace EdgeLearning
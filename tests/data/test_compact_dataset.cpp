@@ -0,0 +1,246 @@
+/***************************************************************************
+ *            data/test_compact_dataset.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "data/compact_dataset.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class RowsParser : public DatasetParser
+{
+public:
+    RowsParser(std::vector<NumType> data, SizeType feature_size,
+               std::set<SizeType> labels_idx)
+        : _data(std::move(data))
+        , _feature_size(feature_size)
+        , _labels_idx(std::move(labels_idx))
+    { }
+
+    std::vector<NumType> entry(SizeType i) override {
+        auto first = _data.begin()
+            + static_cast<std::ptrdiff_t>(i * _feature_size);
+        return {first, first + static_cast<std::ptrdiff_t>(_feature_size)};
+    }
+
+    SizeType entries_amount() const override {
+        return _data.size() / _feature_size;
+    }
+
+    SizeType feature_size() const override { return _feature_size; }
+
+    std::set<SizeType> labels_idx() const override { return _labels_idx; }
+
+private:
+    std::vector<NumType> _data;
+    SizeType _feature_size;
+    std::set<SizeType> _labels_idx;
+};
+
+class TestCompactDataset {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_compact_dataset());
+        EDGE_LEARNING_TEST_CALL(test_batch());
+        EDGE_LEARNING_TEST_CALL(test_normalization());
+        EDGE_LEARNING_TEST_CALL(test_shuffle());
+        EDGE_LEARNING_TEST_CALL(test_parse());
+    }
+
+private:
+    std::vector<std::uint8_t> _v{
+        10, 20, 255, 0,
+        30, 20,   0, 1,
+        50, 20, 128, 2,
+        70, 20,  64, 1,
+        90,  /* Incomplete entry dropped. */
+    };
+
+    void test_compact_dataset() {
+        EDGE_LEARNING_TEST_TRY((CompactDataset<std::uint8_t>()));
+        auto empty = CompactDataset<std::uint8_t>();
+        EDGE_LEARNING_TEST_ASSERT(empty.empty());
+        EDGE_LEARNING_TEST_EQUAL(empty.size(), 0);
+
+        auto ds = CompactDataset<std::uint8_t>(_v, 4, 1, {3, 7});
+        EDGE_LEARNING_TEST_EQUAL(ds.feature_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds.sequence_size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(ds.size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds.data().size(), 16);
+        EDGE_LEARNING_TEST_EQUAL(ds.label_idx().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(ds.label_idx()[0], 3);
+        EDGE_LEARNING_TEST_EQUAL(ds.input_idx().size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(ds.entry(0).size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds.entry(0)[2], 255.0);
+        EDGE_LEARNING_TEST_EQUAL(ds.entry(4).size(), 0);
+        EDGE_LEARNING_TEST_ASSERT(
+            ds.input(1) == std::vector<NumType>({30, 20, 0}));
+        EDGE_LEARNING_TEST_ASSERT(ds.label(3) == std::vector<NumType>({1}));
+
+        EDGE_LEARNING_TEST_TRY(ds.affine(2, 0.5, -1.0));
+        EDGE_LEARNING_TEST_EQUAL(ds.entry(0)[2], 0.5 * 255.0 - 1.0);
+        EDGE_LEARNING_TEST_EQUAL(ds.data()[2], 255);
+        EDGE_LEARNING_TEST_THROWS(ds.affine(4, 1.0, 0.0), std::runtime_error);
+    }
+
+    void test_batch() {
+        auto ds = CompactDataset<std::uint8_t, float>(_v, 4, 1, {3});
+        ds.affine(0, 2.0f, 1.0f);
+
+        Dataset<float> batch;
+        EDGE_LEARNING_TEST_TRY(batch = ds.batch(1, 3));
+        EDGE_LEARNING_TEST_EQUAL(batch.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(batch.feature_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(batch.label_idx().size(), 1);
+        EDGE_LEARNING_TEST_ASSERT(batch.entry(0) == ds.entry(1));
+        EDGE_LEARNING_TEST_ASSERT(batch.entry(1) == ds.entry(2));
+        EDGE_LEARNING_TEST_EQUAL(batch.entry(0)[0], 61.0f);
+        EDGE_LEARNING_TEST_EQUAL(ds.batch(2, 100).size(), 2);
+        EDGE_LEARNING_TEST_THROWS(ds.batch(3, 1), std::runtime_error);
+
+        auto gathered = ds.gather({3, 0});
+        EDGE_LEARNING_TEST_EQUAL(gathered.size(), 2);
+        EDGE_LEARNING_TEST_ASSERT(gathered.entry(0) == ds.entry(3));
+        EDGE_LEARNING_TEST_ASSERT(gathered.entry(1) == ds.entry(0));
+        EDGE_LEARNING_TEST_THROWS(ds.gather({4}), std::runtime_error);
+
+        auto full = ds.to_dataset();
+        EDGE_LEARNING_TEST_EQUAL(full.size(), ds.size());
+        for (SizeType i = 0; i < ds.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_ASSERT(full.entry(i) == ds.entry(i));
+        }
+
+        auto sub = ds.subdata(1, 3);
+        EDGE_LEARNING_TEST_EQUAL(sub.size(), 2);
+        EDGE_LEARNING_TEST_ASSERT(sub.scale() == ds.scale());
+        EDGE_LEARNING_TEST_ASSERT(sub.offset() == ds.offset());
+        EDGE_LEARNING_TEST_ASSERT(sub.entry(0) == ds.entry(1));
+        EDGE_LEARNING_TEST_THROWS(ds.subdata(3, 1), std::runtime_error);
+    }
+
+    void test_normalization() {
+        std::vector<NumType> v_num(_v.begin(), _v.end());
+        auto ds = CompactDataset<std::uint8_t>(_v, 4, 1, {3});
+        auto ds_num = Dataset<NumType>(v_num, 4, 1, {3});
+
+        EDGE_LEARNING_TEST_THROWS(ds.min_max_normalization(1.0, 1.0),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_TRY(ds.min_max_normalization(0.0, 255.0, {0, 2}));
+        ds_num.min_max_normalization(0.0, 255.0, {0, 2});
+        auto stored = std::vector<std::uint8_t>(_v.begin(), _v.begin() + 16);
+        EDGE_LEARNING_TEST_ASSERT(ds.data() == stored);
+        for (SizeType i = 0; i < ds.size(); ++i)
+        {
+            for (SizeType j = 0; j < ds.feature_size(); ++j)
+            {
+                EDGE_LEARNING_TEST_WITHIN(ds.entry(i)[j], ds_num.entry(i)[j],
+                                          1e-12);
+            }
+        }
+
+        // The constant feature 1 is not changed.
+        EDGE_LEARNING_TEST_TRY(ds.min_max_normalization());
+        EDGE_LEARNING_TEST_ASSERT(ds.data() == stored);
+        std::vector<NumType> truth_min{0, 20, 0, 0};
+        std::vector<NumType> truth_max{1, 20, 1, 1};
+        for (SizeType j = 0; j < ds.feature_size(); ++j)
+        {
+            NumType min = ds.entry(0)[j];
+            NumType max = ds.entry(0)[j];
+            for (SizeType i = 1; i < ds.size(); ++i)
+            {
+                min = std::min(min, ds.entry(i)[j]);
+                max = std::max(max, ds.entry(i)[j]);
+            }
+            EDGE_LEARNING_TEST_WITHIN(min, truth_min[j], 1e-12);
+            EDGE_LEARNING_TEST_WITHIN(max, truth_max[j], 1e-12);
+        }
+        EDGE_LEARNING_TEST_WITHIN(ds.entry(1)[0], 1.0 / 3.0, 1e-12);
+    }
+
+    void test_shuffle() {
+        auto ds = CompactDataset<std::uint8_t>(_v, 4, 1, {3});
+        auto ds_copy = ds;
+        EDGE_LEARNING_TEST_TRY(ds.shuffle(RneType(42)));
+        EDGE_LEARNING_TEST_EQUAL(ds.size(), ds_copy.size());
+        for (SizeType i = 0; i < ds.size(); ++i)
+        {
+            bool exist_entry = false;
+            for (SizeType j = 0; j < ds_copy.size(); ++j)
+            {
+                exist_entry |= ds.entry(i) == ds_copy.entry(j);
+            }
+            EDGE_LEARNING_TEST_ASSERT(exist_entry);
+        }
+    }
+
+    void test_parse() {
+        RowsParser rows({10, 200, 2, 30, 40, 1}, 3, {2});
+        auto ds = CompactDataset<std::uint8_t>::parse(rows);
+        EDGE_LEARNING_TEST_EQUAL(ds.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(ds.feature_size(), 3);
+        EDGE_LEARNING_TEST_ASSERT(ds.data() == std::vector<std::uint8_t>(
+            {10, 200, 2, 30, 40, 1}));
+        EDGE_LEARNING_TEST_ASSERT(ds.label(1) == std::vector<NumType>({1}));
+
+        auto one_hot = CompactDataset<std::uint8_t>::parse(
+            rows, DatasetParser::LabelEncoding::ONE_HOT_ENCODING);
+        EDGE_LEARNING_TEST_EQUAL(one_hot.feature_size(), 4);
+        EDGE_LEARNING_TEST_ASSERT(one_hot.label(0)
+                                  == std::vector<NumType>({0, 1}));
+
+        // The values out of the storage type range are not wrapped.
+        EDGE_LEARNING_TEST_THROWS(
+            (void) CompactDataset<std::int8_t>::parse(rows),
+            std::runtime_error);
+        RowsParser negative({-1, 0, 1}, 3, {2});
+        EDGE_LEARNING_TEST_THROWS(
+            (void) CompactDataset<std::uint8_t>::parse(negative),
+            std::runtime_error);
+        auto as_float = CompactDataset<float>::parse(negative);
+        EDGE_LEARNING_TEST_EQUAL(as_float.entry(0)[0], -1.0);
+
+        // The Mnist bytes fill the storage directly.
+        const auto mnist_root = std::filesystem::path(__FILE__).parent_path()
+            / ".." / "parser" / "resource" / "mnist";
+        Mnist mnist(mnist_root / "first10-train-images-idx3-ubyte",
+                    mnist_root / "first10-train-labels-idx1-ubyte");
+        auto images = CompactDataset<std::uint8_t>::parse(mnist);
+        EDGE_LEARNING_TEST_EQUAL(images.size(), mnist.entries_amount());
+        EDGE_LEARNING_TEST_EQUAL(images.feature_size(), mnist.feature_size());
+        EDGE_LEARNING_TEST_ASSERT(images.entry(3) == mnist.entry(3));
+    }
+};
+
+int main() {
+    TestCompactDataset().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
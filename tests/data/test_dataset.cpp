@@ -85,6 +85,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_dataset_labels());
         EDGE_LEARNING_TEST_CALL(test_dataset_trainset());
         EDGE_LEARNING_TEST_CALL(test_dataset_parse());
+        EDGE_LEARNING_TEST_CALL(test_dataset_class_index());
         EDGE_LEARNING_TEST_CALL(test_dataset_shuffle());
         EDGE_LEARNING_TEST_CALL(test_dataset_normalization());
         EDGE_LEARNING_TEST_CALL(test_dataset_concatenate());
@@ -943,6 +944,52 @@ private:
         }
     }
 
+    void test_dataset_class_index()
+    {
+        std::vector<NumType> v({
+            5,5,0,1,
+            5,5,1,1,
+            5,5,0,2,
+            5,5,1,3,
+        });
+        auto edp = ExampleDatasetParser(v, 4, {2,3});
+
+        EDGE_LEARNING_TEST_TRY(Dataset<NumType>::parse(
+            edp, DatasetParser::LabelEncoding::CLASS_INDEX_ENCODING));
+        auto ds = Dataset<NumType>::parse(
+            edp, DatasetParser::LabelEncoding::CLASS_INDEX_ENCODING);
+        EDGE_LEARNING_TEST_EQUAL(ds.feature_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds.size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds.label_idx().size(), 2);
+        std::vector<NumType> truth_class_index({
+            5,5,0,0,
+            5,5,1,0,
+            5,5,0,1,
+            5,5,1,2,
+        });
+        EDGE_LEARNING_TEST_ASSERT(ds.data() == truth_class_index);
+
+        auto one_hot = Dataset<NumType>::parse(
+            edp, DatasetParser::LabelEncoding::ONE_HOT_ENCODING);
+        one_hot.label_idx({4,5,6});
+        auto ds_class_index = one_hot.to_class_index();
+        EDGE_LEARNING_TEST_EQUAL(ds_class_index.feature_size(), 5);
+        EDGE_LEARNING_TEST_EQUAL(ds_class_index.size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(ds_class_index.label_idx().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(ds_class_index.label_idx()[0], 4);
+        for (SizeType i = 0; i < ds_class_index.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_ASSERT(
+                ds_class_index.input(i) == one_hot.input(i));
+            EDGE_LEARNING_TEST_EQUAL(ds_class_index.label(i).size(), 1);
+            EDGE_LEARNING_TEST_EQUAL(ds_class_index.label(i)[0],
+                                     truth_class_index[i * 4 + 3]);
+        }
+
+        auto no_labels = Dataset<NumType>(v, 4);
+        EDGE_LEARNING_TEST_ASSERT(no_labels.to_class_index().data() == v);
+    }
+
     void test_dataset_shuffle() {
         std::vector<NumType> v({
             5, 5, 5, 5, 5, 0, 1,
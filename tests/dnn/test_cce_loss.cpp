@@ -37,6 +37,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_loss_layer());
         EDGE_LEARNING_TEST_CALL(test_score());
         EDGE_LEARNING_TEST_CALL(test_cce_loss_layer());
+        EDGE_LEARNING_TEST_CALL(test_class_index_target());
         EDGE_LEARNING_TEST_CALL(test_stream());
     }
 
@@ -301,6 +302,44 @@ private:
         EDGE_LEARNING_TEST_TRY(l_binary.backward(v3));
     }
 
+    void test_class_index_target() {
+        SizeType input_size = 4;
+        auto l_dense = CategoricalCrossEntropyLossLayer("cce_dense",
+                                                        input_size, 2);
+        auto l_index = CategoricalCrossEntropyLossLayer("cce_index",
+                                                        input_size, 2);
+        std::vector<NumType> v{0.1, 0.2, 0.6, 0.1};
+        std::vector<std::vector<NumType>> dense_targets{
+            {0, 0, 1, 0}, {1, 0, 0, 0}, {0, 0, 0, 1}};
+        std::vector<std::vector<NumType>> index_targets{{2}, {0}, {3}};
+        for (SizeType i = 0; i < dense_targets.size(); ++i)
+        {
+            l_dense.set_target(dense_targets[i]);
+            l_index.set_target(index_targets[i]);
+            l_dense.training_forward(v);
+            l_index.training_forward(v);
+            auto g_dense = l_dense.backward(v);
+            auto g_index = l_index.backward(v);
+            EDGE_LEARNING_TEST_EQUAL(g_index.size(), g_dense.size());
+            for (SizeType j = 0; j < g_dense.size(); ++j)
+            {
+                EDGE_LEARNING_TEST_WITHIN(g_index[j], g_dense[j], 1e-12);
+            }
+        }
+        EDGE_LEARNING_TEST_WITHIN(l_index.avg_loss(), l_dense.avg_loss(),
+                                  1e-12);
+        EDGE_LEARNING_TEST_WITHIN(l_index.accuracy(), l_dense.accuracy(),
+                                  1e-12);
+        EDGE_LEARNING_TEST_WITHIN(l_index.accuracy(), 1.0 / 3.0, 1e-12);
+
+        EDGE_LEARNING_TEST_TRY(l_index.set_target({4}));
+        EDGE_LEARNING_TEST_THROWS(l_index.forward(v), std::runtime_error);
+        EDGE_LEARNING_TEST_TRY(l_index.set_target({-1}));
+        EDGE_LEARNING_TEST_THROWS(l_index.forward(v), std::runtime_error);
+        EDGE_LEARNING_TEST_TRY(l_index.set_target({1.5}));
+        EDGE_LEARNING_TEST_THROWS(l_index.forward(v), std::runtime_error);
+    }
+
     void test_stream()
     {
         auto l = CategoricalCrossEntropyLossLayer("cce_loss_layer_test", 2);
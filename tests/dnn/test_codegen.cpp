@@ -0,0 +1,313 @@
+/***************************************************************************
+ *            dnn/test_codegen.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/codegen.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/activation.hpp"
+#include "dnn/dropout.hpp"
+#include "dnn/concatenate.hpp"
+#include "dnn/recurrent.hpp"
+#include "dnn/cce_loss.hpp"
+#include "dnn/gd_optimizer.hpp"
+#include "data/path.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+
+using namespace std;
+using namespace EdgeLearning;
+
+#ifndef EDGE_LEARNING_TEST_CXX_COMPILER
+#define EDGE_LEARNING_TEST_CXX_COMPILER "c++"
+#endif
+
+
+class TestCodeGenerator {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_generate());
+        EDGE_LEARNING_TEST_CALL(test_compile_and_predict());
+        EDGE_LEARNING_TEST_CALL(test_branches());
+        EDGE_LEARNING_TEST_CALL(test_unsupported());
+    }
+
+private:
+    const SizeType SEED       = 134234563;
+    const SizeType BATCH_SIZE = 8;
+    const SizeType INPUT_SIZE = 4;
+    const SizeType HIDDEN1    = 200;
+    const SizeType HIDDEN2    = 100;
+    const SizeType OUTPUT_SIZE = 2;
+    const SizeType ENTRIES    = 64;
+
+    void test_generate()
+    {
+        auto m = _create_classifier_model();
+        EDGE_LEARNING_TEST_TRY(CodeGenerator{m});
+        CodeGenerator cg{m};
+        EDGE_LEARNING_TEST_EQUAL(cg.input_size(), INPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(cg.output_size(), OUTPUT_SIZE);
+
+        auto src = cg.generate("classifier");
+        EDGE_LEARNING_TEST_ASSERT(src.find("namespace classifier") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find("void predict(") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find("constexpr NumType layer0_weights[800]") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find("stable_softmax(output") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find("new ") == std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find("malloc") == std::string::npos);
+        // Unused kernels are not emitted.
+        EDGE_LEARNING_TEST_ASSERT(src.find("sigmoid") == std::string::npos);
+    }
+
+    void test_compile_and_predict()
+    {
+        auto m = _create_classifier_model();
+        auto inputs = _generate_inputs();
+        _train(m, inputs);
+        _check_generated(m, inputs, "codegen");
+    }
+
+    void test_branches()
+    {
+        // Two branches concatenated, the second one through an Elu.
+        Model m{"branches"};
+        auto a = m.add_layer<DenseLayer>("a", INPUT_SIZE, 2);
+        auto b = m.add_layer<DenseLayer>("b", INPUT_SIZE, 3);
+        auto b_elu = m.add_layer<EluLayer>("b_elu", 3, 0.5);
+        auto concat = m.add_layer<ConcatenateLayer>(
+            "concat", std::vector<DLMath::Shape3d>{{2}, {3}});
+        auto head = m.add_layer<DenseLayer>("head", 5, OUTPUT_SIZE);
+        auto head_softmax = m.add_layer<SoftmaxLayer>(
+            "head_softmax", OUTPUT_SIZE);
+        m.create_edge(b, b_elu);
+        // The inputs follow the layer order, not the edge order.
+        m.create_edge(b_elu, concat);
+        m.create_edge(a, concat);
+        m.create_edge(concat, head);
+        m.create_edge(head, head_softmax);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(SEED));
+
+        auto src = CodeGenerator{m}.generate("branches");
+        EDGE_LEARNING_TEST_ASSERT(
+            src.find("concatenate_slice(buffer") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(src.find(", 0.5);") != std::string::npos);
+        EDGE_LEARNING_TEST_ASSERT(
+            src.find("using NumType = double;") != std::string::npos);
+        _check_generated(m, _generate_inputs(), "codegen_branches");
+    }
+
+    void test_unsupported()
+    {
+        Model rnn{"rnn"};
+        auto r = rnn.add_layer<RecurrentLayer>("r", 2, 2, 2);
+        EDGE_LEARNING_TEST_THROWS(CodeGenerator{rnn}, std::runtime_error);
+
+        Model branches{"branches"};
+        auto in = branches.add_layer<DenseLayer>("in", 2, 2);
+        auto b1 = branches.add_layer<ReluLayer>("b1", 2);
+        auto b2 = branches.add_layer<TanhLayer>("b2", 2);
+        branches.create_edge(in, b1);
+        branches.create_edge(in, b2);
+        EDGE_LEARNING_TEST_THROWS(CodeGenerator{branches},
+                                  std::runtime_error);
+
+        Model identity{"identity"};
+        auto d = identity.add_layer<DropoutLayer>("d", 3, 0.5);
+        auto l = identity.add_layer<LinearLayer>("l", 3);
+        identity.create_edge(d, l);
+        EDGE_LEARNING_TEST_TRY(CodeGenerator{identity});
+        auto src = CodeGenerator{identity}.generate();
+        EDGE_LEARNING_TEST_ASSERT(src.find("output[i] = input[i]") != std::string::npos);
+        (void) r;
+    }
+
+    Model _create_classifier_model()
+    {
+        // Same structure of the simple_classification example.
+        Model m{"classifier"};
+        auto h1 = m.add_layer<DenseLayer>("h1", INPUT_SIZE, HIDDEN1);
+        auto h1_relu = m.add_layer<ReluLayer>("h1_relu", HIDDEN1);
+        auto h2 = m.add_layer<DenseLayer>("h2", HIDDEN1, HIDDEN2);
+        auto h2_relu = m.add_layer<ReluLayer>("h2_relu", HIDDEN2);
+        auto out = m.add_layer<DenseLayer>("out", HIDDEN2, OUTPUT_SIZE);
+        auto out_softmax = m.add_layer<SoftmaxLayer>(
+            "out_softmax", OUTPUT_SIZE);
+        m.create_edge(h1, h1_relu);
+        m.create_edge(h1_relu, h2);
+        m.create_edge(h2, h2_relu);
+        m.create_edge(h2_relu, out);
+        m.create_edge(out, out_softmax);
+        auto loss = m.add_loss<CategoricalCrossEntropyLossLayer>(
+            "cce", OUTPUT_SIZE, BATCH_SIZE);
+        m.create_loss_edge(out_softmax, loss);
+        m.init(Model::InitializationFunction::AUTO,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(SEED));
+        return m;
+    }
+
+    void _check_generated(Model& m,
+                          const std::vector<std::vector<NumType>>& inputs,
+                          const std::string& prefix)
+    {
+        // Generate from the model and from its Json dump.
+        CodeGenerator generator{m};
+        const auto input_size = generator.input_size();
+        const auto output_size = generator.output_size();
+        std::ofstream model_src{std::filesystem::path{prefix + "_model.cpp"},
+                                std::ios::trunc};
+        generator.generate(model_src, "from_model");
+        model_src.close();
+
+        std::ofstream dump_file{std::filesystem::path{prefix + "_model.json"},
+                                std::ios::trunc};
+        m.dump(dump_file);
+        dump_file.close();
+        Json dump;
+        std::ifstream dump_ifile{
+            std::filesystem::path{prefix + "_model.json"}};
+        dump_ifile >> dump;
+        dump_ifile.close();
+        std::ofstream json_src{std::filesystem::path{prefix + "_json.cpp"},
+                               std::ios::trunc};
+        EDGE_LEARNING_TEST_TRY(CodeGenerator{dump}.generate(json_src, "from_json"));
+        json_src.close();
+
+        // Driver that prints the predictions of both generated models, with
+        // the sizes and the NumType of the generated code.
+        std::ofstream driver{std::filesystem::path{prefix + "_main.cpp"},
+                             std::ios::trunc};
+        driver.precision(std::numeric_limits<NumType>::max_digits10);
+        driver << "#include \"" << prefix << "_model.cpp\"\n"
+               << "#include \"" << prefix << "_json.cpp\"\n"
+               << "#include <cstdio>\n"
+               << "#include <limits>\n"
+               << "using from_model::NumType;\n"
+               << "static_assert(from_model::INPUT_SIZE == " << input_size
+               << ", \"input size\");\n"
+               << "static_assert(from_model::OUTPUT_SIZE == " << output_size
+               << ", \"output size\");\n"
+               << "static const NumType inputs[] = {\n";
+        for (const auto& in: inputs)
+        {
+            EDGE_LEARNING_TEST_EQUAL(in.size(), input_size);
+            for (const auto& v: in) driver << v << ",";
+            driver << "\n";
+        }
+        driver << "};\n"
+               << "static void print(const NumType* out)\n"
+               << "{\n"
+               << "    for (std::size_t j = 0; j < from_model::OUTPUT_SIZE;"
+               << " ++j)\n"
+               << "    {\n"
+               << "        std::printf(\"%.*Lg \",\n"
+               << "            std::numeric_limits<NumType>::max_digits10,\n"
+               << "            static_cast<long double>(out[j]));\n"
+               << "    }\n"
+               << "}\n"
+               << "int main()\n"
+               << "{\n"
+               << "    NumType out[from_model::OUTPUT_SIZE];\n"
+               << "    for (std::size_t i = 0; i < " << inputs.size()
+               << "; ++i)\n"
+               << "    {\n"
+               << "        const NumType* in = inputs"
+               << " + i * from_model::INPUT_SIZE;\n"
+               << "        from_model::predict(in, out);\n"
+               << "        print(out);\n"
+               << "        from_json::predict(in, out);\n"
+               << "        print(out);\n"
+               << "        std::printf(\"\\n\");\n"
+               << "    }\n"
+               << "    return 0;\n"
+               << "}\n";
+        driver.close();
+
+        std::string compile = std::string(EDGE_LEARNING_TEST_CXX_COMPILER)
+            + " -std=c++17 -O2 -Wall -Wextra -Wpedantic -Werror"
+            + " -o " + prefix + "_main " + prefix + "_main.cpp";
+        EDGE_LEARNING_TEST_EQUAL(std::system(compile.c_str()), 0);
+        std::string run = "./" + prefix + "_main > " + prefix
+            + "_predictions.txt";
+        EDGE_LEARNING_TEST_EQUAL(std::system(run.c_str()), 0);
+
+        std::ifstream predictions{
+            std::filesystem::path{prefix + "_predictions.txt"}};
+        for (const auto& in: inputs)
+        {
+            const auto& expected = m.predict(in);
+            EDGE_LEARNING_TEST_EQUAL(expected.size(), output_size);
+            std::vector<NumType> from_model(output_size);
+            std::vector<NumType> from_json(output_size);
+            for (auto& v: from_model) predictions >> v;
+            for (auto& v: from_json) predictions >> v;
+            EDGE_LEARNING_TEST_ASSERT(predictions.good());
+            for (SizeType i = 0; i < output_size; ++i)
+            {
+                EDGE_LEARNING_TEST_WITHIN(from_model[i], expected[i], 1e-12);
+                // Json dump keeps a limited amount of decimals.
+                EDGE_LEARNING_TEST_WITHIN(from_json[i], expected[i], 1e-3);
+            }
+        }
+    }
+
+    std::vector<std::vector<NumType>> _generate_inputs()
+    {
+        RneType rne{SEED};
+        std::vector<std::vector<NumType>> ret(ENTRIES);
+        for (auto& in: ret)
+        {
+            in.resize(INPUT_SIZE);
+            for (auto& v: in) v = DLMath::rand<NumType>(0.0, 1.0, rne);
+        }
+        return ret;
+    }
+
+    void _train(Model& m, const std::vector<std::vector<NumType>>& inputs)
+    {
+        GradientDescentOptimizer o{NumType{0.01}};
+        for (SizeType i = 0; i < inputs.size();)
+        {
+            for (SizeType b = 0; b < BATCH_SIZE && i < inputs.size(); ++b, ++i)
+            {
+                const auto& in = inputs[i];
+                bool flag = (in[0] > 0.5 || in[1] > 0.0)
+                    && (in[2] > 0.0 || in[3] > 0.5);
+                m.step(in, {static_cast<NumType>(flag),
+                            static_cast<NumType>(!flag)});
+            }
+            m.train(o);
+        }
+    }
+};
+
+int main() {
+    TestCodeGenerator().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -0,0 +1,221 @@
+/***************************************************************************
+ *            dnn/test_concatenate.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/concatenate.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/model.hpp"
+#include "dnn/mse_loss.hpp"
+#include "dnn/dlmath.hpp"
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestConcatenateLayer {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_layer());
+        EDGE_LEARNING_TEST_CALL(test_channels());
+        EDGE_LEARNING_TEST_CALL(test_model());
+        EDGE_LEARNING_TEST_CALL(test_dump());
+    }
+
+private:
+    void test_layer()
+    {
+        EDGE_LEARNING_TEST_THROWS(ConcatenateLayer("c", {}),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(ConcatenateLayer("c", {{2}}, 3),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(
+            ConcatenateLayer("c", {{2, 2, 1}, {2, 3, 1}}, 0),
+            std::runtime_error);
+
+        ConcatenateLayer l{"c", {{2}, {3}}, 0};
+        EDGE_LEARNING_TEST_EQUAL(l.type(), "Concatenate");
+        EDGE_LEARNING_TEST_EQUAL(l.input_layers(), 2);
+        EDGE_LEARNING_TEST_EQUAL(l.input_size(0), 2);
+        EDGE_LEARNING_TEST_EQUAL(l.input_size(1), 3);
+        EDGE_LEARNING_TEST_EQUAL(l.output_size(), 5);
+        EDGE_LEARNING_TEST_EQUAL(l.param_count(), 0);
+        EDGE_LEARNING_TEST_THROWS(l.param(0), std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(l.gradient(0), std::runtime_error);
+
+        // The inputs are written in their slices in any order.
+        l.forward_input({3.0, 4.0, 5.0}, 1);
+        const auto& out = l.forward_input({1.0, 2.0}, 0);
+        for (SizeType i = 0; i < 5; ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(out[i], NumType(i + 1));
+        }
+        EDGE_LEARNING_TEST_EQUAL(l.last_output().size(), 5);
+        EDGE_LEARNING_TEST_THROWS(l.forward_input({1.0}, 0),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(l.forward_input({1.0, 2.0, 3.0}, 0),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(l.forward_input({1.0, 2.0}, 2),
+                                  std::out_of_range);
+
+        const auto& flat = l.forward({5.0, 4.0, 3.0, 2.0, 1.0});
+        EDGE_LEARNING_TEST_EQUAL(flat[0], 5.0);
+        EDGE_LEARNING_TEST_EQUAL(flat[4], 1.0);
+
+        const auto& gradients = l.backward({0.1, 0.2, 0.3, 0.4, 0.5});
+        EDGE_LEARNING_TEST_EQUAL(gradients.size(), 2);
+        EDGE_LEARNING_TEST_ASSERT(&gradients == &l.input_gradient(0));
+        EDGE_LEARNING_TEST_ASSERT(
+            &l.last_input_gradient() == &l.input_gradient(0));
+        EDGE_LEARNING_TEST_EQUAL(l.input_gradient(0).size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(l.input_gradient(1).size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(l.input_gradient(0)[1], 0.2);
+        EDGE_LEARNING_TEST_EQUAL(l.input_gradient(1)[0], 0.3);
+        EDGE_LEARNING_TEST_EQUAL(l.input_gradient(1)[2], 0.5);
+    }
+
+    void test_channels()
+    {
+        // Inner axes interleave: compare with DLMath::append and extract.
+        DLMath::Shape3d s0{2, 2, 1};
+        DLMath::Shape3d s1{2, 2, 2};
+        DLMath::Shape3d out_shape{2, 2, 3};
+        ConcatenateLayer l{"c", {s0, s1}, 2};
+        EDGE_LEARNING_TEST_EQUAL(l.output_size(), out_shape.size());
+
+        std::vector<NumType> in0(s0.size());
+        std::vector<NumType> in1(s1.size());
+        for (SizeType i = 0; i < in0.size(); ++i) in0[i] = NumType(i);
+        for (SizeType i = 0; i < in1.size(); ++i) in1[i] = NumType(10 + i);
+        std::vector<NumType> expected(out_shape.size());
+        DLMath::append<NumType>(expected.data(), out_shape, in0.data(),
+                                s0.channels(), 2, 0);
+        DLMath::append<NumType>(expected.data(), out_shape, in1.data(),
+                                s1.channels(), 2, s0.channels());
+
+        l.forward_input(in0, 0);
+        auto out = l.forward_input(in1, 1);
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(out[i], expected[i]);
+        }
+
+        l.backward(expected);
+        for (SizeType i = 0; i < in0.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(l.input_gradient(0)[i], in0[i]);
+        }
+        for (SizeType i = 0; i < in1.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(l.input_gradient(1)[i], in1[i]);
+        }
+    }
+
+    void test_model()
+    {
+        // Two branches concatenated are equivalent to a single Dense layer
+        // with the weights of the branches stacked.
+        const std::vector<NumType> input = {0.5, -0.25, 1.0, 0.75};
+        const std::vector<NumType> target = {0.3};
+
+        Model m{"concatenate"};
+        auto a = m.add_layer<DenseLayer>("a", 4, 2);
+        auto b = m.add_layer<DenseLayer>("b", 4, 3);
+        auto concat = m.add_layer<ConcatenateLayer>(
+            "concat", std::vector<DLMath::Shape3d>{{2}, {3}});
+        auto head = m.add_layer<DenseLayer>("head", 5, 1);
+        std::shared_ptr<LossLayer> loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", 1, 1);
+        // The inputs follow the layer order, not the edge order.
+        m.create_edge(b, concat);
+        m.create_edge(a, concat);
+        m.create_edge(concat, head);
+        m.create_loss_edge(head, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(3));
+
+        Model m_ref{"reference"};
+        auto ab = m_ref.add_layer<DenseLayer>("ab", 4, 5);
+        auto head_ref = m_ref.add_layer<DenseLayer>("head", 5, 1);
+        std::shared_ptr<LossLayer> loss_ref =
+            m_ref.add_loss<MeanSquaredLossLayer>("loss", 1, 1);
+        m_ref.create_edge(ab, head_ref);
+        m_ref.create_loss_edge(head_ref, loss_ref);
+        for (SizeType i = 0; i < 8; ++i) ab->param(i) = a->param(i);
+        for (SizeType i = 0; i < 12; ++i) ab->param(8 + i) = b->param(i);
+        for (SizeType i = 0; i < 2; ++i) ab->param(20 + i) = a->param(8 + i);
+        for (SizeType i = 0; i < 3; ++i) ab->param(22 + i) = b->param(12 + i);
+        for (SizeType i = 0; i < head->param_count(); ++i)
+        {
+            head_ref->param(i) = head->param(i);
+        }
+
+        auto p = m.predict(input);
+        auto p_ref = m_ref.predict(input);
+        EDGE_LEARNING_TEST_EQUAL(p.size(), 1);
+        EDGE_LEARNING_TEST_WITHIN(p[0], p_ref[0], 1e-12);
+
+        m.step(input, target);
+        m_ref.step(input, target);
+        for (SizeType i = 0; i < head->param_count(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(head->gradient(i),
+                                      head_ref->gradient(i), 1e-12);
+        }
+        for (SizeType i = 0; i < 8; ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(a->gradient(i), ab->gradient(i), 1e-12);
+        }
+        for (SizeType i = 0; i < 12; ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(b->gradient(i),
+                                      ab->gradient(8 + i), 1e-12);
+        }
+        for (SizeType i = 0; i < 3; ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(b->gradient(12 + i),
+                                      ab->gradient(22 + i), 1e-12);
+        }
+    }
+
+    void test_dump()
+    {
+        ConcatenateLayer l{"c", {{2, 2, 1}, {2, 2, 3}}, 2};
+        Json dump;
+        EDGE_LEARNING_TEST_TRY(dump = l.dump());
+        ConcatenateLayer loaded;
+        EDGE_LEARNING_TEST_TRY(loaded.load(dump));
+        EDGE_LEARNING_TEST_EQUAL(loaded.axis(), 2);
+        EDGE_LEARNING_TEST_EQUAL(loaded.input_layers(), 2);
+        EDGE_LEARNING_TEST_EQUAL(loaded.output_size(), 16);
+        EDGE_LEARNING_TEST_EQUAL(loaded.output_shape().channels(), 4);
+        auto copy = l.clone();
+        EDGE_LEARNING_TEST_EQUAL(copy->input_gradient(1).size(), 12);
+    }
+};
+
+int main() {
+    TestConcatenateLayer().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
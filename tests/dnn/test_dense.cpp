@@ -38,6 +38,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_getter());
         EDGE_LEARNING_TEST_CALL(test_setter());
         EDGE_LEARNING_TEST_CALL(test_stream());
+        EDGE_LEARNING_TEST_CALL(test_lazy_gradients());
     }
 
 private:
@@ -228,6 +229,42 @@ private:
                                  l_assign.output_size());
     }
 
+    void test_lazy_gradients()
+    {
+        std::vector<NumType> v{1.0, 2.0};
+        auto l = DenseLayer("dense_layer_test", 2, 3);
+        EDGE_LEARNING_TEST_ASSERT(!l.gradients_allocated());
+        EDGE_LEARNING_TEST_TRY(l.forward(v));
+        EDGE_LEARNING_TEST_ASSERT(!l.gradients_allocated());
+
+        EDGE_LEARNING_TEST_TRY(l.training_forward(v));
+        EDGE_LEARNING_TEST_ASSERT(l.gradients_allocated());
+        EDGE_LEARNING_TEST_TRY(l.backward({1.0, 1.0, 1.0}));
+        EDGE_LEARNING_TEST_EQUAL(l.last_input_gradient().size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(l.gradient(0), v[0]);
+
+        EDGE_LEARNING_TEST_TRY(l.free_gradients());
+        EDGE_LEARNING_TEST_ASSERT(!l.gradients_allocated());
+        EDGE_LEARNING_TEST_EQUAL(l.gradient(l.param_count() - 1), 0.0);
+        EDGE_LEARNING_TEST_ASSERT(l.gradients_allocated());
+
+        // The shape changes resize the allocated gradients.
+        EDGE_LEARNING_TEST_TRY(l.input_shape(4));
+        EDGE_LEARNING_TEST_EQUAL(l.last_input_gradient().size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(l.gradient(l.param_count() - 1), 0.0);
+
+        // The clones share the parameters, but own their gradients: the
+        // copies of a model can be trained in parallel.
+        auto training_clone = l.clone();
+        EDGE_LEARNING_TEST_ASSERT(
+            &training_clone->gradient(0) != &l.gradient(0));
+
+        // The clone of an inference layer is an inference layer.
+        l.free_gradients();
+        auto clone = l.clone();
+        EDGE_LEARNING_TEST_ASSERT(!clone->gradients_allocated());
+    }
+
     void test_getter()
     {
         SizeType input_size = 1;
@@ -25,7 +25,16 @@
 #include "test.hpp"
 #include "dnn/dlgraph.hpp"
 #include "dnn/dense.hpp"
+#include "dnn/activation.hpp"
 #include "dnn/mse_loss.hpp"
+#include "dnn/model.hpp"
+#include "dnn/scheduler.hpp"
+
+#include "betterthreads/task_manager.hpp"
+
+#include <chrono>
+#include <limits>
+#include <mutex>
 
 
 using namespace std;
@@ -38,6 +47,10 @@ public:
         EDGE_LEARNING_TEST_CALL(test_graph());
         EDGE_LEARNING_TEST_CALL(test_adjacent_matrix());
         EDGE_LEARNING_TEST_CALL(test_dlgraph());
+        EDGE_LEARNING_TEST_CALL(test_large_graph());
+        EDGE_LEARNING_TEST_CALL(test_large_model());
+        EDGE_LEARNING_TEST_CALL(test_scheduler());
+        EDGE_LEARNING_TEST_CALL(test_branches());
     }
 
 private:
@@ -605,6 +618,275 @@ private:
         EDGE_LEARNING_TEST_EQUAL(graph_assign.output_layers_idx().size(), 1);
         EDGE_LEARNING_TEST_EQUAL(graph_assign.output_layers_idx()[0], 5);
     }
+
+    void test_large_graph()
+    {
+        // Chain of layers with a skip arc every two layers.
+        const SizeType layers_amount = 2000;
+        auto begin = std::chrono::steady_clock::now();
+        DLGraph graph;
+        std::vector<std::shared_ptr<Layer>> layers;
+        for (SizeType i = 0; i < layers_amount; ++i)
+        {
+            layers.push_back(std::make_shared<DenseLayer>(
+                "l" + std::to_string(i), 4, 4));
+            graph.add_node(layers.back());
+            if (i > 0) graph.add_edge(layers[i - 1], layers[i]);
+            if (i > 1 && i % 2 == 0) graph.add_edge(layers[i - 2], layers[i]);
+        }
+        std::shared_ptr<LossLayer> loss =
+            std::make_shared<MeanSquaredLossLayer>("loss", 4, 1);
+        graph.add_loss(loss);
+        graph.add_edge(layers.back(), loss);
+        auto build_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+
+        begin = std::chrono::steady_clock::now();
+        auto forward_arcs = graph.forward_run();
+        auto training_forward_arcs = graph.training_forward_run();
+        auto backward_arcs = graph.backward_run();
+        auto run_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+        EDGE_LEARNING_TEST_PRINT(build_time);
+        EDGE_LEARNING_TEST_PRINT(run_time);
+
+        auto skip_arcs = (layers_amount - 1) / 2;
+        EDGE_LEARNING_TEST_EQUAL(graph.size(), layers_amount + 1);
+        EDGE_LEARNING_TEST_EQUAL(forward_arcs.size(),
+                                 layers_amount - 1 + skip_arcs);
+        EDGE_LEARNING_TEST_EQUAL(training_forward_arcs.size(),
+                                 forward_arcs.size() + 1);
+        EDGE_LEARNING_TEST_EQUAL(backward_arcs.size(),
+                                 training_forward_arcs.size());
+        EDGE_LEARNING_TEST_EQUAL(graph.input_layers_idx().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(graph.input_layers_idx()[0], 0);
+        EDGE_LEARNING_TEST_EQUAL(graph.output_layers_idx().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(graph.output_layers_idx()[0],
+                                 layers_amount - 1);
+        EDGE_LEARNING_TEST_EQUAL(graph.loss_layers_idx()[0], layers_amount);
+        EDGE_LEARNING_TEST_EQUAL(graph.forward_predecessors(4).size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(graph.forward(2).size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(graph.backward(4).size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(graph.index_of(*layers[1234]), 1234);
+        EDGE_LEARNING_TEST_EQUAL(graph.index_of(DenseLayer("none", 4, 4)), -1);
+        EDGE_LEARNING_TEST_THROWS(
+            graph.add_edge(std::make_shared<DenseLayer>("none", 4, 4),
+                           layers[0]),
+            std::runtime_error);
+
+        // Each layer appears once as destination of the forward visit.
+        std::vector<bool> visited(graph.size(), false);
+        visited[0] = true;
+        for (const auto& arc: forward_arcs)
+        {
+            EDGE_LEARNING_TEST_ASSERT(
+                visited[static_cast<SizeType>(graph.index_of(*arc.from))]);
+            visited[static_cast<SizeType>(graph.index_of(*arc.to))] = true;
+        }
+        EDGE_LEARNING_TEST_EQUAL(
+            std::count(visited.begin(), visited.end(), true),
+            layers_amount);
+    }
+
+    void test_large_model()
+    {
+        // The run orders are computed once, at the first step.
+        const SizeType layers_amount = 500;
+        auto begin = std::chrono::steady_clock::now();
+        Model m{"large"};
+        auto prev = m.add_layer<DenseLayer>("l0", 4, 4);
+        for (SizeType i = 1; i < layers_amount; ++i)
+        {
+            auto curr = m.add_layer<DenseLayer>(
+                "l" + std::to_string(i), 4, 4);
+            m.create_edge(prev, curr);
+            prev = curr;
+        }
+        auto loss = m.add_loss<MeanSquaredLossLayer>("loss", 4, 1);
+        m.create_loss_edge(prev, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(1));
+        auto build_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+
+        begin = std::chrono::steady_clock::now();
+        EDGE_LEARNING_TEST_TRY(m.step({1.0, 0.0, 0.0, 1.0},
+                                      {0.0, 1.0, 1.0, 0.0}));
+        auto step_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+        EDGE_LEARNING_TEST_PRINT(build_time);
+        EDGE_LEARNING_TEST_PRINT(step_time);
+
+        EDGE_LEARNING_TEST_EQUAL(m.layers().size(), layers_amount + 1);
+        EDGE_LEARNING_TEST_EQUAL(m.input_layers().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(m.output_layers().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(m.predict({1.0, 0.0, 0.0, 1.0}).size(), 4);
+    }
+
+    void test_scheduler()
+    {
+        DLGraph graph;
+        auto in = std::make_shared<DenseLayer>("in", 4, 4);
+        graph.add_node(in);
+        for (SizeType b = 0; b < 3; ++b)
+        {
+            auto prefix = "b" + std::to_string(b);
+            auto hidden = std::make_shared<DenseLayer>(prefix + "_hidden", 4, 4);
+            auto out = std::make_shared<DenseLayer>(prefix + "_out", 4, 4);
+            graph.add_node(hidden);
+            graph.add_node(out);
+            graph.add_edge(in, hidden);
+            graph.add_edge(hidden, out);
+        }
+
+        // The task manager concurrency enables the parallel execution.
+        auto& tm = BetterThreads::TaskManager::instance();
+        tm.set_concurrency(4);
+        RunScheduler forward{graph.forward_run(), 0};
+        EDGE_LEARNING_TEST_EQUAL(forward.run().size(), graph.forward_run().size());
+        EDGE_LEARNING_TEST_EQUAL(forward.width(), 3);
+        EDGE_LEARNING_TEST_ASSERT(forward.parallel());
+        tm.set_concurrency(1);
+        EDGE_LEARNING_TEST_ASSERT(!forward.parallel());
+        tm.set_concurrency(4);
+        EDGE_LEARNING_TEST_ASSERT(forward.concurrent_work() > 0);
+        std::vector<const Layer*> visited;
+        std::mutex mutex;
+        EDGE_LEARNING_TEST_TRY(forward.execute([&](const DLGraph::Arc& arc) {
+            std::lock_guard<std::mutex> lock{mutex};
+            visited.push_back(arc.to.get());
+        }));
+        EDGE_LEARNING_TEST_EQUAL(visited.size(), forward.run().size());
+
+        // The threshold disables the parallel execution of cheap branches.
+        forward.parallel_threshold(forward.concurrent_work() + 1);
+        EDGE_LEARNING_TEST_ASSERT(!forward.parallel());
+        visited.clear();
+        forward.execute([&](const DLGraph::Arc& arc) {
+            visited.push_back(arc.to.get());
+        });
+        EDGE_LEARNING_TEST_EQUAL(visited.size(), forward.run().size());
+
+        // A chain has no independent branches.
+        DLGraph chain;
+        auto l0 = std::make_shared<DenseLayer>("l0", 4, 4);
+        auto l1 = std::make_shared<DenseLayer>("l1", 4, 4);
+        auto l2 = std::make_shared<DenseLayer>("l2", 4, 4);
+        chain.add_node(l0);
+        chain.add_node(l1);
+        chain.add_node(l2);
+        chain.add_edge(l0, l1);
+        chain.add_edge(l1, l2);
+        RunScheduler chain_forward{chain.forward_run(), 0};
+        EDGE_LEARNING_TEST_EQUAL(chain_forward.width(), 1);
+        EDGE_LEARNING_TEST_ASSERT(!chain_forward.parallel());
+
+        // Errors of the layers are propagated to the caller.
+        auto parallel_forward = RunScheduler{graph.forward_run(), 0};
+        EDGE_LEARNING_TEST_ASSERT(parallel_forward.parallel());
+        EDGE_LEARNING_TEST_THROWS(
+            parallel_forward.execute([](const DLGraph::Arc& arc) {
+                if (arc.to->name() == "b1_out")
+                    throw std::runtime_error("layer error");
+            }),
+            std::runtime_error);
+
+        // Small models fall back to the sequential execution by default.
+        EDGE_LEARNING_TEST_ASSERT(!_branches_model(3, 4).parallel());
+    }
+
+    void test_branches()
+    {
+        const SizeType branches = 4;
+        const SizeType width = 256;
+        const SizeType steps = 20;
+        auto m_seq = _branches_model(branches, width);
+        m_seq.parallel_threshold(std::numeric_limits<SizeType>::max());
+        Model m_par{m_seq};
+        m_par.parallel_threshold(0);
+        EDGE_LEARNING_TEST_ASSERT(!m_seq.parallel());
+        auto& tm = BetterThreads::TaskManager::instance();
+        tm.set_concurrency(1);
+        EDGE_LEARNING_TEST_ASSERT(!m_par.parallel());
+        tm.set_concurrency(4);
+        EDGE_LEARNING_TEST_ASSERT(m_par.parallel());
+        // The branches are large enough for the default threshold.
+        Model m_default{m_seq};
+        m_default.parallel_threshold(RunScheduler::DEFAULT_PARALLEL_THRESHOLD);
+        EDGE_LEARNING_TEST_ASSERT(m_default.parallel());
+
+        std::vector<NumType> input(16);
+        std::vector<NumType> target(4, 0.5);
+        for (SizeType i = 0; i < input.size(); ++i)
+        {
+            input[i] = NumType(i) / NumType(input.size()) - 0.5;
+        }
+
+        // Same parameters, same results in parallel and in sequence.
+        m_seq.step(input, target);
+        m_par.step(input, target);
+        for (SizeType l_idx = 0; l_idx < m_seq.layers().size(); ++l_idx)
+        {
+            auto l_seq = m_seq.layers()[l_idx];
+            auto l_par = m_par.layers()[l_idx];
+            for (SizeType p = 0; p < l_seq->param_count(); p += 97)
+            {
+                EDGE_LEARNING_TEST_EQUAL(l_par->gradient(p),
+                                         l_seq->gradient(p));
+            }
+        }
+        auto p_seq = m_seq.predict(input);
+        auto p_par = m_par.predict(input);
+        EDGE_LEARNING_TEST_EQUAL(p_par.size(), p_seq.size());
+        for (SizeType i = 0; i < p_seq.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(p_par[i], p_seq[i]);
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (SizeType s = 0; s < steps; ++s) m_seq.step(input, target);
+        auto sequential_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+        begin = std::chrono::steady_clock::now();
+        for (SizeType s = 0; s < steps; ++s) m_par.step(input, target);
+        auto parallel_time = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count();
+        EDGE_LEARNING_TEST_PRINT(sequential_time);
+        EDGE_LEARNING_TEST_PRINT(parallel_time);
+        EDGE_LEARNING_TEST_PRINT(sequential_time / parallel_time);
+    }
+
+    /**
+     * \brief Model with an input layer forking in independent branches,
+     * each with its own loss.
+     */
+    Model _branches_model(SizeType branches, SizeType width)
+    {
+        Model m{"branches"};
+        auto in = m.add_layer<DenseLayer>("in", 16, width);
+        for (SizeType b = 0; b < branches; ++b)
+        {
+            auto prefix = "b" + std::to_string(b);
+            auto hidden = m.add_layer<DenseLayer>(
+                prefix + "_hidden", width, width);
+            auto relu = m.add_layer<ReluLayer>(prefix + "_relu", width);
+            auto deep = m.add_layer<DenseLayer>(
+                prefix + "_deep", width, width);
+            auto out = m.add_layer<DenseLayer>(prefix + "_out", width, 4);
+            std::shared_ptr<LossLayer> loss =
+                m.add_loss<MeanSquaredLossLayer>(prefix + "_loss", 4, 1);
+            m.create_edge(in, hidden);
+            m.create_edge(hidden, relu);
+            m.create_edge(relu, deep);
+            m.create_edge(deep, out);
+            m.create_loss_edge(out, loss);
+        }
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(1));
+        return m;
+    }
 };
 
 int main() {
@@ -55,6 +55,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_arr_sum());
         EDGE_LEARNING_TEST_CALL(test_arr_mul());
         EDGE_LEARNING_TEST_CALL(test_matarr_mul());
+        EDGE_LEARNING_TEST_CALL(test_matmat_mul());
         EDGE_LEARNING_TEST_CALL(test_relu());
         EDGE_LEARNING_TEST_CALL(test_relu_1());
         EDGE_LEARNING_TEST_CALL(test_elu());
@@ -67,6 +68,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_softmax_1());
         EDGE_LEARNING_TEST_CALL(test_cross_entropy());
         EDGE_LEARNING_TEST_CALL(test_cross_entropy_1());
+        EDGE_LEARNING_TEST_CALL(test_sparse_cross_entropy());
         EDGE_LEARNING_TEST_CALL(test_mean_squared_error());
         EDGE_LEARNING_TEST_CALL(test_mean_squared_error_1());
         EDGE_LEARNING_TEST_CALL(test_max_argmax());
@@ -506,6 +508,54 @@ private:
         }
     }
 
+    void test_matmat_mul() {
+        // 2x3 and 3x2 matrices.
+        std::vector<int> lhs{1,2,3,4,5,6};
+        std::vector<int> rhs{1,2,3,4,5,6};
+        std::vector<int> res(4);
+        std::vector<int> truth{22,28,49,64};
+        DLMath::matmat_mul<int>(res.data(), lhs.data(), rhs.data(), 2, 3, 2);
+        for (std::size_t i = 0; i < truth.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(res[i], truth[i]);
+        }
+        EDGE_LEARNING_TEST_THROWS(
+            DLMath::matmat_mul<int>(lhs.data(), lhs.data(), rhs.data(),
+                                    2, 3, 2),
+            std::runtime_error);
+
+        // Rows of lhs multiplied with rhs (2x3) like matarr_mul.
+        truth = {14,32,32,77};
+        DLMath::matmat_mul_t<int>(res.data(), lhs.data(), rhs.data(), 2, 3, 2);
+        for (std::size_t i = 0; i < truth.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(res[i], truth[i]);
+        }
+        std::vector<int> row_res(2);
+        DLMath::matarr_mul<int>(row_res.data(), rhs.data(), lhs.data() + 3,
+                                2, 3);
+        EDGE_LEARNING_TEST_EQUAL(res[2], row_res[0]);
+        EDGE_LEARNING_TEST_EQUAL(res[3], row_res[1]);
+        EDGE_LEARNING_TEST_THROWS(
+            DLMath::matmat_mul_t<int>(rhs.data(), lhs.data(), rhs.data(),
+                                      2, 3, 2),
+            std::runtime_error);
+
+        // Sum of the outer products of the 2 rows: 3x3 result accumulated.
+        std::vector<int> acc(9, 1);
+        truth = {18,23,28,23,30,37,28,37,46};
+        DLMath::outer_product_acc<int>(acc.data(), lhs.data(), rhs.data(),
+                                       2, 3, 3);
+        for (std::size_t i = 0; i < truth.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(acc[i], truth[i]);
+        }
+        EDGE_LEARNING_TEST_THROWS(
+            DLMath::outer_product_acc<int>(lhs.data(), lhs.data(), rhs.data(),
+                                           2, 3, 3),
+            std::runtime_error);
+    }
+
     void test_relu() {
         std::vector<TestNumType> test_vec{-2,-1,0,1,2};
         std::vector<TestNumType> truth_vec{0,0,0,1,2};
@@ -775,6 +825,27 @@ private:
         EDGE_LEARNING_TEST_WITHIN(ret_val, truth_val, 0.00000000001);
     }
 
+    void test_sparse_cross_entropy() {
+        std::vector<TestNumType> test_y    {0.0, 0.0, 0.00, 0.00, 1.0};
+        std::vector<TestNumType> test_y_hat{0.1, 0.1, 0.25, 0.05, 0.5};
+        SizeType test_y_idx = 4;
+        auto ret = DLMath::sparse_cross_entropy(test_y_idx, test_y_hat.data());
+        EDGE_LEARNING_TEST_WITHIN(ret,
+            DLMath::cross_entropy(test_y.data(), test_y_hat.data(),
+                                  test_y_hat.size()), 0.00000000001);
+
+        std::vector<TestNumType> truth_ce1(test_y.size());
+        DLMath::cross_entropy_1<TestNumType>(truth_ce1.data(), test_y.data(),
+            test_y_hat.data(), 0.5, test_y_hat.size());
+        std::vector<TestNumType> ret_vec(test_y.size(), 7.0);
+        DLMath::sparse_cross_entropy_1<TestNumType>(ret_vec.data(),
+            test_y_idx, test_y_hat.data(), 0.5, test_y_hat.size());
+        for (std::size_t i = 0; i < truth_ce1.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(ret_vec[i], truth_ce1[i], 0.00000000001);
+        }
+    }
+
     void test_mean_squared_error() {
         TestNumType test_val = 1.0;
         TestNumType truth_val = 0.0;
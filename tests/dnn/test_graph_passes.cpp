@@ -0,0 +1,266 @@
+/***************************************************************************
+ *            dnn/test_graph_passes.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/graph_passes.hpp"
+#include "dnn/fused.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/activation.hpp"
+#include "dnn/dropout.hpp"
+#include "dnn/mse_loss.hpp"
+#include "middleware/fnn.hpp"
+
+#include <cmath>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestGraphPasses {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_remove());
+        EDGE_LEARNING_TEST_CALL(test_fuse());
+        EDGE_LEARNING_TEST_CALL(test_merge());
+        EDGE_LEARNING_TEST_CALL(test_fused_layer());
+        EDGE_LEARNING_TEST_CALL(test_fnn());
+    }
+
+private:
+    const RneType::result_type SEED = 7;
+    const std::vector<NumType> INPUT = {0.5, -0.25, 1.0, 0.75};
+
+    void test_remove()
+    {
+        Model m{"remove"};
+        auto in = m.add_layer<DenseLayer>("in", 4, 8);
+        auto linear = m.add_layer<LinearLayer>("linear", 8);
+        auto dropout = m.add_layer<DropoutLayer>("dropout", 8, 0.5);
+        auto out = m.add_layer<DenseLayer>("out", 8, 2);
+        auto out_linear = m.add_layer<LinearLayer>("out_linear", 2);
+        std::shared_ptr<LossLayer> loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", 2, 1, 1.0);
+        m.create_edge(in, linear);
+        m.create_edge(linear, dropout);
+        m.create_edge(dropout, out);
+        m.create_edge(out, out_linear);
+        m.create_loss_edge(out_linear, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, SEED);
+
+        GraphPasses passes{{GraphPasses::Pass::REMOVE_IDENTITY,
+                            GraphPasses::Pass::REMOVE_DROPOUT}};
+        auto opt = passes.run(m);
+        const auto& report = passes.report();
+        EDGE_LEARNING_TEST_EQUAL(report.layers_before, 5);
+        EDGE_LEARNING_TEST_EQUAL(report.layers_after, 2);
+        EDGE_LEARNING_TEST_EQUAL(report.removed.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(report.merged.size(), 0);
+        EDGE_LEARNING_TEST_EQUAL(report.fused.size(), 0);
+        EDGE_LEARNING_TEST_EQUAL(opt.layers().size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(opt.loss_layers().size(), 0);
+        EDGE_LEARNING_TEST_EQUAL(opt.input_layers().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(opt.output_layers().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(opt.input_layers()[0]->name(), "in");
+        EDGE_LEARNING_TEST_EQUAL(opt.output_layers()[0]->name(), "out");
+        EDGE_LEARNING_TEST_TRY(report.print());
+
+        auto expected = m.predict(INPUT);
+        auto actual = opt.predict(INPUT);
+        EDGE_LEARNING_TEST_EQUAL(actual.size(), expected.size());
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(actual[i], expected[i]);
+        }
+
+        // A single pass-through layer is kept.
+        Model single{"single"};
+        single.add_layer<LinearLayer>("linear", 4);
+        auto opt_single = passes.run(single);
+        EDGE_LEARNING_TEST_EQUAL(opt_single.layers().size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(passes.report().removed.size(), 0);
+    }
+
+    void test_fuse()
+    {
+        Model m{"fuse"};
+        auto in = m.add_layer<DenseLayer>("in", 4, 8);
+        auto relu = m.add_layer<ReluLayer>("relu", 8);
+        auto hidden = m.add_layer<DenseLayer>("hidden", 8, 8);
+        auto tanh = m.add_layer<TanhLayer>("tanh", 8);
+        auto out = m.add_layer<DenseLayer>("out", 8, 2);
+        auto sigmoid = m.add_layer<SigmoidLayer>("sigmoid", 2);
+        m.create_edge(in, relu);
+        m.create_edge(relu, hidden);
+        m.create_edge(hidden, tanh);
+        m.create_edge(tanh, out);
+        m.create_edge(out, sigmoid);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, SEED);
+
+        GraphPasses passes;
+        auto opt = passes.run(m);
+        const auto& report = passes.report();
+        EDGE_LEARNING_TEST_EQUAL(report.layers_before, 6);
+        EDGE_LEARNING_TEST_EQUAL(report.layers_after, 3);
+        EDGE_LEARNING_TEST_EQUAL(report.fused.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(report.fused[0], "in + relu");
+        for (const auto& l: opt.layers())
+        {
+            EDGE_LEARNING_TEST_ASSERT(l->is_type<FusedLayer>());
+        }
+
+        auto expected = m.predict(INPUT);
+        auto actual = opt.predict(INPUT);
+        EDGE_LEARNING_TEST_EQUAL(actual.size(), expected.size());
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(actual[i], expected[i]);
+        }
+    }
+
+    void test_merge()
+    {
+        Model m{"merge"};
+        auto in = m.add_layer<DenseLayer>("in", 4, 16);
+        auto hidden = m.add_layer<DenseLayer>("hidden", 16, 16);
+        auto out = m.add_layer<DenseLayer>("out", 16, 2);
+        m.create_edge(in, hidden);
+        m.create_edge(hidden, out);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, SEED);
+
+        GraphPasses passes;
+        auto opt = passes.run(m);
+        const auto& report = passes.report();
+        // in(4->16) + hidden(16->16) costs more merged (256 > 16 * 32),
+        // hidden(16->16) + out(16->2) merges, then in + merged merges.
+        EDGE_LEARNING_TEST_EQUAL(report.merged.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(report.layers_after, 1);
+        EDGE_LEARNING_TEST_EQUAL(opt.layers()[0]->input_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(opt.layers()[0]->output_size(), 2);
+
+        auto expected = m.predict(INPUT);
+        auto actual = opt.predict(INPUT);
+        EDGE_LEARNING_TEST_EQUAL(actual.size(), expected.size());
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(actual[i], expected[i], 1e-9);
+        }
+
+        // Expanding layers are not merged.
+        Model wide{"wide"};
+        auto w_in = wide.add_layer<DenseLayer>("in", 16, 2);
+        auto w_out = wide.add_layer<DenseLayer>("out", 2, 16);
+        wide.create_edge(w_in, w_out);
+        passes.run(wide);
+        EDGE_LEARNING_TEST_EQUAL(passes.report().merged.size(), 0);
+    }
+
+    void test_fused_layer()
+    {
+        auto dense = std::make_shared<DenseLayer>("dense", 4, 3);
+        dense->init(Layer::InitializationFunction::XAVIER,
+                    Layer::ProbabilityDensityFunction::NORMAL, RneType{SEED});
+        auto reference = std::static_pointer_cast<DenseLayer>(dense->clone());
+        TanhLayer tanh{"tanh", 3};
+        FusedLayer fused{"fused", dense, FusedLayer::Activation::TanH};
+        EDGE_LEARNING_TEST_EQUAL(fused.type(), "Fused");
+        EDGE_LEARNING_TEST_EQUAL(fused.param_count(), dense->param_count());
+        EDGE_LEARNING_TEST_EQUAL(fused.input_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(fused.output_size(), 3);
+
+        auto expected = tanh.training_forward(
+            reference->training_forward(INPUT));
+        auto actual = fused.training_forward(INPUT);
+        // The activation runs in place on the output of the dense layer.
+        EDGE_LEARNING_TEST_ASSERT(
+            fused.last_output().data() == dense->last_output().data());
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(actual[i], expected[i]);
+        }
+
+        std::vector<NumType> gradients = {0.1, -0.2, 0.3};
+        auto expected_in = reference->backward(tanh.backward(gradients));
+        auto actual_in = fused.backward(gradients);
+        EDGE_LEARNING_TEST_EQUAL(actual_in.size(), expected_in.size());
+        for (SizeType i = 0; i < expected_in.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(actual_in[i], expected_in[i], 1e-12);
+        }
+        for (SizeType i = 0; i < fused.param_count(); ++i)
+        {
+            // The reference shares the parameters and the gradients are
+            // accumulated twice on the same weights.
+            EDGE_LEARNING_TEST_WITHIN(
+                fused.gradient(i), reference->gradient(i), 1e-12);
+        }
+
+        auto copy = fused.clone();
+        EDGE_LEARNING_TEST_EQUAL(copy->param(0), fused.param(0));
+        Json dump;
+        EDGE_LEARNING_TEST_TRY(dump = fused.dump());
+        FusedLayer empty;
+        EDGE_LEARNING_TEST_THROWS(empty.load(dump), std::runtime_error);
+        FusedLayer loaded{"loaded", std::make_shared<DenseLayer>()};
+        EDGE_LEARNING_TEST_TRY(loaded.load(dump));
+        EDGE_LEARNING_TEST_WITHIN(loaded.param(0), fused.param(0), 1e-6);
+        EDGE_LEARNING_TEST_EQUAL(
+            static_cast<int>(loaded.activation()),
+            static_cast<int>(FusedLayer::Activation::TanH));
+        EDGE_LEARNING_TEST_EQUAL(loaded.input_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(loaded.output_size(), 3);
+    }
+
+    void test_fnn()
+    {
+        EdgeFeedforwardNeuralNetwork<LossType::MSE> fnn{"fnn"};
+        fnn.add(Input{"in", 4UL});
+        fnn.add(Dense{"hidden", 8UL, ActivationType::ReLU});
+        fnn.add(Dropout{"dropout", 0.5});
+        fnn.add(Dense{"out", 2UL, ActivationType::Linear});
+        Dataset<NumType>::Mat data = {
+            {0.5, -0.25, 1.0, 0.75, 0.1, 0.2},
+            {0.1,  0.2,  0.3, 0.4,  0.4, 0.3},
+        };
+        Dataset<NumType> dataset{data, 1, {4, 5}};
+        fnn.fit(dataset, OptimizerType::GRADIENT_DESCENT, 1, 1, 0.01, SEED);
+        const auto& report = fnn.optimization_report();
+        EDGE_LEARNING_TEST_EQUAL(report.layers_before, 6);
+        EDGE_LEARNING_TEST_EQUAL(report.removed.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(report.fused.size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(report.layers_after, 2);
+        Dataset<NumType> inputs{Dataset<NumType>::Mat{INPUT}};
+        auto prediction = fnn.predict(inputs);
+        EDGE_LEARNING_TEST_EQUAL(prediction.size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(prediction.feature_size(), 2);
+    }
+};
+
+int main() {
+    TestGraphPasses().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -0,0 +1,272 @@
+/***************************************************************************
+ *            dnn/test_gru.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/gru.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/mse_loss.hpp"
+#include "dnn/gd_optimizer.hpp"
+
+#include <cmath>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestGruLayer {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_layer());
+        EDGE_LEARNING_TEST_CALL(test_setter());
+        EDGE_LEARNING_TEST_CALL(test_gradients());
+        EDGE_LEARNING_TEST_CALL(test_stream());
+        EDGE_LEARNING_TEST_CALL(test_model());
+    }
+
+private:
+    const SizeType INPUT_SIZE  = 3;
+    const SizeType OUTPUT_SIZE = 2;
+    const SizeType HIDDEN_SIZE = 4;
+
+    void test_layer()
+    {
+        EDGE_LEARNING_TEST_EQUAL(GruLayer::TYPE, "Gru");
+        std::vector<NumType> v_empty;
+        EDGE_LEARNING_TEST_TRY(auto l = GruLayer("gru_layer_test"));
+        auto l_empty = GruLayer("gru_layer_test");
+        EDGE_LEARNING_TEST_EQUAL(l_empty.type(), "Gru");
+        EDGE_LEARNING_TEST_EQUAL(l_empty.param_count(), 0);
+        EDGE_LEARNING_TEST_TRY(l_empty.training_forward(v_empty));
+        EDGE_LEARNING_TEST_TRY(l_empty.backward(v_empty));
+        EDGE_LEARNING_TEST_THROWS(l_empty.param(0), std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(l_empty.gradient(0), std::runtime_error);
+        EDGE_LEARNING_TEST_ASSERT(!GruLayer().name().empty());
+
+        auto l = GruLayer("gru_layer_test",
+                           INPUT_SIZE, OUTPUT_SIZE, HIDDEN_SIZE, 2);
+        EDGE_LEARNING_TEST_EQUAL(l.input_size(), INPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(l.output_size(), OUTPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(l.hidden_size(), HIDDEN_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(
+            l.param_count(),
+            3 * HIDDEN_SIZE * (INPUT_SIZE + HIDDEN_SIZE + 2)
+            + OUTPUT_SIZE * (HIDDEN_SIZE + 1));
+        EDGE_LEARNING_TEST_TRY(
+            l.init(Layer::InitializationFunction::XAVIER,
+                   Layer::ProbabilityDensityFunction::NORMAL, RneType()));
+        EDGE_LEARNING_TEST_TRY(l.print());
+        EDGE_LEARNING_TEST_TRY(l.param(l.param_count() - 1));
+        EDGE_LEARNING_TEST_THROWS(l.param(l.param_count()),
+                                  std::runtime_error);
+
+        // Copies share the parameters.
+        GruLayer l_copy{l};
+        l.param(0) = 42.0;
+        EDGE_LEARNING_TEST_EQUAL(l_copy.param(0), 42.0);
+        EDGE_LEARNING_TEST_EQUAL(l.clone()->name(), l.name());
+
+        std::vector<NumType> v(INPUT_SIZE * 2);
+        EDGE_LEARNING_TEST_TRY(l.training_forward(v));
+        EDGE_LEARNING_TEST_EQUAL(l.last_output().size(), OUTPUT_SIZE * 2);
+        EDGE_LEARNING_TEST_THROWS(l.training_forward(v_empty),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(l.backward(v_empty), std::runtime_error);
+    }
+
+    void test_setter()
+    {
+        auto l = GruLayer("gru_layer_test",
+                           INPUT_SIZE, OUTPUT_SIZE, HIDDEN_SIZE, 1);
+        EDGE_LEARNING_TEST_THROWS(l.hidden_state({0, 1, 2, 3, 4}),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_TRY(l.hidden_state({0, 1, 2, 3}));
+        EDGE_LEARNING_TEST_TRY(l.time_steps(3));
+        EDGE_LEARNING_TEST_EQUAL(l.time_steps(), 3);
+        EDGE_LEARNING_TEST_EQUAL(l.last_output().size(), 3 * OUTPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(l.last_input_gradient().size(),
+                                 3 * INPUT_SIZE);
+        EDGE_LEARNING_TEST_CALL(l.input_shape(5));
+        EDGE_LEARNING_TEST_EQUAL(l.input_size(), 5);
+        EDGE_LEARNING_TEST_EQUAL(l.last_input_gradient().size(), 3 * 5);
+        EDGE_LEARNING_TEST_EQUAL(
+            l.param_count(),
+            3 * HIDDEN_SIZE * (5 + HIDDEN_SIZE + 2)
+            + OUTPUT_SIZE * (HIDDEN_SIZE + 1));
+    }
+
+    void test_gradients()
+    {
+        const NumType EPSILON = 1e-6;
+        const NumType TOLERANCE = 1e-6;
+        std::vector<NumType> initial_hidden{0.1, -0.2, 0.3, 0.05};
+
+        for (SizeType time_steps: {SizeType(1), SizeType(4)})
+        {
+            auto l = GruLayer("gru_layer_test",
+                               INPUT_SIZE, OUTPUT_SIZE, HIDDEN_SIZE,
+                               time_steps);
+            l.init(Layer::InitializationFunction::XAVIER,
+                   Layer::ProbabilityDensityFunction::NORMAL, RneType(7));
+            std::vector<NumType> inputs(INPUT_SIZE * time_steps);
+            std::vector<NumType> gradients(OUTPUT_SIZE * time_steps);
+            for (SizeType i = 0; i < inputs.size(); ++i)
+            {
+                inputs[i] = std::cos(static_cast<NumType>(i));
+            }
+            for (SizeType i = 0; i < gradients.size(); ++i)
+            {
+                gradients[i] = std::sin(static_cast<NumType>(i) + 1.0);
+            }
+
+            // Loss as the dot product between the outputs and the gradients.
+            auto loss = [&](const std::vector<NumType>& in) {
+                l.reset_hidden_state();
+                l.hidden_state(initial_hidden);
+                const auto& out = l.forward(in);
+                NumType ret = 0.0;
+                for (SizeType i = 0; i < out.size(); ++i)
+                {
+                    ret += out[i] * gradients[i];
+                }
+                return ret;
+            };
+
+            l.reset_hidden_state();
+            l.hidden_state(initial_hidden);
+            l.training_forward(inputs);
+            std::vector<NumType> input_gradients = l.backward(gradients);
+            EDGE_LEARNING_TEST_EQUAL(input_gradients.size(), inputs.size());
+
+            for (SizeType p = 0; p < l.param_count(); ++p)
+            {
+                NumType param = l.param(p);
+                l.param(p) = param + EPSILON;
+                NumType loss_plus = loss(inputs);
+                l.param(p) = param - EPSILON;
+                NumType loss_minus = loss(inputs);
+                l.param(p) = param;
+                EDGE_LEARNING_TEST_WITHIN(
+                    l.gradient(p), (loss_plus - loss_minus) / (2 * EPSILON),
+                    TOLERANCE);
+            }
+
+            for (SizeType i = 0; i < inputs.size(); ++i)
+            {
+                auto in = inputs;
+                in[i] = inputs[i] + EPSILON;
+                NumType loss_plus = loss(in);
+                in[i] = inputs[i] - EPSILON;
+                NumType loss_minus = loss(in);
+                EDGE_LEARNING_TEST_WITHIN(
+                    input_gradients[i],
+                    (loss_plus - loss_minus) / (2 * EPSILON), TOLERANCE);
+            }
+        }
+    }
+
+    void test_stream()
+    {
+        SizeType time_steps = 3;
+        auto l = GruLayer("gru_layer_test",
+                           INPUT_SIZE, OUTPUT_SIZE, HIDDEN_SIZE, time_steps);
+        l.init(Layer::InitializationFunction::XAVIER,
+               Layer::ProbabilityDensityFunction::NORMAL, RneType(3));
+        std::vector<NumType> inputs(INPUT_SIZE * time_steps, 0.5);
+        auto expected = l.forward(inputs);
+
+        Json l_dump;
+        EDGE_LEARNING_TEST_TRY(l_dump = l.dump());
+        EDGE_LEARNING_TEST_EQUAL(l_dump["type"].as<std::string>(), "Gru");
+        EDGE_LEARNING_TEST_EQUAL(l_dump["name"].as<std::string>(), l.name());
+        EDGE_LEARNING_TEST_EQUAL(
+            l_dump["others"]["hidden_size"].as<SizeType>(), HIDDEN_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(
+            l_dump["others"]["time_steps"].as<SizeType>(), time_steps);
+
+        auto l_load = GruLayer();
+        EDGE_LEARNING_TEST_TRY(l_load.load(l_dump));
+        EDGE_LEARNING_TEST_EQUAL(l_load.name(), l.name());
+        EDGE_LEARNING_TEST_EQUAL(l_load.input_size(), INPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(l_load.output_size(), OUTPUT_SIZE);
+        EDGE_LEARNING_TEST_EQUAL(l_load.param_count(), l.param_count());
+        auto out = l_load.forward(inputs);
+        for (SizeType i = 0; i < out.size(); ++i)
+        {
+            // Json dump keeps a limited amount of decimals.
+            EDGE_LEARNING_TEST_WITHIN(out[i], expected[i], 1e-4);
+        }
+    }
+
+    void test_model()
+    {
+        // Learn to output the input of the previous time step.
+        // The model needs a feedforward input layer.
+        SizeType time_steps = 5;
+        Model m{"gru_model"};
+        auto in_layer = m.add_layer<DenseLayer>("in", time_steps, time_steps);
+        auto l = m.add_layer<GruLayer>("gru", 1, 1, 8, time_steps);
+        auto loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", time_steps, 1, 1.0);
+        m.create_edge(in_layer, l);
+        m.create_loss_edge(l, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL,
+               static_cast<RneType::result_type>(11));
+        GradientDescentOptimizer o{NumType{0.05}};
+
+        RneType rne{5};
+        auto sample = [&](std::vector<NumType>& in, std::vector<NumType>& t) {
+            in.resize(time_steps);
+            t.resize(time_steps);
+            for (SizeType i = 0; i < time_steps; ++i)
+            {
+                in[i] = DLMath::rand<NumType>(-1.0, 1.0, rne);
+                t[i] = i == 0 ? 0.0 : in[i - 1];
+            }
+        };
+
+        std::vector<NumType> in, target;
+        NumType first_loss = 0.0;
+        NumType last_loss = 0.0;
+        for (SizeType e = 0; e < 400; ++e)
+        {
+            l->reset_hidden_state();
+            sample(in, target);
+            m.step(in, target);
+            m.train(o);
+            if (e < 20) first_loss += m.avg_loss();
+            if (e >= 380) last_loss += m.avg_loss();
+            m.reset_score();
+        }
+        EDGE_LEARNING_TEST_PRINT(first_loss);
+        EDGE_LEARNING_TEST_PRINT(last_loss);
+        EDGE_LEARNING_TEST_ASSERT(last_loss < first_loss);
+    }
+};
+
+int main() {
+    TestGruLayer().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
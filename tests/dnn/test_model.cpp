@@ -28,6 +28,9 @@
 #include "dnn/dense.hpp"
 #include "dnn/activation.hpp"
 #include "dnn/recurrent.hpp"
+#include "dnn/lstm.hpp"
+#include "dnn/gru.hpp"
+#include "dnn/convolutional.hpp"
 #include "dnn/cce_loss.hpp"
 #include "dnn/mse_loss.hpp"
 #include "dnn/gd_optimizer.hpp"
@@ -81,6 +84,10 @@ public:
         EDGE_LEARNING_TEST_CALL(test_regressor_model());
         EDGE_LEARNING_TEST_CALL(test_regressor_model_predict());
         EDGE_LEARNING_TEST_CALL(test_recursive_model());
+        EDGE_LEARNING_TEST_CALL(test_checkpointing());
+        EDGE_LEARNING_TEST_CALL(test_inference_only());
+        EDGE_LEARNING_TEST_CALL(test_stream_dump());
+        EDGE_LEARNING_TEST_CALL(test_stream_layers());
     }
 
 private:
@@ -415,6 +422,261 @@ private:
         }
     }
 
+    void test_checkpointing() {
+        const SizeType depth = 8;
+        std::vector<NumType> input = {10.0, 1.0, 8.0, 1.5};
+        std::vector<NumType> target = {1.0, 0.0};
+
+        Model m = _create_deep_model(depth);
+        m.init(Model::InitializationFunction::AUTO,
+               Model::ProbabilityDensityFunction::NORMAL, 42);
+        EDGE_LEARNING_TEST_ASSERT(
+            m.checkpointing() == Model::CheckpointPolicy::NONE);
+        EDGE_LEARNING_TEST_EQUAL(m.kept_layers().size(), m.layers().size());
+
+        // The copies share the parameters and own the gradients.
+        Model m_sqrt{m};
+        m_sqrt.checkpointing(Model::CheckpointPolicy::SQRT);
+        EDGE_LEARNING_TEST_ASSERT(
+            m_sqrt.checkpointing() == Model::CheckpointPolicy::SQRT);
+        Model m_manual{m};
+        m_manual.checkpoint(m_manual.layers()[depth]);
+        EDGE_LEARNING_TEST_ASSERT(
+            m_manual.checkpointing() == Model::CheckpointPolicy::MANUAL);
+        EDGE_LEARNING_TEST_THROWS(
+            m_manual.checkpoint(std::make_shared<DenseLayer>()),
+            std::runtime_error);
+
+        m.step(input, target);
+        auto full_size = m.activations_size();
+        auto expected = m.predict(input);
+        for (auto* c: {&m_sqrt, &m_manual})
+        {
+            EDGE_LEARNING_TEST_ASSERT(
+                c->kept_layers().size() < c->layers().size());
+            c->step(input, target);
+            EDGE_LEARNING_TEST_ASSERT(c->activations_size() < full_size);
+            for (SizeType l = 0; l < m.layers().size(); ++l)
+            {
+                auto layer = m.layers()[l];
+                for (SizeType i = 0; i < layer->param_count(); ++i)
+                {
+                    EDGE_LEARNING_TEST_WITHIN(c->layers()[l]->gradient(i),
+                                              layer->gradient(i), 1e-12);
+                }
+            }
+            auto prediction = c->predict(input);
+            EDGE_LEARNING_TEST_EQUAL(c->activations_size(), full_size);
+            EDGE_LEARNING_TEST_EQUAL(prediction.size(), expected.size());
+            for (SizeType i = 0; i < expected.size(); ++i)
+            {
+                EDGE_LEARNING_TEST_WITHIN(prediction[i], expected[i], 1e-12);
+            }
+        }
+
+        // A second step accumulates the gradients like a plain step.
+        m.step(input, target);
+        m_sqrt.step(input, target);
+        auto layer = m.layers()[0];
+        for (SizeType i = 0; i < layer->param_count(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(m_sqrt.layers()[0]->gradient(i),
+                                      layer->gradient(i), 1e-12);
+        }
+
+        m_sqrt.checkpointing(Model::CheckpointPolicy::NONE);
+        EDGE_LEARNING_TEST_EQUAL(m_sqrt.kept_layers().size(),
+                                 m_sqrt.layers().size());
+    }
+
+    void test_inference_only() {
+        std::vector<NumType> input = {10.0, 1.0, 8.0, 1.5};
+        std::vector<NumType> target = {1.0, 0.0};
+
+        Model m = _create_regressor_model();
+        m.init(Model::InitializationFunction::AUTO,
+               Model::ProbabilityDensityFunction::NORMAL, 7);
+        m.step(input, target);
+        EDGE_LEARNING_TEST_ASSERT(m.layers()[0]->gradients_allocated());
+        auto expected = m.predict(input);
+        std::ofstream out{std::filesystem::path{"inference_weight.json"},
+                          std::ios::trunc};
+        EDGE_LEARNING_TEST_TRY(m.dump(out));
+        out.close();
+
+        Model m_inference = _create_regressor_model();
+        std::ifstream in{std::filesystem::path{"inference_weight.json"}};
+        EDGE_LEARNING_TEST_TRY(m_inference.load(in, true));
+        in.close();
+        auto prediction = m_inference.predict(input);
+        for (const auto& layer: m_inference.layers())
+        {
+            EDGE_LEARNING_TEST_ASSERT(!layer->gradients_allocated());
+        }
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(prediction[i], expected[i], 1e-4);
+        }
+
+        // The training allocates the gradients again.
+        EDGE_LEARNING_TEST_TRY(m_inference.step(input, target));
+        EDGE_LEARNING_TEST_ASSERT(
+            m_inference.layers()[0]->gradients_allocated());
+        EDGE_LEARNING_TEST_TRY(m.free_gradients());
+        EDGE_LEARNING_TEST_ASSERT(!m.layers()[0]->gradients_allocated());
+    }
+
+    void test_stream_dump() {
+        std::vector<NumType> input = {10.0, 1.0, 8.0, 1.5};
+        Model m = _create_regressor_model();
+        m.init(Model::InitializationFunction::AUTO,
+               Model::ProbabilityDensityFunction::NORMAL, 11);
+        auto expected = m.predict(input);
+        std::ofstream out{std::filesystem::path{"stream_weight.json"},
+                          std::ios::trunc};
+        EDGE_LEARNING_TEST_TRY(m.dump(out));
+        out.close();
+
+        // The numbers are written with the shortest round trip format.
+        Model m_load = _create_regressor_model();
+        std::ifstream in{std::filesystem::path{"stream_weight.json"}};
+        EDGE_LEARNING_TEST_TRY(m_load.load(in));
+        in.close();
+        EDGE_LEARNING_TEST_EQUAL(m_load.name(), m.name());
+        for (SizeType l = 0; l < m.layers().size(); ++l)
+        {
+            for (SizeType p = 0; p < m.layers()[l]->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_EQUAL(m_load.layers()[l]->param(p),
+                                         m.layers()[l]->param(p));
+            }
+        }
+        auto prediction = m_load.predict(input);
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(prediction[i], expected[i]);
+        }
+
+        // The Json tree dump of the previous format is still loaded.
+        Json model;
+        model["name"] = m.name();
+        Json layers_json;
+        for (const auto& layer: m.layers())
+        {
+            layers_json.append(layer->dump());
+        }
+        model["layers"] = layers_json;
+        std::ofstream tree_out{std::filesystem::path{"tree_weight.json"},
+                               std::ios::trunc};
+        tree_out << model;
+        tree_out.close();
+        Model m_tree = _create_regressor_model();
+        std::ifstream tree_in{std::filesystem::path{"tree_weight.json"}};
+        EDGE_LEARNING_TEST_TRY(m_tree.load(tree_in));
+        tree_in.close();
+        prediction = m_tree.predict(input);
+        for (SizeType i = 0; i < expected.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(prediction[i], expected[i], 1e-4);
+        }
+
+        // A dump with less layers than the model is rejected.
+        Json partial;
+        partial["name"] = m.name();
+        Json partial_layers;
+        partial_layers.append(m.layers().front()->dump());
+        partial["layers"] = partial_layers;
+        std::ofstream partial_out{
+            std::filesystem::path{"partial_weight.json"}, std::ios::trunc};
+        partial_out << partial;
+        partial_out.close();
+        Model m_partial = _create_regressor_model();
+        std::ifstream partial_in{std::filesystem::path{"partial_weight.json"}};
+        EDGE_LEARNING_TEST_THROWS(m_partial.load(partial_in),
+                                  std::runtime_error);
+        partial_in.close();
+
+        // The streamed dump is still a valid Json document.
+        std::ifstream json_in{std::filesystem::path{"stream_weight.json"}};
+        Json parsed;
+        json_in >> parsed;
+        EDGE_LEARNING_TEST_EQUAL(parsed["name"].as<std::string>(), m.name());
+        EDGE_LEARNING_TEST_EQUAL(parsed["layers"].size(), m.layers().size());
+    }
+
+    void test_stream_layers() {
+        std::vector<Layer::SharedPtr> layers = {
+            std::make_shared<RecurrentLayer>("rnn", 3, 2, 4, 2),
+            std::make_shared<LstmLayer>("lstm", 3, 2, 4, 2),
+            std::make_shared<GruLayer>("gru", 3, 2, 4, 2),
+            std::make_shared<ConvolutionalLayer>(
+                "conv", DLMath::Shape3d{4, 4, 2}, DLMath::Shape2d{3, 2}, 3),
+        };
+        std::vector<Layer::SharedPtr> empty = {
+            std::make_shared<RecurrentLayer>(),
+            std::make_shared<LstmLayer>(),
+            std::make_shared<GruLayer>(),
+            std::make_shared<ConvolutionalLayer>(),
+        };
+        for (SizeType l = 0; l < layers.size(); ++l)
+        {
+            layers[l]->init(Layer::InitializationFunction::XAVIER,
+                            Layer::ProbabilityDensityFunction::UNIFORM,
+                            RneType{static_cast<RneType::result_type>(l)});
+            std::stringstream ss;
+            {
+                JsonWriter w{ss};
+                layers[l]->dump_stream(w);
+            }
+            JsonReader r{ss};
+            EDGE_LEARNING_TEST_TRY(empty[l]->load_stream(r));
+            EDGE_LEARNING_TEST_EQUAL(empty[l]->param_count(),
+                                     layers[l]->param_count());
+            for (SizeType p = 0; p < layers[l]->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_EQUAL(empty[l]->param(p),
+                                         layers[l]->param(p));
+            }
+
+            // Json dump: the biases come before the other fields.
+            std::stringstream tree;
+            tree << layers[l]->dump();
+            auto copy = layers[l]->clone();
+            copy->init(Layer::InitializationFunction::XAVIER,
+                       Layer::ProbabilityDensityFunction::UNIFORM,
+                       RneType{99});
+            JsonReader tree_r{tree};
+            EDGE_LEARNING_TEST_TRY(copy->load_stream(tree_r));
+            for (SizeType p = 0; p < layers[l]->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_WITHIN(copy->param(p),
+                                          layers[l]->param(p), 1e-5);
+            }
+        }
+    }
+
+    Model _create_deep_model(SizeType depth)
+    {
+        Model m{"deep"};
+        Layer::SharedPtr prev = m.add_layer<DenseLayer>("input", 4, 16);
+        for (SizeType i = 0; i < depth; ++i)
+        {
+            auto relu = m.add_layer<ReluLayer>(
+                "relu_" + std::to_string(i), 16);
+            auto dense = m.add_layer<DenseLayer>(
+                "dense_" + std::to_string(i), 16, 16);
+            m.create_edge(prev, relu);
+            m.create_edge(relu, dense);
+            prev = dense;
+        }
+        auto output_layer = m.add_layer<DenseLayer>("output", 16, 2);
+        auto loss_layer = m.add_loss<MeanSquaredLossLayer>(
+            "loss", 2, BATCH_SIZE, 0.5);
+        m.create_edge(prev, output_layer);
+        m.create_loss_edge(output_layer, loss_layer);
+        return m;
+    }
+
     Model _create_binary_classifier_model()
     {
         Model m{"binary_classifier"};
@@ -0,0 +1,266 @@
+/***************************************************************************
+ *            dnn/test_model_file.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/model_file.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/activation.hpp"
+#include "dnn/convolutional.hpp"
+#include "dnn/mse_loss.hpp"
+#include "dnn/gd_optimizer.hpp"
+
+#include <fstream>
+#include <iterator>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestModelFile {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_roundtrip());
+        EDGE_LEARNING_TEST_CALL(test_layout());
+        EDGE_LEARNING_TEST_CALL(test_train_after_load());
+        EDGE_LEARNING_TEST_CALL(test_convert());
+        EDGE_LEARNING_TEST_CALL(test_errors());
+    }
+
+private:
+    const RneType::result_type SEED = 3;
+    const std::vector<NumType> INPUT = {
+        0.5, -0.25, 1.0, 0.75, 0.1, -0.6, 0.3, 0.9, -1.0};
+    const std::vector<NumType> TARGET = {1.0, 0.0};
+
+    static Model _create_model(RneType::result_type seed)
+    {
+        Model m{"model_file"};
+        auto conv = m.add_layer<ConvolutionalLayer>(
+            "conv", DLMath::Shape3d{3, 3, 1}, DLMath::Shape2d{2, 2}, 2);
+        auto relu = m.add_layer<ReluLayer>("relu", 8);
+        auto hidden = m.add_layer<DenseLayer>("hidden", 8, 4);
+        auto out = m.add_layer<DenseLayer>("out", 4, 2);
+        std::shared_ptr<LossLayer> loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", 2, 1, 1.0);
+        m.create_edge(conv, relu);
+        m.create_edge(relu, hidden);
+        m.create_edge(hidden, out);
+        m.create_loss_edge(out, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, seed);
+        return m;
+    }
+
+    static std::string _read(const std::filesystem::path& path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        return {std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>()};
+    }
+
+    NumType _error(const std::vector<NumType>& output) const
+    {
+        NumType error = 0;
+        for (std::size_t i = 0; i < output.size(); ++i)
+        {
+            error += (output[i] - TARGET[i]) * (output[i] - TARGET[i]);
+        }
+        return error;
+    }
+
+    void test_roundtrip()
+    {
+        const std::filesystem::path path{"model_file_roundtrip.elmf"};
+        auto m = _create_model(SEED);
+        EDGE_LEARNING_TEST_TRY(ModelFile::dump(m, path));
+
+        auto loaded = _create_model(SEED + 1);
+        EDGE_LEARNING_TEST_TRY(ModelFile::load(loaded, path));
+        EDGE_LEARNING_TEST_EQUAL(loaded.name(), m.name());
+        auto expected = m.predict(INPUT);
+        auto output = loaded.predict(INPUT);
+        EDGE_LEARNING_TEST_EQUAL(output.size(), expected.size());
+        for (std::size_t i = 0; i < output.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(output[i], expected[i]);
+        }
+        for (std::size_t l = 0; l < m.layers().size(); ++l)
+        {
+            const auto& layer = m.layers()[l];
+            for (std::size_t p = 0; p < layer->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_EQUAL(
+                    loaded.layers()[l]->param(p), layer->param(p));
+            }
+        }
+
+        auto inference = _create_model(SEED + 1);
+        EDGE_LEARNING_TEST_TRY(ModelFile::load(inference, path, true));
+        for (const auto& layer: inference.layers())
+        {
+            EDGE_LEARNING_TEST_ASSERT(!layer->gradients_allocated());
+        }
+        output = inference.predict(INPUT);
+        for (std::size_t i = 0; i < output.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(output[i], expected[i]);
+        }
+    }
+
+    void test_layout()
+    {
+        const std::filesystem::path path{"model_file_layout.elmf"};
+        auto m = _create_model(SEED);
+        ModelFile::dump(m, path);
+        auto content = _read(path);
+        EDGE_LEARNING_TEST_ASSERT(content.size() > 4);
+        EDGE_LEARNING_TEST_EQUAL(content.substr(0, 4), "ELMF");
+
+        // The parameters of each layer are aligned and stored in the order
+        // of Layer::param.
+        auto loaded = _create_model(SEED + 1);
+        ModelFile::load(loaded, path);
+        for (const auto& layer: loaded.layers())
+        {
+            if (layer->param_count() == 0) continue;
+            auto* first = &layer->param(0);
+            EDGE_LEARNING_TEST_EQUAL(
+                reinterpret_cast<std::uintptr_t>(first)
+                    % ModelFile::ALIGNMENT, 0);
+            for (std::size_t p = 1; p < layer->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_EQUAL(&layer->param(p), first + p);
+            }
+        }
+    }
+
+    void test_train_after_load()
+    {
+        const std::filesystem::path path{"model_file_train.elmf"};
+        auto m = _create_model(SEED);
+        ModelFile::dump(m, path);
+        auto before = _read(path);
+
+        auto loaded = _create_model(SEED + 1);
+        ModelFile::load(loaded, path);
+        auto error_before = _error(loaded.predict(INPUT));
+        GradientDescentOptimizer o{NumType{0.1}};
+        for (int i = 0; i < 10; ++i)
+        {
+            loaded.step(INPUT, TARGET);
+            loaded.train(o);
+        }
+        EDGE_LEARNING_TEST_ASSERT(_error(loaded.predict(INPUT)) < error_before);
+        bool trained = false;
+        for (std::size_t p = 0; p < m.layers()[3]->param_count(); ++p)
+        {
+            trained |= loaded.layers()[3]->param(p) != m.layers()[3]->param(p);
+        }
+        EDGE_LEARNING_TEST_ASSERT(trained);
+
+        // The training writes private pages: the file is not modified.
+        EDGE_LEARNING_TEST_ASSERT(_read(path) == before);
+        auto reloaded = _create_model(SEED + 1);
+        ModelFile::load(reloaded, path);
+        for (std::size_t p = 0; p < m.layers()[3]->param_count(); ++p)
+        {
+            EDGE_LEARNING_TEST_EQUAL(
+                reloaded.layers()[3]->param(p), m.layers()[3]->param(p));
+        }
+    }
+
+    void test_convert()
+    {
+        const std::filesystem::path json_path{"model_file_convert.json"};
+        const std::filesystem::path path{"model_file_convert.elmf"};
+        auto m = _create_model(SEED);
+        {
+            std::ofstream out{json_path};
+            m.dump(out);
+        }
+
+        auto converter = _create_model(SEED + 1);
+        std::ifstream in{json_path};
+        EDGE_LEARNING_TEST_TRY(ModelFile::convert(converter, in, path));
+
+        auto loaded = _create_model(SEED + 2);
+        ModelFile::load(loaded, path);
+        auto expected = m.predict(INPUT);
+        auto output = loaded.predict(INPUT);
+        for (std::size_t i = 0; i < output.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_WITHIN(output[i], expected[i], 1e-4);
+        }
+    }
+
+    void test_errors()
+    {
+        const std::filesystem::path path{"model_file_errors.elmf"};
+        EDGE_LEARNING_TEST_THROWS(
+            ModelFile::load(*std::make_unique<Model>(), "missing.elmf"),
+            std::runtime_error);
+
+        {
+            std::ofstream out{path, std::ios::binary};
+            out << "JSON{}                                      ";
+        }
+        auto m = _create_model(SEED);
+        EDGE_LEARNING_TEST_THROWS(ModelFile::load(m, path),
+                                  std::runtime_error);
+
+        Model other{"other"};
+        auto in = other.add_layer<DenseLayer>("in", 9, 2);
+        std::shared_ptr<LossLayer> loss = other.add_loss<MeanSquaredLossLayer>(
+            "loss", 2, 1, 1.0);
+        other.create_loss_edge(in, loss);
+        other.init();
+        ModelFile::dump(other, path);
+        EDGE_LEARNING_TEST_THROWS(ModelFile::load(m, path),
+                                  std::runtime_error);
+
+        // Parameters aligned to NumType but not to ALIGNMENT.
+        ModelFile::dump(m, path);
+        auto content = _read(path);
+        auto key = content.find("\"offset\"");
+        EDGE_LEARNING_TEST_ASSERT(key != std::string::npos);
+        auto begin = content.find_first_of("0123456789", key);
+        auto end = content.find_first_not_of("0123456789", begin);
+        auto offset = std::stoull(content.substr(begin, end - begin));
+        auto misaligned = std::to_string(offset + sizeof(NumType));
+        EDGE_LEARNING_TEST_EQUAL(misaligned.size(), end - begin);
+        content.replace(begin, end - begin, misaligned);
+        {
+            std::ofstream out{path, std::ios::binary};
+            out << content;
+        }
+        EDGE_LEARNING_TEST_THROWS(ModelFile::load(m, path),
+                                  std::runtime_error);
+    }
+};
+
+int main() {
+    TestModelFile().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -0,0 +1,227 @@
+/***************************************************************************
+ *            dnn/test_pipeline.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/pipeline.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/activation.hpp"
+#include "dnn/mse_loss.hpp"
+#include "dnn/gd_optimizer.hpp"
+#include "data/dataset.hpp"
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestPipelineTrainer {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_trainer());
+        EDGE_LEARNING_TEST_CALL(test_equivalence());
+        EDGE_LEARNING_TEST_CALL(test_utilization());
+    }
+
+private:
+    const RneType::result_type SEED = 5;
+    const SizeType WIDTH = 8;
+
+    void test_trainer()
+    {
+        GradientDescentOptimizer o{NumType{0.01}};
+        Model empty{"empty"};
+        EDGE_LEARNING_TEST_THROWS(PipelineTrainer(empty, o, 2, 2),
+                                  std::runtime_error);
+
+        auto m = _create_model(4);
+        EDGE_LEARNING_TEST_THROWS(PipelineTrainer(m, o, 0, 2),
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(PipelineTrainer(m, o, 2, 0),
+                                  std::runtime_error);
+
+        PipelineTrainer trainer{m, o, 3, 4};
+        EDGE_LEARNING_TEST_EQUAL(trainer.stages(), 3);
+        EDGE_LEARNING_TEST_EQUAL(trainer.micro_batches(), 4);
+        SizeType layers = 0;
+        for (SizeType s = 0; s < trainer.stages(); ++s)
+        {
+            EDGE_LEARNING_TEST_ASSERT(!trainer.stage_layers(s).empty());
+            layers += trainer.stage_layers(s).size();
+        }
+        EDGE_LEARNING_TEST_EQUAL(layers, m.layers().size());
+        // The stages follow the forward order.
+        EDGE_LEARNING_TEST_EQUAL(trainer.stage_layers(0).front()->name(),
+                                 "l0");
+        EDGE_LEARNING_TEST_EQUAL(trainer.stage_layers(2).back()->name(),
+                                 "loss");
+
+        EDGE_LEARNING_TEST_THROWS(
+            trainer.train({{1.0}}, {}), std::runtime_error);
+
+        // More stages than layers are clamped.
+        auto small = _create_model(1);
+        PipelineTrainer small_trainer{small, o, 10, 2};
+        EDGE_LEARNING_TEST_EQUAL(small_trainer.stages(),
+                                 small.layers().size());
+    }
+
+    void test_equivalence()
+    {
+        // The pipeline accumulates the gradients of all the micro-batches
+        // before a single step, as a sequential batch.
+        const SizeType samples = 10;
+        std::vector<std::vector<NumType>> inputs;
+        std::vector<std::vector<NumType>> targets;
+        _batch(samples, inputs, targets);
+
+        auto m_seq = _create_model(4);
+        auto m_pipe = _create_model(4);
+        GradientDescentOptimizer o_seq{NumType{0.05}};
+        GradientDescentOptimizer o_pipe{NumType{0.05}};
+        PipelineTrainer trainer{m_pipe, o_pipe, 3, 4};
+
+        for (SizeType epoch = 0; epoch < 3; ++epoch)
+        {
+            m_seq.reset_score();
+            for (SizeType i = 0; i < samples; ++i)
+            {
+                m_seq.step(inputs[i], targets[i]);
+            }
+            m_seq.train(o_seq);
+            EDGE_LEARNING_TEST_TRY(trainer.train(inputs, targets));
+            EDGE_LEARNING_TEST_WITHIN(trainer.report().loss,
+                                      m_seq.avg_loss(), 1e-9);
+        }
+
+        for (SizeType l_idx = 0; l_idx < m_seq.layers().size(); ++l_idx)
+        {
+            auto l_seq = m_seq.layers()[l_idx];
+            auto l_pipe = m_pipe.layers()[l_idx];
+            for (SizeType p = 0; p < l_seq->param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_WITHIN(l_pipe->param(p), l_seq->param(p),
+                                          1e-9);
+            }
+        }
+
+        const auto& report = trainer.report();
+        EDGE_LEARNING_TEST_EQUAL(report.stages, 3);
+        EDGE_LEARNING_TEST_EQUAL(report.micro_batches, samples);
+        EDGE_LEARNING_TEST_EQUAL(report.rounds, 3);
+
+        // Training from a dataset.
+        Dataset<NumType>::Mat data;
+        for (SizeType i = 0; i < samples; ++i)
+        {
+            auto row = inputs[i];
+            row.insert(row.end(), targets[i].begin(), targets[i].end());
+            data.push_back(row);
+        }
+        std::set<SizeType> labels_idx;
+        for (SizeType i = 0; i < targets[0].size(); ++i)
+        {
+            labels_idx.insert(inputs[0].size() + i);
+        }
+        Dataset<NumType> dataset{data, 1, labels_idx};
+        EDGE_LEARNING_TEST_TRY(trainer.train(dataset));
+        EDGE_LEARNING_TEST_EQUAL(trainer.report().micro_batches, samples);
+    }
+
+    void test_utilization()
+    {
+        const SizeType samples = 32;
+        std::vector<std::vector<NumType>> inputs;
+        std::vector<std::vector<NumType>> targets;
+        _batch(samples, inputs, targets);
+
+        for (SizeType stages: {1UL, 2UL, 4UL})
+        {
+            auto m = _create_model(8, 64);
+            GradientDescentOptimizer o{NumType{0.01}};
+            PipelineTrainer trainer{m, o, stages, 8};
+            trainer.train(inputs, targets);
+            const auto& report = trainer.report();
+            auto utilization = report.utilization();
+            auto bubble = report.bubble();
+            auto ideal_bubble = report.ideal_bubble(8);
+            auto seconds = report.seconds;
+            EDGE_LEARNING_TEST_PRINT(stages);
+            EDGE_LEARNING_TEST_PRINT(seconds);
+            EDGE_LEARNING_TEST_PRINT(utilization);
+            EDGE_LEARNING_TEST_PRINT(bubble);
+            EDGE_LEARNING_TEST_PRINT(ideal_bubble);
+            EDGE_LEARNING_TEST_ASSERT(utilization > 0.0);
+            EDGE_LEARNING_TEST_ASSERT(utilization <= 1.0);
+            EDGE_LEARNING_TEST_WITHIN(
+                ideal_bubble,
+                double(stages - 1) / double(8 + stages - 1), 1e-12);
+        }
+    }
+
+    Model _create_model(SizeType hidden_layers, SizeType width = 0)
+    {
+        if (width == 0) width = WIDTH;
+        Model m{"pipeline"};
+        Layer::SharedPtr prev = m.add_layer<DenseLayer>("l0", 4, width);
+        for (SizeType i = 1; i < hidden_layers; ++i)
+        {
+            auto relu = m.add_layer<ReluLayer>(
+                "relu" + std::to_string(i), width);
+            auto dense = m.add_layer<DenseLayer>(
+                "l" + std::to_string(i), width, width);
+            m.create_edge(prev, relu);
+            m.create_edge(relu, dense);
+            prev = dense;
+        }
+        auto out = m.add_layer<DenseLayer>("out", width, 2);
+        std::shared_ptr<LossLayer> loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", 2, 1);
+        m.create_edge(prev, out);
+        m.create_loss_edge(out, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, SEED);
+        return m;
+    }
+
+    void _batch(SizeType samples,
+                std::vector<std::vector<NumType>>& inputs,
+                std::vector<std::vector<NumType>>& targets)
+    {
+        RneType rne{SEED};
+        inputs.clear();
+        targets.clear();
+        for (SizeType i = 0; i < samples; ++i)
+        {
+            std::vector<NumType> input(4);
+            for (auto& v: input) v = DLMath::rand<NumType>(-1.0, 1.0, rne);
+            inputs.push_back(input);
+            targets.push_back({input[0] * input[1], input[2] - input[3]});
+        }
+    }
+};
+
+int main() {
+    TestPipelineTrainer().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -38,6 +38,8 @@ public:
         EDGE_LEARNING_TEST_CALL(test_getter());
         EDGE_LEARNING_TEST_CALL(test_setter());
         EDGE_LEARNING_TEST_CALL(test_stream());
+        EDGE_LEARNING_TEST_CALL(test_step());
+        EDGE_LEARNING_TEST_CALL(test_gradients());
     }
 
 private:
@@ -365,6 +367,152 @@ private:
         EDGE_LEARNING_TEST_EQUAL(l_dump["others"]["time_steps"].as<SizeType>(),
                                  time_steps);
     }
+
+    void test_step()
+    {
+        SizeType hidden_size = 4;
+        SizeType time_steps = 5;
+        SizeType input_size = 3;
+        SizeType output_size = 2;
+        auto l = RecurrentLayer("recurrent_layer_test",
+                                input_size, output_size, hidden_size,
+                                time_steps);
+        l.init(Layer::InitializationFunction::XAVIER,
+               Layer::ProbabilityDensityFunction::NORMAL, RneType(42));
+        // The copy shares the parameters and owns the hidden state.
+        RecurrentLayer l_stream{l};
+
+        std::vector<NumType> sequence(input_size * (time_steps + 1));
+        for (SizeType i = 0; i < sequence.size(); ++i)
+        {
+            sequence[i] = std::sin(static_cast<NumType>(i));
+        }
+        std::vector<NumType> window(
+            sequence.begin(),
+            sequence.begin() + static_cast<std::int64_t>(input_size * time_steps));
+        auto expected = l.forward(window);
+
+        EDGE_LEARNING_TEST_THROWS(l_stream.step({}), std::runtime_error);
+
+        // Step by step gives the same outputs of the whole window.
+        l_stream.reset_hidden_state();
+        for (SizeType t = 0; t < time_steps; ++t)
+        {
+            std::vector<NumType> x(
+                sequence.begin() + static_cast<std::int64_t>(t * input_size),
+                sequence.begin() + static_cast<std::int64_t>((t + 1) * input_size));
+            const auto& out = l_stream.step(x);
+            EDGE_LEARNING_TEST_EQUAL(out.size(), output_size);
+            for (SizeType i = 0; i < output_size; ++i)
+            {
+                EDGE_LEARNING_TEST_EQUAL(out[i],
+                                         expected[t * output_size + i]);
+            }
+        }
+
+        // The stream continues from the last hidden state of the window.
+        std::vector<NumType> next(
+            sequence.begin() + static_cast<std::int64_t>(time_steps * input_size),
+            sequence.end());
+        auto expected_next = l.step(next);
+        auto out_next = l_stream.step(next);
+        for (SizeType i = 0; i < output_size; ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(out_next[i], expected_next[i]);
+        }
+
+        // Reset starts a new session.
+        std::vector<NumType> first(
+            sequence.begin(),
+            sequence.begin() + static_cast<std::int64_t>(input_size));
+        l_stream.reset_hidden_state();
+        auto out_first = l_stream.step(first);
+        for (SizeType i = 0; i < output_size; ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(out_first[i], expected[i]);
+        }
+    }
+
+    void test_gradients()
+    {
+        const NumType EPSILON = 1e-6;
+        const NumType TOLERANCE = 1e-6;
+        SizeType hidden_size = 4;
+        SizeType input_size = 3;
+        SizeType output_size = 2;
+        std::vector<NumType> initial_state{0.1, -0.2, 0.3, 0.05};
+
+        for (SizeType time_steps: {SizeType(1), SizeType(3)})
+        {
+            auto l = RecurrentLayer("recurrent_layer_test",
+                                    input_size, output_size, hidden_size,
+                                    time_steps);
+            l.init(Layer::InitializationFunction::XAVIER,
+                   Layer::ProbabilityDensityFunction::NORMAL, RneType(7));
+            std::vector<NumType> inputs(input_size * time_steps);
+            std::vector<NumType> gradients(output_size * time_steps);
+            for (SizeType i = 0; i < inputs.size(); ++i)
+            {
+                inputs[i] = std::cos(static_cast<NumType>(i));
+            }
+            for (SizeType i = 0; i < gradients.size(); ++i)
+            {
+                gradients[i] = std::sin(static_cast<NumType>(i) + 1.0);
+            }
+
+            // Loss as the dot product between the outputs and the gradients.
+            auto loss = [&](const std::vector<NumType>& in) {
+                l.reset_hidden_state();
+                l.hidden_state(initial_state);
+                const auto& out = l.forward(in);
+                NumType ret = 0.0;
+                for (SizeType i = 0; i < out.size(); ++i)
+                {
+                    ret += out[i] * gradients[i];
+                }
+                return ret;
+            };
+
+            l.reset_hidden_state();
+            l.hidden_state(initial_state);
+            l.training_forward(inputs);
+            std::vector<NumType> input_gradients = l.backward(gradients);
+            EDGE_LEARNING_TEST_EQUAL(input_gradients.size(), inputs.size());
+
+            for (SizeType p = 0; p < l.param_count(); ++p)
+            {
+                NumType param = l.param(p);
+                l.param(p) = param + EPSILON;
+                NumType loss_plus = loss(inputs);
+                l.param(p) = param - EPSILON;
+                NumType loss_minus = loss(inputs);
+                l.param(p) = param;
+                EDGE_LEARNING_TEST_WITHIN(
+                    l.gradient(p), (loss_plus - loss_minus) / (2 * EPSILON),
+                    TOLERANCE);
+            }
+
+            for (SizeType i = 0; i < inputs.size(); ++i)
+            {
+                auto in = inputs;
+                in[i] = inputs[i] + EPSILON;
+                NumType loss_plus = loss(in);
+                in[i] = inputs[i] - EPSILON;
+                NumType loss_minus = loss(in);
+                EDGE_LEARNING_TEST_WITHIN(
+                    input_gradients[i],
+                    (loss_plus - loss_minus) / (2 * EPSILON), TOLERANCE);
+            }
+
+            std::vector<NumType> short_inputs(input_size * time_steps - 1);
+            EDGE_LEARNING_TEST_THROWS(l.forward(short_inputs),
+                                      std::runtime_error);
+            std::vector<NumType> short_gradients(
+                output_size * time_steps - 1);
+            EDGE_LEARNING_TEST_THROWS(l.backward(short_gradients),
+                                      std::runtime_error);
+        }
+    }
 };
 
 int main() {
@@ -0,0 +1,212 @@
+/***************************************************************************
+ *            dnn/test_tbptt.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "dnn/tbptt.hpp"
+#include "dnn/model.hpp"
+#include "dnn/dense.hpp"
+#include "dnn/lstm.hpp"
+#include "dnn/recurrent.hpp"
+#include "dnn/mse_loss.hpp"
+#include "dnn/gd_optimizer.hpp"
+#include "data/dataset.hpp"
+
+#include <cmath>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestTruncatedBpttTrainer {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_trainer());
+        EDGE_LEARNING_TEST_CALL(test_equivalence());
+        EDGE_LEARNING_TEST_CALL(test_long_stream());
+    }
+
+private:
+    const SizeType CHUNK_STEPS = 4;
+    const SizeType HIDDEN_SIZE = 8;
+    const RneType::result_type SEED = 11;
+
+    void test_trainer()
+    {
+        GradientDescentOptimizer o{NumType{0.01}};
+        Model m_dense{"dense"};
+        m_dense.add_layer<DenseLayer>("in", 1, 1);
+        EDGE_LEARNING_TEST_THROWS(
+            TruncatedBpttTrainer(m_dense, o, CHUNK_STEPS),
+            std::runtime_error);
+
+        auto m = _create_model();
+        EDGE_LEARNING_TEST_THROWS(TruncatedBpttTrainer(m, o, 0),
+                                  std::runtime_error);
+        TruncatedBpttTrainer trainer{m, o, CHUNK_STEPS};
+        EDGE_LEARNING_TEST_EQUAL(trainer.chunk_steps(), CHUNK_STEPS);
+        auto lstm = std::dynamic_pointer_cast<LstmLayer>(m.layers()[0]);
+        EDGE_LEARNING_TEST_EQUAL(lstm->time_steps(), CHUNK_STEPS);
+
+        for (SizeType t = 0; t < CHUNK_STEPS - 1; ++t)
+        {
+            EDGE_LEARNING_TEST_ASSERT(!trainer.push({0.5}, {0.5}));
+        }
+        EDGE_LEARNING_TEST_EQUAL(trainer.pending_steps(), CHUNK_STEPS - 1);
+        EDGE_LEARNING_TEST_ASSERT(trainer.push({0.5}, {0.5}));
+        EDGE_LEARNING_TEST_EQUAL(trainer.pending_steps(), 0);
+        EDGE_LEARNING_TEST_EQUAL(trainer.trained_chunks(), 1);
+        EDGE_LEARNING_TEST_THROWS(trainer.push({0.5, 0.5}, {0.5}),
+                                  std::runtime_error);
+
+        trainer.push({0.5}, {0.5});
+        EDGE_LEARNING_TEST_EQUAL(trainer.pending_steps(), 1);
+        EDGE_LEARNING_TEST_TRY(trainer.reset());
+        EDGE_LEARNING_TEST_EQUAL(trainer.pending_steps(), 0);
+    }
+
+    void test_equivalence()
+    {
+        // The trainer behaves like a step per chunk with the hidden state
+        // carried between the chunks.
+        GradientDescentOptimizer o{NumType{0.01}};
+        auto m_trainer = _create_model();
+        auto m_manual = _create_model();
+        TruncatedBpttTrainer trainer{m_trainer, o, CHUNK_STEPS};
+        std::dynamic_pointer_cast<LstmLayer>(m_manual.layers()[0])
+            ->time_steps(CHUNK_STEPS);
+
+        std::vector<NumType> input, target;
+        _stream(3 * CHUNK_STEPS, input, target);
+        for (SizeType t = 0; t < input.size(); ++t)
+        {
+            trainer.push({input[t]}, {target[t]});
+        }
+        for (SizeType c = 0; c < 3; ++c)
+        {
+            auto begin = static_cast<std::int64_t>(c * CHUNK_STEPS);
+            auto end = static_cast<std::int64_t>((c + 1) * CHUNK_STEPS);
+            m_manual.step({input.begin() + begin, input.begin() + end},
+                          {target.begin() + begin, target.begin() + end});
+            m_manual.train(o);
+        }
+
+        for (SizeType l = 0; l < m_manual.layers().size(); ++l)
+        {
+            auto& l_trainer = *m_trainer.layers()[l];
+            auto& l_manual = *m_manual.layers()[l];
+            for (SizeType p = 0; p < l_manual.param_count(); ++p)
+            {
+                EDGE_LEARNING_TEST_EQUAL(l_trainer.param(p),
+                                         l_manual.param(p));
+            }
+        }
+    }
+
+    void test_long_stream()
+    {
+        // Learn to output the input of the previous time step on a stream
+        // much longer than the chunk: the dependency crosses the chunks.
+        SizeType stream_size = 2000;
+        GradientDescentOptimizer o{NumType{0.05}};
+        auto m = _create_model();
+        TruncatedBpttTrainer trainer{m, o, CHUNK_STEPS};
+        auto lstm = std::dynamic_pointer_cast<LstmLayer>(m.layers()[0]);
+
+        std::vector<NumType> input, target;
+        _stream(stream_size, input, target);
+        std::vector<NumType> stream(stream_size * 2);
+        for (SizeType t = 0; t < stream_size; ++t)
+        {
+            stream[t * 2] = input[t];
+            stream[t * 2 + 1] = target[t];
+        }
+        Dataset<NumType> data{stream, 2};
+        data.label_idx({1});
+
+        NumType first_loss = 0.0;
+        NumType last_loss = 0.0;
+        SizeType chunks = 0;
+        for (SizeType t = 0; t < data.size(); ++t)
+        {
+            if (trainer.push(data.input(t), data.label(t)))
+            {
+                if (chunks < 50) first_loss += m.avg_loss();
+                if (chunks >= stream_size / CHUNK_STEPS - 50)
+                {
+                    last_loss += m.avg_loss();
+                }
+                m.reset_score();
+                ++chunks;
+            }
+            // The memory is bounded by the chunk.
+            EDGE_LEARNING_TEST_ASSERT(
+                lstm->last_output().size() == CHUNK_STEPS);
+        }
+        EDGE_LEARNING_TEST_EQUAL(chunks, stream_size / CHUNK_STEPS);
+        EDGE_LEARNING_TEST_EQUAL(trainer.trained_chunks(), chunks);
+        EDGE_LEARNING_TEST_PRINT(first_loss);
+        EDGE_LEARNING_TEST_PRINT(last_loss);
+        EDGE_LEARNING_TEST_ASSERT(last_loss < first_loss);
+
+        // Stream interface with an incomplete chunk at the end.
+        trainer.reset();
+        auto tail = Dataset<NumType>{
+            std::vector<NumType>(stream.begin(), stream.begin() + 2 * 10), 2};
+        tail.label_idx({1});
+        EDGE_LEARNING_TEST_EQUAL(trainer.train(tail), 10 / CHUNK_STEPS);
+        EDGE_LEARNING_TEST_EQUAL(trainer.pending_steps(), 10 % CHUNK_STEPS);
+    }
+
+    Model _create_model()
+    {
+        // The stream feeds the recurrent layer directly, one value per time
+        // step, so the only memory of the past steps is the hidden state.
+        Model m{"tbptt"};
+        auto lstm = m.add_layer<LstmLayer>("lstm", 1, 1, HIDDEN_SIZE, 1);
+        auto loss = m.add_loss<MeanSquaredLossLayer>(
+            "loss", CHUNK_STEPS, 1, 1.0);
+        m.create_loss_edge(lstm, loss);
+        m.init(Model::InitializationFunction::XAVIER,
+               Model::ProbabilityDensityFunction::NORMAL, SEED);
+        return m;
+    }
+
+    void _stream(SizeType size, std::vector<NumType>& input,
+                 std::vector<NumType>& target)
+    {
+        RneType rne{SEED};
+        input.resize(size);
+        target.resize(size);
+        for (SizeType t = 0; t < size; ++t)
+        {
+            input[t] = DLMath::rand<NumType>(-1.0, 1.0, rne);
+            target[t] = t == 0 ? 0.0 : input[t - 1];
+        }
+    }
+};
+
+int main() {
+    TestTruncatedBpttTrainer().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -0,0 +1,247 @@
+/***************************************************************************
+ *            middleware/test_rnn.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "middleware/rnn.hpp"
+
+#include <cmath>
+
+using namespace std;
+using namespace EdgeLearning;
+
+
+class TestRNN {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_bucket());
+        EDGE_LEARNING_TEST_CALL(test_fit());
+        EDGE_LEARNING_TEST_CALL(test_padding());
+        EDGE_LEARNING_TEST_CALL(test_uneven_buckets());
+        EDGE_LEARNING_TEST_CALL(test_predict());
+    }
+
+private:
+    const RneType::result_type SEED = 7;
+
+    void test_bucket()
+    {
+        std::vector<SizeType> lengths{5, 2, 9, 2, 5, 3};
+        auto buckets = bucket_by_length(lengths, 2);
+        EDGE_LEARNING_TEST_EQUAL(buckets.size(), 3);
+        EDGE_LEARNING_TEST_ASSERT(
+            (buckets[0] == std::vector<SizeType>{1, 3}));
+        EDGE_LEARNING_TEST_ASSERT(
+            (buckets[1] == std::vector<SizeType>{5, 0}));
+        EDGE_LEARNING_TEST_ASSERT(
+            (buckets[2] == std::vector<SizeType>{4, 2}));
+
+        buckets = bucket_by_length(lengths, 4);
+        EDGE_LEARNING_TEST_EQUAL(buckets.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(buckets[1].size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(bucket_by_length(lengths, 0).size(),
+                                 lengths.size());
+        EDGE_LEARNING_TEST_ASSERT(bucket_by_length({}, 2).empty());
+    }
+
+    void test_fit()
+    {
+        std::vector<std::vector<NumType>> inputs, labels;
+        _echo_sequences(64, 2, 12, inputs, labels);
+
+        EdgeRecurrentNeuralNetwork<RecurrentType::LSTM> m{
+            "echo", 1, 1, 8};
+        EDGE_LEARNING_TEST_EQUAL(m.input_size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(m.output_size(), 1);
+        EDGE_LEARNING_TEST_THROWS(
+            m.fit(inputs, {labels[0]}), std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(
+            m.fit({{1.0, 2.0}}, {{1.0}}), std::runtime_error);
+
+        auto first = m.fit(inputs, labels, OptimizerType::ADAM,
+                           1, 8, 0.01, SEED);
+        EDGE_LEARNING_TEST_EQUAL(first.sequences, inputs.size());
+        EDGE_LEARNING_TEST_EQUAL(first.buckets, inputs.size() / 8);
+        EDGE_LEARNING_TEST_ASSERT(first.padding_efficiency() <= 1.0);
+        EDGE_LEARNING_TEST_ASSERT(first.sequences_per_second() > 0.0);
+        auto last = m.fit(inputs, labels, OptimizerType::ADAM,
+                          20, 8, 0.01, SEED);
+        EDGE_LEARNING_TEST_PRINT(first.loss);
+        EDGE_LEARNING_TEST_PRINT(last.loss);
+        EDGE_LEARNING_TEST_ASSERT(last.loss < first.loss);
+        EDGE_LEARNING_TEST_EQUAL(last.sequences, 20 * inputs.size());
+
+        // Length buckets waste less padding than a single batch.
+        EdgeRecurrentNeuralNetwork<RecurrentType::GRU> m_gru{
+            "echo", 1, 1, 8};
+        auto bucketed = m_gru.fit(inputs, labels, OptimizerType::ADAM,
+                                  1, 8, 0.01, SEED);
+        auto single = m_gru.fit(inputs, labels, OptimizerType::ADAM,
+                                1, inputs.size(), 0.01, SEED);
+        EDGE_LEARNING_TEST_EQUAL(bucketed.real_steps, single.real_steps);
+        EDGE_LEARNING_TEST_PRINT(bucketed.padding_efficiency());
+        EDGE_LEARNING_TEST_PRINT(single.padding_efficiency());
+        EDGE_LEARNING_TEST_PRINT(bucketed.sequences_per_second());
+        EDGE_LEARNING_TEST_PRINT(single.sequences_per_second());
+        EDGE_LEARNING_TEST_ASSERT(
+            bucketed.padding_efficiency() > single.padding_efficiency());
+    }
+
+    void test_padding()
+    {
+        // The padded time steps of a short sequence do not contribute to the
+        // gradients: training on the padded bucket equals training on the
+        // short sequence explicitly extended with zero-loss time steps. The
+        // gradients are averaged over the real time steps, 6 and 8, hence
+        // the learning rate of the extended training is scaled by 8 / 6.
+        std::vector<NumType> s_in{0.5, -0.3};
+        std::vector<NumType> s_label{0.1, 0.2};
+        std::vector<NumType> l_in{0.2, 0.7, -0.1, 0.4};
+        std::vector<NumType> l_label{0.0, 0.2, 0.7, -0.1};
+
+        EdgeRecurrentNeuralNetwork<RecurrentType::Simple> m_bucket{
+            "bucket", 1, 1, 4};
+        EdgeRecurrentNeuralNetwork<RecurrentType::Simple> m_extended{
+            "extended", 1, 1, 4};
+        m_bucket.fit({}, {}, OptimizerType::GRADIENT_DESCENT,
+                     0, 2, 0.1, SEED);
+        m_extended.fit({}, {}, OptimizerType::GRADIENT_DESCENT,
+                       0, 2, 0.1, SEED);
+
+        std::vector<NumType> e_in{0.5, -0.3, 0.0, 0.0};
+        auto e_label = m_extended.predict({e_in})[0];
+        e_label[0] = s_label[0];
+        e_label[1] = s_label[1];
+
+        m_bucket.fit({s_in, l_in}, {s_label, l_label},
+                     OptimizerType::GRADIENT_DESCENT, 1, 2, 0.1, SEED);
+        EDGE_LEARNING_TEST_EQUAL(m_bucket.report().real_steps, 6);
+        EDGE_LEARNING_TEST_EQUAL(m_bucket.report().padded_steps, 8);
+        m_extended.fit({e_in, l_in}, {e_label, l_label},
+                       OptimizerType::GRADIENT_DESCENT, 1, 2, 0.1 * 8.0 / 6.0,
+                       SEED);
+
+        auto& l_bucket = m_bucket.layer();
+        auto& l_extended = m_extended.layer();
+        for (SizeType p = 0; p < l_bucket.param_count(); ++p)
+        {
+            EDGE_LEARNING_TEST_WITHIN(l_bucket.param(p),
+                                      l_extended.param(p), 1e-12);
+        }
+    }
+
+    void test_uneven_buckets()
+    {
+        // 3 sequences in buckets of 2: the last bucket has 1 sequence and it
+        // is scaled by its own time steps, like a training on it alone.
+        std::vector<std::vector<NumType>> inputs, labels;
+        _echo_sequences(3, 1, 6, inputs, labels);
+        auto buckets = bucket_by_length(_lengths(inputs), 2);
+        EDGE_LEARNING_TEST_EQUAL(buckets.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(buckets[1].size(), 1);
+
+        EdgeRecurrentNeuralNetwork<RecurrentType::Simple> m_uneven{
+            "uneven", 1, 1, 4};
+        EdgeRecurrentNeuralNetwork<RecurrentType::Simple> m_split{
+            "split", 1, 1, 4};
+        m_uneven.fit(inputs, labels, OptimizerType::GRADIENT_DESCENT,
+                     1, 2, 0.1, SEED);
+        EDGE_LEARNING_TEST_EQUAL(m_uneven.report().buckets, 2);
+        m_split.fit({inputs[buckets[0][0]], inputs[buckets[0][1]]},
+                    {labels[buckets[0][0]], labels[buckets[0][1]]},
+                    OptimizerType::GRADIENT_DESCENT, 1, 2, 0.1, SEED);
+        m_split.fit({inputs[buckets[1][0]]}, {labels[buckets[1][0]]},
+                    OptimizerType::GRADIENT_DESCENT, 1, 1, 0.1, SEED);
+
+        auto& l_uneven = m_uneven.layer();
+        auto& l_split = m_split.layer();
+        for (SizeType p = 0; p < l_uneven.param_count(); ++p)
+        {
+            EDGE_LEARNING_TEST_WITHIN(l_uneven.param(p),
+                                      l_split.param(p), 1e-12);
+        }
+    }
+
+    void test_predict()
+    {
+        std::vector<std::vector<NumType>> inputs, labels;
+        _echo_sequences(16, 1, 6, inputs, labels);
+        EdgeRecurrentNeuralNetwork<RecurrentType::LSTM> m{"echo", 1, 1, 4};
+        m.fit(inputs, labels, OptimizerType::ADAM, 1, 4, 0.01, SEED);
+
+        auto out = m.predict(inputs);
+        EDGE_LEARNING_TEST_EQUAL(out.size(), inputs.size());
+        for (SizeType i = 0; i < inputs.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(out[i].size(), inputs[i].size());
+        }
+        EDGE_LEARNING_TEST_EQUAL(m.report().sequences, inputs.size());
+        EDGE_LEARNING_TEST_WITHIN(m.report().padding_efficiency(), 1.0,
+                                  1e-12);
+
+        // Predictions are independent from the other sequences.
+        auto single = m.predict({inputs[3]});
+        for (SizeType t = 0; t < single[0].size(); ++t)
+        {
+            EDGE_LEARNING_TEST_WITHIN(single[0][t], out[3][t], 1e-12);
+        }
+    }
+
+    std::vector<SizeType> _lengths(
+        const std::vector<std::vector<NumType>>& inputs)
+    {
+        std::vector<SizeType> lengths;
+        for (const auto& in: inputs) lengths.push_back(in.size());
+        return lengths;
+    }
+
+    /**
+     * \brief Sequences of random length where the label is the input of the
+     * previous time step.
+     */
+    void _echo_sequences(SizeType amount, SizeType min_len, SizeType max_len,
+                         std::vector<std::vector<NumType>>& inputs,
+                         std::vector<std::vector<NumType>>& labels)
+    {
+        RneType rne{SEED};
+        std::uniform_int_distribution<SizeType> len_dist{min_len, max_len};
+        inputs.resize(amount);
+        labels.resize(amount);
+        for (SizeType i = 0; i < amount; ++i)
+        {
+            auto len = len_dist(rne);
+            inputs[i].resize(len);
+            labels[i].resize(len);
+            for (SizeType t = 0; t < len; ++t)
+            {
+                inputs[i][t] = DLMath::rand<NumType>(-1.0, 1.0, rne);
+                labels[i][t] = t == 0 ? 0.0 : inputs[i][t - 1];
+            }
+        }
+    }
+};
+
+int main() {
+    TestRNN().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -42,6 +42,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_cifar10());
         EDGE_LEARNING_TEST_CALL(test_cifar100());
         EDGE_LEARNING_TEST_CALL(test_dataset_parser());
+        EDGE_LEARNING_TEST_CALL(test_entries());
     }
 private:
     const std::string FIRST10_CIFAR10_BATCH1_FN = "first10_data_batch_1.bin";
@@ -366,6 +367,44 @@ private:
             cifar100.height() *  cifar100.width() * cifar100.channels() + 1);
         EDGE_LEARNING_TEST_EQUAL(cifar100.labels_idx().size(), 1);
     }
+
+    void test_entries() {
+        EDGE_LEARNING_TEST_THROWS(
+            Cifar(CIFAR_RESOURCE_ROOT / "missing.bin", CIFAR10_META_FP),
+            std::runtime_error);
+
+        for (auto order: {CifarShapeOrder::CHN_ROW_COL,
+                          CifarShapeOrder::ROW_COL_CHN})
+        {
+            auto cifar = Cifar(
+                FIRST10_CIFAR100_TRAIN_FP, CIFAR100_COARSE_META_FP,
+                order, CifarDataset::CIFAR_100, CIFAR100_FINE_META_FP);
+            const auto fsize = cifar.feature_size();
+            EDGE_LEARNING_TEST_EQUAL(cifar.image_data(1)[0],
+                                     cifar.image(1).data()[0]);
+
+            // The batch file contains only the first 10 entries.
+            std::vector<std::uint8_t> data(cifar.entries_amount() * fsize);
+            EDGE_LEARNING_TEST_TRY(cifar.entries(data.data()));
+            bool equal = true;
+            for (std::size_t i = 0; i < 11; ++i)
+            {
+                auto image = cifar.image(i).data();
+                auto label = cifar.label(i).fine_label();
+                auto entry = cifar.entry(i);
+                for (std::size_t j = 0; j < Cifar::IMAGE_BYTES; ++j)
+                {
+                    equal = equal && data[i * fsize + j] == image[j]
+                        && entry[j] == image[j];
+                }
+                equal = equal && data[i * fsize + Cifar::IMAGE_BYTES] == label
+                    && entry[Cifar::IMAGE_BYTES] == label;
+            }
+            EDGE_LEARNING_TEST_ASSERT(equal);
+            EDGE_LEARNING_TEST_EQUAL(
+                static_cast<int>(data[10 * fsize + Cifar::IMAGE_BYTES]), 0);
+        }
+    }
 };
 
 int main() {
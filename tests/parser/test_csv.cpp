@@ -28,6 +28,7 @@
 
 #include <vector>
 #include <stdexcept>
+#include <fstream>
 
 using namespace std;
 using namespace EdgeLearning;
@@ -39,6 +40,9 @@ public:
         EDGE_LEARNING_TEST_CALL(test_csv_row());
         EDGE_LEARNING_TEST_CALL(test_csv());
         EDGE_LEARNING_TEST_CALL(test_csv_iterator(10));
+        EDGE_LEARNING_TEST_CALL(test_csv_lines());
+        EDGE_LEARNING_TEST_CALL(test_csv_entries());
+        EDGE_LEARNING_TEST_CALL(test_csv_types_sample());
         EDGE_LEARNING_TEST_CALL(test_dataset_parser());
     }
 
@@ -243,6 +247,123 @@ private:
         EDGE_LEARNING_TEST_ASSERT(iterator_cpy1 == iterator_cpy3);
     }
 
+    void test_csv_lines() {
+        const std::filesystem::path fp{"csv_lines.csv"};
+        std::ofstream out{fp, std::ios::trunc};
+        out << "a,b\n1,2\n\n3,4\n5,6";
+        out.close();
+
+        auto lines = CSVLines{fp.string()};
+        EDGE_LEARNING_TEST_EQUAL(lines.size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(lines[0], "a,b");
+        EDGE_LEARNING_TEST_EQUAL(lines[3], "3,4");
+        EDGE_LEARNING_TEST_EQUAL(lines[1], "1,2");
+        EDGE_LEARNING_TEST_ASSERT(lines[2].empty());
+        EDGE_LEARNING_TEST_EQUAL(lines[4], "5,6");
+        EDGE_LEARNING_TEST_ASSERT(lines[5].empty());
+        EDGE_LEARNING_TEST_THROWS(CSVLines{""}, std::runtime_error);
+
+        auto csv = CSV(fp.string());
+        EDGE_LEARNING_TEST_EQUAL(csv.rows_size(), 4);
+        EDGE_LEARNING_TEST_EQUAL(csv[3].line(), "3,4");
+        EDGE_LEARNING_TEST_EQUAL(csv[1].line(), "1,2");
+        EDGE_LEARNING_TEST_EQUAL(csv[5].line(), "1,2");
+        auto it = csv.begin();
+        ++it; ++it;
+        EDGE_LEARNING_TEST_EQUAL(it->line(), "3,4");
+        --it; --it;
+        EDGE_LEARNING_TEST_EQUAL(it->line(), "1,2");
+        EDGE_LEARNING_TEST_EQUAL(csv.to_mat<int>()[3][1], 4);
+        EDGE_LEARNING_TEST_EQUAL(csv.to_vec<int>().size(), 8);
+
+        auto csv_big = CSV(data_training_fp.string());
+        auto rows = std::vector<std::string>(csv_big);
+        for (std::size_t i = csv_big.rows_size(); i-- > 0; )
+        {
+            EDGE_LEARNING_TEST_EQUAL(csv_big[i].line(), rows[i]);
+        }
+    }
+
+    void test_csv_entries() {
+        auto csv = CSV(data_training_fp.string());
+        auto mat = csv.to_mat<NumType>();
+        auto data = csv.entries();
+        EDGE_LEARNING_TEST_EQUAL(data.size(),
+                                 csv.entries_amount() * csv.cols_size());
+        for (std::size_t r = 0; r < csv.entries_amount(); ++r)
+        {
+            for (std::size_t c = 0; c < csv.cols_size(); ++c)
+            {
+                EDGE_LEARNING_TEST_EQUAL(
+                    data[r * csv.cols_size() + c], mat[r + 1][c]);
+            }
+        }
+        EDGE_LEARNING_TEST_ASSERT(csv.entry(5) == mat[6]);
+
+        // Enough bytes to split the rows in several chunks.
+        const std::filesystem::path fp{"csv_entries.csv"};
+        const std::size_t rows = 200000;
+        std::ofstream out{fp, std::ios::trunc};
+        out << "a,b,c,d,e\n";
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            out << i << "," << static_cast<double>(i) * 0.5 << ",-" << i
+                << ", +" << i % 7 << ",\"x\"" << "\n";
+        }
+        out.close();
+        auto big = CSV(fp.string());
+        EDGE_LEARNING_TEST_EQUAL(big.entries_amount(), rows);
+        EDGE_LEARNING_TEST_ASSERT(
+            rows * 16 > 2 * CSV::PARALLEL_CHUNK_BYTES);
+        std::vector<float> buffer(rows * big.cols_size());
+        EDGE_LEARNING_TEST_TRY(big.entries(buffer.data(), 4));
+        bool equal = true;
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            const auto* row = buffer.data() + i * big.cols_size();
+            equal = equal && row[0] == static_cast<float>(i)
+                && row[1] == static_cast<float>(i) * 0.5f
+                && row[2] == -static_cast<float>(i)
+                && row[3] == static_cast<float>(i % 7)
+                && row[4] == 0.0f;
+        }
+        EDGE_LEARNING_TEST_ASSERT(equal);
+        auto ints = std::vector<int>(rows * big.cols_size());
+        EDGE_LEARNING_TEST_TRY(big.entries(ints.data()));
+        EDGE_LEARNING_TEST_EQUAL(ints[7 * big.cols_size() + 2], -7);
+        EDGE_LEARNING_TEST_ASSERT(big.entries() == big.data_to_encoding());
+    }
+
+    void test_csv_types_sample() {
+        const std::filesystem::path fp{"csv_types.csv"};
+        std::ofstream out{fp, std::ios::trunc};
+        out << "i,f,b,s,n\n";
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            out << i << "," << (i == 9 ? "0.5" : "1") << ",true,"
+                << (i == 5 ? "\"s\"" : "2") << ",\n";
+        }
+        out.close();
+
+        using T = TypeChecker::Type;
+        auto csv = CSV(fp.string());
+        EDGE_LEARNING_TEST_EQUAL(csv.types(), std::vector<T>(
+            {T::INT, T::FLOAT, T::BOOL, T::STRING, T::NONE}));
+        EDGE_LEARNING_TEST_EQUAL(csv[9].types(), csv.types());
+        EDGE_LEARNING_TEST_EQUAL(csv[10][1].type(), T::FLOAT);
+
+        // Only the first entry.
+        csv = CSV(fp.string(), {T::AUTO}, ',', {}, 1);
+        EDGE_LEARNING_TEST_EQUAL(csv.types(), std::vector<T>(
+            {T::INT, T::INT, T::BOOL, T::INT, T::NONE}));
+
+        // The explicit types are not inferred.
+        auto types = std::vector<T>(5, T::STRING);
+        csv = CSV(fp.string(), types);
+        EDGE_LEARNING_TEST_EQUAL(csv.types(), types);
+        EDGE_LEARNING_TEST_EQUAL(csv[3].types(), types);
+    }
+
     void test_dataset_parser() {
         auto csv_dp = CSV(data_training_fp.string(),
                           { TypeChecker::Type::AUTO }, ',', {3, 4});
@@ -26,6 +26,8 @@
 #include "parser/json.hpp"
 #include "data/path.hpp"
 
+#include <limits>
+#include <sstream>
 #include <stdexcept>
 
 using namespace std;
@@ -41,6 +43,10 @@ public:
         EDGE_LEARNING_TEST_CALL(test_json_item());
         EDGE_LEARNING_TEST_CALL(test_json());
         EDGE_LEARNING_TEST_CALL(test_stream());
+        EDGE_LEARNING_TEST_CALL(test_native_leaf());
+        EDGE_LEARNING_TEST_CALL(test_copy_on_write());
+        EDGE_LEARNING_TEST_CALL(test_move());
+        EDGE_LEARNING_TEST_CALL(test_packed_list());
     }
 
 private:
@@ -149,7 +155,7 @@ private:
         JsonLeaf f = JsonLeaf(float(1.0));
         EDGE_LEARNING_TEST_EQUAL(jl.json_type(), JsonObject::JsonType::LEAF);
         EDGE_LEARNING_TEST_PRINT(f.value());
-        EDGE_LEARNING_TEST_EQUAL(f.value(), "1.000000");
+        EDGE_LEARNING_TEST_EQUAL(f.value(), "1.0");
         EDGE_LEARNING_TEST_EQUAL(f.type(), TypeChecker::Type::FLOAT);
         EDGE_LEARNING_TEST_EQUAL(f.as<int>(), 1);
         EDGE_LEARNING_TEST_EQUAL(static_cast<int>(f), 1);
@@ -212,7 +218,7 @@ private:
         EDGE_LEARNING_TEST_FAIL((void) jl.at(10));
         EDGE_LEARNING_TEST_THROWS((void) jl.at(10), std::runtime_error);
         EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(jl),
-                                 "[10,10.000000,\"string\",true]");
+                                 "[10,10.0,\"string\",true]");
         EDGE_LEARNING_TEST_EQUAL(jl.value().size(), jl.size());
         EDGE_LEARNING_TEST_EQUAL(
             static_cast<std::vector<std::string>>(jl).size(), jl.size());
@@ -292,7 +298,7 @@ private:
         EDGE_LEARNING_TEST_FAIL(jl[10]);
         EDGE_LEARNING_TEST_THROWS(jl[10], std::runtime_error);
         EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(jl),
-                                 "[10.000000,11.000000,12.500000,13.500000]");
+                                 "[10.0,11.0,12.5,13.5]");
         EDGE_LEARNING_TEST_EQUAL(
             static_cast<std::vector<std::string>>(jl).size(), jl.size());
         jl_vec = static_cast<std::vector<std::string>>(jl);
@@ -476,7 +482,7 @@ private:
         EDGE_LEARNING_TEST_FAIL((void) jd.at("key"));
         EDGE_LEARNING_TEST_THROWS((void) jd.at("key"), std::runtime_error);
         EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(jd),
-                                 "{\"a\":1.000000,\"b\":2.500000}");
+                                 "{\"a\":1.0,\"b\":2.5}");
         jd_map = static_cast<std::map<std::string, std::string>>(jd);
         EDGE_LEARNING_TEST_EQUAL(jd_map.size(), jd.size());
         for (const auto& e: jd_map)
@@ -617,7 +623,8 @@ private:
         EDGE_LEARNING_TEST_EQUAL(static_cast<double>(ji), 10.0);
         EDGE_LEARNING_TEST_EQUAL(static_cast<float>(ji), 10.0);
         EDGE_LEARNING_TEST_EQUAL(static_cast<bool>(ji), false);
-        int ji_int;
+        // Initialized: the conversion may throw inside the TRY.
+        int ji_int = 0;
         EDGE_LEARNING_TEST_TRY(ji.as<int>(ji_int));
         EDGE_LEARNING_TEST_EQUAL(ji_int, 10);
         EDGE_LEARNING_TEST_FAIL((void) ji.as_vec<std::string>());
@@ -665,7 +672,7 @@ private:
                                  JsonObject::JsonType::LEAF);
         EDGE_LEARNING_TEST_EQUAL(ji.value().json_type(),
                                  JsonObject::JsonType::LEAF);
-        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji), "1.000000");
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji), "1.0");
         ji = JsonItem(false);
         EDGE_LEARNING_TEST_PRINT(ji);
         EDGE_LEARNING_TEST_ASSERT(static_cast<bool>(ji) == false);
@@ -720,7 +727,7 @@ private:
                                  JsonObject::JsonType::LEAF);
         EDGE_LEARNING_TEST_EQUAL(ji.value().json_type(),
                                  JsonObject::JsonType::LEAF);
-        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji), "1.000000");
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji), "1.0");
         ji = false;
         EDGE_LEARNING_TEST_PRINT(ji);
         EDGE_LEARNING_TEST_ASSERT(static_cast<bool>(ji) == false);
@@ -754,7 +761,7 @@ private:
         EDGE_LEARNING_TEST_EQUAL(ji.value().json_type(),
                                  JsonObject::JsonType::LIST);
         EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji),
-                                 "[10,\"test1\",false,\"test1\",1.000000]");
+                                 "[10,\"test1\",false,\"test1\",1.0]");
         EDGE_LEARNING_TEST_EQUAL(static_cast<int>(ji[0]), 10);
         EDGE_LEARNING_TEST_EQUAL(static_cast<int>(ji.at(0)), 10);
         EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ji[1]), "test1");
@@ -1061,6 +1068,184 @@ private:
         fs::remove(fs::path("tmp.json"));
     }
 
+    void test_native_leaf()
+    {
+        JsonLeaf f = JsonLeaf(0.1234567);
+        EDGE_LEARNING_TEST_EQUAL(f.type(), TypeChecker::Type::FLOAT);
+        EDGE_LEARNING_TEST_EQUAL(f.as<double>(), 0.1234567);
+        EDGE_LEARNING_TEST_EQUAL(f.value(), "0.1234567");
+        EDGE_LEARNING_TEST_EQUAL(f, JsonLeaf("0.1234567"));
+        EDGE_LEARNING_TEST_ASSERT(f != JsonLeaf(0.1234571));
+        EDGE_LEARNING_TEST_ASSERT(f != JsonLeaf(0.123));
+
+        // The native floats are written back without losing precision.
+        std::stringstream floats("[0.123456789,1e-9,{\"a\":2.0}]");
+        Json parsed;
+        floats >> parsed;
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(parsed),
+                                 "[0.123456789,1e-09,{\"a\":2.0}]");
+        EDGE_LEARNING_TEST_EQUAL(JsonLeaf(2.0).value(), "2.0");
+        EDGE_LEARNING_TEST_EQUAL(JsonLeaf(1e-9).type(),
+                                 JsonLeaf(JsonLeaf(1e-9).value()).type());
+
+        JsonLeaf i = JsonLeaf(-42L);
+        EDGE_LEARNING_TEST_EQUAL(i.type(), TypeChecker::Type::INT);
+        EDGE_LEARNING_TEST_EQUAL(i.as<int>(), -42);
+        EDGE_LEARNING_TEST_EQUAL(i.as<double>(), -42.0);
+        EDGE_LEARNING_TEST_EQUAL(i, JsonLeaf("-42"));
+        EDGE_LEARNING_TEST_ASSERT(i != JsonLeaf(-42.0));
+
+        auto big = std::numeric_limits<unsigned long long>::max();
+        JsonLeaf u = JsonLeaf(big);
+        EDGE_LEARNING_TEST_EQUAL(u.type(), TypeChecker::Type::INT);
+        EDGE_LEARNING_TEST_EQUAL(u.as<unsigned long long>(), big);
+
+        JsonLeaf b = JsonLeaf(false);
+        EDGE_LEARNING_TEST_EQUAL(b.as<bool>(), false);
+        EDGE_LEARNING_TEST_EQUAL(b.value(), "false");
+        b.value(3.5);
+        EDGE_LEARNING_TEST_EQUAL(b.type(), TypeChecker::Type::FLOAT);
+        EDGE_LEARNING_TEST_EQUAL(b.as<double>(), 3.5);
+
+        // The parsed numbers keep the precision of the text.
+        std::stringstream ss("[0.1234567, 12345678901, 1e-3]");
+        Json j;
+        ss >> j;
+        EDGE_LEARNING_TEST_EQUAL(j[0].as<double>(), 0.1234567);
+        EDGE_LEARNING_TEST_EQUAL(j[1].as<long long>(), 12345678901LL);
+        EDGE_LEARNING_TEST_EQUAL(j[2].as<double>(), 1e-3);
+    }
+
+    void test_copy_on_write()
+    {
+        Json weights = JsonList(std::vector<double>({1.0, 2.0, 3.0}));
+        Json model;
+        model["weights"] = weights;
+        model["name"] = "model";
+
+        // The copies share the subtrees.
+        Json copy = model;
+        EDGE_LEARNING_TEST_EQUAL(&copy.at("weights").value(),
+                                 &model.at("weights").value());
+        EDGE_LEARNING_TEST_EQUAL(copy, model);
+
+        // A write copies the modified path only.
+        copy["weights"][1] = 5.0;
+        copy["other"] = 1;
+        EDGE_LEARNING_TEST_EQUAL(copy["weights"][1].as<double>(), 5.0);
+        EDGE_LEARNING_TEST_EQUAL(model["weights"][1].as<double>(), 2.0);
+        EDGE_LEARNING_TEST_EQUAL(weights[1].as<double>(), 2.0);
+        EDGE_LEARNING_TEST_EQUAL(model.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(copy.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(&copy.at("name").value(),
+                                 &model.at("name").value());
+
+        Json list = std::vector<JsonItem>({1, 2});
+        Json list_copy = list;
+        list_copy.append(3);
+        EDGE_LEARNING_TEST_EQUAL(list.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(list_copy.size(), 3);
+    }
+
+    void test_move()
+    {
+        Json src = JsonList(std::vector<int>({1, 2, 3}));
+        const auto* list = &src.value();
+        Json dst = std::move(src);
+        EDGE_LEARNING_TEST_EQUAL(&dst.value(), list);
+        EDGE_LEARNING_TEST_EQUAL(src.json_type(), JsonObject::JsonType::NONE);
+        EDGE_LEARNING_TEST_EQUAL(src.size(), 0);
+
+        Json other;
+        other = std::move(dst);
+        EDGE_LEARNING_TEST_EQUAL(&other.value(), list);
+        EDGE_LEARNING_TEST_EQUAL(other.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(dst.json_type(), JsonObject::JsonType::NONE);
+    }
+
+    void test_packed_list()
+    {
+        JsonList floats(std::vector<double>({1.0, 2.5, -3.0}));
+        EDGE_LEARNING_TEST_ASSERT(floats.is_packed());
+        EDGE_LEARNING_TEST_EQUAL(floats.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(floats.packed()[1], 2.5);
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(floats),
+                                 "[1.0,2.5,-3.0]");
+        EDGE_LEARNING_TEST_EQUAL(
+            static_cast<std::string>(
+                JsonList(std::vector<double>({0.1234567, 1e-9}))),
+            "[0.1234567,1e-09]");
+        JsonList ints(std::vector<int>({1, -2}));
+        EDGE_LEARNING_TEST_ASSERT(ints.is_packed());
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(ints), "[1,-2]");
+
+        // A streamed list keeps the packed numbers.
+        std::istringstream in{"[1,2,3]"};
+        JsonList read;
+        in >> read;
+        EDGE_LEARNING_TEST_EQUAL(read.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(read), "[1,2,3]");
+        EDGE_LEARNING_TEST_ASSERT(!JsonList(std::vector<unsigned long long>(
+            {std::numeric_limits<unsigned long long>::max()})).is_packed());
+        EDGE_LEARNING_TEST_ASSERT(
+            !JsonList(std::vector<bool>({true})).is_packed());
+
+        // The conversions copy the packed numbers.
+        auto v = floats.as<double>();
+        EDGE_LEARNING_TEST_EQUAL(v.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(v[2], -3.0);
+        EDGE_LEARNING_TEST_EQUAL(floats.as<int>()[1], 2);
+        EDGE_LEARNING_TEST_EQUAL(floats.as<std::string>()[1], "2.5");
+        float row[3];
+        Json(floats).as_vec(row, 3);
+        EDGE_LEARNING_TEST_EQUAL(row[1], 2.5f);
+        EDGE_LEARNING_TEST_THROWS(Json(floats).as_vec(row, 2),
+                                  std::runtime_error);
+
+        // The parsed homogeneous lists are packed.
+        std::stringstream ss("[[0.5, 1e-3], [1, 2], [1, 2.5], []]");
+        Json j;
+        ss >> j;
+        const auto& parsed = dynamic_cast<const JsonList&>(j.value());
+        auto row_list = [&parsed](std::size_t i) -> const JsonList& {
+            return dynamic_cast<const JsonList&>(parsed.value()[i].value());
+        };
+        EDGE_LEARNING_TEST_ASSERT(row_list(0).is_packed());
+        EDGE_LEARNING_TEST_EQUAL(row_list(0).packed()[1], 1e-3);
+        EDGE_LEARNING_TEST_ASSERT(row_list(1).is_packed());
+        EDGE_LEARNING_TEST_ASSERT(!row_list(2).is_packed());
+        EDGE_LEARNING_TEST_EQUAL(j[2][0].as<int>(), 1);
+        EDGE_LEARNING_TEST_EQUAL(j.at(1),
+                                 Json(JsonList(std::vector<int>({1, 2}))));
+
+        // An access by reference unpacks the list.
+        Json packed = floats;
+        EDGE_LEARNING_TEST_EQUAL(packed[1].as<double>(), 2.5);
+        packed[1] = "x";
+        EDGE_LEARNING_TEST_EQUAL(static_cast<std::string>(packed),
+                                 "[1.0,\"x\",-3.0]");
+        EDGE_LEARNING_TEST_ASSERT(floats.is_packed());
+        packed.append(4.0);
+        EDGE_LEARNING_TEST_EQUAL(packed.size(), 4);
+
+        // Equality between packed and not packed lists.
+        Json items = std::vector<JsonItem>({1.0, 2.5, -3.0});
+        EDGE_LEARNING_TEST_EQUAL(items, Json(floats));
+        EDGE_LEARNING_TEST_ASSERT(Json(floats) != Json(ints));
+        EDGE_LEARNING_TEST_ASSERT(floats.is_packed());
+
+        // The const accesses read the packed numbers without unpacking.
+        const JsonList& const_floats = floats;
+        EDGE_LEARNING_TEST_EQUAL(const_floats.at(1).as<double>(), 2.5);
+        EDGE_LEARNING_TEST_EQUAL(Json(floats).at(2).as<double>(), -3.0);
+        EDGE_LEARNING_TEST_ASSERT(floats.is_packed());
+        EDGE_LEARNING_TEST_THROWS((void) const_floats.value(),
+                                  std::runtime_error);
+        floats.unpack();
+        EDGE_LEARNING_TEST_ASSERT(!floats.is_packed());
+        EDGE_LEARNING_TEST_EQUAL(const_floats.value().size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(items, Json(floats));
+    }
 };
 
 int main() {
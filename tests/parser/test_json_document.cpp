@@ -0,0 +1,217 @@
+/***************************************************************************
+ *            parser/test_json_document.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "parser/json.hpp"
+#include "parser/json_document.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+using namespace std;
+using namespace EdgeLearning;
+
+/**
+ * \brief Stream buffer that can not seek and gives one character a time.
+ */
+class UnseekableBuf : public std::streambuf {
+public:
+    explicit UnseekableBuf(std::string text) : _text{std::move(text)} { }
+
+protected:
+    int_type underflow() override
+    {
+        if (_pos >= _text.size()) return traits_type::eof();
+        setg(&_text[_pos], &_text[_pos], &_text[_pos] + 1);
+        ++_pos;
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    std::string _text;
+    std::size_t _pos = 0;
+};
+
+class TestJsonDocument {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_leaves());
+        EDGE_LEARNING_TEST_CALL(test_containers());
+        EDGE_LEARNING_TEST_CALL(test_strings());
+        EDGE_LEARNING_TEST_CALL(test_prefix());
+        EDGE_LEARNING_TEST_CALL(test_json());
+        EDGE_LEARNING_TEST_CALL(test_errors());
+    }
+
+private:
+    void test_leaves()
+    {
+        JsonDocument d{" -12 "};
+        EDGE_LEARNING_TEST_ASSERT(d.root().type() == JsonDocument::Type::NUMBER);
+        EDGE_LEARNING_TEST_ASSERT(d.root().is_integer());
+        EDGE_LEARNING_TEST_EQUAL(d.root().as_number<int>(), -12);
+        EDGE_LEARNING_TEST_EQUAL(d.root().text(), "-12");
+        EDGE_LEARNING_TEST_EQUAL(d.consumed(), 5);
+
+        d = JsonDocument{"1.5e-3"};
+        EDGE_LEARNING_TEST_ASSERT(!d.root().is_integer());
+        EDGE_LEARNING_TEST_WITHIN(d.root().as_number<double>(), 1.5e-3, 1e-12);
+        EDGE_LEARNING_TEST_EQUAL(d.root().as_number<int>(), 0);
+
+        d = JsonDocument{"true"};
+        EDGE_LEARNING_TEST_ASSERT(d.root().type() == JsonDocument::Type::BOOL);
+        EDGE_LEARNING_TEST_ASSERT(d.root().as_bool());
+        d = JsonDocument{"null"};
+        EDGE_LEARNING_TEST_ASSERT(d.root().type() == JsonDocument::Type::NONE);
+
+        // Written by std::to_string.
+        d = JsonDocument{"[nan,-inf]"};
+        EDGE_LEARNING_TEST_ASSERT(std::isnan(d.root()[0].as_number<double>()));
+        EDGE_LEARNING_TEST_ASSERT(std::isinf(d.root()[1].as_number<double>()));
+        EDGE_LEARNING_TEST_ASSERT(!d.root()[0].is_integer());
+    }
+
+    void test_containers()
+    {
+        std::string text = "{\"a\": [1, [2, 3], {}], \"b\": {\"c\": []},"
+                           " \"d\": \"e\"}";
+        auto d = JsonDocument::view(text);
+        auto root = d.root();
+        EDGE_LEARNING_TEST_ASSERT(root.type() == JsonDocument::Type::DICT);
+        EDGE_LEARNING_TEST_EQUAL(root.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(d.node_count(), 14);
+        EDGE_LEARNING_TEST_ASSERT(root.contains("b"));
+        EDGE_LEARNING_TEST_ASSERT(!root.contains("e"));
+
+        auto a = root["a"];
+        EDGE_LEARNING_TEST_EQUAL(a.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(a[0].as_number<int>(), 1);
+        EDGE_LEARNING_TEST_EQUAL(a[1][1].as_number<int>(), 3);
+        EDGE_LEARNING_TEST_EQUAL(a[2].size(), 0);
+        EDGE_LEARNING_TEST_EQUAL(root["b"]["c"].size(), 0);
+        EDGE_LEARNING_TEST_EQUAL(root["d"].as_string(), "e");
+        // The siblings skip the subtrees.
+        EDGE_LEARNING_TEST_EQUAL(a.first_child().next().next().size(), 0);
+        // The leaves are views of the source text.
+        EDGE_LEARNING_TEST_EQUAL(root["d"].text().data(),
+                                 text.data() + text.find('e'));
+
+        EDGE_LEARNING_TEST_THROWS((void) root["x"], std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS((void) a[3], std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS((void) a.as_string(), std::runtime_error);
+    }
+
+    void test_strings()
+    {
+        // Long enough to be scanned in SIMD blocks.
+        std::string text = "[\"0123456789abcdef0123456789\","
+                           " \"quote \\\" and backslash \\\\ in a long string\","
+                           " \"\\n\\t\\u00e8\\u20ac\\ud83d\\ude00\"]";
+        auto d = JsonDocument::view(text);
+        EDGE_LEARNING_TEST_EQUAL(d.root()[0].as_string(),
+                                 "0123456789abcdef0123456789");
+        EDGE_LEARNING_TEST_EQUAL(d.root()[1].as_string(),
+                                 "quote \" and backslash \\ in a long string");
+        EDGE_LEARNING_TEST_EQUAL(d.root()[2].as_string(),
+                                 "\n\t\xc3\xa8\xe2\x82\xac\xf0\x9f\x98\x80");
+
+        // Escaped keys are decoded before the comparison.
+        auto e = JsonDocument{"{\"a\\\"b\": 1, \"\\u00e8\": 2}"};
+        EDGE_LEARNING_TEST_ASSERT(e.root().contains("a\"b"));
+        EDGE_LEARNING_TEST_ASSERT(e.root().contains("\xc3\xa8"));
+        EDGE_LEARNING_TEST_ASSERT(!e.root().contains("\\u00e8"));
+        EDGE_LEARNING_TEST_EQUAL(e.root()["\xc3\xa8"].as_number<int>(), 2);
+    }
+
+    void test_prefix()
+    {
+        std::string text = "[1, 2] {\"a\": 3}";
+        EDGE_LEARNING_TEST_THROWS(JsonDocument::view(text),
+                                  std::runtime_error);
+        auto d = JsonDocument::view(text, true);
+        EDGE_LEARNING_TEST_EQUAL(d.root().size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(d.consumed(), 7);
+        d = JsonDocument::view(std::string_view(text).substr(d.consumed()));
+        EDGE_LEARNING_TEST_EQUAL(d.root()["a"].as_number<int>(), 3);
+
+        // The stream operator leaves the stream after the value.
+        std::stringstream ss("[1, 2],\n{\"a\": 3}");
+        Json list;
+        Json dict;
+        ss >> list >> dict;
+        EDGE_LEARNING_TEST_EQUAL(list.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(dict["a"].as<int>(), 3);
+
+        // Only the value is read: a stream that can not seek keeps the rest.
+        UnseekableBuf buf("{\"s\": \"]}\\\"\"} 42,[true] \"x\"");
+        std::istream is(&buf);
+        Json first;
+        Json number;
+        Json third;
+        Json fourth;
+        is >> first >> number >> third >> fourth;
+        EDGE_LEARNING_TEST_EQUAL(first["s"].as<std::string>(), "]}\"");
+        EDGE_LEARNING_TEST_EQUAL(number.as<int>(), 42);
+        EDGE_LEARNING_TEST_EQUAL(third.size(), 1);
+        EDGE_LEARNING_TEST_EQUAL(fourth.as<std::string>(), "x");
+    }
+
+    void test_json()
+    {
+        Json expected = std::map<std::string, JsonItem>({
+            {"a", 10}, {"b", "string"}, {"c", true},
+            {"d", std::vector<JsonItem>({10, 1.0, "string", false})}});
+        std::stringstream ss;
+        ss << expected;
+        JsonDocument d{ss.str()};
+        Json json{d.root()};
+        EDGE_LEARNING_TEST_EQUAL(json, expected);
+        EDGE_LEARNING_TEST_EQUAL(json["d"][1].as<double>(), 1.0);
+
+        JsonLeaf leaf{JsonDocument{"5"}.root()};
+        EDGE_LEARNING_TEST_EQUAL(leaf.type(), TypeChecker::Type::INT);
+        EDGE_LEARNING_TEST_THROWS(JsonList{JsonDocument{"{}"}.root()},
+                                  std::runtime_error);
+        EDGE_LEARNING_TEST_THROWS(JsonDict{JsonDocument{"[]"}.root()},
+                                  std::runtime_error);
+    }
+
+    void test_errors()
+    {
+        for (const auto& text: {"", "[1, 2", "{\"a\" 1}", "{\"a\": 1,}",
+                                "[1 2]", "\"abc", "tru", "[1}", "{1: 2}",
+                                "@"})
+        {
+            EDGE_LEARNING_TEST_THROWS(JsonDocument{text}, std::runtime_error);
+        }
+    }
+};
+
+int main() {
+    TestJsonDocument().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
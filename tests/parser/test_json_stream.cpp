@@ -0,0 +1,275 @@
+/***************************************************************************
+ *            parser/test_json_stream.cpp
+ *
+ *  Copyright  2021  Mirco De Marchi
+ *
+ ****************************************************************************/
+
+/*
+ *  This file is part of EdgeLearning.
+ *
+ *  EdgeLearning is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  EdgeLearning is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with EdgeLearning.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.hpp"
+#include "parser/json_stream.hpp"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace EdgeLearning;
+
+class TestJsonStream {
+public:
+    void test() {
+        EDGE_LEARNING_TEST_CALL(test_writer());
+        EDGE_LEARNING_TEST_CALL(test_numbers());
+        EDGE_LEARNING_TEST_CALL(test_reader());
+        EDGE_LEARNING_TEST_CALL(test_escapes());
+        EDGE_LEARNING_TEST_CALL(test_read_numbers());
+        EDGE_LEARNING_TEST_CALL(test_compatibility());
+        EDGE_LEARNING_TEST_CALL(test_errors());
+    }
+
+private:
+    void test_writer()
+    {
+        std::ostringstream oss;
+        {
+            JsonWriter w{oss};
+            w.begin_object();
+            w.key("name");
+            w.value("layer \"a\"");
+            w.key("size");
+            w.value(3UL);
+            w.key("flag");
+            w.value(true);
+            Json meta;
+            meta["x"] = 1;
+            meta["y"] = "b";
+            w.members(meta);
+            w.key("empty");
+            w.begin_array();
+            w.end_array();
+            std::vector<double> t = {1.5, -2.0, 0.25, 4.0, 5.0, 6.0};
+            w.key("tensor");
+            w.tensor(t.data(), {2, 3});
+            w.end_object();
+        }
+        EDGE_LEARNING_TEST_EQUAL(oss.str(),
+            "{\"name\":\"layer \\\"a\\\"\",\"size\":3,\"flag\":true,"
+            "\"x\":1,\"y\":\"b\",\"empty\":[],"
+            "\"tensor\":[[1.5,-2,0.25],[4,5,6]]}");
+
+        std::ostringstream closed;
+        JsonWriter w{closed};
+        EDGE_LEARNING_TEST_THROWS(w.end_object(), std::runtime_error);
+    }
+
+    void test_numbers()
+    {
+        // The shortest representation reads back to the same value.
+        std::vector<double> values = {
+            0.1, 1.0 / 3.0, -2.5e-300, 6.02214076e23,
+            std::numeric_limits<double>::min(),
+            std::numeric_limits<double>::max(),
+            std::nextafter(1.0, 2.0)
+        };
+        std::stringstream ss;
+        {
+            JsonWriter w{ss};
+            w.tensor(values.data(), {values.size()});
+        }
+        EDGE_LEARNING_TEST_ASSERT(ss.str().find("0.1,") != std::string::npos);
+
+        std::vector<double> read(values.size());
+        JsonReader r{ss};
+        r.read_numbers<double>({{read.data(), read.size()}});
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            EDGE_LEARNING_TEST_EQUAL(read[i], values[i]);
+        }
+    }
+
+    void test_reader()
+    {
+        std::istringstream iss{
+            " { \"name\" : \"a\\\"b\", \"shape\": [ [1, 2], [3] ],\n"
+            "   \"rate\": 0.5, \"on\": false, \"none\": null,"
+            "   \"dict\": {\"k\": [], \"d\": {}} } "};
+        JsonReader r{iss};
+        r.begin_object();
+        std::string key;
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(key, "name");
+        EDGE_LEARNING_TEST_EQUAL(r.read_string(), "a\"b");
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(key, "shape");
+        auto shape = r.read();
+        EDGE_LEARNING_TEST_EQUAL(shape.size(), 2);
+        EDGE_LEARNING_TEST_EQUAL(shape[0][1].as<int>(), 2);
+        EDGE_LEARNING_TEST_EQUAL(shape[1][0].as<int>(), 3);
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(r.read_number(), 0.5);
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(r.read().as<bool>(), false);
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(r.read().json_type(),
+                                 JsonObject::JsonType::NONE);
+        EDGE_LEARNING_TEST_ASSERT(r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(key, "dict");
+        EDGE_LEARNING_TEST_TRY(r.skip());
+        EDGE_LEARNING_TEST_ASSERT(!r.next_key(key));
+        EDGE_LEARNING_TEST_EQUAL(key, "dict");
+    }
+
+    void test_escapes()
+    {
+        // Control characters and non-finite numbers are valid JSON.
+        std::stringstream ss;
+        {
+            JsonWriter w{ss};
+            w.begin_array();
+            w.value(std::string("a\nb\t\x01\"\\"));
+            w.value(std::numeric_limits<double>::quiet_NaN());
+            w.value(std::numeric_limits<double>::infinity());
+            w.value(1.0);
+            w.end_array();
+        }
+        EDGE_LEARNING_TEST_EQUAL(ss.str(),
+            "[\"a\\u000ab\\u0009\\u0001\\\"\\\\\",null,null,1]");
+
+        JsonReader r{ss};
+        r.begin_array();
+        EDGE_LEARNING_TEST_ASSERT(r.next_item());
+        EDGE_LEARNING_TEST_EQUAL(r.read_string(), "a\nb\t\x01\"\\");
+        EDGE_LEARNING_TEST_ASSERT(r.next_item());
+        EDGE_LEARNING_TEST_ASSERT(std::isnan(r.read_number()));
+        std::vector<double> v;
+        EDGE_LEARNING_TEST_ASSERT(r.next_item());
+        r.read_numbers(v);
+        EDGE_LEARNING_TEST_ASSERT(std::isnan(v[0]));
+        EDGE_LEARNING_TEST_ASSERT(r.next_item());
+        EDGE_LEARNING_TEST_EQUAL(r.read_number(), 1.0);
+        EDGE_LEARNING_TEST_ASSERT(!r.next_item());
+
+        // Short escapes and UTF-16 code units, also as surrogate pairs.
+        std::istringstream iss{
+            "\"\\n\\t\\r\\b\\f\\/\\u00e9\\u20AC\\ud83d\\ude00\""};
+        JsonReader r_escapes{iss};
+        EDGE_LEARNING_TEST_EQUAL(r_escapes.read_string(),
+            "\n\t\r\b\f/\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+    }
+
+    void test_read_numbers()
+    {
+        std::istringstream iss{"[[[1,2],[3]],[4,5,6]] [1,2] [1,2,3]"};
+        JsonReader r{iss};
+        std::vector<double> a(3), b(3);
+        r.read_numbers<double>({{a.data(), a.size()}, {b.data(), b.size()}});
+        EDGE_LEARNING_TEST_EQUAL(a[2], 3);
+        EDGE_LEARNING_TEST_EQUAL(b[0], 4);
+        EDGE_LEARNING_TEST_EQUAL(b[2], 6);
+        EDGE_LEARNING_TEST_THROWS(
+            r.read_numbers<double>({{a.data(), a.size()}}),
+            std::runtime_error);
+
+        JsonReader r_more{iss};
+        std::vector<float> c(2);
+        EDGE_LEARNING_TEST_THROWS(
+            r_more.read_numbers<float>({{c.data(), c.size()}}),
+            std::runtime_error);
+
+        std::istringstream flat_iss{"[[0.5,1],[-1e-3]]"};
+        JsonReader flat_r{flat_iss};
+        std::vector<double> flat;
+        flat_r.read_numbers(flat);
+        EDGE_LEARNING_TEST_EQUAL(flat.size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(flat[2], -1e-3);
+    }
+
+    void test_compatibility()
+    {
+        // A stream written by JsonWriter is read by the Json parser.
+        std::stringstream ss;
+        {
+            JsonWriter w{ss};
+            w.begin_object();
+            w.key("b");
+            std::vector<double> t = {0.125, -3};
+            w.tensor(t.data(), {2});
+            w.key("a");
+            w.value("x");
+            w.end_object();
+        }
+        Json j;
+        ss >> j;
+        EDGE_LEARNING_TEST_EQUAL(j["a"].as<std::string>(), "x");
+        EDGE_LEARNING_TEST_EQUAL(j["b"][0].as<double>(), 0.125);
+        EDGE_LEARNING_TEST_EQUAL(j["b"][1].as<double>(), -3);
+
+        // A Json dump is read by JsonReader.
+        std::stringstream dump;
+        dump << j;
+        JsonReader r{dump};
+        auto read = r.read();
+        EDGE_LEARNING_TEST_EQUAL(read["a"].as<std::string>(), "x");
+        EDGE_LEARNING_TEST_EQUAL(read["b"][0].as<double>(), 0.125);
+    }
+
+    void test_errors()
+    {
+        std::istringstream not_object{"[1]"};
+        JsonReader r_array{not_object};
+        EDGE_LEARNING_TEST_THROWS(r_array.begin_object(), std::runtime_error);
+
+        std::istringstream missing_comma{"[1 2]"};
+        JsonReader r_comma{missing_comma};
+        std::vector<double> v;
+        EDGE_LEARNING_TEST_THROWS(r_comma.read_numbers(v),
+                                  std::runtime_error);
+
+        std::istringstream bad_number{"[1.2.3]"};
+        JsonReader r_number{bad_number};
+        EDGE_LEARNING_TEST_THROWS(r_number.read_numbers(v),
+                                  std::runtime_error);
+
+        std::istringstream unterminated{"\"abc"};
+        JsonReader r_string{unterminated};
+        EDGE_LEARNING_TEST_THROWS(r_string.read_string(),
+                                  std::runtime_error);
+
+        std::istringstream bad_escape{"\"\\x\""};
+        JsonReader r_escape{bad_escape};
+        EDGE_LEARNING_TEST_THROWS(r_escape.read_string(),
+                                  std::runtime_error);
+
+        std::istringstream lone_surrogate{"\"\\ud83d\""};
+        JsonReader r_surrogate{lone_surrogate};
+        EDGE_LEARNING_TEST_THROWS(r_surrogate.read_string(),
+                                  std::runtime_error);
+
+        std::istringstream bad_word{"nope"};
+        JsonReader r_word{bad_word};
+        EDGE_LEARNING_TEST_THROWS(r_word.read(), std::runtime_error);
+    }
+};
+
+int main() {
+    TestJsonStream().test();
+    return EDGE_LEARNING_TEST_FAILURES;
+}
@@ -28,6 +28,7 @@
 
 #include <vector>
 #include <stdexcept>
+#include <fstream>
 
 using namespace std;
 using namespace EdgeLearning;
@@ -40,6 +41,7 @@ public:
         EDGE_LEARNING_TEST_CALL(test_mnist_label());
         EDGE_LEARNING_TEST_CALL(test_mnist());
         EDGE_LEARNING_TEST_CALL(test_dataset_parser());
+        EDGE_LEARNING_TEST_CALL(test_entries());
     }
 private:
     const std::string FIRST10_TRAINING_IMAGES_FN =
@@ -236,6 +238,81 @@ private:
                                  mnist_dp.width() * mnist_dp.height() + 1);
         EDGE_LEARNING_TEST_EQUAL(mnist_dp.labels_idx().size(), 1);
     }
+
+    static void _write_uint32(std::ofstream& out, std::uint32_t v)
+    {
+        uint32_endian_order(v);
+        out.write(reinterpret_cast<char*>(&v), 4);
+    }
+
+    void test_entries() {
+        // The header declares one image more than the files contain.
+        const std::size_t amount = 1100;
+        const fs::path images_fp{"entries-images-idx3-ubyte"};
+        const fs::path labels_fp{"entries-labels-idx1-ubyte"};
+        std::ofstream images{images_fp, std::ios::binary | std::ios::trunc};
+        _write_uint32(images, Mnist::IMAGE_MAGIC);
+        _write_uint32(images, amount + 1);
+        _write_uint32(images, MnistImage::IMAGE_SIDE);
+        _write_uint32(images, MnistImage::IMAGE_SIDE);
+        std::ofstream labels{labels_fp, std::ios::binary | std::ios::trunc};
+        _write_uint32(labels, Mnist::LABEL_MAGIC);
+        _write_uint32(labels, amount + 1);
+        for (std::size_t i = 0; i < amount; ++i)
+        {
+            for (std::size_t j = 0; j < Mnist::IMAGE_BYTES; ++j)
+            {
+                images.put(static_cast<char>((i + j) % 256));
+            }
+            labels.put(static_cast<char>(i % 10));
+        }
+        images.close();
+        labels.close();
+
+        auto mnist = Mnist(images_fp, labels_fp);
+        EDGE_LEARNING_TEST_EQUAL(mnist.size(), amount + 1);
+        EDGE_LEARNING_TEST_EQUAL(mnist.image_data(3)[5], 8);
+        EDGE_LEARNING_TEST_EQUAL(mnist.image_data(3),
+                                 mnist.image_data(amount + 4));
+        EDGE_LEARNING_TEST_EQUAL(mnist.label_data(13), 3);
+        EDGE_LEARNING_TEST_EQUAL(mnist.image(7).data()[2], 9);
+        EDGE_LEARNING_TEST_EQUAL(mnist.label(7).data(), 7);
+
+        auto data = mnist.entries();
+        const auto fsize = mnist.feature_size();
+        EDGE_LEARNING_TEST_EQUAL(data.size(), (amount + 1) * fsize);
+        bool equal = true;
+        for (std::size_t i = 0; i < amount; ++i)
+        {
+            for (std::size_t j = 0; j < Mnist::IMAGE_BYTES; ++j)
+            {
+                equal = equal && data[i * fsize + j]
+                    == static_cast<NumType>((i + j) % 256);
+            }
+            equal = equal && data[i * fsize + Mnist::IMAGE_BYTES]
+                == static_cast<NumType>(i % 10);
+        }
+        EDGE_LEARNING_TEST_ASSERT(equal);
+        EDGE_LEARNING_TEST_ASSERT(mnist.entry(5) == std::vector<NumType>(
+            data.begin() + static_cast<std::ptrdiff_t>(5 * fsize),
+            data.begin() + static_cast<std::ptrdiff_t>(6 * fsize)));
+
+        // The truncated entry is zeros.
+        EDGE_LEARNING_TEST_ASSERT(mnist.entry(amount)
+                                  == std::vector<NumType>(fsize, 0.0));
+
+        std::vector<float> floats((amount + 1) * fsize);
+        EDGE_LEARNING_TEST_TRY(mnist.entries(floats.data(), 3));
+        equal = true;
+        for (std::size_t k = 0; k < floats.size(); ++k)
+        {
+            equal = equal && floats[k] == static_cast<float>(data[k]);
+        }
+        EDGE_LEARNING_TEST_ASSERT(equal);
+
+        fs::remove(images_fp);
+        fs::remove(labels_fp);
+    }
 };
 
 int main() {
@@ -47,6 +47,7 @@ public:
     }
 
     std::vector<NumType> entry(SizeType i) override {
+        ++_entry_calls;
         if (i >= _entries_amount) return {};
 
         std::vector<NumType> ret(_feature_size);
@@ -73,6 +74,7 @@ public:
     SizeType _feature_size;
     SizeType _entries_amount;
     std::set<SizeType> _labels_idx;
+    SizeType _entry_calls = 0;
 };
 
 
@@ -81,6 +83,7 @@ public:
     void test() {
         EDGE_LEARNING_TEST_CALL(test_parser());
         EDGE_LEARNING_TEST_CALL(test_dataset_parser());
+        EDGE_LEARNING_TEST_CALL(test_one_hot_single_pass());
     }
 
 private:
@@ -180,6 +183,59 @@ private:
             EDGE_LEARNING_TEST_EQUAL(data_one_hot_encoding[i], test_v[i]);
         }
     }
+
+    void test_one_hot_single_pass() {
+        std::vector<NumType> v;
+        SizeType entries_amount = 5000;
+        for (SizeType i = 0; i < entries_amount; ++i)
+        {
+            v.insert(v.end(), {NumType(i), NumType(i % 3), NumType(i % 7)});
+        }
+        auto edp = ExampleDatasetParser(v, 3, {1, 2});
+        auto one_hot = ExampleDatasetParser::LabelEncoding::ONE_HOT_ENCODING;
+
+        auto data = edp.data_to_encoding(one_hot);
+        EDGE_LEARNING_TEST_EQUAL(edp.encoding_feature_size(one_hot), 1+3+7);
+        EDGE_LEARNING_TEST_EQUAL(edp.encoding_labels_idx(one_hot).size(), 3+7);
+        EDGE_LEARNING_TEST_EQUAL(edp.unique(1).size(), 3);
+        EDGE_LEARNING_TEST_EQUAL(edp.unique_map(2).size(), 7);
+        EDGE_LEARNING_TEST_EQUAL(edp._entry_calls, entries_amount);
+
+        EDGE_LEARNING_TEST_EQUAL(data.size(), entries_amount * (1+3+7));
+        for (SizeType i = 0; i < entries_amount; ++i)
+        {
+            const auto* row = data.data() + i * (1+3+7);
+            EDGE_LEARNING_TEST_EQUAL(row[0], NumType(i));
+            for (SizeType j = 0; j < 3; ++j)
+            {
+                EDGE_LEARNING_TEST_ASSERT(
+                    row[1 + j] == (j == i % 3 ? NumType(1) : NumType(0)));
+            }
+            for (SizeType j = 0; j < 7; ++j)
+            {
+                EDGE_LEARNING_TEST_ASSERT(
+                    row[4 + j] == (j == i % 7 ? NumType(1) : NumType(0)));
+            }
+        }
+
+        auto class_index = edp.data_to_encoding(
+            ExampleDatasetParser::LabelEncoding::CLASS_INDEX_ENCODING);
+        EDGE_LEARNING_TEST_EQUAL(class_index.size(), v.size());
+        EDGE_LEARNING_TEST_ASSERT(class_index == v);
+
+        auto data_again = edp.data_to_encoding(one_hot);
+        EDGE_LEARNING_TEST_ASSERT(data_again == data);
+        edp.clear_encoding_cache();
+        EDGE_LEARNING_TEST_EQUAL(edp.encoding_feature_size(one_hot), 1+3+7);
+
+        // The sizes and the input values are collected one entry at a time.
+        auto fresh = ExampleDatasetParser(v, 3, {1, 2});
+        EDGE_LEARNING_TEST_EQUAL(fresh.encoding_feature_size(one_hot), 1+3+7);
+        EDGE_LEARNING_TEST_EQUAL(fresh._entry_calls, entries_amount);
+        EDGE_LEARNING_TEST_EQUAL(fresh.unique(0).size(), entries_amount);
+        EDGE_LEARNING_TEST_EQUAL(fresh._entry_calls, 2 * entries_amount);
+        EDGE_LEARNING_TEST_ASSERT(fresh.data_to_encoding(one_hot) == data);
+    }
 };
 
 int main() {
@@ -28,6 +28,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <string_view>
 
 
 using namespace std;
@@ -39,6 +40,8 @@ public:
         EDGE_LEARNING_TEST_CALL(test_type());
         EDGE_LEARNING_TEST_CALL(test_parse());
         EDGE_LEARNING_TEST_CALL(test_is());
+        EDGE_LEARNING_TEST_CALL(test_parse_edge_cases());
+        EDGE_LEARNING_TEST_CALL(test_merge());
         EDGE_LEARNING_TEST_CALL(test_convert());
     }
 
@@ -104,6 +107,53 @@ private:
         EDGE_LEARNING_TEST_ASSERT(TypeChecker::is_string("edgelearning123dl"));
     }
 
+    void test_parse_edge_cases() {
+        auto test_vec = std::map<std::string, TypeChecker::Type>{
+            { "0",         TypeChecker::Type::INT    },
+            { "007",       TypeChecker::Type::FLOAT  },
+            { "-.5",       TypeChecker::Type::FLOAT  },
+            { "1e5",       TypeChecker::Type::FLOAT  },
+            { "2.5E+3",    TypeChecker::Type::FLOAT  },
+            { "1.",        TypeChecker::Type::STRING },
+            { ".",         TypeChecker::Type::STRING },
+            { "1e",        TypeChecker::Type::STRING },
+            { "1e+",       TypeChecker::Type::STRING },
+            { "+",         TypeChecker::Type::STRING },
+            { "--1",       TypeChecker::Type::STRING },
+            { "1.2.3",     TypeChecker::Type::STRING },
+            { " 1",        TypeChecker::Type::STRING },
+            { "nan",       TypeChecker::Type::STRING },
+            { "True",      TypeChecker::Type::STRING },
+            { "\"",        TypeChecker::Type::STRING },
+            { "\"\"",      TypeChecker::Type::STRING },
+            { "\"1\"",     TypeChecker::Type::STRING },
+        };
+        for (const auto& [key, value]: test_vec)
+        {
+            EDGE_LEARNING_TEST_EQUAL(TypeChecker::parse(key), value);
+        }
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::parse(std::string_view{"12,3"}.substr(0, 2)),
+            TypeChecker::Type::INT);
+    }
+
+    void test_merge() {
+        using T = TypeChecker::Type;
+        EDGE_LEARNING_TEST_EQUAL(TypeChecker::merge(T::INT, T::INT), T::INT);
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::merge(T::INT, T::FLOAT), T::FLOAT);
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::merge(T::FLOAT, T::INT), T::FLOAT);
+        EDGE_LEARNING_TEST_EQUAL(TypeChecker::merge(T::NONE, T::BOOL), T::BOOL);
+        EDGE_LEARNING_TEST_EQUAL(TypeChecker::merge(T::INT, T::AUTO), T::INT);
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::merge(T::BOOL, T::INT), T::STRING);
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::merge(T::FLOAT, T::STRING), T::STRING);
+        EDGE_LEARNING_TEST_EQUAL(
+            TypeChecker::merge(T::NONE, T::NONE), T::NONE);
+    }
+
     void test_convert() {
         float f;
         EDGE_LEARNING_TEST_ASSERT(convert("1.2", f));